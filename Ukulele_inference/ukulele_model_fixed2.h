@@ -53,6 +53,951 @@ static inline number_t clamp_to_number_t(long_number_t number) {
 
 
 #endif //__NUMBER_H__
+/**
+  ******************************************************************************
+  * @file    layer_params.h
+  * @version 1.0.0
+  * @date    17 october 2026
+  * @brief   Runtime shape descriptors emitted next to each generated layer
+  */
+
+#ifndef __LAYER_PARAMS_H__
+#define __LAYER_PARAMS_H__
+
+#include <stdint.h>
+
+typedef enum {
+  ACTIVATION_KIND_LINEAR = 0,
+  ACTIVATION_KIND_RELU,
+} activation_kind_t;
+
+// Same values as the INPUT_CHANNELS/INPUT_SAMPLES/... defines of a conv1d_*.c file, kept
+// after the #undef block so that generic kernels can be handed the shape of the layer
+typedef struct {
+  unsigned short input_channels;
+  unsigned short input_samples;
+  unsigned short filters;
+  unsigned short kernel_size;
+  unsigned short stride;
+  unsigned short zeropadding_left;
+  unsigned short zeropadding_right;
+  unsigned short outsamples;
+  activation_kind_t activation;
+  unsigned char requant_shift; // <LAYER>_REQUANT_SHIFT: input + weight - output fractional bits
+} conv1d_params_t;
+
+// Cache tiles of the vector conv kernel of conv1d_simd.h: each tile of blocks of conv positions
+// runs the filters and input channels in slices of these sizes. A zero size is chosen from the
+// shape of the layer, see conv1d_simd_tile().
+typedef struct {
+  unsigned short filters;   // rounded up to a multiple of 4
+  unsigned short blocks;    // blocks of 2 * SIMD_LANES conv positions
+  unsigned short channels;
+} conv1d_tile_t;
+
+// Same for the INPUT_CHANNELS/INPUT_SAMPLES/POOL_* defines of a max_pooling1d_*.c file
+typedef struct {
+  unsigned short input_channels;
+  unsigned short input_samples;
+  unsigned short pool_size;
+  unsigned short pool_stride;
+  unsigned short pool_length;
+  activation_kind_t activation;
+} maxpool1d_params_t;
+
+// Worst-case widths of the accumulators of a conv1d or dense layer, from its weights and the
+// bounds of its input, computed offline by tools/accum_plan.py into weights/accum_plan.c
+typedef struct {
+  unsigned char narrow_taps;   // consecutive taps of a window whose products sum in int16, 0: widen every product
+  unsigned char acc_bits;      // full accumulator, sign included, at most the 32 of long_number_t
+  unsigned char winograd_bits; // transform-domain sums of the Winograd kernel, 0 without one
+} accum_plan_t;
+
+// Conv kernels a layer can be switched to at run time by the autotuner of autotune.h (-DCNN_AUTOTUNE)
+typedef enum {
+  CONV1D_KERNEL_DEFAULT = 0, // the chain of the build flags, ending with the generated loops
+  CONV1D_KERNEL_DIRECT,      // vector kernel of conv1d_simd.h on the tiles of the choice
+  CONV1D_KERNEL_POLYPHASE,   // same on the polyphase decomposition of a strided conv
+  CONV1D_KERNEL_IM2COL,      // im2col + blocked GEMM of conv1d_im2col.h
+  CONV1D_KERNEL_WINOGRAD,    // Winograd kernel of conv1d_winograd.h
+} conv1d_kernel_t;
+
+// Kernel of a conv1d layer chosen by the autotuner, with what the candidates need besides its
+// int16 kernel
+typedef struct {
+  conv1d_kernel_t kernel;
+  conv1d_tile_t *tile;              // cache tiles of the vector kernel, NULL without CNN_SIMD
+  const accum_plan_t *accum_plan;
+  const number_t *winograd_kernel;  // weights/<layer>_winograd.c, NULL for the layers without one
+} conv1d_choice_t;
+
+// Ternary or binary weights of a conv1d or dense layer, bit-packed by tools/ternary_weights.py
+// into weights/ternary.c. Bit r of a filter row is the weight r = z * kernel_size + x of the
+// generated kernel[filters][input_channels][kernel_size] array (z for a dense layer).
+typedef struct {
+  unsigned short words;   // uint32_t words of a packed row, ceil(input_channels * kernel_size / 32)
+  const uint32_t *pos;    // [filters][words], weights equal to +scale
+  const uint32_t *neg;    // [filters][words], weights equal to -scale; NULL for binary weights,
+                          // whose weights not in pos are all -scale
+  const number_t *scale;  // [filters], in the fixed-point format of the original weights
+} ternary_weights_t;
+
+// Int8 weights of a conv1d or dense layer and the int8 quantization of its input, generated by
+// tools/int8_weights.py into weights/int8.c from calibration clips. The kernel rows of a conv are
+// [tap][channel], padded with zero weights to row bytes and to a multiple of 8 filters.
+typedef struct {
+  unsigned short row;            // bytes of a kernel row, input_channels * kernel_size rounded up to 32
+  const int8_t *kernel;          // [filters][row], symmetric: scale per filter, no zero point
+  const int32_t *offset;         // [filters] input_zero_point * sum of the row
+  const int32_t *multiplier;     // [filters] accumulator of the int16 weights = ((dot - offset) * multiplier) >> shift
+  unsigned char shift;           // at most 32
+  int32_t input_multiplier;      // q = clamp(((x * input_multiplier) >> input_shift) + input_zero_point, 0, input_max)
+  unsigned char input_shift;
+  unsigned char input_zero_point;
+  unsigned char input_max;       // at most 255, lowered so that no pair of products saturates int16
+} int8_weights_t;
+
+// Block-sparse weights of a conv1d or dense layer, pruned by tools/sparse_weights.py into
+// weights/sparse.c. The rows of the kernel (filters, units) go by groups of rows and each row by
+// blocks of cols weights: the kernel_size taps of one input channel of a conv, or the pair of
+// inputs 2 * index, 2 * index + 1 of a dense layer. Only the blocks with a nonzero weight in one
+// of the rows of their group are stored.
+typedef struct {
+  unsigned char rows;           // rows per group, the last group padded with zero rows
+  unsigned char cols;           // weights per row of a block, kernel_size of a conv, 2 of a dense layer
+  const unsigned short *start;  // [groups + 1] first block of each group, start[groups] blocks in all
+  const unsigned short *index;  // [blocks] input channel of a conv block, input pair of a dense one
+  const number_t *values;       // [blocks][rows][cols]
+} sparse_weights_t;
+
+#endif//__LAYER_PARAMS_H__
+/**
+  ******************************************************************************
+  * @file    dsp.h
+  * @version 1.0.0
+  * @date    17 october 2026
+  * @brief   conv1d and dense kernels on the dual 16-bit MAC of the Cortex-M4 DSP extension
+  *
+  * SMLAD adds the two products of the int16 halves of two registers to an int32 accumulator in
+  * one cycle, with the pairs of number_t read by one 32-bit load. The conv kernel copies the
+  * windows of two conv positions (max pooled first when the pooling is fused) to the stack, each
+  * a row of input_channels * kernel_size samples laid out like a filter of the kernel, and runs
+  * 2 filters x 2 positions at a time: 4 loads per 4 SMLAD, 8 MACs, where the generated loops
+  * load two operands per MAC. The dense kernel runs 2 units at a time, sharing the load of the
+  * input pair. The sums are those of the generated loops, in int32, so the results are bit-exact.
+  * On a core with the DSP extension (__ARM_FEATURE_DSP: M4, M7, M33) the dsp_* intrinsics below
+  * are the instructions and CNN_DSP is defined; anywhere else -DCNN_DSP builds the same kernels
+  * on the C emulation of the intrinsics, to test them on the host. The host vector
+  * kernels run first when there are any, CNN_ISA=scalar or -DCNN_NO_SIMD leave the layers to
+  * these. -DCNN_NO_DSP keeps the generated loops.
+  */
+
+#ifndef __DSP_H__
+#define __DSP_H__
+
+#ifndef SINGLE_FILE
+#include "number.h"
+#include "layer_params.h"
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#if !defined(CNN_NO_DSP) && FIXED_POINT > 0 && NUMBER_MAX == 32767 && (defined(__ARM_FEATURE_DSP) || defined(CNN_DSP))
+
+#ifndef CNN_DSP
+#define CNN_DSP
+#endif
+
+#define DSP_MAX_WINDOW 256 // input_channels * kernel_size of a conv, two windows on the stack
+
+#ifdef __ARM_FEATURE_DSP
+
+// Inline assembly like the __SMLAD and __SSAT of CMSIS, arm_acle.h only has them from GCC 10
+static inline int32_t dsp_smlad(int32_t x, int32_t y, int32_t acc) {
+  int32_t r;
+  __asm__ ("smlad %0, %1, %2, %3" : "=r" (r) : "r" (x), "r" (y), "r" (acc));
+  return r;
+}
+
+static inline int32_t dsp_ssat16(int32_t x) {
+  int32_t r;
+  __asm__ ("ssat %0, #16, %1" : "=r" (r) : "r" (x));
+  return r;
+}
+
+#else
+
+// acc + x.lo * y.lo + x.hi * y.hi, wrapping like SMLAD (which sets the Q flag instead, never read)
+static inline int32_t dsp_smlad(int32_t x, int32_t y, int32_t acc) {
+  return (int32_t)((uint32_t)acc + (uint32_t)((int16_t)x * (int16_t)y) + (uint32_t)((x >> 16) * (y >> 16)));
+}
+
+// x saturated to int16, SSAT #16
+static inline int32_t dsp_ssat16(int32_t x) {
+  return x < -32768 ? -32768 : x > 32767 ? 32767 : x;
+}
+
+#endif//__ARM_FEATURE_DSP
+
+// (p[0], p[1]) packed in one register, p[0] in the low half; the M4 loads it unaligned
+static inline int32_t dsp_read_pair(const number_t *p) {
+  int32_t pair;
+  memcpy(&pair, p, sizeof(pair));
+  return pair;
+}
+
+// requantize_number_t of requant_simd.h with the clamp on SSAT
+static inline number_t dsp_requant(long_number_t acc, int shift, long_number_t bias, int relu) {
+  acc = (acc >> shift) + bias;
+  if (relu && acc < 0)
+    return 0;
+  return (number_t)dsp_ssat16(acc);
+}
+
+// The samples of conv position pos of p under the kernel, [input_channels][kernel_size], max
+// pooled by input_pool when not NULL
+static inline void dsp_window(
+  const maxpool1d_params_t *input_pool,
+  const conv1d_params_t *p,
+  const number_t *input,
+  int pos,
+  number_t *window) {
+
+  const int raw_samples = input_pool != NULL ? input_pool->input_samples : p->input_samples;
+  const number_t *in;
+  number_t max, tmp;
+  int z, x, y;
+
+  for (z = 0; z < p->input_channels; z++) {
+    in = input + z * raw_samples;
+    if (input_pool == NULL) {
+      memcpy(window, in + pos * p->stride, p->kernel_size * sizeof(number_t));
+      window += p->kernel_size;
+      continue;
+    }
+    for (x = 0; x < p->kernel_size; x++) {
+      max = in[(pos * p->stride + x) * input_pool->pool_stride];
+      for (y = 1; y < input_pool->pool_size; y++) {
+        tmp = in[(pos * p->stride + x) * input_pool->pool_stride + y];
+        max = max < tmp ? tmp : max;
+      }
+      *window++ = max;
+    }
+  }
+}
+
+// Conv p optionally preceded by the max pooling input_pool of its input and followed by the
+// pool 2 / stride 2 max pooling output_pool (both may be NULL, linear pools only), requantized
+// with bias. Returns 0 when the layer does not fit, the caller then runs the generated loops.
+static int conv1d_maxpool1d_dsp(
+  const maxpool1d_params_t *input_pool,
+  const conv1d_params_t *p,
+  const maxpool1d_params_t *output_pool,
+  const number_t *input,    // [input_channels][input_samples], or the input of input_pool
+  const number_t *kernel,   // [filters][input_channels][kernel_size]
+  const number_t *bias,     // [filters]
+  number_t *output) {       // [filters][outsamples], [filters][pool_length] with output_pool
+
+  number_t window[2][DSP_MAX_WINDOW];
+  const int n = p->input_channels * p->kernel_size;
+  const int relu = p->activation == ACTIVATION_KIND_RELU;
+  const int conv_samples = output_pool != NULL ? 2 * output_pool->pool_length : p->outsamples;
+  const int out_samples = output_pool != NULL ? output_pool->pool_length : p->outsamples;
+  const number_t *k0, *k1;
+  long_number_t sum00, sum01, sum10, sum11;
+  int32_t x0, x1, w0, w1;
+  int pos, second, k, j;
+
+  if (p->zeropadding_left != 0 || p->zeropadding_right != 0 || n > DSP_MAX_WINDOW)
+    return 0;
+  if ((input_pool != NULL && input_pool->activation != ACTIVATION_KIND_LINEAR)
+      || (output_pool != NULL && (output_pool->activation != ACTIVATION_KIND_LINEAR
+                                  || output_pool->pool_size != 2 || output_pool->pool_stride != 2)))
+    return 0;
+
+  for (pos = 0; pos < conv_samples; pos += 2) {
+    // An odd last position without output pooling runs twice, its second output is dropped
+    second = pos + 1 < conv_samples ? pos + 1 : pos;
+    dsp_window(input_pool, p, input, pos, window[0]);
+    dsp_window(input_pool, p, input, second, window[1]);
+
+    for (k = 0; k < p->filters; k += 2) {
+      k0 = kernel + k * n;
+      k1 = k + 1 < p->filters ? k0 + n : k0; // odd last filter: same, the second is dropped
+      sum00 = sum01 = sum10 = sum11 = 0;
+      for (j = 0; j + 1 < n; j += 2) {
+        x0 = dsp_read_pair(&window[0][j]);
+        x1 = dsp_read_pair(&window[1][j]);
+        w0 = dsp_read_pair(k0 + j);
+        w1 = dsp_read_pair(k1 + j);
+        sum00 = dsp_smlad(w0, x0, sum00);
+        sum01 = dsp_smlad(w0, x1, sum01);
+        sum10 = dsp_smlad(w1, x0, sum10);
+        sum11 = dsp_smlad(w1, x1, sum11);
+      }
+      if (j < n) { // odd last tap, (w, 0) pairs
+        x0 = (uint16_t)window[0][j];
+        x1 = (uint16_t)window[1][j];
+        w0 = (uint16_t)k0[j];
+        w1 = (uint16_t)k1[j];
+        sum00 = dsp_smlad(w0, x0, sum00);
+        sum01 = dsp_smlad(w0, x1, sum01);
+        sum10 = dsp_smlad(w1, x0, sum10);
+        sum11 = dsp_smlad(w1, x1, sum11);
+      }
+
+      // The requantization is monotonic, the output pool takes the max of the accumulators
+      if (output_pool != NULL) {
+        output[k * out_samples + pos / 2] = dsp_requant(sum00 > sum01 ? sum00 : sum01, p->requant_shift, bias[k], relu);
+        if (k + 1 < p->filters)
+          output[(k + 1) * out_samples + pos / 2] = dsp_requant(sum10 > sum11 ? sum10 : sum11, p->requant_shift, bias[k + 1], relu);
+        continue;
+      }
+      output[k * out_samples + pos] = dsp_requant(sum00, p->requant_shift, bias[k], relu);
+      if (second != pos)
+        output[k * out_samples + second] = dsp_requant(sum01, p->requant_shift, bias[k], relu);
+      if (k + 1 < p->filters) {
+        output[(k + 1) * out_samples + pos] = dsp_requant(sum10, p->requant_shift, bias[k + 1], relu);
+        if (second != pos)
+          output[(k + 1) * out_samples + second] = dsp_requant(sum11, p->requant_shift, bias[k + 1], relu);
+      }
+    }
+  }
+  return 1;
+}
+
+// acc[u] = sum_z kernel[u][z] * input[z] of a dense layer, to be requantized by the caller
+static void dense_dsp(
+  const number_t *kernel,   // [units][inputs]
+  int inputs,
+  int units,
+  const number_t *input,    // [inputs]
+  long_number_t *acc) {     // [units]
+
+  const number_t *k0, *k1;
+  long_number_t sum0, sum1;
+  int32_t x;
+  int u, z;
+
+  for (u = 0; u < units; u += 2) {
+    k0 = kernel + u * inputs;
+    k1 = u + 1 < units ? k0 + inputs : k0;
+    sum0 = sum1 = 0;
+    for (z = 0; z + 1 < inputs; z += 2) {
+      x = dsp_read_pair(input + z);
+      sum0 = dsp_smlad(dsp_read_pair(k0 + z), x, sum0);
+      sum1 = dsp_smlad(dsp_read_pair(k1 + z), x, sum1);
+    }
+    if (z < inputs) { // odd last input, (w, 0) pairs
+      x = (uint16_t)input[z];
+      sum0 = dsp_smlad((uint16_t)k0[z], x, sum0);
+      sum1 = dsp_smlad((uint16_t)k1[z], x, sum1);
+    }
+    acc[u] = sum0;
+    if (u + 1 < units)
+      acc[u + 1] = sum1;
+  }
+}
+
+#endif//CNN_DSP
+
+#endif//__DSP_H__
+/**
+  ******************************************************************************
+  * @file    ternary.h
+  * @version 1.0.0
+  * @date    17 october 2026
+  * @brief   conv1d and dense kernels on ternary or binary weights: bit-packed signs with one
+  *          scale per filter, accumulated without multiplications
+  *
+  * A filter is scale * t with t[r] in {-1, 0, +1} (ternary) or {-1, +1} (binary), so its
+  * accumulator is scale * (sum of the inputs under +1 taps - sum of the inputs under -1 taps).
+  * The taps of a filter are decoded once from its masks, then each one adds or subtracts a whole
+  * row of inputs. Binary rows only walk their +1 taps: sum(t x) = 2 sum(+1 taps) - sum(all taps),
+  * the last term being shared by every filter of the layer.
+  * The scaled accumulator stands for the one of the int16 weights, it goes through the same
+  * pooling and requantization. Enabled at build time with -DCNN_TERNARY for the layers that
+  * tools/ternary_weights.py converted (weights/ternary.c defines <LAYER>_TERNARY for each), whose
+  * int16 kernel is then not linked.
+  */
+
+#ifndef __TERNARY_H__
+#define __TERNARY_H__
+
+#ifdef CNN_TERNARY
+
+// requantize_number_t of requant_simd.h, shift is the requant_shift of the layer (FIXED_POINT)
+static inline number_t requantize_number_t(long_number_t acc, int shift, long_number_t bias, int relu) {
+#if FIXED_POINT > 0
+  acc = (acc >> shift) + bias;
+#else
+  (void)shift;
+  acc = acc + bias;
+#endif
+  if (relu && acc < 0)
+    return 0;
+  return clamp_to_number_t(acc);
+}
+
+// out[i] = requantize_number_t(acc[i], shift, bias[i * bias_step], relu) for i < n, the scalar
+// loop of requant_simd.h: bias_step 0 for the row of one conv filter, 1 for dense units
+static inline void requant_simd_row(number_t *out, const long_number_t *acc, int n, int shift, const number_t *bias, int bias_step, int relu) {
+  int i;
+
+  for (i = 0; i < n; i++)
+    out[i] = requantize_number_t(acc[i], shift, bias[i * bias_step], relu);
+}
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define TERNARY_MAX_TAPS    1024 // input_channels * kernel_size of a conv, input units of a dense layer
+#define TERNARY_MAX_SAMPLES 1024 // conv outputs of one filter, before the output pooling
+
+// Offsets in the input of the taps set in mask (row of words words), tap_step samples apart in a
+// channel (the stride of an input pooling), returns their number
+static inline int ternary_taps(const uint32_t *mask, int words, int kernel_size, int input_samples, int tap_step, int *offsets) {
+  int n = 0, i, r;
+  uint32_t m;
+
+  for (i = 0; i < words; i++) {
+    for (m = mask[i]; m != 0; m &= m - 1) {
+      r = i * 32 + __builtin_ctz(m);
+      offsets[n++] = r / kernel_size * input_samples + r % kernel_size * tap_step;
+    }
+  }
+  return n;
+}
+
+// acc[pos] += sign * input[offset + pos * stride] for pos < samples or, with input_pool, the max
+// of the input_pool window starting there
+static inline void ternary_add_row(long_number_t *acc, const number_t *input, const maxpool1d_params_t *input_pool,
+                                   int offset, int stride, int samples, int sign) {
+  int pos, y;
+  number_t x, tmp;
+
+  if (input_pool == NULL) {
+    input += offset;
+    if (sign > 0)
+      for (pos = 0; pos < samples; pos++)
+        acc[pos] += input[pos * stride];
+    else
+      for (pos = 0; pos < samples; pos++)
+        acc[pos] -= input[pos * stride];
+    return;
+  }
+  for (pos = 0; pos < samples; pos++) {
+    const number_t *in = input + offset + pos * stride;
+    x = in[0];
+    for (y = 1; y < input_pool->pool_size; y++) {
+      tmp = in[y];
+      if (x < tmp)
+        x = tmp;
+    }
+    acc[pos] += sign > 0 ? x : -x;
+  }
+}
+
+// scale * sum, saturated to long_number_t: a ternary sum can exceed what the int16 weights reach
+static inline long_number_t ternary_scale(long_number_t sum, number_t scale) {
+  int64_t acc = (int64_t)sum * scale;
+  return acc > INT32_MAX ? INT32_MAX : acc < INT32_MIN ? INT32_MIN : (long_number_t)acc;
+}
+
+// Conv p on the ternary weights w, optionally preceded by the max pooling input_pool of its input
+// and followed by the max pooling output_pool (both may be NULL, linear pools only), requantized
+// with bias. Returns 0 when the layer does not fit the buffers, which conv1d_<n>.c rules out at
+// build time: the layer has no int16 weights to run instead.
+static inline int conv1d_maxpool1d_ternary(
+  const maxpool1d_params_t *input_pool,
+  const conv1d_params_t *p,
+  const maxpool1d_params_t *output_pool,
+  const ternary_weights_t *w,
+  const number_t *input,    // [input_channels][input_samples], or the input of input_pool
+  const number_t *bias,     // [filters]
+  number_t *output) {       // [filters][outsamples], [filters][pool_length] with output_pool
+
+  int offsets[TERNARY_MAX_TAPS];
+  long_number_t acc[TERNARY_MAX_SAMPLES];
+  long_number_t total[TERNARY_MAX_SAMPLES]; // binary weights: minus the sum of every tap of each window
+  const int depth = p->input_channels * p->kernel_size;
+  const int samples = p->outsamples;
+  const int raw_samples = input_pool != NULL ? input_pool->input_samples : p->input_samples;
+  const int tap_step = input_pool != NULL ? input_pool->pool_stride : 1;
+  const int stride = p->stride * tap_step;
+  const int relu = p->activation == ACTIVATION_KIND_RELU;
+  const int out_samples = output_pool != NULL ? output_pool->pool_length : samples;
+  int k, n, i, pos, y;
+  uint32_t ones[TERNARY_MAX_TAPS / 32];
+
+  if (depth > TERNARY_MAX_TAPS || samples > TERNARY_MAX_SAMPLES || p->zeropadding_left != 0 || p->zeropadding_right != 0)
+    return 0;
+  if ((input_pool != NULL && input_pool->activation != ACTIVATION_KIND_LINEAR)
+      || (output_pool != NULL && output_pool->activation != ACTIVATION_KIND_LINEAR))
+    return 0;
+
+  if (w->neg == NULL) {
+    for (i = 0; i < w->words; i++)
+      ones[i] = depth - 32 * i >= 32 ? 0xFFFFFFFFu : (1u << (depth - 32 * i)) - 1;
+    n = ternary_taps(ones, w->words, p->kernel_size, raw_samples, tap_step, offsets);
+    for (pos = 0; pos < samples; pos++)
+      total[pos] = 0;
+    for (i = 0; i < n; i++)
+      ternary_add_row(total, input, input_pool, offsets[i], stride, samples, -1);
+  }
+
+  for (k = 0; k < p->filters; k++) {
+    for (pos = 0; pos < samples; pos++)
+      acc[pos] = 0;
+    n = ternary_taps(w->pos + k * w->words, w->words, p->kernel_size, raw_samples, tap_step, offsets);
+    for (i = 0; i < n; i++)
+      ternary_add_row(acc, input, input_pool, offsets[i], stride, samples, 1);
+    if (w->neg != NULL) {
+      n = ternary_taps(w->neg + k * w->words, w->words, p->kernel_size, raw_samples, tap_step, offsets);
+      for (i = 0; i < n; i++)
+        ternary_add_row(acc, input, input_pool, offsets[i], stride, samples, -1);
+      for (pos = 0; pos < samples; pos++)
+        acc[pos] = ternary_scale(acc[pos], w->scale[k]);
+    } else {
+      for (pos = 0; pos < samples; pos++)
+        acc[pos] = ternary_scale(2 * acc[pos] + total[pos], w->scale[k]);
+    }
+
+    // The pooled accumulators are written in place, the requantization is monotonic
+    if (output_pool != NULL) {
+      for (pos = 0; pos < out_samples; pos++) {
+        acc[pos] = acc[pos * output_pool->pool_stride];
+        for (y = 1; y < output_pool->pool_size; y++)
+          if (acc[pos] < acc[pos * output_pool->pool_stride + y])
+            acc[pos] = acc[pos * output_pool->pool_stride + y];
+      }
+    }
+    requant_simd_row(output + k * out_samples, acc, out_samples, p->requant_shift, &bias[k], 0, relu);
+  }
+  return 1;
+}
+
+// Accumulators acc[units] of a dense layer on the ternary weights w, to be requantized by the
+// caller like those of its int16 weights
+static inline void dense_ternary(
+  const ternary_weights_t *w,
+  int input_samples,
+  int units,
+  const number_t *input,    // [input_samples]
+  long_number_t *acc) {     // [units]
+
+  long_number_t sum, total = 0;
+  int k, i, z;
+  uint32_t m;
+
+  if (w->neg == NULL)
+    for (z = 0; z < input_samples; z++)
+      total += input[z];
+
+  for (k = 0; k < units; k++) {
+    sum = 0;
+    for (i = 0; i < w->words; i++)
+      for (m = w->pos[k * w->words + i]; m != 0; m &= m - 1)
+        sum += input[i * 32 + __builtin_ctz(m)];
+    if (w->neg != NULL) {
+      for (i = 0; i < w->words; i++)
+        for (m = w->neg[k * w->words + i]; m != 0; m &= m - 1)
+          sum -= input[i * 32 + __builtin_ctz(m)];
+    } else {
+      sum = 2 * sum - total;
+    }
+    acc[k] = ternary_scale(sum, w->scale[k]);
+  }
+}
+
+#endif//CNN_TERNARY
+
+#endif//__TERNARY_H__
+/**
+  ******************************************************************************
+  * @file    weights/ternary.c
+  * @version 1.0.0
+  * @date    17 october 2026
+  * @brief   Ternary weights of conv1d_119, dense_58 with one scale per filter,
+  *          generated by tools/ternary_weights.py from the int16 weights, used with -DCNN_TERNARY
+  *          in place of their int16 kernel
+  */
+
+#ifdef CNN_TERNARY
+
+#define CONV1D_119_TERNARY
+
+const int16_t conv1d_119_bias[128] = {-2, -10, 14, 0, 9, -11, -5, 20, 3, 4, 10, 6, -16, 0, 6, 12, -4, -15, 0, -5, 19, -16, 0, 8, 4, 14, -8, 2, -10, 1, 15, 12, 0, 0, 1, 6, 1, -9, 22, 2, 6, -6, -13, 7, 3, 12, 6, -12, 17, 7, -14, 4, 0, 12, -5, -8, 22, -1, 1, -5, 5, 9, -10, 4, -1, 16, 0, 19, -7, 3, 21, -6, -2, -15, 0, 6, 6, -8, 9, 9, 2, -3, -16, -9, -6, -7, 5, 22, -2, -5, 10, -4, 22, 5, 13, 4, 8, -15, 17, -3, 0, 17, 3, -6, 14, -8, 12, -4, 2, -5, 4, -3, 6, 2, -4, -3, 7, -2, 11, 15, -3, 0, -4, 4, -3, 2, -4, -8}
+;
+
+static const uint32_t conv1d_119_ternary_pos[128][6] = {
+  {0x2281F190u, 0x8897894Cu, 0x42800954u, 0x4CCC88A4u, 0xD0C43C40u, 0x148B1018u},
+  {0x01068A0Eu, 0x6BC0A125u, 0x56363192u, 0x80A2E420u, 0x21C82106u, 0x4834AA38u},
+  {0xD96D0046u, 0xC0C60805u, 0x2A180669u, 0x01040046u, 0x323DCA80u, 0x03653016u},
+  {0x82A59830u, 0x1C882359u, 0x629587DDu, 0xAC0181E9u, 0xCB7618F6u, 0x0C0D0500u},
+  {0x214840E5u, 0x4C0E2D08u, 0x0CD61812u, 0x40C9C246u, 0x2DAA0A4Au, 0x6158740Cu},
+  {0x01B78B0Au, 0x85240344u, 0x00995730u, 0x480263D3u, 0x401450C1u, 0x3702020Bu},
+  {0x107A8094u, 0x31745070u, 0xAB898084u, 0xA7240DE8u, 0xA0048848u, 0x000F1010u},
+  {0xE4082231u, 0x65148241u, 0x02050659u, 0x01123152u, 0xA616E408u, 0x0436A019u},
+  {0x40235F14u, 0x20A225E5u, 0x861FC9BEu, 0xEEB0809Du, 0x9018BC02u, 0x0C00C061u},
+  {0x05810578u, 0x13016980u, 0x0E305A08u, 0x888CBFE2u, 0xD1C35000u, 0x2920E030u},
+  {0x40808132u, 0x83A2D419u, 0xC02935E1u, 0xB82A0195u, 0x8E249485u, 0xB1513F80u},
+  {0x2E4D0182u, 0x0A736041u, 0x40180010u, 0x002109E7u, 0x94D044A4u, 0x36D30846u},
+  {0x08420198u, 0x48188285u, 0x11000525u, 0x1879E9E1u, 0xCA641918u, 0x44704340u},
+  {0x0F34002Du, 0x9B43C346u, 0x2D242410u, 0x1895C628u, 0x3480A180u, 0x4C801F00u},
+  {0x0012BB48u, 0x28857E41u, 0x90B02521u, 0x128A4801u, 0x0666DACDu, 0x0087B1D4u},
+  {0x0621C151u, 0x80030860u, 0x31405C1Bu, 0x40C10E84u, 0xA112C4C0u, 0x4352B908u},
+  {0x36C5C041u, 0xB2239370u, 0x8C28E8A0u, 0x10F452D4u, 0x250400C4u, 0x10090001u},
+  {0x88946E31u, 0x06D80122u, 0x0423014Cu, 0x48218A68u, 0x8A041811u, 0x01C75008u},
+  {0xAA8A5F00u, 0x61822001u, 0x8029A788u, 0x4850480Fu, 0x0624C446u, 0x0A171020u},
+  {0x104D0102u, 0x00260488u, 0x29299463u, 0x8801C188u, 0x0A7638A1u, 0x8CC1106Cu},
+  {0x1281C208u, 0x8C9D4325u, 0xEC73D808u, 0x20D07842u, 0x46B68042u, 0xE30D2CD0u},
+  {0x9880046Fu, 0xA863A385u, 0x840000E1u, 0xC33C0C02u, 0x06082006u, 0x2628332Fu},
+  {0x22D00286u, 0x4B302053u, 0x20354685u, 0x0C511984u, 0xB0022860u, 0x04100250u},
+  {0x13106560u, 0x99281F98u, 0x15094076u, 0x9090618Cu, 0x88300010u, 0x28028102u},
+  {0x61021F10u, 0x23380C68u, 0x0482CA28u, 0x15721CA4u, 0xD0C46262u, 0xA61054D1u},
+  {0x10D06058u, 0x021BA508u, 0x8E47F880u, 0x24D15433u, 0x50921833u, 0x89018016u},
+  {0x404B9B00u, 0x222A0000u, 0x8B601805u, 0x0681099Cu, 0x90401194u, 0x00000632u},
+  {0xA33913FDu, 0x4A138CE8u, 0x00160957u, 0x42418040u, 0x96284109u, 0x1D581001u},
+  {0x6D730BCDu, 0x4469C620u, 0x02823B20u, 0x804C44D3u, 0xA1281E68u, 0x8A20C436u},
+  {0xD8100480u, 0x03CAB45Cu, 0x7185A4A8u, 0x144000D0u, 0xA64270A2u, 0x18002E48u},
+  {0x20144080u, 0x4081DD4Du, 0x0E30D6ADu, 0xD6900302u, 0x00BC8C30u, 0x392015C4u},
+  {0x46D0A048u, 0x0098E121u, 0xDCD35881u, 0x0028EFB8u, 0x100448B8u, 0x304C8C18u},
+  {0x2B880813u, 0x06104220u, 0x01C644BCu, 0x018AD2D5u, 0xE004123Au, 0x34070521u},
+  {0x828D0011u, 0x8E04D188u, 0x14C01296u, 0x864145E0u, 0xB2808B58u, 0xC96507BCu},
+  {0x0B3DD944u, 0x5846522Du, 0x38042B18u, 0x01E068CCu, 0x412100E2u, 0x444C3080u},
+  {0x804EA220u, 0x01021E51u, 0x723E3501u, 0x508278C0u, 0x22C46C01u, 0x85900E61u},
+  {0x22030F41u, 0x45600841u, 0x1D33CA33u, 0x04BCBB04u, 0xA0560A82u, 0x10C94025u},
+  {0x68156A09u, 0x51000044u, 0x43208524u, 0xFA0A01B6u, 0x45AE3910u, 0xD5C82218u},
+  {0xB0005EA0u, 0x13198082u, 0xFA51C281u, 0x0081AE1Au, 0x464CE871u, 0xEB05C181u},
+  {0x33684358u, 0xB06C5592u, 0xB0801800u, 0xE061A649u, 0xA00C101Au, 0x54C0C814u},
+  {0x4024E988u, 0x3A260D12u, 0x2D091401u, 0x030D2840u, 0x0450A596u, 0xA6424E03u},
+  {0x49056021u, 0x8DB10126u, 0x26166EB1u, 0x1230690Fu, 0x81542C2Au, 0x032E4304u},
+  {0x04484801u, 0x078400CAu, 0x140890F4u, 0x18058040u, 0x14A003D3u, 0x5E3C0209u},
+  {0x81101029u, 0x2806DF63u, 0x0CB3202Au, 0x2201EC07u, 0x42C1EA40u, 0x501D8210u},
+  {0x90A4688Cu, 0x88B1242Au, 0x26602164u, 0x3825A803u, 0x19280671u, 0x085D9843u},
+  {0x3038B220u, 0x00780D86u, 0x2280B5A3u, 0x4002360Au, 0x00054192u, 0xC1000304u},
+  {0x801FA9A6u, 0x46048C46u, 0x8C006C3Cu, 0x36490C50u, 0x5A194A0Du, 0x18283150u},
+  {0x12542420u, 0x35271439u, 0x00742848u, 0x010A6084u, 0x525098E0u, 0xB2700201u},
+  {0x350020B6u, 0x71933448u, 0x2AD87090u, 0x00480044u, 0x0A2188E5u, 0x849158B0u},
+  {0xD8401622u, 0x6683418Bu, 0x98A56944u, 0x4D0A4508u, 0x4130D404u, 0x900018E1u},
+  {0x0DA04B82u, 0xC42C8490u, 0x042CC5EDu, 0x45523112u, 0x60380906u, 0x9CF22688u},
+  {0xC531C590u, 0x62730228u, 0x52540441u, 0xE0A68D36u, 0x5A1058B4u, 0x4893A940u},
+  {0x3C08B104u, 0x66A84D40u, 0x15084AE1u, 0x8C418400u, 0x6F195311u, 0xB8161F08u},
+  {0x04101885u, 0x82CEB429u, 0xC06DC212u, 0x1164112Eu, 0x089C1D26u, 0x21AC30BCu},
+  {0x486A0004u, 0x84882006u, 0x0F2A1426u, 0x554C6180u, 0xE0456124u, 0x2798085Fu},
+  {0x66BC0C00u, 0x71059E22u, 0x1B023322u, 0xC04088D0u, 0x8080003Fu, 0xA15D4E0Eu},
+  {0x40A05002u, 0x1E351D03u, 0x61869E00u, 0x183C0BB4u, 0xC518979Du, 0x38014C04u},
+  {0x4024A908u, 0x005440ABu, 0x20502720u, 0x0000E00Cu, 0x80202066u, 0x982A0182u},
+  {0x08AA4F35u, 0x5118C694u, 0xBD411418u, 0xD562AE07u, 0x9840613Cu, 0x2029E902u},
+  {0xA01EC065u, 0x802FA461u, 0x462A4204u, 0x488240E1u, 0x0188DEA0u, 0x00040C2Cu},
+  {0x442D80A0u, 0x698712A8u, 0x210D2800u, 0xA849E01Au, 0x09329EDAu, 0x10082DC4u},
+  {0x8960120Du, 0x047F0C0Fu, 0x203E5661u, 0x284A48F5u, 0x2AA2680Au, 0x48355D42u},
+  {0x00832218u, 0xC2881008u, 0xA1D44048u, 0xC1401212u, 0x6152E228u, 0x158EC100u},
+  {0x01806A18u, 0x92908DA5u, 0x3A61C0A8u, 0xDE229E7Du, 0x0D14A0C0u, 0x7802C00Cu},
+  {0x11C419C2u, 0x10E844ACu, 0x850C0904u, 0x48076050u, 0x14662003u, 0x00CC3040u},
+  {0x822B065Du, 0x0888C080u, 0xED4AC0B4u, 0x8525A828u, 0x8E04B808u, 0x8009B601u},
+  {0x83E4A115u, 0xC911E0C8u, 0x8C880913u, 0xC0680484u, 0x53010E45u, 0xE220808Cu},
+  {0x8C8A913Cu, 0x00220CC0u, 0xAB4CCC40u, 0x36802419u, 0x4CB0C02Du, 0xA259D088u},
+  {0x21F22696u, 0x42102914u, 0x00284AA3u, 0x06069304u, 0xCA460486u, 0x4CEC0652u},
+  {0xC8982E28u, 0xC282AA07u, 0xA1704E2Cu, 0x0A121181u, 0x242A0415u, 0xB003062Bu},
+  {0x830ED0A8u, 0x4B508DC0u, 0x2E513F02u, 0x016340AAu, 0xC4CD4234u, 0x0895E03Fu},
+  {0x02AA9B40u, 0x2CC001C0u, 0x08078716u, 0x634CF43Au, 0x518230D0u, 0x10078CFBu},
+  {0x00A08E51u, 0xC0A204C0u, 0x40001E32u, 0xE20022A4u, 0x8CA740C2u, 0x2C751143u},
+  {0x62A05200u, 0x00F0173Cu, 0x0D241018u, 0x0148EAFCu, 0x12021240u, 0x0C190424u},
+  {0x0EFFDC86u, 0xB0204A02u, 0x28000415u, 0xC0A19000u, 0x04433197u, 0x66981508u},
+  {0x14A00A6Bu, 0x9B3EC280u, 0x40D04048u, 0x888191C0u, 0x15042053u, 0x81F0132Eu},
+  {0x3A1205C8u, 0x10AA2498u, 0x81F5CB80u, 0x0A2801ADu, 0x0A2BE143u, 0x1AE2F8D3u},
+  {0x06A85020u, 0x00805041u, 0xA5CF140Au, 0x708E6D36u, 0x24C8836Cu, 0x22080408u},
+  {0x86056618u, 0x03C409C9u, 0x9AC100A0u, 0x21BD0018u, 0x44C5094Eu, 0xF150E519u},
+  {0x23204541u, 0xC6008826u, 0x00723C50u, 0x18170900u, 0x20244B40u, 0x2311C601u},
+  {0x60110493u, 0xB181773Cu, 0xA1C18A16u, 0xC2502113u, 0x23050CC0u, 0x26A13548u},
+  {0x4D0DCA41u, 0x240C0140u, 0x00601034u, 0x43611229u, 0x088DA025u, 0x073A004Bu},
+  {0x70B01008u, 0x4D840654u, 0x762A0040u, 0xA0412149u, 0x18B03149u, 0x0D180B46u},
+  {0x26040034u, 0x26873420u, 0x00100024u, 0x681DC136u, 0x2A15424Au, 0x0F662C04u},
+  {0x5415911Eu, 0x26262211u, 0x88052484u, 0x2151A801u, 0x0409832Au, 0x6B959900u},
+  {0x59BA8600u, 0x1A9035C2u, 0x2107A800u, 0x7102F035u, 0x09E00882u, 0x35391114u},
+  {0xA8426552u, 0x1290430Du, 0x014008A0u, 0x0448A1F2u, 0x5C212054u, 0x783351CCu},
+  {0xCC70A902u, 0x48706178u, 0x800907C7u, 0x98A6168Cu, 0x60259904u, 0x22005D44u},
+  {0x8840C423u, 0x100C302Cu, 0x118C0E82u, 0x1C090088u, 0x00175060u, 0x2650BD80u},
+  {0x08C9EAE0u, 0x84455012u, 0x0015CD53u, 0x861CC0A4u, 0x5A3020D8u, 0x20770B41u},
+  {0xCB38C261u, 0x30810143u, 0xC016EE0Du, 0x831040FEu, 0x282068C0u, 0x3088B7C0u},
+  {0x10210651u, 0x20540142u, 0x00813000u, 0xD2D2C824u, 0x0B404152u, 0x1AADBF20u},
+  {0x4005EFF0u, 0x420E1700u, 0xE4604920u, 0x0DC4A8D0u, 0xA117182Cu, 0x1301E700u},
+  {0xF8BC1033u, 0x01813689u, 0x8FCC6960u, 0x27970700u, 0x24B84876u, 0x8E4C4B06u},
+  {0xA1B0D063u, 0x1F109440u, 0x0E0241E0u, 0x58ACA26Eu, 0xA8350049u, 0xEE316D9Eu},
+  {0x81549E88u, 0x4301200Au, 0xA0DF8056u, 0xA1440083u, 0x1BD29441u, 0x05820420u},
+  {0x051880A0u, 0x04223E46u, 0x96060817u, 0x17628C18u, 0x444810C7u, 0xF23420A9u},
+  {0xB8204888u, 0x1C915269u, 0x00044029u, 0xC9880240u, 0xC0A61730u, 0x14A184B3u},
+  {0x46049060u, 0xD6868819u, 0xA064E070u, 0x20548056u, 0xC687D34Du, 0x56420404u},
+  {0x2CB145A1u, 0x80021CC2u, 0xB03C9806u, 0xC1340884u, 0x0B502030u, 0x421CC988u},
+  {0x924EA7EAu, 0xC8A49835u, 0x037D99C4u, 0x48C44AB4u, 0x3E006C0Bu, 0x028059A1u},
+  {0x4810090Du, 0x9F313C01u, 0x4BFBE960u, 0x34441420u, 0x0C688514u, 0xC96C709Bu},
+  {0x0C8011DCu, 0x2609E851u, 0x1C010308u, 0x8ECE00A1u, 0xF0472172u, 0x541CD8E1u},
+  {0x85D24538u, 0x024804C0u, 0x00142047u, 0xD002D484u, 0xE0405026u, 0x0CD29A45u},
+  {0x2421CBA0u, 0xD148CEEDu, 0x5417C245u, 0x7A229419u, 0xA0540091u, 0x08A58144u},
+  {0x84C28198u, 0xC4668200u, 0x020C4300u, 0x91E2050Du, 0xC0409293u, 0xAF02011Au},
+  {0x8509E020u, 0x420B8486u, 0xC10CF040u, 0xF1840081u, 0xDA50C056u, 0x2249BBC0u},
+  {0x8A080850u, 0x1AC1B18Cu, 0x18890410u, 0xAB002243u, 0x41941C5Eu, 0x3C00019Cu},
+  {0x45448042u, 0x5A23D246u, 0x900C1870u, 0x062BE600u, 0x609644CEu, 0x40050659u},
+  {0x10808016u, 0x4C104402u, 0x04100D15u, 0x50080140u, 0x7C490289u, 0xA3C82A09u},
+  {0x32007080u, 0xF9049E1Cu, 0x00508308u, 0x5AA4D890u, 0x08B02800u, 0x2C2C6DE0u},
+  {0x04230600u, 0x31087041u, 0x75A28026u, 0x40180849u, 0x1BD06141u, 0x4461621Du},
+  {0xF000B628u, 0x44A2C14Du, 0xD181CC0Cu, 0xA2A542BCu, 0xA2028E42u, 0x42819481u},
+  {0x001204C1u, 0x3999F089u, 0x840508E8u, 0x61603F09u, 0x8B9900CAu, 0xA621710Fu},
+  {0x108A0920u, 0xC180E180u, 0x2C75A28Fu, 0x3ABDE32Bu, 0xCCC64368u, 0x064A0494u},
+  {0x4C431B24u, 0x4A32084Fu, 0x0006202Du, 0x90068506u, 0x23D10AC0u, 0x005C6400u},
+  {0x038405C8u, 0x0400329Cu, 0x0002055Eu, 0x84161D16u, 0x19C015C0u, 0x38DA818Au},
+  {0x2A8750E4u, 0x0601BB02u, 0x6700920Du, 0x90680362u, 0x2840D301u, 0x180430A8u},
+  {0xA0028000u, 0xE8304420u, 0xD044E000u, 0x8F0044C4u, 0x0438A849u, 0x1559C290u},
+  {0xCAC6CA04u, 0x12608D2Cu, 0x4166BC90u, 0x00EA0000u, 0xCA343441u, 0x06A22DCAu},
+  {0x04204317u, 0x64882454u, 0x0D028431u, 0x040EB05Au, 0x084721E0u, 0x59C20695u},
+  {0xB0C5A429u, 0xCC50204Du, 0x51096670u, 0xB11B0040u, 0x10683486u, 0x6168DB40u},
+  {0xB81AF67Cu, 0x80308037u, 0x900598D8u, 0x91000580u, 0xA21D4CC0u, 0x1F0F0400u},
+  {0x03C046C7u, 0x6259C31Au, 0x8950250Du, 0x28A4CB39u, 0x80104030u, 0x54589259u},
+  {0x08140E0Au, 0x2609883Cu, 0xA214B420u, 0xCA1C5022u, 0xCF1B5040u, 0x48019F14u},
+  {0xB45C184Bu, 0x0640C344u, 0x811B40F5u, 0x24203AC0u, 0x166F0425u, 0x83529732u},
+  {0xB1194E86u, 0x3C0040E0u, 0x0002A501u, 0x68398051u, 0x0082D830u, 0x0711C102u},
+  {0xC00CC024u, 0x2B308C02u, 0x982EAC6Cu, 0xC000A680u, 0x8308B484u, 0x2E3280C2u}
+};
+
+static const uint32_t conv1d_119_ternary_neg[128][6] = {
+  {0xD17A0269u, 0x724854B3u, 0x9068648Bu, 0x3221405Bu, 0x2B38C3A4u, 0x89000DC0u},
+  {0x8E2965C0u, 0x043B5418u, 0x89C9C060u, 0x5B110A0Bu, 0x9631D4E1u, 0x80C215C3u},
+  {0x06107708u, 0x3428A440u, 0xC0A00810u, 0xA4A93FA0u, 0x41C22038u, 0x180A4689u},
+  {0x21402088u, 0x42158C20u, 0x15022802u, 0x030E4C00u, 0x30806708u, 0x2180C045u},
+  {0x46822F08u, 0xB30042D0u, 0x010820CCu, 0xBD363821u, 0x10550490u, 0x98078B40u},
+  {0x2A407050u, 0x688B5092u, 0x0200A045u, 0x8340040Cu, 0x19AAA302u, 0x88E03D04u},
+  {0x6D815D69u, 0xC48AA103u, 0x04222E78u, 0x18083203u, 0x46A943B2u, 0x06F04D8Cu},
+  {0x0A105900u, 0x020118A4u, 0xBD703004u, 0xE6C1C80Du, 0x41C009B1u, 0xC2814B06u},
+  {0x890080CAu, 0x5E544202u, 0x51602001u, 0x104B3240u, 0x47E541D9u, 0xC0761208u},
+  {0xF23A5802u, 0x40948056u, 0x80C90555u, 0x76010011u, 0x0A300178u, 0x54551B84u},
+  {0x1479328Du, 0x54140846u, 0x11C0481Eu, 0x44C0EC60u, 0x7090005Au, 0x448E4031u},
+  {0x1020787Cu, 0x7480062Cu, 0x2B42D026u, 0xA79C1200u, 0x6A249302u, 0x010C17A1u},
+  {0x53201240u, 0x26241930u, 0x02950A08u, 0x2184000Au, 0x0093C444u, 0x30008C20u},
+  {0x20483112u, 0x008C2010u, 0xC08AD344u, 0xC42A0151u, 0x81120070u, 0x1022A0F3u},
+  {0x0CC84004u, 0x15200010u, 0x234F0088u, 0x8470902Cu, 0x81880030u, 0x01480429u},
+  {0xD8862228u, 0x10000093u, 0x422FA080u, 0x201EA122u, 0x1AE00A1Fu, 0x20050251u},
+  {0x8030368Au, 0x04506C0Bu, 0x0117021Du, 0x6501A528u, 0x8A89A039u, 0xC43229AEu},
+  {0x6269918Eu, 0xD8229010u, 0x29409211u, 0x03461004u, 0x555B26E4u, 0xBC00A490u},
+  {0x0001A004u, 0x883DD4B2u, 0x68020066u, 0x012527C0u, 0xE1821398u, 0xE1088B02u},
+  {0xCDB2045Du, 0x3F507954u, 0x02144180u, 0x20823270u, 0x01014748u, 0x5034CA83u},
+  {0x84360860u, 0x41600C98u, 0x12840671u, 0x150E068Du, 0x90093619u, 0x1082D201u},
+  {0x047B9A80u, 0x07000018u, 0x22C23402u, 0x0C439099u, 0xD922D4D8u, 0xD9C1C450u},
+  {0x840CE028u, 0x14449088u, 0x87429138u, 0x628A0040u, 0x0EE4C315u, 0xA846D887u},
+  {0xA4A5809Eu, 0x04056040u, 0x88628501u, 0x0D4A8000u, 0x520294CCu, 0x43804A0Cu},
+  {0x8215A084u, 0x08863313u, 0xA27901C0u, 0xE805605Bu, 0x20291C00u, 0x59030906u},
+  {0x29280C22u, 0xC84400E5u, 0x2030052Bu, 0xC80029C8u, 0x80402308u, 0x22B41689u},
+  {0x02A024A6u, 0x1CD58589u, 0x24926462u, 0x601C0021u, 0x4224AA21u, 0x100B6000u},
+  {0x04462C02u, 0x80482205u, 0x64E01028u, 0x30204F24u, 0x618096D2u, 0xC027650Cu},
+  {0x82808020u, 0x228621C1u, 0xD445404Au, 0x2EA0A82Cu, 0x5E80A094u, 0x00512881u},
+  {0x05475243u, 0x58004A20u, 0x08380003u, 0x88A14C21u, 0x19108951u, 0x0059C181u},
+  {0x8360204Eu, 0x922E02A0u, 0xF1C82850u, 0x00650CCDu, 0xC402438Du, 0xC207023Au},
+  {0x300C0C92u, 0x87610254u, 0x20282616u, 0xC3551002u, 0x6C3B1143u, 0x0C1011E4u},
+  {0x0016D200u, 0x40CF805Cu, 0xC831A100u, 0x94040128u, 0x16A02440u, 0x40B06A46u},
+  {0x21022604u, 0x00722E10u, 0xE21BA160u, 0x69201818u, 0x0C310404u, 0x00027003u},
+  {0xF002000Au, 0x23388D02u, 0x02C0C002u, 0xBA069212u, 0x36589D00u, 0x39204471u},
+  {0x59111885u, 0x006C0008u, 0x81C00086u, 0x06690134u, 0x0C19113Eu, 0x7A48209Cu},
+  {0xDDE0D032u, 0x289C90BEu, 0x628C2480u, 0xF3014012u, 0x02088018u, 0xCE000C0Au},
+  {0x17C290A6u, 0xAA6D0D39u, 0x34C11202u, 0x01A5D601u, 0x8A414642u, 0x22240866u},
+  {0x08ACA041u, 0xE0C60C24u, 0x018A316Cu, 0x00540044u, 0x18130782u, 0x10822216u},
+  {0x040220A0u, 0x0690A024u, 0x474F05BBu, 0x14144022u, 0x5E216884u, 0x20093623u},
+  {0x3A4A1060u, 0x015040ADu, 0x80A420C2u, 0xFC02102Fu, 0x412D0049u, 0x4995A0E8u},
+  {0x12028686u, 0x500C0A80u, 0xC9E90040u, 0xAD060690u, 0x50819380u, 0xA8909CD3u},
+  {0xE030A2FAu, 0xB0383C35u, 0x8B266C0Au, 0x00A27DACu, 0x8B00F008u, 0x8100F0E4u},
+  {0x768A45C6u, 0x1148201Cu, 0x21044610u, 0x0DDA0000u, 0x240000A6u, 0x2C421802u},
+  {0x00499640u, 0x650CD115u, 0x91918283u, 0xC4500420u, 0x2010B182u, 0x27024004u},
+  {0x8A024DCDu, 0x05079231u, 0xD0394854u, 0xBA9988D1u, 0x40201C40u, 0x3067D041u},
+  {0x3EA04651u, 0x81482199u, 0x409593C2u, 0x00B020A7u, 0x2182A432u, 0xC49380A3u},
+  {0x2C2A098Au, 0x8208CB46u, 0x43005013u, 0x42840838u, 0x8C016504u, 0x048F810Au},
+  {0x8A884840u, 0x04644020u, 0x0425812Au, 0xC094A500u, 0x50427610u, 0x434A0241u},
+  {0x0486A14Cu, 0x11481C70u, 0x27188613u, 0x80C40017u, 0x000A2291u, 0x05212506u},
+  {0x8257A469u, 0x1341490Fu, 0x21C13810u, 0x00A90221u, 0x0147E049u, 0x41045961u},
+  {0x2AC21845u, 0x1C880044u, 0xA803A12Cu, 0x150862C9u, 0x25E9A501u, 0x930852ACu},
+  {0xC0560EF1u, 0x881080BCu, 0xC8E38112u, 0x520E31BFu, 0x00C4A420u, 0x4528C092u},
+  {0x73A86172u, 0x09204352u, 0x3412206Du, 0x049AC6D1u, 0x10020048u, 0xDE404701u},
+  {0x92952883u, 0x1B374598u, 0xC045E041u, 0x8A908826u, 0x1102925Au, 0x882123A0u},
+  {0x81011132u, 0x08E2409Du, 0xC06CC444u, 0x1184540Au, 0x242C9140u, 0x0CA001D1u},
+  {0x00480A71u, 0xE180202Cu, 0x0400013Eu, 0x01808400u, 0x30840042u, 0x07720201u},
+  {0x18531456u, 0x7081AE40u, 0x1204189Du, 0x029703F1u, 0x1A1A5F01u, 0x6440724Du},
+  {0x9144A002u, 0xA2830921u, 0x0232A9A6u, 0x288051C0u, 0x011B9040u, 0x0BC402E0u},
+  {0x1F402482u, 0x2F904B96u, 0x898014D8u, 0x15308D1Au, 0xA4750104u, 0xA0B24091u},
+  {0x9A127E59u, 0x04084516u, 0x9AD04577u, 0x04B21B40u, 0x90C86021u, 0x0D50802Bu},
+  {0x001A2C00u, 0xAA00C1A0u, 0x94800006u, 0x4621B200u, 0x41040151u, 0x8182829Cu},
+  {0x7E0888E7u, 0x202723E4u, 0x04001F82u, 0x24BA8145u, 0x1AAC00D4u, 0x885120D0u},
+  {0x1E510525u, 0x440D3210u, 0x050E1251u, 0x20410002u, 0xF2095C00u, 0x02453AB2u},
+  {0xAE0B0228u, 0x2F109B12u, 0x3051445Au, 0xB0C00D0Eu, 0x631892D0u, 0xF531CF14u},
+  {0x11C04020u, 0x0352223Au, 0x00340A08u, 0x629010C4u, 0x30C00644u, 0x4230011Eu},
+  {0x38115A2Au, 0x204C1002u, 0x0217E04Cu, 0x1502020Bu, 0x00AE6018u, 0x0C072923u},
+  {0x10252682u, 0x7A058030u, 0x40B1029Bu, 0x4050D342u, 0x90062000u, 0x19222871u},
+  {0x88094068u, 0x09289000u, 0xE651A418u, 0x81304851u, 0x24299130u, 0x021248A0u},
+  {0x240451C0u, 0x345114E8u, 0x1E822193u, 0x456DE418u, 0x8B8123A0u, 0x4C040194u},
+  {0x78610D01u, 0x04AD6006u, 0x808A0095u, 0xBE082240u, 0x321294C0u, 0x352A0500u},
+  {0x715540BBu, 0xC328F222u, 0x47184848u, 0x0C000BC0u, 0x06608309u, 0xE1701204u},
+  {0x8858702Eu, 0x0D00C82Fu, 0xBD846000u, 0x19B15C10u, 0x12400F24u, 0x02028E98u},
+  {0x8441A910u, 0x8C04A000u, 0x40D36CE7u, 0x38360400u, 0xA1684487u, 0xE222190Au},
+  {0xB1000319u, 0x06C39465u, 0x43DB49CAu, 0x3E1664BEu, 0x9B008E68u, 0x910060C2u},
+  {0x2041E480u, 0x64802C62u, 0x22209A90u, 0x30580816u, 0xC2581200u, 0x160568D0u},
+  {0x05804233u, 0xC4059342u, 0x0C080015u, 0xE583F042u, 0xB5141030u, 0x25110320u},
+  {0x8946289Cu, 0xB00FAA1Eu, 0x003069A0u, 0x046180C0u, 0xC2056003u, 0x51425926u},
+  {0x715888A2u, 0x943AA616u, 0x61321F4Cu, 0x1A405CA4u, 0x18005480u, 0x00AD0822u},
+  {0xD05E12B0u, 0x08302551u, 0x670C818Du, 0xC5008678u, 0x0743208Fu, 0x582000CEu},
+  {0x1502AB04u, 0x402C0040u, 0x5C121160u, 0x25048AA8u, 0xD8F8A206u, 0x984A0A31u},
+  {0x22100402u, 0xC0C04A25u, 0xA98A0841u, 0x8486E8D4u, 0xF042511Au, 0x00847590u},
+  {0x0B4326C4u, 0x222828AAu, 0x0090F714u, 0x520CC610u, 0x45444CA6u, 0x7223C0B8u},
+  {0x5863F883u, 0x08380B52u, 0x9D6E0910u, 0x05C21641u, 0xD4AA1D00u, 0x308082F1u},
+  {0x23200CA1u, 0x00191524u, 0x12789970u, 0x4A0A07E2u, 0xD2E46854u, 0x044206ADu},
+  {0x06007900u, 0x816F000Cu, 0xD84807CFu, 0x86F80C00u, 0xC4065735u, 0x80404CC8u},
+  {0x41209221u, 0x046F8002u, 0x8036A50Eu, 0x19A30405u, 0x21D8D381u, 0x04442813u},
+  {0x110000B4u, 0xB40B8C03u, 0x74A08028u, 0x24484821u, 0x8E800299u, 0xC8DD2291u},
+  {0x500308C4u, 0xC6314D80u, 0xE830A151u, 0x02408F16u, 0x9868AC1Bu, 0x882C427Au},
+  {0x0732100Du, 0x20022340u, 0x1A0A0220u, 0x20631202u, 0xA4C75D21u, 0x4A88C41Au},
+  {0x34462416u, 0x010ABA88u, 0x1E090082u, 0x182D8C01u, 0x41471023u, 0x42154814u},
+  {0x8A4A9800u, 0x84A1B6B4u, 0x0004C997u, 0x2D210291u, 0x54B52A8Cu, 0x454240DDu},
+  {0xBC000001u, 0x20610841u, 0x1308061Eu, 0xE0180501u, 0x52602781u, 0xA082188Eu},
+  {0x010209CCu, 0xB024C060u, 0x40031616u, 0x4000D817u, 0x82001389u, 0x419224C8u},
+  {0x40090E88u, 0x80AE2183u, 0x00291E1Cu, 0xA5500D10u, 0x144A0E00u, 0x11460000u},
+  {0x1C806033u, 0x1C1ACA21u, 0x13004280u, 0x1083F008u, 0x240D4AB6u, 0xE209634Cu},
+  {0xA0E70208u, 0x99040138u, 0x21184400u, 0xA01031C3u, 0xB2872D10u, 0x0D41C302u},
+  {0x42D58051u, 0xA2462106u, 0x78791340u, 0x3210A10Cu, 0x0D19E802u, 0x61080140u},
+  {0x38C04602u, 0x20281666u, 0x08180B0Du, 0x8F203628u, 0x20502020u, 0x80BC022Bu},
+  {0x404E881Cu, 0x2C0CC229u, 0x0E0024B0u, 0x344A2359u, 0x400B8D4Au, 0x2C823403u},
+  {0x04B15800u, 0x11114780u, 0x50002418u, 0xA3013442u, 0x41BD9020u, 0x04280614u},
+  {0x1228D410u, 0x60088066u, 0x3404028Fu, 0x81B2E28Eu, 0x2083728Bu, 0x16808404u},
+  {0xF3372223u, 0x108004ACu, 0x63208077u, 0x00112148u, 0x0E201088u, 0xA943251Cu},
+  {0x18083885u, 0x2122D216u, 0xD1E955B8u, 0x02B40810u, 0x1B152098u, 0x232960B0u},
+  {0x93922417u, 0x00043110u, 0x03E81838u, 0x059168E0u, 0x08000F00u, 0x360A2A0Bu},
+  {0x70345001u, 0x111909F5u, 0x050234E4u, 0x4410CAE2u, 0x06A84920u, 0x1038C6A4u},
+  {0x28400855u, 0x28E05040u, 0x1AC00090u, 0x08213658u, 0x00080429u, 0xC9240414u},
+  {0x419534A8u, 0x042E4E03u, 0x60105BC3u, 0x0078800Cu, 0x9608C201u, 0x00183443u},
+  {0x909A48A0u, 0x249024A0u, 0x42A04785u, 0x91441056u, 0x1768B220u, 0x9A5AC806u},
+  {0x690F6CA8u, 0x11C5805Cu, 0xC2698262u, 0x2FA1082Fu, 0x02806404u, 0x4C25D4F4u},
+  {0x85F80C0Bu, 0x00C00042u, 0x4A207CA3u, 0x85100667u, 0x04438628u, 0x0182121Bu},
+  {0xB25810FDu, 0x4ED402BAu, 0x02056509u, 0x0AE21686u, 0x442A02A8u, 0x231490E2u},
+  {0x07054004u, 0x33443232u, 0x0C2A00A3u, 0x1018B140u, 0x409841A8u, 0x1C020218u},
+  {0x37644828u, 0xC6400206u, 0x305A5106u, 0x8C91C006u, 0x40203B00u, 0x514A8260u},
+  {0x8D109446u, 0x20730A27u, 0xD28A0D70u, 0x41001414u, 0x2011A885u, 0x88202201u},
+  {0x1118A048u, 0x24CDF4B0u, 0x81A84842u, 0x0F716058u, 0xC02C4435u, 0xA102010Eu},
+  {0x14710234u, 0x49628820u, 0x2FB8D020u, 0x6361A289u, 0x46258A14u, 0x06046E31u},
+  {0x8448231Au, 0x11E240A5u, 0x80514CA0u, 0x01920491u, 0x060B00A8u, 0xE30A8C52u},
+  {0x49AD22EBu, 0x15071898u, 0x229304ECu, 0x2095AA01u, 0xFA835634u, 0xA0A4100Eu},
+  {0x31110561u, 0x81814200u, 0x94880048u, 0x58112746u, 0x00830B1Au, 0xA9481234u},
+  {0x28D92048u, 0x18101A01u, 0xC0F9108Au, 0xB2D04400u, 0x46905A13u, 0xA604B062u},
+  {0x051A1B50u, 0x002C0E12u, 0x2AA48800u, 0x42E0D180u, 0xC3078351u, 0x0C060495u},
+  {0x03C50180u, 0x7DCE4D88u, 0x0D582626u, 0x2C422831u, 0x0D428115u, 0x40C01A50u},
+  {0x400C9910u, 0x8C820425u, 0x70AC1032u, 0xD3582400u, 0x2D24B902u, 0xA9014D06u},
+  {0x01810064u, 0xC9C42500u, 0x0960484Cu, 0x314087CCu, 0x3024843Au, 0xA6526020u},
+  {0x012381B0u, 0x582E0C09u, 0x2C801500u, 0x1A104029u, 0xA910208Au, 0x500C6884u},
+  {0x0C000060u, 0xC0382908u, 0xDEA1022Eu, 0x86443024u, 0xCC140047u, 0x6826200Cu},
+  {0x1A823193u, 0x04820301u, 0x07511112u, 0x07E85979u, 0x1C44404Au, 0x1048453Cu}
+};
+
+static const number_t conv1d_119_ternary_scale[128] = { 37, 35, 37, 37, 35, 39, 34, 37, 35, 35, 35, 35, 38, 37, 39, 36, 35, 37, 37, 35, 37, 33, 35, 36, 37, 36, 38, 36, 36, 39, 36, 37, 35, 36, 37, 35, 37, 37, 35, 36, 38, 34, 39, 39, 36, 37, 37, 39, 37, 36, 37, 35, 38, 38, 37, 37, 38, 35, 35, 36, 35, 39, 37, 37, 35, 35, 35, 38, 38, 37, 35, 39, 33, 35, 36, 35, 35, 35, 37, 37, 34, 38, 36, 35, 35, 39, 37, 36, 37, 35, 38, 35, 37, 37, 36, 36, 37, 38, 35, 33, 37, 38, 36, 37, 37, 37, 37, 37, 39, 37, 37, 35, 35, 35, 35, 37, 34, 35, 36, 39, 37, 37, 37, 36, 35, 35, 41, 35 };
+
+const ternary_weights_t conv1d_119_ternary = {
+  6, &conv1d_119_ternary_pos[0][0], &conv1d_119_ternary_neg[0][0], conv1d_119_ternary_scale
+};
+
+#define DENSE_58_TERNARY
+
+const int16_t dense_58_bias[40] = {-8, 10, 14, 4, 4, 11, 13, 0, -2, -9, -4, 2, -9, -4, 0, 9, -8, 4, 9, 2, -5, 14, 7, 14, 4, -3, -1, 11, -6, 0, -10, 1, 14, 0, 0, -8, -8, -3, 1, -8}
+;
+
+static const uint32_t dense_58_ternary_pos[40][4] = {
+  {0x0C542449u, 0x5086C9A2u, 0x45291818u, 0x93628210u},
+  {0x48C23216u, 0x91180868u, 0x55C81D44u, 0xCC1485A4u},
+  {0x685C869Cu, 0x0A102B60u, 0xA001D044u, 0x6A4C2C08u},
+  {0x8A11C910u, 0x2E91C8D8u, 0x04404044u, 0x192B3269u},
+  {0x810A0C10u, 0xAA797998u, 0x4039284Bu, 0x03A1A400u},
+  {0xA7B82B08u, 0x05002816u, 0x5E3C1A89u, 0x1509DC28u},
+  {0xC1144009u, 0xB13208B4u, 0x9265C16Au, 0x0881C958u},
+  {0x3111AA95u, 0x860D4207u, 0x00001209u, 0x28242000u},
+  {0x8609AE52u, 0x02907994u, 0x000042D4u, 0x00351B9Au},
+  {0x064E5620u, 0xE8850161u, 0x0210B903u, 0x3F18444Au},
+  {0x50200163u, 0xE044EA60u, 0x22540B11u, 0x700F1800u},
+  {0xA41A14C4u, 0x58422620u, 0x0C1D08A0u, 0x20A22280u},
+  {0x62ADF056u, 0x6270DD20u, 0x7D0440F5u, 0x728C0850u},
+  {0xC2022263u, 0xC0008181u, 0x68740A49u, 0x010E880Cu},
+  {0x48A675C4u, 0xA04BCC89u, 0x10240002u, 0x01A9000Cu},
+  {0x052AD910u, 0x64A81109u, 0x92C0B41Au, 0x08E03410u},
+  {0xC06069E7u, 0x4004253Du, 0x828505B6u, 0xC65D2E5Au},
+  {0x40540404u, 0x3108C888u, 0x7230C04Cu, 0x06446381u},
+  {0x23902F8Cu, 0x235A1010u, 0x37809CF3u, 0xD69E0977u},
+  {0x602F1880u, 0x3B077031u, 0xEF446823u, 0x1A090012u},
+  {0x006A2809u, 0x2C06E617u, 0x4825DF84u, 0x15E41000u},
+  {0x02002124u, 0x8B0B134Eu, 0x44C14802u, 0x42C60A35u},
+  {0x8822D030u, 0x04240932u, 0x0CA503CEu, 0x18095241u},
+  {0x4341C2D0u, 0x4421784Fu, 0x28581802u, 0x25D2A521u},
+  {0xDAE10291u, 0x00D021D2u, 0x6A40404Eu, 0x28E22101u},
+  {0x087078C0u, 0x01C19805u, 0xA2788AA4u, 0xCC5190A0u},
+  {0x30440095u, 0x01E20200u, 0x2E001189u, 0x94A010F0u},
+  {0x22CDAE74u, 0x10004022u, 0x21C0D9C9u, 0x63428080u},
+  {0x5B612831u, 0x32C00683u, 0x60280810u, 0x834206C1u},
+  {0xA0A2180Cu, 0xA0001450u, 0x0D899091u, 0x769D0906u},
+  {0x994405ABu, 0x4496071Cu, 0x8220C2A0u, 0xC8189980u},
+  {0x26810D9Cu, 0x101F2224u, 0x4484104Au, 0x92284526u},
+  {0x4394C401u, 0x0267A000u, 0xF0A1680Au, 0x06410108u},
+  {0xA9602078u, 0x463E004Bu, 0x86324080u, 0x16202038u},
+  {0x04346120u, 0x31D2F480u, 0x0F348923u, 0x80024E83u},
+  {0x20A68102u, 0x0025DA24u, 0x63656601u, 0x22488363u},
+  {0x2CEE180Bu, 0x08F40032u, 0x42209455u, 0x1E016018u},
+  {0x420E0110u, 0x54990AF8u, 0x20616883u, 0xC0011210u},
+  {0xA044A08Cu, 0x22056741u, 0x43391048u, 0x101C52A1u},
+  {0x35061D60u, 0x07005010u, 0xA9401660u, 0xC4B9B0E3u}
+};
+
+static const uint32_t dense_58_ternary_neg[40][4] = {
+  {0x33839104u, 0x26692249u, 0x38064464u, 0x681D0509u},
+  {0x950444A1u, 0x40462101u, 0xA2160020u, 0x1223300Au},
+  {0x87811141u, 0x54AF1082u, 0x1A902789u, 0x9120C347u},
+  {0x01841669u, 0x10643624u, 0x0109A591u, 0x60008886u},
+  {0x62B5F32Cu, 0x44840405u, 0x8C86D094u, 0x64585092u},
+  {0x5041D026u, 0x2A76C620u, 0x0103E456u, 0x2A200294u},
+  {0x008ABC06u, 0x0C8CF402u, 0x29981691u, 0x12663083u},
+  {0x002C5008u, 0x10620998u, 0xB38F4086u, 0x01D0D50Eu},
+  {0x78220184u, 0x10648069u, 0xD77B9428u, 0x16880000u},
+  {0x21118014u, 0x0432BA0Eu, 0x51070440u, 0x00A19395u},
+  {0x8EC5C084u, 0x1739051Eu, 0x8C2A84C6u, 0x8E8004A4u},
+  {0x00802A11u, 0x869C489Du, 0x10E2A71Bu, 0xC848194Fu},
+  {0x900001A1u, 0x0C8522CDu, 0x8090270Au, 0x0013E587u},
+  {0x0C254004u, 0x3FBD544Au, 0x968A1120u, 0x56911520u},
+  {0x97110808u, 0x11101222u, 0xAB419539u, 0x90040A30u},
+  {0x30C1020Eu, 0x104620E2u, 0x6C2B4080u, 0xC7040B2Eu},
+  {0x00931418u, 0x85AB9A42u, 0x34200248u, 0x08A2C1A4u},
+  {0x2DAB2B19u, 0x0C151435u, 0x84460303u, 0x190A9846u},
+  {0x00001043u, 0x140180EDu, 0xC00B6000u, 0x08417088u},
+  {0x8500E04Au, 0xC42803CEu, 0x109B8514u, 0x4034B604u},
+  {0x0201D500u, 0x81B81800u, 0x36100071u, 0x8213C616u},
+  {0x88338250u, 0x74D00C00u, 0x003C368Cu, 0x8D002142u},
+  {0x260504CDu, 0xCB989601u, 0x22583001u, 0xA6002800u},
+  {0xB02C112Eu, 0x380C06B0u, 0x142282CDu, 0xD22D4A8Au},
+  {0x240E2140u, 0x0F2B5E28u, 0x80B80521u, 0xD5001498u},
+  {0xA68E802Eu, 0xC81E2780u, 0x41824149u, 0x20826719u},
+  {0x8308D148u, 0x8E183C60u, 0x11A56422u, 0x084CC102u},
+  {0x49221000u, 0x06A48895u, 0x8A3C0232u, 0x841C2129u},
+  {0x808C00CCu, 0xC5207934u, 0x149080EEu, 0x3409D038u},
+  {0x1218C6B2u, 0x1BB36305u, 0x62664D02u, 0x0802A049u},
+  {0x00997854u, 0x212960E1u, 0x39800D4Du, 0x1387442Du},
+  {0x083A4202u, 0x084009D9u, 0x10500A14u, 0x4502BA48u},
+  {0xB00A3804u, 0x80984330u, 0x0A120704u, 0x58A63081u},
+  {0x02980103u, 0x81C07430u, 0x21C1B353u, 0x61DA1BC5u},
+  {0x42888084u, 0x84250A2Eu, 0x508134D4u, 0x09392104u},
+  {0xD9197801u, 0xAB1001D0u, 0x889A90B0u, 0x88965C84u},
+  {0x8000C340u, 0x21021EC1u, 0xB41A0008u, 0x80E411E1u},
+  {0xBC81926Fu, 0x08461107u, 0x15881158u, 0x095E2064u},
+  {0x40381F21u, 0xC1009830u, 0x8800ECB1u, 0x0C00A506u},
+  {0xCAD9E007u, 0x502B2941u, 0x56B3C086u, 0x1A004E0Cu}
+};
+
+static const number_t dense_58_ternary_scale[40] = { 65, 64, 63, 68, 64, 65, 66, 68, 69, 65, 68, 67, 63, 73, 63, 69, 67, 68, 66, 71, 65, 62, 66, 69, 68, 64, 67, 65, 67, 62, 70, 67, 70, 68, 66, 63, 68, 65, 65, 62 };
+
+const ternary_weights_t dense_58_ternary = {
+  4, &dense_58_ternary_pos[0][0], &dense_58_ternary_neg[0][0], dense_58_ternary_scale
+};
+
+#endif//CNN_TERNARY
 /**
   ******************************************************************************
   * @file    maxpool.cc
@@ -150,7 +1095,7 @@ static inline void conv1d_116(
   unsigned short x;
   short input_x;
   long_number_t	kernel_mac;
-  static long_number_t	output_acc[CONV_OUTSAMPLES];
+  long_number_t	output_acc[CONV_OUTSAMPLES];
   long_number_t tmp;
 
   for (k = 0; k < CONV_FILTERS; k++) { 
@@ -311,6 +1256,135 @@ static inline void max_pooling1d_146(
 #undef POOL_PAD
 #undef POOL_LENGTH
 #undef ACTIVATION_LINEAR
+/**
+  ******************************************************************************
+  * @file    max_pooling1d_145_conv1d_116_max_pooling1d_146.c
+  * @version 1.0.0
+  * @date    17 october 2026
+  * @brief   max_pooling1d_145, conv1d_116 and max_pooling1d_146 fused: the pooled input
+  *          samples are computed under the conv kernel and each output sample is the max
+  *          of the conv outputs under the second pool, neither buffer is materialized
+  */
+
+#ifndef SINGLE_FILE
+#include "number.h"
+#include "layer_params.h"
+#include "conv1d_simd.h"
+#endif
+
+#define INPUT_CHANNELS      1
+#define INPUT_SAMPLES       16000
+#define POOL_SIZE           2
+#define POOL_STRIDE         2
+#define POOL_LENGTH         ( ( (INPUT_SAMPLES - POOL_SIZE) / POOL_STRIDE ) + 1 )
+#define CONV_FILTERS        16
+#define CONV_KERNEL_SIZE    20
+#define CONV_STRIDE         8
+#define CONV_OUTSAMPLES     ( ( (POOL_LENGTH - CONV_KERNEL_SIZE) / CONV_STRIDE ) + 1 )
+#define OUTPUT_POOL_SIZE    2
+#define OUTPUT_POOL_STRIDE  2
+#define OUTPUT_POOL_LENGTH  ( ( (CONV_OUTSAMPLES - OUTPUT_POOL_SIZE) / OUTPUT_POOL_STRIDE ) + 1 )
+
+#define ACTIVATION_RELU
+
+#ifdef CNN_DSP
+// Shapes of the fused layers for the kernel of dsp.h, those of max_pooling1d_145.c, conv1d_116.c and max_pooling1d_146.c
+static const maxpool1d_params_t max_pooling1d_145_params = {
+  INPUT_CHANNELS, INPUT_SAMPLES, POOL_SIZE, POOL_STRIDE, POOL_LENGTH, ACTIVATION_KIND_LINEAR,
+};
+
+static const conv1d_params_t conv1d_116_params = {
+  INPUT_CHANNELS, POOL_LENGTH, CONV_FILTERS, CONV_KERNEL_SIZE, CONV_STRIDE, 0, 0, CONV_OUTSAMPLES,
+  ACTIVATION_KIND_RELU, FIXED_POINT,
+};
+
+static const maxpool1d_params_t max_pooling1d_146_params = {
+  CONV_FILTERS, CONV_OUTSAMPLES, OUTPUT_POOL_SIZE, OUTPUT_POOL_STRIDE, OUTPUT_POOL_LENGTH, ACTIVATION_KIND_LINEAR,
+};
+#endif
+
+static inline void max_pooling1d_145_conv1d_116_max_pooling1d_146(
+  const number_t input[INPUT_CHANNELS][INPUT_SAMPLES],                   // IN
+  const number_t kernel[CONV_FILTERS][INPUT_CHANNELS][CONV_KERNEL_SIZE], // IN
+
+  const number_t bias[CONV_FILTERS],                                     // IN
+
+  number_t output[CONV_FILTERS][OUTPUT_POOL_LENGTH]) {                  // OUT
+
+  unsigned short pos_x, z, k, x, y, w;
+  unsigned int input_x;
+  number_t window[INPUT_CHANNELS][CONV_KERNEL_SIZE]; // pooled samples under the kernel
+  number_t max, tmp;
+  long_number_t output_acc;
+
+#ifdef CNN_SIMD
+  if (conv1d_maxpool1d_simd(&max_pooling1d_145_params, &conv1d_116_params, &max_pooling1d_146_params,
+                            &input[0][0], &kernel[0][0][0], bias, &output[0][0]))
+    return;
+#endif
+
+#ifdef CNN_DSP
+  // SMLAD kernel of dsp.h, the loops below without the DSP extension
+  if (conv1d_maxpool1d_dsp(&max_pooling1d_145_params, &conv1d_116_params, &max_pooling1d_146_params, &input[0][0], &kernel[0][0][0], bias, &output[0][0]))
+    return;
+#endif
+
+  for (pos_x = 0; pos_x < OUTPUT_POOL_LENGTH; pos_x++) {
+    for (w = 0; w < OUTPUT_POOL_SIZE; w++) {
+      // max_pooling1d_145 restricted to the window of conv output position pos_x * OUTPUT_POOL_STRIDE + w
+      for (z = 0; z < INPUT_CHANNELS; z++) {
+        for (x = 0; x < CONV_KERNEL_SIZE; x++) {
+          input_x = ((pos_x * OUTPUT_POOL_STRIDE + w) * CONV_STRIDE + x) * POOL_STRIDE;
+          max = input[z][input_x];
+          for (y = 1; y < POOL_SIZE; y++) {
+            tmp = input[z][input_x + y];
+            if (max < tmp)
+              max = tmp;
+          }
+          window[z][x] = max;
+        }
+      }
+
+      for (k = 0; k < CONV_FILTERS; k++) {
+        output_acc = 0;
+        for (z = 0; z < INPUT_CHANNELS; z++)
+          for (x = 0; x < CONV_KERNEL_SIZE; x++)
+            output_acc = output_acc + window[z][x] * kernel[k][z][x];
+
+        output_acc = scale_number_t(output_acc);
+
+        output_acc = output_acc + bias[k];
+
+#ifdef ACTIVATION_LINEAR
+        tmp = clamp_to_number_t(output_acc);
+#elif defined(ACTIVATION_RELU)
+        // Activation function: ReLU
+        if (output_acc < 0)
+          tmp = 0;
+        else
+          tmp = clamp_to_number_t(output_acc);
+#endif
+        // max_pooling1d_146 is linear: the first conv output under the pool initializes the max
+        if (w == 0 || output[k][pos_x] < tmp)
+          output[k][pos_x] = tmp;
+      }
+    }
+  }
+}
+
+#undef INPUT_CHANNELS
+#undef INPUT_SAMPLES
+#undef POOL_SIZE
+#undef POOL_STRIDE
+#undef POOL_LENGTH
+#undef CONV_FILTERS
+#undef CONV_KERNEL_SIZE
+#undef CONV_STRIDE
+#undef CONV_OUTSAMPLES
+#undef OUTPUT_POOL_SIZE
+#undef OUTPUT_POOL_STRIDE
+#undef OUTPUT_POOL_LENGTH
+#undef ACTIVATION_RELU
 /**
   ******************************************************************************
   * @file    conv.cc
@@ -351,7 +1425,7 @@ static inline void conv1d_117(
   unsigned short x;
   short input_x;
   long_number_t	kernel_mac;
-  static long_number_t	output_acc[CONV_OUTSAMPLES];
+  long_number_t	output_acc[CONV_OUTSAMPLES];
   long_number_t tmp;
 
   for (k = 0; k < CONV_FILTERS; k++) { 
@@ -1024,6 +2098,125 @@ static inline void max_pooling1d_147(
 #undef POOL_PAD
 #undef POOL_LENGTH
 #undef ACTIVATION_LINEAR
+/**
+  ******************************************************************************
+  * @file    conv1d_117_max_pooling1d_147.c
+  * @version 1.0.0
+  * @date    17 october 2026
+  * @brief   conv1d_117 fused with the max_pooling1d_147 that follows it: each pooled sample
+  *          is the max of the conv outputs under the pool, which are never stored
+  */
+
+#ifndef SINGLE_FILE
+#include "number.h"
+#include "layer_params.h"
+#include "conv1d_simd.h"
+#include "conv1d_im2col.h"
+#endif
+
+#define INPUT_CHANNELS      16
+#define INPUT_SAMPLES       499
+#define CONV_FILTERS        32
+#define CONV_KERNEL_SIZE    3
+#define CONV_STRIDE         2
+#define CONV_OUTSAMPLES     ( ( (INPUT_SAMPLES - CONV_KERNEL_SIZE) / CONV_STRIDE ) + 1 )
+#define POOL_SIZE           2
+#define POOL_STRIDE         2
+#define POOL_LENGTH         ( ( (CONV_OUTSAMPLES - POOL_SIZE) / POOL_STRIDE ) + 1 )
+
+#define ACTIVATION_RELU
+
+#ifdef CNN_DSP
+// Shapes of the fused layers for the kernel of dsp.h, those of conv1d_117.c and max_pooling1d_147.c
+static const conv1d_params_t conv1d_117_params = {
+  INPUT_CHANNELS, INPUT_SAMPLES, CONV_FILTERS, CONV_KERNEL_SIZE, CONV_STRIDE, 0, 0, CONV_OUTSAMPLES,
+  ACTIVATION_KIND_RELU, FIXED_POINT,
+};
+
+static const maxpool1d_params_t max_pooling1d_147_params = {
+  CONV_FILTERS, CONV_OUTSAMPLES, POOL_SIZE, POOL_STRIDE, POOL_LENGTH, ACTIVATION_KIND_LINEAR,
+};
+#endif
+
+static inline void conv1d_117_max_pooling1d_147(
+  const number_t input[INPUT_CHANNELS][INPUT_SAMPLES],                   // IN
+  const number_t kernel[CONV_FILTERS][INPUT_CHANNELS][CONV_KERNEL_SIZE], // IN
+
+  const number_t bias[CONV_FILTERS],                                     // IN
+
+  number_t output[CONV_FILTERS][POOL_LENGTH]) {                         // OUT
+
+  unsigned short pos_x, z, k, x, y;
+  unsigned short input_x;
+  long_number_t kernel_mac;
+  long_number_t output_acc[CONV_OUTSAMPLES]; // conv outputs of one filter, pooled before the activation
+  long_number_t max;
+
+#ifdef CONV1D_IM2COL
+  // im2col + blocked GEMM path, selected at build time
+  if (conv1d_maxpool1d_im2col_gemm(&conv1d_117_params, &max_pooling1d_147_params, &input[0][0], &kernel[0][0][0], bias, &output[0][0]))
+    return;
+#endif
+
+#ifdef CNN_SIMD
+  // Vectorized kernel of the running CPU, the loops below are the scalar fallback
+  if (conv1d_maxpool1d_simd(NULL, &conv1d_117_params, &max_pooling1d_147_params, &input[0][0], &kernel[0][0][0], bias, &output[0][0]))
+    return;
+#endif
+
+#ifdef CNN_DSP
+  // SMLAD kernel of dsp.h, the loops below without the DSP extension
+  if (conv1d_maxpool1d_dsp(NULL, &conv1d_117_params, &max_pooling1d_147_params, &input[0][0], &kernel[0][0][0], bias, &output[0][0]))
+    return;
+#endif
+
+  for (k = 0; k < CONV_FILTERS; k++) {
+    for (pos_x = 0; pos_x < CONV_OUTSAMPLES; pos_x++) {
+      output_acc[pos_x] = 0;
+      for (z = 0; z < INPUT_CHANNELS; z++) {
+        kernel_mac = 0;
+        for (x = 0; x < CONV_KERNEL_SIZE; x++) {
+          input_x = pos_x * CONV_STRIDE + x;
+          kernel_mac = kernel_mac + input[z][input_x] * kernel[k][z][x];
+        }
+        output_acc[pos_x] = output_acc[pos_x] + kernel_mac;
+      }
+      output_acc[pos_x] = scale_number_t(output_acc[pos_x]);
+
+      output_acc[pos_x] = output_acc[pos_x] + bias[k];
+    }
+
+    // max_pooling1d_147 (linear) of the row; the activation and the clamp are monotonic so they
+    // are applied once to the max instead of to every conv output
+    for (pos_x = 0; pos_x < POOL_LENGTH; pos_x++) {
+      max = output_acc[pos_x * POOL_STRIDE];
+      for (y = 1; y < POOL_SIZE; y++)
+        if (max < output_acc[pos_x * POOL_STRIDE + y])
+          max = output_acc[pos_x * POOL_STRIDE + y];
+
+#ifdef ACTIVATION_LINEAR
+      output[k][pos_x] = clamp_to_number_t(max);
+#elif defined(ACTIVATION_RELU)
+      // Activation function: ReLU
+      if (max < 0)
+        output[k][pos_x] = 0;
+      else
+        output[k][pos_x] = clamp_to_number_t(max);
+#endif
+    }
+  }
+}
+
+#undef INPUT_CHANNELS
+#undef INPUT_SAMPLES
+#undef CONV_FILTERS
+#undef CONV_KERNEL_SIZE
+#undef CONV_STRIDE
+#undef CONV_OUTSAMPLES
+#undef POOL_SIZE
+#undef POOL_STRIDE
+#undef POOL_LENGTH
+#undef ACTIVATION_RELU
 /**
   ******************************************************************************
   * @file    conv.cc
@@ -1064,7 +2257,7 @@ static inline void conv1d_118(
   unsigned short x;
   short input_x;
   long_number_t	kernel_mac;
-  static long_number_t	output_acc[CONV_OUTSAMPLES];
+  long_number_t	output_acc[CONV_OUTSAMPLES];
   long_number_t tmp;
 
   for (k = 0; k < CONV_FILTERS; k++) { 
@@ -3305,6 +4498,125 @@ static inline void max_pooling1d_148(
 #undef POOL_PAD
 #undef POOL_LENGTH
 #undef ACTIVATION_LINEAR
+/**
+  ******************************************************************************
+  * @file    conv1d_118_max_pooling1d_148.c
+  * @version 1.0.0
+  * @date    17 october 2026
+  * @brief   conv1d_118 fused with the max_pooling1d_148 that follows it: each pooled sample
+  *          is the max of the conv outputs under the pool, which are never stored
+  */
+
+#ifndef SINGLE_FILE
+#include "number.h"
+#include "layer_params.h"
+#include "conv1d_simd.h"
+#include "conv1d_im2col.h"
+#endif
+
+#define INPUT_CHANNELS      32
+#define INPUT_SAMPLES       124
+#define CONV_FILTERS        64
+#define CONV_KERNEL_SIZE    3
+#define CONV_STRIDE         2
+#define CONV_OUTSAMPLES     ( ( (INPUT_SAMPLES - CONV_KERNEL_SIZE) / CONV_STRIDE ) + 1 )
+#define POOL_SIZE           2
+#define POOL_STRIDE         2
+#define POOL_LENGTH         ( ( (CONV_OUTSAMPLES - POOL_SIZE) / POOL_STRIDE ) + 1 )
+
+#define ACTIVATION_RELU
+
+#ifdef CNN_DSP
+// Shapes of the fused layers for the kernel of dsp.h, those of conv1d_118.c and max_pooling1d_148.c
+static const conv1d_params_t conv1d_118_params = {
+  INPUT_CHANNELS, INPUT_SAMPLES, CONV_FILTERS, CONV_KERNEL_SIZE, CONV_STRIDE, 0, 0, CONV_OUTSAMPLES,
+  ACTIVATION_KIND_RELU, FIXED_POINT,
+};
+
+static const maxpool1d_params_t max_pooling1d_148_params = {
+  CONV_FILTERS, CONV_OUTSAMPLES, POOL_SIZE, POOL_STRIDE, POOL_LENGTH, ACTIVATION_KIND_LINEAR,
+};
+#endif
+
+static inline void conv1d_118_max_pooling1d_148(
+  const number_t input[INPUT_CHANNELS][INPUT_SAMPLES],                   // IN
+  const number_t kernel[CONV_FILTERS][INPUT_CHANNELS][CONV_KERNEL_SIZE], // IN
+
+  const number_t bias[CONV_FILTERS],                                     // IN
+
+  number_t output[CONV_FILTERS][POOL_LENGTH]) {                         // OUT
+
+  unsigned short pos_x, z, k, x, y;
+  unsigned short input_x;
+  long_number_t kernel_mac;
+  long_number_t output_acc[CONV_OUTSAMPLES]; // conv outputs of one filter, pooled before the activation
+  long_number_t max;
+
+#ifdef CONV1D_IM2COL
+  // im2col + blocked GEMM path, selected at build time
+  if (conv1d_maxpool1d_im2col_gemm(&conv1d_118_params, &max_pooling1d_148_params, &input[0][0], &kernel[0][0][0], bias, &output[0][0]))
+    return;
+#endif
+
+#ifdef CNN_SIMD
+  // Vectorized kernel of the running CPU, the loops below are the scalar fallback
+  if (conv1d_maxpool1d_simd(NULL, &conv1d_118_params, &max_pooling1d_148_params, &input[0][0], &kernel[0][0][0], bias, &output[0][0]))
+    return;
+#endif
+
+#ifdef CNN_DSP
+  // SMLAD kernel of dsp.h, the loops below without the DSP extension
+  if (conv1d_maxpool1d_dsp(NULL, &conv1d_118_params, &max_pooling1d_148_params, &input[0][0], &kernel[0][0][0], bias, &output[0][0]))
+    return;
+#endif
+
+  for (k = 0; k < CONV_FILTERS; k++) {
+    for (pos_x = 0; pos_x < CONV_OUTSAMPLES; pos_x++) {
+      output_acc[pos_x] = 0;
+      for (z = 0; z < INPUT_CHANNELS; z++) {
+        kernel_mac = 0;
+        for (x = 0; x < CONV_KERNEL_SIZE; x++) {
+          input_x = pos_x * CONV_STRIDE + x;
+          kernel_mac = kernel_mac + input[z][input_x] * kernel[k][z][x];
+        }
+        output_acc[pos_x] = output_acc[pos_x] + kernel_mac;
+      }
+      output_acc[pos_x] = scale_number_t(output_acc[pos_x]);
+
+      output_acc[pos_x] = output_acc[pos_x] + bias[k];
+    }
+
+    // max_pooling1d_148 (linear) of the row; the activation and the clamp are monotonic so they
+    // are applied once to the max instead of to every conv output
+    for (pos_x = 0; pos_x < POOL_LENGTH; pos_x++) {
+      max = output_acc[pos_x * POOL_STRIDE];
+      for (y = 1; y < POOL_SIZE; y++)
+        if (max < output_acc[pos_x * POOL_STRIDE + y])
+          max = output_acc[pos_x * POOL_STRIDE + y];
+
+#ifdef ACTIVATION_LINEAR
+      output[k][pos_x] = clamp_to_number_t(max);
+#elif defined(ACTIVATION_RELU)
+      // Activation function: ReLU
+      if (max < 0)
+        output[k][pos_x] = 0;
+      else
+        output[k][pos_x] = clamp_to_number_t(max);
+#endif
+    }
+  }
+}
+
+#undef INPUT_CHANNELS
+#undef INPUT_SAMPLES
+#undef CONV_FILTERS
+#undef CONV_KERNEL_SIZE
+#undef CONV_STRIDE
+#undef CONV_OUTSAMPLES
+#undef POOL_SIZE
+#undef POOL_STRIDE
+#undef POOL_LENGTH
+#undef ACTIVATION_RELU
 /**
   ******************************************************************************
   * @file    conv.cc
@@ -3345,7 +4657,7 @@ static inline void conv1d_119(
   unsigned short x;
   short input_x;
   long_number_t	kernel_mac;
-  static long_number_t	output_acc[CONV_OUTSAMPLES];
+  long_number_t	output_acc[CONV_OUTSAMPLES];
   long_number_t tmp;
 
   for (k = 0; k < CONV_FILTERS; k++) { 
@@ -3408,6 +4720,7 @@ static inline void conv1d_119(
 #define CONV_KERNEL_SIZE  3
 
 
+#ifndef CONV1D_119_TERNARY // -DCNN_TERNARY: the ternary weights above hold the bias
 const int16_t conv1d_119_bias[CONV_FILTERS] = {-2, -10, 14, 0, 9, -11, -5, 20, 3, 4, 10, 6, -16, 0, 6, 12, -4, -15, 0, -5, 19, -16, 0, 8, 4, 14, -8, 2, -10, 1, 15, 12, 0, 0, 1, 6, 1, -9, 22, 2, 6, -6, -13, 7, 3, 12, 6, -12, 17, 7, -14, 4, 0, 12, -5, -8, 22, -1, 1, -5, 5, 9, -10, 4, -1, 16, 0, 19, -7, 3, 21, -6, -2, -15, 0, 6, 6, -8, 9, 9, 2, -3, -16, -9, -6, -7, 5, 22, -2, -5, 10, -4, 22, 5, 13, 4, 8, -15, 17, -3, 0, 17, 3, -6, 14, -8, 12, -4, 2, -5, 4, -3, 6, 2, -4, -3, 7, -2, 11, 15, -3, 0, -4, 4, -3, 2, -4, -8}
 ;
 
@@ -11733,6 +13046,7 @@ const int16_t conv1d_119_kernel[CONV_FILTERS][INPUT_CHANNELS][CONV_KERNEL_SIZE]
 }
 }
 ;
+#endif
 
 #undef INPUT_CHANNELS
 #undef CONV_FILTERS
@@ -11794,6 +13108,136 @@ static inline void max_pooling1d_149(
 #undef POOL_PAD
 #undef POOL_LENGTH
 #undef ACTIVATION_LINEAR
+/**
+  ******************************************************************************
+  * @file    conv1d_119_max_pooling1d_149.c
+  * @version 1.0.0
+  * @date    17 october 2026
+  * @brief   conv1d_119 fused with the max_pooling1d_149 that follows it: each pooled sample
+  *          is the max of the conv outputs under the pool, which are never stored
+  */
+
+#ifndef SINGLE_FILE
+#include "number.h"
+#include "layer_params.h"
+#include "conv1d_simd.h"
+#include "conv1d_im2col.h"
+#endif
+
+#define INPUT_CHANNELS      64
+#define INPUT_SAMPLES       30
+#define CONV_FILTERS        128
+#define CONV_KERNEL_SIZE    3
+#define CONV_STRIDE         1
+#define CONV_OUTSAMPLES     ( ( (INPUT_SAMPLES - CONV_KERNEL_SIZE) / CONV_STRIDE ) + 1 )
+#define POOL_SIZE           2
+#define POOL_STRIDE         2
+#define POOL_LENGTH         ( ( (CONV_OUTSAMPLES - POOL_SIZE) / POOL_STRIDE ) + 1 )
+
+#define ACTIVATION_RELU
+
+#if defined(CNN_DSP) || defined(CONV1D_119_TERNARY)
+// Shapes of the fused layers for the kernels of dsp.h and ternary.h, those of conv1d_119.c and max_pooling1d_149.c
+static const conv1d_params_t conv1d_119_params = {
+  INPUT_CHANNELS, INPUT_SAMPLES, CONV_FILTERS, CONV_KERNEL_SIZE, CONV_STRIDE, 0, 0, CONV_OUTSAMPLES,
+  ACTIVATION_KIND_RELU, FIXED_POINT,
+};
+
+static const maxpool1d_params_t max_pooling1d_149_params = {
+  CONV_FILTERS, CONV_OUTSAMPLES, POOL_SIZE, POOL_STRIDE, POOL_LENGTH, ACTIVATION_KIND_LINEAR,
+};
+#endif
+
+#if defined(CONV1D_119_TERNARY) && (INPUT_CHANNELS * CONV_KERNEL_SIZE > TERNARY_MAX_TAPS || CONV_OUTSAMPLES > TERNARY_MAX_SAMPLES)
+#error "-DCNN_TERNARY: conv1d_119 does not fit the kernel of ternary.h, and has no int16 kernel to fall back to"
+#endif
+
+static inline void conv1d_119_max_pooling1d_149(
+  const number_t input[INPUT_CHANNELS][INPUT_SAMPLES],                   // IN
+  const number_t kernel[CONV_FILTERS][INPUT_CHANNELS][CONV_KERNEL_SIZE], // IN
+
+  const number_t bias[CONV_FILTERS],                                     // IN
+
+  number_t output[CONV_FILTERS][POOL_LENGTH]) {                         // OUT
+
+  unsigned short pos_x, z, k, x, y;
+  unsigned short input_x;
+  long_number_t kernel_mac;
+  long_number_t output_acc[CONV_OUTSAMPLES]; // conv outputs of one filter, pooled before the activation
+  long_number_t max;
+
+#ifdef CONV1D_119_TERNARY
+  // -DCNN_TERNARY: sign-select kernel on the ternary weights above, the only weights of the
+  // layer (kernel is NULL)
+  conv1d_maxpool1d_ternary(NULL, &conv1d_119_params, &max_pooling1d_149_params, &conv1d_119_ternary, &input[0][0], bias, &output[0][0]);
+  return;
+#endif
+
+#ifdef CONV1D_IM2COL
+  // im2col + blocked GEMM path, selected at build time
+  if (conv1d_maxpool1d_im2col_gemm(&conv1d_119_params, &max_pooling1d_149_params, &input[0][0], &kernel[0][0][0], bias, &output[0][0]))
+    return;
+#endif
+
+#ifdef CNN_SIMD
+  // Vectorized kernel of the running CPU, the loops below are the scalar fallback
+  if (conv1d_maxpool1d_simd(NULL, &conv1d_119_params, &max_pooling1d_149_params, &input[0][0], &kernel[0][0][0], bias, &output[0][0]))
+    return;
+#endif
+
+#ifdef CNN_DSP
+  // SMLAD kernel of dsp.h, the loops below without the DSP extension
+  if (conv1d_maxpool1d_dsp(NULL, &conv1d_119_params, &max_pooling1d_149_params, &input[0][0], &kernel[0][0][0], bias, &output[0][0]))
+    return;
+#endif
+
+  for (k = 0; k < CONV_FILTERS; k++) {
+    for (pos_x = 0; pos_x < CONV_OUTSAMPLES; pos_x++) {
+      output_acc[pos_x] = 0;
+      for (z = 0; z < INPUT_CHANNELS; z++) {
+        kernel_mac = 0;
+        for (x = 0; x < CONV_KERNEL_SIZE; x++) {
+          input_x = pos_x * CONV_STRIDE + x;
+          kernel_mac = kernel_mac + input[z][input_x] * kernel[k][z][x];
+        }
+        output_acc[pos_x] = output_acc[pos_x] + kernel_mac;
+      }
+      output_acc[pos_x] = scale_number_t(output_acc[pos_x]);
+
+      output_acc[pos_x] = output_acc[pos_x] + bias[k];
+    }
+
+    // max_pooling1d_149 (linear) of the row; the activation and the clamp are monotonic so they
+    // are applied once to the max instead of to every conv output
+    for (pos_x = 0; pos_x < POOL_LENGTH; pos_x++) {
+      max = output_acc[pos_x * POOL_STRIDE];
+      for (y = 1; y < POOL_SIZE; y++)
+        if (max < output_acc[pos_x * POOL_STRIDE + y])
+          max = output_acc[pos_x * POOL_STRIDE + y];
+
+#ifdef ACTIVATION_LINEAR
+      output[k][pos_x] = clamp_to_number_t(max);
+#elif defined(ACTIVATION_RELU)
+      // Activation function: ReLU
+      if (max < 0)
+        output[k][pos_x] = 0;
+      else
+        output[k][pos_x] = clamp_to_number_t(max);
+#endif
+    }
+  }
+}
+
+#undef INPUT_CHANNELS
+#undef INPUT_SAMPLES
+#undef CONV_FILTERS
+#undef CONV_KERNEL_SIZE
+#undef CONV_STRIDE
+#undef CONV_OUTSAMPLES
+#undef POOL_SIZE
+#undef POOL_STRIDE
+#undef POOL_LENGTH
+#undef ACTIVATION_RELU
 /**
   ******************************************************************************
   * @file    averagepool.cc
@@ -11943,6 +13387,7 @@ static inline void dense_58(
 #define FC_UNITS 40
 
 
+#ifndef DENSE_58_TERNARY // -DCNN_TERNARY: the ternary weights above hold the bias
 const int16_t dense_58_bias[FC_UNITS] = {-8, 10, 14, 4, 4, 11, 13, 0, -2, -9, -4, 2, -9, -4, 0, 9, -8, 4, 9, 2, -5, 14, 7, 14, 4, -3, -1, 11, -6, 0, -10, 1, 14, 0, 0, -8, -8, -3, 1, -8}
 ;
 
@@ -11988,6 +13433,7 @@ const int16_t dense_58_kernel[FC_UNITS][INPUT_SAMPLES] = {{49, 31, -50, 62, -23,
 , {-62, -66, -44, -30, 1, 68, 48, 19, 50, 4, 43, 78, 36, -73, -47, -54, -87, 59, 38, -79, -56, -8, -36, -70, 52, -78, 52, -70, 72, 69, -89, -51, -69, -17, 5, -29, 84, 20, -52, -17, -71, 27, 24, -32, 65, -81, 47, -30, -100, -47, -4, -34, -21, -89, 28, 15, 90, 40, 89, 24, -92, 7, -78, 10, -6, -52, -98, -30, 11, 54, 47, -50, -13, 54, 35, 2, 74, -21, -98, -67, -39, -58, 28, 16, -49, -66, 66, -77, 94, -56, -44, 70, -54, 75, -51, 31, 70, 85, -55, -91, 22, 49, 72, 33, -21, -33, -50, -64, 32, 82, -56, 54, 97, 17, -29, 64, 68, 42, -2, 61, -11, -81, 58, -42, -44, 5, 33, 65}
 }
 ;
+#endif
 
 #undef INPUT_SAMPLES
 #undef FC_UNITS
@@ -12076,6 +13522,133 @@ const int16_t dense_59_kernel[FC_UNITS][INPUT_SAMPLES] = {{-202, 178, -36, 48, 4
 
 #undef INPUT_SAMPLES
 #undef FC_UNITS
+/**
+  ******************************************************************************
+  * @file    average_pooling1d_29_dense_58_dense_59.c
+  * @version 1.0.0
+  * @date    17 october 2026
+  * @brief   Classifier head in one pass: average_pooling1d_29 (global), flatten_29,
+  *          dense_58 and dense_59, intermediate vectors kept on the stack
+  */
+
+#ifndef SINGLE_FILE
+#include "number.h"
+#endif
+
+#define INPUT_CHANNELS      128
+#define INPUT_SAMPLES       14
+#define POOL_SIZE           14
+#define DENSE_58_UNITS      40
+#define DENSE_59_UNITS      7
+
+#define ACTIVATION_LINEAR   // dense_58 and dense_59
+
+#if FIXED_POINT > 0
+// ceil(2^32 / POOL_SIZE): (|tmp| * POOL_RECIPROCAL) >> 32 == |tmp| / POOL_SIZE for every sum of
+// POOL_SIZE number_t up to POOL_SIZE = 361
+#define POOL_RECIPROCAL     ( ( (1LL << 32) + POOL_SIZE - 1 ) / POOL_SIZE )
+#endif
+
+static inline void average_pooling1d_29_dense_58_dense_59(
+  const number_t input[INPUT_CHANNELS][INPUT_SAMPLES],          // IN
+  const number_t kernel_58[DENSE_58_UNITS][INPUT_CHANNELS],     // IN
+  const number_t bias_58[DENSE_58_UNITS],                       // IN
+  const number_t kernel_59[DENSE_59_UNITS][DENSE_58_UNITS],     // IN
+  const number_t bias_59[DENSE_59_UNITS],                       // IN
+
+  number_t output[DENSE_59_UNITS]) {                            // OUT
+
+  unsigned short k, x;
+  long_number_t tmp, output_acc;
+  number_t pooled[INPUT_CHANNELS];   // average_pooling1d_29 output, flatten_29 is a no-op
+  number_t hidden[DENSE_58_UNITS];   // dense_58 output
+#if defined(CNN_DSP) || defined(DENSE_58_TERNARY)
+  long_number_t kernel_acc[DENSE_58_UNITS]; // sums of the dsp.h or ternary.h kernel, dense_58 then dense_59
+#endif
+#ifndef CNN_DSP
+  unsigned short z;
+#endif
+
+  for (k = 0; k < INPUT_CHANNELS; k++) {
+    tmp = 0;
+    for (x = 0; x < INPUT_SAMPLES; x++)
+      tmp += input[k][x];
+#if FIXED_POINT > 0
+    // tmp / POOL_SIZE, truncated toward zero, as a multiply
+    if (tmp < 0)
+      tmp = -(long_number_t)((-(int64_t)tmp * POOL_RECIPROCAL) >> 32);
+    else
+      tmp = (long_number_t)(((int64_t)tmp * POOL_RECIPROCAL) >> 32);
+#else
+    tmp = tmp / POOL_SIZE;
+#endif
+    pooled[k] = clamp_to_number_t(tmp);
+  }
+
+#ifdef DENSE_58_TERNARY
+  // -DCNN_TERNARY: sign-select kernel on the ternary weights above, kernel_58 is NULL
+  dense_ternary(&dense_58_ternary, INPUT_CHANNELS, DENSE_58_UNITS, pooled, kernel_acc);
+  (void)kernel_58;
+#elif defined(CNN_DSP)
+  dense_dsp(&kernel_58[0][0], INPUT_CHANNELS, DENSE_58_UNITS, pooled, kernel_acc);
+#endif
+  for (k = 0; k < DENSE_58_UNITS; k++) {
+#if defined(CNN_DSP) || defined(DENSE_58_TERNARY)
+    output_acc = kernel_acc[k];
+#else
+    output_acc = 0;
+    for (z = 0; z < INPUT_CHANNELS; z++)
+      output_acc = output_acc + ( kernel_58[k][z] * pooled[z] );
+#endif
+
+    output_acc = scale_number_t(output_acc);
+
+    output_acc = output_acc + bias_58[k];
+
+#ifdef ACTIVATION_LINEAR
+    hidden[k] = clamp_to_number_t(output_acc);
+#elif defined(ACTIVATION_RELU)
+    if (output_acc < 0)
+      hidden[k] = 0;
+    else
+      hidden[k] = clamp_to_number_t(output_acc);
+#endif
+  }
+
+#ifdef CNN_DSP
+  dense_dsp(&kernel_59[0][0], DENSE_58_UNITS, DENSE_59_UNITS, hidden, kernel_acc);
+#endif
+  for (k = 0; k < DENSE_59_UNITS; k++) {
+#ifdef CNN_DSP
+    output_acc = kernel_acc[k];
+#else
+    output_acc = 0;
+    for (z = 0; z < DENSE_58_UNITS; z++)
+      output_acc = output_acc + ( kernel_59[k][z] * hidden[z] );
+#endif
+
+    output_acc = scale_number_t(output_acc);
+
+    output_acc = output_acc + bias_59[k];
+
+#ifdef ACTIVATION_LINEAR
+    output[k] = clamp_to_number_t(output_acc);
+#elif defined(ACTIVATION_RELU)
+    if (output_acc < 0)
+      output[k] = 0;
+    else
+      output[k] = clamp_to_number_t(output_acc);
+#endif
+  }
+}
+
+#undef INPUT_CHANNELS
+#undef INPUT_SAMPLES
+#undef POOL_SIZE
+#undef DENSE_58_UNITS
+#undef DENSE_59_UNITS
+#undef ACTIVATION_LINEAR
+#undef POOL_RECIPROCAL
 /**
   ******************************************************************************
   * @file    model.hh
@@ -12096,9 +13669,23 @@ const int16_t dense_59_kernel[FC_UNITS][INPUT_SAMPLES] = {{-202, 178, -36, 48, 4
 #define MODEL_INPUT_SAMPLES 16000 // node 0 is InputLayer so use its output shape as input shape of the model
 #define MODEL_INPUT_CHANNELS 1
 
-void cnn(
+// Scratch memory of one inference: the activations1/activations2 unions holding the layer outputs
+// (each member has the shape of the *_output_type of its layer). The caller owns it and cnn_run()
+// keeps no other mutable state, so threads running cnn_run() on their own context need no locking.
+typedef struct {
+  union {
+    number_t max_pooling1d_146_output[16][499];
+    number_t max_pooling1d_148_output[64][30];
+  } activations1;
+  union {
+    number_t max_pooling1d_147_output[32][124];
+    number_t max_pooling1d_149_output[128][14];
+  } activations2;
+} cnn_ctx_t;
+
+void cnn_run(
+  cnn_ctx_t *ctx,
   const number_t input[MODEL_INPUT_CHANNELS][MODEL_INPUT_SAMPLES],
-  //dense_59_output_type dense_59_output);
   number_t output[MODEL_OUTPUT_SAMPLES]);
 
 #endif//__MODEL_H__
@@ -12137,28 +13724,35 @@ void cnn(
 #include "weights/dense_59.c"
 #endif
 
-void cnn(
+// Int16 kernels passed to the layers, NULL for the layers that run on their ternary weights only
+#ifdef CONV1D_119_TERNARY
+#define CONV1D_119_KERNEL NULL
+#else
+#define CONV1D_119_KERNEL conv1d_119_kernel
+#endif
+#ifdef DENSE_58_TERNARY
+#define DENSE_58_KERNEL NULL
+#else
+#define DENSE_58_KERNEL dense_58_kernel
+#endif
+
+// cnn_ctx_t of model.h declares the unions with plain arrays, they must match the layer output types
+#define CNN_CTX_CHECK(activations, layer) \
+  typedef char layer##_ctx_check[sizeof(((cnn_ctx_t *)0)->activations.layer##_output) == sizeof(layer##_output_type) ? 1 : -1]
+CNN_CTX_CHECK(activations1, max_pooling1d_146);
+CNN_CTX_CHECK(activations1, max_pooling1d_148);
+CNN_CTX_CHECK(activations2, max_pooling1d_147);
+CNN_CTX_CHECK(activations2, max_pooling1d_149);
+#undef CNN_CTX_CHECK
+
+void cnn_run(
+  cnn_ctx_t *ctx,
   const number_t input[MODEL_INPUT_CHANNELS][MODEL_INPUT_SAMPLES],
   dense_59_output_type dense_59_output) {
 
-  // Output array allocation
-  static union {
-    max_pooling1d_145_output_type max_pooling1d_145_output;
-    max_pooling1d_146_output_type max_pooling1d_146_output;
-    max_pooling1d_147_output_type max_pooling1d_147_output;
-    max_pooling1d_148_output_type max_pooling1d_148_output;
-    max_pooling1d_149_output_type max_pooling1d_149_output;
-    dense_58_output_type dense_58_output;
-  } activations1;
-
-  static union {
-    conv1d_116_output_type conv1d_116_output;
-    conv1d_117_output_type conv1d_117_output;
-    conv1d_118_output_type conv1d_118_output;
-    conv1d_119_output_type conv1d_119_output;
-    average_pooling1d_29_output_type average_pooling1d_29_output;
-    flatten_29_output_type flatten_29_output;
-  } activations2;
+  // Output arrays are the unions of the caller's context (see model.h)
+  // Each conv is fused with the max pooling that follows it, conv outputs are never stored.
+  // The classifier head keeps its intermediate vectors on the stack.
 
 
   //static union {
@@ -12193,94 +13787,54 @@ void cnn(
 
   // Model layers call chain
  // InputLayer is excluded 
-  max_pooling1d_145(
+  max_pooling1d_145_conv1d_116_max_pooling1d_146(
      // First layer uses input passed as model parameter
     input,
-    activations1.max_pooling1d_145_output
-  );
- // InputLayer is excluded 
-  conv1d_116(
-    
-    activations1.max_pooling1d_145_output,
     conv1d_116_kernel,
     conv1d_116_bias,
-    activations2.conv1d_116_output
+    ctx->activations1.max_pooling1d_146_output
   );
  // InputLayer is excluded 
-  max_pooling1d_146(
+  conv1d_117_max_pooling1d_147(
     
-    activations2.conv1d_116_output,
-    activations1.max_pooling1d_146_output
-  );
- // InputLayer is excluded 
-  conv1d_117(
-    
-    activations1.max_pooling1d_146_output,
+    ctx->activations1.max_pooling1d_146_output,
     conv1d_117_kernel,
     conv1d_117_bias,
-    activations2.conv1d_117_output
-  );
- // InputLayer is excluded 
-  max_pooling1d_147(
-    
-    activations2.conv1d_117_output,
-    activations1.max_pooling1d_147_output
+    ctx->activations2.max_pooling1d_147_output
   );
  // InputLayer is excluded 
-  conv1d_118(
+  conv1d_118_max_pooling1d_148(
     
-    activations1.max_pooling1d_147_output,
+    ctx->activations2.max_pooling1d_147_output,
     conv1d_118_kernel,
     conv1d_118_bias,
-    activations2.conv1d_118_output
-  );
- // InputLayer is excluded 
-  max_pooling1d_148(
-    
-    activations2.conv1d_118_output,
-    activations1.max_pooling1d_148_output
+    ctx->activations1.max_pooling1d_148_output
   );
  // InputLayer is excluded 
-  conv1d_119(
+  conv1d_119_max_pooling1d_149(
     
-    activations1.max_pooling1d_148_output,
-    conv1d_119_kernel,
+    ctx->activations1.max_pooling1d_148_output,
+    CONV1D_119_KERNEL,
     conv1d_119_bias,
-    activations2.conv1d_119_output
-  );
- // InputLayer is excluded 
-  max_pooling1d_149(
-    
-    activations2.conv1d_119_output,
-    activations1.max_pooling1d_149_output
+    ctx->activations2.max_pooling1d_149_output
   );
  // InputLayer is excluded 
-  average_pooling1d_29(
+  average_pooling1d_29_dense_58_dense_59(
     
-    activations1.max_pooling1d_149_output,
-    activations2.average_pooling1d_29_output
-  );
- // InputLayer is excluded 
-  flatten_29(
-    
-    activations2.average_pooling1d_29_output,
-    activations2.flatten_29_output
-  );
- // InputLayer is excluded 
-  dense_58(
-    
-    activations2.flatten_29_output,
-    dense_58_kernel,
+    ctx->activations2.max_pooling1d_149_output,
+    DENSE_58_KERNEL,
     dense_58_bias,
-    activations1.dense_58_output
-  );
- // InputLayer is excluded 
-  dense_59(
-    
-    activations1.dense_58_output,
     dense_59_kernel,
     dense_59_bias, // Last layer uses output passed as model parameter
     dense_59_output
   );
 
 }
+
+static cnn_ctx_t cnn_ctx; // Context of cnn(), shared by all its callers
+
+void cnn(
+  const number_t input[MODEL_INPUT_CHANNELS][MODEL_INPUT_SAMPLES],
+  number_t output[MODEL_OUTPUT_SAMPLES]) {
+  cnn_run(&cnn_ctx, input, output);
+}
@@ -0,0 +1,125 @@
+// Histograms of the int16 inputs of every conv1d and dense layer over a set of clips, read by
+// tools/int8_weights.py to choose the int8 quantization of each input and by
+// tools/fixed_point_formats.py to choose the output format of each layer. The clips are 16-bit mono
+// .wav files (dataset/), zero-padded or cut to one second like in the notebook; their paths are
+// read from stdin, one per line. Prints "layer value count" for every value met. With --logits,
+// prints instead one line per clip for tools/softmax_calibration.py: the logits returned by cnn(),
+// then their cnn_softmax() at the temperature of weights/softmax.c.
+//   g++ -O2 -Igsc_output_fixed calibrate.cpp -o calibrate
+//   ls dataset/A/*.wav | ./calibrate [--logits]
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "model.c" // unity build: the layer functions are static
+
+static const char *const layer_names[] = {"conv1d_116", "conv1d_117", "conv1d_118", "conv1d_119", "dense_58", "dense_59"};
+static const int layer_count = sizeof(layer_names) / sizeof(layer_names[0]);
+
+// Samples of the data chunk of a 16-bit PCM file, false when it cannot be read
+static bool read_wav(const char *path, number_t input[MODEL_INPUT_SAMPLES]) {
+	FILE *f = fopen(path, "rb");
+	unsigned char header[12], chunk[8];
+	bool ok = false;
+
+	if (f == NULL) {
+		return false;
+	}
+	if (fread(header, 1, sizeof(header), f) == sizeof(header) && memcmp(header, "RIFF", 4) == 0 && memcmp(header + 8, "WAVE", 4) == 0) {
+		while (fread(chunk, 1, sizeof(chunk), f) == sizeof(chunk)) {
+			uint32_t size = chunk[4] | chunk[5] << 8 | chunk[6] << 16 | (uint32_t)chunk[7] << 24;
+			if (memcmp(chunk, "data", 4) != 0) {
+				fseek(f, size + (size & 1), SEEK_CUR);
+				continue;
+			}
+			std::vector<int16_t> samples(size / 2);
+			samples.resize(fread(samples.data(), 2, samples.size(), f)); // little-endian host
+			for (int i = 0; i < MODEL_INPUT_SAMPLES; i++) {
+				input[i] = i < (int)samples.size() ? samples[i] : 0;
+			}
+			ok = true;
+			break;
+		}
+	}
+	fclose(f);
+	return ok;
+}
+
+template<size_t N>
+static void count(std::vector<long> &histogram, const number_t (&values)[N]) {
+	for (number_t v : values) {
+		histogram[v - NUMBER_MIN]++;
+	}
+}
+
+template<size_t M, size_t N>
+static void count(std::vector<long> &histogram, const number_t (&values)[M][N]) {
+	for (const auto &row : values) {
+		count(histogram, row);
+	}
+}
+
+int main(int argc, const char *argv[]) {
+	const bool logits_only = argc > 1 && strcmp(argv[1], "--logits") == 0;
+	static number_t input[MODEL_INPUT_CHANNELS][MODEL_INPUT_SAMPLES];
+	static max_pooling1d_145_output_type pooled_145;
+	static number_t pooled_146[16][499], pooled_147[32][124], pooled_148[64][30], pooled_149[128][14];
+	static average_pooling1d_29_output_type pooled_29;
+	static dense_58_output_type hidden;
+	std::vector<std::vector<long>> histograms(layer_count, std::vector<long>(NUMBER_MAX - NUMBER_MIN + 1));
+	std::string path;
+	int clips = 0;
+
+	while (std::getline(std::cin, path)) {
+		if (path.empty()) {
+			continue;
+		}
+		if (!read_wav(path.c_str(), input[0])) {
+			std::cerr << "Cannot read \"" << path << "\"" << std::endl;
+			return 1;
+		}
+		if (logits_only) {
+			number_t logits[MODEL_OUTPUT_SAMPLES], probs[MODEL_OUTPUT_SAMPLES];
+			cnn(input, logits);
+			cnn_softmax(logits, probs);
+			for (int i = 0; i < 2 * MODEL_OUTPUT_SAMPLES; i++) {
+				printf(i == 0 ? "%d" : " %d", i < MODEL_OUTPUT_SAMPLES ? logits[i] : probs[i - MODEL_OUTPUT_SAMPLES]);
+			}
+			printf("\n");
+			clips++;
+			continue;
+		}
+		// The stages of cnn_run(), keeping the input of every conv and dense layer
+		max_pooling1d_145(input, pooled_145);
+		max_pooling1d_145_conv1d_116_max_pooling1d_146(input, CONV1D_116_KERNEL, conv1d_116_bias, pooled_146);
+		conv1d_117_max_pooling1d_147(pooled_146, CONV1D_117_KERNEL, conv1d_117_bias, pooled_147);
+		conv1d_118_max_pooling1d_148(pooled_147, CONV1D_118_KERNEL, conv1d_118_bias, pooled_148);
+		conv1d_119_max_pooling1d_149(pooled_148, CONV1D_119_KERNEL, conv1d_119_bias, pooled_149);
+		average_pooling1d_29(pooled_149, pooled_29); // flatten_29 keeps the 128 values in order
+		dense_58(&pooled_29[0][0], DENSE_58_KERNEL, dense_58_bias, hidden);
+
+		count(histograms[0], pooled_145);
+		count(histograms[1], pooled_146);
+		count(histograms[2], pooled_147);
+		count(histograms[3], pooled_148);
+		count(histograms[4], pooled_29);
+		count(histograms[5], hidden);
+		clips++;
+	}
+
+	std::cerr << clips << " clips" << std::endl;
+	if (logits_only) {
+		return 0;
+	}
+	for (int l = 0; l < layer_count; l++) {
+		for (size_t v = 0; v < histograms[l].size(); v++) {
+			if (histograms[l][v] != 0) {
+				printf("%s %ld %ld\n", layer_names[l], (long)v + NUMBER_MIN, histograms[l][v]);
+			}
+		}
+	}
+	return 0;
+}
@@ -0,0 +1,435 @@
+/**
+  ******************************************************************************
+  * @file    autotune.h
+  * @version 1.0.0
+  * @date    17 october 2026
+  * @brief   Per-layer choice of the conv kernel, timed on the running CPU and kept in a cache file
+  *
+  * Built with -DCNN_AUTOTUNE, each fused conv layer of cnn() first runs the kernel of its
+  * conv1d_choice_t, the chain of the build flags when it is CONV1D_KERNEL_DEFAULT or does not apply.
+  * cnn_autotune_layers() runs the candidates of every layer in turn: that chain, the direct vector
+  * kernel on a few tiles, its polyphase variant, im2col + GEMM and Winograd. A candidate counts only
+  * if its output is bit-exact with cnn_autotune_reference(), scalar loops that do not read cnn_isa,
+  * and the fastest one over CNN_AUTOTUNE_ROUNDS rounds is kept. The choices are appended to a text
+  * file, one line per layer:
+  *   <cpu model> TAB <isa> TAB <threads> TAB <layer shape> TAB <build> TAB <kernel> <tile filters> <blocks> <channels>
+  * where <build> hashes the build flags of the kernels, the compiler and the weights of the layer
+  * (cnn_autotune_build()). Later startups with the same key read the last line of the layer back
+  * instead of timing again, and check the output of the layer on that choice once against
+  * cnn_autotune_reference(): a choice that is not bit-exact is tuned again. The file is
+  * $CNN_AUTOTUNE_CACHE, CNN_AUTOTUNE_CACHE_FILE in the working directory by default; an empty
+  * CNN_AUTOTUNE_CACHE tunes at every startup and writes nothing.
+  */
+
+#ifndef __AUTOTUNE_H__
+#define __AUTOTUNE_H__
+
+#ifndef SINGLE_FILE
+#include "number.h"
+#include "layer_params.h"
+#include "simd.h"
+#include "thread_pool.h"
+#include "conv1d_simd.h"
+#include "conv1d_im2col.h"
+#include "conv1d_winograd.h"
+#include "requant_simd.h"
+#endif
+
+#ifdef CNN_AUTOTUNE
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#include <cpuid.h>
+#endif
+
+#ifndef CNN_AUTOTUNE_CACHE_FILE
+#define CNN_AUTOTUNE_CACHE_FILE "cnn_autotune.txt"
+#endif
+#ifndef CNN_AUTOTUNE_ROUNDS
+#define CNN_AUTOTUNE_ROUNDS 5 // rounds over the candidates of a layer, each keeps its fastest round
+#endif
+#ifndef CNN_AUTOTUNE_REPETITIONS
+#define CNN_AUTOTUNE_REPETITIONS 10 // runs of a candidate timed together in a round
+#endif
+#define CNN_AUTOTUNE_MAX_OUTPUT 8192 // number_t outputs of a layer, for its reference copy
+
+// Tile pointer of a conv1d_choice_t, the tiles only exist for the vector kernel
+#ifdef CNN_SIMD
+#define CONV1D_CHOICE_TILE(tile) (&(tile))
+#else
+#define CONV1D_CHOICE_TILE(tile) NULL
+#endif
+
+// Runs the kernel of choice on the layer, with the arguments of conv1d_maxpool1d_simd(). Returns
+// 0 for CONV1D_KERNEL_DEFAULT and when the kernel does not apply to the layer or to the running
+// CPU, the caller then runs the chain of the build flags.
+static inline int conv1d_maxpool1d_tuned(
+  const conv1d_choice_t *choice,
+  const maxpool1d_params_t *input_pool,
+  const conv1d_params_t *p,
+  const maxpool1d_params_t *output_pool,
+  const number_t *input,
+  const number_t *kernel,
+  const number_t *bias,
+  number_t *output) {
+
+  switch (choice->kernel) {
+#ifdef CNN_SIMD
+  case CONV1D_KERNEL_DIRECT:
+    return conv1d_maxpool1d_simd_direct(input_pool, p, output_pool, choice->tile, input, kernel, bias, output);
+  case CONV1D_KERNEL_POLYPHASE:
+    return cnn_isa != CNN_ISA_SCALAR
+      && conv1d_maxpool1d_polyphase_simd(input_pool, p, output_pool, choice->tile, input, kernel, bias, output);
+#endif
+  case CONV1D_KERNEL_IM2COL:
+    return input_pool == NULL && conv1d_maxpool1d_im2col_gemm(p, output_pool, input, kernel, bias, output);
+  case CONV1D_KERNEL_WINOGRAD:
+    return input_pool == NULL && choice->winograd_kernel != NULL
+      && conv1d_maxpool1d_winograd(p, output_pool, choice->accum_plan, input, choice->winograd_kernel, bias, output);
+  default:
+    return 0;
+  }
+}
+
+// A fused conv layer of the model for cnn_autotune_layers(): run is the layer function on the
+// buffers below, reading choice
+typedef struct {
+  const maxpool1d_params_t *input_pool;  // NULL when the layer has none
+  const conv1d_params_t *p;
+  const maxpool1d_params_t *output_pool; // same
+  conv1d_choice_t *choice;
+  void (*run)(void);
+  const number_t *input;
+  const number_t *kernel;
+  const number_t *bias;
+  number_t *output;
+  int output_size;                       // number_t
+} cnn_autotune_layer_t;
+
+typedef struct {
+  conv1d_kernel_t kernel;
+  conv1d_tile_t tile; // requested from conv1d_simd_tile(), 0: its default
+} cnn_autotune_candidate_t;
+
+// Names of the kernels in the cache file, in the order of conv1d_kernel_t
+static const char *const cnn_autotune_kernels[] = {"default", "direct", "polyphase", "im2col", "winograd"};
+
+// Channel tiles are left to the default: splitting the channels only adds partial sums here
+static const cnn_autotune_candidate_t cnn_autotune_candidates[] = {
+  {CONV1D_KERNEL_DEFAULT, {0, 0, 0}},
+  {CONV1D_KERNEL_DIRECT, {0, 0, 0}},
+  {CONV1D_KERNEL_DIRECT, {0, 1, 0}},
+  {CONV1D_KERNEL_DIRECT, {0, 4, 0}},
+  {CONV1D_KERNEL_DIRECT, {8, 0, 0}},
+  {CONV1D_KERNEL_DIRECT, {8, 1, 0}},
+  {CONV1D_KERNEL_DIRECT, {8, 4, 0}},
+  {CONV1D_KERNEL_DIRECT, {32, 0, 0}},
+  {CONV1D_KERNEL_DIRECT, {32, 1, 0}},
+  {CONV1D_KERNEL_DIRECT, {32, 4, 0}},
+  {CONV1D_KERNEL_POLYPHASE, {0, 0, 0}},
+  {CONV1D_KERNEL_IM2COL, {0, 0, 0}},
+  {CONV1D_KERNEL_WINOGRAD, {0, 0, 0}},
+};
+#define CNN_AUTOTUNE_CANDIDATES (int)(sizeof(cnn_autotune_candidates) / sizeof(cnn_autotune_candidates[0]))
+
+// Seconds, monotonic where the headers declare it (CPU time of the process otherwise)
+static double cnn_autotune_now(void) {
+#ifdef CLOCK_MONOTONIC
+  struct timespec t;
+
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec + t.tv_nsec * 1e-9;
+#else
+  return (double)clock() / CLOCKS_PER_SEC;
+#endif
+}
+
+// Brand string of an x86 CPU, else the first model line of /proc/cpuinfo, in at most 63 chars
+// without tabs
+static void cnn_autotune_cpu(char cpu[64]) {
+  char line[256];
+  const char *value = NULL;
+  FILE *f;
+  int n;
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+  unsigned int brand[13];
+
+  if (__get_cpuid_max(0x80000000, NULL) >= 0x80000004) {
+    for (n = 0; n < 3; n++)
+      __get_cpuid(0x80000002 + n, &brand[4 * n], &brand[4 * n + 1], &brand[4 * n + 2], &brand[4 * n + 3]);
+    brand[12] = 0;
+    value = (const char *)brand;
+  }
+#endif
+
+  if (value == NULL && (f = fopen("/proc/cpuinfo", "r")) != NULL) {
+    while (value == NULL && fgets(line, sizeof(line), f) != NULL)
+      if (strncmp(line, "model name", 10) == 0 || strncmp(line, "Hardware", 8) == 0 || strncmp(line, "CPU part", 8) == 0)
+        if ((value = strchr(line, ':')) != NULL)
+          value++;
+    fclose(f);
+  }
+  if (value == NULL)
+    value = "unknown";
+
+  while (*value == ' ' || *value == '\t')
+    value++;
+  for (n = 0; n < 63 && value[n] != '\0' && value[n] != '\n'; n++)
+    cpu[n] = value[n] == '\t' ? ' ' : value[n];
+  while (n > 0 && cpu[n - 1] == ' ')
+    n--;
+  cpu[n] = '\0';
+}
+
+// Build flags that select or size the kernels of the layers, besides the ISA and threads of the key
+static const char cnn_autotune_flags[] = "conv1d"
+#ifdef CONV1D_IM2COL
+  " im2col"
+#endif
+#ifdef CONV1D_POLYPHASE
+  " polyphase"
+#endif
+#ifdef CONV1D_WINOGRAD
+  " winograd"
+#endif
+#ifdef CNN_DSP
+  " dsp"
+#endif
+#ifdef CNN_LAYER_FORMATS
+  " formats"
+#endif
+#ifdef __VERSION__
+  " " __VERSION__
+#endif
+  ;
+
+// FNV-1a hash of the size bytes at data, continuing hash
+static unsigned int cnn_autotune_hash(unsigned int hash, const void *data, size_t size) {
+  const unsigned char *bytes = (const unsigned char *)data;
+  size_t i;
+
+  for (i = 0; i < size; i++)
+    hash = (hash ^ bytes[i]) * 16777619u;
+  return hash;
+}
+
+// Hash of the build flags, tile and block sizes, compiler, and of the weights and requantization
+// of the layer: a choice timed on another build or other weights is not read back
+static unsigned int cnn_autotune_build(const cnn_autotune_layer_t *layer) {
+  const conv1d_params_t *p = layer->p;
+  char build[256];
+  unsigned int hash = 2166136261u;
+  int n;
+
+  n = snprintf(build, sizeof(build), "%s l1 %d kc %d nc %d shift %d %s", cnn_autotune_flags, CONV1D_TILE_L1,
+               CONV1D_GEMM_KC, CONV1D_GEMM_NC, p->requant_shift, p->activation == ACTIVATION_KIND_RELU ? "relu" : "linear");
+  hash = cnn_autotune_hash(hash, build, n < (int)sizeof(build) ? (size_t)n : sizeof(build) - 1);
+  hash = cnn_autotune_hash(hash, layer->kernel, (size_t)p->filters * p->input_channels * p->kernel_size * sizeof(number_t));
+  return cnn_autotune_hash(hash, layer->bias, (size_t)p->filters * sizeof(number_t));
+}
+
+// Cache key of a layer: what its timings depend on
+static void cnn_autotune_key(const cnn_autotune_layer_t *layer, const char *cpu, char *key, size_t size) {
+  const conv1d_params_t *p = layer->p;
+  unsigned int threads = 1;
+  const char *isa = "scalar";
+
+#ifdef CNN_THREADS
+  threads = cnn_thread_pool_size();
+#endif
+#ifdef CNN_SIMD
+  isa = cnn_isa_name(cnn_isa);
+#endif
+  snprintf(key, size, "%s\t%s\t%u\tconv1d %dx%d k%d s%d f%d pool %d/%d\t%08x", cpu, isa, threads,
+           p->input_channels, p->input_samples, p->kernel_size, p->stride, p->filters,
+           layer->input_pool != NULL ? layer->input_pool->pool_size : 0,
+           layer->output_pool != NULL ? layer->output_pool->pool_size : 0, cnn_autotune_build(layer));
+}
+
+// Sets choice from the last line of the cache file f starting with key, the one appended after a
+// choice that failed cnn_autotune_check(). Returns 0 when there is none.
+static int cnn_autotune_load(FILE *f, const char *key, conv1d_choice_t *choice) {
+  const size_t length = strlen(key);
+  char line[512], name[16];
+  unsigned int filters, blocks, channels;
+  int k, found = 0;
+
+  rewind(f);
+  while (fgets(line, sizeof(line), f) != NULL) {
+    if (strncmp(line, key, length) != 0 || line[length] != '\t'
+        || sscanf(line + length + 1, "%15s %u %u %u", name, &filters, &blocks, &channels) != 4)
+      continue;
+    for (k = 0; k < (int)(sizeof(cnn_autotune_kernels) / sizeof(cnn_autotune_kernels[0])); k++)
+      if (strcmp(name, cnn_autotune_kernels[k]) == 0) {
+        choice->kernel = (conv1d_kernel_t)k;
+        if (choice->tile != NULL) {
+          choice->tile->filters = (unsigned short)filters;
+          choice->tile->blocks = (unsigned short)blocks;
+          choice->tile->channels = (unsigned short)channels;
+        }
+        found = 1;
+      }
+  }
+  return found;
+}
+
+// Output of the layer computed like its generated loops, whatever the ISA of the running CPU:
+// input_pool max pooled on the fly, zero padding, int32 sums, output_pool taken on the sums before
+// requantize_number_t(). Returns 0 for poolings with an activation, which no candidate fuses.
+static int cnn_autotune_reference(const cnn_autotune_layer_t *layer, number_t *output) {
+  const conv1d_params_t *p = layer->p;
+  const maxpool1d_params_t *input_pool = layer->input_pool, *output_pool = layer->output_pool;
+  const int input_samples = input_pool != NULL ? input_pool->input_samples : p->input_samples;
+  const int out_samples = output_pool != NULL ? output_pool->pool_length : p->outsamples;
+  const int windows = output_pool != NULL ? output_pool->pool_size : 1;
+  const number_t *row;
+  long_number_t acc, best = 0;
+  number_t sample;
+  int k, o, w, pos, z, x, i, y;
+
+  if ((input_pool != NULL && input_pool->activation != ACTIVATION_KIND_LINEAR)
+      || (output_pool != NULL && output_pool->activation != ACTIVATION_KIND_LINEAR))
+    return 0;
+
+  for (k = 0; k < p->filters; k++)
+    for (o = 0; o < out_samples; o++) {
+      for (w = 0; w < windows; w++) {
+        pos = output_pool != NULL ? o * output_pool->pool_stride + w : o;
+        acc = 0;
+        for (z = 0; z < p->input_channels; z++) {
+          row = layer->input + z * input_samples;
+          for (x = 0; x < p->kernel_size; x++) {
+            i = pos * p->stride + x - p->zeropadding_left;
+            if (i < 0 || i >= p->input_samples)
+              continue;
+            if (input_pool != NULL) {
+              sample = row[i * input_pool->pool_stride];
+              for (y = 1; y < input_pool->pool_size; y++)
+                if (sample < row[i * input_pool->pool_stride + y])
+                  sample = row[i * input_pool->pool_stride + y];
+            } else {
+              sample = row[i];
+            }
+            acc += sample * layer->kernel[(k * p->input_channels + z) * p->kernel_size + x];
+          }
+        }
+        if (w == 0 || best < acc)
+          best = acc;
+      }
+      output[k * out_samples + o] = requantize_number_t(best, p->requant_shift, layer->bias[k], p->activation == ACTIVATION_KIND_RELU);
+    }
+  return 1;
+}
+
+// Runs the layer on the choice read from the cache file, returns 0 when its output is not bit-exact
+// with cnn_autotune_reference(). A layer the reference does not take keeps the default only, as
+// cnn_autotune_layer() would choose.
+static int cnn_autotune_check(const cnn_autotune_layer_t *layer) {
+  number_t reference[CNN_AUTOTUNE_MAX_OUTPUT];
+
+  if (layer->output_size > CNN_AUTOTUNE_MAX_OUTPUT || !cnn_autotune_reference(layer, reference)) {
+    layer->run();
+    return layer->choice->kernel == CONV1D_KERNEL_DEFAULT;
+  }
+  memset(layer->output, 0x55, layer->output_size * sizeof(number_t));
+  layer->run();
+  return memcmp(reference, layer->output, layer->output_size * sizeof(number_t)) == 0;
+}
+
+// Runs candidate c on the layer, returns 0 when it does not apply
+static int cnn_autotune_run(const cnn_autotune_layer_t *layer, const cnn_autotune_candidate_t *c) {
+  conv1d_choice_t choice = *layer->choice;
+  conv1d_tile_t tile = c->tile;
+
+  if (c->kernel == CONV1D_KERNEL_DEFAULT) {
+    layer->run();
+    return 1;
+  }
+  choice.kernel = c->kernel;
+  choice.tile = &tile;
+  return conv1d_maxpool1d_tuned(&choice, layer->input_pool, layer->p, layer->output_pool,
+                                layer->input, layer->kernel, layer->bias, layer->output);
+}
+
+// Times the candidates of the layer and sets its choice to the fastest bit-exact one
+static void cnn_autotune_layer(const cnn_autotune_layer_t *layer) {
+  const conv1d_tile_t default_tile = {0, 0, 0};
+  number_t reference[CNN_AUTOTUNE_MAX_OUTPUT];
+  double best[CNN_AUTOTUNE_CANDIDATES], start, t;
+  int valid[CNN_AUTOTUNE_CANDIDATES];
+  int c, round, r, winner = 0;
+
+  // The chain of the build flags on the default tiles is the first candidate
+  layer->choice->kernel = CONV1D_KERNEL_DEFAULT;
+  if (layer->choice->tile != NULL)
+    *layer->choice->tile = default_tile;
+  if (layer->output_size > CNN_AUTOTUNE_MAX_OUTPUT || !cnn_autotune_reference(layer, reference))
+    return;
+
+  for (c = 0; c < CNN_AUTOTUNE_CANDIDATES; c++) {
+    memset(layer->output, 0x55, layer->output_size * sizeof(number_t));
+    valid[c] = cnn_autotune_run(layer, &cnn_autotune_candidates[c])
+      && memcmp(reference, layer->output, layer->output_size * sizeof(number_t)) == 0;
+    best[c] = 1e30;
+  }
+
+  // Candidates take turns in each round so that a slow period of the machine does not fall on one
+  for (round = 0; round < CNN_AUTOTUNE_ROUNDS; round++)
+    for (c = 0; c < CNN_AUTOTUNE_CANDIDATES; c++) {
+      if (!valid[c])
+        continue;
+      start = cnn_autotune_now();
+      for (r = 0; r < CNN_AUTOTUNE_REPETITIONS; r++)
+        cnn_autotune_run(layer, &cnn_autotune_candidates[c]);
+      t = cnn_autotune_now() - start;
+      if (t < best[c])
+        best[c] = t;
+    }
+
+  for (c = 1; c < CNN_AUTOTUNE_CANDIDATES; c++)
+    if (valid[c] && best[c] < best[winner])
+      winner = c;
+  layer->choice->kernel = cnn_autotune_candidates[winner].kernel;
+  if (layer->choice->tile != NULL)
+    *layer->choice->tile = cnn_autotune_candidates[winner].tile;
+}
+
+// Loads the choice of every layer from the cache file, tuning and appending those it lacks or that
+// fail cnn_autotune_check(). The layers run in order on the buffers of the table, the output of
+// one being the input of the next.
+static void cnn_autotune_layers(const cnn_autotune_layer_t *layers, int n) {
+  const char *path = getenv("CNN_AUTOTUNE_CACHE");
+  const conv1d_tile_t *tile;
+  char cpu[64], key[320];
+  FILE *cache, *out;
+  int l;
+
+  if (path == NULL)
+    path = CNN_AUTOTUNE_CACHE_FILE;
+  cnn_autotune_cpu(cpu);
+  cache = path[0] != '\0' ? fopen(path, "r") : NULL;
+
+  for (l = 0; l < n; l++) {
+    cnn_autotune_key(&layers[l], cpu, key, sizeof(key));
+    if (cache != NULL && cnn_autotune_load(cache, key, layers[l].choice) && cnn_autotune_check(&layers[l]))
+      continue;
+    cnn_autotune_layer(&layers[l]);
+    if (path[0] != '\0' && (out = fopen(path, "a")) != NULL) {
+      tile = layers[l].choice->tile;
+      fprintf(out, "%s\t%s %u %u %u\n", key, cnn_autotune_kernels[layers[l].choice->kernel],
+              tile != NULL ? tile->filters : 0, tile != NULL ? tile->blocks : 0, tile != NULL ? tile->channels : 0);
+      fclose(out);
+    }
+    layers[l].run();
+  }
+
+  if (cache != NULL)
+    fclose(cache);
+}
+
+#endif//CNN_AUTOTUNE
+
+#endif//__AUTOTUNE_H__
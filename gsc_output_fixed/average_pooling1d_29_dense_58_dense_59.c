@@ -0,0 +1,195 @@
+/**
+  ******************************************************************************
+  * @file    average_pooling1d_29_dense_58_dense_59.c
+  * @version 1.0.0
+  * @date    17 october 2026
+  * @brief   Classifier head in one pass: average_pooling1d_29 (global), flatten_29,
+  *          dense_58 and dense_59, intermediate vectors kept on the stack
+  */
+
+#ifndef SINGLE_FILE
+#include "number.h"
+#include "requant_simd.h"
+#include "ternary.h"
+#include "int8.h"
+#include "sparse.h"
+#include "dense_gemm.h"
+#endif
+
+#define INPUT_CHANNELS      128
+#define INPUT_SAMPLES       14
+#define POOL_SIZE           14
+#define DENSE_58_UNITS      40
+#define DENSE_59_UNITS      7
+
+#define ACTIVATION_LINEAR   // dense_58 and dense_59
+#define BATCH_ROWS          8   // clips per GEMM of the batched head
+
+#ifdef DENSE_58_PANELS
+#define DENSE_58_PANELS_KERNEL &dense_58_panels[0][0][0]
+#else
+#define DENSE_58_PANELS_KERNEL NULL
+#endif
+#ifdef DENSE_59_PANELS
+#define DENSE_59_PANELS_KERNEL &dense_59_panels[0][0][0]
+#else
+#define DENSE_59_PANELS_KERNEL NULL
+#endif
+
+#if FIXED_POINT > 0
+// ceil(2^32 / POOL_SIZE): (|tmp| * POOL_RECIPROCAL) >> 32 == |tmp| / POOL_SIZE for every sum of
+// POOL_SIZE number_t up to POOL_SIZE = 361
+#define POOL_RECIPROCAL     ( ( (1LL << 32) + POOL_SIZE - 1 ) / POOL_SIZE )
+#endif
+
+// average_pooling1d_29, flatten_29 is a no-op
+static inline void average_pooling1d_29_flat(
+  const number_t input[INPUT_CHANNELS][INPUT_SAMPLES],          // IN
+
+  number_t pooled[INPUT_CHANNELS]) {                            // OUT
+
+  unsigned short k, x;
+  long_number_t tmp;
+
+  for (k = 0; k < INPUT_CHANNELS; k++) {
+    tmp = 0;
+    for (x = 0; x < INPUT_SAMPLES; x++)
+      tmp += input[k][x];
+#if FIXED_POINT > 0
+    // tmp / POOL_SIZE, truncated toward zero, as a multiply
+    if (tmp < 0)
+      tmp = -(long_number_t)((-(int64_t)tmp * POOL_RECIPROCAL) >> 32);
+    else
+      tmp = (long_number_t)(((int64_t)tmp * POOL_RECIPROCAL) >> 32);
+#else
+    tmp = tmp / POOL_SIZE;
+#endif
+    pooled[k] = clamp_to_number_t(tmp);
+  }
+}
+
+static inline void average_pooling1d_29_dense_58_dense_59(
+  const number_t input[INPUT_CHANNELS][INPUT_SAMPLES],          // IN
+  const number_t kernel_58[DENSE_58_UNITS][INPUT_CHANNELS],     // IN
+  const number_t bias_58[DENSE_58_UNITS],                       // IN
+  const number_t kernel_59[DENSE_59_UNITS][DENSE_58_UNITS],     // IN
+  const number_t bias_59[DENSE_59_UNITS],                       // IN
+
+  number_t output[DENSE_59_UNITS]) {                            // OUT
+
+  long_number_t output_acc[DENSE_GEMM_LDACC(DENSE_58_UNITS)]; // dense_58 then dense_59 accumulators
+  number_t pooled[INPUT_CHANNELS];   // average_pooling1d_29 output
+  number_t hidden[DENSE_58_UNITS];   // dense_58 output
+
+  average_pooling1d_29_flat(input, pooled);
+
+#ifdef DENSE_58_TERNARY
+  // -DCNN_TERNARY: sign-select kernel on the ternary weights of weights/ternary.c
+  dense_ternary(&dense_58_ternary, INPUT_CHANNELS, DENSE_58_UNITS, pooled, output_acc);
+  (void)kernel_58;
+#elif defined(DENSE_58_INT8)
+  // -DCNN_INT8: int8 kernel on the weights and input quantization of weights/int8.c
+  dense_int8(&dense_58_int8, INPUT_CHANNELS, DENSE_58_UNITS, pooled, output_acc);
+  (void)kernel_58;
+#elif defined(DENSE_58_SPARSE)
+  // -DCNN_SPARSE: zero-skipping kernel on the block-sparse weights of weights/sparse.c
+  dense_sparse(&dense_58_sparse, INPUT_CHANNELS, DENSE_58_UNITS, pooled, output_acc);
+  (void)kernel_58;
+#else
+  // GEMV on the packed panels of weights/dense_58_panels.c, the generated loop without them
+  dense_gemm(&kernel_58[0][0], DENSE_58_PANELS_KERNEL, INPUT_CHANNELS, DENSE_58_UNITS, 1, pooled, INPUT_CHANNELS, output_acc, DENSE_GEMM_LDACC(DENSE_58_UNITS));
+#endif
+
+#ifdef ACTIVATION_LINEAR
+  requant_simd_row(hidden, output_acc, DENSE_58_UNITS, DENSE_58_REQUANT_SHIFT, bias_58, 1, 0);
+#elif defined(ACTIVATION_RELU)
+  requant_simd_row(hidden, output_acc, DENSE_58_UNITS, DENSE_58_REQUANT_SHIFT, bias_58, 1, 1);
+#endif
+
+#ifdef DENSE_59_TERNARY
+  // -DCNN_TERNARY: sign-select kernel on the ternary weights of weights/ternary.c
+  dense_ternary(&dense_59_ternary, DENSE_58_UNITS, DENSE_59_UNITS, hidden, output_acc);
+  (void)kernel_59;
+#elif defined(DENSE_59_INT8)
+  // -DCNN_INT8: int8 kernel on the weights and input quantization of weights/int8.c
+  dense_int8(&dense_59_int8, DENSE_58_UNITS, DENSE_59_UNITS, hidden, output_acc);
+  (void)kernel_59;
+#elif defined(DENSE_59_SPARSE)
+  // -DCNN_SPARSE: zero-skipping kernel on the block-sparse weights of weights/sparse.c
+  dense_sparse(&dense_59_sparse, DENSE_58_UNITS, DENSE_59_UNITS, hidden, output_acc);
+  (void)kernel_59;
+#else
+  dense_gemm(&kernel_59[0][0], DENSE_59_PANELS_KERNEL, DENSE_58_UNITS, DENSE_59_UNITS, 1, hidden, DENSE_58_UNITS, output_acc, DENSE_GEMM_LDACC(DENSE_59_UNITS));
+#endif
+
+#ifdef ACTIVATION_LINEAR
+  requant_simd_row(output, output_acc, DENSE_59_UNITS, DENSE_59_REQUANT_SHIFT, bias_59, 1, 0);
+#elif defined(ACTIVATION_RELU)
+  requant_simd_row(output, output_acc, DENSE_59_UNITS, DENSE_59_REQUANT_SHIFT, bias_59, 1, 1);
+#endif
+}
+
+// average_pooling1d_29_dense_58_dense_59() of n clips, the input of clip b at input + b * input_stride
+// number_t: the dense layers run as GEMMs over BATCH_ROWS clips at a time
+static inline void average_pooling1d_29_dense_58_dense_59_batch(
+  unsigned int n,
+  const number_t *input,                                        // IN
+  size_t input_stride,
+  const number_t kernel_58[DENSE_58_UNITS][INPUT_CHANNELS],     // IN
+  const number_t bias_58[DENSE_58_UNITS],                       // IN
+  const number_t kernel_59[DENSE_59_UNITS][DENSE_58_UNITS],     // IN
+  const number_t bias_59[DENSE_59_UNITS],                       // IN
+
+  number_t output[][DENSE_59_UNITS]) {                          // OUT
+
+  unsigned int b;
+#if defined(DENSE_58_TERNARY) || defined(DENSE_58_INT8) || defined(DENSE_58_SPARSE) \
+    || defined(DENSE_59_TERNARY) || defined(DENSE_59_INT8) || defined(DENSE_59_SPARSE)
+  // The ternary, int8 and sparse kernels run one clip at a time
+  for (b = 0; b < n; b++)
+    average_pooling1d_29_dense_58_dense_59((const number_t (*)[INPUT_SAMPLES])(input + b * input_stride),
+                                           kernel_58, bias_58, kernel_59, bias_59, output[b]);
+#else
+  long_number_t output_acc[BATCH_ROWS][DENSE_GEMM_LDACC(DENSE_58_UNITS)]; // dense_58 then dense_59 accumulators
+  number_t pooled[BATCH_ROWS][INPUT_CHANNELS];
+  number_t hidden[BATCH_ROWS][DENSE_58_UNITS];
+  unsigned int first, rows;
+
+  for (first = 0; first < n; first += BATCH_ROWS) {
+    rows = n - first < BATCH_ROWS ? n - first : BATCH_ROWS;
+    for (b = 0; b < rows; b++)
+      average_pooling1d_29_flat((const number_t (*)[INPUT_SAMPLES])(input + (first + b) * input_stride), pooled[b]);
+
+    dense_gemm(&kernel_58[0][0], DENSE_58_PANELS_KERNEL, INPUT_CHANNELS, DENSE_58_UNITS, rows,
+               pooled[0], INPUT_CHANNELS, output_acc[0], DENSE_GEMM_LDACC(DENSE_58_UNITS));
+    for (b = 0; b < rows; b++) {
+#ifdef ACTIVATION_LINEAR
+      requant_simd_row(hidden[b], output_acc[b], DENSE_58_UNITS, DENSE_58_REQUANT_SHIFT, bias_58, 1, 0);
+#elif defined(ACTIVATION_RELU)
+      requant_simd_row(hidden[b], output_acc[b], DENSE_58_UNITS, DENSE_58_REQUANT_SHIFT, bias_58, 1, 1);
+#endif
+    }
+
+    dense_gemm(&kernel_59[0][0], DENSE_59_PANELS_KERNEL, DENSE_58_UNITS, DENSE_59_UNITS, rows,
+               hidden[0], DENSE_58_UNITS, output_acc[0], DENSE_GEMM_LDACC(DENSE_58_UNITS));
+    for (b = 0; b < rows; b++) {
+#ifdef ACTIVATION_LINEAR
+      requant_simd_row(output[first + b], output_acc[b], DENSE_59_UNITS, DENSE_59_REQUANT_SHIFT, bias_59, 1, 0);
+#elif defined(ACTIVATION_RELU)
+      requant_simd_row(output[first + b], output_acc[b], DENSE_59_UNITS, DENSE_59_REQUANT_SHIFT, bias_59, 1, 1);
+#endif
+    }
+  }
+#endif
+}
+
+#undef INPUT_CHANNELS
+#undef INPUT_SAMPLES
+#undef POOL_SIZE
+#undef DENSE_58_UNITS
+#undef DENSE_59_UNITS
+#undef ACTIVATION_LINEAR
+#undef POOL_RECIPROCAL
+#undef BATCH_ROWS
+#undef DENSE_58_PANELS_KERNEL
+#undef DENSE_59_PANELS_KERNEL
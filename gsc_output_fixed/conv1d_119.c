@@ -9,6 +9,14 @@
 
 #ifndef SINGLE_FILE
 #include "number.h"
+#include "layer_params.h"
+#include "conv1d_simd.h"
+#include "requant_simd.h"
+#include "ternary.h"
+#include "int8.h"
+#include "sparse.h"
+#include "dsp.h"
+#include "conv1d_im2col.h"
 #endif
 
 #define INPUT_CHANNELS      64
@@ -24,8 +32,44 @@
 
 #define ACTIVATION_RELU
 
+#ifndef CONV1D_119_REQUANT_SHIFT
+#define CONV1D_119_REQUANT_SHIFT FIXED_POINT // input + weight - output fractional bits, per layer with -DCNN_LAYER_FORMATS
+#endif
+
 typedef number_t conv1d_119_output_type[CONV_FILTERS][CONV_OUTSAMPLES];
 
+static const conv1d_params_t conv1d_119_params = {
+  INPUT_CHANNELS, INPUT_SAMPLES, CONV_FILTERS, CONV_KERNEL_SIZE, CONV_STRIDE,
+  ZEROPADDING_LEFT, ZEROPADDING_RIGHT, CONV_OUTSAMPLES,
+#ifdef ACTIVATION_RELU
+  ACTIVATION_KIND_RELU,
+#else
+  ACTIVATION_KIND_LINEAR,
+#endif
+  CONV1D_119_REQUANT_SHIFT,
+};
+
+#if defined(CONV1D_119_TERNARY) && (INPUT_CHANNELS * CONV_KERNEL_SIZE > TERNARY_MAX_TAPS || CONV_OUTSAMPLES > TERNARY_MAX_SAMPLES \
+                                   || ZEROPADDING_LEFT != 0 || ZEROPADDING_RIGHT != 0)
+#error "-DCNN_TERNARY: conv1d_119 does not fit the kernel of ternary.h, and has no int16 kernel to fall back to"
+#endif
+
+#if defined(CONV1D_119_INT8) && (INPUT_CHANNELS * INPUT_SAMPLES > INT8_MAX_INPUT || (INPUT_CHANNELS * CONV_KERNEL_SIZE + 31) / 32 * 32 > INT8_MAX_ROW \
+                                || CONV_OUTSAMPLES > INT8_MAX_SAMPLES || ZEROPADDING_LEFT != 0 || ZEROPADDING_RIGHT != 0)
+#error "-DCNN_INT8: conv1d_119 does not fit the kernel of int8.h, and has no int16 kernel to fall back to"
+#endif
+
+#if defined(CONV1D_119_SPARSE) && (INPUT_CHANNELS * INPUT_SAMPLES > SPARSE_MAX_INPUT || CONV_OUTSAMPLES > SPARSE_MAX_SAMPLES \
+                                  || ZEROPADDING_LEFT != 0 || ZEROPADDING_RIGHT != 0)
+#error "-DCNN_SPARSE: conv1d_119 does not fit the kernel of sparse.h, and has no int16 kernel to fall back to"
+#endif
+
+#ifdef CNN_SIMD
+// Cache tiles of the vector kernel, zero for the defaults of conv1d_simd_tile(); shared with the
+// fused layers of conv1d_119
+static conv1d_tile_t conv1d_119_tile = {0, 0, 0};
+#endif
+
 static inline void conv1d_119(
   const number_t input[INPUT_CHANNELS][INPUT_SAMPLES],               // IN
   const number_t kernel[CONV_FILTERS][INPUT_CHANNELS][CONV_KERNEL_SIZE], // IN
@@ -38,9 +82,48 @@ static inline void conv1d_119(
   unsigned short x;
   short input_x;
   long_number_t	kernel_mac;
-  static long_number_t	output_acc[CONV_OUTSAMPLES];
+  long_number_t	output_acc[CONV_OUTSAMPLES];
   long_number_t tmp;
 
+#ifdef CONV1D_119_TERNARY
+  // -DCNN_TERNARY: sign-select kernel on the ternary weights of weights/ternary.c, the only
+  // weights of the layer (kernel is NULL)
+  conv1d_maxpool1d_ternary(NULL, &conv1d_119_params, NULL, &conv1d_119_ternary, &input[0][0], bias, &output[0][0]);
+  return;
+#endif
+
+#ifdef CONV1D_119_INT8
+  // -DCNN_INT8: int8 kernel on the weights and input quantization of weights/int8.c, the only
+  // weights of the layer (kernel is NULL)
+  conv1d_maxpool1d_int8(NULL, &conv1d_119_params, NULL, &conv1d_119_int8, &input[0][0], bias, &output[0][0]);
+  return;
+#endif
+
+#ifdef CONV1D_119_SPARSE
+  // -DCNN_SPARSE: zero-skipping kernel on the block-sparse weights of weights/sparse.c, the only
+  // weights of the layer (kernel is NULL)
+  conv1d_maxpool1d_sparse(NULL, &conv1d_119_params, NULL, &conv1d_119_sparse, &input[0][0], bias, &output[0][0]);
+  return;
+#endif
+
+#ifdef CONV1D_IM2COL
+  // im2col + blocked GEMM path, selected at build time
+  if (conv1d_im2col_gemm(&conv1d_119_params, &input[0][0], &kernel[0][0][0], bias, &output[0][0]))
+    return;
+#endif
+
+#ifdef CNN_SIMD
+  // Vectorized kernel of the running CPU, the loops below are the scalar fallback
+  if (conv1d_simd(&conv1d_119_params, &conv1d_119_tile, &input[0][0], &kernel[0][0][0], bias, &output[0][0]))
+    return;
+#endif
+
+#ifdef CNN_DSP
+  // Without a vector ISA: SMLAD kernel of dsp.h, on the Cortex-M4 or its emulation (-DCNN_DSP)
+  if (conv1d_maxpool1d_dsp(NULL, &conv1d_119_params, NULL, &input[0][0], &kernel[0][0][0], bias, &output[0][0]))
+    return;
+#endif
+
   for (k = 0; k < CONV_FILTERS; k++) { 
     for (pos_x = 0; pos_x < CONV_OUTSAMPLES; pos_x++) { 
       output_acc[pos_x] = 0;
@@ -58,23 +141,14 @@ static inline void conv1d_119(
 
 	      output_acc[pos_x] = output_acc[pos_x] + kernel_mac; 
       }
-      output_acc[pos_x] = scale_number_t(output_acc[pos_x]);
-
-      output_acc[pos_x] = output_acc[pos_x] + bias[k]; 
-
     }
 
-    for (pos_x = 0; pos_x < CONV_OUTSAMPLES; pos_x++) {
 #ifdef ACTIVATION_LINEAR
-      output[k][pos_x] = clamp_to_number_t(output_acc[pos_x]);
+    requant_simd_row(output[k], output_acc, CONV_OUTSAMPLES, CONV1D_119_REQUANT_SHIFT, &bias[k], 0, 0);
 #elif defined(ACTIVATION_RELU)
-      // Activation function: ReLU
-      if (output_acc[pos_x] < 0)
-        output[k][pos_x] = 0;
-      else
-        output[k][pos_x] = clamp_to_number_t(output_acc[pos_x]);
+    // Activation function: ReLU
+    requant_simd_row(output[k], output_acc, CONV_OUTSAMPLES, CONV1D_119_REQUANT_SHIFT, &bias[k], 0, 1);
 #endif
-    }
   }
 }
 
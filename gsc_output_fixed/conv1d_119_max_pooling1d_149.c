@@ -0,0 +1,156 @@
+/**
+  ******************************************************************************
+  * @file    conv1d_119_max_pooling1d_149.c
+  * @version 1.0.0
+  * @date    17 october 2026
+  * @brief   conv1d_119 fused with the max_pooling1d_149 that follows it: each pooled sample
+  *          is the max of the conv outputs under the pool, which are never stored
+  */
+
+#ifndef SINGLE_FILE
+#include "number.h"
+#include "layer_params.h"
+#include "conv1d_simd.h"
+#include "conv1d_im2col.h"
+#include "conv1d_winograd.h"
+#include "ternary.h"
+#include "int8.h"
+#include "sparse.h"
+#include "dsp.h"
+#include "autotune.h"
+#include "requant_simd.h"
+#endif
+
+#define INPUT_CHANNELS      64
+#define INPUT_SAMPLES       30
+#define CONV_FILTERS        128
+#define CONV_KERNEL_SIZE    3
+#define CONV_STRIDE         1
+#define CONV_OUTSAMPLES     ( ( (INPUT_SAMPLES - CONV_KERNEL_SIZE) / CONV_STRIDE ) + 1 )
+#define POOL_SIZE           2
+#define POOL_STRIDE         2
+#define POOL_LENGTH         ( ( (CONV_OUTSAMPLES - POOL_SIZE) / POOL_STRIDE ) + 1 )
+
+#define ACTIVATION_RELU
+
+#ifdef CNN_AUTOTUNE
+// Kernel of conv1d_119 picked by cnn_autotune(), see autotune.h
+static conv1d_choice_t conv1d_119_choice = {
+  CONV1D_KERNEL_DEFAULT,
+  CONV1D_CHOICE_TILE(conv1d_119_tile),
+  &conv1d_119_accum_plan,
+#ifdef CONV1D_119_WINOGRAD
+  &conv1d_119_winograd_kernel[0][0][0],
+#else
+  NULL,
+#endif
+};
+#endif
+
+static inline void conv1d_119_max_pooling1d_149(
+  const number_t input[INPUT_CHANNELS][INPUT_SAMPLES],                   // IN
+  const number_t kernel[CONV_FILTERS][INPUT_CHANNELS][CONV_KERNEL_SIZE], // IN
+
+  const number_t bias[CONV_FILTERS],                                     // IN
+
+  number_t output[CONV_FILTERS][POOL_LENGTH]) {                         // OUT
+
+  unsigned short pos_x, z, k, x, y;
+  unsigned short input_x;
+  long_number_t kernel_mac;
+  long_number_t output_acc[CONV_OUTSAMPLES]; // conv outputs of one filter, pooled before the activation
+  long_number_t max;
+
+#ifdef CONV1D_119_TERNARY
+  // -DCNN_TERNARY: sign-select kernel on the ternary weights of weights/ternary.c, the only
+  // weights of the layer (kernel is NULL)
+  conv1d_maxpool1d_ternary(NULL, &conv1d_119_params, &max_pooling1d_149_params, &conv1d_119_ternary, &input[0][0], bias, &output[0][0]);
+  return;
+#endif
+
+#ifdef CONV1D_119_INT8
+  // -DCNN_INT8: int8 kernel on the weights and input quantization of weights/int8.c, the only
+  // weights of the layer (kernel is NULL)
+  conv1d_maxpool1d_int8(NULL, &conv1d_119_params, &max_pooling1d_149_params, &conv1d_119_int8, &input[0][0], bias, &output[0][0]);
+  return;
+#endif
+
+#ifdef CONV1D_119_SPARSE
+  // -DCNN_SPARSE: zero-skipping kernel on the block-sparse weights of weights/sparse.c, the only
+  // weights of the layer (kernel is NULL)
+  conv1d_maxpool1d_sparse(NULL, &conv1d_119_params, &max_pooling1d_149_params, &conv1d_119_sparse, &input[0][0], bias, &output[0][0]);
+  return;
+#endif
+
+#ifdef CNN_AUTOTUNE
+  // -DCNN_AUTOTUNE: kernel measured fastest on this CPU, the chain below when it is the default
+  if (conv1d_maxpool1d_tuned(&conv1d_119_choice, NULL, &conv1d_119_params, &max_pooling1d_149_params, &input[0][0], &kernel[0][0][0], bias, &output[0][0]))
+    return;
+#endif
+
+#ifdef CONV1D_IM2COL
+  // im2col + blocked GEMM path, selected at build time
+  if (conv1d_maxpool1d_im2col_gemm(&conv1d_119_params, &max_pooling1d_149_params, &input[0][0], &kernel[0][0][0], bias, &output[0][0]))
+    return;
+#endif
+
+#ifdef CNN_SIMD
+  // Vectorized kernel of the running CPU, the loops below are the scalar fallback
+  if (conv1d_maxpool1d_simd(NULL, &conv1d_119_params, &max_pooling1d_149_params, &conv1d_119_tile, &input[0][0], &kernel[0][0][0], bias, &output[0][0]))
+    return;
+#endif
+
+#ifdef CNN_DSP
+  // Without a vector ISA: SMLAD kernel of dsp.h, on the Cortex-M4 or its emulation (-DCNN_DSP)
+  if (conv1d_maxpool1d_dsp(NULL, &conv1d_119_params, &max_pooling1d_149_params, &input[0][0], &kernel[0][0][0], bias, &output[0][0]))
+    return;
+#endif
+
+#if defined(CONV1D_WINOGRAD) && defined(CONV1D_119_WINOGRAD) // not for the layers on ternary, int8 or sparse weights only
+  // Without a vector ISA: Winograd path on the transformed kernel of weights/conv1d_119_winograd.c, selected at build time
+  if (conv1d_maxpool1d_winograd(&conv1d_119_params, &max_pooling1d_149_params, &conv1d_119_accum_plan, &input[0][0], &conv1d_119_winograd_kernel[0][0][0], bias, &output[0][0]))
+    return;
+#endif
+
+  for (k = 0; k < CONV_FILTERS; k++) {
+    for (pos_x = 0; pos_x < CONV_OUTSAMPLES; pos_x++) {
+      output_acc[pos_x] = 0;
+      for (z = 0; z < INPUT_CHANNELS; z++) {
+        kernel_mac = 0;
+        for (x = 0; x < CONV_KERNEL_SIZE; x++) {
+          input_x = pos_x * CONV_STRIDE + x;
+          kernel_mac = kernel_mac + input[z][input_x] * kernel[k][z][x];
+        }
+        output_acc[pos_x] = output_acc[pos_x] + kernel_mac;
+      }
+    }
+
+    // max_pooling1d_149 (linear) of the row, in place; the requantization, the activation and
+    // the clamp are monotonic so they are applied once to the max instead of to every conv output
+    for (pos_x = 0; pos_x < POOL_LENGTH; pos_x++) {
+      max = output_acc[pos_x * POOL_STRIDE];
+      for (y = 1; y < POOL_SIZE; y++)
+        if (max < output_acc[pos_x * POOL_STRIDE + y])
+          max = output_acc[pos_x * POOL_STRIDE + y];
+      output_acc[pos_x] = max;
+    }
+
+#ifdef ACTIVATION_LINEAR
+    requant_simd_row(output[k], output_acc, POOL_LENGTH, CONV1D_119_REQUANT_SHIFT, &bias[k], 0, 0);
+#elif defined(ACTIVATION_RELU)
+    // Activation function: ReLU
+    requant_simd_row(output[k], output_acc, POOL_LENGTH, CONV1D_119_REQUANT_SHIFT, &bias[k], 0, 1);
+#endif
+  }
+}
+
+#undef INPUT_CHANNELS
+#undef INPUT_SAMPLES
+#undef CONV_FILTERS
+#undef CONV_KERNEL_SIZE
+#undef CONV_STRIDE
+#undef CONV_OUTSAMPLES
+#undef POOL_SIZE
+#undef POOL_STRIDE
+#undef POOL_LENGTH
+#undef ACTIVATION_RELU
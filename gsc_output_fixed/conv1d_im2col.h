@@ -0,0 +1,263 @@
+/**
+  ******************************************************************************
+  * @file    conv1d_im2col.h
+  * @version 1.0.0
+  * @date    17 october 2026
+  * @brief   conv1d lowered to im2col and a cache-blocked int16 GEMM
+  *
+  * output[k][pos] = sum_r kernel[k][r] * cols[pos][r] with r = z * kernel_size + x, so the
+  * generated kernel[filters][input_channels][kernel_size] array is used as is as the left
+  * operand. Enabled at build time with -DCONV1D_IM2COL for the layers that support it.
+  */
+
+#ifndef __CONV1D_IM2COL_H__
+#define __CONV1D_IM2COL_H__
+
+#ifndef SINGLE_FILE
+#include "number.h"
+#include "layer_params.h"
+#include "simd.h"
+#include "requant_simd.h"
+#endif
+
+#include <string.h>
+
+// Tile sizes: MR filters x NR output positions per microkernel call, KC depth pairs and NC output
+// positions per packed block of the im2col matrix (KC * NR int32 must stay well inside L1)
+#define CONV1D_GEMM_MR 4
+#define CONV1D_GEMM_NR 16
+#ifndef CONV1D_GEMM_KC
+#define CONV1D_GEMM_KC 128
+#endif
+#ifndef CONV1D_GEMM_NC
+#define CONV1D_GEMM_NC 64
+#endif
+
+#define CONV1D_IM2COL_MAX_COLS 16384 // outsamples * input_channels * kernel_size
+#define CONV1D_IM2COL_MAX_ACC  16384 // filters * outsamples rounded up to CONV1D_GEMM_NR
+
+static void conv1d_gemm_microkernel_scalar(
+  int kc,
+  const int32_t *a,
+  const number_t *w,
+  int ldw,
+  int last_single,
+  int nfilters,
+  long_number_t *c,
+  int ldc,
+  int accumulate) {
+
+  long_number_t acc[CONV1D_GEMM_MR][CONV1D_GEMM_NR];
+  int q, f, n;
+
+  for (f = 0; f < nfilters; f++)
+    for (n = 0; n < CONV1D_GEMM_NR; n++)
+      acc[f][n] = accumulate ? c[f * ldc + n] : 0;
+
+  for (q = 0; q < kc; q++) {
+    const int single = last_single && q == kc - 1;
+    for (f = 0; f < nfilters; f++) {
+      const long_number_t w0 = w[f * ldw + 2 * q];
+      const long_number_t w1 = single ? 0 : w[f * ldw + 2 * q + 1];
+      for (n = 0; n < CONV1D_GEMM_NR; n++) {
+        const int32_t pair = a[q * CONV1D_GEMM_NR + n];
+        acc[f][n] += w0 * (number_t)(pair & 0xFFFF) + w1 * (number_t)(pair >> 16);
+      }
+    }
+  }
+
+  for (f = 0; f < nfilters; f++)
+    for (n = 0; n < CONV1D_GEMM_NR; n++)
+      c[f * ldc + n] = acc[f][n];
+}
+
+#ifdef CNN_SIMD
+
+#define SIMD_ISA(name) name##_portable
+#define SIMD_VEC cnn_vec_t
+#define SIMD_LANES 4
+#include "conv1d_im2col_isa.h"
+#undef SIMD_ISA
+#undef SIMD_VEC
+#undef SIMD_LANES
+
+#ifdef CNN_SIMD_X86
+
+#pragma GCC push_options
+#pragma GCC target("sse4.1")
+#define SIMD_ISA(name) name##_sse41
+#define SIMD_VEC __m128i
+#define SIMD_LANES 4
+#include "conv1d_im2col_isa.h"
+#undef SIMD_ISA
+#undef SIMD_VEC
+#undef SIMD_LANES
+#pragma GCC pop_options
+
+#pragma GCC push_options
+#pragma GCC target("avx2")
+#define SIMD_ISA(name) name##_avx2
+#define SIMD_VEC __m256i
+#define SIMD_LANES 8
+#include "conv1d_im2col_isa.h"
+#undef SIMD_ISA
+#undef SIMD_VEC
+#undef SIMD_LANES
+#pragma GCC pop_options
+
+#endif//CNN_SIMD_X86
+
+#endif//CNN_SIMD
+
+typedef void (*conv1d_gemm_microkernel_t)(int, const int32_t *, const number_t *, int, int, int, long_number_t *, int, int);
+
+static conv1d_gemm_microkernel_t conv1d_gemm_microkernel(void) {
+#ifdef CNN_SIMD
+  switch (cnn_isa) {
+#ifdef CNN_SIMD_X86
+    case CNN_ISA_AVX2:
+      return conv1d_gemm_microkernel_avx2;
+    case CNN_ISA_SSE41:
+      return conv1d_gemm_microkernel_sse41;
+#endif
+    case CNN_ISA_PORTABLE:
+      return conv1d_gemm_microkernel_portable;
+    default:
+      break;
+  }
+#endif
+  return conv1d_gemm_microkernel_scalar;
+}
+
+// cols[pos][z * kernel_size + x] = input[z][pos * stride + x], no zero padding
+static void conv1d_im2col(
+  const conv1d_params_t *p,
+  const number_t *input,
+  number_t *cols) {
+
+  // Shapes are copied out of the descriptor, its unsigned short fields may alias number_t stores
+  const int input_channels = p->input_channels, input_samples = p->input_samples;
+  const int kernel_size = p->kernel_size, stride = p->stride, outsamples = p->outsamples;
+  const number_t *in;
+  number_t *col = cols;
+  int pos, z, x;
+
+  for (pos = 0; pos < outsamples; pos++) {
+    in = input + pos * stride;
+    for (z = 0; z < input_channels; z++, in += input_samples)
+      for (x = 0; x < kernel_size; x++)
+        *col++ = in[x];
+  }
+}
+
+// Packs depth pairs [q0, q0 + kc) of im2col rows [pos0, pos0 + nc) into CONV1D_GEMM_NR wide panels,
+// padding the last panel with zero columns
+static void conv1d_gemm_pack(
+  const number_t *cols,
+  int depth,
+  int pos0,
+  int nc,
+  int q0,
+  int kc,
+  int32_t *packed) {
+
+  int panel, q, n, r, width;
+  const number_t *row;
+
+  for (panel = 0; panel < nc; panel += CONV1D_GEMM_NR, packed += kc * CONV1D_GEMM_NR) {
+    width = nc - panel < CONV1D_GEMM_NR ? nc - panel : CONV1D_GEMM_NR;
+    if (width < CONV1D_GEMM_NR)
+      memset(packed, 0, kc * CONV1D_GEMM_NR * sizeof(int32_t));
+    for (n = 0; n < width; n++) {
+      row = cols + (pos0 + panel + n) * depth;
+      for (q = 0; q < kc; q++) {
+        r = 2 * (q0 + q);
+        if (r + 1 < depth)
+          memcpy(&packed[q * CONV1D_GEMM_NR + n], row + r, sizeof(int32_t)); // (row[r], row[r+1])
+        else
+          packed[q * CONV1D_GEMM_NR + n] = (uint16_t)row[r];
+      }
+    }
+  }
+}
+
+// Returns 0 when the layer does not fit the buffers (or is zero-padded), the caller then runs its
+// direct loops. The GEMM leaves every conv output in acc, so a max pooling following the conv
+// (output_pool, may be NULL) is applied there before requantization, which is monotonic.
+static int conv1d_maxpool1d_im2col_gemm(
+  const conv1d_params_t *p,
+  const maxpool1d_params_t *output_pool,
+  const number_t *input,
+  const number_t *kernel,
+  const number_t *bias,
+  number_t *output) {
+
+  // On the stack (~140 kB with the default limits) so that concurrent inferences do not share them,
+  // this path is only built for hosts
+  number_t cols[CONV1D_IM2COL_MAX_COLS];
+  long_number_t acc[CONV1D_IM2COL_MAX_ACC];
+  int32_t packed[CONV1D_GEMM_KC * (CONV1D_GEMM_NC + CONV1D_GEMM_NR)];
+
+  const int filters = p->filters, outsamples = p->outsamples;
+  const int relu = p->activation == ACTIVATION_KIND_RELU;
+  const int depth = p->input_channels * p->kernel_size;
+  const int dpairs = (depth + 1) / 2;
+  const int ldc = (outsamples + CONV1D_GEMM_NR - 1) / CONV1D_GEMM_NR * CONV1D_GEMM_NR;
+  const conv1d_gemm_microkernel_t microkernel = conv1d_gemm_microkernel();
+  const int pool_size = output_pool != NULL ? output_pool->pool_size : 1;
+  const int pool_stride = output_pool != NULL ? output_pool->pool_stride : 1;
+  const int out_samples = output_pool != NULL ? output_pool->pool_length : outsamples;
+  int q0, kc, pos0, nc, k, panel, pos, y;
+  long_number_t *row;
+
+  if (p->zeropadding_left != 0 || p->zeropadding_right != 0)
+    return 0;
+  if (output_pool != NULL && (output_pool->activation != ACTIVATION_KIND_LINEAR
+                              || output_pool->input_channels != filters || output_pool->input_samples != outsamples))
+    return 0;
+  if (outsamples * depth > CONV1D_IM2COL_MAX_COLS || filters * ldc > CONV1D_IM2COL_MAX_ACC)
+    return 0;
+
+  conv1d_im2col(p, input, cols);
+
+  for (q0 = 0; q0 < dpairs; q0 += CONV1D_GEMM_KC) {
+    kc = dpairs - q0 < CONV1D_GEMM_KC ? dpairs - q0 : CONV1D_GEMM_KC;
+    for (pos0 = 0; pos0 < outsamples; pos0 += CONV1D_GEMM_NC) {
+      nc = outsamples - pos0 < CONV1D_GEMM_NC ? outsamples - pos0 : CONV1D_GEMM_NC;
+      conv1d_gemm_pack(cols, depth, pos0, nc, q0, kc, packed);
+      for (k = 0; k < filters; k += CONV1D_GEMM_MR)
+        for (panel = 0; panel < nc; panel += CONV1D_GEMM_NR)
+          microkernel(kc, packed + panel * kc, kernel + k * depth + 2 * q0, depth,
+                      (depth & 1) && q0 + kc == dpairs,
+                      filters - k < CONV1D_GEMM_MR ? filters - k : CONV1D_GEMM_MR,
+                      acc + k * ldc + pos0 + panel, ldc, q0 != 0);
+    }
+  }
+
+  // The pooled accumulators are written in place (pos <= pos * pool_stride), then the row is
+  // requantized at once
+  for (k = 0; k < filters; k++) {
+    row = acc + k * ldc;
+    if (output_pool != NULL) {
+      for (pos = 0; pos < out_samples; pos++) {
+        row[pos] = row[pos * pool_stride];
+        for (y = 1; y < pool_size; y++)
+          if (row[pos] < row[pos * pool_stride + y])
+            row[pos] = row[pos * pool_stride + y];
+      }
+    }
+    requant_simd_row(output + k * out_samples, row, out_samples, p->requant_shift, &bias[k], 0, relu);
+  }
+  return 1;
+}
+
+static inline int conv1d_im2col_gemm(
+  const conv1d_params_t *p,
+  const number_t *input,
+  const number_t *kernel,
+  const number_t *bias,
+  number_t *output) {
+  return conv1d_maxpool1d_im2col_gemm(p, NULL, input, kernel, bias, output);
+}
+
+#endif//__CONV1D_IM2COL_H__
@@ -0,0 +1,59 @@
+/**
+  ******************************************************************************
+  * @file    conv1d_im2col_isa.h
+  * @version 1.0.0
+  * @date    17 october 2026
+  * @brief   int16 GEMM microkernel, included once per ISA by conv1d_im2col.h
+  *
+  * Expects SIMD_ISA(name) to append the ISA suffix, SIMD_VEC the vector type and
+  * SIMD_LANES its number of int32 lanes (CONV1D_GEMM_NR must be a multiple of it).
+  */
+
+static void SIMD_ISA(conv1d_gemm_microkernel)(
+  int kc,                    // depth pairs in this block
+  const int32_t *a,          // packed panel [kc][CONV1D_GEMM_NR] of (col[2q], col[2q+1]) pairs
+  const number_t *w,         // first filter row, already offset to the block depth
+  int ldw,                   // filter row stride (input_channels * kernel_size)
+  int last_single,           // last pair of the block is a trailing odd tap
+  int nfilters,              // <= CONV1D_GEMM_MR
+  long_number_t *c,          // [nfilters][ldc] accumulators
+  int ldc,
+  int accumulate) {          // 0 on the first depth block
+
+  const int nvec = CONV1D_GEMM_NR / SIMD_LANES;
+  SIMD_VEC acc[CONV1D_GEMM_MR][CONV1D_GEMM_NR / SIMD_LANES];
+  SIMD_VEC av[CONV1D_GEMM_NR / SIMD_LANES], wv;
+  int q, f, v;
+
+  for (f = 0; f < nfilters; f++)
+    for (v = 0; v < nvec; v++)
+      acc[f][v] = accumulate ? SIMD_ISA(vload_i32)(c + f * ldc + v * SIMD_LANES) : SIMD_ISA(vzero)();
+
+  if (nfilters == CONV1D_GEMM_MR && !last_single) {
+    // Constant trip counts so that the whole accumulator tile stays in registers
+    for (q = 0; q < kc; q++) {
+      for (v = 0; v < CONV1D_GEMM_NR / SIMD_LANES; v++)
+        av[v] = SIMD_ISA(vload_i32)(a + q * CONV1D_GEMM_NR + v * SIMD_LANES);
+      for (f = 0; f < CONV1D_GEMM_MR; f++) {
+        wv = SIMD_ISA(vset_pair)(load_number_pair(w + f * ldw + 2 * q));
+        for (v = 0; v < CONV1D_GEMM_NR / SIMD_LANES; v++)
+          acc[f][v] = SIMD_ISA(vadd)(acc[f][v], SIMD_ISA(vmadd)(av[v], wv));
+      }
+    }
+  } else {
+    for (q = 0; q < kc; q++) {
+      const int single = last_single && q == kc - 1;
+      for (v = 0; v < nvec; v++)
+        av[v] = SIMD_ISA(vload_i32)(a + q * CONV1D_GEMM_NR + v * SIMD_LANES);
+      for (f = 0; f < nfilters; f++) {
+        wv = SIMD_ISA(vset_pair)(single ? load_number_single(w + f * ldw + 2 * q) : load_number_pair(w + f * ldw + 2 * q));
+        for (v = 0; v < nvec; v++)
+          acc[f][v] = SIMD_ISA(vadd)(acc[f][v], SIMD_ISA(vmadd)(av[v], wv));
+      }
+    }
+  }
+
+  for (f = 0; f < nfilters; f++)
+    for (v = 0; v < nvec; v++)
+      SIMD_ISA(vstore_i32)(c + f * ldc + v * SIMD_LANES, acc[f][v]);
+}
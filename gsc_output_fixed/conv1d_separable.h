@@ -0,0 +1,132 @@
+/**
+  ******************************************************************************
+  * @file    conv1d_separable.h
+  * @version 1.0.0
+  * @date    17 october 2026
+  * @brief   Vector kernels of the depthwise and pointwise conv1d layers of a separable block
+  *
+  * A depthwise-separable block (Keras SeparableConv1D) replaces a conv of input_channels x
+  * kernel_size taps per filter by a depthwise conv, kernel_size taps on each input channel
+  * (depth_multiplier filters per channel, output channel o reading input channel
+  * o / depth_multiplier), then a pointwise conv of kernel size 1 across the channels of the
+  * depthwise output. The shapes are those of conv1d_params_t: the depthwise conv has
+  * filters = input_channels * depth_multiplier, the pointwise one kernel_size = stride = 1.
+  * The depthwise kernel runs one channel at a time on vload_pairs of its row, the pairs of taps
+  * broadcast once per channel. The pointwise kernel interleaves the pairs of channels of a block
+  * of positions once (vload_rows_pairs), then 4 filters at a time sum them like the vector conv
+  * kernel of conv1d_simd.h, optionally fused with the pool 2 / stride 2 max pooling that follows.
+  * Both sum the int32 products of the generated loops, so they are bit-exact with them. They run
+  * on one thread, the scalar loops of the depthwise_conv1d_*.c and pointwise_conv1d_*.c layers
+  * are the fallback (CNN_ISA=scalar, -DCNN_NO_SIMD). Used by the -DCNN_SEPARABLE chain.
+  */
+
+#ifndef __CONV1D_SEPARABLE_H__
+#define __CONV1D_SEPARABLE_H__
+
+#ifndef SINGLE_FILE
+#include "number.h"
+#include "layer_params.h"
+#include "simd.h"
+#include "conv1d_simd.h"
+#endif
+
+#include <stddef.h>
+#include <string.h>
+
+#ifdef CNN_SIMD
+
+#define SEPARABLE_MAX_TAPS     32  // kernel_size of a depthwise conv
+#define SEPARABLE_MAX_CHANNELS 256 // input_channels of a pointwise conv
+
+#define SIMD_ISA(name) name##_portable
+#define SIMD_VEC cnn_vec_t
+#define SIMD_LANES 4
+#include "conv1d_separable_isa.h"
+#undef SIMD_ISA
+#undef SIMD_VEC
+#undef SIMD_LANES
+
+#ifdef CNN_SIMD_X86
+
+#pragma GCC push_options
+#pragma GCC target("sse4.1")
+#define SIMD_ISA(name) name##_sse41
+#define SIMD_VEC __m128i
+#define SIMD_LANES 4
+#include "conv1d_separable_isa.h"
+#undef SIMD_ISA
+#undef SIMD_VEC
+#undef SIMD_LANES
+#pragma GCC pop_options
+
+#pragma GCC push_options
+#pragma GCC target("avx2")
+#define SIMD_ISA(name) name##_avx2
+#define SIMD_VEC __m256i
+#define SIMD_LANES 8
+#include "conv1d_separable_isa.h"
+#undef SIMD_ISA
+#undef SIMD_VEC
+#undef SIMD_LANES
+#pragma GCC pop_options
+
+#endif//CNN_SIMD_X86
+
+// Depthwise conv p (kernel [filters][kernel_size], filters a multiple of input_channels),
+// requantized with bias. Returns 0 when the layer does not fit, the caller then runs the
+// generated loops.
+static inline int depthwise_conv1d_simd(
+  const conv1d_params_t *p,
+  const number_t *input,    // [input_channels][input_samples]
+  const number_t *kernel,   // [filters][kernel_size]
+  const number_t *bias,     // [filters]
+  number_t *output) {       // [filters][outsamples]
+
+  if (cnn_isa == CNN_ISA_SCALAR || p->zeropadding_left != 0 || p->zeropadding_right != 0
+      || p->filters % p->input_channels != 0 || p->kernel_size > SEPARABLE_MAX_TAPS
+      || p->stride > CONV1D_SIMD_MAX_STRIDE || p->input_samples < p->kernel_size)
+    return 0;
+
+#ifdef CNN_SIMD_X86
+  if (cnn_isa == CNN_ISA_AVX2)
+    depthwise_conv1d_avx2(p, input, kernel, bias, output);
+  else if (cnn_isa == CNN_ISA_SSE41)
+    depthwise_conv1d_sse41(p, input, kernel, bias, output);
+  else
+#endif
+    depthwise_conv1d_portable(p, input, kernel, bias, output);
+  return 1;
+}
+
+// Pointwise conv p (kernel [filters][input_channels]) followed by the pool 2 / stride 2 max
+// pooling output_pool (NULL for none, linear only), requantized with bias. Returns 0 when the
+// layer does not fit, the caller then runs the generated loops.
+static inline int pointwise_conv1d_maxpool1d_simd(
+  const conv1d_params_t *p,
+  const maxpool1d_params_t *output_pool,
+  const number_t *input,    // [input_channels][input_samples]
+  const number_t *kernel,   // [filters][input_channels]
+  const number_t *bias,     // [filters]
+  number_t *output) {       // [filters][outsamples], [filters][pool_length] with output_pool
+
+  if (cnn_isa == CNN_ISA_SCALAR || p->kernel_size != 1 || p->stride != 1
+      || p->zeropadding_left != 0 || p->zeropadding_right != 0 || p->input_channels > SEPARABLE_MAX_CHANNELS)
+    return 0;
+  if (output_pool != NULL && (output_pool->activation != ACTIVATION_KIND_LINEAR
+                              || output_pool->pool_size != 2 || output_pool->pool_stride != 2))
+    return 0;
+
+#ifdef CNN_SIMD_X86
+  if (cnn_isa == CNN_ISA_AVX2)
+    pointwise_conv1d_maxpool1d_avx2(p, input, kernel, bias, output_pool != NULL, output);
+  else if (cnn_isa == CNN_ISA_SSE41)
+    pointwise_conv1d_maxpool1d_sse41(p, input, kernel, bias, output_pool != NULL, output);
+  else
+#endif
+    pointwise_conv1d_maxpool1d_portable(p, input, kernel, bias, output_pool != NULL, output);
+  return 1;
+}
+
+#endif//CNN_SIMD
+
+#endif//__CONV1D_SEPARABLE_H__
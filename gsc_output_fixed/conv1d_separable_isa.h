@@ -0,0 +1,153 @@
+/**
+  ******************************************************************************
+  * @file    conv1d_separable_isa.h
+  * @version 1.0.0
+  * @date    17 october 2026
+  * @brief   Vectorized depthwise and pointwise conv1d kernels, included once per ISA by
+  *          conv1d_separable.h
+  *
+  * Expects SIMD_ISA(name) to append the ISA suffix, SIMD_VEC the vector type and SIMD_LANES its
+  * number of int32 lanes.
+  */
+
+// Depthwise conv p, same input, kernel and output as depthwise_conv1d_simd(): each filter runs
+// its blocks of 2*SIMD_LANES conv positions on the vload_pairs of the row of its input channel.
+// The blocks whose windows would read past the row (the last one, the odd last tap reading the
+// sample after its window with a zero weight) run on a zero-padded copy of the rest of the row.
+static void SIMD_ISA(depthwise_conv1d)(
+  const conv1d_params_t *p,
+  const number_t *input,    // [input_channels][input_samples]
+  const number_t *kernel,   // [filters][kernel_size]
+  const number_t *bias,     // [filters]
+  number_t *output) {       // [filters][outsamples]
+
+  const int block = 2 * SIMD_LANES; // conv positions per iteration
+  const int multiplier = p->filters / p->input_channels;
+  const int npairs = (p->kernel_size + 1) / 2;
+  const int window = (block - 1) * p->stride + 2 * npairs; // samples read by a block
+  const int safe = p->input_samples >= 2 * npairs ? (p->input_samples - 2 * npairs) / p->stride + 1 : 0;
+  const int full = (safe < p->outsamples ? safe : p->outsamples) / block * block;
+  const int relu = p->activation == ACTIVATION_KIND_RELU;
+  SIMD_VEC taps[SEPARABLE_MAX_TAPS / 2];
+  number_t tail[(2 * SIMD_LANES - 1) * CONV1D_SIMD_MAX_STRIDE + SEPARABLE_MAX_TAPS];
+  number_t partial_out[2 * SIMD_LANES];
+  const number_t *row, *in, *w;
+  number_t *out;
+  int k, j, pos, count, n;
+
+  for (k = 0; k < p->filters; k++) {
+    row = input + (k / multiplier) * p->input_samples;
+    w = kernel + k * p->kernel_size;
+    out = output + k * p->outsamples;
+    for (j = 0; j < npairs; j++)
+      taps[j] = SIMD_ISA(vset_pair)(2 * j + 1 < p->kernel_size ? load_number_pair(w + 2 * j) : load_number_single(w + 2 * j));
+
+    for (pos = 0; pos < p->outsamples; pos += block) {
+      SIMD_VEC lo = SIMD_ISA(vzero)(), hi = lo, a, b;
+
+      count = p->outsamples - pos < block ? p->outsamples - pos : block;
+      in = row + pos * p->stride;
+      if (pos >= full) {
+        n = p->input_samples - pos * p->stride < window ? p->input_samples - pos * p->stride : window;
+        memcpy(tail, in, n * sizeof(number_t));
+        memset(tail + n, 0, (window - n) * sizeof(number_t));
+        in = tail;
+      }
+      for (j = 0; j < npairs; j++) {
+        SIMD_ISA(vload_pairs)(in + 2 * j, p->stride, &a, &b);
+        lo = SIMD_ISA(vadd)(lo, SIMD_ISA(vmadd)(a, taps[j]));
+        hi = SIMD_ISA(vadd)(hi, SIMD_ISA(vmadd)(b, taps[j]));
+      }
+
+      if (count < block) {
+        SIMD_ISA(vstore_requant)(partial_out, lo, hi, p->requant_shift, bias[k], relu);
+        memcpy(out + pos, partial_out, count * sizeof(number_t));
+      } else {
+        SIMD_ISA(vstore_requant)(out + pos, lo, hi, p->requant_shift, bias[k], relu);
+      }
+    }
+  }
+}
+
+// Pointwise conv p, same input, kernel and output as pointwise_conv1d_maxpool1d_simd() with the
+// pool 2 / stride 2 max pooling of its output when pool2. The pairs of channels of a block of
+// 2*SIMD_LANES positions are interleaved once, then each group of 4 filters sums them on 8
+// accumulators. The last block and an odd last channel are read from zero-padded copies.
+static void SIMD_ISA(pointwise_conv1d_maxpool1d)(
+  const conv1d_params_t *p,
+  const number_t *input,    // [input_channels][input_samples]
+  const number_t *kernel,   // [filters][input_channels]
+  const number_t *bias,     // [filters]
+  int pool2,
+  number_t *output) {       // [filters][outsamples], [filters][outsamples / 2] if pool2
+
+  const int block = 2 * SIMD_LANES;                 // conv positions per iteration
+  const int out_block = pool2 ? SIMD_LANES : block;
+  const int channels = p->input_channels;
+  const int npairs = (channels + 1) / 2;
+  const int out_samples = pool2 ? p->outsamples / 2 : p->outsamples;
+  const int conv_samples = pool2 ? 2 * out_samples : p->outsamples;
+  const int relu = p->activation == ACTIVATION_KIND_RELU;
+  SIMD_VEC pairs[SEPARABLE_MAX_CHANNELS / 2][2];
+  number_t tail[2][2 * SIMD_LANES];
+  number_t partial_out[2 * SIMD_LANES];
+  const number_t *a, *b, *w[4];
+  number_t *out;
+  int pos, count, n, j, k, f;
+
+  for (pos = 0; pos < conv_samples; pos += block) {
+    count = conv_samples - pos < block ? conv_samples - pos : block;
+    if (pool2)
+      count /= 2;
+
+    for (j = 0; j < npairs; j++) {
+      a = input + 2 * j * p->input_samples + pos;
+      b = 2 * j + 1 < channels ? a + p->input_samples : NULL;
+      if (pos + block <= p->input_samples && b != NULL) {
+        SIMD_ISA(vload_rows_pairs)(a, b, &pairs[j][0], &pairs[j][1]);
+        continue;
+      }
+      n = p->input_samples - pos < block ? p->input_samples - pos : block;
+      memset(tail, 0, sizeof(tail));
+      memcpy(tail[0], a, n * sizeof(number_t));
+      if (b != NULL)
+        memcpy(tail[1], b, n * sizeof(number_t));
+      SIMD_ISA(vload_rows_pairs)(tail[0], tail[1], &pairs[j][0], &pairs[j][1]);
+    }
+
+    for (k = 0; k < p->filters; k += 4) {
+      SIMD_VEC acc[4][2];
+
+      // The filters past the last one of the last group repeat it, their sums are dropped
+      for (f = 0; f < 4; f++) {
+        w[f] = kernel + (k + f < p->filters ? k + f : p->filters - 1) * channels;
+        acc[f][0] = acc[f][1] = SIMD_ISA(vzero)();
+      }
+      for (j = 0; j < npairs; j++) {
+        const int odd = 2 * j + 1 >= channels;
+        const SIMD_VEC w0 = SIMD_ISA(vset_pair)(odd ? load_number_single(w[0] + 2 * j) : load_number_pair(w[0] + 2 * j));
+        const SIMD_VEC w1 = SIMD_ISA(vset_pair)(odd ? load_number_single(w[1] + 2 * j) : load_number_pair(w[1] + 2 * j));
+        const SIMD_VEC w2 = SIMD_ISA(vset_pair)(odd ? load_number_single(w[2] + 2 * j) : load_number_pair(w[2] + 2 * j));
+        const SIMD_VEC w3 = SIMD_ISA(vset_pair)(odd ? load_number_single(w[3] + 2 * j) : load_number_pair(w[3] + 2 * j));
+        acc[0][0] = SIMD_ISA(vadd)(acc[0][0], SIMD_ISA(vmadd)(pairs[j][0], w0));
+        acc[0][1] = SIMD_ISA(vadd)(acc[0][1], SIMD_ISA(vmadd)(pairs[j][1], w0));
+        acc[1][0] = SIMD_ISA(vadd)(acc[1][0], SIMD_ISA(vmadd)(pairs[j][0], w1));
+        acc[1][1] = SIMD_ISA(vadd)(acc[1][1], SIMD_ISA(vmadd)(pairs[j][1], w1));
+        acc[2][0] = SIMD_ISA(vadd)(acc[2][0], SIMD_ISA(vmadd)(pairs[j][0], w2));
+        acc[2][1] = SIMD_ISA(vadd)(acc[2][1], SIMD_ISA(vmadd)(pairs[j][1], w2));
+        acc[3][0] = SIMD_ISA(vadd)(acc[3][0], SIMD_ISA(vmadd)(pairs[j][0], w3));
+        acc[3][1] = SIMD_ISA(vadd)(acc[3][1], SIMD_ISA(vmadd)(pairs[j][1], w3));
+      }
+
+      for (f = 0; f < 4 && k + f < p->filters; f++) {
+        out = count < out_block ? partial_out : output + (k + f) * out_samples + (pool2 ? pos / 2 : pos);
+        if (pool2)
+          SIMD_ISA(vstore_requant_pool2)(out, acc[f][0], acc[f][1], p->requant_shift, bias[k + f], relu);
+        else
+          SIMD_ISA(vstore_requant)(out, acc[f][0], acc[f][1], p->requant_shift, bias[k + f], relu);
+        if (count < out_block)
+          memcpy(output + (k + f) * out_samples + (pool2 ? pos / 2 : pos), partial_out, count * sizeof(number_t));
+      }
+    }
+  }
+}
@@ -0,0 +1,392 @@
+/**
+  ******************************************************************************
+  * @file    conv1d_simd.h
+  * @version 1.0.0
+  * @date    17 october 2026
+  * @brief   SSE4.1/AVX2/portable int16 conv1d kernels, bit-exact with the generated scalar loops,
+ *          optionally fused with the max pooling layers around the conv
+  */
+
+#ifndef __CONV1D_SIMD_H__
+#define __CONV1D_SIMD_H__
+
+#ifndef SINGLE_FILE
+#include "number.h"
+#include "layer_params.h"
+#include "simd.h"
+#include "thread_pool.h"
+#include "maxpool1d_simd.h"
+#endif
+
+#ifdef CNN_SIMD
+
+#include <limits.h>
+
+#define CONV1D_SIMD_MAX_PAIRS   256 // input_channels * ceil(kernel_size / 2) interleaved window vectors, per tile
+#define CONV1D_SIMD_MAX_PARTIAL 256 // filters x blocks of a tile whose channels are split
+#define CONV1D_SIMD_MAX_STRIDE  16  // bounds the zero-padded copy used for the last block
+
+#ifndef CONV1D_TILE_L1
+#define CONV1D_TILE_L1 32768 // bytes of L1 data cache the default tiles are sized for
+#endif
+
+// Tile of conv p over blocks blocks of conv positions for vectors of lanes int32: the sizes of tile
+// (NULL for all zero) clamped to the shape and the stack buffers. The default is every channel, so
+// that the sums stay in registers, the most blocks whose windows take at most a quarter of
+// CONV1D_TILE_L1 and the most filters whose kernel slice takes at most half of it: the windows are
+// interleaved once for all the filters and the kernel slice is read from L1 for every block.
+static inline conv1d_tile_t conv1d_simd_tile(const conv1d_params_t *p, const conv1d_tile_t *tile, int blocks, int lanes) {
+  const int rows = p->input_channels * ((p->kernel_size + 1) / 2);
+  const int block_bytes = rows * 2 * lanes * (int)sizeof(int32_t); // windows of one block
+  const int filters = (p->filters + 3) / 4 * 4;
+  int f = tile != NULL ? tile->filters : 0;
+  int b = tile != NULL ? tile->blocks : 0;
+  int c = tile != NULL ? tile->channels : 0;
+  conv1d_tile_t t;
+
+  if (c <= 0 || c > p->input_channels)
+    c = p->input_channels;
+  if (b <= 0)
+    b = CONV1D_TILE_L1 / 4 / block_bytes;
+  if (b > blocks)
+    b = blocks;
+  if (b > CONV1D_SIMD_MAX_PAIRS / rows)
+    b = CONV1D_SIMD_MAX_PAIRS / rows;
+  if (b < 1)
+    b = 1;
+  if (f <= 0)
+    f = CONV1D_TILE_L1 / 2 / (c * p->kernel_size * (int)sizeof(number_t)) / 4 * 4;
+  f = (f + 3) / 4 * 4;
+  if (f > filters)
+    f = filters;
+  if (f < 4)
+    f = 4;
+  if (c < p->input_channels) {
+    if (f * b > CONV1D_SIMD_MAX_PARTIAL)
+      f = CONV1D_SIMD_MAX_PARTIAL / b / 4 * 4;
+    if (f < 4) {
+      f = 4;
+      b = CONV1D_SIMD_MAX_PARTIAL / 4;
+    }
+  }
+  t.filters = (unsigned short)f;
+  t.blocks = (unsigned short)b;
+  t.channels = (unsigned short)c;
+  return t;
+}
+
+#define SIMD_ISA(name) name##_portable
+#define SIMD_VEC cnn_vec_t
+#define SIMD_LANES 4
+#include "conv1d_simd_isa.h"
+#undef SIMD_ISA
+#undef SIMD_VEC
+#undef SIMD_LANES
+
+#ifdef CNN_SIMD_X86
+
+#pragma GCC push_options
+#pragma GCC target("sse4.1")
+#define SIMD_ISA(name) name##_sse41
+#define SIMD_VEC __m128i
+#define SIMD_LANES 4
+#include "conv1d_simd_isa.h"
+#undef SIMD_ISA
+#undef SIMD_VEC
+#undef SIMD_LANES
+#pragma GCC pop_options
+
+#pragma GCC push_options
+#pragma GCC target("avx2")
+#define SIMD_ISA(name) name##_avx2
+#define SIMD_VEC __m256i
+#define SIMD_LANES 8
+#include "conv1d_simd_isa.h"
+#undef SIMD_ISA
+#undef SIMD_VEC
+#undef SIMD_LANES
+#pragma GCC pop_options
+
+#endif//CNN_SIMD_X86
+
+// Blocks first_block .. end_block - 1 of the conv positions with the kernel of the running CPU
+static inline void conv1d_maxpool1d_simd_range(
+  const conv1d_params_t *p,
+  const number_t *input,
+  int raw_samples,
+  const number_t *kernel,
+  const number_t *bias,
+  int pool2,
+  int first_block,
+  int end_block,
+  const conv1d_tile_t *tile,
+  number_t *output) {
+#ifdef CNN_SIMD_X86
+  if (cnn_isa == CNN_ISA_AVX2) {
+    conv1d_maxpool1d_simd_avx2(p, input, raw_samples, kernel, bias, pool2, first_block, end_block, tile, output);
+    return;
+  }
+  if (cnn_isa == CNN_ISA_SSE41) {
+    conv1d_maxpool1d_simd_sse41(p, input, raw_samples, kernel, bias, pool2, first_block, end_block, tile, output);
+    return;
+  }
+#endif
+  conv1d_maxpool1d_simd_portable(p, input, raw_samples, kernel, bias, pool2, first_block, end_block, tile, output);
+}
+
+#ifdef CNN_THREADS
+
+// One layer split into filter_chunks x block_chunks tasks. Chunks of filters are multiples of the
+// 4 filters the kernels run together and chunks of positions whole blocks, so every output is
+// accumulated exactly as in the serial call.
+typedef struct {
+  const conv1d_params_t *p;
+  const number_t *input;
+  int raw_samples;
+  const number_t *kernel;
+  const number_t *bias;
+  int pool2;
+  const conv1d_tile_t *tile;
+  number_t *output;
+  int groups;        // groups of 4 filters
+  int blocks;        // blocks of conv positions
+  int filter_chunks;
+  int block_chunks;
+} conv1d_simd_job_t;
+
+static void conv1d_maxpool1d_simd_task(void *arg, unsigned int task) {
+  const conv1d_simd_job_t *job = (const conv1d_simd_job_t *)arg;
+  const int fc = task / job->block_chunks;
+  const int bc = task % job->block_chunks;
+  const int first_filter = 4 * (fc * job->groups / job->filter_chunks);
+  const int end_filter = 4 * ((fc + 1) * job->groups / job->filter_chunks);
+  const int out_samples = job->pool2 ? job->p->outsamples / 2 : job->p->outsamples;
+  conv1d_params_t sub = *job->p;
+
+  sub.filters = (end_filter < job->p->filters ? end_filter : job->p->filters) - first_filter;
+  conv1d_maxpool1d_simd_range(&sub, job->input, job->raw_samples,
+                              job->kernel + first_filter * sub.input_channels * sub.kernel_size,
+                              job->bias + first_filter, job->pool2,
+                              bc * job->blocks / job->block_chunks, (bc + 1) * job->blocks / job->block_chunks,
+                              job->tile, job->output + first_filter * out_samples);
+}
+
+// Runs the layer on the thread pool, returns 0 when it is not worth splitting. Output positions
+// are split first since every filter chunk interleaves its input window again.
+static inline int conv1d_maxpool1d_simd_parallel(
+  const conv1d_params_t *p,
+  const number_t *input,
+  int raw_samples,
+  const number_t *kernel,
+  const number_t *bias,
+  int pool2,
+  const conv1d_tile_t *tile,
+  number_t *output) {
+
+  const int threads = cnn_thread_pool_size();
+  const int block = cnn_isa == CNN_ISA_AVX2 ? 16 : 8;
+  const int conv_samples = pool2 ? 2 * (p->outsamples / 2) : p->outsamples;
+  conv1d_simd_job_t job;
+
+  if (threads <= 1)
+    return 0;
+  job.p = p;
+  job.input = input;
+  job.raw_samples = raw_samples;
+  job.kernel = kernel;
+  job.bias = bias;
+  job.pool2 = pool2;
+  job.tile = tile;
+  job.output = output;
+  job.groups = (p->filters + 3) / 4;
+  job.blocks = (conv_samples + block - 1) / block;
+  job.block_chunks = job.blocks < threads ? job.blocks : threads;
+  job.filter_chunks = (threads + job.block_chunks - 1) / job.block_chunks;
+  if (job.filter_chunks > job.groups)
+    job.filter_chunks = job.groups;
+  if (job.filter_chunks * job.block_chunks <= 1)
+    return 0;
+
+  cnn_thread_pool_run(conv1d_maxpool1d_simd_task, &job, job.filter_chunks * job.block_chunks);
+  return 1;
+}
+
+#endif//CNN_THREADS
+
+// Whether the vector kernels take conv p with these poolings: no zero padding, window and stride
+// within the buffers, pool 2 / stride 2 poolings whose shapes chain with the conv
+static inline int conv1d_simd_fits(
+  const maxpool1d_params_t *input_pool,
+  const conv1d_params_t *p,
+  const maxpool1d_params_t *output_pool) {
+
+  if (p->zeropadding_left != 0 || p->zeropadding_right != 0)
+    return 0;
+  if (p->input_channels * ((p->kernel_size + 1) / 2) > CONV1D_SIMD_MAX_PAIRS)
+    return 0;
+  if ((input_pool != NULL ? 2 : 1) * p->stride > CONV1D_SIMD_MAX_STRIDE)
+    return 0;
+  if (input_pool != NULL && (!maxpool1d_simd_pool2(input_pool) || input_pool->input_channels != p->input_channels
+                             || input_pool->pool_length != p->input_samples))
+    return 0;
+  if (output_pool != NULL && (!maxpool1d_simd_pool2(output_pool) || output_pool->input_channels != p->filters
+                              || output_pool->input_samples != p->outsamples))
+    return 0;
+  return 1;
+}
+
+// Runs conv p with the best kernel of the running CPU, fused with the max pooling input_pool
+// producing its input and/or the max pooling output_pool consuming its output (either may be
+// NULL) so that the pooled input and the conv output are never written. Returns 0 when the
+// caller has to fall back to its scalar loops: no vector ISA, zero padding, window or stride too
+// large, pooling other than pool 2 / stride 2 or whose shape does not chain with the conv.
+// Built with -DCNN_THREADS, the layer is split across the thread pool of thread_pool.h. tile gives
+// the cache tiles of the kernel, NULL for the defaults of conv1d_simd_tile().
+static inline int conv1d_maxpool1d_simd_direct(
+  const maxpool1d_params_t *input_pool,
+  const conv1d_params_t *p,
+  const maxpool1d_params_t *output_pool,
+  const conv1d_tile_t *tile,
+  const number_t *input,
+  const number_t *kernel,
+  const number_t *bias,
+  number_t *output) {
+
+  const int raw_samples = input_pool != NULL ? input_pool->input_samples : 0;
+  const int pool2 = output_pool != NULL;
+
+  if (!conv1d_simd_fits(input_pool, p, output_pool) || cnn_isa == CNN_ISA_SCALAR)
+    return 0;
+
+#ifdef CNN_THREADS
+  if (conv1d_maxpool1d_simd_parallel(p, input, raw_samples, kernel, bias, pool2, tile, output))
+    return 1;
+#endif
+  conv1d_maxpool1d_simd_range(p, input, raw_samples, kernel, bias, pool2, 0, INT_MAX, tile, output);
+  return 1;
+}
+
+// Phase streams and kernel of conv1d_maxpool1d_polyphase_simd(), kept on the stack (host only)
+#define CONV1D_POLYPHASE_MAX_INPUT   16384
+#define CONV1D_POLYPHASE_MAX_WEIGHTS 8192
+
+// Strided conv p run on its polyphase decomposition, so that each output reads contiguous samples
+// instead of a window every stride samples (a gather). Phases are taken two by two to keep the
+// tap pairs of the kernel: for an even stride, stream c * stride / 2 + ph / 2 holds the pairs
+// (x[c][m * stride + ph], x[c][m * stride + ph + 1]) at 2 m and runs as a stride 2 conv whose tap
+// pair j is (g[c][j * stride + ph], g[c][j * stride + ph + 1]). An odd stride gets one stream per
+// phase and a stride 1 conv. Taps past the kernel are 0 and the input max pooling, if any, is
+// applied before splitting the streams, so the outputs are bit-exact. Returns 0 when the
+// decomposition would be the input itself (stride 2, no input pooling) or does not fit.
+static inline int conv1d_maxpool1d_polyphase_simd(
+  const maxpool1d_params_t *input_pool,
+  const conv1d_params_t *p,
+  const maxpool1d_params_t *output_pool,
+  const conv1d_tile_t *tile,
+  const number_t *input,
+  const number_t *kernel,
+  const number_t *bias,
+  number_t *output) {
+
+  number_t pooled[CONV1D_POLYPHASE_MAX_INPUT];
+  number_t streams[CONV1D_POLYPHASE_MAX_INPUT];
+  number_t taps[CONV1D_POLYPHASE_MAX_WEIGHTS];
+  const int stride = p->stride;
+  const int width = stride % 2 == 0 ? 2 : 1;                      // phases per stream
+  const int phase_taps = (p->kernel_size + stride - 1) / stride;  // taps of the kernel per phase
+  const int rows = p->outsamples - 1 + phase_taps;                 // samples of each phase read by the conv
+  const int length = width * rows;                                 // samples per stream
+  const int streams_per_channel = stride / width;
+  const int channels = p->input_channels * streams_per_channel;
+  const int kernel_size = width * phase_taps;
+  const int full = p->input_samples / stride < rows ? p->input_samples / stride : rows; // rows inside the input
+  conv1d_params_t sub = *p;
+  const number_t *row;
+  number_t *stream;
+  int f, c, ph, m, e, j, t;
+
+  if (stride <= 1 || (stride == 2 && input_pool == NULL) || p->zeropadding_left != 0 || p->zeropadding_right != 0)
+    return 0;
+  if (channels * length > CONV1D_POLYPHASE_MAX_INPUT || p->input_samples > CONV1D_POLYPHASE_MAX_INPUT
+      || p->filters * channels * kernel_size > CONV1D_POLYPHASE_MAX_WEIGHTS)
+    return 0;
+  if (input_pool != NULL && (!maxpool1d_simd_pool2(input_pool) || input_pool->input_channels != p->input_channels
+                             || input_pool->pool_length != p->input_samples))
+    return 0;
+
+  for (c = 0; c < p->input_channels; c++) {
+    if (input_pool != NULL) {
+      maxpool1d_simd_pool2_row(input + c * input_pool->input_samples, pooled, p->input_samples, 0);
+      row = pooled;
+    } else {
+      row = input + c * p->input_samples;
+    }
+
+    // Row m of stride samples goes to sample m of every stream of the channel, the rows past the
+    // end of the input are zero
+    stream = streams + c * streams_per_channel * length;
+    if (width == 2) {
+      for (m = 0; m < full; m++)
+        for (ph = 0; ph < streams_per_channel; ph++)
+          memcpy(stream + ph * length + 2 * m, row + m * stride + 2 * ph, 2 * sizeof(number_t));
+    } else {
+      for (m = 0; m < full; m++)
+        for (ph = 0; ph < streams_per_channel; ph++)
+          stream[ph * length + m] = row[m * stride + ph];
+    }
+    for (ph = 0; ph < streams_per_channel; ph++)
+      for (e = width * full; e < length; e++) {
+        t = (e / width) * stride + ph * width + e % width;
+        stream[ph * length + e] = t < p->input_samples ? row[t] : 0;
+      }
+  }
+
+  for (f = 0; f < p->filters; f++)
+    for (c = 0; c < p->input_channels; c++)
+      for (ph = 0; ph < stride; ph += width)
+        for (j = 0; j < phase_taps; j++)
+          for (e = 0; e < width; e++) {
+            t = j * stride + ph + e;
+            taps[((f * channels + (c * stride + ph) / width) * phase_taps + j) * width + e] =
+              t < p->kernel_size ? kernel[(f * p->input_channels + c) * p->kernel_size + t] : 0;
+          }
+
+  sub.input_channels = channels;
+  sub.input_samples = length;
+  sub.kernel_size = kernel_size;
+  sub.stride = width;
+  return conv1d_maxpool1d_simd_direct(NULL, &sub, output_pool, tile, streams, taps, bias, output);
+}
+
+// Built with -DCONV1D_POLYPHASE, strided convs run as their polyphase decomposition
+static inline int conv1d_maxpool1d_simd(
+  const maxpool1d_params_t *input_pool,
+  const conv1d_params_t *p,
+  const maxpool1d_params_t *output_pool,
+  const conv1d_tile_t *tile,
+  const number_t *input,
+  const number_t *kernel,
+  const number_t *bias,
+  number_t *output) {
+#ifdef CONV1D_POLYPHASE
+  if (p->stride > 1 && cnn_isa != CNN_ISA_SCALAR
+      && conv1d_maxpool1d_polyphase_simd(input_pool, p, output_pool, tile, input, kernel, bias, output))
+    return 1;
+#endif
+  return conv1d_maxpool1d_simd_direct(input_pool, p, output_pool, tile, input, kernel, bias, output);
+}
+
+// The conv alone
+static inline int conv1d_simd(
+  const conv1d_params_t *p,
+  const conv1d_tile_t *tile,
+  const number_t *input,
+  const number_t *kernel,
+  const number_t *bias,
+  number_t *output) {
+  return conv1d_maxpool1d_simd(NULL, p, NULL, tile, input, kernel, bias, output);
+}
+
+#endif//CNN_SIMD
+
+#endif//__CONV1D_SIMD_H__
@@ -0,0 +1,220 @@
+/**
+  ******************************************************************************
+  * @file    conv1d_simd_isa.h
+  * @version 1.0.0
+  * @date    17 october 2026
+  * @brief   Vectorized conv1d body, included once per ISA by conv1d_simd.h
+  *
+  * Expects SIMD_ISA(name) to append the ISA suffix, SIMD_VEC the vector type and
+  * SIMD_LANES its number of int32 lanes. Output positions are vectorized: one madd
+  * multiplies two consecutive taps of 2*SIMD_LANES positions by a broadcast weight pair.
+  */
+
+// Sums channels [c0, c0 + nchannels) of filters [k0, k1) over one block of output positions
+// whose interleaved input window, from channel c0, is in pairs; only the first count outputs are
+// stored. With pool2 the 2*SIMD_LANES positions of the block are max pooled two by two into
+// SIMD_LANES samples of rows of out_samples. When the channels are split in several tiles the
+// sums of each filter go through partial[f - k0], from the first tile to the last which stores
+// them; partial is NULL for a single tile.
+static inline void SIMD_ISA(conv1d_simd_block)(
+  const conv1d_params_t *p,
+  SIMD_VEC pairs[][2],
+  const number_t *kernel,
+  const number_t *bias,
+  number_t *output,
+  int out_samples,
+  int pool2,
+  int pos,
+  int count,
+  int k0,
+  int k1,
+  int c0,
+  int nchannels,
+  SIMD_VEC partial[][2],
+  int first,
+  int last) {
+
+  const int block = pool2 ? SIMD_LANES : 2 * SIMD_LANES;
+  const int full_pairs = p->kernel_size / 2;
+  const int npairs = (p->kernel_size + 1) / 2;      // odd kernels end with a (tap, 0) pair
+  const int filter_stride = p->input_channels * p->kernel_size;
+  const int relu = p->activation == ACTIVATION_KIND_RELU;
+  number_t partial_out[2 * SIMD_LANES];
+  number_t *out;
+  int k, z, j, r, f;
+
+  // Four filters at a time so that each window vector is loaded once for 8 accumulators
+  for (k = k0; k < k1; k += 4) {
+    const int nfilters = k1 - k < 4 ? k1 - k : 4;
+    const number_t *w = kernel + k * filter_stride + c0 * p->kernel_size;
+    SIMD_VEC acc[4][2];
+
+    for (f = 0; f < 4; f++) {
+      if (first || f >= nfilters) {
+        acc[f][0] = acc[f][1] = SIMD_ISA(vzero)();
+      } else {
+        acc[f][0] = partial[k - k0 + f][0];
+        acc[f][1] = partial[k - k0 + f][1];
+      }
+    }
+
+    if (nfilters == 4) {
+      for (z = 0, r = 0; z < nchannels; z++, w += p->kernel_size) {
+        for (j = 0; j < npairs; j++, r++) {
+          SIMD_VEC w0, w1, w2, w3;
+          if (j < full_pairs) {
+            w0 = SIMD_ISA(vset_pair)(load_number_pair(w + 2 * j));
+            w1 = SIMD_ISA(vset_pair)(load_number_pair(w + filter_stride + 2 * j));
+            w2 = SIMD_ISA(vset_pair)(load_number_pair(w + 2 * filter_stride + 2 * j));
+            w3 = SIMD_ISA(vset_pair)(load_number_pair(w + 3 * filter_stride + 2 * j));
+          } else {
+            w0 = SIMD_ISA(vset_pair)(load_number_single(w + 2 * j));
+            w1 = SIMD_ISA(vset_pair)(load_number_single(w + filter_stride + 2 * j));
+            w2 = SIMD_ISA(vset_pair)(load_number_single(w + 2 * filter_stride + 2 * j));
+            w3 = SIMD_ISA(vset_pair)(load_number_single(w + 3 * filter_stride + 2 * j));
+          }
+          acc[0][0] = SIMD_ISA(vadd)(acc[0][0], SIMD_ISA(vmadd)(pairs[r][0], w0));
+          acc[0][1] = SIMD_ISA(vadd)(acc[0][1], SIMD_ISA(vmadd)(pairs[r][1], w0));
+          acc[1][0] = SIMD_ISA(vadd)(acc[1][0], SIMD_ISA(vmadd)(pairs[r][0], w1));
+          acc[1][1] = SIMD_ISA(vadd)(acc[1][1], SIMD_ISA(vmadd)(pairs[r][1], w1));
+          acc[2][0] = SIMD_ISA(vadd)(acc[2][0], SIMD_ISA(vmadd)(pairs[r][0], w2));
+          acc[2][1] = SIMD_ISA(vadd)(acc[2][1], SIMD_ISA(vmadd)(pairs[r][1], w2));
+          acc[3][0] = SIMD_ISA(vadd)(acc[3][0], SIMD_ISA(vmadd)(pairs[r][0], w3));
+          acc[3][1] = SIMD_ISA(vadd)(acc[3][1], SIMD_ISA(vmadd)(pairs[r][1], w3));
+        }
+      }
+    } else {
+      for (f = 0; f < nfilters; f++) {
+        w = kernel + (k + f) * filter_stride + c0 * p->kernel_size;
+        for (z = 0, r = 0; z < nchannels; z++, w += p->kernel_size) {
+          for (j = 0; j < npairs; j++, r++) {
+            SIMD_VEC w0 = SIMD_ISA(vset_pair)(j < full_pairs ? load_number_pair(w + 2 * j) : load_number_single(w + 2 * j));
+            acc[f][0] = SIMD_ISA(vadd)(acc[f][0], SIMD_ISA(vmadd)(pairs[r][0], w0));
+            acc[f][1] = SIMD_ISA(vadd)(acc[f][1], SIMD_ISA(vmadd)(pairs[r][1], w0));
+          }
+        }
+      }
+    }
+
+    for (f = 0; f < nfilters; f++) {
+      if (!last) {
+        partial[k - k0 + f][0] = acc[f][0];
+        partial[k - k0 + f][1] = acc[f][1];
+        continue;
+      }
+      out = output + (k + f) * out_samples + pos;
+      if (count < block)
+        out = partial_out;
+      if (pool2)
+        SIMD_ISA(vstore_requant_pool2)(out, acc[f][0], acc[f][1], p->requant_shift, bias[k + f], relu);
+      else
+        SIMD_ISA(vstore_requant)(out, acc[f][0], acc[f][1], p->requant_shift, bias[k + f], relu);
+      if (count < block)
+        memcpy(output + (k + f) * out_samples + pos, partial_out, count * sizeof(number_t));
+    }
+  }
+}
+
+// Interleaved input windows of the nblocks blocks of 2*SIMD_LANES conv positions from block first:
+// pairs[(b * input_channels + z) * npairs + j] holds the tap pair j of channel z for the positions
+// of block first + b, read through the pool 2 / stride 2 max pooling of
+// input[input_channels][raw_samples] when raw_samples != 0. The last block may run past the end of
+// the rows, its samples are then read from a zero-padded copy.
+static inline void SIMD_ISA(conv1d_simd_windows)(
+  const conv1d_params_t *p,
+  const number_t *input,
+  int raw_samples,
+  int first,
+  int nblocks,
+  SIMD_VEC pairs[][2]) {
+
+  const int block = 2 * SIMD_LANES;
+  const int npairs = (p->kernel_size + 1) / 2;
+  const int row = raw_samples ? raw_samples : p->input_samples;
+  const int step = raw_samples ? 2 * p->stride : p->stride;
+  const int span = step * (block - 1) + (raw_samples ? 4 : 2); // samples touched by the vload_pairs
+  SIMD_VEC a0, a1, b0, b1;
+  number_t padded[CONV1D_SIMD_MAX_STRIDE * (2 * SIMD_LANES - 1) + 4];
+  const number_t *src;
+  int b, pos, z, j, r, start, avail;
+
+  for (b = 0, r = 0; b < nblocks; b++) {
+    pos = (first + b) * block;
+    for (z = 0; z < p->input_channels; z++) {
+      for (j = 0; j < npairs; j++, r++) {
+        start = pos * p->stride + 2 * j;
+        if (raw_samples)
+          start *= 2;
+        avail = row - start;
+        src = input + z * row + start;
+        if (avail < span) {
+          memset(padded, 0, sizeof(padded));
+          memcpy(padded, src, avail * sizeof(number_t));
+          src = padded;
+        }
+        SIMD_ISA(vload_pairs)(src, step, &pairs[r][0], &pairs[r][1]);
+        if (raw_samples) {
+          SIMD_ISA(vload_pairs)(src + 2, step, &b0, &b1);
+          a0 = pairs[r][0];
+          a1 = pairs[r][1];
+          pairs[r][0] = SIMD_ISA(vmax_pairs)(a0, b0);
+          pairs[r][1] = SIMD_ISA(vmax_pairs)(a1, b1);
+        }
+      }
+    }
+  }
+}
+
+// Conv of p, optionally reading its input through a pool 2 / stride 2 max pooling of
+// input[input_channels][raw_samples] (raw_samples != 0) and/or max pooling its output with
+// pool 2 / stride 2 (pool2). Pooled samples are computed while interleaving the window and
+// pooled outputs on the accumulators, neither is ever stored. Only the blocks of 2*SIMD_LANES
+// conv positions first_block .. end_block - 1 are computed, in tiles of tile->blocks blocks whose
+// windows are interleaved once; each tile runs the filters tile->filters at a time and the
+// channels tile->channels at a time, so that the kernel and window slices of the inner loops
+// stay in cache (conv1d_simd_tile()).
+static void SIMD_ISA(conv1d_maxpool1d_simd)(
+  const conv1d_params_t *p,
+  const number_t *input,    // [input_channels][input_samples], [input_channels][raw_samples] if pooled
+  int raw_samples,
+  const number_t *kernel,   // [filters][input_channels][kernel_size]
+  const number_t *bias,     // [filters]
+  int pool2,
+  int first_block,
+  int end_block,
+  const conv1d_tile_t *tile,
+  number_t *output) {       // [filters][outsamples], [filters][outsamples / 2] if pool2
+
+  const int block = 2 * SIMD_LANES;                 // conv positions per iteration
+  const int npairs = (p->kernel_size + 1) / 2;
+  const int rows = p->input_channels * npairs;      // window vectors of one block
+  const int out_samples = pool2 ? p->outsamples / 2 : p->outsamples;
+  const int conv_samples = pool2 ? 2 * out_samples : p->outsamples;
+  const int blocks = (conv_samples + block - 1) / block;
+  const int end = end_block < blocks ? end_block : blocks;
+  const conv1d_tile_t t = conv1d_simd_tile(p, tile, end - first_block, SIMD_LANES);
+  SIMD_VEC pairs[CONV1D_SIMD_MAX_PAIRS][2];
+  SIMD_VEC partial[CONV1D_SIMD_MAX_PARTIAL][2];
+  int first, nblocks, b, pos, k0, k1, c0, nchannels, count;
+
+  for (first = first_block; first < end; first += t.blocks) {
+    nblocks = end - first < t.blocks ? end - first : t.blocks;
+
+    // Interleave the input windows of the tile once, they are reused by every filter
+    SIMD_ISA(conv1d_simd_windows)(p, input, raw_samples, first, nblocks, pairs);
+
+    for (k0 = 0; k0 < p->filters; k0 += t.filters) {
+      k1 = p->filters - k0 < t.filters ? p->filters : k0 + t.filters;
+      for (c0 = 0; c0 < p->input_channels; c0 += t.channels) {
+        nchannels = p->input_channels - c0 < t.channels ? p->input_channels - c0 : t.channels;
+        for (b = 0; b < nblocks; b++) {
+          pos = (first + b) * block;
+          count = conv_samples - pos < block ? conv_samples - pos : block;
+          SIMD_ISA(conv1d_simd_block)(p, pairs + b * rows + c0 * npairs, kernel, bias, output, out_samples, pool2,
+                                      pool2 ? pos / 2 : pos, pool2 ? count / 2 : count, k0, k1, c0, nchannels,
+                                      partial + b * t.filters, c0 == 0, c0 + nchannels == p->input_channels);
+        }
+      }
+    }
+  }
+}
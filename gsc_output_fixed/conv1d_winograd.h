@@ -0,0 +1,202 @@
+/**
+  ******************************************************************************
+  * @file    conv1d_winograd.h
+  * @version 1.0.0
+  * @date    17 october 2026
+  * @brief   Winograd minimal filtering for the kernel 3 conv1d layers, bit-exact with the
+  *          generated loops
+  *
+  * Outputs are computed two at a time (one tile), from the kernels precomputed by
+  * tools/winograd_weights.py into weights/conv1d_*_winograd.c:
+  *  stride 1: F(2,3), U = {2 g0, g0 + g1 + g2, g0 - g1 + g2, 2 g2} and
+  *            V = {d0 - d2, d1 + d2, d2 - d1, d1 - d3} for the input d0..d3 of the tile,
+  *            2 y0 = U0 V0 + U1 V1 + U2 V2, 2 y1 = U1 V1 - U2 V2 - U3 V3: 4 products instead of 6.
+  *  stride 2: the even taps g0, g2 run as F(2,2) on the even samples e0..e2 of the tile and g1
+  *            on the odd samples o0, o1, U = {g0 + g2, g0, g2, g1}:
+  *            y0 = U0 e1 + U1 (e0 - e1) + U3 o0, y1 = U0 e1 + U2 (e2 - e1) + U3 o1: 5 products
+  *            instead of 6.
+  * Products are summed over the input channels in 64-bit accumulators so no intermediate sum can
+  * overflow, or in 32-bit ones when the accum_plan_t of the layer (tools/accum_plan.py) proves
+  * that they fit. The exact sum is then narrowed to long_number_t, which gives the same bits as
+  * the direct loops.
+  * Enabled at build time with -DCONV1D_WINOGRAD for the layers that support it.
+  */
+
+#ifndef __CONV1D_WINOGRAD_H__
+#define __CONV1D_WINOGRAD_H__
+
+#ifndef SINGLE_FILE
+#include "number.h"
+#include "layer_params.h"
+#include "requant_simd.h"
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define CONV1D_WINOGRAD_MAX_CHANNELS 128 // transformed input of one tile, kept on the stack
+#define CONV1D_WINOGRAD_MAX_FILTERS  128 // accumulators of one tile, requantized together
+#define CONV1D_WINOGRAD_TAPS         4   // transformed kernel values per filter and input channel
+
+// Transformed input of the tile starting at x (stride 1: 4 samples, stride 2: 5 samples)
+static inline void conv1d_winograd_input(const number_t *x, int stride, long_number_t v[5]) {
+  if (stride == 1) {
+    v[0] = x[0] - x[2];
+    v[1] = x[1] + x[2];
+    v[2] = x[2] - x[1];
+    v[3] = x[1] - x[3];
+  } else {
+    v[0] = x[2];
+    v[1] = x[0] - x[2];
+    v[2] = x[4] - x[2];
+    v[3] = x[1];
+    v[4] = x[3];
+  }
+}
+
+// Outputs y[0], y[1] of one tile for the transformed kernel u of a filter, summed in int32: only
+// for layers whose plan bounds the sums to 32 bits
+static inline void conv1d_winograd_tile32(const long_number_t v[][5], const number_t *u, int channels, int stride, long_number_t y[2]) {
+  long_number_t m0 = 0, m1 = 0, m2 = 0, m3 = 0, m4 = 0;
+  int z;
+
+  if (stride == 1) {
+    for (z = 0; z < channels; z++, u += CONV1D_WINOGRAD_TAPS) {
+      m0 += v[z][0] * u[0];
+      m1 += v[z][1] * u[1];
+      m2 += v[z][2] * u[2];
+      m3 += v[z][3] * u[3];
+    }
+    y[0] = (m0 + m1 + m2) >> 1; // even: G is scaled by 2
+    y[1] = (m1 - m2 - m3) >> 1;
+  } else {
+    for (z = 0; z < channels; z++, u += CONV1D_WINOGRAD_TAPS) {
+      m0 += v[z][0] * u[0];
+      m1 += v[z][1] * u[1];
+      m2 += v[z][2] * u[2];
+      m3 += v[z][3] * u[3];
+      m4 += v[z][4] * u[3];
+    }
+    y[0] = m0 + m1 + m3;
+    y[1] = m0 + m2 + m4;
+  }
+}
+
+// Same in int64, which cannot overflow for any int16 kernel and input
+static inline void conv1d_winograd_tile64(const long_number_t v[][5], const number_t *u, int channels, int stride, long_number_t y[2]) {
+  int64_t m0 = 0, m1 = 0, m2 = 0, m3 = 0, m4 = 0;
+  int z;
+
+  if (stride == 1) {
+    for (z = 0; z < channels; z++, u += CONV1D_WINOGRAD_TAPS) {
+      m0 += (int64_t)v[z][0] * u[0];
+      m1 += (int64_t)v[z][1] * u[1];
+      m2 += (int64_t)v[z][2] * u[2];
+      m3 += (int64_t)v[z][3] * u[3];
+    }
+    y[0] = (long_number_t)((m0 + m1 + m2) >> 1); // even: G is scaled by 2
+    y[1] = (long_number_t)((m1 - m2 - m3) >> 1);
+  } else {
+    for (z = 0; z < channels; z++, u += CONV1D_WINOGRAD_TAPS) {
+      m0 += (int64_t)v[z][0] * u[0];
+      m1 += (int64_t)v[z][1] * u[1];
+      m2 += (int64_t)v[z][2] * u[2];
+      m3 += (int64_t)v[z][3] * u[3];
+      m4 += (int64_t)v[z][4] * u[3];
+    }
+    y[0] = (long_number_t)(m0 + m1 + m3);
+    y[1] = (long_number_t)(m0 + m2 + m4);
+  }
+}
+
+// Conv p (kernel 3, stride 1 or 2) from its transformed kernel, optionally max pooled by
+// output_pool (may be NULL; pool 2 / stride 2 only, so that a tile is one pooling window).
+// plan (may be NULL) selects the 32-bit sums when its winograd_bits allow them.
+// Returns 0 when the layer is not supported, the caller then runs its direct loops.
+static inline int conv1d_maxpool1d_winograd(
+  const conv1d_params_t *p,
+  const maxpool1d_params_t *output_pool,
+  const accum_plan_t *plan,
+  const number_t *input,    // [input_channels][input_samples]
+  const number_t *kernel,   // [filters][input_channels][CONV1D_WINOGRAD_TAPS]
+  const number_t *bias,     // [filters]
+  number_t *output) {       // [filters][outsamples], [filters][outsamples / 2] with output_pool
+
+  long_number_t v[CONV1D_WINOGRAD_MAX_CHANNELS][5];
+  long_number_t acc[2][CONV1D_WINOGRAD_MAX_FILTERS]; // [output of the tile][filter]
+  number_t requantized[2][CONV1D_WINOGRAD_MAX_FILTERS];
+  const int channels = p->input_channels;
+  const int stride = p->stride;
+  const int tiles = p->outsamples / 2;
+  const int pool2 = output_pool != NULL;
+  const int out_samples = pool2 ? tiles : p->outsamples;
+  const int relu = p->activation == ACTIVATION_KIND_RELU;
+  const int narrow = plan != NULL && plan->winograd_bits != 0 && plan->winograd_bits <= 32;
+  long_number_t y[2];
+  int64_t m0;
+  const number_t *u;
+  int t, k, z, i, n;
+
+  if (FIXED_POINT == 0) // the halving of F(2,3) is integer arithmetic, floating point keeps the direct loops
+    return 0;
+  if (p->zeropadding_left != 0 || p->zeropadding_right != 0 || p->kernel_size != 3)
+    return 0;
+  if ((stride != 1 && stride != 2) || channels > CONV1D_WINOGRAD_MAX_CHANNELS || p->filters > CONV1D_WINOGRAD_MAX_FILTERS)
+    return 0;
+  if (output_pool != NULL && (output_pool->pool_size != 2 || output_pool->pool_stride != 2
+                              || output_pool->activation != ACTIVATION_KIND_LINEAR
+                              || output_pool->input_channels != p->filters || output_pool->input_samples != p->outsamples))
+    return 0;
+
+  // The input of each tile is transformed once, it is reused by every filter
+  for (t = 0; t < tiles; t++) {
+    for (z = 0; z < channels; z++)
+      conv1d_winograd_input(input + z * p->input_samples + 2 * t * stride, stride, v[z]);
+
+    for (k = 0; k < p->filters; k++) {
+      u = kernel + k * channels * CONV1D_WINOGRAD_TAPS;
+      if (narrow)
+        conv1d_winograd_tile32((const long_number_t (*)[5])v, u, channels, stride, y);
+      else
+        conv1d_winograd_tile64((const long_number_t (*)[5])v, u, channels, stride, y);
+
+      // The max pooling is taken before the requantization, which is monotonic
+      if (pool2 && y[1] > y[0])
+        y[0] = y[1];
+      acc[0][k] = y[0];
+      acc[1][k] = y[1];
+    }
+
+    // Every filter of the tile at once, one bias each
+    for (i = 0; i < (pool2 ? 1 : 2); i++) {
+      requant_simd_row(requantized[i], acc[i], p->filters, p->requant_shift, bias, 1, relu);
+      n = pool2 ? t : 2 * t + i;
+      for (k = 0; k < p->filters; k++)
+        output[k * out_samples + n] = requantized[i][k];
+    }
+  }
+
+  // Odd number of outputs without pooling: the last one is computed directly, the original taps
+  // are recovered from the transformed kernel
+  if (!pool2 && (p->outsamples & 1)) {
+    n = p->outsamples - 1;
+    for (k = 0; k < p->filters; k++) {
+      u = kernel + k * channels * CONV1D_WINOGRAD_TAPS;
+      m0 = 0;
+      for (z = 0; z < channels; z++, u += CONV1D_WINOGRAD_TAPS) {
+        const number_t *x = input + z * p->input_samples + n * stride;
+        if (stride == 1)
+          m0 += (int64_t)u[0] * x[0] + (int64_t)(u[1] - u[2]) * x[1] + (int64_t)u[3] * x[2];
+        else
+          m0 += (int64_t)u[1] * x[0] + (int64_t)u[3] * x[1] + (int64_t)u[2] * x[2];
+      }
+      acc[0][k] = (long_number_t)(stride == 1 ? m0 >> 1 : m0);
+    }
+    requant_simd_row(requantized[0], acc[0], p->filters, p->requant_shift, bias, 1, relu);
+    for (k = 0; k < p->filters; k++)
+      output[k * out_samples + n] = requantized[0][k];
+  }
+  return 1;
+}
+
+#endif//__CONV1D_WINOGRAD_H__
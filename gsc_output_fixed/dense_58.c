@@ -9,12 +9,21 @@
 
 #ifndef SINGLE_FILE
 #include "number.h"
+#include "requant_simd.h"
+#include "ternary.h"
+#include "int8.h"
+#include "sparse.h"
+#include "dense_gemm.h"
 #endif
 
 #define INPUT_SAMPLES 128
 #define FC_UNITS 40
 #define ACTIVATION_LINEAR
 
+#ifndef DENSE_58_REQUANT_SHIFT
+#define DENSE_58_REQUANT_SHIFT FIXED_POINT // input + weight - output fractional bits, per layer with -DCNN_LAYER_FORMATS
+#endif
+
 typedef number_t dense_58_output_type[FC_UNITS];
 
 static inline void dense_58(
@@ -25,31 +34,41 @@ static inline void dense_58(
 
 	number_t output[FC_UNITS]) {			                // OUT
 
-  unsigned short k, z; 
-  long_number_t output_acc; 
-
-  for (k = 0; k < FC_UNITS; k++) { 
-    output_acc = 0; 
-    for (z = 0; z < INPUT_SAMPLES; z++) 
-      output_acc = output_acc + ( kernel[k][z] * input[z] ); 
-
-    output_acc = scale_number_t(output_acc);
-
-    output_acc = output_acc + bias[k]; 
+  long_number_t output_acc[DENSE_GEMM_LDACC(FC_UNITS)]; 
 
+#ifdef DENSE_58_TERNARY
+  // -DCNN_TERNARY: sign-select kernel on the ternary weights of weights/ternary.c
+  dense_ternary(&dense_58_ternary, INPUT_SAMPLES, FC_UNITS, input, output_acc);
+  (void)kernel;
+#elif defined(DENSE_58_INT8)
+#if INPUT_SAMPLES > INT8_MAX_ROW
+#error "-DCNN_INT8: the input of dense_58 does not fit the kernel of int8.h"
+#endif
+  // -DCNN_INT8: int8 kernel on the weights and input quantization of weights/int8.c
+  dense_int8(&dense_58_int8, INPUT_SAMPLES, FC_UNITS, input, output_acc);
+  (void)kernel;
+#elif defined(DENSE_58_SPARSE)
+#if INPUT_SAMPLES % 2
+#error "-DCNN_SPARSE: the vector kernels of sparse.h load whole input pairs, prune dense layers of even inputs"
+#endif
+  // -DCNN_SPARSE: zero-skipping kernel on the block-sparse weights of weights/sparse.c
+  dense_sparse(&dense_58_sparse, INPUT_SAMPLES, FC_UNITS, input, output_acc);
+  (void)kernel;
+#elif defined(DENSE_58_PANELS)
+  // GEMV on the packed panels of weights/dense_58_panels.c
+  dense_gemm(&kernel[0][0], &dense_58_panels[0][0][0], INPUT_SAMPLES, FC_UNITS, 1, input, INPUT_SAMPLES, output_acc, DENSE_GEMM_LDACC(FC_UNITS));
+#else
+  dense_gemm(&kernel[0][0], NULL, INPUT_SAMPLES, FC_UNITS, 1, input, INPUT_SAMPLES, output_acc, DENSE_GEMM_LDACC(FC_UNITS));
+#endif
 
-    // Activation function
+  // Activation function
 #ifdef ACTIVATION_LINEAR
-    // Linear (MEANS NONE)
-    output[k] = clamp_to_number_t(output_acc);
+  // Linear (MEANS NONE)
+  requant_simd_row(output, output_acc, FC_UNITS, DENSE_58_REQUANT_SHIFT, bias, 1, 0);
 #elif defined(ACTIVATION_RELU)
-    // ReLU
-    if (output_acc < 0)
-      output[k] = 0;
-    else
-      output[k] = clamp_to_number_t(output_acc);
+  // ReLU
+  requant_simd_row(output, output_acc, FC_UNITS, DENSE_58_REQUANT_SHIFT, bias, 1, 1);
 #endif
-  }
 }
 
 #undef INPUT_SAMPLES
@@ -0,0 +1,131 @@
+/**
+  ******************************************************************************
+  * @file    dense_gemm.h
+  * @version 1.0.0
+  * @date    17 october 2026
+  * @brief   Register-blocked int16 GEMM of the dense layers over a batch, GEMV for one input
+  *
+  * acc[b][u] = sum_z kernel[u][z] * input[b][z]. The vector kernels read the weights packed
+  * offline in panels of DENSE_PANEL_UNITS units (tools/dense_panels.py, weights/dense_<n>_panels.c):
+  * panel p holds, for each input pair q, the int16 pairs (kernel[u][2q], kernel[u][2q + 1]) of its
+  * units u = p * DENSE_PANEL_UNITS + r, zero past the last unit and the last input. madd of a
+  * vector of these pairs with the input pair of one row broadcast adds to SIMD_LANES units at once,
+  * with no horizontal sum: the microkernel keeps 2 vectors of units x DENSE_GEMM_ROWS rows of
+  * accumulators in registers and loads each weight vector once for the rows. The sums are those of
+  * the generated loops, in int32 (tools/accum_plan.py proves they fit), so the results and the
+  * requantization that follows are unchanged.
+  */
+
+#ifndef __DENSE_GEMM_H__
+#define __DENSE_GEMM_H__
+
+#ifndef SINGLE_FILE
+#include "number.h"
+#include "simd.h"
+#include "dsp.h"
+#endif
+
+#define DENSE_PANEL_UNITS 8 // units per panel, a multiple of the int32 lanes of every ISA
+#define DENSE_GEMM_ROWS   4 // batch rows per microkernel call
+
+// Accumulators of a dense layer per row: its units rounded up to the panels, the padded units are
+// written by the vector kernels
+#define DENSE_GEMM_LDACC(units) (((units) + DENSE_PANEL_UNITS - 1) / DENSE_PANEL_UNITS * DENSE_PANEL_UNITS)
+
+#ifdef CNN_SIMD
+
+#define SIMD_ISA(name) name##_portable
+#define SIMD_VEC cnn_vec_t
+#define SIMD_LANES 4
+#include "dense_gemm_isa.h"
+#undef SIMD_ISA
+#undef SIMD_VEC
+#undef SIMD_LANES
+
+#ifdef CNN_SIMD_X86
+
+#pragma GCC push_options
+#pragma GCC target("sse4.1")
+#define SIMD_ISA(name) name##_sse41
+#define SIMD_VEC __m128i
+#define SIMD_LANES 4
+#include "dense_gemm_isa.h"
+#undef SIMD_ISA
+#undef SIMD_VEC
+#undef SIMD_LANES
+#pragma GCC pop_options
+
+#pragma GCC push_options
+#pragma GCC target("avx2")
+#define SIMD_ISA(name) name##_avx2
+#define SIMD_VEC __m256i
+#define SIMD_LANES 8
+#include "dense_gemm_isa.h"
+#undef SIMD_ISA
+#undef SIMD_VEC
+#undef SIMD_LANES
+#pragma GCC pop_options
+
+#endif//CNN_SIMD_X86
+
+#endif//CNN_SIMD
+
+// acc[b * ldacc + u] for the n rows input + b * ldin of a dense layer, ldacc at least
+// DENSE_GEMM_LDACC(units). With the kernel of the running CPU on panels, the packed kernel (NULL
+// when the layer has none), else the DSP kernel or the generated loops on kernel[units][inputs].
+static inline void dense_gemm(
+  const number_t *kernel,
+  const number_t *panels,
+  int inputs,
+  int units,
+  int n,
+  const number_t *input,
+  int ldin,
+  long_number_t *acc,
+  int ldacc) {
+
+  int b, k, z;
+
+#ifdef CNN_SIMD_X86
+  if (panels != NULL && cnn_isa == CNN_ISA_AVX2) {
+    if (n == 1)
+      dense_gemv_avx2(panels, inputs, units, input, acc);
+    else
+      dense_gemm_avx2(panels, inputs, units, n, input, ldin, acc, ldacc);
+    return;
+  }
+  if (panels != NULL && cnn_isa == CNN_ISA_SSE41) {
+    if (n == 1)
+      dense_gemv_sse41(panels, inputs, units, input, acc);
+    else
+      dense_gemm_sse41(panels, inputs, units, n, input, ldin, acc, ldacc);
+    return;
+  }
+#endif
+#ifdef CNN_SIMD
+  if (panels != NULL && cnn_isa == CNN_ISA_PORTABLE) {
+    if (n == 1)
+      dense_gemv_portable(panels, inputs, units, input, acc);
+    else
+      dense_gemm_portable(panels, inputs, units, n, input, ldin, acc, ldacc);
+    return;
+  }
+#else
+  (void)panels;
+#endif
+#ifdef CNN_DSP
+  // SMLAD kernel of dsp.h on kernel[units][inputs], one row at a time
+  for (b = 0; b < n; b++)
+    dense_dsp(kernel, inputs, units, input + b * ldin, acc + b * ldacc);
+  return;
+#endif
+  for (b = 0; b < n; b++) {
+    for (k = 0; k < units; k++) {
+      acc[b * ldacc + k] = 0;
+      for (z = 0; z < inputs; z++)
+        acc[b * ldacc + k] = acc[b * ldacc + k] + ( kernel[k * inputs + z] * input[b * ldin + z] );
+    }
+  }
+}
+
+#endif//__DENSE_GEMM_H__
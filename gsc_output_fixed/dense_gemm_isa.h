@@ -0,0 +1,156 @@
+/**
+  ******************************************************************************
+  * @file    dense_gemm_isa.h
+  * @version 1.0.0
+  * @date    17 october 2026
+  * @brief   Dense GEMM microkernel and GEMV on packed panels, included once per ISA by dense_gemm.h
+  *
+  * Expects SIMD_ISA(name) to append the ISA suffix, SIMD_VEC the vector type and SIMD_LANES
+  * its number of int32 lanes (DENSE_PANEL_UNITS must be a multiple of it). One vector holds the
+  * weight pairs of SIMD_LANES consecutive units of a panel.
+  */
+
+// Weight pairs of units u .. u + SIMD_LANES - 1 at input pair 0, the next pairs follow every
+// DENSE_PANEL_UNITS int32
+static inline const int32_t *SIMD_ISA(dense_panel_at)(const number_t *panels, int pairs, int u) {
+  return (const int32_t *)panels + (u / DENSE_PANEL_UNITS * pairs) * DENSE_PANEL_UNITS + u % DENSE_PANEL_UNITS;
+}
+
+// Input pair q of row x broadcast, (x[2q], 0) for the trailing odd input
+static inline SIMD_VEC SIMD_ISA(dense_input_pair)(const number_t *x, int q, int full) {
+  return SIMD_ISA(vset_pair)(q < full ? load_number_pair(x + 2 * q) : load_number_single(x + 2 * q));
+}
+
+// acc[b * ldacc + u] for the DENSE_GEMM_ROWS rows from input and the 2 * SIMD_LANES units whose
+// weights are at w0 and w1: the 8 accumulators stay in registers and each weight vector is loaded
+// once for the rows. The rows past nrows read row 0 again and are not stored.
+static inline void SIMD_ISA(dense_gemm_tile2)(const int32_t *w0, const int32_t *w1, int pairs, int full,
+                                              const number_t *input, int ldin, int nrows, long_number_t *acc, int ldacc) {
+  const number_t *x0 = input, *x1 = nrows > 1 ? x0 + ldin : x0;
+  const number_t *x2 = nrows > 2 ? x0 + 2 * ldin : x0, *x3 = nrows > 3 ? x0 + 3 * ldin : x0;
+  SIMD_VEC a0 = SIMD_ISA(vzero)(), a1 = a0, a2 = a0, a3 = a0;
+  SIMD_VEC b0 = a0, b1 = a0, b2 = a0, b3 = a0;
+  SIMD_VEC u, v, x;
+  int q;
+
+  for (q = 0; q < pairs; q++) {
+    u = SIMD_ISA(vload_i32)(w0 + q * DENSE_PANEL_UNITS);
+    v = SIMD_ISA(vload_i32)(w1 + q * DENSE_PANEL_UNITS);
+    x = SIMD_ISA(dense_input_pair)(x0, q, full);
+    a0 = SIMD_ISA(vadd)(a0, SIMD_ISA(vmadd)(x, u));
+    b0 = SIMD_ISA(vadd)(b0, SIMD_ISA(vmadd)(x, v));
+    x = SIMD_ISA(dense_input_pair)(x1, q, full);
+    a1 = SIMD_ISA(vadd)(a1, SIMD_ISA(vmadd)(x, u));
+    b1 = SIMD_ISA(vadd)(b1, SIMD_ISA(vmadd)(x, v));
+    x = SIMD_ISA(dense_input_pair)(x2, q, full);
+    a2 = SIMD_ISA(vadd)(a2, SIMD_ISA(vmadd)(x, u));
+    b2 = SIMD_ISA(vadd)(b2, SIMD_ISA(vmadd)(x, v));
+    x = SIMD_ISA(dense_input_pair)(x3, q, full);
+    a3 = SIMD_ISA(vadd)(a3, SIMD_ISA(vmadd)(x, u));
+    b3 = SIMD_ISA(vadd)(b3, SIMD_ISA(vmadd)(x, v));
+  }
+
+  SIMD_ISA(vstore_i32)(acc, a0);
+  SIMD_ISA(vstore_i32)(acc + SIMD_LANES, b0);
+  if (nrows > 1) {
+    SIMD_ISA(vstore_i32)(acc + ldacc, a1);
+    SIMD_ISA(vstore_i32)(acc + ldacc + SIMD_LANES, b1);
+  }
+  if (nrows > 2) {
+    SIMD_ISA(vstore_i32)(acc + 2 * ldacc, a2);
+    SIMD_ISA(vstore_i32)(acc + 2 * ldacc + SIMD_LANES, b2);
+  }
+  if (nrows > 3) {
+    SIMD_ISA(vstore_i32)(acc + 3 * ldacc, a3);
+    SIMD_ISA(vstore_i32)(acc + 3 * ldacc + SIMD_LANES, b3);
+  }
+}
+
+// dense_gemm_tile2 for the last SIMD_LANES units, when they do not make two vectors
+static inline void SIMD_ISA(dense_gemm_tile1)(const int32_t *w0, int pairs, int full,
+                                              const number_t *input, int ldin, int nrows, long_number_t *acc, int ldacc) {
+  const number_t *x0 = input, *x1 = nrows > 1 ? x0 + ldin : x0;
+  const number_t *x2 = nrows > 2 ? x0 + 2 * ldin : x0, *x3 = nrows > 3 ? x0 + 3 * ldin : x0;
+  SIMD_VEC a0 = SIMD_ISA(vzero)(), a1 = a0, a2 = a0, a3 = a0;
+  SIMD_VEC u;
+  int q;
+
+  for (q = 0; q < pairs; q++) {
+    u = SIMD_ISA(vload_i32)(w0 + q * DENSE_PANEL_UNITS);
+    a0 = SIMD_ISA(vadd)(a0, SIMD_ISA(vmadd)(SIMD_ISA(dense_input_pair)(x0, q, full), u));
+    a1 = SIMD_ISA(vadd)(a1, SIMD_ISA(vmadd)(SIMD_ISA(dense_input_pair)(x1, q, full), u));
+    a2 = SIMD_ISA(vadd)(a2, SIMD_ISA(vmadd)(SIMD_ISA(dense_input_pair)(x2, q, full), u));
+    a3 = SIMD_ISA(vadd)(a3, SIMD_ISA(vmadd)(SIMD_ISA(dense_input_pair)(x3, q, full), u));
+  }
+
+  SIMD_ISA(vstore_i32)(acc, a0);
+  if (nrows > 1)
+    SIMD_ISA(vstore_i32)(acc + ldacc, a1);
+  if (nrows > 2)
+    SIMD_ISA(vstore_i32)(acc + 2 * ldacc, a2);
+  if (nrows > 3)
+    SIMD_ISA(vstore_i32)(acc + 3 * ldacc, a3);
+}
+
+// dense_gemm of n rows, units rounded up to DENSE_PANEL_UNITS
+static void SIMD_ISA(dense_gemm)(const number_t *panels, int inputs, int units, int n,
+                                 const number_t *input, int ldin, long_number_t *acc, int ldacc) {
+  const int pairs = (inputs + 1) / 2, full = inputs / 2;
+  const int padded = (units + DENSE_PANEL_UNITS - 1) / DENSE_PANEL_UNITS * DENSE_PANEL_UNITS;
+  int b, u, nrows;
+
+  for (b = 0; b < n; b += DENSE_GEMM_ROWS) {
+    nrows = n - b < DENSE_GEMM_ROWS ? n - b : DENSE_GEMM_ROWS;
+    for (u = 0; u + 2 * SIMD_LANES <= padded; u += 2 * SIMD_LANES)
+      SIMD_ISA(dense_gemm_tile2)(SIMD_ISA(dense_panel_at)(panels, pairs, u), SIMD_ISA(dense_panel_at)(panels, pairs, u + SIMD_LANES),
+                                 pairs, full, input + b * ldin, ldin, nrows, acc + b * ldacc + u, ldacc);
+    if (u < padded)
+      SIMD_ISA(dense_gemm_tile1)(SIMD_ISA(dense_panel_at)(panels, pairs, u), pairs, full,
+                                 input + b * ldin, ldin, nrows, acc + b * ldacc + u, ldacc);
+  }
+}
+
+// Batch size 1: 4 vectors of units at a time, 4 independent madd chains, then one vector with the
+// even and odd input pairs in separate accumulators
+static void SIMD_ISA(dense_gemv)(const number_t *panels, int inputs, int units, const number_t *input, long_number_t *acc) {
+  const int pairs = (inputs + 1) / 2, full = inputs / 2;
+  const int padded = (units + DENSE_PANEL_UNITS - 1) / DENSE_PANEL_UNITS * DENSE_PANEL_UNITS;
+  int u = 0, q;
+
+  for (; u + 4 * SIMD_LANES <= padded; u += 4 * SIMD_LANES) {
+    const int32_t *w0 = SIMD_ISA(dense_panel_at)(panels, pairs, u);
+    const int32_t *w1 = SIMD_ISA(dense_panel_at)(panels, pairs, u + SIMD_LANES);
+    const int32_t *w2 = SIMD_ISA(dense_panel_at)(panels, pairs, u + 2 * SIMD_LANES);
+    const int32_t *w3 = SIMD_ISA(dense_panel_at)(panels, pairs, u + 3 * SIMD_LANES);
+    SIMD_VEC a0 = SIMD_ISA(vzero)(), a1 = a0, a2 = a0, a3 = a0;
+    SIMD_VEC x;
+
+    for (q = 0; q < pairs; q++) {
+      x = SIMD_ISA(dense_input_pair)(input, q, full);
+      a0 = SIMD_ISA(vadd)(a0, SIMD_ISA(vmadd)(x, SIMD_ISA(vload_i32)(w0 + q * DENSE_PANEL_UNITS)));
+      a1 = SIMD_ISA(vadd)(a1, SIMD_ISA(vmadd)(x, SIMD_ISA(vload_i32)(w1 + q * DENSE_PANEL_UNITS)));
+      a2 = SIMD_ISA(vadd)(a2, SIMD_ISA(vmadd)(x, SIMD_ISA(vload_i32)(w2 + q * DENSE_PANEL_UNITS)));
+      a3 = SIMD_ISA(vadd)(a3, SIMD_ISA(vmadd)(x, SIMD_ISA(vload_i32)(w3 + q * DENSE_PANEL_UNITS)));
+    }
+    SIMD_ISA(vstore_i32)(acc + u, a0);
+    SIMD_ISA(vstore_i32)(acc + u + SIMD_LANES, a1);
+    SIMD_ISA(vstore_i32)(acc + u + 2 * SIMD_LANES, a2);
+    SIMD_ISA(vstore_i32)(acc + u + 3 * SIMD_LANES, a3);
+  }
+
+  for (; u < padded; u += SIMD_LANES) {
+    const int32_t *w0 = SIMD_ISA(dense_panel_at)(panels, pairs, u);
+    SIMD_VEC even = SIMD_ISA(vzero)(), odd = even;
+
+    for (q = 0; q + 1 < pairs; q += 2) {
+      even = SIMD_ISA(vadd)(even, SIMD_ISA(vmadd)(SIMD_ISA(dense_input_pair)(input, q, full),
+                                                  SIMD_ISA(vload_i32)(w0 + q * DENSE_PANEL_UNITS)));
+      odd = SIMD_ISA(vadd)(odd, SIMD_ISA(vmadd)(SIMD_ISA(dense_input_pair)(input, q + 1, full),
+                                                SIMD_ISA(vload_i32)(w0 + (q + 1) * DENSE_PANEL_UNITS)));
+    }
+    if (q < pairs)
+      even = SIMD_ISA(vadd)(even, SIMD_ISA(vmadd)(SIMD_ISA(dense_input_pair)(input, q, full),
+                                                  SIMD_ISA(vload_i32)(w0 + q * DENSE_PANEL_UNITS)));
+    SIMD_ISA(vstore_i32)(acc + u, SIMD_ISA(vadd)(even, odd));
+  }
+}
@@ -0,0 +1,96 @@
+/**
+  ******************************************************************************
+  * @file    depthwise_conv1d_119.c
+  * @version 1.0.0
+  * @date    17 october 2026
+  * @brief   Depthwise conv of the separable block replacing conv1d_119 (-DCNN_SEPARABLE): the
+  *          3 taps of each of its CNN_SEPARABLE_MULTIPLIER filters per channel run on that
+  *          channel only, linear like the depthwise conv of a Keras SeparableConv1D
+  */
+
+#ifndef SINGLE_FILE
+#include "number.h"
+#include "model.h"
+#include "layer_params.h"
+#include "conv1d_separable.h"
+#include "requant_simd.h"
+#endif
+
+#define INPUT_CHANNELS      64
+#define INPUT_SAMPLES       30
+#define DEPTH_MULTIPLIER    CNN_SEPARABLE_MULTIPLIER
+#define CONV_FILTERS        ( INPUT_CHANNELS * DEPTH_MULTIPLIER )
+#define CONV_KERNEL_SIZE    3
+#define CONV_STRIDE         1
+
+#define ZEROPADDING_LEFT    0
+#define ZEROPADDING_RIGHT   0
+
+#define CONV_OUTSAMPLES     ( ( (INPUT_SAMPLES - CONV_KERNEL_SIZE + ZEROPADDING_LEFT + ZEROPADDING_RIGHT) / CONV_STRIDE ) + 1 )
+
+#define ACTIVATION_LINEAR
+
+#ifndef DEPTHWISE_CONV1D_119_REQUANT_SHIFT
+#define DEPTHWISE_CONV1D_119_REQUANT_SHIFT FIXED_POINT // input + weight - output fractional bits, defined by weights/separable.c
+#endif
+
+typedef number_t depthwise_conv1d_119_output_type[CONV_FILTERS][CONV_OUTSAMPLES];
+
+static const conv1d_params_t depthwise_conv1d_119_params = {
+  INPUT_CHANNELS, INPUT_SAMPLES, CONV_FILTERS, CONV_KERNEL_SIZE, CONV_STRIDE,
+  ZEROPADDING_LEFT, ZEROPADDING_RIGHT, CONV_OUTSAMPLES,
+#ifdef ACTIVATION_RELU
+  ACTIVATION_KIND_RELU,
+#else
+  ACTIVATION_KIND_LINEAR,
+#endif
+  DEPTHWISE_CONV1D_119_REQUANT_SHIFT,
+};
+
+static inline void depthwise_conv1d_119(
+  const number_t input[INPUT_CHANNELS][INPUT_SAMPLES],     // IN
+  const number_t kernel[CONV_FILTERS][CONV_KERNEL_SIZE],   // IN
+
+  const number_t bias[CONV_FILTERS],                       // IN
+
+  number_t output[CONV_FILTERS][CONV_OUTSAMPLES]) {        // OUT
+
+  unsigned short pos_x, k, x;
+  short input_x;
+  long_number_t output_acc[CONV_OUTSAMPLES];
+
+#ifdef CNN_SIMD
+  // Vectorized kernel of the running CPU, the loops below are the scalar fallback
+  if (depthwise_conv1d_simd(&depthwise_conv1d_119_params, &input[0][0], &kernel[0][0], bias, &output[0][0]))
+    return;
+#endif
+
+  for (k = 0; k < CONV_FILTERS; k++) {
+    for (pos_x = 0; pos_x < CONV_OUTSAMPLES; pos_x++) {
+      output_acc[pos_x] = 0;
+      for (x = 0; x < CONV_KERNEL_SIZE; x++) {
+        input_x = pos_x * CONV_STRIDE - ZEROPADDING_LEFT + x;
+        if (input_x >= 0 && input_x < INPUT_SAMPLES) // ZeroPadding1D
+          output_acc[pos_x] = output_acc[pos_x] + input[k / DEPTH_MULTIPLIER][input_x] * kernel[k][x];
+      }
+    }
+
+#ifdef ACTIVATION_LINEAR
+    requant_simd_row(output[k], output_acc, CONV_OUTSAMPLES, DEPTHWISE_CONV1D_119_REQUANT_SHIFT, &bias[k], 0, 0);
+#elif defined(ACTIVATION_RELU)
+    // Activation function: ReLU
+    requant_simd_row(output[k], output_acc, CONV_OUTSAMPLES, DEPTHWISE_CONV1D_119_REQUANT_SHIFT, &bias[k], 0, 1);
+#endif
+  }
+}
+
+#undef INPUT_CHANNELS
+#undef INPUT_SAMPLES
+#undef DEPTH_MULTIPLIER
+#undef CONV_FILTERS
+#undef CONV_KERNEL_SIZE
+#undef CONV_STRIDE
+#undef ZEROPADDING_LEFT
+#undef ZEROPADDING_RIGHT
+#undef CONV_OUTSAMPLES
+#undef ACTIVATION_LINEAR
@@ -0,0 +1,233 @@
+/**
+  ******************************************************************************
+  * @file    dsp.h
+  * @version 1.0.0
+  * @date    17 october 2026
+  * @brief   conv1d and dense kernels on the dual 16-bit MAC of the Cortex-M4 DSP extension
+  *
+  * SMLAD adds the two products of the int16 halves of two registers to an int32 accumulator in
+  * one cycle, with the pairs of number_t read by one 32-bit load. The conv kernel copies the
+  * windows of two conv positions (max pooled first when the pooling is fused) to the stack, each
+  * a row of input_channels * kernel_size samples laid out like a filter of the kernel, and runs
+  * 2 filters x 2 positions at a time: 4 loads per 4 SMLAD, 8 MACs, where the generated loops
+  * load two operands per MAC. The dense kernel runs 2 units at a time, sharing the load of the
+  * input pair. The sums are those of the generated loops, in int32, so the results are bit-exact.
+  * On a core with the DSP extension (__ARM_FEATURE_DSP: M4, M7, M33) the dsp_* intrinsics below
+  * are the instructions and CNN_DSP is defined; anywhere else -DCNN_DSP builds the same kernels
+  * on the C emulation of the intrinsics, to test them on the host. The host vector
+  * kernels run first when there are any, CNN_ISA=scalar or -DCNN_NO_SIMD leave the layers to
+  * these. -DCNN_NO_DSP keeps the generated loops.
+  */
+
+#ifndef __DSP_H__
+#define __DSP_H__
+
+#ifndef SINGLE_FILE
+#include "number.h"
+#include "layer_params.h"
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#if !defined(CNN_NO_DSP) && FIXED_POINT > 0 && NUMBER_MAX == 32767 && (defined(__ARM_FEATURE_DSP) || defined(CNN_DSP))
+
+#ifndef CNN_DSP
+#define CNN_DSP
+#endif
+
+#define DSP_MAX_WINDOW 256 // input_channels * kernel_size of a conv, two windows on the stack
+
+#ifdef __ARM_FEATURE_DSP
+
+// Inline assembly like the __SMLAD and __SSAT of CMSIS, arm_acle.h only has them from GCC 10
+static inline int32_t dsp_smlad(int32_t x, int32_t y, int32_t acc) {
+  int32_t r;
+  __asm__ ("smlad %0, %1, %2, %3" : "=r" (r) : "r" (x), "r" (y), "r" (acc));
+  return r;
+}
+
+static inline int32_t dsp_ssat16(int32_t x) {
+  int32_t r;
+  __asm__ ("ssat %0, #16, %1" : "=r" (r) : "r" (x));
+  return r;
+}
+
+#else
+
+// acc + x.lo * y.lo + x.hi * y.hi, wrapping like SMLAD (which sets the Q flag instead, never read)
+static inline int32_t dsp_smlad(int32_t x, int32_t y, int32_t acc) {
+  return (int32_t)((uint32_t)acc + (uint32_t)((int16_t)x * (int16_t)y) + (uint32_t)((x >> 16) * (y >> 16)));
+}
+
+// x saturated to int16, SSAT #16
+static inline int32_t dsp_ssat16(int32_t x) {
+  return x < -32768 ? -32768 : x > 32767 ? 32767 : x;
+}
+
+#endif//__ARM_FEATURE_DSP
+
+// (p[0], p[1]) packed in one register, p[0] in the low half; the M4 loads it unaligned
+static inline int32_t dsp_read_pair(const number_t *p) {
+  int32_t pair;
+  memcpy(&pair, p, sizeof(pair));
+  return pair;
+}
+
+// requantize_number_t of requant_simd.h with the clamp on SSAT
+static inline number_t dsp_requant(long_number_t acc, int shift, long_number_t bias, int relu) {
+  acc = (acc >> shift) + bias;
+  if (relu && acc < 0)
+    return 0;
+  return (number_t)dsp_ssat16(acc);
+}
+
+// The samples of conv position pos of p under the kernel, [input_channels][kernel_size], max
+// pooled by input_pool when not NULL
+static inline void dsp_window(
+  const maxpool1d_params_t *input_pool,
+  const conv1d_params_t *p,
+  const number_t *input,
+  int pos,
+  number_t *window) {
+
+  const int raw_samples = input_pool != NULL ? input_pool->input_samples : p->input_samples;
+  const number_t *in;
+  number_t max, tmp;
+  int z, x, y;
+
+  for (z = 0; z < p->input_channels; z++) {
+    in = input + z * raw_samples;
+    if (input_pool == NULL) {
+      memcpy(window, in + pos * p->stride, p->kernel_size * sizeof(number_t));
+      window += p->kernel_size;
+      continue;
+    }
+    for (x = 0; x < p->kernel_size; x++) {
+      max = in[(pos * p->stride + x) * input_pool->pool_stride];
+      for (y = 1; y < input_pool->pool_size; y++) {
+        tmp = in[(pos * p->stride + x) * input_pool->pool_stride + y];
+        max = max < tmp ? tmp : max;
+      }
+      *window++ = max;
+    }
+  }
+}
+
+// Conv p optionally preceded by the max pooling input_pool of its input and followed by the
+// pool 2 / stride 2 max pooling output_pool (both may be NULL, linear pools only), requantized
+// with bias. Returns 0 when the layer does not fit, the caller then runs the generated loops.
+static int conv1d_maxpool1d_dsp(
+  const maxpool1d_params_t *input_pool,
+  const conv1d_params_t *p,
+  const maxpool1d_params_t *output_pool,
+  const number_t *input,    // [input_channels][input_samples], or the input of input_pool
+  const number_t *kernel,   // [filters][input_channels][kernel_size]
+  const number_t *bias,     // [filters]
+  number_t *output) {       // [filters][outsamples], [filters][pool_length] with output_pool
+
+  number_t window[2][DSP_MAX_WINDOW];
+  const int n = p->input_channels * p->kernel_size;
+  const int relu = p->activation == ACTIVATION_KIND_RELU;
+  const int conv_samples = output_pool != NULL ? 2 * output_pool->pool_length : p->outsamples;
+  const int out_samples = output_pool != NULL ? output_pool->pool_length : p->outsamples;
+  const number_t *k0, *k1;
+  long_number_t sum00, sum01, sum10, sum11;
+  int32_t x0, x1, w0, w1;
+  int pos, second, k, j;
+
+  if (p->zeropadding_left != 0 || p->zeropadding_right != 0 || n > DSP_MAX_WINDOW)
+    return 0;
+  if ((input_pool != NULL && input_pool->activation != ACTIVATION_KIND_LINEAR)
+      || (output_pool != NULL && (output_pool->activation != ACTIVATION_KIND_LINEAR
+                                  || output_pool->pool_size != 2 || output_pool->pool_stride != 2)))
+    return 0;
+
+  for (pos = 0; pos < conv_samples; pos += 2) {
+    // An odd last position without output pooling runs twice, its second output is dropped
+    second = pos + 1 < conv_samples ? pos + 1 : pos;
+    dsp_window(input_pool, p, input, pos, window[0]);
+    dsp_window(input_pool, p, input, second, window[1]);
+
+    for (k = 0; k < p->filters; k += 2) {
+      k0 = kernel + k * n;
+      k1 = k + 1 < p->filters ? k0 + n : k0; // odd last filter: same, the second is dropped
+      sum00 = sum01 = sum10 = sum11 = 0;
+      for (j = 0; j + 1 < n; j += 2) {
+        x0 = dsp_read_pair(&window[0][j]);
+        x1 = dsp_read_pair(&window[1][j]);
+        w0 = dsp_read_pair(k0 + j);
+        w1 = dsp_read_pair(k1 + j);
+        sum00 = dsp_smlad(w0, x0, sum00);
+        sum01 = dsp_smlad(w0, x1, sum01);
+        sum10 = dsp_smlad(w1, x0, sum10);
+        sum11 = dsp_smlad(w1, x1, sum11);
+      }
+      if (j < n) { // odd last tap, (w, 0) pairs
+        x0 = (uint16_t)window[0][j];
+        x1 = (uint16_t)window[1][j];
+        w0 = (uint16_t)k0[j];
+        w1 = (uint16_t)k1[j];
+        sum00 = dsp_smlad(w0, x0, sum00);
+        sum01 = dsp_smlad(w0, x1, sum01);
+        sum10 = dsp_smlad(w1, x0, sum10);
+        sum11 = dsp_smlad(w1, x1, sum11);
+      }
+
+      // The requantization is monotonic, the output pool takes the max of the accumulators
+      if (output_pool != NULL) {
+        output[k * out_samples + pos / 2] = dsp_requant(sum00 > sum01 ? sum00 : sum01, p->requant_shift, bias[k], relu);
+        if (k + 1 < p->filters)
+          output[(k + 1) * out_samples + pos / 2] = dsp_requant(sum10 > sum11 ? sum10 : sum11, p->requant_shift, bias[k + 1], relu);
+        continue;
+      }
+      output[k * out_samples + pos] = dsp_requant(sum00, p->requant_shift, bias[k], relu);
+      if (second != pos)
+        output[k * out_samples + second] = dsp_requant(sum01, p->requant_shift, bias[k], relu);
+      if (k + 1 < p->filters) {
+        output[(k + 1) * out_samples + pos] = dsp_requant(sum10, p->requant_shift, bias[k + 1], relu);
+        if (second != pos)
+          output[(k + 1) * out_samples + second] = dsp_requant(sum11, p->requant_shift, bias[k + 1], relu);
+      }
+    }
+  }
+  return 1;
+}
+
+// acc[u] = sum_z kernel[u][z] * input[z] of a dense layer, to be requantized by the caller
+static void dense_dsp(
+  const number_t *kernel,   // [units][inputs]
+  int inputs,
+  int units,
+  const number_t *input,    // [inputs]
+  long_number_t *acc) {     // [units]
+
+  const number_t *k0, *k1;
+  long_number_t sum0, sum1;
+  int32_t x;
+  int u, z;
+
+  for (u = 0; u < units; u += 2) {
+    k0 = kernel + u * inputs;
+    k1 = u + 1 < units ? k0 + inputs : k0;
+    sum0 = sum1 = 0;
+    for (z = 0; z + 1 < inputs; z += 2) {
+      x = dsp_read_pair(input + z);
+      sum0 = dsp_smlad(dsp_read_pair(k0 + z), x, sum0);
+      sum1 = dsp_smlad(dsp_read_pair(k1 + z), x, sum1);
+    }
+    if (z < inputs) { // odd last input, (w, 0) pairs
+      x = (uint16_t)input[z];
+      sum0 = dsp_smlad((uint16_t)k0[z], x, sum0);
+      sum1 = dsp_smlad((uint16_t)k1[z], x, sum1);
+    }
+    acc[u] = sum0;
+    if (u + 1 < units)
+      acc[u + 1] = sum1;
+  }
+}
+
+#endif//CNN_DSP
+
+#endif//__DSP_H__
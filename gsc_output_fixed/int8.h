@@ -0,0 +1,223 @@
+/**
+  ******************************************************************************
+  * @file    int8.h
+  * @version 1.0.0
+  * @date    17 october 2026
+  * @brief   conv1d and dense kernels on int8 weights with one scale per filter and int8
+  *          inputs with a per-layer scale and zero point, accumulated in int32
+  *
+  * The input of a layer is quantized once to uint8 (max pooled first when the pooling is fused),
+ * channels last: the kernel rows are [tap][channel], so the window of each output is a slice of
+ * the quantized input and its dot product with the row reads it in place (the padding of the
+ * rows reads past the window, under zero weights). The int32 sum, minus zero point * sum of the
+ * row, is rescaled by the multiplier of its filter and the shift of the layer to the scale of
+ * the int16 accumulators, and goes through the same pooling and requantization. The dot
+ * products run 8 filters at a time over all the windows, with SSSE3 maddubs (32 uint8 x int8
+ * products per AVX2 instruction) on the host: tools/int8_weights.py lowers input_max so that
+ * the int16 pair sums of maddubs never saturate and checks that the rescaled sums fit in int32,
+ * the vector and scalar kernels are bit-exact. The buffers are on the stack (about 42 KB).
+ * Enabled at build time with -DCNN_INT8 for the layers that tools/int8_weights.py converted
+ * (weights/int8.c defines <LAYER>_INT8 for each), whose int16 kernel is then not linked: the
+ * six layers of this model link 42078 B of int8 rows, scales and bias instead of 87406 B of int16
+ * kernels, GEMV panels and bias (gcc -O2, x86-64).
+ */
+
+#ifndef __INT8_H__
+#define __INT8_H__
+
+#ifndef SINGLE_FILE
+#include "number.h"
+#include "layer_params.h"
+#include "simd.h"
+#include "requant_simd.h"
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define INT8_MAX_INPUT    8192 // input_channels * input_samples of a conv, after the input pooling
+#define INT8_MAX_ROW      1024 // int8_weights_t.row
+#define INT8_MAX_SAMPLES  1024 // conv outputs of one filter, before the output pooling
+#define INT8_FILTER_BLOCK 8    // filters of one int8_gemm call
+
+#ifdef CNN_SIMD_X86
+
+#pragma GCC push_options
+#pragma GCC target("sse4.1")
+#define SIMD_ISA(name) name##_sse41
+#define SIMD_VEC __m128i
+#define SIMD_LANES 4
+#include "int8_isa.h"
+#undef SIMD_ISA
+#undef SIMD_VEC
+#undef SIMD_LANES
+#pragma GCC pop_options
+
+#pragma GCC push_options
+#pragma GCC target("avx2")
+#define SIMD_ISA(name) name##_avx2
+#define SIMD_VEC __m256i
+#define SIMD_LANES 8
+#include "int8_isa.h"
+#undef SIMD_ISA
+#undef SIMD_VEC
+#undef SIMD_LANES
+#pragma GCC pop_options
+
+#endif//CNN_SIMD_X86
+
+static inline uint8_t int8_quantize(const int8_weights_t *w, number_t x) {
+  int32_t q = ((x * w->input_multiplier + (1 << (w->input_shift - 1))) >> w->input_shift) + w->input_zero_point;
+  q = q < 0 ? 0 : q;
+  return (uint8_t)(q > w->input_max ? w->input_max : q);
+}
+
+// out[i * step] = int8_quantize of the max of in[i * pool_stride + y] for y < pool_size and
+// i < n, with the kernel of the running CPU for the common pools. The quantization is monotonic,
+// the pooling is taken before it.
+static void int8_quantize_row(const int8_weights_t *w, const number_t *in, int pool_size, int pool_stride, int n, uint8_t *out, int step) {
+  int i = 0, y;
+  number_t x, tmp;
+
+#ifdef CNN_SIMD_X86
+  if (cnn_isa >= CNN_ISA_SSE41 && pool_size == pool_stride && pool_size <= 2)
+    i = int8_quantize_row_sse41(w, in, pool_size == 2, n, out, step);
+#endif
+  for (; i < n; i++) {
+    // Selects rather than branches, the inputs are noise to the branch predictor
+    x = in[i * pool_stride];
+    for (y = 1; y < pool_size; y++) {
+      tmp = in[i * pool_stride + y];
+      x = x < tmp ? tmp : x;
+    }
+    out[i * step] = int8_quantize(w, x);
+  }
+}
+
+// Dot product of filter k rescaled to the accumulators of the int16 weights, the tool keeps the
+// result within long_number_t
+static inline long_number_t int8_rescale(const int8_weights_t *w, int k, int32_t dot) {
+  return (long_number_t)(((int64_t)(dot - w->offset[k]) * w->multiplier[k] + ((int64_t)1 << (w->shift - 1))) >> w->shift);
+}
+
+// acc[f * ldacc + pos] = rescaled dot product of the w->row values at windows + pos * step with
+// kernel row k + f, for the INT8_FILTER_BLOCK filters from k and count windows, with the kernel
+// of the running CPU
+static void int8_gemm(const int8_weights_t *w, int k, const uint8_t *windows, int step, int count, long_number_t *acc, int ldacc) {
+  int f, pos, r;
+
+#ifdef CNN_SIMD_X86
+  if (cnn_isa == CNN_ISA_AVX2) {
+    int8_gemm_avx2(w, k, windows, step, count, acc, ldacc);
+    return;
+  }
+  if (cnn_isa == CNN_ISA_SSE41) {
+    int8_gemm_sse41(w, k, windows, step, count, acc, ldacc);
+    return;
+  }
+#endif
+  for (f = 0; f < INT8_FILTER_BLOCK; f++) {
+    const int8_t *kernel = w->kernel + (k + f) * w->row;
+
+    for (pos = 0; pos < count; pos++) {
+      const uint8_t *x = windows + pos * step;
+      int32_t dot = 0;
+
+      for (r = 0; r < w->row; r++)
+        dot += x[r] * kernel[r];
+      acc[f * ldacc + pos] = int8_rescale(w, k + f, dot);
+    }
+  }
+}
+
+// Conv p on the int8 weights w, optionally preceded by the max pooling input_pool of its input
+// and followed by the max pooling output_pool (both may be NULL, linear pools only), requantized
+// with bias. Returns 0 when the layer does not fit the buffers, which conv1d_<n>.c rules out at
+// build time: the layer has no int16 weights to run instead.
+static inline int conv1d_maxpool1d_int8(
+  const maxpool1d_params_t *input_pool,
+  const conv1d_params_t *p,
+  const maxpool1d_params_t *output_pool,
+  const int8_weights_t *w,
+  const number_t *input,    // [input_channels][input_samples], or the input of input_pool
+  const number_t *bias,     // [filters]
+  number_t *output) {       // [filters][outsamples], [filters][pool_length] with output_pool
+
+  uint8_t xq[INT8_MAX_INPUT + INT8_MAX_ROW]; // quantized input, [input_samples][input_channels]
+  long_number_t acc[INT8_FILTER_BLOCK][INT8_MAX_SAMPLES];
+  const int channels = p->input_channels, input_samples = p->input_samples, samples = p->outsamples;
+  const int row = w->row;
+  const int relu = p->activation == ACTIVATION_KIND_RELU;
+  const int out_samples = output_pool != NULL ? output_pool->pool_length : samples;
+  const int pool_size = output_pool != NULL ? output_pool->pool_size : 1;
+  const int pool_stride = output_pool != NULL ? output_pool->pool_stride : 1;
+  int k, f, z, i, pos, y;
+  long_number_t a, tmp;
+
+  if (channels * input_samples > INT8_MAX_INPUT || row > INT8_MAX_ROW || samples > INT8_MAX_SAMPLES
+      || p->zeropadding_left != 0 || p->zeropadding_right != 0)
+    return 0;
+  if ((input_pool != NULL && input_pool->activation != ACTIVATION_KIND_LINEAR)
+      || (output_pool != NULL && output_pool->activation != ACTIVATION_KIND_LINEAR))
+    return 0;
+
+  // Channels last
+  for (z = 0; z < channels; z++) {
+    if (input_pool != NULL)
+      int8_quantize_row(w, input + z * input_pool->input_samples, input_pool->pool_size, input_pool->pool_stride,
+                        input_samples, xq + z, channels);
+    else
+      int8_quantize_row(w, input + z * input_samples, 1, 1, input_samples, xq + z, channels);
+  }
+
+  // Read by the padding of the last rows
+  for (i = channels * input_samples; i < channels * input_samples + row; i++)
+    xq[i] = 0;
+
+  for (k = 0; k < p->filters; k += INT8_FILTER_BLOCK) {
+    const int nfilters = p->filters - k < INT8_FILTER_BLOCK ? p->filters - k : INT8_FILTER_BLOCK;
+
+    int8_gemm(w, k, xq, p->stride * channels, samples, &acc[0][0], INT8_MAX_SAMPLES);
+    for (f = 0; f < nfilters; f++) {
+      // The pooled accumulators are written in place, the requantization is monotonic
+      if (output_pool != NULL) {
+        for (pos = 0; pos < out_samples; pos++) {
+          a = acc[f][pos * pool_stride];
+          for (y = 1; y < pool_size; y++) {
+            tmp = acc[f][pos * pool_stride + y];
+            a = a < tmp ? tmp : a;
+          }
+          acc[f][pos] = a;
+        }
+      }
+      requant_simd_row(output + (k + f) * out_samples, acc[f], out_samples, p->requant_shift, &bias[k + f], 0, relu);
+    }
+  }
+  return 1;
+}
+
+// Accumulators acc[units] of a dense layer on the int8 weights w, to be requantized by the
+// caller like those of its int16 weights. input_samples is at most INT8_MAX_ROW.
+static inline void dense_int8(
+  const int8_weights_t *w,
+  int input_samples,
+  int units,
+  const number_t *input,    // [input_samples]
+  long_number_t *acc) {     // [units]
+
+  uint8_t xq[INT8_MAX_ROW];
+  long_number_t dot[INT8_FILTER_BLOCK];
+  int k, f, z;
+
+  int8_quantize_row(w, input, 1, 1, input_samples, xq, 1);
+  for (z = input_samples; z < w->row; z++)
+    xq[z] = 0;
+
+  for (k = 0; k < units; k += INT8_FILTER_BLOCK) {
+    int8_gemm(w, k, xq, 0, 1, dot, 1);
+    for (f = 0; f < INT8_FILTER_BLOCK && k + f < units; f++)
+      acc[k + f] = dot[f];
+  }
+}
+
+#endif//__INT8_H__
@@ -0,0 +1,154 @@
+/**
+  ******************************************************************************
+  * @file    int8_isa.h
+  * @version 1.0.0
+  * @date    17 october 2026
+  * @brief   Vectorized int8 dot products, included once per ISA by int8.h
+  *
+  * Expects SIMD_ISA(name) to append the ISA suffix, SIMD_VEC the vector type and SIMD_LANES
+  * its number of int32 lanes. The reduction runs along the kernel row: maddubs multiplies
+  * 4*SIMD_LANES uint8 inputs by as many int8 weights and adds them in pairs to int16, madd with
+  * ones widens the pairs to int32 lanes. The loop holds 4 filters x 2 windows in 8 accumulators,
+  * hadd folds them to one int32 lane per filter and the rescaling runs on the 4 filters at once.
+  */
+
+#if SIMD_LANES == 8
+
+static inline __m256i SIMD_ISA(int8_madd)(__m256i x, __m256i w) {
+  return _mm256_madd_epi16(_mm256_maddubs_epi16(x, w), _mm256_set1_epi16(1));
+}
+
+#define INT8_LOAD(p) _mm256_loadu_si256((const __m256i *)(p))
+
+// Sums of the lanes of a0..a3, in this order
+static inline __m128i SIMD_ISA(int8_hsum4)(__m256i a0, __m256i a1, __m256i a2, __m256i a3) {
+  // hadd works per 128-bit lane: both halves hold partial sums of the 4 filters
+  __m256i h = _mm256_hadd_epi32(_mm256_hadd_epi32(a0, a1), _mm256_hadd_epi32(a2, a3));
+  return _mm_add_epi32(_mm256_castsi256_si128(h), _mm256_extracti128_si256(h, 1));
+}
+
+#else
+
+static inline __m128i SIMD_ISA(int8_madd)(__m128i x, __m128i w) {
+  return _mm_madd_epi16(_mm_maddubs_epi16(x, w), _mm_set1_epi16(1));
+}
+
+#define INT8_LOAD(p) _mm_loadu_si128((const __m128i *)(p))
+
+static inline __m128i SIMD_ISA(int8_hsum4)(__m128i a0, __m128i a1, __m128i a2, __m128i a3) {
+  return _mm_hadd_epi32(_mm_hadd_epi32(a0, a1), _mm_hadd_epi32(a2, a3));
+}
+
+#endif
+
+#if SIMD_LANES == 4 // SSE4.1 only, used by both ISAs
+
+// out[i * step] = int8_quantize of in[i], or of the max of in[2 * i] and in[2 * i + 1] with pool2,
+// for i < n rounded down to 4, returns that count
+static int SIMD_ISA(int8_quantize_row)(const int8_weights_t *w, const number_t *in, int pool2, int n, uint8_t *out, int step) {
+  // Loaded once: the stores to out may alias w for the compiler
+  const __m128i multiplier = _mm_set1_epi32(w->input_multiplier);
+  const __m128i round = _mm_set1_epi32(1 << (w->input_shift - 1));
+  const __m128i shift = _mm_cvtsi32_si128(w->input_shift);
+  const __m128i zero_point = _mm_set1_epi32(w->input_zero_point);
+  const __m128i max = _mm_set1_epi32(w->input_max);
+  int i, j;
+
+  for (i = 0; i + 4 <= n; i += 4) {
+    __m128i x;
+    uint32_t bytes;
+
+    if (pool2) {
+      // The max of each pair lands in the low half of its int32 lane
+      x = _mm_loadu_si128((const __m128i *)(in + 2 * i));
+      x = _mm_max_epi16(x, _mm_srli_epi32(x, 16));
+      x = _mm_srai_epi32(_mm_slli_epi32(x, 16), 16);
+    } else {
+      x = _mm_cvtepi16_epi32(_mm_loadl_epi64((const __m128i *)(in + i)));
+    }
+    x = _mm_sra_epi32(_mm_add_epi32(_mm_mullo_epi32(x, multiplier), round), shift);
+    x = _mm_min_epi32(_mm_max_epi32(_mm_add_epi32(x, zero_point), _mm_setzero_si128()), max);
+    bytes = (uint32_t)_mm_cvtsi128_si32(_mm_packus_epi16(_mm_packs_epi32(x, x), x));
+    for (j = 0; j < 4; j++)
+      out[(i + j) * step] = (uint8_t)(bytes >> 8 * j);
+  }
+  return i;
+}
+
+#endif
+
+// int8_rescale of the dot products of filters k..k+3: the int64 products are shifted right
+// logically, their low 32 bits are those of the arithmetic shift since shift <= 32
+static inline __m128i SIMD_ISA(int8_rescale4)(const int8_weights_t *w, int k, __m128i dot) {
+  const __m128i m = _mm_loadu_si128((const __m128i *)(w->multiplier + k));
+  const __m128i v = _mm_sub_epi32(dot, _mm_loadu_si128((const __m128i *)(w->offset + k)));
+  const __m128i round = _mm_set1_epi64x((int64_t)1 << (w->shift - 1));
+  const __m128i count = _mm_cvtsi32_si128(w->shift);
+  __m128i even = _mm_srl_epi64(_mm_add_epi64(_mm_mul_epi32(v, m), round), count);
+  __m128i odd = _mm_srl_epi64(_mm_add_epi64(_mm_mul_epi32(_mm_srli_epi64(v, 32), _mm_srli_epi64(m, 32)), round), count);
+  return _mm_blend_epi16(even, _mm_slli_epi64(odd, 32), 0xCC);
+}
+
+// Stores the rescaled sums of filters f..f+3 for the windows pos (a) and pos + 1 (b), at
+// acc[f * ldacc + pos] and the next
+static inline void SIMD_ISA(int8_store4x2)(long_number_t *acc, int ldacc, __m128i a, __m128i b) {
+  const __m128i lo = _mm_unpacklo_epi32(a, b), hi = _mm_unpackhi_epi32(a, b);
+
+  _mm_storel_epi64((__m128i *)acc, lo);
+  _mm_storeh_pd((double *)(acc + ldacc), _mm_castsi128_pd(lo));
+  _mm_storel_epi64((__m128i *)(acc + 2 * ldacc), hi);
+  _mm_storeh_pd((double *)(acc + 3 * ldacc), _mm_castsi128_pd(hi));
+}
+
+// int8_gemm on the vector units, row a multiple of 32
+static void SIMD_ISA(int8_gemm)(const int8_weights_t *w, int k, const uint8_t *windows, int step, int count, long_number_t *acc, int ldacc) {
+  const int row = w->row;
+  int f, pos, r;
+
+  for (f = 0; f < INT8_FILTER_BLOCK; f += 4) {
+    const int8_t *k0 = w->kernel + (k + f) * row;
+    const int8_t *k1 = k0 + row, *k2 = k1 + row, *k3 = k2 + row;
+
+    for (pos = 0; pos < count; pos += 2) {
+      // An odd last window runs twice, its copy is not stored
+      const uint8_t *x0 = windows + pos * step;
+      const uint8_t *x1 = pos + 1 < count ? x0 + step : x0;
+      SIMD_VEC a0 = SIMD_ISA(vzero)(), a1 = a0, a2 = a0, a3 = a0;
+      SIMD_VEC b0 = a0, b1 = a0, b2 = a0, b3 = a0;
+
+      for (r = 0; r < row; r += 4 * SIMD_LANES) {
+        const SIMD_VEC u = INT8_LOAD(x0 + r), v = INT8_LOAD(x1 + r);
+        SIMD_VEC wv;
+
+        wv = INT8_LOAD(k0 + r);
+        a0 = SIMD_ISA(vadd)(a0, SIMD_ISA(int8_madd)(u, wv));
+        b0 = SIMD_ISA(vadd)(b0, SIMD_ISA(int8_madd)(v, wv));
+        wv = INT8_LOAD(k1 + r);
+        a1 = SIMD_ISA(vadd)(a1, SIMD_ISA(int8_madd)(u, wv));
+        b1 = SIMD_ISA(vadd)(b1, SIMD_ISA(int8_madd)(v, wv));
+        wv = INT8_LOAD(k2 + r);
+        a2 = SIMD_ISA(vadd)(a2, SIMD_ISA(int8_madd)(u, wv));
+        b2 = SIMD_ISA(vadd)(b2, SIMD_ISA(int8_madd)(v, wv));
+        wv = INT8_LOAD(k3 + r);
+        a3 = SIMD_ISA(vadd)(a3, SIMD_ISA(int8_madd)(u, wv));
+        b3 = SIMD_ISA(vadd)(b3, SIMD_ISA(int8_madd)(v, wv));
+      }
+
+      {
+        const __m128i a = SIMD_ISA(int8_rescale4)(w, k + f, SIMD_ISA(int8_hsum4)(a0, a1, a2, a3));
+
+        if (pos + 1 < count) {
+          SIMD_ISA(int8_store4x2)(acc + f * ldacc + pos, ldacc, a,
+                                  SIMD_ISA(int8_rescale4)(w, k + f, SIMD_ISA(int8_hsum4)(b0, b1, b2, b3)));
+        } else {
+          acc[f * ldacc + pos] = _mm_cvtsi128_si32(a);
+          acc[(f + 1) * ldacc + pos] = _mm_extract_epi32(a, 1);
+          acc[(f + 2) * ldacc + pos] = _mm_extract_epi32(a, 2);
+          acc[(f + 3) * ldacc + pos] = _mm_extract_epi32(a, 3);
+        }
+      }
+    }
+  }
+}
+
+#undef INT8_LOAD
@@ -0,0 +1,118 @@
+/**
+  ******************************************************************************
+  * @file    layer_params.h
+  * @version 1.0.0
+  * @date    17 october 2026
+  * @brief   Runtime shape descriptors emitted next to each generated layer
+  */
+
+#ifndef __LAYER_PARAMS_H__
+#define __LAYER_PARAMS_H__
+
+#include <stdint.h>
+
+typedef enum {
+  ACTIVATION_KIND_LINEAR = 0,
+  ACTIVATION_KIND_RELU,
+} activation_kind_t;
+
+// Same values as the INPUT_CHANNELS/INPUT_SAMPLES/... defines of a conv1d_*.c file, kept
+// after the #undef block so that generic kernels can be handed the shape of the layer
+typedef struct {
+  unsigned short input_channels;
+  unsigned short input_samples;
+  unsigned short filters;
+  unsigned short kernel_size;
+  unsigned short stride;
+  unsigned short zeropadding_left;
+  unsigned short zeropadding_right;
+  unsigned short outsamples;
+  activation_kind_t activation;
+  unsigned char requant_shift; // <LAYER>_REQUANT_SHIFT: input + weight - output fractional bits
+} conv1d_params_t;
+
+// Cache tiles of the vector conv kernel of conv1d_simd.h: each tile of blocks of conv positions
+// runs the filters and input channels in slices of these sizes. A zero size is chosen from the
+// shape of the layer, see conv1d_simd_tile().
+typedef struct {
+  unsigned short filters;   // rounded up to a multiple of 4
+  unsigned short blocks;    // blocks of 2 * SIMD_LANES conv positions
+  unsigned short channels;
+} conv1d_tile_t;
+
+// Same for the INPUT_CHANNELS/INPUT_SAMPLES/POOL_* defines of a max_pooling1d_*.c file
+typedef struct {
+  unsigned short input_channels;
+  unsigned short input_samples;
+  unsigned short pool_size;
+  unsigned short pool_stride;
+  unsigned short pool_length;
+  activation_kind_t activation;
+} maxpool1d_params_t;
+
+// Worst-case widths of the accumulators of a conv1d or dense layer, from its weights and the
+// bounds of its input, computed offline by tools/accum_plan.py into weights/accum_plan.c
+typedef struct {
+  unsigned char narrow_taps;   // consecutive taps of a window whose products sum in int16, 0: widen every product
+  unsigned char acc_bits;      // full accumulator, sign included, at most the 32 of long_number_t
+  unsigned char winograd_bits; // transform-domain sums of the Winograd kernel, 0 without one
+} accum_plan_t;
+
+// Conv kernels a layer can be switched to at run time by the autotuner of autotune.h (-DCNN_AUTOTUNE)
+typedef enum {
+  CONV1D_KERNEL_DEFAULT = 0, // the chain of the build flags, ending with the generated loops
+  CONV1D_KERNEL_DIRECT,      // vector kernel of conv1d_simd.h on the tiles of the choice
+  CONV1D_KERNEL_POLYPHASE,   // same on the polyphase decomposition of a strided conv
+  CONV1D_KERNEL_IM2COL,      // im2col + blocked GEMM of conv1d_im2col.h
+  CONV1D_KERNEL_WINOGRAD,    // Winograd kernel of conv1d_winograd.h
+} conv1d_kernel_t;
+
+// Kernel of a conv1d layer chosen by the autotuner, with what the candidates need besides its
+// int16 kernel
+typedef struct {
+  conv1d_kernel_t kernel;
+  conv1d_tile_t *tile;              // cache tiles of the vector kernel, NULL without CNN_SIMD
+  const accum_plan_t *accum_plan;
+  const number_t *winograd_kernel;  // weights/<layer>_winograd.c, NULL for the layers without one
+} conv1d_choice_t;
+
+// Ternary or binary weights of a conv1d or dense layer, bit-packed by tools/ternary_weights.py
+// into weights/ternary.c. Bit r of a filter row is the weight r = z * kernel_size + x of the
+// generated kernel[filters][input_channels][kernel_size] array (z for a dense layer).
+typedef struct {
+  unsigned short words;   // uint32_t words of a packed row, ceil(input_channels * kernel_size / 32)
+  const uint32_t *pos;    // [filters][words], weights equal to +scale
+  const uint32_t *neg;    // [filters][words], weights equal to -scale; NULL for binary weights,
+                          // whose weights not in pos are all -scale
+  const number_t *scale;  // [filters], in the fixed-point format of the original weights
+} ternary_weights_t;
+
+// Int8 weights of a conv1d or dense layer and the int8 quantization of its input, generated by
+// tools/int8_weights.py into weights/int8.c from calibration clips. The kernel rows of a conv are
+// [tap][channel], padded with zero weights to row bytes and to a multiple of 8 filters.
+typedef struct {
+  unsigned short row;            // bytes of a kernel row, input_channels * kernel_size rounded up to 32
+  const int8_t *kernel;          // [filters][row], symmetric: scale per filter, no zero point
+  const int32_t *offset;         // [filters] input_zero_point * sum of the row
+  const int32_t *multiplier;     // [filters] accumulator of the int16 weights = ((dot - offset) * multiplier) >> shift
+  unsigned char shift;           // at most 32
+  int32_t input_multiplier;      // q = clamp(((x * input_multiplier) >> input_shift) + input_zero_point, 0, input_max)
+  unsigned char input_shift;
+  unsigned char input_zero_point;
+  unsigned char input_max;       // at most 255, lowered so that no pair of products saturates int16
+} int8_weights_t;
+
+// Block-sparse weights of a conv1d or dense layer, pruned by tools/sparse_weights.py into
+// weights/sparse.c. The rows of the kernel (filters, units) go by groups of rows and each row by
+// blocks of cols weights: the kernel_size taps of one input channel of a conv, or the pair of
+// inputs 2 * index, 2 * index + 1 of a dense layer. Only the blocks with a nonzero weight in one
+// of the rows of their group are stored.
+typedef struct {
+  unsigned char rows;           // rows per group, the last group padded with zero rows
+  unsigned char cols;           // weights per row of a block, kernel_size of a conv, 2 of a dense layer
+  const unsigned short *start;  // [groups + 1] first block of each group, start[groups] blocks in all
+  const unsigned short *index;  // [blocks] input channel of a conv block, input pair of a dense one
+  const number_t *values;       // [blocks][rows][cols]
+} sparse_weights_t;
+
+#endif//__LAYER_PARAMS_H__
@@ -0,0 +1,545 @@
+/**
+  ******************************************************************************
+  * @file    layers.hpp
+  * @version 1.0.0
+  * @date    17 october 2026
+  * @brief   Header-only C++ templates for the generated layer kinds
+  *
+  * Each layer is a type whose shapes are template parameters, so the compiler sees
+  * constant trip counts (tap loops are unrolled) and output types are derived from
+  * the input ones. Sequential<...> chains layers into a typed pipeline and checks at
+  * compile time that every layer accepts the output of the previous one; a Conv1D
+  * directly followed by a MaxPool1D over its output runs as one fused stage, together
+  * with the MaxPool1D producing its input if any. Arithmetic
+  * is the same as the generated conv1d_*.c/max_pooling1d_*.c/... files, bit for bit.
+  * Needs C++17 (fold expressions, if constexpr); enabled in model.c with -DCNN_TEMPLATE_LAYERS.
+  */
+
+#ifndef __LAYERS_HPP__
+#define __LAYERS_HPP__
+
+#include <array>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#ifndef SINGLE_FILE
+#include "number.h"
+#include "layer_params.h"
+#include "requant_simd.h"
+#include "maxpool1d_simd.h"
+#include "conv1d_simd.h"
+#include "ternary.h"
+#include "int8.h"
+#include "sparse.h"
+#include "dsp.h"
+#include "autotune.h"
+#include "dense_gemm.h"
+#endif
+
+namespace cnn_layers {
+
+enum class Activation { Linear, Relu };
+
+// Sum of in[X] * w[X] over the tap indices, expanded at compile time
+template<int... X>
+static inline long_number_t taps(const number_t *in, const number_t *w, std::integer_sequence<int, X...>) {
+  return (0 + ... + (long_number_t)(in[X] * w[X]));
+}
+
+// Shift: fractional bits of the input plus those of the kernel minus those of the output, the
+// FIXED_POINT of every layer unless -DCNN_LAYER_FORMATS gives them their own formats
+template<int Cin, int Len, int Cout, int K, int Stride, Activation Act, int Shift = FIXED_POINT>
+struct Conv1D {
+  static_assert(Len >= K, "Conv1D input shorter than its kernel");
+
+  static constexpr int input_channels = Cin;
+  static constexpr int input_samples = Len;
+  static constexpr int filters = Cout;
+  static constexpr int kernel_size = K;
+  static constexpr int stride = Stride;
+  static constexpr int outsamples = (Len - K) / Stride + 1;
+
+  typedef number_t input_type[Cin][Len];
+  typedef number_t output_type[Cout][outsamples];
+  typedef number_t kernel_type[Cout][Cin][K];
+  typedef number_t bias_type[Cout];
+
+  static constexpr conv1d_params_t params = {
+    Cin, Len, Cout, K, Stride, 0, 0, outsamples,
+    Act == Activation::Relu ? ACTIVATION_KIND_RELU : ACTIVATION_KIND_LINEAR,
+    Shift,
+  };
+
+  const number_t (*kernel)[Cin][K];          // nullptr for the layers that run on their ternary, int8 or sparse weights only
+  const bias_type &bias;
+  const ternary_weights_t *ternary = nullptr; // weights/ternary.c with -DCNN_TERNARY, run instead of kernel
+  const int8_weights_t *int8 = nullptr;       // weights/int8.c with -DCNN_INT8, same
+  const sparse_weights_t *sparse = nullptr;   // weights/sparse.c with -DCNN_SPARSE, same
+  const conv1d_tile_t *tile = nullptr;        // cache tiles of the vector kernel, nullptr for the defaults
+  const conv1d_choice_t *choice = nullptr;    // kernel picked by cnn_autotune() for the fused stages, -DCNN_AUTOTUNE
+
+  // Accumulator of output sample pos_x of filter k, before requantization
+  long_number_t acc(const input_type &input, int k, int pos_x) const {
+    long_number_t output_acc = 0;
+    for (int z = 0; z < Cin; z++)
+      output_acc += taps(&input[z][pos_x * Stride], kernel[k][z], std::make_integer_sequence<int, K>());
+    return output_acc;
+  }
+
+  // Accumulator of filter k for the input samples under the kernel
+  long_number_t acc(const number_t (&window)[Cin][K], int k) const {
+    long_number_t output_acc = 0;
+    for (int z = 0; z < Cin; z++)
+      output_acc += taps(window[z], kernel[k][z], std::make_integer_sequence<int, K>());
+    return output_acc;
+  }
+
+  void operator()(const input_type &input, output_type &output) const {
+    // The generated conv1d_<n>.c checks at build time that the ternary, int8 or sparse kernel takes the layer
+    if (ternary != nullptr) {
+      conv1d_maxpool1d_ternary(nullptr, &params, nullptr, ternary, &input[0][0], bias, &output[0][0]);
+      return;
+    }
+    if (int8 != nullptr) {
+      conv1d_maxpool1d_int8(nullptr, &params, nullptr, int8, &input[0][0], bias, &output[0][0]);
+      return;
+    }
+    if (sparse != nullptr) {
+      conv1d_maxpool1d_sparse(nullptr, &params, nullptr, sparse, &input[0][0], bias, &output[0][0]);
+      return;
+    }
+#ifdef CNN_SIMD
+    if (conv1d_simd(&params, tile, &input[0][0], &kernel[0][0][0], bias, &output[0][0]))
+      return;
+#endif
+#ifdef CNN_DSP
+    if (conv1d_maxpool1d_dsp(nullptr, &params, nullptr, &input[0][0], &kernel[0][0][0], bias, &output[0][0]))
+      return;
+#endif
+    long_number_t output_acc[outsamples];
+    for (int k = 0; k < Cout; k++) {
+      for (int pos_x = 0; pos_x < outsamples; pos_x++)
+        output_acc[pos_x] = acc(input, k, pos_x);
+      requant_simd_row(output[k], output_acc, outsamples, Shift, &bias[k], 0, Act == Activation::Relu);
+    }
+  }
+};
+
+template<int Channels, int Len, int Pool, int Stride>
+struct MaxPool1D {
+  static constexpr int input_channels = Channels;
+  static constexpr int input_samples = Len;
+  static constexpr int pool_size = Pool;
+  static constexpr int stride = Stride;
+  static constexpr int pool_length = (Len - Pool) / Stride + 1;
+
+  typedef number_t input_type[Channels][Len];
+  typedef number_t output_type[Channels][pool_length];
+
+  static constexpr maxpool1d_params_t params = {
+    Channels, Len, Pool, Stride, pool_length, ACTIVATION_KIND_LINEAR,
+  };
+
+  void operator()(const input_type &input, output_type &output) const {
+#ifdef CNN_SIMD
+    if (maxpool1d_simd(&params, &input[0][0], &output[0][0]))
+      return;
+#endif
+    for (int k = 0; k < Channels; k++) {
+      for (int pos_x = 0; pos_x < pool_length; pos_x++) {
+        number_t max = input[k][pos_x * Stride];
+        for (int x = 1; x < Pool; x++)
+          if (max < input[k][pos_x * Stride + x])
+            max = input[k][pos_x * Stride + x];
+        output[k][pos_x] = max;
+      }
+    }
+  }
+};
+
+template<int Channels, int Len, int Pool, int Stride>
+struct AvgPool1D {
+  static constexpr int input_channels = Channels;
+  static constexpr int pool_length = (Len - Pool) / Stride + 1;
+
+  typedef number_t input_type[Channels][Len];
+  typedef number_t output_type[Channels][pool_length];
+
+  void operator()(const input_type &input, output_type &output) const {
+    for (int k = 0; k < Channels; k++) {
+      for (int pos_x = 0; pos_x < pool_length; pos_x++) {
+        long_number_t tmp = 0;
+        for (int x = 0; x < Pool; x++)
+          tmp += input[k][pos_x * Stride + x];
+        output[k][pos_x] = clamp_to_number_t(tmp / Pool);
+      }
+    }
+  }
+};
+
+template<int Channels, int Len>
+struct Flatten {
+  typedef number_t input_type[Channels][Len];
+  typedef number_t output_type[Channels * Len];
+
+  void operator()(const input_type &input, output_type &output) const {
+    for (int i = 0; i < Channels * Len; i++)
+      output[i] = (&input[0][0])[i];
+  }
+};
+
+template<int In, int Units, Activation Act, int Shift = FIXED_POINT>
+struct Dense {
+  typedef number_t input_type[In];
+  typedef number_t output_type[Units];
+  typedef number_t kernel_type[Units][In];
+  typedef number_t bias_type[Units];
+
+  const number_t (*kernel)[In];              // nullptr for the layers that run on their ternary, int8 or sparse weights only
+  const bias_type &bias;
+  const ternary_weights_t *ternary = nullptr; // weights/ternary.c with -DCNN_TERNARY, run instead of kernel
+  const int8_weights_t *int8 = nullptr;       // weights/int8.c with -DCNN_INT8, same
+  const sparse_weights_t *sparse = nullptr;   // weights/sparse.c with -DCNN_SPARSE, same
+  const number_t *panels = nullptr;           // weights/dense_<n>_panels.c, kernel packed for dense_gemm
+
+  static constexpr int ldacc = DENSE_GEMM_LDACC(Units);
+  static constexpr int batch_rows = 8;        // rows of one dense_gemm call in batch()
+
+  void operator()(const input_type &input, output_type &output) const {
+    long_number_t output_acc[ldacc];
+    if (ternary != nullptr) {
+      dense_ternary(ternary, In, Units, input, output_acc);
+    } else if (int8 != nullptr) {
+      dense_int8(int8, In, Units, input, output_acc);
+    } else if (sparse != nullptr) {
+      dense_sparse(sparse, In, Units, input, output_acc);
+    } else {
+      dense_gemm(&kernel[0][0], panels, In, Units, 1, input, In, output_acc, ldacc);
+    }
+    requant_simd_row(output, output_acc, Units, Shift, bias, 1, Act == Activation::Relu);
+  }
+
+  // n inputs at input + b * input_stride bytes, outputs likewise: one GEMM per batch_rows inputs,
+  // so that each weight is loaded once for all of them
+  void batch(std::size_t n, const unsigned char *input, std::size_t input_stride,
+             unsigned char *output, std::size_t output_stride) const {
+    alignas(32) long_number_t output_acc[batch_rows][ldacc];
+    for (std::size_t b = 0; b < n; b += batch_rows) {
+      const int rows = n - b < batch_rows ? int(n - b) : batch_rows;
+      if (ternary != nullptr || int8 != nullptr || sparse != nullptr || input_stride % sizeof(number_t) != 0) {
+        for (int r = 0; r < rows; r++)
+          (*this)(*reinterpret_cast<const input_type *>(input + (b + r) * input_stride),
+                  *reinterpret_cast<output_type *>(output + (b + r) * output_stride));
+        continue;
+      }
+      dense_gemm(&kernel[0][0], panels, In, Units, rows, reinterpret_cast<const number_t *>(input + b * input_stride),
+                 int(input_stride / sizeof(number_t)), &output_acc[0][0], ldacc);
+      for (int r = 0; r < rows; r++)
+        requant_simd_row(reinterpret_cast<number_t *>(output + (b + r) * output_stride), output_acc[r], Units, Shift,
+                         bias, 1, Act == Activation::Relu);
+    }
+  }
+};
+
+// Whether a stage runs a whole batch in one call (Dense::batch)
+template<class Stage, class = void>
+struct runs_batch : std::false_type {};
+
+template<class Stage>
+struct runs_batch<Stage, std::void_t<decltype(std::declval<const Stage &>().batch(
+    std::size_t(), (const unsigned char *)nullptr, std::size_t(), (unsigned char *)nullptr, std::size_t()))>>
+    : std::true_type {};
+
+// Whether layer B is a max pooling of the whole output of the conv A
+template<class A, class B>
+struct fuses : std::false_type {};
+
+template<int Cin, int Len, int Cout, int K, int Stride, Activation Act, int Shift, int Channels, int PoolLen, int Pool, int PoolStride>
+struct fuses<Conv1D<Cin, Len, Cout, K, Stride, Act, Shift>, MaxPool1D<Channels, PoolLen, Pool, PoolStride>>
+  : std::bool_constant<Channels == Cout && PoolLen == Conv1D<Cin, Len, Cout, K, Stride, Act, Shift>::outsamples> {};
+
+// Whether the conv B reads the whole output of the max pooling A
+template<class A, class B>
+struct fuses_input : std::false_type {};
+
+template<int Channels, int PoolLen, int Pool, int PoolStride, int Cin, int Len, int Cout, int K, int Stride, Activation Act, int Shift>
+struct fuses_input<MaxPool1D<Channels, PoolLen, Pool, PoolStride>, Conv1D<Cin, Len, Cout, K, Stride, Act, Shift>>
+  : std::bool_constant<Channels == Cin && Len == MaxPool1D<Channels, PoolLen, Pool, PoolStride>::pool_length> {};
+
+// Conv followed by a max pooling of its output as one stage: each pooled sample is the max of
+// the conv outputs under the pool, which are never stored
+template<class Conv, class Pool>
+struct Conv1DMaxPool1D {
+  static_assert(fuses<Conv, Pool>::value, "max pooling does not match the conv output");
+
+  typedef typename Conv::input_type input_type;
+  typedef typename Pool::output_type output_type;
+
+  const Conv &conv;
+
+  void operator()(const input_type &input, output_type &output) const {
+    if (conv.ternary != nullptr) {
+      conv1d_maxpool1d_ternary(nullptr, &Conv::params, &Pool::params, conv.ternary, &input[0][0], conv.bias, &output[0][0]);
+      return;
+    }
+    if (conv.int8 != nullptr) {
+      conv1d_maxpool1d_int8(nullptr, &Conv::params, &Pool::params, conv.int8, &input[0][0], conv.bias, &output[0][0]);
+      return;
+    }
+    if (conv.sparse != nullptr) {
+      conv1d_maxpool1d_sparse(nullptr, &Conv::params, &Pool::params, conv.sparse, &input[0][0], conv.bias, &output[0][0]);
+      return;
+    }
+#ifdef CNN_AUTOTUNE
+    if (conv.choice != nullptr
+        && conv1d_maxpool1d_tuned(conv.choice, nullptr, &Conv::params, &Pool::params, &input[0][0], &conv.kernel[0][0][0], conv.bias, &output[0][0]))
+      return;
+#endif
+#ifdef CNN_SIMD
+    if (conv1d_maxpool1d_simd(nullptr, &Conv::params, &Pool::params, conv.tile, &input[0][0], &conv.kernel[0][0][0], conv.bias, &output[0][0]))
+      return;
+#endif
+#ifdef CNN_DSP
+    if (conv1d_maxpool1d_dsp(nullptr, &Conv::params, &Pool::params, &input[0][0], &conv.kernel[0][0][0], conv.bias, &output[0][0]))
+      return;
+#endif
+    // The requantization is monotonic, the max is taken on the accumulators
+    long_number_t output_acc[Pool::pool_length];
+    for (int k = 0; k < Conv::filters; k++) {
+      for (int pos_x = 0; pos_x < Pool::pool_length; pos_x++) {
+        long_number_t max = conv.acc(input, k, pos_x * Pool::stride);
+        for (int x = 1; x < Pool::pool_size; x++) {
+          long_number_t tmp = conv.acc(input, k, pos_x * Pool::stride + x);
+          if (max < tmp)
+            max = tmp;
+        }
+        output_acc[pos_x] = max;
+      }
+      requant_simd_row(output[k], output_acc, Pool::pool_length, Conv::params.requant_shift, &conv.bias[k], 0, Conv::params.activation == ACTIVATION_KIND_RELU);
+    }
+  }
+};
+
+// Same with the max pooling InPool of the conv input computed under the kernel as well, so that
+// neither the pooled input nor the conv output is stored
+template<class InPool, class Conv, class Pool>
+struct MaxPool1DConv1DMaxPool1D {
+  static_assert(fuses_input<InPool, Conv>::value, "conv input does not match the max pooling output");
+  static_assert(fuses<Conv, Pool>::value, "max pooling does not match the conv output");
+
+  typedef typename InPool::input_type input_type;
+  typedef typename Pool::output_type output_type;
+
+  const Conv &conv;
+
+  void operator()(const input_type &input, output_type &output) const {
+    if (conv.ternary != nullptr) {
+      conv1d_maxpool1d_ternary(&InPool::params, &Conv::params, &Pool::params, conv.ternary, &input[0][0], conv.bias, &output[0][0]);
+      return;
+    }
+    if (conv.int8 != nullptr) {
+      conv1d_maxpool1d_int8(&InPool::params, &Conv::params, &Pool::params, conv.int8, &input[0][0], conv.bias, &output[0][0]);
+      return;
+    }
+    if (conv.sparse != nullptr) {
+      conv1d_maxpool1d_sparse(&InPool::params, &Conv::params, &Pool::params, conv.sparse, &input[0][0], conv.bias, &output[0][0]);
+      return;
+    }
+#ifdef CNN_AUTOTUNE
+    if (conv.choice != nullptr
+        && conv1d_maxpool1d_tuned(conv.choice, &InPool::params, &Conv::params, &Pool::params, &input[0][0], &conv.kernel[0][0][0], conv.bias, &output[0][0]))
+      return;
+#endif
+#ifdef CNN_SIMD
+    if (conv1d_maxpool1d_simd(&InPool::params, &Conv::params, &Pool::params, conv.tile, &input[0][0], &conv.kernel[0][0][0], conv.bias, &output[0][0]))
+      return;
+#endif
+#ifdef CNN_DSP
+    if (conv1d_maxpool1d_dsp(&InPool::params, &Conv::params, &Pool::params, &input[0][0], &conv.kernel[0][0][0], conv.bias, &output[0][0]))
+      return;
+#endif
+    number_t window[Conv::input_channels][Conv::kernel_size];
+    long_number_t pooled_acc[Conv::filters];
+    number_t pooled[Conv::filters];
+
+    for (int pos_x = 0; pos_x < Pool::pool_length; pos_x++) {
+      for (int w = 0; w < Pool::pool_size; w++) {
+        const int conv_x = pos_x * Pool::stride + w;
+        for (int z = 0; z < Conv::input_channels; z++) {
+          for (int x = 0; x < Conv::kernel_size; x++) {
+            const number_t *in = &input[z][(conv_x * Conv::stride + x) * InPool::stride];
+            number_t max = in[0];
+            for (int y = 1; y < InPool::pool_size; y++)
+              if (max < in[y])
+                max = in[y];
+            window[z][x] = max;
+          }
+        }
+        for (int k = 0; k < Conv::filters; k++) {
+          long_number_t tmp = conv.acc(window, k);
+          if (w == 0 || pooled_acc[k] < tmp)
+            pooled_acc[k] = tmp;
+        }
+      }
+      requant_simd_row(pooled, pooled_acc, Conv::filters, Conv::params.requant_shift, conv.bias, 1, Conv::params.activation == ACTIVATION_KIND_RELU);
+      for (int k = 0; k < Conv::filters; k++)
+        output[k][pos_x] = pooled[k];
+    }
+  }
+};
+
+// Layers run in order, intermediate results alternate between two scratch buffers like the
+// activations1/activations2 unions of the generated cnn(). A conv is grouped with the max pooling
+// of its output and, when it has one, the max pooling of its input: only the last output of a
+// group is stored, the alternation goes on with the next group.
+template<class... Layers>
+struct Sequential {
+  typedef std::tuple<Layers...> layers_type;
+  static constexpr std::size_t depth = sizeof...(Layers);
+
+  template<std::size_t I>
+  using layer = std::tuple_element_t<I, layers_type>;
+
+  typedef typename layer<0>::input_type input_type;
+  typedef typename layer<depth - 1>::output_type output_type;
+
+ private:
+  template<std::size_t... I>
+  static constexpr bool chained(std::index_sequence<I...>) {
+    return (true && ... && std::is_same_v<typename layer<I>::output_type, typename layer<I + 1>::input_type>);
+  }
+  static_assert(chained(std::make_index_sequence<depth - 1>()), "layer input does not match the previous output");
+
+  // Number of layers run as one stage from layer I
+  template<std::size_t I>
+  static constexpr std::size_t group() {
+    if constexpr (I + 2 < depth) {
+      if constexpr (fuses_input<layer<I>, layer<I + 1>>::value && fuses<layer<I + 1>, layer<I + 2>>::value)
+        return 3;
+    }
+    if constexpr (I + 1 < depth) {
+      if constexpr (fuses<layer<I>, layer<I + 1>>::value)
+        return 2;
+    }
+    return 1;
+  }
+
+  template<std::size_t... I>
+  static constexpr std::array<std::size_t, depth> groups(std::index_sequence<I...>) { return {{group<I>()...}}; }
+  template<std::size_t... I>
+  static constexpr std::array<std::size_t, depth> output_bytes(std::index_sequence<I...>) {
+    return {{sizeof(typename layer<I>::output_type)...}};
+  }
+
+  // Scratch buffer (0 even, 1 odd) receiving the output of the stage starting at layer i
+  static constexpr std::size_t slot(std::size_t i) {
+    constexpr std::array<std::size_t, depth> n = groups(std::make_index_sequence<depth>());
+    std::size_t stored = 0;
+    for (std::size_t j = 0; j < i; j += n[j])
+      stored++;
+    return stored % 2;
+  }
+
+  static constexpr std::size_t scratch_bytes(std::size_t parity) {
+    constexpr std::array<std::size_t, depth> n = groups(std::make_index_sequence<depth>());
+    constexpr std::array<std::size_t, depth> out = output_bytes(std::make_index_sequence<depth>());
+    std::size_t bytes = 0;
+    for (std::size_t j = 0; j + n[j] < depth; j += n[j])
+      if (slot(j) == parity && out[j + n[j] - 1] > bytes)
+        bytes = out[j + n[j] - 1];
+    return bytes;
+  }
+
+ public:
+  // Sizes of the two buffers, for callers providing their own memory
+  static constexpr std::size_t even_bytes = scratch_bytes(0);
+  static constexpr std::size_t odd_bytes = scratch_bytes(1);
+
+  struct scratch_type {
+    alignas(32) unsigned char even[even_bytes + 1];
+    alignas(32) unsigned char odd[odd_bytes + 1];
+  };
+
+  layers_type layers;
+
+  explicit Sequential(Layers... l) : layers(l...) {}
+
+  void operator()(const input_type &input, output_type &output, scratch_type &scratch) const {
+    run<0>(input, output, scratch.even, scratch.odd);
+  }
+
+  // even/odd hold at least even_bytes/odd_bytes
+  void operator()(const input_type &input, output_type &output, void *even, void *odd) const {
+    run<0>(input, output, even, odd);
+  }
+
+  // n inputs run stage by stage, so that the weights of a stage stay in cache across the batch.
+  // The buffers of input b are at even + b * stride and odd + b * stride.
+  void operator()(std::size_t n, const input_type *inputs, output_type *outputs, void *even, void *odd, std::size_t stride) const {
+    run_batch<0>(n, inputs, outputs, static_cast<unsigned char *>(even), static_cast<unsigned char *>(odd), stride);
+  }
+
+ private:
+  // Layer I alone or the fused stage starting at it
+  template<std::size_t I>
+  auto stage() const {
+    if constexpr (group<I>() == 3)
+      return MaxPool1DConv1DMaxPool1D<layer<I>, layer<I + 1>, layer<I + 2>>{std::get<I + 1>(layers)};
+    else if constexpr (group<I>() == 2)
+      return Conv1DMaxPool1D<layer<I>, layer<I + 1>>{std::get<I>(layers)};
+    else
+      return std::get<I>(layers);
+  }
+
+  template<std::size_t I>
+  void run(const typename layer<I>::input_type &input, output_type &output, void *even, void *odd) const {
+    constexpr std::size_t next_layer = I + group<I>();
+    if constexpr (next_layer == depth) {
+      stage<I>()(input, output);
+    } else {
+      auto &next = *static_cast<typename layer<next_layer - 1>::output_type *>(slot(I) == 0 ? even : odd);
+      stage<I>()(input, next);
+      run<next_layer>(next, output, even, odd);
+    }
+  }
+
+  template<std::size_t I>
+  void run_batch(std::size_t n, const input_type *inputs, output_type *outputs,
+                 unsigned char *even, unsigned char *odd, std::size_t stride) const {
+    constexpr std::size_t next_layer = I + group<I>();
+    typedef typename layer<I>::input_type stage_input;
+    typedef typename layer<next_layer - 1>::output_type stage_output;
+    const auto s = stage<I>();
+
+    if constexpr (runs_batch<decltype(s)>::value) {
+      const unsigned char *input;
+      if constexpr (I == 0)
+        input = reinterpret_cast<const unsigned char *>(inputs);
+      else
+        input = slot(I) == 0 ? odd : even;
+      if constexpr (next_layer == depth)
+        s.batch(n, input, I == 0 ? sizeof(stage_input) : stride, reinterpret_cast<unsigned char *>(outputs), sizeof(stage_output));
+      else
+        s.batch(n, input, I == 0 ? sizeof(stage_input) : stride, slot(I) == 0 ? even : odd, stride);
+    } else for (std::size_t b = 0; b < n; b++) {
+      // The previous stage wrote to the other buffer
+      const stage_input *input;
+      if constexpr (I == 0)
+        input = &inputs[b];
+      else
+        input = reinterpret_cast<const stage_input *>((slot(I) == 0 ? odd : even) + b * stride);
+      if constexpr (next_layer == depth)
+        s(*input, outputs[b]);
+      else
+        s(*input, *reinterpret_cast<stage_output *>((slot(I) == 0 ? even : odd) + b * stride));
+    }
+    if constexpr (next_layer < depth)
+      run_batch<next_layer>(n, inputs, outputs, even, odd, stride);
+  }
+};
+
+} // namespace cnn_layers
+
+#endif//__LAYERS_HPP__
@@ -0,0 +1,155 @@
+/**
+  ******************************************************************************
+  * @file    max_pooling1d_145_conv1d_116_max_pooling1d_146.c
+  * @version 1.0.0
+  * @date    17 october 2026
+  * @brief   max_pooling1d_145, conv1d_116 and max_pooling1d_146 fused: the pooled input
+  *          samples are computed under the conv kernel and each output sample is the max
+  *          of the conv outputs under the second pool, neither buffer is materialized
+  */
+
+#ifndef SINGLE_FILE
+#include "number.h"
+#include "layer_params.h"
+#include "conv1d_simd.h"
+#include "requant_simd.h"
+#include "ternary.h"
+#include "int8.h"
+#include "sparse.h"
+#include "dsp.h"
+#include "autotune.h"
+#endif
+
+#define INPUT_CHANNELS      1
+#define INPUT_SAMPLES       16000
+#define POOL_SIZE           2
+#define POOL_STRIDE         2
+#define POOL_LENGTH         ( ( (INPUT_SAMPLES - POOL_SIZE) / POOL_STRIDE ) + 1 )
+#define CONV_FILTERS        16
+#define CONV_KERNEL_SIZE    20
+#define CONV_STRIDE         8
+#define CONV_OUTSAMPLES     ( ( (POOL_LENGTH - CONV_KERNEL_SIZE) / CONV_STRIDE ) + 1 )
+#define OUTPUT_POOL_SIZE    2
+#define OUTPUT_POOL_STRIDE  2
+#define OUTPUT_POOL_LENGTH  ( ( (CONV_OUTSAMPLES - OUTPUT_POOL_SIZE) / OUTPUT_POOL_STRIDE ) + 1 )
+
+#define ACTIVATION_RELU
+
+#ifdef CNN_AUTOTUNE
+// Kernel of conv1d_116 picked by cnn_autotune(), see autotune.h
+static conv1d_choice_t conv1d_116_choice = {
+  CONV1D_KERNEL_DEFAULT,
+  CONV1D_CHOICE_TILE(conv1d_116_tile),
+  &conv1d_116_accum_plan,
+  NULL,
+};
+#endif
+
+static inline void max_pooling1d_145_conv1d_116_max_pooling1d_146(
+  const number_t input[INPUT_CHANNELS][INPUT_SAMPLES],                   // IN
+  const number_t kernel[CONV_FILTERS][INPUT_CHANNELS][CONV_KERNEL_SIZE], // IN
+
+  const number_t bias[CONV_FILTERS],                                     // IN
+
+  number_t output[CONV_FILTERS][OUTPUT_POOL_LENGTH]) {                  // OUT
+
+  unsigned short pos_x, z, k, x, y, w;
+  unsigned int input_x;
+  number_t window[INPUT_CHANNELS][CONV_KERNEL_SIZE]; // pooled samples under the kernel
+  number_t max, tmp;
+  long_number_t output_acc;
+  long_number_t pooled_acc[CONV_FILTERS]; // max_pooling1d_146 of the conv accumulators of each filter
+  number_t pooled[CONV_FILTERS];
+
+#ifdef CONV1D_116_TERNARY
+  // -DCNN_TERNARY: sign-select kernel on the ternary weights of weights/ternary.c, the only
+  // weights of the layer (kernel is NULL)
+  conv1d_maxpool1d_ternary(&max_pooling1d_145_params, &conv1d_116_params, &max_pooling1d_146_params, &conv1d_116_ternary, &input[0][0], bias, &output[0][0]);
+  return;
+#endif
+
+#ifdef CONV1D_116_INT8
+  // -DCNN_INT8: int8 kernel on the weights and input quantization of weights/int8.c, the only
+  // weights of the layer (kernel is NULL)
+  conv1d_maxpool1d_int8(&max_pooling1d_145_params, &conv1d_116_params, &max_pooling1d_146_params, &conv1d_116_int8, &input[0][0], bias, &output[0][0]);
+  return;
+#endif
+
+#ifdef CONV1D_116_SPARSE
+  // -DCNN_SPARSE: zero-skipping kernel on the block-sparse weights of weights/sparse.c, the only
+  // weights of the layer (kernel is NULL)
+  conv1d_maxpool1d_sparse(&max_pooling1d_145_params, &conv1d_116_params, &max_pooling1d_146_params, &conv1d_116_sparse, &input[0][0], bias, &output[0][0]);
+  return;
+#endif
+
+#ifdef CNN_AUTOTUNE
+  // -DCNN_AUTOTUNE: kernel measured fastest on this CPU, the chain below when it is the default
+  if (conv1d_maxpool1d_tuned(&conv1d_116_choice, &max_pooling1d_145_params, &conv1d_116_params, &max_pooling1d_146_params, &input[0][0], &kernel[0][0][0], bias, &output[0][0]))
+    return;
+#endif
+
+#ifdef CNN_SIMD
+  if (conv1d_maxpool1d_simd(&max_pooling1d_145_params, &conv1d_116_params, &max_pooling1d_146_params, &conv1d_116_tile,
+                            &input[0][0], &kernel[0][0][0], bias, &output[0][0]))
+    return;
+#endif
+
+#ifdef CNN_DSP
+  // Without a vector ISA: SMLAD kernel of dsp.h, on the Cortex-M4 or its emulation (-DCNN_DSP)
+  if (conv1d_maxpool1d_dsp(&max_pooling1d_145_params, &conv1d_116_params, &max_pooling1d_146_params, &input[0][0], &kernel[0][0][0], bias, &output[0][0]))
+    return;
+#endif
+
+  for (pos_x = 0; pos_x < OUTPUT_POOL_LENGTH; pos_x++) {
+    for (w = 0; w < OUTPUT_POOL_SIZE; w++) {
+      // max_pooling1d_145 restricted to the window of conv output position pos_x * OUTPUT_POOL_STRIDE + w
+      for (z = 0; z < INPUT_CHANNELS; z++) {
+        for (x = 0; x < CONV_KERNEL_SIZE; x++) {
+          input_x = ((pos_x * OUTPUT_POOL_STRIDE + w) * CONV_STRIDE + x) * POOL_STRIDE;
+          max = input[z][input_x];
+          for (y = 1; y < POOL_SIZE; y++) {
+            tmp = input[z][input_x + y];
+            if (max < tmp)
+              max = tmp;
+          }
+          window[z][x] = max;
+        }
+      }
+
+      for (k = 0; k < CONV_FILTERS; k++) {
+        output_acc = 0;
+        for (z = 0; z < INPUT_CHANNELS; z++)
+          for (x = 0; x < CONV_KERNEL_SIZE; x++)
+            output_acc = output_acc + window[z][x] * kernel[k][z][x];
+
+        // max_pooling1d_146 is linear and the requantization monotonic: the max is taken on the
+        // accumulators, the first conv output under the pool initializes it
+        if (w == 0 || pooled_acc[k] < output_acc)
+          pooled_acc[k] = output_acc;
+      }
+    }
+
+#ifdef ACTIVATION_LINEAR
+    requant_simd_row(pooled, pooled_acc, CONV_FILTERS, CONV1D_116_REQUANT_SHIFT, bias, 1, 0);
+#elif defined(ACTIVATION_RELU)
+    // Activation function: ReLU
+    requant_simd_row(pooled, pooled_acc, CONV_FILTERS, CONV1D_116_REQUANT_SHIFT, bias, 1, 1);
+#endif
+    for (k = 0; k < CONV_FILTERS; k++)
+      output[k][pos_x] = pooled[k];
+  }
+}
+
+#undef INPUT_CHANNELS
+#undef INPUT_SAMPLES
+#undef POOL_SIZE
+#undef POOL_STRIDE
+#undef POOL_LENGTH
+#undef CONV_FILTERS
+#undef CONV_KERNEL_SIZE
+#undef CONV_STRIDE
+#undef CONV_OUTSAMPLES
+#undef OUTPUT_POOL_SIZE
+#undef OUTPUT_POOL_STRIDE
+#undef OUTPUT_POOL_LENGTH
+#undef ACTIVATION_RELU
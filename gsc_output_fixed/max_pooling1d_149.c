@@ -9,6 +9,8 @@
 
 #ifndef SINGLE_FILE
 #include "number.h"
+#include "layer_params.h"
+#include "maxpool1d_simd.h"
 #endif
 
 #define INPUT_CHANNELS  128
@@ -22,6 +24,15 @@
 
 typedef number_t max_pooling1d_149_output_type[INPUT_CHANNELS][POOL_LENGTH];
 
+static const maxpool1d_params_t max_pooling1d_149_params = {
+  INPUT_CHANNELS, INPUT_SAMPLES, POOL_SIZE, POOL_STRIDE, POOL_LENGTH,
+#ifdef ACTIVATION_RELU
+  ACTIVATION_KIND_RELU,
+#else
+  ACTIVATION_KIND_LINEAR,
+#endif
+};
+
 static inline void max_pooling1d_149(
   const number_t input[INPUT_CHANNELS][INPUT_SAMPLES], 	    // IN
   number_t output[INPUT_CHANNELS][POOL_LENGTH]) {	// OUT
@@ -30,6 +41,12 @@ static inline void max_pooling1d_149(
   unsigned int x;
   number_t max, tmp; 
 
+#ifdef CNN_SIMD
+  // Vectorized kernel of the running CPU, the loops below are the scalar fallback
+  if (maxpool1d_simd(&max_pooling1d_149_params, &input[0][0], &output[0][0]))
+    return;
+#endif
+
   for (k = 0; k < INPUT_CHANNELS; k++) 
     for (pos_x = 0; pos_x < POOL_LENGTH; pos_x++) {
 #ifdef ACTIVATION_LINEAR
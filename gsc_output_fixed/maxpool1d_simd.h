@@ -0,0 +1,96 @@
+/**
+  ******************************************************************************
+  * @file    maxpool1d_simd.h
+  * @version 1.0.0
+  * @date    17 october 2026
+  * @brief   SSE4.1/AVX2 int16 max pooling kernels, bit-exact with the generated scalar loops
+  */
+
+#ifndef __MAXPOOL1D_SIMD_H__
+#define __MAXPOOL1D_SIMD_H__
+
+#ifndef SINGLE_FILE
+#include "number.h"
+#include "layer_params.h"
+#include "simd.h"
+#endif
+
+#ifdef CNN_SIMD
+
+#define SIMD_ISA(name) name##_portable
+#define SIMD_LANES 4
+#include "maxpool1d_simd_isa.h"
+#undef SIMD_ISA
+#undef SIMD_LANES
+
+#ifdef CNN_SIMD_X86
+
+#pragma GCC push_options
+#pragma GCC target("sse4.1")
+#define SIMD_ISA(name) name##_sse41
+#define SIMD_LANES 4
+#include "maxpool1d_simd_isa.h"
+#undef SIMD_ISA
+#undef SIMD_LANES
+#pragma GCC pop_options
+
+#pragma GCC push_options
+#pragma GCC target("avx2")
+#define SIMD_ISA(name) name##_avx2
+#define SIMD_LANES 8
+#include "maxpool1d_simd_isa.h"
+#undef SIMD_ISA
+#undef SIMD_LANES
+#pragma GCC pop_options
+
+#endif//CNN_SIMD_X86
+
+// Whether pool is the pool 2 / stride 2 linear max pooling the vector kernels fuse
+static inline int maxpool1d_simd_pool2(const maxpool1d_params_t *pool) {
+  return pool->pool_size == 2 && pool->pool_stride == 2 && pool->activation == ACTIVATION_KIND_LINEAR;
+}
+
+// Pool 2 / stride 2 row with the kernel of the running CPU, which must have a vector ISA
+static inline void maxpool1d_simd_pool2_row(const number_t *in, number_t *out, int samples, int relu) {
+#ifdef CNN_SIMD_X86
+  if (cnn_isa == CNN_ISA_AVX2) {
+    maxpool1d_pool2_row_avx2(in, out, samples, relu);
+    return;
+  }
+  if (cnn_isa == CNN_ISA_SSE41) {
+    maxpool1d_pool2_row_sse41(in, out, samples, relu);
+    return;
+  }
+#endif
+  maxpool1d_pool2_row_portable(in, out, samples, relu);
+}
+
+// Max pooling p of input[input_channels][input_samples] into output[input_channels][pool_length]
+// with the best kernel of the running CPU. Returns 0 when the caller has to fall back to its
+// scalar loops: no vector ISA or pooling other than pool 2 / stride 2.
+static inline int maxpool1d_simd(
+  const maxpool1d_params_t *p,
+  const number_t *input,
+  number_t *output) {
+
+  const int relu = p->activation == ACTIVATION_KIND_RELU;
+  int k;
+
+  if (cnn_isa == CNN_ISA_SCALAR)
+    return 0;
+  if (p->pool_size != 2 || p->pool_stride != 2)
+    return 0;
+
+  // Even rows chain without a gap, the whole tensor is then one row. An odd row (499, 249, 61
+  // samples...) drops its last sample, each row is pooled on its own.
+  if (p->input_samples == 2 * p->pool_length)
+    maxpool1d_simd_pool2_row(input, output, p->input_channels * p->pool_length, relu);
+  else
+    for (k = 0; k < p->input_channels; k++)
+      maxpool1d_simd_pool2_row(input + k * p->input_samples, output + k * p->pool_length, p->pool_length, relu);
+  return 1;
+}
+
+#endif//CNN_SIMD
+
+#endif//__MAXPOOL1D_SIMD_H__
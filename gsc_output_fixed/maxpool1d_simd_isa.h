@@ -0,0 +1,30 @@
+/**
+  ******************************************************************************
+  * @file    maxpool1d_simd_isa.h
+  * @version 1.0.0
+  * @date    17 october 2026
+  * @brief   Vectorized max pooling body, included once per ISA by maxpool1d_simd.h
+  *
+  * Expects SIMD_ISA(name) to append the ISA suffix and SIMD_LANES the number of int32 lanes of
+  * its vectors, which hold 2*SIMD_LANES int16 samples.
+  */
+
+// out[i] = max(in[2i], in[2i+1]), or max(0, in[2i], in[2i+1]) with relu, for i < samples. Only
+// in[0] .. in[2*samples-1] is read: the tail of a row of at least one vector is done by a last
+// vector ending with the row, which overlaps the previous one, shorter rows run scalar.
+static inline void SIMD_ISA(maxpool1d_pool2_row)(const number_t *in, number_t *out, int samples, int relu) {
+  number_t max;
+  int i = 0;
+
+  if (samples >= 2 * SIMD_LANES) {
+    for (; i + 2 * SIMD_LANES <= samples; i += 2 * SIMD_LANES)
+      SIMD_ISA(vstore_pool2)(out + i, in + 2 * i, relu);
+    if (i < samples)
+      SIMD_ISA(vstore_pool2)(out + samples - 2 * SIMD_LANES, in + 2 * (samples - 2 * SIMD_LANES), relu);
+    return;
+  }
+  for (; i < samples; i++) {
+    max = in[2 * i] > in[2 * i + 1] ? in[2 * i] : in[2 * i + 1];
+    out[i] = relu && max < 0 ? 0 : max;
+  }
+}
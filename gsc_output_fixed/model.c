@@ -10,51 +10,499 @@
 #ifndef SINGLE_FILE
 #include "number.h"
 #include "model.h"
+#include "layer_params.h"
+#include "simd.h"
+#include "requant_simd.h"
+#include "thread_pool.h"
+#include "maxpool1d_simd.h"
+#include "conv1d_simd.h"
+#include "conv1d_im2col.h"
+#include "conv1d_winograd.h"
+#include "ternary.h"
+#include "int8.h"
+#include "sparse.h"
+#include "dsp.h"
+#include "conv1d_separable.h"
+#include "softmax.h"
+#include "dense_gemm.h"
+#include "autotune.h"
 
  // InputLayer is excluded
+#include "weights/accum_plan.c" // accumulator widths of the layers, tools/accum_plan.py
+#ifdef CNN_LAYER_FORMATS
+#if defined(CNN_TERNARY) || defined(CNN_INT8) || defined(CNN_SPARSE) || defined(CONV1D_WINOGRAD)
+#error "-DCNN_LAYER_FORMATS: the ternary, int8, sparse and Winograd weights derive from the FIXED_POINT weights"
+#endif
+#include "weights/formats.c" // tools/fixed_point_formats.py, defines <LAYER>_FORMATS and <LAYER>_REQUANT_SHIFT
+#endif
+#if defined(CNN_AUTOTUNE) && (defined(CNN_TERNARY) || defined(CNN_INT8) || defined(CNN_SPARSE))
+#error "-DCNN_AUTOTUNE chooses among the kernels of the int16 weights, the ternary, int8 and sparse layers run first"
+#endif
+#ifdef CNN_TERNARY
+#include "weights/ternary.c" // tools/ternary_weights.py, defines <LAYER>_TERNARY for the converted layers
+#endif
+#ifdef CNN_INT8
+#ifdef CNN_TERNARY
+#error "-DCNN_INT8 and -DCNN_TERNARY both replace the int16 weights of their layers, build with one of them"
+#endif
+#include "weights/int8.c" // tools/int8_weights.py, defines <LAYER>_INT8 for the converted layers
+#endif
+#ifdef CNN_SPARSE
+#if defined(CNN_TERNARY) || defined(CNN_INT8) || defined(CONV1D_WINOGRAD)
+#error "-DCNN_SPARSE: the ternary, int8 and Winograd weights derive from the unpruned weights"
+#endif
+#include "weights/sparse.c" // tools/sparse_weights.py, defines <LAYER>_SPARSE for the pruned layers
+#endif
+#ifdef CNN_SEPARABLE
+#if defined(CNN_LAYER_FORMATS) || defined(CNN_TEMPLATE_LAYERS)
+#error "-DCNN_SEPARABLE: the separable blocks have Q9 activations and no layer template"
+#endif
+#include "weights/separable.c" // tools/separable_weights.py, defines SEPARABLE_WEIGHTS once trained weights are imported
+#ifndef SEPARABLE_WEIGHTS
+#error "-DCNN_SEPARABLE: no trained separable weights, import those of a model .h5 with tools/separable_weights.py"
+#endif
+#endif
+#if defined(CNN_SOFTMAX) && defined(CNN_LOG_SOFTMAX)
+#error "-DCNN_SOFTMAX and -DCNN_LOG_SOFTMAX both replace the logits returned by cnn_run()"
+#endif
+#ifdef CNN_SIMD
+// tools/dense_panels.py, define DENSE_<n>_PANELS: the kernels packed for the vector GEMM of dense_gemm.h
+// (weights/dense_<n>.c, not the per-layer formats nor the pruned, ternary or int8 weights)
+#if !defined(DENSE_58_FORMATS) && !defined(DENSE_58_SPARSE) && !defined(DENSE_58_TERNARY) && !defined(DENSE_58_INT8)
+#include "weights/dense_58_panels.c"
+#endif
+#if !defined(DENSE_59_FORMATS) && !defined(DENSE_59_SPARSE) && !defined(DENSE_59_TERNARY) && !defined(DENSE_59_INT8)
+#include "weights/dense_59_panels.c"
+#endif
+#endif
 #include "max_pooling1d_145.c" // InputLayer is excluded
 #include "conv1d_116.c"
-#include "weights/conv1d_116.c" // InputLayer is excluded
+#if !defined(CONV1D_116_FORMATS) && !defined(CONV1D_116_SPARSE) && !defined(CONV1D_116_TERNARY) && !defined(CONV1D_116_INT8)
+#include "weights/conv1d_116.c"
+#endif
 #include "max_pooling1d_146.c" // InputLayer is excluded
+#include "max_pooling1d_145_conv1d_116_max_pooling1d_146.c"
 #include "conv1d_117.c"
+#if !defined(CONV1D_117_FORMATS) && !defined(CONV1D_117_SPARSE) && !defined(CONV1D_117_TERNARY) && !defined(CONV1D_117_INT8)
 #include "weights/conv1d_117.c" // InputLayer is excluded
+#endif
+#if (defined(CONV1D_WINOGRAD) || (defined(CNN_AUTOTUNE) && !defined(CONV1D_117_FORMATS))) && !defined(CONV1D_117_TERNARY) && !defined(CONV1D_117_INT8)
+#include "weights/conv1d_117_winograd.c" // defines CONV1D_117_WINOGRAD
+#endif
 #include "max_pooling1d_147.c" // InputLayer is excluded
+#include "conv1d_117_max_pooling1d_147.c"
 #include "conv1d_118.c"
+#if !defined(CONV1D_118_FORMATS) && !defined(CONV1D_118_SPARSE) && !defined(CONV1D_118_TERNARY) && !defined(CONV1D_118_INT8)
 #include "weights/conv1d_118.c" // InputLayer is excluded
+#endif
+#if (defined(CONV1D_WINOGRAD) || (defined(CNN_AUTOTUNE) && !defined(CONV1D_118_FORMATS))) && !defined(CONV1D_118_TERNARY) && !defined(CONV1D_118_INT8)
+#include "weights/conv1d_118_winograd.c" // defines CONV1D_118_WINOGRAD
+#endif
 #include "max_pooling1d_148.c" // InputLayer is excluded
+#include "conv1d_118_max_pooling1d_148.c"
+#ifdef CNN_SEPARABLE
+// Separable block replacing conv1d_118, weights of weights/separable.c
+#include "depthwise_conv1d_118.c"
+#include "pointwise_conv1d_118.c"
+#include "pointwise_conv1d_118_max_pooling1d_148.c"
+#endif
 #include "conv1d_119.c"
+#if !defined(CONV1D_119_FORMATS) && !defined(CONV1D_119_SPARSE) && !defined(CONV1D_119_TERNARY) && !defined(CONV1D_119_INT8)
 #include "weights/conv1d_119.c" // InputLayer is excluded
+#endif
+#if (defined(CONV1D_WINOGRAD) || (defined(CNN_AUTOTUNE) && !defined(CONV1D_119_FORMATS))) && !defined(CONV1D_119_TERNARY) && !defined(CONV1D_119_INT8)
+#include "weights/conv1d_119_winograd.c" // defines CONV1D_119_WINOGRAD
+#endif
 #include "max_pooling1d_149.c" // InputLayer is excluded
+#include "conv1d_119_max_pooling1d_149.c"
+#ifdef CNN_SEPARABLE
+// Separable block replacing conv1d_119
+#include "depthwise_conv1d_119.c"
+#include "pointwise_conv1d_119.c"
+#include "pointwise_conv1d_119_max_pooling1d_149.c"
+#endif
 #include "average_pooling1d_29.c" // InputLayer is excluded
 #include "flatten_29.c" // InputLayer is excluded
 #include "dense_58.c"
+#if !defined(DENSE_58_FORMATS) && !defined(DENSE_58_SPARSE) && !defined(DENSE_58_TERNARY) && !defined(DENSE_58_INT8)
 #include "weights/dense_58.c" // InputLayer is excluded
+#endif
 #include "dense_59.c"
+#if !defined(DENSE_59_FORMATS) && !defined(DENSE_59_SPARSE) && !defined(DENSE_59_TERNARY) && !defined(DENSE_59_INT8)
 #include "weights/dense_59.c"
 #endif
+#include "weights/softmax.c" // tools/softmax_calibration.py, temperature of cnn_softmax()
+#include "average_pooling1d_29_dense_58_dense_59.c"
+#ifdef CNN_TEMPLATE_LAYERS
+#include "layers.hpp"
+#endif
+#endif
 
-void cnn(
+// Int16 kernels passed to the layers, NULL for the layers that run on their ternary, int8 or sparse
+// weights only: weights/<layer>.c is not included for them, weights/ternary.c, int8.c or sparse.c
+// holds their bias
+#if defined(CONV1D_116_TERNARY) || defined(CONV1D_116_INT8) || defined(CONV1D_116_SPARSE)
+#define CONV1D_116_KERNEL NULL
+#else
+#define CONV1D_116_KERNEL conv1d_116_kernel
+#endif
+#if defined(CONV1D_117_TERNARY) || defined(CONV1D_117_INT8) || defined(CONV1D_117_SPARSE)
+#define CONV1D_117_KERNEL NULL
+#else
+#define CONV1D_117_KERNEL conv1d_117_kernel
+#endif
+#if defined(CONV1D_118_TERNARY) || defined(CONV1D_118_INT8) || defined(CONV1D_118_SPARSE)
+#define CONV1D_118_KERNEL NULL
+#else
+#define CONV1D_118_KERNEL conv1d_118_kernel
+#endif
+#if defined(CONV1D_119_TERNARY) || defined(CONV1D_119_INT8) || defined(CONV1D_119_SPARSE)
+#define CONV1D_119_KERNEL NULL
+#else
+#define CONV1D_119_KERNEL conv1d_119_kernel
+#endif
+#if defined(DENSE_58_TERNARY) || defined(DENSE_58_INT8) || defined(DENSE_58_SPARSE)
+#define DENSE_58_KERNEL NULL
+#else
+#define DENSE_58_KERNEL dense_58_kernel
+#endif
+#if defined(DENSE_59_TERNARY) || defined(DENSE_59_INT8) || defined(DENSE_59_SPARSE)
+#define DENSE_59_KERNEL NULL
+#else
+#define DENSE_59_KERNEL dense_59_kernel
+#endif
+
+#ifdef CNN_AUTOTUNE
+
+#include <pthread.h>
+
+// The layers run by cnn_autotune() on an input and a context of their own
+static number_t cnn_autotune_input[MODEL_INPUT_CHANNELS][MODEL_INPUT_SAMPLES];
+static cnn_ctx_t cnn_autotune_ctx;
+static pthread_once_t cnn_autotune_once = PTHREAD_ONCE_INIT;
+
+static void cnn_autotune_conv1d_116(void) {
+  max_pooling1d_145_conv1d_116_max_pooling1d_146(cnn_autotune_input, conv1d_116_kernel, conv1d_116_bias,
+                                                 cnn_autotune_ctx.activations1.max_pooling1d_146_output);
+}
+
+static void cnn_autotune_conv1d_117(void) {
+  conv1d_117_max_pooling1d_147(cnn_autotune_ctx.activations1.max_pooling1d_146_output, conv1d_117_kernel, conv1d_117_bias,
+                               cnn_autotune_ctx.activations2.max_pooling1d_147_output);
+}
+
+#ifndef CNN_SEPARABLE // the separable blocks replacing conv1d_118 and conv1d_119 have a single kernel
+
+static void cnn_autotune_conv1d_118(void) {
+  conv1d_118_max_pooling1d_148(cnn_autotune_ctx.activations2.max_pooling1d_147_output, conv1d_118_kernel, conv1d_118_bias,
+                               cnn_autotune_ctx.activations1.max_pooling1d_148_output);
+}
+
+static void cnn_autotune_conv1d_119(void) {
+  conv1d_119_max_pooling1d_149(cnn_autotune_ctx.activations1.max_pooling1d_148_output, conv1d_119_kernel, conv1d_119_bias,
+                               cnn_autotune_ctx.activations2.max_pooling1d_149_output);
+}
+
+#endif
+
+static void cnn_autotune_model(void) {
+  const cnn_autotune_layer_t layers[] = {
+    {&max_pooling1d_145_params, &conv1d_116_params, &max_pooling1d_146_params, &conv1d_116_choice, cnn_autotune_conv1d_116,
+     &cnn_autotune_input[0][0], &conv1d_116_kernel[0][0][0], conv1d_116_bias,
+     &cnn_autotune_ctx.activations1.max_pooling1d_146_output[0][0], sizeof(cnn_autotune_ctx.activations1.max_pooling1d_146_output) / sizeof(number_t)},
+    {NULL, &conv1d_117_params, &max_pooling1d_147_params, &conv1d_117_choice, cnn_autotune_conv1d_117,
+     &cnn_autotune_ctx.activations1.max_pooling1d_146_output[0][0], &conv1d_117_kernel[0][0][0], conv1d_117_bias,
+     &cnn_autotune_ctx.activations2.max_pooling1d_147_output[0][0], sizeof(cnn_autotune_ctx.activations2.max_pooling1d_147_output) / sizeof(number_t)},
+#ifndef CNN_SEPARABLE
+    {NULL, &conv1d_118_params, &max_pooling1d_148_params, &conv1d_118_choice, cnn_autotune_conv1d_118,
+     &cnn_autotune_ctx.activations2.max_pooling1d_147_output[0][0], &conv1d_118_kernel[0][0][0], conv1d_118_bias,
+     &cnn_autotune_ctx.activations1.max_pooling1d_148_output[0][0], sizeof(cnn_autotune_ctx.activations1.max_pooling1d_148_output) / sizeof(number_t)},
+    {NULL, &conv1d_119_params, &max_pooling1d_149_params, &conv1d_119_choice, cnn_autotune_conv1d_119,
+     &cnn_autotune_ctx.activations1.max_pooling1d_148_output[0][0], &conv1d_119_kernel[0][0][0], conv1d_119_bias,
+     &cnn_autotune_ctx.activations2.max_pooling1d_149_output[0][0], sizeof(cnn_autotune_ctx.activations2.max_pooling1d_149_output) / sizeof(number_t)},
+#endif
+  };
+  number_t *input = &cnn_autotune_input[0][0];
+  unsigned int i, seed = 1;
+
+  // Pseudo-random samples in the range of the clips, the time of the kernels does not depend on them
+  for (i = 0; i < MODEL_INPUT_CHANNELS * MODEL_INPUT_SAMPLES; i++) {
+    seed = seed * 1103515245u + 12345u;
+    input[i] = (number_t)((int)((seed >> 16) % 8001) - 4000);
+  }
+  cnn_autotune_layers(layers, sizeof(layers) / sizeof(layers[0]));
+}
+
+// The first caller tunes, the others wait for it: the choices are only read once it returns
+void cnn_autotune(void) {
+  pthread_once(&cnn_autotune_once, cnn_autotune_model);
+}
+
+#endif//CNN_AUTOTUNE
+
+void cnn_softmax(
+  const number_t logits[MODEL_OUTPUT_SAMPLES],
+  number_t probs[MODEL_OUTPUT_SAMPLES]) {
+  softmax_number_t(logits, MODEL_OUTPUT_SAMPLES, DENSE_59_SOFTMAX_MULTIPLIER, DENSE_59_SOFTMAX_SHIFT, probs);
+}
+
+void cnn_log_softmax(
+  const number_t logits[MODEL_OUTPUT_SAMPLES],
+  number_t log_probs[MODEL_OUTPUT_SAMPLES]) {
+  log_softmax_number_t(logits, MODEL_OUTPUT_SAMPLES, DENSE_59_SOFTMAX_MULTIPLIER, DENSE_59_SOFTMAX_SHIFT, log_probs);
+}
+
+// The logits of dense_59 replaced by the confidences of -DCNN_SOFTMAX or -DCNN_LOG_SOFTMAX, if any
+static inline void cnn_output_confidence(number_t output[MODEL_OUTPUT_SAMPLES]) {
+#if defined(CNN_SOFTMAX)
+  cnn_softmax(output, output);
+#elif defined(CNN_LOG_SOFTMAX)
+  cnn_log_softmax(output, output);
+#else
+  (void)output;
+#endif
+}
+
+#ifdef CNN_TEMPLATE_LAYERS
+
+// Same call chain as below expressed with the layer templates of layers.hpp
+typedef cnn_layers::Sequential<
+  cnn_layers::MaxPool1D<1, 16000, 2, 2>,                                                           // max_pooling1d_145
+  cnn_layers::Conv1D<1, 8000, 16, 20, 8, cnn_layers::Activation::Relu, CONV1D_116_REQUANT_SHIFT>,  // conv1d_116
+  cnn_layers::MaxPool1D<16, 998, 2, 2>,                                                            // max_pooling1d_146
+  cnn_layers::Conv1D<16, 499, 32, 3, 2, cnn_layers::Activation::Relu, CONV1D_117_REQUANT_SHIFT>,   // conv1d_117
+  cnn_layers::MaxPool1D<32, 249, 2, 2>,                                                            // max_pooling1d_147
+  cnn_layers::Conv1D<32, 124, 64, 3, 2, cnn_layers::Activation::Relu, CONV1D_118_REQUANT_SHIFT>,   // conv1d_118
+  cnn_layers::MaxPool1D<64, 61, 2, 2>,                                                             // max_pooling1d_148
+  cnn_layers::Conv1D<64, 30, 128, 3, 1, cnn_layers::Activation::Relu, CONV1D_119_REQUANT_SHIFT>,   // conv1d_119
+  cnn_layers::MaxPool1D<128, 28, 2, 2>,                                                            // max_pooling1d_149
+  cnn_layers::AvgPool1D<128, 14, 14, 14>,                                                          // average_pooling1d_29
+  cnn_layers::Flatten<128, 1>,                                                                     // flatten_29
+  cnn_layers::Dense<128, 40, cnn_layers::Activation::Linear, DENSE_58_REQUANT_SHIFT>,              // dense_58
+  cnn_layers::Dense<40, 7, cnn_layers::Activation::Linear, DENSE_59_REQUANT_SHIFT>                 // dense_59
+> cnn_pipeline_t;
+
+static_assert(std::is_same_v<cnn_pipeline_t::input_type, number_t[MODEL_INPUT_CHANNELS][MODEL_INPUT_SAMPLES]>, "model input shape");
+static_assert(std::is_same_v<cnn_pipeline_t::output_type, number_t[MODEL_OUTPUT_SAMPLES]>, "model output shape");
+
+// Ternary, int8 and block-sparse weights of the layers converted by tools/ternary_weights.py
+// (-DCNN_TERNARY), tools/int8_weights.py (-DCNN_INT8) and tools/sparse_weights.py (-DCNN_SPARSE),
+// nullptr for the layers that keep their int16 kernel
+#ifdef CONV1D_116_TERNARY
+#define CONV1D_116_TERNARY_WEIGHTS &conv1d_116_ternary
+#else
+#define CONV1D_116_TERNARY_WEIGHTS nullptr
+#endif
+#ifdef CONV1D_117_TERNARY
+#define CONV1D_117_TERNARY_WEIGHTS &conv1d_117_ternary
+#else
+#define CONV1D_117_TERNARY_WEIGHTS nullptr
+#endif
+#ifdef CONV1D_118_TERNARY
+#define CONV1D_118_TERNARY_WEIGHTS &conv1d_118_ternary
+#else
+#define CONV1D_118_TERNARY_WEIGHTS nullptr
+#endif
+#ifdef CONV1D_119_TERNARY
+#define CONV1D_119_TERNARY_WEIGHTS &conv1d_119_ternary
+#else
+#define CONV1D_119_TERNARY_WEIGHTS nullptr
+#endif
+#ifdef DENSE_58_TERNARY
+#define DENSE_58_TERNARY_WEIGHTS &dense_58_ternary
+#else
+#define DENSE_58_TERNARY_WEIGHTS nullptr
+#endif
+#ifdef DENSE_59_TERNARY
+#define DENSE_59_TERNARY_WEIGHTS &dense_59_ternary
+#else
+#define DENSE_59_TERNARY_WEIGHTS nullptr
+#endif
+
+#ifdef CONV1D_116_INT8
+#define CONV1D_116_INT8_WEIGHTS &conv1d_116_int8
+#else
+#define CONV1D_116_INT8_WEIGHTS nullptr
+#endif
+#ifdef CONV1D_117_INT8
+#define CONV1D_117_INT8_WEIGHTS &conv1d_117_int8
+#else
+#define CONV1D_117_INT8_WEIGHTS nullptr
+#endif
+#ifdef CONV1D_118_INT8
+#define CONV1D_118_INT8_WEIGHTS &conv1d_118_int8
+#else
+#define CONV1D_118_INT8_WEIGHTS nullptr
+#endif
+#ifdef CONV1D_119_INT8
+#define CONV1D_119_INT8_WEIGHTS &conv1d_119_int8
+#else
+#define CONV1D_119_INT8_WEIGHTS nullptr
+#endif
+#ifdef DENSE_58_INT8
+#define DENSE_58_INT8_WEIGHTS &dense_58_int8
+#else
+#define DENSE_58_INT8_WEIGHTS nullptr
+#endif
+#ifdef DENSE_59_INT8
+#define DENSE_59_INT8_WEIGHTS &dense_59_int8
+#else
+#define DENSE_59_INT8_WEIGHTS nullptr
+#endif
+
+#ifdef CONV1D_116_SPARSE
+#define CONV1D_116_SPARSE_WEIGHTS &conv1d_116_sparse
+#else
+#define CONV1D_116_SPARSE_WEIGHTS nullptr
+#endif
+#ifdef CONV1D_117_SPARSE
+#define CONV1D_117_SPARSE_WEIGHTS &conv1d_117_sparse
+#else
+#define CONV1D_117_SPARSE_WEIGHTS nullptr
+#endif
+#ifdef CONV1D_118_SPARSE
+#define CONV1D_118_SPARSE_WEIGHTS &conv1d_118_sparse
+#else
+#define CONV1D_118_SPARSE_WEIGHTS nullptr
+#endif
+#ifdef CONV1D_119_SPARSE
+#define CONV1D_119_SPARSE_WEIGHTS &conv1d_119_sparse
+#else
+#define CONV1D_119_SPARSE_WEIGHTS nullptr
+#endif
+#ifdef DENSE_58_SPARSE
+#define DENSE_58_SPARSE_WEIGHTS &dense_58_sparse
+#else
+#define DENSE_58_SPARSE_WEIGHTS nullptr
+#endif
+#ifdef DENSE_59_SPARSE
+#define DENSE_59_SPARSE_WEIGHTS &dense_59_sparse
+#else
+#define DENSE_59_SPARSE_WEIGHTS nullptr
+#endif
+
+// Cache tiles of the vector conv kernel, shared with the generated chain
+#ifdef CNN_SIMD
+#define CONV1D_116_TILE &conv1d_116_tile
+#define CONV1D_117_TILE &conv1d_117_tile
+#define CONV1D_118_TILE &conv1d_118_tile
+#define CONV1D_119_TILE &conv1d_119_tile
+#else
+#define CONV1D_116_TILE nullptr
+#define CONV1D_117_TILE nullptr
+#define CONV1D_118_TILE nullptr
+#define CONV1D_119_TILE nullptr
+#endif
+
+// Kernels picked by cnn_autotune(), shared with the generated chain
+#ifdef CNN_AUTOTUNE
+#define CONV1D_116_CHOICE &conv1d_116_choice
+#define CONV1D_117_CHOICE &conv1d_117_choice
+#define CONV1D_118_CHOICE &conv1d_118_choice
+#define CONV1D_119_CHOICE &conv1d_119_choice
+#else
+#define CONV1D_116_CHOICE nullptr
+#define CONV1D_117_CHOICE nullptr
+#define CONV1D_118_CHOICE nullptr
+#define CONV1D_119_CHOICE nullptr
+#endif
+
+// Kernels packed by tools/dense_panels.py, nullptr without CNN_SIMD
+#ifdef DENSE_58_PANELS
+#define DENSE_58_PANELS_WEIGHTS &dense_58_panels[0][0][0]
+#else
+#define DENSE_58_PANELS_WEIGHTS nullptr
+#endif
+#ifdef DENSE_59_PANELS
+#define DENSE_59_PANELS_WEIGHTS &dense_59_panels[0][0][0]
+#else
+#define DENSE_59_PANELS_WEIGHTS nullptr
+#endif
+
+static const cnn_pipeline_t cnn_pipeline(
+  {},
+  {CONV1D_116_KERNEL, conv1d_116_bias, CONV1D_116_TERNARY_WEIGHTS, CONV1D_116_INT8_WEIGHTS, CONV1D_116_SPARSE_WEIGHTS, CONV1D_116_TILE, CONV1D_116_CHOICE},
+  {},
+  {CONV1D_117_KERNEL, conv1d_117_bias, CONV1D_117_TERNARY_WEIGHTS, CONV1D_117_INT8_WEIGHTS, CONV1D_117_SPARSE_WEIGHTS, CONV1D_117_TILE, CONV1D_117_CHOICE},
+  {},
+  {CONV1D_118_KERNEL, conv1d_118_bias, CONV1D_118_TERNARY_WEIGHTS, CONV1D_118_INT8_WEIGHTS, CONV1D_118_SPARSE_WEIGHTS, CONV1D_118_TILE, CONV1D_118_CHOICE},
+  {},
+  {CONV1D_119_KERNEL, conv1d_119_bias, CONV1D_119_TERNARY_WEIGHTS, CONV1D_119_INT8_WEIGHTS, CONV1D_119_SPARSE_WEIGHTS, CONV1D_119_TILE, CONV1D_119_CHOICE},
+  {},
+  {},
+  {},
+  {DENSE_58_KERNEL, dense_58_bias, DENSE_58_TERNARY_WEIGHTS, DENSE_58_INT8_WEIGHTS, DENSE_58_SPARSE_WEIGHTS, DENSE_58_PANELS_WEIGHTS},
+  {DENSE_59_KERNEL, dense_59_bias, DENSE_59_TERNARY_WEIGHTS, DENSE_59_INT8_WEIGHTS, DENSE_59_SPARSE_WEIGHTS, DENSE_59_PANELS_WEIGHTS}
+);
+
+// The pipeline alternates between the two unions of the context like the generated chain below
+static_assert(cnn_pipeline_t::even_bytes <= sizeof(cnn_ctx_t::activations1), "activations1 too small for the pipeline");
+static_assert(cnn_pipeline_t::odd_bytes <= sizeof(cnn_ctx_t::activations2), "activations2 too small for the pipeline");
+
+void cnn_run(
+  cnn_ctx_t *ctx,
+  const number_t input[MODEL_INPUT_CHANNELS][MODEL_INPUT_SAMPLES],
+  number_t output[MODEL_OUTPUT_SAMPLES]) {
+
+#ifdef CNN_AUTOTUNE
+  cnn_autotune();
+#endif
+
+  cnn_pipeline(*reinterpret_cast<const cnn_pipeline_t::input_type *>(input),
+               *reinterpret_cast<cnn_pipeline_t::output_type *>(output), &ctx->activations1, &ctx->activations2);
+  cnn_output_confidence(output);
+}
+
+void cnn_batch_run(
+  cnn_batch_ctx_t *ctx,
+  unsigned int n,
+  const number_t inputs[][MODEL_INPUT_CHANNELS][MODEL_INPUT_SAMPLES],
+  number_t outputs[][MODEL_OUTPUT_SAMPLES]) {
+
+  unsigned int i, count;
+
+#ifdef CNN_AUTOTUNE
+  cnn_autotune();
+#endif
+
+  for (i = 0; i < n; i += CNN_BATCH_SIZE) {
+    count = n - i < CNN_BATCH_SIZE ? n - i : CNN_BATCH_SIZE;
+    cnn_pipeline(count, &inputs[i], &outputs[i],
+                 &ctx->clips[0].activations1, &ctx->clips[0].activations2, sizeof(cnn_ctx_t));
+  }
+  for (i = 0; i < n; i++)
+    cnn_output_confidence(outputs[i]);
+}
+
+#else
+
+// cnn_ctx_t of model.h declares the unions with plain arrays, they must match the layer output types
+#define CNN_CTX_CHECK(activations, layer) \
+  typedef char layer##_ctx_check[sizeof(((cnn_ctx_t *)0)->activations.layer##_output) == sizeof(layer##_output_type) ? 1 : -1]
+CNN_CTX_CHECK(activations1, max_pooling1d_146);
+#ifdef CNN_SEPARABLE
+CNN_CTX_CHECK(activations1, depthwise_conv1d_118);
+CNN_CTX_CHECK(activations1, depthwise_conv1d_119);
+CNN_CTX_CHECK(activations2, max_pooling1d_148);
+#else
+CNN_CTX_CHECK(activations1, max_pooling1d_148);
+#endif
+CNN_CTX_CHECK(activations2, max_pooling1d_147);
+CNN_CTX_CHECK(activations2, max_pooling1d_149);
+#undef CNN_CTX_CHECK
+
+void cnn_run(
+  cnn_ctx_t *ctx,
   const number_t input[MODEL_INPUT_CHANNELS][MODEL_INPUT_SAMPLES],
   dense_59_output_type dense_59_output) {
 
-  // Output array allocation
-  static union {
-    max_pooling1d_145_output_type max_pooling1d_145_output;
-    max_pooling1d_146_output_type max_pooling1d_146_output;
-    max_pooling1d_147_output_type max_pooling1d_147_output;
-    max_pooling1d_148_output_type max_pooling1d_148_output;
-    max_pooling1d_149_output_type max_pooling1d_149_output;
-    dense_58_output_type dense_58_output;
-  } activations1;
-
-  static union {
-    conv1d_116_output_type conv1d_116_output;
-    conv1d_117_output_type conv1d_117_output;
-    conv1d_118_output_type conv1d_118_output;
-    conv1d_119_output_type conv1d_119_output;
-    average_pooling1d_29_output_type average_pooling1d_29_output;
-    flatten_29_output_type flatten_29_output;
-  } activations2;
+#ifdef CNN_AUTOTUNE
+  cnn_autotune();
+#endif
+
+  // Output arrays are the unions of the caller's context (see model.h)
+  // Each conv is fused with the max pooling that follows it, conv outputs are never stored.
+  // The classifier head keeps its intermediate vectors on the stack.
 
 
   //static union {
@@ -89,94 +537,197 @@ void cnn(
 
   // Model layers call chain
  // InputLayer is excluded 
-  max_pooling1d_145(
+  max_pooling1d_145_conv1d_116_max_pooling1d_146(
      // First layer uses input passed as model parameter
     input,
-    activations1.max_pooling1d_145_output
-  );
- // InputLayer is excluded 
-  conv1d_116(
-    
-    activations1.max_pooling1d_145_output,
-    conv1d_116_kernel,
+    CONV1D_116_KERNEL,
     conv1d_116_bias,
-    activations2.conv1d_116_output
+    ctx->activations1.max_pooling1d_146_output
   );
  // InputLayer is excluded 
-  max_pooling1d_146(
+  conv1d_117_max_pooling1d_147(
     
-    activations2.conv1d_116_output,
-    activations1.max_pooling1d_146_output
-  );
- // InputLayer is excluded 
-  conv1d_117(
-    
-    activations1.max_pooling1d_146_output,
-    conv1d_117_kernel,
+    ctx->activations1.max_pooling1d_146_output,
+    CONV1D_117_KERNEL,
     conv1d_117_bias,
-    activations2.conv1d_117_output
-  );
- // InputLayer is excluded 
-  max_pooling1d_147(
-    
-    activations2.conv1d_117_output,
-    activations1.max_pooling1d_147_output
+    ctx->activations2.max_pooling1d_147_output
   );
  // InputLayer is excluded 
-  conv1d_118(
-    
-    activations1.max_pooling1d_147_output,
-    conv1d_118_kernel,
-    conv1d_118_bias,
-    activations2.conv1d_118_output
+#ifdef CNN_SEPARABLE
+  // Separable blocks in place of conv1d_118 and conv1d_119, the depthwise outputs in activations1
+  depthwise_conv1d_118(
+    ctx->activations2.max_pooling1d_147_output,
+    depthwise_conv1d_118_kernel,
+    depthwise_conv1d_118_bias,
+    ctx->activations1.depthwise_conv1d_118_output
   );
- // InputLayer is excluded 
-  max_pooling1d_148(
-    
-    activations2.conv1d_118_output,
-    activations1.max_pooling1d_148_output
+  pointwise_conv1d_118_max_pooling1d_148(
+    ctx->activations1.depthwise_conv1d_118_output,
+    pointwise_conv1d_118_kernel,
+    pointwise_conv1d_118_bias,
+    ctx->activations2.max_pooling1d_148_output
   );
- // InputLayer is excluded 
-  conv1d_119(
-    
-    activations1.max_pooling1d_148_output,
-    conv1d_119_kernel,
-    conv1d_119_bias,
-    activations2.conv1d_119_output
+  depthwise_conv1d_119(
+    ctx->activations2.max_pooling1d_148_output,
+    depthwise_conv1d_119_kernel,
+    depthwise_conv1d_119_bias,
+    ctx->activations1.depthwise_conv1d_119_output
   );
- // InputLayer is excluded 
-  max_pooling1d_149(
-    
-    activations2.conv1d_119_output,
-    activations1.max_pooling1d_149_output
+  pointwise_conv1d_119_max_pooling1d_149(
+    ctx->activations1.depthwise_conv1d_119_output,
+    pointwise_conv1d_119_kernel,
+    pointwise_conv1d_119_bias,
+    ctx->activations2.max_pooling1d_149_output
   );
- // InputLayer is excluded 
-  average_pooling1d_29(
+#else
+  conv1d_118_max_pooling1d_148(
     
-    activations1.max_pooling1d_149_output,
-    activations2.average_pooling1d_29_output
+    ctx->activations2.max_pooling1d_147_output,
+    CONV1D_118_KERNEL,
+    conv1d_118_bias,
+    ctx->activations1.max_pooling1d_148_output
   );
  // InputLayer is excluded 
-  flatten_29(
+  conv1d_119_max_pooling1d_149(
     
-    activations2.average_pooling1d_29_output,
-    activations2.flatten_29_output
+    ctx->activations1.max_pooling1d_148_output,
+    CONV1D_119_KERNEL,
+    conv1d_119_bias,
+    ctx->activations2.max_pooling1d_149_output
   );
+#endif
  // InputLayer is excluded 
-  dense_58(
+  average_pooling1d_29_dense_58_dense_59(
     
-    activations2.flatten_29_output,
-    dense_58_kernel,
+    ctx->activations2.max_pooling1d_149_output,
+    DENSE_58_KERNEL,
     dense_58_bias,
-    activations1.dense_58_output
-  );
- // InputLayer is excluded 
-  dense_59(
-    
-    activations1.dense_58_output,
-    dense_59_kernel,
+    DENSE_59_KERNEL,
     dense_59_bias, // Last layer uses output passed as model parameter
     dense_59_output
   );
+  cnn_output_confidence(dense_59_output);
+
+}
+
+void cnn_batch_run(
+  cnn_batch_ctx_t *ctx,
+  unsigned int n,
+  const number_t inputs[][MODEL_INPUT_CHANNELS][MODEL_INPUT_SAMPLES],
+  number_t outputs[][MODEL_OUTPUT_SAMPLES]) {
 
+  unsigned int i, b, count;
+
+#ifdef CNN_AUTOTUNE
+  cnn_autotune();
+#endif
+
+  // Same call chain as cnn_run(), each layer running on the whole tile before the next one
+  for (i = 0; i < n; i += CNN_BATCH_SIZE) {
+    count = n - i < CNN_BATCH_SIZE ? n - i : CNN_BATCH_SIZE;
+
+    for (b = 0; b < count; b++)
+      max_pooling1d_145_conv1d_116_max_pooling1d_146(
+        inputs[i + b],
+        CONV1D_116_KERNEL,
+        conv1d_116_bias,
+        ctx->clips[b].activations1.max_pooling1d_146_output
+      );
+    for (b = 0; b < count; b++)
+      conv1d_117_max_pooling1d_147(
+        ctx->clips[b].activations1.max_pooling1d_146_output,
+        CONV1D_117_KERNEL,
+        conv1d_117_bias,
+        ctx->clips[b].activations2.max_pooling1d_147_output
+      );
+#ifdef CNN_SEPARABLE
+    for (b = 0; b < count; b++)
+      depthwise_conv1d_118(
+        ctx->clips[b].activations2.max_pooling1d_147_output,
+        depthwise_conv1d_118_kernel,
+        depthwise_conv1d_118_bias,
+        ctx->clips[b].activations1.depthwise_conv1d_118_output
+      );
+    for (b = 0; b < count; b++)
+      pointwise_conv1d_118_max_pooling1d_148(
+        ctx->clips[b].activations1.depthwise_conv1d_118_output,
+        pointwise_conv1d_118_kernel,
+        pointwise_conv1d_118_bias,
+        ctx->clips[b].activations2.max_pooling1d_148_output
+      );
+    for (b = 0; b < count; b++)
+      depthwise_conv1d_119(
+        ctx->clips[b].activations2.max_pooling1d_148_output,
+        depthwise_conv1d_119_kernel,
+        depthwise_conv1d_119_bias,
+        ctx->clips[b].activations1.depthwise_conv1d_119_output
+      );
+    for (b = 0; b < count; b++)
+      pointwise_conv1d_119_max_pooling1d_149(
+        ctx->clips[b].activations1.depthwise_conv1d_119_output,
+        pointwise_conv1d_119_kernel,
+        pointwise_conv1d_119_bias,
+        ctx->clips[b].activations2.max_pooling1d_149_output
+      );
+#else
+    for (b = 0; b < count; b++)
+      conv1d_118_max_pooling1d_148(
+        ctx->clips[b].activations2.max_pooling1d_147_output,
+        CONV1D_118_KERNEL,
+        conv1d_118_bias,
+        ctx->clips[b].activations1.max_pooling1d_148_output
+      );
+    for (b = 0; b < count; b++)
+      conv1d_119_max_pooling1d_149(
+        ctx->clips[b].activations1.max_pooling1d_148_output,
+        CONV1D_119_KERNEL,
+        conv1d_119_bias,
+        ctx->clips[b].activations2.max_pooling1d_149_output
+      );
+#endif
+    // The dense layers of the head run as GEMMs over the clips of the tile
+    average_pooling1d_29_dense_58_dense_59_batch(
+      count,
+      &ctx->clips[0].activations2.max_pooling1d_149_output[0][0],
+      sizeof(cnn_ctx_t) / sizeof(number_t),
+      DENSE_58_KERNEL,
+      dense_58_bias,
+      DENSE_59_KERNEL,
+      dense_59_bias,
+      &outputs[i]
+    );
+    for (b = 0; b < count; b++)
+      cnn_output_confidence(outputs[i + b]);
+  }
+}
+
+#endif//CNN_TEMPLATE_LAYERS
+
+static cnn_ctx_t cnn_ctx; // Context of cnn(), shared by all its callers
+
+void cnn(
+  const number_t input[MODEL_INPUT_CHANNELS][MODEL_INPUT_SAMPLES],
+  number_t output[MODEL_OUTPUT_SAMPLES]) {
+  cnn_run(&cnn_ctx, input, output);
+}
+
+static cnn_batch_ctx_t cnn_batch_ctx; // Context of cnn_batch(), shared by all its callers
+
+void cnn_batch(
+  unsigned int n,
+  const number_t inputs[][MODEL_INPUT_CHANNELS][MODEL_INPUT_SAMPLES],
+  number_t outputs[][MODEL_OUTPUT_SAMPLES]) {
+  cnn_batch_run(&cnn_batch_ctx, n, inputs, outputs);
+}
+
+#ifdef CNN_THREADS
+
+void cnn_set_num_threads(unsigned int threads) {
+  cnn_thread_pool_set(threads);
 }
+
+unsigned int cnn_get_num_threads(void) {
+  return cnn_thread_pool_size();
+}
+
+#endif//CNN_THREADS
@@ -18,9 +18,94 @@
 #define MODEL_INPUT_SAMPLES 16000 // node 0 is InputLayer so use its output shape as input shape of the model
 #define MODEL_INPUT_CHANNELS 1
 
+#ifdef CNN_SEPARABLE
+#ifndef CNN_SEPARABLE_MULTIPLIER
+#define CNN_SEPARABLE_MULTIPLIER 1 // depth_multiplier of the depthwise convs, that of the weights imported in weights/separable.c
+#endif
+#endif
+
+// Scratch memory of one inference: the activations1/activations2 unions holding the layer outputs
+// (each member has the shape of the *_output_type of its layer). The caller owns it and cnn_run()
+// keeps no other mutable state, so threads running cnn_run() on their own context need no locking.
+// With -DCNN_SEPARABLE the depthwise convs replacing conv1d_118 and conv1d_119 write to
+// activations1, so the pooled outputs of the pointwise convs all go to activations2.
+typedef struct {
+  union {
+    number_t max_pooling1d_146_output[16][499];
+#ifdef CNN_SEPARABLE
+    number_t depthwise_conv1d_118_output[32 * CNN_SEPARABLE_MULTIPLIER][61];
+    number_t depthwise_conv1d_119_output[64 * CNN_SEPARABLE_MULTIPLIER][28];
+#else
+    number_t max_pooling1d_148_output[64][30];
+#endif
+  } activations1;
+  union {
+    number_t max_pooling1d_147_output[32][124];
+#ifdef CNN_SEPARABLE
+    number_t max_pooling1d_148_output[64][30];
+#endif
+    number_t max_pooling1d_149_output[128][14];
+  } activations2;
+} cnn_ctx_t;
+
+void cnn_run(
+  cnn_ctx_t *ctx,
+  const number_t input[MODEL_INPUT_CHANNELS][MODEL_INPUT_SAMPLES],
+  number_t output[MODEL_OUTPUT_SAMPLES]);
+
+// cnn_run() on a context shared by every caller, not reentrant
 void cnn(
   const number_t input[MODEL_INPUT_CHANNELS][MODEL_INPUT_SAMPLES],
   //dense_59_output_type dense_59_output);
   number_t output[MODEL_OUTPUT_SAMPLES]);
 
+#ifndef CNN_BATCH_SIZE
+#define CNN_BATCH_SIZE 8 // Clips run layer by layer by cnn_batch_run(), each layer's weights stay in cache across them
+#endif
+
+typedef struct {
+  cnn_ctx_t clips[CNN_BATCH_SIZE];
+} cnn_batch_ctx_t;
+
+// Same outputs as n calls of cnn_run(), computed CNN_BATCH_SIZE clips at a time
+void cnn_batch_run(
+  cnn_batch_ctx_t *ctx,
+  unsigned int n,
+  const number_t inputs[][MODEL_INPUT_CHANNELS][MODEL_INPUT_SAMPLES],
+  number_t outputs[][MODEL_OUTPUT_SAMPLES]);
+
+// cnn_batch_run() on a context shared by every caller, not reentrant
+void cnn_batch(
+  unsigned int n,
+  const number_t inputs[][MODEL_INPUT_CHANNELS][MODEL_INPUT_SAMPLES],
+  number_t outputs[][MODEL_OUTPUT_SAMPLES]);
+
+// Confidences of the logits returned by cnn_run(): softmax of logits / T in the format of number_t
+// (1.0 = 1 << FIXED_POINT), T the temperature fitted by tools/softmax_calibration.py
+// (weights/softmax.c); probs may be logits. cnn_log_softmax() gives their natural log. Built
+// with -DCNN_SOFTMAX (-DCNN_LOG_SOFTMAX), cnn_run() and cnn_batch_run() return them in place of
+// the logits.
+void cnn_softmax(
+  const number_t logits[MODEL_OUTPUT_SAMPLES],
+  number_t probs[MODEL_OUTPUT_SAMPLES]);
+
+void cnn_log_softmax(
+  const number_t logits[MODEL_OUTPUT_SAMPLES],
+  number_t log_probs[MODEL_OUTPUT_SAMPLES]);
+
+#ifdef CNN_AUTOTUNE
+// Picks the fastest bit-exact kernel of every conv layer on this CPU, or reads the choices cached
+// by an earlier run of the same build and weights and checks them once (see autotune.h). Runs once per process, on the first call (cnn_run() and
+// cnn_batch_run() make it); concurrent callers wait until the choices are set, so threads need no
+// locking around it. Calling it at startup keeps the tuning time out of the first inference.
+void cnn_autotune(void);
+#endif
+
+#ifdef CNN_THREADS
+// Threads each conv layer is split across (calling thread included), see thread_pool.h. The
+// outputs do not depend on it.
+void cnn_set_num_threads(unsigned int threads);
+unsigned int cnn_get_num_threads(void);
+#endif
+
 #endif//__MODEL_H__
\ No newline at end of file
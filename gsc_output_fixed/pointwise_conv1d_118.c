@@ -0,0 +1,90 @@
+/**
+  ******************************************************************************
+  * @file    pointwise_conv1d_118.c
+  * @version 1.0.0
+  * @date    17 october 2026
+  * @brief   Pointwise conv of the separable block replacing conv1d_118 (-DCNN_SEPARABLE): a
+  *          kernel size 1 conv across the channels of the output of depthwise_conv1d_118, with the bias
+  *          and the activation of conv1d_118
+  */
+
+#ifndef SINGLE_FILE
+#include "number.h"
+#include "model.h"
+#include "layer_params.h"
+#include "conv1d_separable.h"
+#include "requant_simd.h"
+#endif
+
+#define INPUT_CHANNELS      ( 32 * CNN_SEPARABLE_MULTIPLIER )
+#define INPUT_SAMPLES       61
+#define CONV_FILTERS        64
+#define CONV_KERNEL_SIZE    1
+#define CONV_STRIDE         1
+
+#define ZEROPADDING_LEFT    0
+#define ZEROPADDING_RIGHT   0
+
+#define CONV_OUTSAMPLES     ( ( (INPUT_SAMPLES - CONV_KERNEL_SIZE + ZEROPADDING_LEFT + ZEROPADDING_RIGHT) / CONV_STRIDE ) + 1 )
+
+#define ACTIVATION_RELU
+
+#ifndef POINTWISE_CONV1D_118_REQUANT_SHIFT
+#define POINTWISE_CONV1D_118_REQUANT_SHIFT FIXED_POINT
+#endif
+
+typedef number_t pointwise_conv1d_118_output_type[CONV_FILTERS][CONV_OUTSAMPLES];
+
+static const conv1d_params_t pointwise_conv1d_118_params = {
+  INPUT_CHANNELS, INPUT_SAMPLES, CONV_FILTERS, CONV_KERNEL_SIZE, CONV_STRIDE,
+  ZEROPADDING_LEFT, ZEROPADDING_RIGHT, CONV_OUTSAMPLES,
+#ifdef ACTIVATION_RELU
+  ACTIVATION_KIND_RELU,
+#else
+  ACTIVATION_KIND_LINEAR,
+#endif
+  POINTWISE_CONV1D_118_REQUANT_SHIFT,
+};
+
+static inline void pointwise_conv1d_118(
+  const number_t input[INPUT_CHANNELS][INPUT_SAMPLES],     // IN
+  const number_t kernel[CONV_FILTERS][INPUT_CHANNELS],     // IN
+
+  const number_t bias[CONV_FILTERS],                       // IN
+
+  number_t output[CONV_FILTERS][CONV_OUTSAMPLES]) {        // OUT
+
+  unsigned short pos_x, z, k;
+  long_number_t output_acc[CONV_OUTSAMPLES];
+
+#ifdef CNN_SIMD
+  // Vectorized kernel of the running CPU, the loops below are the scalar fallback
+  if (pointwise_conv1d_maxpool1d_simd(&pointwise_conv1d_118_params, NULL, &input[0][0], &kernel[0][0], bias, &output[0][0]))
+    return;
+#endif
+
+  for (k = 0; k < CONV_FILTERS; k++) {
+    for (pos_x = 0; pos_x < CONV_OUTSAMPLES; pos_x++) {
+      output_acc[pos_x] = 0;
+      for (z = 0; z < INPUT_CHANNELS; z++)
+        output_acc[pos_x] = output_acc[pos_x] + input[z][pos_x] * kernel[k][z];
+    }
+
+#ifdef ACTIVATION_LINEAR
+    requant_simd_row(output[k], output_acc, CONV_OUTSAMPLES, POINTWISE_CONV1D_118_REQUANT_SHIFT, &bias[k], 0, 0);
+#elif defined(ACTIVATION_RELU)
+    // Activation function: ReLU
+    requant_simd_row(output[k], output_acc, CONV_OUTSAMPLES, POINTWISE_CONV1D_118_REQUANT_SHIFT, &bias[k], 0, 1);
+#endif
+  }
+}
+
+#undef INPUT_CHANNELS
+#undef INPUT_SAMPLES
+#undef CONV_FILTERS
+#undef CONV_KERNEL_SIZE
+#undef CONV_STRIDE
+#undef ZEROPADDING_LEFT
+#undef ZEROPADDING_RIGHT
+#undef CONV_OUTSAMPLES
+#undef ACTIVATION_RELU
@@ -0,0 +1,79 @@
+/**
+  ******************************************************************************
+  * @file    pointwise_conv1d_118_max_pooling1d_148.c
+  * @version 1.0.0
+  * @date    17 october 2026
+  * @brief   pointwise_conv1d_118 fused with the max_pooling1d_148 that follows it: each pooled sample
+  *          is the max of the conv outputs under the pool, which are never stored
+  */
+
+#ifndef SINGLE_FILE
+#include "number.h"
+#include "model.h"
+#include "layer_params.h"
+#include "conv1d_separable.h"
+#include "requant_simd.h"
+#endif
+
+#define INPUT_CHANNELS      ( 32 * CNN_SEPARABLE_MULTIPLIER )
+#define INPUT_SAMPLES       61
+#define CONV_FILTERS        64
+#define CONV_OUTSAMPLES     INPUT_SAMPLES
+#define POOL_SIZE           2
+#define POOL_STRIDE         2
+#define POOL_LENGTH         ( ( (CONV_OUTSAMPLES - POOL_SIZE) / POOL_STRIDE ) + 1 )
+
+#define ACTIVATION_RELU
+
+static inline void pointwise_conv1d_118_max_pooling1d_148(
+  const number_t input[INPUT_CHANNELS][INPUT_SAMPLES],     // IN
+  const number_t kernel[CONV_FILTERS][INPUT_CHANNELS],     // IN
+
+  const number_t bias[CONV_FILTERS],                       // IN
+
+  number_t output[CONV_FILTERS][POOL_LENGTH]) {            // OUT
+
+  unsigned short pos_x, z, k, y;
+  long_number_t output_acc[CONV_OUTSAMPLES]; // conv outputs of one filter, pooled before the activation
+  long_number_t max;
+
+#ifdef CNN_SIMD
+  // Vectorized kernel of the running CPU, the loops below are the scalar fallback
+  if (pointwise_conv1d_maxpool1d_simd(&pointwise_conv1d_118_params, &max_pooling1d_148_params, &input[0][0], &kernel[0][0], bias, &output[0][0]))
+    return;
+#endif
+
+  for (k = 0; k < CONV_FILTERS; k++) {
+    for (pos_x = 0; pos_x < CONV_OUTSAMPLES; pos_x++) {
+      output_acc[pos_x] = 0;
+      for (z = 0; z < INPUT_CHANNELS; z++)
+        output_acc[pos_x] = output_acc[pos_x] + input[z][pos_x] * kernel[k][z];
+    }
+
+    // max_pooling1d_148 (linear) of the row, in place; the requantization, the activation and
+    // the clamp are monotonic so they are applied once to the max instead of to every conv output
+    for (pos_x = 0; pos_x < POOL_LENGTH; pos_x++) {
+      max = output_acc[pos_x * POOL_STRIDE];
+      for (y = 1; y < POOL_SIZE; y++)
+        if (max < output_acc[pos_x * POOL_STRIDE + y])
+          max = output_acc[pos_x * POOL_STRIDE + y];
+      output_acc[pos_x] = max;
+    }
+
+#ifdef ACTIVATION_LINEAR
+    requant_simd_row(output[k], output_acc, POOL_LENGTH, POINTWISE_CONV1D_118_REQUANT_SHIFT, &bias[k], 0, 0);
+#elif defined(ACTIVATION_RELU)
+    // Activation function: ReLU
+    requant_simd_row(output[k], output_acc, POOL_LENGTH, POINTWISE_CONV1D_118_REQUANT_SHIFT, &bias[k], 0, 1);
+#endif
+  }
+}
+
+#undef INPUT_CHANNELS
+#undef INPUT_SAMPLES
+#undef CONV_FILTERS
+#undef CONV_OUTSAMPLES
+#undef POOL_SIZE
+#undef POOL_STRIDE
+#undef POOL_LENGTH
+#undef ACTIVATION_RELU
@@ -0,0 +1,95 @@
+/**
+  ******************************************************************************
+  * @file    requant_simd.h
+  * @version 1.0.0
+  * @date    17 october 2026
+  * @brief   Requantization epilogue shared by the conv and dense kernels: shift to the output
+  *          format, bias, optional ReLU then clamp_to_number_t of the long_number_t accumulators
+  *
+  * The vector rows shift the int32 lanes arithmetically, add the sign-extended bias, take the max
+  * with 0 for ReLU and pack to int16 with signed saturation, which is bit-exact with number.h for
+  * every accumulator, negative ones included. Without a vector ISA (MCU, floating point,
+  * -DCNN_NO_SIMD) the rows run requantize_number_t.
+  */
+
+#ifndef __REQUANT_SIMD_H__
+#define __REQUANT_SIMD_H__
+
+#ifndef SINGLE_FILE
+#include "number.h"
+#include "simd.h"
+#endif
+
+// One output sample, the reference for the vector rows. shift is the requant_shift of the layer,
+// input + weight - output fractional bits: FIXED_POINT, i.e. scale_number_t, when the whole model
+// has one format, per layer with -DCNN_LAYER_FORMATS (weights/formats.c).
+static inline number_t requantize_number_t(long_number_t acc, int shift, long_number_t bias, int relu) {
+#if FIXED_POINT > 0
+  acc = (acc >> shift) + bias;
+#else
+  (void)shift;
+  acc = acc + bias;
+#endif
+  if (relu && acc < 0)
+    return 0;
+  return clamp_to_number_t(acc);
+}
+
+#ifdef CNN_SIMD
+
+#define SIMD_ISA(name) name##_portable
+#define SIMD_LANES 4
+#include "requant_simd_isa.h"
+#undef SIMD_ISA
+#undef SIMD_LANES
+
+#ifdef CNN_SIMD_X86
+
+#pragma GCC push_options
+#pragma GCC target("sse4.1")
+#define SIMD_ISA(name) name##_sse41
+#define SIMD_LANES 4
+#include "requant_simd_isa.h"
+#undef SIMD_ISA
+#undef SIMD_LANES
+#pragma GCC pop_options
+
+#pragma GCC push_options
+#pragma GCC target("avx2")
+#define SIMD_ISA(name) name##_avx2
+#define SIMD_LANES 8
+#include "requant_simd_isa.h"
+#undef SIMD_ISA
+#undef SIMD_LANES
+#pragma GCC pop_options
+
+#endif//CNN_SIMD_X86
+
+#endif//CNN_SIMD
+
+// out[i] = requantize_number_t(acc[i], shift, bias[i * bias_step], relu) for i < n with the kernel
+// of the running CPU: bias_step 0 for the row of one conv filter, 1 for dense units (one bias each)
+static inline void requant_simd_row(number_t *out, const long_number_t *acc, int n, int shift, const number_t *bias, int bias_step, int relu) {
+  int i;
+
+#ifdef CNN_SIMD_X86
+  if (cnn_isa == CNN_ISA_AVX2) {
+    requant_row_avx2(out, acc, n, shift, bias, bias_step, relu);
+    return;
+  }
+  if (cnn_isa == CNN_ISA_SSE41) {
+    requant_row_sse41(out, acc, n, shift, bias, bias_step, relu);
+    return;
+  }
+#endif
+#ifdef CNN_SIMD
+  if (cnn_isa == CNN_ISA_PORTABLE) {
+    requant_row_portable(out, acc, n, shift, bias, bias_step, relu);
+    return;
+  }
+#endif
+  for (i = 0; i < n; i++)
+    out[i] = requantize_number_t(acc[i], shift, bias[i * bias_step], relu);
+}
+
+#endif//__REQUANT_SIMD_H__
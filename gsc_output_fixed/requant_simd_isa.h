@@ -0,0 +1,28 @@
+/**
+  ******************************************************************************
+  * @file    requant_simd_isa.h
+  * @version 1.0.0
+  * @date    17 october 2026
+  * @brief   Vectorized requantization body, included once per ISA by requant_simd.h
+  *
+  * Expects SIMD_ISA(name) to append the ISA suffix and SIMD_LANES the number of int32 lanes of
+  * its vectors.
+  */
+
+// out[i] = requantize_number_t(acc[i], shift, bias[i * bias_step], relu) for i < n. Like the pooling
+// rows, a row of at least 2*SIMD_LANES accumulators ends with a vector overlapping the previous
+// one, shorter rows run scalar.
+static inline void SIMD_ISA(requant_row)(number_t *out, const long_number_t *acc, int n, int shift, const number_t *bias, int bias_step, int relu) {
+  int i = 0;
+
+  if (n >= 2 * SIMD_LANES) {
+    for (; i + 2 * SIMD_LANES <= n; i += 2 * SIMD_LANES)
+      SIMD_ISA(vstore_requant_i32)(out + i, acc + i, shift, bias + i * bias_step, bias_step, relu);
+    if (i < n)
+      SIMD_ISA(vstore_requant_i32)(out + n - 2 * SIMD_LANES, acc + n - 2 * SIMD_LANES, shift,
+                                   bias + (n - 2 * SIMD_LANES) * bias_step, bias_step, relu);
+    return;
+  }
+  for (; i < n; i++)
+    out[i] = requantize_number_t(acc[i], shift, bias[i * bias_step], relu);
+}
@@ -0,0 +1,422 @@
+/**
+  ******************************************************************************
+  * @file    simd.h
+  * @version 1.0.0
+  * @date    17 october 2026
+  * @brief   Runtime ISA selection and int16 vector primitives for the host kernels
+  *
+  * Every vector kernel is written once against the primitives below and included once per ISA:
+  * SSE4.1 and AVX2 on x86, and a portable 128-bit variant written with the vector extensions of
+  * GCC and clang, which the compiler lowers to the vector unit of the target (NEON on aarch64).
+  * The portable kernels give the same bits as the x86 ones, so they can be tested on x86 with
+  * CNN_ISA=portable, or with -DCNN_PORTABLE_SIMD which builds them alone like on another host.
+  */
+
+#ifndef __SIMD_H__
+#define __SIMD_H__
+
+#ifndef SINGLE_FILE
+#include "number.h"
+#endif
+
+// Vector kernels are only built for x86 and ARM hosts (or any target with -DCNN_PORTABLE_SIMD)
+// with a GCC-compatible compiler and the Q7.9 int16 number_t; anything else (MCU build, floating
+// point) keeps the generated scalar loops. CNN_SIMD_X86 adds the SSE4.1 and AVX2 kernels.
+#if !defined(CNN_NO_SIMD) && defined(__GNUC__) && FIXED_POINT > 0 && NUMBER_MAX == 32767 \
+  && (defined(__x86_64__) || defined(__i386__) || defined(__aarch64__) || defined(__ARM_NEON) || defined(CNN_PORTABLE_SIMD))
+#ifndef CNN_SIMD // may come from the command line
+#define CNN_SIMD
+#endif
+#if (defined(__x86_64__) || defined(__i386__)) && !defined(CNN_PORTABLE_SIMD) && !defined(CNN_SIMD_X86)
+#define CNN_SIMD_X86
+#endif
+#endif
+
+// In increasing order of speed, CNN_ISA caps the selection at one of them
+typedef enum {
+  CNN_ISA_SCALAR = 0,
+  CNN_ISA_PORTABLE,
+  CNN_ISA_SSE41,
+  CNN_ISA_AVX2,
+} cnn_isa_t;
+
+#ifdef CNN_SIMD
+
+#include <stdlib.h>
+#include <string.h>
+#ifdef CNN_SIMD_X86
+#include <immintrin.h>
+#endif
+
+static cnn_isa_t cnn_isa = CNN_ISA_SCALAR; // Best ISA of the running CPU, set once at startup
+
+static cnn_isa_t cnn_isa_detect(void) {
+  cnn_isa_t isa = CNN_ISA_PORTABLE;
+  const char *env;
+
+#ifdef CNN_SIMD_X86
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx2"))
+    isa = CNN_ISA_AVX2;
+  else if (__builtin_cpu_supports("sse4.1"))
+    isa = CNN_ISA_SSE41;
+#endif
+
+  // CNN_ISA=scalar|portable|sse41 caps the selection, e.g. to exercise the fallbacks on a recent host
+  env = getenv("CNN_ISA");
+  if (env != NULL) {
+    if (strcmp(env, "scalar") == 0)
+      isa = CNN_ISA_SCALAR;
+    else if (strcmp(env, "portable") == 0 && isa > CNN_ISA_PORTABLE)
+      isa = CNN_ISA_PORTABLE;
+    else if (strcmp(env, "sse41") == 0 && isa > CNN_ISA_SSE41)
+      isa = CNN_ISA_SSE41;
+  }
+  return isa;
+}
+
+// Name of an ISA, as CNN_ISA takes it
+static inline const char *cnn_isa_name(cnn_isa_t isa) {
+  return isa == CNN_ISA_AVX2 ? "avx2" : isa == CNN_ISA_SSE41 ? "sse41" : isa == CNN_ISA_PORTABLE ? "portable" : "scalar";
+}
+
+__attribute__((constructor)) static void cnn_isa_init(void) {
+  cnn_isa = cnn_isa_detect();
+}
+
+static inline int32_t load_number_pair(const number_t *w) { // (w[0], w[1]) as one madd operand
+  int32_t pair;
+  memcpy(&pair, w, sizeof(pair));
+  return pair;
+}
+
+static inline int32_t load_number_single(const number_t *w) { // (w[0], 0) for an odd trailing tap
+  return (uint16_t)w[0];
+}
+
+/*
+ * Each ISA below provides the same primitives, suffixed by the ISA name:
+ *  vzero, vadd, vmadd (int16 pairs -> int32), vset_pair (broadcast one packed pair),
+ *  vload_i32/vstore_i32 (unaligned int32 lanes),
+ *  vload_pairs: (in[i*stride], in[i*stride+1]) for 2*LANES consecutive positions i, split in
+ *               two vectors lo/hi in the order that vstore_requant packs back to i = 0, 1, ...
+ *               Touches in[0] .. in[stride*(2*LANES-1)+1].
+ *  vload_rows_pairs: (a[i], b[i]) for the 2*LANES positions i of two rows, in the order of
+ *               vload_pairs (the pairs of two input channels of a pointwise conv)
+ *  vlow_pair: (a[0], 0) in each 32-bit lane, the window pair of an odd last tap
+ *  vmax_pairs: (max(a[0], a[1]), max(b[0], b[1])) in each 32-bit lane, i.e. a pool 2 max
+ *              pooling of two vload_pairs results taken two samples apart
+ *  vrequant: arithmetic shift right by the requant_shift of the layer (FIXED_POINT, the
+ *            scale_number_t of number.h, unless -DCNN_LAYER_FORMATS), bias then optional ReLU of
+ *            int32 lanes, the epilogue every kernel shares; the saturating int32 -> int16 pack
+ *            that follows it is clamp_to_number_t
+ *  vload_bias: bias[0] .. bias[LANES-1] sign-extended to int32 lanes
+ *  vstore_requant: vrequant of lo/hi with one bias, packed back to the 2*LANES samples
+ *  vstore_requant_i32: requantization of the int32 accumulators acc[0] .. acc[2*LANES-1] with
+ *               bias[i * bias_step] (bias_step 0: one bias for the row, 1: one per accumulator)
+ *  vstore_requant_pool2: same after a pool 2 / stride 2 max pooling of the 2*LANES positions of
+ *               lo/hi, storing LANES samples. The requantization is monotonic so the max can be
+ *               taken on the accumulators.
+ *  vstore_pool2: pool 2 / stride 2 max pooling of in[0] .. in[4*LANES-1], optionally ReLU (max with
+ *               0), stores the 2*LANES samples
+ */
+
+// Portable: 4 int32 lanes in plain order, lo holds positions 0-3 and hi 4-7. Sums and products go
+// through the unsigned type so that they wrap like the x86 instructions.
+typedef int32_t cnn_vec_t __attribute__((vector_size(16)));
+typedef uint32_t cnn_uvec_t __attribute__((vector_size(16)));
+
+static inline cnn_vec_t vzero_portable(void) { cnn_vec_t v = {0, 0, 0, 0}; return v; }
+static inline cnn_vec_t vadd_portable(cnn_vec_t a, cnn_vec_t b) { return (cnn_vec_t)((cnn_uvec_t)a + (cnn_uvec_t)b); }
+static inline cnn_vec_t vset_pair_portable(int32_t pair) { cnn_vec_t v = {pair, pair, pair, pair}; return v; }
+static inline cnn_vec_t vload_i32_portable(const int32_t *p) { cnn_vec_t v; memcpy(&v, p, sizeof(v)); return v; }
+static inline void vstore_i32_portable(int32_t *p, cnn_vec_t v) { memcpy(p, &v, sizeof(v)); }
+
+static inline cnn_vec_t vlow16_portable(cnn_vec_t a) { return (cnn_vec_t)((cnn_uvec_t)a << 16) >> 16; } // sign-extended
+static inline cnn_vec_t vmax_i32_portable(cnn_vec_t a, cnn_vec_t b) { cnn_vec_t m = a > b; return (a & m) | (b & ~m); }
+static inline cnn_vec_t vmin_i32_portable(cnn_vec_t a, cnn_vec_t b) { cnn_vec_t m = a < b; return (a & m) | (b & ~m); }
+
+static inline cnn_vec_t vmadd_portable(cnn_vec_t a, cnn_vec_t b) {
+  return (cnn_vec_t)((cnn_uvec_t)vlow16_portable(a) * (cnn_uvec_t)vlow16_portable(b) + (cnn_uvec_t)(a >> 16) * (cnn_uvec_t)(b >> 16));
+}
+
+static inline cnn_vec_t vload_i16_portable(const number_t *in) { // in[0] .. in[3] sign-extended
+  cnn_vec_t v = {in[0], in[1], in[2], in[3]};
+  return v;
+}
+
+static inline cnn_vec_t vload_bias_portable(const number_t *bias) { return vload_i16_portable(bias); }
+
+// Packs the int16 values of the lanes to out[0] .. out[3], saturating them first with saturate
+static inline void vstore_i16_portable(number_t *out, cnn_vec_t v, int saturate) {
+  const cnn_vec_t lo = {NUMBER_MIN, NUMBER_MIN, NUMBER_MIN, NUMBER_MIN}, hi = {NUMBER_MAX, NUMBER_MAX, NUMBER_MAX, NUMBER_MAX};
+  if (saturate)
+    v = vmin_i32_portable(vmax_i32_portable(v, lo), hi); // clamp_to_number_t
+  out[0] = (number_t)v[0];
+  out[1] = (number_t)v[1];
+  out[2] = (number_t)v[2];
+  out[3] = (number_t)v[3];
+}
+
+static inline void vload_pairs_portable(const number_t *in, unsigned short stride, cnn_vec_t *lo, cnn_vec_t *hi) {
+  if (stride == 1) {
+    *lo = (cnn_vec_t)(((cnn_uvec_t)vload_i16_portable(in) & 0xFFFFu) | ((cnn_uvec_t)vload_i16_portable(in + 1) << 16));
+    *hi = (cnn_vec_t)(((cnn_uvec_t)vload_i16_portable(in + 4) & 0xFFFFu) | ((cnn_uvec_t)vload_i16_portable(in + 5) << 16));
+  } else if (stride == 2) {
+    memcpy(lo, in, sizeof(*lo));
+    memcpy(hi, in + 8, sizeof(*hi));
+  } else {
+    cnn_vec_t a = {load_number_pair(in), load_number_pair(in + stride), load_number_pair(in + 2 * stride), load_number_pair(in + 3 * stride)};
+    cnn_vec_t b = {load_number_pair(in + 4 * stride), load_number_pair(in + 5 * stride), load_number_pair(in + 6 * stride), load_number_pair(in + 7 * stride)};
+    *lo = a;
+    *hi = b;
+  }
+}
+
+static inline void vload_rows_pairs_portable(const number_t *a, const number_t *b, cnn_vec_t *lo, cnn_vec_t *hi) {
+  *lo = (cnn_vec_t)(((cnn_uvec_t)vload_i16_portable(a) & 0xFFFFu) | ((cnn_uvec_t)vload_i16_portable(b) << 16));
+  *hi = (cnn_vec_t)(((cnn_uvec_t)vload_i16_portable(a + 4) & 0xFFFFu) | ((cnn_uvec_t)vload_i16_portable(b + 4) << 16));
+}
+
+static inline cnn_vec_t vlow_pair_portable(cnn_vec_t a) { return (cnn_vec_t)((cnn_uvec_t)a & 0xFFFFu); }
+
+static inline cnn_vec_t vmax_pairs_portable(cnn_vec_t a, cnn_vec_t b) {
+  a = vmax_i32_portable(vlow16_portable(a), a >> 16);
+  b = vmax_i32_portable(vlow16_portable(b), b >> 16);
+  return (cnn_vec_t)(((cnn_uvec_t)a & 0xFFFFu) | ((cnn_uvec_t)b << 16));
+}
+
+static inline cnn_vec_t vrequant_portable(cnn_vec_t acc, int shift, cnn_vec_t bias, int relu) {
+  acc = vadd_portable(acc >> shift, bias);
+  if (relu)
+    acc = vmax_i32_portable(acc, vzero_portable());
+  return acc;
+}
+
+static inline void vstore_requant_portable(number_t *out, cnn_vec_t lo, cnn_vec_t hi, int shift, long_number_t bias, int relu) {
+  const cnn_vec_t b = vset_pair_portable(bias);
+  vstore_i16_portable(out, vrequant_portable(lo, shift, b, relu), 1);
+  vstore_i16_portable(out + 4, vrequant_portable(hi, shift, b, relu), 1);
+}
+
+static inline void vstore_requant_i32_portable(number_t *out, const long_number_t *acc, int shift, const number_t *bias, int bias_step, int relu) {
+  const cnn_vec_t b = bias_step == 0 ? vset_pair_portable(bias[0]) : vload_bias_portable(bias);
+  vstore_i16_portable(out, vrequant_portable(vload_i32_portable(acc), shift, b, relu), 1);
+  vstore_i16_portable(out + 4, vrequant_portable(vload_i32_portable(acc + 4), shift, bias_step == 0 ? b : vload_bias_portable(bias + 4), relu), 1);
+}
+
+static inline void vstore_requant_pool2_portable(number_t *out, cnn_vec_t lo, cnn_vec_t hi, int shift, long_number_t bias, int relu) {
+  const cnn_vec_t even = {lo[0], lo[2], hi[0], hi[2]}, odd = {lo[1], lo[3], hi[1], hi[3]};
+  vstore_i16_portable(out, vrequant_portable(vmax_i32_portable(even, odd), shift, vset_pair_portable(bias), relu), 1);
+}
+
+static inline void vstore_pool2_portable(number_t *out, const number_t *in, int relu) {
+  cnn_vec_t a, b;
+  memcpy(&a, in, sizeof(a));
+  memcpy(&b, in + 8, sizeof(b));
+  a = vmax_i32_portable(vlow16_portable(a), a >> 16);
+  b = vmax_i32_portable(vlow16_portable(b), b >> 16);
+  if (relu) {
+    a = vmax_i32_portable(a, vzero_portable());
+    b = vmax_i32_portable(b, vzero_portable());
+  }
+  vstore_i16_portable(out, a, 0);
+  vstore_i16_portable(out + 4, b, 0);
+}
+
+#ifdef CNN_SIMD_X86
+
+#pragma GCC push_options
+#pragma GCC target("sse4.1")
+
+static inline __m128i vzero_sse41(void) { return _mm_setzero_si128(); }
+static inline __m128i vadd_sse41(__m128i a, __m128i b) { return _mm_add_epi32(a, b); }
+static inline __m128i vmadd_sse41(__m128i a, __m128i b) { return _mm_madd_epi16(a, b); }
+static inline __m128i vset_pair_sse41(int32_t pair) { return _mm_set1_epi32(pair); }
+static inline __m128i vload_i32_sse41(const int32_t *p) { return _mm_loadu_si128((const __m128i *)p); }
+static inline void vstore_i32_sse41(int32_t *p, __m128i v) { _mm_storeu_si128((__m128i *)p, v); }
+
+static inline void vload_pairs_sse41(const number_t *in, unsigned short stride, __m128i *lo, __m128i *hi) {
+  if (stride == 1) {
+    __m128i a = _mm_loadu_si128((const __m128i *)in);
+    __m128i b = _mm_loadu_si128((const __m128i *)(in + 1));
+    *lo = _mm_unpacklo_epi16(a, b);
+    *hi = _mm_unpackhi_epi16(a, b);
+  } else if (stride == 2) {
+    *lo = _mm_loadu_si128((const __m128i *)in);
+    *hi = _mm_loadu_si128((const __m128i *)(in + 8));
+  } else {
+    *lo = _mm_set_epi32(load_number_pair(in + 3 * stride), load_number_pair(in + 2 * stride),
+                        load_number_pair(in + stride), load_number_pair(in));
+    *hi = _mm_set_epi32(load_number_pair(in + 7 * stride), load_number_pair(in + 6 * stride),
+                        load_number_pair(in + 5 * stride), load_number_pair(in + 4 * stride));
+  }
+}
+
+static inline void vload_rows_pairs_sse41(const number_t *a, const number_t *b, __m128i *lo, __m128i *hi) {
+  __m128i x = _mm_loadu_si128((const __m128i *)a);
+  __m128i y = _mm_loadu_si128((const __m128i *)b);
+  *lo = _mm_unpacklo_epi16(x, y);
+  *hi = _mm_unpackhi_epi16(x, y);
+}
+
+static inline __m128i vlow_pair_sse41(__m128i a) { return _mm_blend_epi16(a, _mm_setzero_si128(), 0xAA); }
+
+static inline __m128i vmax_pairs_sse41(__m128i a, __m128i b) {
+  a = _mm_max_epi16(a, _mm_srli_epi32(a, 16));
+  b = _mm_max_epi16(b, _mm_srli_epi32(b, 16));
+  return _mm_blend_epi16(a, _mm_slli_epi32(b, 16), 0xAA);
+}
+
+static inline __m128i vrequant_sse41(__m128i acc, int shift, __m128i bias, int relu) {
+  acc = _mm_add_epi32(_mm_sra_epi32(acc, _mm_cvtsi32_si128(shift)), bias); // arithmetic shift == requantize_number_t
+  if (relu)
+    acc = _mm_max_epi32(acc, _mm_setzero_si128());
+  return acc;
+}
+
+static inline __m128i vload_bias_sse41(const number_t *bias) {
+  return _mm_cvtepi16_epi32(_mm_loadl_epi64((const __m128i *)bias));
+}
+
+static inline void vstore_requant_sse41(number_t *out, __m128i lo, __m128i hi, int shift, long_number_t bias, int relu) {
+  __m128i b = _mm_set1_epi32(bias);
+  _mm_storeu_si128((__m128i *)out, _mm_packs_epi32(vrequant_sse41(lo, shift, b, relu), vrequant_sse41(hi, shift, b, relu))); // Saturating pack == clamp_to_number_t
+}
+
+static inline void vstore_requant_i32_sse41(number_t *out, const long_number_t *acc, int shift, const number_t *bias, int bias_step, int relu) {
+  __m128i lo = _mm_loadu_si128((const __m128i *)acc);
+  __m128i hi = _mm_loadu_si128((const __m128i *)(acc + 4));
+  __m128i b = bias_step == 0 ? _mm_set1_epi32(bias[0]) : vload_bias_sse41(bias);
+  lo = vrequant_sse41(lo, shift, b, relu);
+  hi = vrequant_sse41(hi, shift, bias_step == 0 ? b : vload_bias_sse41(bias + 4), relu);
+  _mm_storeu_si128((__m128i *)out, _mm_packs_epi32(lo, hi));
+}
+
+static inline void vstore_requant_pool2_sse41(number_t *out, __m128i lo, __m128i hi, int shift, long_number_t bias, int relu) {
+  __m128i v;
+  lo = _mm_max_epi32(lo, _mm_shuffle_epi32(lo, 0xB1)); // max of positions 2i and 2i+1 in both lanes
+  hi = _mm_max_epi32(hi, _mm_shuffle_epi32(hi, 0xB1));
+  v = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(lo), _mm_castsi128_ps(hi), _MM_SHUFFLE(2, 0, 2, 0)));
+  v = vrequant_sse41(v, shift, _mm_set1_epi32(bias), relu);
+  _mm_storel_epi64((__m128i *)out, _mm_packs_epi32(v, v));
+}
+
+static inline void vstore_pool2_sse41(number_t *out, const number_t *in, int relu) {
+  __m128i a = _mm_loadu_si128((const __m128i *)in);
+  __m128i b = _mm_loadu_si128((const __m128i *)(in + 8));
+  a = _mm_max_epi16(a, _mm_srli_epi32(a, 16)); // max of each pair in the low half of its lane
+  b = _mm_max_epi16(b, _mm_srli_epi32(b, 16));
+  a = _mm_srai_epi32(_mm_slli_epi32(a, 16), 16);
+  b = _mm_srai_epi32(_mm_slli_epi32(b, 16), 16);
+  a = _mm_packs_epi32(a, b); // deinterleaves the maxima back to consecutive samples
+  if (relu)
+    a = _mm_max_epi16(a, _mm_setzero_si128());
+  _mm_storeu_si128((__m128i *)out, a);
+}
+
+#pragma GCC pop_options
+
+#pragma GCC push_options
+#pragma GCC target("avx2")
+
+static inline __m256i vzero_avx2(void) { return _mm256_setzero_si256(); }
+static inline __m256i vadd_avx2(__m256i a, __m256i b) { return _mm256_add_epi32(a, b); }
+static inline __m256i vmadd_avx2(__m256i a, __m256i b) { return _mm256_madd_epi16(a, b); }
+static inline __m256i vset_pair_avx2(int32_t pair) { return _mm256_set1_epi32(pair); }
+static inline __m256i vload_i32_avx2(const int32_t *p) { return _mm256_loadu_si256((const __m256i *)p); }
+static inline void vstore_i32_avx2(int32_t *p, __m256i v) { _mm256_storeu_si256((__m256i *)p, v); }
+
+// 256-bit unpack and pack both work per 128-bit lane: lo holds positions 0-3 and 8-11, hi holds
+// positions 4-7 and 12-15, and _mm256_packs_epi32(lo, hi) restores 0..15
+static inline void vload_pairs_avx2(const number_t *in, unsigned short stride, __m256i *lo, __m256i *hi) {
+  if (stride == 1) {
+    __m256i a = _mm256_loadu_si256((const __m256i *)in);
+    __m256i b = _mm256_loadu_si256((const __m256i *)(in + 1));
+    *lo = _mm256_unpacklo_epi16(a, b);
+    *hi = _mm256_unpackhi_epi16(a, b);
+  } else if (stride == 2) {
+    __m256i a = _mm256_loadu_si256((const __m256i *)in);
+    __m256i b = _mm256_loadu_si256((const __m256i *)(in + 16));
+    *lo = _mm256_permute2x128_si256(a, b, 0x20);
+    *hi = _mm256_permute2x128_si256(a, b, 0x31);
+  } else {
+    __m256i idx = _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 8, 9, 10, 11), _mm256_set1_epi32(stride));
+    *lo = _mm256_i32gather_epi32((const int *)in, idx, sizeof(number_t));
+    idx = _mm256_add_epi32(idx, _mm256_set1_epi32(4 * stride));
+    *hi = _mm256_i32gather_epi32((const int *)in, idx, sizeof(number_t));
+  }
+}
+
+static inline void vload_rows_pairs_avx2(const number_t *a, const number_t *b, __m256i *lo, __m256i *hi) {
+  __m256i x = _mm256_loadu_si256((const __m256i *)a);
+  __m256i y = _mm256_loadu_si256((const __m256i *)b);
+  *lo = _mm256_unpacklo_epi16(x, y);
+  *hi = _mm256_unpackhi_epi16(x, y);
+}
+
+static inline __m256i vlow_pair_avx2(__m256i a) { return _mm256_blend_epi16(a, _mm256_setzero_si256(), 0xAA); }
+
+static inline __m256i vmax_pairs_avx2(__m256i a, __m256i b) {
+  a = _mm256_max_epi16(a, _mm256_srli_epi32(a, 16));
+  b = _mm256_max_epi16(b, _mm256_srli_epi32(b, 16));
+  return _mm256_blend_epi16(a, _mm256_slli_epi32(b, 16), 0xAA);
+}
+
+static inline __m256i vrequant_avx2(__m256i acc, int shift, __m256i bias, int relu) {
+  acc = _mm256_add_epi32(_mm256_sra_epi32(acc, _mm_cvtsi32_si128(shift)), bias);
+  if (relu)
+    acc = _mm256_max_epi32(acc, _mm256_setzero_si256());
+  return acc;
+}
+
+static inline __m256i vload_bias_avx2(const number_t *bias) {
+  return _mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i *)bias));
+}
+
+static inline void vstore_requant_avx2(number_t *out, __m256i lo, __m256i hi, int shift, long_number_t bias, int relu) {
+  __m256i b = _mm256_set1_epi32(bias);
+  _mm256_storeu_si256((__m256i *)out, _mm256_packs_epi32(vrequant_avx2(lo, shift, b, relu), vrequant_avx2(hi, shift, b, relu))); // Saturating pack == clamp_to_number_t
+}
+
+// acc in memory order: lo holds 0-7 and hi 8-15, the per 128-bit lane pack is undone by permute4x64
+static inline void vstore_requant_i32_avx2(number_t *out, const long_number_t *acc, int shift, const number_t *bias, int bias_step, int relu) {
+  __m256i lo = _mm256_loadu_si256((const __m256i *)acc);
+  __m256i hi = _mm256_loadu_si256((const __m256i *)(acc + 8));
+  __m256i b = bias_step == 0 ? _mm256_set1_epi32(bias[0]) : vload_bias_avx2(bias);
+  lo = vrequant_avx2(lo, shift, b, relu);
+  hi = vrequant_avx2(hi, shift, bias_step == 0 ? b : vload_bias_avx2(bias + 8), relu);
+  _mm256_storeu_si256((__m256i *)out, _mm256_permute4x64_epi64(_mm256_packs_epi32(lo, hi), 0xD8));
+}
+
+// lo/hi in vload_pairs order: the per 128-bit lane shuffle_ps brings the maxima back to 0..7
+static inline void vstore_requant_pool2_avx2(number_t *out, __m256i lo, __m256i hi, int shift, long_number_t bias, int relu) {
+  __m256i v;
+  lo = _mm256_max_epi32(lo, _mm256_shuffle_epi32(lo, 0xB1));
+  hi = _mm256_max_epi32(hi, _mm256_shuffle_epi32(hi, 0xB1));
+  v = _mm256_castps_si256(_mm256_shuffle_ps(_mm256_castsi256_ps(lo), _mm256_castsi256_ps(hi), _MM_SHUFFLE(2, 0, 2, 0)));
+  v = vrequant_avx2(v, shift, _mm256_set1_epi32(bias), relu);
+  v = _mm256_permute4x64_epi64(_mm256_packs_epi32(v, v), 0x08); // 64-bit lanes 0 and 2 hold samples 0-3 and 4-7
+  _mm_storeu_si128((__m128i *)out, _mm256_castsi256_si128(v));
+}
+
+static inline void vstore_pool2_avx2(number_t *out, const number_t *in, int relu) {
+  __m256i a = _mm256_loadu_si256((const __m256i *)in);
+  __m256i b = _mm256_loadu_si256((const __m256i *)(in + 16));
+  a = _mm256_max_epi16(a, _mm256_srli_epi32(a, 16));
+  b = _mm256_max_epi16(b, _mm256_srli_epi32(b, 16));
+  a = _mm256_srai_epi32(_mm256_slli_epi32(a, 16), 16);
+  b = _mm256_srai_epi32(_mm256_slli_epi32(b, 16), 16);
+  a = _mm256_permute4x64_epi64(_mm256_packs_epi32(a, b), 0xD8); // packs is per 128-bit lane
+  if (relu)
+    a = _mm256_max_epi16(a, _mm256_setzero_si256());
+  _mm256_storeu_si256((__m256i *)out, a);
+}
+
+#pragma GCC pop_options
+
+#endif//CNN_SIMD_X86
+
+#endif//CNN_SIMD
+
+#endif//__SIMD_H__
@@ -0,0 +1,173 @@
+/**
+  ******************************************************************************
+  * @file    softmax.h
+  * @version 1.0.0
+  * @date    17 october 2026
+  * @brief   Fixed-point softmax and log-softmax of the logits of the model, on lookup tables
+  *
+  * The Keras model ends with a softmax that the generated code leaves out, cnn() returns the
+  * logits of dense_59. These turn them into per-class confidences: z[i] = (max(x) - x[i]) / T is
+  * taken in Q9 nats (T the temperature of weights/softmax.c, 1 unless tools/softmax_calibration.py
+  * finds a stable one, folded with the input format in multiplier / 2^shift), exp(-z) is the product of two Q15 table entries, exp(-k / 16)
+  * for the sixteenths of a nat and exp(-j / 512) for the 32 remainders (0 from 11 nats on), and the
+  * probabilities are the exps times one reciprocal of their sum: one division per call, no floating
+  * point. The log-softmax is -z - ln(sum), the log of the sum normalized to [1, 2) read from a
+  * 65-entry table and interpolated. The outputs are in the format of number_t (1.0 = 1 << FIXED_POINT),
+  * the probabilities within one unit of the float softmax of the same logits, the log-probabilities
+  * within two. The classes are few (7 here) and the tables are gathers, so the loops stay scalar:
+  * a few hundred cycles per clip against millions for the convs. Floating-point builds
+  * (FIXED_POINT 0) use expf() and logf().
+  */
+
+#ifndef __SOFTMAX_H__
+#define __SOFTMAX_H__
+
+#ifndef SINGLE_FILE
+#include "number.h"
+#endif
+
+#include <stdint.h>
+
+#define SOFTMAX_Z_BITS 9 // fractional bits of z, in nats
+
+// multiplier and shift for a temperature of 1, the default of weights/softmax.c
+#define SOFTMAX_DEFAULT_MULTIPLIER (1 << 14)
+#define SOFTMAX_DEFAULT_SHIFT      (14 + FIXED_POINT - SOFTMAX_Z_BITS)
+
+#if FIXED_POINT > 0
+
+#define SOFTMAX_EXP_ENTRIES 176 // exp(-z) of the sixteenths of a nat up to 11 nats, 0 after
+#define SOFTMAX_LN2         22713 // ln(2) in Q15
+
+// exp(-i / 16) in Q15
+static const uint16_t softmax_exp_hi[SOFTMAX_EXP_ENTRIES] = {
+  32768, 30783, 28918, 27166, 25520, 23974, 22521, 21157, 19875, 18671, 17539, 16477,
+  15479, 14541, 13660, 12832, 12055, 11324, 10638, 9994, 9388, 8819, 8285, 7783,
+  7312, 6869, 6452, 6061, 5694, 5349, 5025, 4721, 4435, 4166, 3914, 3676,
+  3454, 3244, 3048, 2863, 2690, 2527, 2374, 2230, 2095, 1968, 1849, 1737,
+  1631, 1533, 1440, 1352, 1271, 1194, 1121, 1053, 990, 930, 873, 820,
+  771, 724, 680, 639, 600, 564, 530, 498, 467, 439, 412, 387,
+  364, 342, 321, 302, 283, 266, 250, 235, 221, 207, 195, 183,
+  172, 162, 152, 143, 134, 126, 118, 111, 104, 98, 92, 86,
+  81, 76, 72, 67, 63, 59, 56, 52, 49, 46, 43, 41,
+  38, 36, 34, 32, 30, 28, 26, 25, 23, 22, 21, 19,
+  18, 17, 16, 15, 14, 13, 12, 12, 11, 10, 10, 9,
+  9, 8, 8, 7, 7, 6, 6, 6, 5, 5, 5, 4,
+  4, 4, 4, 3, 3, 3, 3, 3, 2, 2, 2, 2,
+  2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1,
+};
+
+// exp(-j / 512) in Q15
+static const uint16_t softmax_exp_lo[32] = {
+  32768, 32704, 32640, 32577, 32513, 32450, 32386, 32323, 32260, 32197, 32134, 32072,
+  32009, 31946, 31884, 31822, 31760, 31698, 31636, 31574, 31513, 31451, 31390, 31329,
+  31267, 31206, 31146, 31085, 31024, 30964, 30903, 30843,
+};
+
+// ln(1 + i / 64) in Q15
+static const uint16_t softmax_ln[65] = {
+  0, 508, 1008, 1501, 1987, 2465, 2936, 3401, 3860, 4311, 4757, 5197,
+  5631, 6060, 6482, 6900, 7312, 7719, 8121, 8518, 8911, 9299, 9682, 10061,
+  10435, 10805, 11171, 11534, 11892, 12246, 12596, 12943, 13286, 13626, 13962, 14295,
+  14624, 14950, 15273, 15593, 15909, 16223, 16533, 16841, 17146, 17448, 17747, 18044,
+  18337, 18629, 18917, 19204, 19487, 19769, 20048, 20324, 20598, 20870, 21140, 21407,
+  21673, 21936, 22197, 22456, 22713,
+};
+
+// z = (largest - x) * multiplier >> shift in Q9 nats (multiplier < 2^16), saturated to 2^15 - 1
+static inline long_number_t softmax_z(number_t largest, number_t x, long_number_t multiplier, int shift) {
+  const uint32_t z = ((uint32_t)((long_number_t)largest - x) * (uint32_t)multiplier + ((1u << shift) >> 1)) >> shift; // < 2^32
+
+  return z < 32767 ? (long_number_t)z : 32767;
+}
+
+// exp(-z) in Q15, z in Q9 nats
+static inline long_number_t softmax_exp(long_number_t z) {
+  if (z >= SOFTMAX_EXP_ENTRIES << 5)
+    return 0;
+  return ((long_number_t)softmax_exp_hi[z >> 5] * softmax_exp_lo[z & 31] + (1 << 14)) >> 15;
+}
+
+// ln(sum / 2^15) in Q15, sum >= 2^15
+static inline long_number_t softmax_ln_sum(long_number_t sum) {
+  long_number_t k = 0, f, i;
+
+  while (sum >= 1 << 16) {
+    sum >>= 1;
+    k++;
+  }
+  f = sum - (1 << 15); // mantissa - 1 in Q15
+  i = f >> 9;
+  return k * SOFTMAX_LN2 + softmax_ln[i] + (((softmax_ln[i + 1] - softmax_ln[i]) * (f & 511) + 256) >> 9);
+}
+
+// out[i] = softmax(in / T)[i] for i < n, multiplier / 2^shift = 2^(SOFTMAX_Z_BITS - FIXED_POINT) / T;
+// out may be in
+static inline void softmax_number_t(const number_t *in, int n, long_number_t multiplier, int shift, number_t *out) {
+  number_t largest = in[0];
+  long_number_t sum = 0, reciprocal;
+  int i;
+
+  for (i = 1; i < n; i++)
+    largest = largest < in[i] ? in[i] : largest;
+  for (i = 0; i < n; i++)
+    sum += softmax_exp(softmax_z(largest, in[i], multiplier, shift));
+  reciprocal = (1 << 30) / sum; // sum >= 2^15, exp(0) of the max
+  for (i = 0; i < n; i++)
+    out[i] = (number_t)((softmax_exp(softmax_z(largest, in[i], multiplier, shift)) * reciprocal + ((1 << (30 - FIXED_POINT)) >> 1)) >> (30 - FIXED_POINT));
+}
+
+// out[i] = log_softmax(in / T)[i] for i < n, saturated to NUMBER_MIN; out may be in
+static inline void log_softmax_number_t(const number_t *in, int n, long_number_t multiplier, int shift, number_t *out) {
+  number_t largest = in[0];
+  long_number_t sum = 0, ln_sum, v;
+  int i;
+
+  for (i = 1; i < n; i++)
+    largest = largest < in[i] ? in[i] : largest;
+  for (i = 0; i < n; i++)
+    sum += softmax_exp(softmax_z(largest, in[i], multiplier, shift));
+  ln_sum = softmax_ln_sum(sum);
+  for (i = 0; i < n; i++) {
+    v = (softmax_z(largest, in[i], multiplier, shift) << (15 - SOFTMAX_Z_BITS)) + ln_sum; // -log p in Q15
+    v = (v + ((1 << (15 - FIXED_POINT)) >> 1)) >> (15 - FIXED_POINT);
+    out[i] = clamp_to_number_t(-v);
+  }
+}
+
+#else
+
+#include <math.h>
+
+static inline void softmax_number_t(const number_t *in, int n, long_number_t multiplier, int shift, number_t *out) {
+  const float scale = ldexpf((float)multiplier, -(shift + SOFTMAX_Z_BITS)); // 1 / T
+  number_t largest = in[0];
+  float sum = 0;
+  int i;
+
+  for (i = 1; i < n; i++)
+    largest = largest < in[i] ? in[i] : largest;
+  for (i = 0; i < n; i++)
+    sum += expf((in[i] - largest) * scale);
+  for (i = 0; i < n; i++)
+    out[i] = expf((in[i] - largest) * scale) / sum;
+}
+
+static inline void log_softmax_number_t(const number_t *in, int n, long_number_t multiplier, int shift, number_t *out) {
+  const float scale = ldexpf((float)multiplier, -(shift + SOFTMAX_Z_BITS));
+  number_t largest = in[0];
+  float sum = 0;
+  int i;
+
+  for (i = 1; i < n; i++)
+    largest = largest < in[i] ? in[i] : largest;
+  for (i = 0; i < n; i++)
+    sum += expf((in[i] - largest) * scale);
+  for (i = 0; i < n; i++)
+    out[i] = (in[i] - largest) * scale - logf(sum);
+}
+
+#endif//FIXED_POINT
+
+#endif//__SOFTMAX_H__
@@ -0,0 +1,217 @@
+/**
+  ******************************************************************************
+  * @file    sparse.h
+  * @version 1.0.0
+  * @date    17 october 2026
+  * @brief   conv1d and dense kernels on block-sparse weights, skipping the pruned blocks
+  *
+  * tools/sparse_weights.py zeroes the blocks of smallest magnitude of a layer and stores the
+  * others with their column (sparse_weights_t). A conv block is SPARSE_CONV_ROWS filters x the
+  * taps of one input channel, the filters and window pairs the vector conv kernel runs together
+  * (stored at the tap count, an odd last tap is paired with zero in registers); a dense block is
+  * DENSE_PANEL_UNITS units x one input pair, a row of a panel of dense_gemm.h. The kernels only
+  * walk the stored blocks of each group: the vector ones are those of conv1d_simd.h and
+  * dense_gemm.h on the block list, the scalar ones multiply each nonzero weight of a block by a
+  * whole row of the input. Both sum the same int32 products, the outputs are bit-exact. The sparse
+  * conv runs on one thread. Enabled at build time with -DCNN_SPARSE for the layers that
+  * tools/sparse_weights.py pruned (weights/sparse.c defines <LAYER>_SPARSE for each and holds
+  * their bias): their int16 kernel is not linked.
+  */
+
+#ifndef __SPARSE_H__
+#define __SPARSE_H__
+
+#ifndef SINGLE_FILE
+#include "number.h"
+#include "layer_params.h"
+#include "simd.h"
+#include "requant_simd.h"
+#include "conv1d_simd.h"
+#include "dense_gemm.h"
+#endif
+
+#include <stddef.h>
+#include <string.h>
+
+#define SPARSE_CONV_ROWS   4     // filters per group of a conv, DENSE_PANEL_UNITS units for a dense layer
+#define SPARSE_MAX_INPUT   16384 // input_channels * input_samples of a conv after the input pooling, scalar kernel
+#define SPARSE_MAX_SAMPLES 1024  // conv outputs of one filter, before the output pooling
+
+#ifdef CNN_SIMD
+
+#define SIMD_ISA(name) name##_portable
+#define SIMD_VEC cnn_vec_t
+#define SIMD_LANES 4
+#include "sparse_isa.h"
+#undef SIMD_ISA
+#undef SIMD_VEC
+#undef SIMD_LANES
+
+#ifdef CNN_SIMD_X86
+
+#pragma GCC push_options
+#pragma GCC target("sse4.1")
+#define SIMD_ISA(name) name##_sse41
+#define SIMD_VEC __m128i
+#define SIMD_LANES 4
+#include "sparse_isa.h"
+#undef SIMD_ISA
+#undef SIMD_VEC
+#undef SIMD_LANES
+#pragma GCC pop_options
+
+#pragma GCC push_options
+#pragma GCC target("avx2")
+#define SIMD_ISA(name) name##_avx2
+#define SIMD_VEC __m256i
+#define SIMD_LANES 8
+#include "sparse_isa.h"
+#undef SIMD_ISA
+#undef SIMD_VEC
+#undef SIMD_LANES
+#pragma GCC pop_options
+
+#endif//CNN_SIMD_X86
+
+#endif//CNN_SIMD
+
+// Conv p on the block-sparse weights w, optionally preceded by the max pooling input_pool of its
+// input and followed by the max pooling output_pool (both may be NULL, linear pools only),
+// requantized with bias. Returns 0 when the layer does not fit the buffers, which conv1d_<n>.c
+// rules out at build time: the layer has no int16 kernel to run instead.
+static inline int conv1d_maxpool1d_sparse(
+  const maxpool1d_params_t *input_pool,
+  const conv1d_params_t *p,
+  const maxpool1d_params_t *output_pool,
+  const sparse_weights_t *w,
+  const number_t *input,    // [input_channels][input_samples], or the input of input_pool
+  const number_t *bias,     // [filters]
+  number_t *output) {       // [filters][outsamples], [filters][pool_length] with output_pool
+
+  number_t pooled[SPARSE_MAX_INPUT];
+  long_number_t acc[SPARSE_MAX_SAMPLES];
+  const int samples = p->outsamples;
+  const int relu = p->activation == ACTIVATION_KIND_RELU;
+  const int out_samples = output_pool != NULL ? output_pool->pool_length : samples;
+  const int groups = (p->filters + w->rows - 1) / w->rows;
+  const number_t *in, *v;
+  long_number_t max;
+  number_t x, tmp;
+  int g, f, k, i, z, pos, y;
+
+  if (p->zeropadding_left != 0 || p->zeropadding_right != 0 || w->cols != p->kernel_size || samples > SPARSE_MAX_SAMPLES)
+    return 0;
+  if ((input_pool != NULL && input_pool->activation != ACTIVATION_KIND_LINEAR)
+      || (output_pool != NULL && output_pool->activation != ACTIVATION_KIND_LINEAR))
+    return 0;
+
+#ifdef CNN_SIMD
+  if (cnn_isa != CNN_ISA_SCALAR && w->rows == SPARSE_CONV_ROWS
+      && conv1d_simd_fits(input_pool, p, output_pool)) {
+    const int raw_samples = input_pool != NULL ? input_pool->input_samples : 0;
+#ifdef CNN_SIMD_X86
+    if (cnn_isa == CNN_ISA_AVX2)
+      conv1d_maxpool1d_sparse_avx2(p, w, input, raw_samples, bias, output_pool != NULL, output);
+    else if (cnn_isa == CNN_ISA_SSE41)
+      conv1d_maxpool1d_sparse_sse41(p, w, input, raw_samples, bias, output_pool != NULL, output);
+    else
+#endif
+      conv1d_maxpool1d_sparse_portable(p, w, input, raw_samples, bias, output_pool != NULL, output);
+    return 1;
+  }
+#endif
+
+  if (input_pool != NULL) {
+    if (p->input_channels * p->input_samples > SPARSE_MAX_INPUT)
+      return 0;
+    for (z = 0; z < p->input_channels; z++) {
+      in = input + z * input_pool->input_samples;
+      for (pos = 0; pos < p->input_samples; pos++) {
+        x = in[pos * input_pool->pool_stride];
+        for (y = 1; y < input_pool->pool_size; y++) {
+          tmp = in[pos * input_pool->pool_stride + y];
+          x = x < tmp ? tmp : x;
+        }
+        pooled[z * p->input_samples + pos] = x;
+      }
+    }
+    input = pooled;
+  }
+
+  for (g = 0; g < groups; g++) {
+    for (f = 0; f < w->rows && g * w->rows + f < p->filters; f++) {
+      k = g * w->rows + f;
+      for (pos = 0; pos < samples; pos++)
+        acc[pos] = 0;
+      for (i = w->start[g]; i < w->start[g + 1]; i++) {
+        v = w->values + (i * w->rows + f) * w->cols;
+        in = input + w->index[i] * p->input_samples;
+        for (z = 0; z < p->kernel_size; z++) {
+          if (v[z] == 0) // the other filters of the group keep the block
+            continue;
+          for (pos = 0; pos < samples; pos++)
+            acc[pos] += v[z] * in[pos * p->stride + z];
+        }
+      }
+
+      // The pooled accumulators are written in place, the requantization is monotonic
+      if (output_pool != NULL) {
+        for (pos = 0; pos < out_samples; pos++) {
+          max = acc[pos * output_pool->pool_stride];
+          for (y = 1; y < output_pool->pool_size; y++)
+            if (max < acc[pos * output_pool->pool_stride + y])
+              max = acc[pos * output_pool->pool_stride + y];
+          acc[pos] = max;
+        }
+      }
+      requant_simd_row(output + k * out_samples, acc, out_samples, p->requant_shift, &bias[k], 0, relu);
+    }
+  }
+  return 1;
+}
+
+// Accumulators of a dense layer on the block-sparse weights w, to be requantized by the caller
+// like those of its int16 weights. The vector kernels also write the units past the last one,
+// acc holds DENSE_GEMM_LDACC(units) of them as for dense_gemm(). They load whole input pairs: the
+// generated layers check at build time that the inputs are even, odd ones run the scalar loop.
+static inline void dense_sparse(
+  const sparse_weights_t *w,
+  int inputs,
+  int units,
+  const number_t *input,    // [inputs]
+  long_number_t *acc) {     // [DENSE_GEMM_LDACC(units)]
+
+  const int groups = (units + w->rows - 1) / w->rows;
+  const number_t *v;
+  long_number_t sum;
+  int g, f, i, x, z;
+
+#ifdef CNN_SIMD
+  if (cnn_isa != CNN_ISA_SCALAR && w->rows == DENSE_PANEL_UNITS && w->cols == 2 && inputs % 2 == 0) {
+#ifdef CNN_SIMD_X86
+    if (cnn_isa == CNN_ISA_AVX2)
+      dense_sparse_avx2(w, units, input, acc);
+    else if (cnn_isa == CNN_ISA_SSE41)
+      dense_sparse_sse41(w, units, input, acc);
+    else
+#endif
+      dense_sparse_portable(w, units, input, acc);
+    return;
+  }
+#endif
+
+  for (g = 0; g < groups; g++) {
+    for (f = 0; f < w->rows && g * w->rows + f < units; f++) {
+      sum = 0;
+      for (i = w->start[g]; i < w->start[g + 1]; i++) {
+        v = w->values + (i * w->rows + f) * w->cols;
+        z = w->index[i] * w->cols;
+        for (x = 0; x < w->cols && z + x < inputs; x++)
+          sum += v[x] * input[z + x];
+      }
+      acc[g * w->rows + f] = sum;
+    }
+  }
+}
+
+#endif//__SPARSE_H__
@@ -0,0 +1,120 @@
+/**
+  ******************************************************************************
+  * @file    sparse_isa.h
+  * @version 1.0.0
+  * @date    17 october 2026
+  * @brief   Vectorized block-sparse conv1d and dense kernels, included once per ISA by sparse.h
+  *
+  * Expects SIMD_ISA(name) to append the ISA suffix, SIMD_VEC the vector type and SIMD_LANES its
+  * number of int32 lanes. The conv is conv1d_simd_block() of conv1d_simd_isa.h with the loop over
+  * the input channels replaced by the stored blocks of a group of 4 filters, the dense layer is
+  * dense_gemv() of dense_gemm_isa.h with the loop over the input pairs replaced by those of a panel.
+  */
+
+// Conv p on the block-sparse weights w (groups of SPARSE_CONV_ROWS filters, blocks of
+// kernel_size taps, read by pairs), same input, pooling and output as conv1d_maxpool1d_simd() of
+// conv1d_simd_isa.h. The windows of a block of 2*SIMD_LANES conv positions are interleaved once
+// for every channel and each stored block of a group adds its channel to the 8 accumulators of the
+// 4 filters. For an odd kernel_size the second sample of the last window pair is zeroed, so that
+// the last tap of a filter is loaded with the first tap of the next row as one pair; the last row
+// of a block, which may end the array, loads it alone.
+static void SIMD_ISA(conv1d_maxpool1d_sparse)(
+  const conv1d_params_t *p,
+  const sparse_weights_t *w,
+  const number_t *input,    // [input_channels][input_samples], [input_channels][raw_samples] if pooled
+  int raw_samples,
+  const number_t *bias,     // [filters]
+  int pool2,
+  number_t *output) {       // [filters][outsamples], [filters][outsamples / 2] if pool2
+
+  const int block = 2 * SIMD_LANES;                 // conv positions per iteration
+  const int out_block = pool2 ? SIMD_LANES : block;
+  const int npairs = (w->cols + 1) / 2, full_pairs = w->cols / 2;
+  const int out_samples = pool2 ? p->outsamples / 2 : p->outsamples;
+  const int conv_samples = pool2 ? 2 * out_samples : p->outsamples;
+  const int groups = (p->filters + SPARSE_CONV_ROWS - 1) / SPARSE_CONV_ROWS;
+  const int relu = p->activation == ACTIVATION_KIND_RELU;
+  SIMD_VEC pairs[CONV1D_SIMD_MAX_PAIRS][2];
+  number_t partial_out[2 * SIMD_LANES];
+  number_t *out;
+  int pos, count, g, i, j, f, k;
+
+  for (pos = 0; pos < conv_samples; pos += block) {
+    count = conv_samples - pos < block ? conv_samples - pos : block;
+    if (pool2)
+      count /= 2;
+    SIMD_ISA(conv1d_simd_windows)(p, input, raw_samples, pos / block, 1, pairs);
+    if (full_pairs < npairs) // odd kernel_size
+      for (i = 0; i < p->input_channels; i++) {
+        pairs[i * npairs + full_pairs][0] = SIMD_ISA(vlow_pair)(pairs[i * npairs + full_pairs][0]);
+        pairs[i * npairs + full_pairs][1] = SIMD_ISA(vlow_pair)(pairs[i * npairs + full_pairs][1]);
+      }
+
+    for (g = 0; g < groups; g++) {
+      SIMD_VEC acc[SPARSE_CONV_ROWS][2];
+
+      for (f = 0; f < SPARSE_CONV_ROWS; f++)
+        acc[f][0] = acc[f][1] = SIMD_ISA(vzero)();
+
+      for (i = w->start[g]; i < w->start[g + 1]; i++) {
+        const number_t *v = w->values + i * SPARSE_CONV_ROWS * w->cols;
+        SIMD_VEC (*x)[2] = pairs + w->index[i] * npairs;
+
+        for (j = 0; j < npairs; j++) {
+          const SIMD_VEC w0 = SIMD_ISA(vset_pair)(load_number_pair(v + 2 * j));
+          const SIMD_VEC w1 = SIMD_ISA(vset_pair)(load_number_pair(v + w->cols + 2 * j));
+          const SIMD_VEC w2 = SIMD_ISA(vset_pair)(load_number_pair(v + 2 * w->cols + 2 * j));
+          const SIMD_VEC w3 = SIMD_ISA(vset_pair)(j < full_pairs ? load_number_pair(v + 3 * w->cols + 2 * j)
+                                                                 : load_number_single(v + 3 * w->cols + 2 * j));
+          acc[0][0] = SIMD_ISA(vadd)(acc[0][0], SIMD_ISA(vmadd)(x[j][0], w0));
+          acc[0][1] = SIMD_ISA(vadd)(acc[0][1], SIMD_ISA(vmadd)(x[j][1], w0));
+          acc[1][0] = SIMD_ISA(vadd)(acc[1][0], SIMD_ISA(vmadd)(x[j][0], w1));
+          acc[1][1] = SIMD_ISA(vadd)(acc[1][1], SIMD_ISA(vmadd)(x[j][1], w1));
+          acc[2][0] = SIMD_ISA(vadd)(acc[2][0], SIMD_ISA(vmadd)(x[j][0], w2));
+          acc[2][1] = SIMD_ISA(vadd)(acc[2][1], SIMD_ISA(vmadd)(x[j][1], w2));
+          acc[3][0] = SIMD_ISA(vadd)(acc[3][0], SIMD_ISA(vmadd)(x[j][0], w3));
+          acc[3][1] = SIMD_ISA(vadd)(acc[3][1], SIMD_ISA(vmadd)(x[j][1], w3));
+        }
+      }
+
+      for (f = 0; f < SPARSE_CONV_ROWS && g * SPARSE_CONV_ROWS + f < p->filters; f++) {
+        k = g * SPARSE_CONV_ROWS + f;
+        out = count < out_block ? partial_out : output + k * out_samples + (pool2 ? pos / 2 : pos);
+        if (pool2)
+          SIMD_ISA(vstore_requant_pool2)(out, acc[f][0], acc[f][1], p->requant_shift, bias[k], relu);
+        else
+          SIMD_ISA(vstore_requant)(out, acc[f][0], acc[f][1], p->requant_shift, bias[k], relu);
+        if (count < out_block)
+          memcpy(output + k * out_samples + (pool2 ? pos / 2 : pos), partial_out, count * sizeof(number_t));
+      }
+    }
+  }
+}
+
+// acc[u] for the units of a dense layer on the block-sparse weights w (groups of
+// DENSE_PANEL_UNITS units, blocks of one input pair), up to the units rounded up to the groups:
+// the stored pairs of a group are the rows of its panel that are not zero, one vector of
+// SIMD_LANES units at a time with the even and odd blocks in separate accumulators. The inputs
+// are even, every block is a whole pair of them.
+static void SIMD_ISA(dense_sparse)(const sparse_weights_t *w, int units, const number_t *input, long_number_t *acc) {
+  const int groups = (units + DENSE_PANEL_UNITS - 1) / DENSE_PANEL_UNITS;
+  int g, r, i;
+
+  for (g = 0; g < groups; g++) {
+    for (r = 0; r < DENSE_PANEL_UNITS; r += SIMD_LANES) {
+      const int32_t *v = (const int32_t *)w->values + r;
+      SIMD_VEC even = SIMD_ISA(vzero)(), odd = even;
+
+      for (i = w->start[g]; i + 1 < w->start[g + 1]; i += 2) {
+        even = SIMD_ISA(vadd)(even, SIMD_ISA(vmadd)(SIMD_ISA(vset_pair)(load_number_pair(input + 2 * w->index[i])),
+                                                    SIMD_ISA(vload_i32)(v + i * DENSE_PANEL_UNITS)));
+        odd = SIMD_ISA(vadd)(odd, SIMD_ISA(vmadd)(SIMD_ISA(vset_pair)(load_number_pair(input + 2 * w->index[i + 1])),
+                                                  SIMD_ISA(vload_i32)(v + (i + 1) * DENSE_PANEL_UNITS)));
+      }
+      if (i < w->start[g + 1])
+        even = SIMD_ISA(vadd)(even, SIMD_ISA(vmadd)(SIMD_ISA(vset_pair)(load_number_pair(input + 2 * w->index[i])),
+                                                    SIMD_ISA(vload_i32)(v + i * DENSE_PANEL_UNITS)));
+      SIMD_ISA(vstore_i32)(acc + g * DENSE_PANEL_UNITS + r, SIMD_ISA(vadd)(even, odd));
+    }
+  }
+}
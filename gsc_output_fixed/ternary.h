@@ -0,0 +1,191 @@
+/**
+  ******************************************************************************
+  * @file    ternary.h
+  * @version 1.0.0
+  * @date    17 october 2026
+  * @brief   conv1d and dense kernels on ternary or binary weights: bit-packed signs with one
+  *          scale per filter, accumulated without multiplications
+  *
+  * A filter is scale * t with t[r] in {-1, 0, +1} (ternary) or {-1, +1} (binary), so its
+  * accumulator is scale * (sum of the inputs under +1 taps - sum of the inputs under -1 taps).
+  * The taps of a filter are decoded once from its masks, then each one adds or subtracts a whole
+  * row of inputs. Binary rows only walk their +1 taps: sum(t x) = 2 sum(+1 taps) - sum(all taps),
+  * the last term being shared by every filter of the layer.
+  * The scaled accumulator stands for the one of the int16 weights, it goes through the same
+  * pooling and requantization. Enabled at build time with -DCNN_TERNARY for the layers that
+  * tools/ternary_weights.py converted (weights/ternary.c defines <LAYER>_TERNARY for each), whose
+  * int16 kernel is then not linked.
+  */
+
+#ifndef __TERNARY_H__
+#define __TERNARY_H__
+
+#ifndef SINGLE_FILE
+#include "number.h"
+#include "layer_params.h"
+#include "requant_simd.h"
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define TERNARY_MAX_TAPS    1024 // input_channels * kernel_size of a conv, input units of a dense layer
+#define TERNARY_MAX_SAMPLES 1024 // conv outputs of one filter, before the output pooling
+
+// Offsets in the input of the taps set in mask (row of words words), tap_step samples apart in a
+// channel (the stride of an input pooling), returns their number
+static inline int ternary_taps(const uint32_t *mask, int words, int kernel_size, int input_samples, int tap_step, int *offsets) {
+  int n = 0, i, r;
+  uint32_t m;
+
+  for (i = 0; i < words; i++) {
+    for (m = mask[i]; m != 0; m &= m - 1) {
+      r = i * 32 + __builtin_ctz(m);
+      offsets[n++] = r / kernel_size * input_samples + r % kernel_size * tap_step;
+    }
+  }
+  return n;
+}
+
+// acc[pos] += sign * input[offset + pos * stride] for pos < samples or, with input_pool, the max
+// of the input_pool window starting there
+static inline void ternary_add_row(long_number_t *acc, const number_t *input, const maxpool1d_params_t *input_pool,
+                                   int offset, int stride, int samples, int sign) {
+  int pos, y;
+  number_t x, tmp;
+
+  if (input_pool == NULL) {
+    input += offset;
+    if (sign > 0)
+      for (pos = 0; pos < samples; pos++)
+        acc[pos] += input[pos * stride];
+    else
+      for (pos = 0; pos < samples; pos++)
+        acc[pos] -= input[pos * stride];
+    return;
+  }
+  for (pos = 0; pos < samples; pos++) {
+    const number_t *in = input + offset + pos * stride;
+    x = in[0];
+    for (y = 1; y < input_pool->pool_size; y++) {
+      tmp = in[y];
+      if (x < tmp)
+        x = tmp;
+    }
+    acc[pos] += sign > 0 ? x : -x;
+  }
+}
+
+// scale * sum, saturated to long_number_t: a ternary sum can exceed what the int16 weights reach
+static inline long_number_t ternary_scale(long_number_t sum, number_t scale) {
+  int64_t acc = (int64_t)sum * scale;
+  return acc > INT32_MAX ? INT32_MAX : acc < INT32_MIN ? INT32_MIN : (long_number_t)acc;
+}
+
+// Conv p on the ternary weights w, optionally preceded by the max pooling input_pool of its input
+// and followed by the max pooling output_pool (both may be NULL, linear pools only), requantized
+// with bias. Returns 0 when the layer does not fit the buffers, which conv1d_<n>.c rules out at
+// build time: the layer has no int16 weights to run instead.
+static inline int conv1d_maxpool1d_ternary(
+  const maxpool1d_params_t *input_pool,
+  const conv1d_params_t *p,
+  const maxpool1d_params_t *output_pool,
+  const ternary_weights_t *w,
+  const number_t *input,    // [input_channels][input_samples], or the input of input_pool
+  const number_t *bias,     // [filters]
+  number_t *output) {       // [filters][outsamples], [filters][pool_length] with output_pool
+
+  int offsets[TERNARY_MAX_TAPS];
+  long_number_t acc[TERNARY_MAX_SAMPLES];
+  long_number_t total[TERNARY_MAX_SAMPLES]; // binary weights: minus the sum of every tap of each window
+  const int depth = p->input_channels * p->kernel_size;
+  const int samples = p->outsamples;
+  const int raw_samples = input_pool != NULL ? input_pool->input_samples : p->input_samples;
+  const int tap_step = input_pool != NULL ? input_pool->pool_stride : 1;
+  const int stride = p->stride * tap_step;
+  const int relu = p->activation == ACTIVATION_KIND_RELU;
+  const int out_samples = output_pool != NULL ? output_pool->pool_length : samples;
+  int k, n, i, pos, y;
+  uint32_t ones[TERNARY_MAX_TAPS / 32];
+
+  if (depth > TERNARY_MAX_TAPS || samples > TERNARY_MAX_SAMPLES || p->zeropadding_left != 0 || p->zeropadding_right != 0)
+    return 0;
+  if ((input_pool != NULL && input_pool->activation != ACTIVATION_KIND_LINEAR)
+      || (output_pool != NULL && output_pool->activation != ACTIVATION_KIND_LINEAR))
+    return 0;
+
+  if (w->neg == NULL) {
+    for (i = 0; i < w->words; i++)
+      ones[i] = depth - 32 * i >= 32 ? 0xFFFFFFFFu : (1u << (depth - 32 * i)) - 1;
+    n = ternary_taps(ones, w->words, p->kernel_size, raw_samples, tap_step, offsets);
+    for (pos = 0; pos < samples; pos++)
+      total[pos] = 0;
+    for (i = 0; i < n; i++)
+      ternary_add_row(total, input, input_pool, offsets[i], stride, samples, -1);
+  }
+
+  for (k = 0; k < p->filters; k++) {
+    for (pos = 0; pos < samples; pos++)
+      acc[pos] = 0;
+    n = ternary_taps(w->pos + k * w->words, w->words, p->kernel_size, raw_samples, tap_step, offsets);
+    for (i = 0; i < n; i++)
+      ternary_add_row(acc, input, input_pool, offsets[i], stride, samples, 1);
+    if (w->neg != NULL) {
+      n = ternary_taps(w->neg + k * w->words, w->words, p->kernel_size, raw_samples, tap_step, offsets);
+      for (i = 0; i < n; i++)
+        ternary_add_row(acc, input, input_pool, offsets[i], stride, samples, -1);
+      for (pos = 0; pos < samples; pos++)
+        acc[pos] = ternary_scale(acc[pos], w->scale[k]);
+    } else {
+      for (pos = 0; pos < samples; pos++)
+        acc[pos] = ternary_scale(2 * acc[pos] + total[pos], w->scale[k]);
+    }
+
+    // The pooled accumulators are written in place, the requantization is monotonic
+    if (output_pool != NULL) {
+      for (pos = 0; pos < out_samples; pos++) {
+        acc[pos] = acc[pos * output_pool->pool_stride];
+        for (y = 1; y < output_pool->pool_size; y++)
+          if (acc[pos] < acc[pos * output_pool->pool_stride + y])
+            acc[pos] = acc[pos * output_pool->pool_stride + y];
+      }
+    }
+    requant_simd_row(output + k * out_samples, acc, out_samples, p->requant_shift, &bias[k], 0, relu);
+  }
+  return 1;
+}
+
+// Accumulators acc[units] of a dense layer on the ternary weights w, to be requantized by the
+// caller like those of its int16 weights
+static inline void dense_ternary(
+  const ternary_weights_t *w,
+  int input_samples,
+  int units,
+  const number_t *input,    // [input_samples]
+  long_number_t *acc) {     // [units]
+
+  long_number_t sum, total = 0;
+  int k, i, z;
+  uint32_t m;
+
+  if (w->neg == NULL)
+    for (z = 0; z < input_samples; z++)
+      total += input[z];
+
+  for (k = 0; k < units; k++) {
+    sum = 0;
+    for (i = 0; i < w->words; i++)
+      for (m = w->pos[k * w->words + i]; m != 0; m &= m - 1)
+        sum += input[i * 32 + __builtin_ctz(m)];
+    if (w->neg != NULL) {
+      for (i = 0; i < w->words; i++)
+        for (m = w->neg[k * w->words + i]; m != 0; m &= m - 1)
+          sum -= input[i * 32 + __builtin_ctz(m)];
+    } else {
+      sum = 2 * sum - total;
+    }
+    acc[k] = ternary_scale(sum, w->scale[k]);
+  }
+}
+
+#endif//__TERNARY_H__
@@ -0,0 +1,205 @@
+/**
+  ******************************************************************************
+  * @file    thread_pool.h
+  * @version 1.0.0
+  * @date    17 october 2026
+  * @brief   Persistent worker threads splitting one layer across the cores of the host
+  *
+  * Enabled at build time with -DCNN_THREADS (link with -pthread). The number of threads defaults
+  * to the online CPUs, CNN_NUM_THREADS=n in the environment or cnn_set_num_threads() override it,
+  * 1 runs every layer on the calling thread. Tasks of a run write disjoint outputs and compute
+  * each of them exactly as the serial loops do, so the results do not depend on the thread count.
+  */
+
+#ifndef __THREAD_POOL_H__
+#define __THREAD_POOL_H__
+
+#ifdef CNN_THREADS
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#define CNN_THREADS_MAX  64
+#define CNN_THREADS_SPIN 20000 // polls of an idle worker before it sleeps, layers come back to back
+
+typedef void (*cnn_task_fn_t)(void *arg, unsigned int task);
+
+typedef struct {
+  pthread_mutex_t lock;
+  pthread_cond_t wake;             // a new run or stop, signalled to the workers
+  pthread_cond_t done;             // the last worker left the current run
+  pthread_t workers[CNN_THREADS_MAX - 1];
+  unsigned int threads;            // calling thread included
+  unsigned int started;            // running workers
+  unsigned int generation;         // bumped for each run
+  unsigned int first_generation;   // generation when the workers were started, they wait for the next one
+  unsigned int spin;               // polls before sleeping, 0 when the threads outnumber the CPUs
+  unsigned int next_task;          // first task not taken yet
+  unsigned int active;             // workers still inside the current run
+  int stop;
+  int busy;                        // a run is in flight, concurrent callers run their tasks serially
+  cnn_task_fn_t fn;
+  void *arg;
+  unsigned int ntasks;
+} cnn_thread_pool_t;
+
+static cnn_thread_pool_t cnn_thread_pool = {
+  PTHREAD_MUTEX_INITIALIZER, PTHREAD_COND_INITIALIZER, PTHREAD_COND_INITIALIZER,
+  {0}, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL, NULL, 0
+};
+
+static inline void cnn_cpu_relax(void) {
+#if defined(__x86_64__) || defined(__i386__)
+  __builtin_ia32_pause();
+#endif
+}
+
+static inline void cnn_thread_pool_tasks(cnn_thread_pool_t *pool, cnn_task_fn_t fn, void *arg, unsigned int ntasks) {
+  unsigned int task;
+  while ((task = __atomic_fetch_add(&pool->next_task, 1, __ATOMIC_RELAXED)) < ntasks)
+    fn(arg, task);
+}
+
+static void *cnn_thread_pool_worker(void *data) {
+  cnn_thread_pool_t *pool = (cnn_thread_pool_t *)data;
+  unsigned int seen = pool->first_generation;
+  unsigned int spin;
+  cnn_task_fn_t fn;
+  void *arg;
+  unsigned int ntasks;
+
+  for (;;) {
+    for (spin = 0; spin < pool->spin && __atomic_load_n(&pool->generation, __ATOMIC_ACQUIRE) == seen
+                   && !__atomic_load_n(&pool->stop, __ATOMIC_RELAXED); spin++)
+      cnn_cpu_relax();
+
+    pthread_mutex_lock(&pool->lock);
+    while (pool->generation == seen && !pool->stop)
+      pthread_cond_wait(&pool->wake, &pool->lock);
+    if (pool->stop) {
+      pthread_mutex_unlock(&pool->lock);
+      return NULL;
+    }
+    seen = pool->generation;
+    fn = pool->fn;
+    arg = pool->arg;
+    ntasks = pool->ntasks;
+    pthread_mutex_unlock(&pool->lock);
+
+    cnn_thread_pool_tasks(pool, fn, arg, ntasks);
+
+    // The run is not over before every worker has left it, so that none of them can take a task
+    // index of the next run with the function of this one
+    if (__atomic_sub_fetch(&pool->active, 1, __ATOMIC_ACQ_REL) == 0) {
+      pthread_mutex_lock(&pool->lock);
+      pthread_cond_signal(&pool->done);
+      pthread_mutex_unlock(&pool->lock);
+    }
+  }
+}
+
+static inline void cnn_thread_pool_acquire(cnn_thread_pool_t *pool) {
+  while (__atomic_exchange_n(&pool->busy, 1, __ATOMIC_ACQUIRE))
+    cnn_cpu_relax();
+}
+
+static inline void cnn_thread_pool_release(cnn_thread_pool_t *pool) {
+  __atomic_store_n(&pool->busy, 0, __ATOMIC_RELEASE);
+}
+
+// Stops the workers and starts threads - 1 new ones, the caller holds busy
+static void cnn_thread_pool_resize(cnn_thread_pool_t *pool, unsigned int threads) {
+  unsigned int i;
+
+  pthread_mutex_lock(&pool->lock);
+  __atomic_store_n(&pool->stop, 1, __ATOMIC_RELAXED);
+  pthread_cond_broadcast(&pool->wake);
+  pthread_mutex_unlock(&pool->lock);
+  for (i = 0; i < pool->started; i++)
+    pthread_join(pool->workers[i], NULL);
+
+  __atomic_store_n(&pool->stop, 0, __ATOMIC_RELAXED);
+  pool->started = 0;
+  __atomic_store_n(&pool->threads, threads, __ATOMIC_RELEASE);
+  pool->first_generation = pool->generation;
+  pool->spin = (long)threads <= sysconf(_SC_NPROCESSORS_ONLN) ? CNN_THREADS_SPIN : 0;
+  for (i = 0; i + 1 < threads; i++) {
+    if (pthread_create(&pool->workers[i], NULL, cnn_thread_pool_worker, pool) != 0)
+      break;
+    pool->started++;
+  }
+}
+
+static inline unsigned int cnn_thread_pool_default(void) {
+  const char *env = getenv("CNN_NUM_THREADS");
+  long n = env != NULL ? atol(env) : sysconf(_SC_NPROCESSORS_ONLN);
+  return n < 1 ? 1 : n > CNN_THREADS_MAX ? CNN_THREADS_MAX : (unsigned int)n;
+}
+
+static inline void cnn_thread_pool_set(unsigned int threads) {
+  cnn_thread_pool_t *pool = &cnn_thread_pool;
+  if (threads < 1)
+    threads = 1;
+  if (threads > CNN_THREADS_MAX)
+    threads = CNN_THREADS_MAX;
+  cnn_thread_pool_acquire(pool);
+  if (threads != pool->threads)
+    cnn_thread_pool_resize(pool, threads);
+  cnn_thread_pool_release(pool);
+}
+
+// Threads a layer may use, workers are started on the first call
+static inline unsigned int cnn_thread_pool_size(void) {
+  unsigned int threads = __atomic_load_n(&cnn_thread_pool.threads, __ATOMIC_ACQUIRE);
+  if (threads == 0) {
+    cnn_thread_pool_set(cnn_thread_pool_default());
+    threads = __atomic_load_n(&cnn_thread_pool.threads, __ATOMIC_ACQUIRE);
+  }
+  return threads;
+}
+
+// Calls fn(arg, task) for task = 0 .. ntasks - 1 on the workers and the calling thread, returns
+// once all of them are done. The order of the calls is unspecified.
+static void cnn_thread_pool_run(cnn_task_fn_t fn, void *arg, unsigned int ntasks) {
+  cnn_thread_pool_t *pool = &cnn_thread_pool;
+  unsigned int i;
+
+  // Another thread of the process is running a layer on the pool: do not wait for it
+  if (ntasks <= 1 || __atomic_exchange_n(&pool->busy, 1, __ATOMIC_ACQUIRE)) {
+    for (i = 0; i < ntasks; i++)
+      fn(arg, i);
+    return;
+  }
+  if (pool->started == 0) {
+    cnn_thread_pool_release(pool);
+    for (i = 0; i < ntasks; i++)
+      fn(arg, i);
+    return;
+  }
+
+  pthread_mutex_lock(&pool->lock);
+  pool->fn = fn;
+  pool->arg = arg;
+  pool->ntasks = ntasks;
+  __atomic_store_n(&pool->next_task, 0, __ATOMIC_RELAXED);
+  __atomic_store_n(&pool->active, pool->started, __ATOMIC_RELAXED);
+  __atomic_store_n(&pool->generation, pool->generation + 1, __ATOMIC_RELEASE);
+  pthread_cond_broadcast(&pool->wake);
+  pthread_mutex_unlock(&pool->lock);
+
+  cnn_thread_pool_tasks(pool, fn, arg, ntasks);
+
+  for (i = 0; i < pool->spin && __atomic_load_n(&pool->active, __ATOMIC_ACQUIRE) != 0; i++)
+    cnn_cpu_relax();
+  pthread_mutex_lock(&pool->lock);
+  while (__atomic_load_n(&pool->active, __ATOMIC_ACQUIRE) != 0)
+    pthread_cond_wait(&pool->done, &pool->lock);
+  pthread_mutex_unlock(&pool->lock);
+
+  cnn_thread_pool_release(pool);
+}
+
+#endif//CNN_THREADS
+
+#endif//__THREAD_POOL_H__
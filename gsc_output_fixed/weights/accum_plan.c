@@ -0,0 +1,16 @@
+/**
+  ******************************************************************************
+  * @file    weights/accum_plan.c
+  * @version 1.0.0
+  * @date    17 october 2026
+  * @brief   Worst-case accumulator widths of the conv1d and dense layers, generated by
+  *          tools/accum_plan.py from the weights and the Q7.9 bounds of the model input
+  */
+
+// { narrow_taps, acc_bits, winograd_bits }
+const accum_plan_t conv1d_116_accum_plan = { 0, 26, 0 };
+const accum_plan_t conv1d_117_accum_plan = { 0, 28, 28 };
+const accum_plan_t conv1d_118_accum_plan = { 0, 29, 29 };
+const accum_plan_t conv1d_119_accum_plan = { 0, 29, 30 };
+const accum_plan_t dense_58_accum_plan = { 0, 29, 0 };
+const accum_plan_t dense_59_accum_plan = { 0, 29, 0 };
@@ -0,0 +1,565 @@
+/**
+  ******************************************************************************
+  * @file    weights/conv1d_117_winograd.c
+  * @version 1.0.0
+  * @date    17 october 2026
+  * @brief   Even/odd phase (F(2,2) + direct) transformed kernel of conv1d_117, generated by tools/winograd_weights.py
+  */
+
+#define CONV1D_117_WINOGRAD
+
+#define INPUT_CHANNELS    16
+#define CONV_FILTERS      32
+#define WINOGRAD_TAPS     4
+
+
+const int16_t conv1d_117_winograd_kernel[CONV_FILTERS][INPUT_CHANNELS][WINOGRAD_TAPS] = {{{-59, 7, -66, 50}
+, {85, 35, 50, -98}
+, {-48, -17, -31, 10}
+, {-26, 27, -53, -24}
+, {51, -9, 60, -102}
+, {99, 110, -11, 79}
+, {-97, -23, -74, -60}
+, {23, -43, 66, 91}
+, {98, 47, 51, 14}
+, {-22, -3, -19, 33}
+, {135, 38, 97, 63}
+, {90, 54, 36, 29}
+, {34, 89, -55, -40}
+, {55, -12, 67, 13}
+, {-88, -45, -43, 64}
+, {-127, -89, -38, -45}
+}
+, {{-17, -23, 6, 62}
+, {59, 74, -15, -12}
+, {-111, -49, -62, -51}
+, {90, 90, 0, -79}
+, {46, 91, -45, -68}
+, {203, 82, 121, -47}
+, {-88, -27, -61, -55}
+, {68, 79, -11, -69}
+, {-124, -36, -88, 108}
+, {53, 22, 31, -93}
+, {-23, 76, -99, -65}
+, {49, 19, 30, 65}
+, {142, 56, 86, -78}
+, {-90, -77, -13, -40}
+, {0, -23, 23, 8}
+, {-20, -82, 62, -59}
+}
+, {{151, 70, 81, 17}
+, {81, 69, 12, -62}
+, {-130, -22, -108, -27}
+, {49, 49, 0, 77}
+, {107, 65, 42, -24}
+, {99, 16, 83, 4}
+, {1, 0, 1, -99}
+, {-132, -52, -80, 43}
+, {-11, 60, -71, 71}
+, {60, 70, -10, -75}
+, {28, 61, -33, -100}
+, {29, 0, 29, 35}
+, {126, 85, 41, -72}
+, {-218, -115, -103, 104}
+, {-29, -99, 70, 73}
+, {-78, 11, -89, 50}
+}
+, {{-80, 14, -94, -60}
+, {45, 11, 34, -98}
+, {99, 105, -6, -6}
+, {73, 49, 24, -43}
+, {-157, -74, -83, -79}
+, {55, 29, 26, 102}
+, {-7, -49, 42, 58}
+, {-74, -63, -11, 35}
+, {-2, 83, -85, 27}
+, {-28, -51, 23, -92}
+, {-109, -67, -42, -36}
+, {-139, -69, -70, 49}
+, {-27, -60, 33, 35}
+, {-22, -88, 66, -22}
+, {20, 38, -18, 68}
+, {-57, 0, -57, 89}
+}
+, {{-45, 19, -64, -29}
+, {-96, -94, -2, 65}
+, {-107, -15, -92, -63}
+, {28, -29, 57, 63}
+, {-45, -57, 12, 60}
+, {19, -84, 103, -47}
+, {-121, -65, -56, 24}
+, {209, 111, 98, -4}
+, {-24, 14, -38, -38}
+, {32, 28, 4, 46}
+, {48, -29, 77, 71}
+, {-8, 43, -51, 15}
+, {47, -47, 94, 88}
+, {-118, -57, -61, 18}
+, {83, 70, 13, -38}
+, {-112, -66, -46, -35}
+}
+, {{-158, -59, -99, 41}
+, {-139, -62, -77, 37}
+, {-17, 73, -90, -56}
+, {-77, -33, -44, 96}
+, {31, -76, 107, -5}
+, {84, 103, -19, 50}
+, {-75, -17, -58, 49}
+, {-89, -8, -81, -95}
+, {-108, -30, -78, 83}
+, {26, -17, 43, 67}
+, {82, 10, 72, -25}
+, {23, 63, -40, -74}
+, {1, -21, 22, 59}
+, {78, 106, -28, 34}
+, {144, 101, 43, -83}
+, {12, 49, -37, 95}
+}
+, {{-63, -90, 27, -71}
+, {-90, -86, -4, -9}
+, {52, 78, -26, 29}
+, {39, -24, 63, 20}
+, {-45, -56, 11, -79}
+, {71, 79, -8, 3}
+, {114, 7, 107, 65}
+, {89, 36, 53, -82}
+, {95, 16, 79, 37}
+, {159, 108, 51, 31}
+, {11, -8, 19, -76}
+, {106, 62, 44, 77}
+, {-46, -20, -26, -88}
+, {61, -45, 106, 9}
+, {-70, -77, 7, -34}
+, {-9, -36, 27, -72}
+}
+, {{190, 81, 109, -30}
+, {-17, 67, -84, 125}
+, {76, -19, 95, -85}
+, {34, 117, -83, 91}
+, {-91, -14, -77, -7}
+, {-127, -112, -15, 47}
+, {113, 34, 79, -29}
+, {12, 2, 10, 5}
+, {129, 107, 22, -81}
+, {7, 8, -1, -98}
+, {17, -77, 94, -53}
+, {-106, -120, 14, -4}
+, {-73, 21, -94, 8}
+, {70, 65, 5, 103}
+, {98, 101, -3, 31}
+, {-4, 22, -26, 91}
+}
+, {{-187, -72, -115, 11}
+, {113, 53, 60, -72}
+, {-84, -22, -62, 79}
+, {-19, -78, 59, 79}
+, {-8, 90, -98, -39}
+, {-83, -7, -76, 29}
+, {-18, 61, -79, -22}
+, {-74, -15, -59, 92}
+, {-67, 14, -81, 72}
+, {-83, -83, 0, -30}
+, {-78, -103, 25, 70}
+, {-148, -85, -63, -100}
+, {121, 89, 32, 68}
+, {-121, -75, -46, -90}
+, {-58, -124, 66, -22}
+, {-55, -38, -17, -20}
+}
+, {{-36, 18, -54, 0}
+, {12, -19, 31, -34}
+, {-3, 27, -30, 45}
+, {-29, 56, -85, 81}
+, {-160, -111, -49, 76}
+, {-29, 2, -31, -81}
+, {-36, -31, -5, 0}
+, {16, 14, 2, 63}
+, {67, 10, 57, -13}
+, {178, 78, 100, 71}
+, {-90, -87, -3, -55}
+, {-93, -52, -41, 52}
+, {-58, -6, -52, 0}
+, {35, -54, 89, 63}
+, {-6, -36, 30, 94}
+, {2, 50, -48, -10}
+}
+, {{25, 59, -34, -17}
+, {12, 17, -5, 55}
+, {-63, -31, -32, 52}
+, {-39, -67, 28, 86}
+, {59, 41, 18, 9}
+, {49, 1, 48, -44}
+, {-108, -22, -86, -49}
+, {168, 95, 73, 0}
+, {0, 12, -12, 13}
+, {101, 28, 73, -58}
+, {-56, 34, -90, -86}
+, {72, 106, -34, 27}
+, {8, -61, 69, 93}
+, {68, -36, 104, -19}
+, {-78, -15, -63, -68}
+, {122, 105, 17, 32}
+}
+, {{24, -21, 45, -70}
+, {157, 60, 97, -19}
+, {-9, 5, -14, -76}
+, {41, -8, 49, 1}
+, {-29, 57, -86, 106}
+, {61, 70, -9, -12}
+, {-6, 75, -81, 12}
+, {11, 80, -69, -17}
+, {41, -40, 81, 103}
+, {111, 81, 30, -73}
+, {6, -34, 40, -15}
+, {-98, -82, -16, 26}
+, {-71, -92, 21, -34}
+, {-6, 56, -62, -98}
+, {24, -66, 90, 76}
+, {-10, -91, 81, 15}
+}
+, {{2, 53, -51, -73}
+, {173, 73, 100, -15}
+, {-111, -23, -88, 71}
+, {-170, -70, -100, 3}
+, {129, 33, 96, -19}
+, {156, 103, 53, -103}
+, {-99, -17, -82, 71}
+, {67, -30, 97, -3}
+, {7, 49, -42, 55}
+, {-115, -67, -48, 96}
+, {-116, -61, -55, 65}
+, {-20, 53, -73, 47}
+, {-60, -36, -24, -36}
+, {127, 56, 71, 16}
+, {-17, -53, 36, -84}
+, {128, 42, 86, -58}
+}
+, {{-194, -95, -99, -36}
+, {132, 109, 23, -100}
+, {-70, -28, -42, 56}
+, {63, 55, 8, 60}
+, {139, 62, 77, -60}
+, {80, 92, -12, -101}
+, {1, -54, 55, -34}
+, {32, 86, -54, -30}
+, {-86, -103, 17, -62}
+, {38, -77, 115, 19}
+, {84, 109, -25, 25}
+, {63, 93, -30, 86}
+, {-123, -38, -85, -72}
+, {163, 97, 66, -51}
+, {101, 30, 71, 54}
+, {136, 23, 113, -27}
+}
+, {{167, 92, 75, 11}
+, {-11, 76, -87, -41}
+, {36, -58, 94, -44}
+, {24, 102, -78, -14}
+, {29, 33, -4, -11}
+, {27, -27, 54, -89}
+, {4, 13, -9, 24}
+, {11, -52, 63, -98}
+, {84, 25, 59, -23}
+, {-64, -49, -15, 84}
+, {32, -48, 80, -3}
+, {-58, -34, -24, -68}
+, {54, 53, 1, -57}
+, {10, 94, -84, -70}
+, {100, 40, 60, 23}
+, {-54, 32, -86, 58}
+}
+, {{38, 75, -37, 47}
+, {52, -28, 80, 34}
+, {-11, 29, -40, -39}
+, {39, 4, 35, 77}
+, {-16, 78, -94, -36}
+, {-24, -82, 58, 29}
+, {-55, 36, -91, -40}
+, {-134, -61, -73, 1}
+, {85, 79, 6, -17}
+, {-143, -43, -100, -90}
+, {74, 83, -9, 47}
+, {-36, 17, -53, -5}
+, {-10, -32, 22, -22}
+, {-19, -86, 67, 21}
+, {23, -76, 99, 69}
+, {34, -39, 73, 90}
+}
+, {{83, 13, 70, -47}
+, {15, 53, -38, -14}
+, {-7, -69, 62, 87}
+, {-61, 31, -92, 54}
+, {47, -48, 95, 52}
+, {-55, -26, -29, -13}
+, {1, -59, 60, 40}
+, {-81, -104, 23, 95}
+, {107, 97, 10, 15}
+, {-194, -114, -80, 103}
+, {-18, -26, 8, -89}
+, {-41, -75, 34, -101}
+, {-101, -35, -66, -18}
+, {121, 35, 86, 35}
+, {-9, 0, -9, 39}
+, {63, 15, 48, -40}
+}
+, {{-16, -71, 55, 38}
+, {-140, -86, -54, 61}
+, {108, 104, 4, -82}
+, {15, 98, -83, 10}
+, {-152, -82, -70, -63}
+, {-2, 61, -63, 71}
+, {-1, 84, -85, -95}
+, {116, 54, 62, 30}
+, {74, 68, 6, 23}
+, {-6, 48, -54, 21}
+, {41, 9, 32, -88}
+, {-20, -70, 50, 110}
+, {205, 94, 111, 71}
+, {88, 19, 69, -49}
+, {-132, -83, -49, -72}
+, {-67, -34, -33, -30}
+}
+, {{115, 69, 46, 38}
+, {77, 51, 26, -17}
+, {76, 45, 31, 60}
+, {72, -32, 104, 75}
+, {-78, -33, -45, -22}
+, {-102, -24, -78, -57}
+, {6, 7, -1, -57}
+, {-109, -77, -32, 88}
+, {5, -68, 73, -34}
+, {10, 80, -70, 5}
+, {-48, -39, -9, -75}
+, {-78, -70, -8, -77}
+, {59, 69, -10, 83}
+, {191, 83, 108, -40}
+, {-90, 1, -91, 6}
+, {87, 64, 23, -85}
+}
+, {{44, -49, 93, -8}
+, {-159, -92, -67, 75}
+, {-170, -85, -85, 91}
+, {46, -50, 96, -53}
+, {-62, -53, -9, 12}
+, {13, -78, 91, 97}
+, {-65, -13, -52, 2}
+, {-49, -58, 9, -58}
+, {-174, -57, -117, 32}
+, {30, 6, 24, -95}
+, {56, -12, 68, -7}
+, {144, 73, 71, -24}
+, {-162, -88, -74, -70}
+, {-68, -53, -15, -13}
+, {-16, -7, -9, 69}
+, {91, 55, 36, 3}
+}
+, {{-33, -34, 1, 61}
+, {-9, 86, -95, 85}
+, {5, 41, -36, 40}
+, {-77, -38, -39, -49}
+, {-33, 10, -43, 71}
+, {52, -18, 70, 94}
+, {-10, 65, -75, 63}
+, {-182, -75, -107, 36}
+, {-75, 14, -89, 84}
+, {11, 93, -82, -31}
+, {125, 23, 102, -94}
+, {-57, -43, -14, 58}
+, {-6, -78, 72, -105}
+, {155, 57, 98, -74}
+, {153, 91, 62, 40}
+, {-73, -5, -68, 20}
+}
+, {{192, 81, 111, -102}
+, {26, -38, 64, 77}
+, {96, 23, 73, -84}
+, {65, -33, 98, -75}
+, {-198, -106, -92, -24}
+, {-93, -34, -59, 106}
+, {-113, -83, -30, 0}
+, {-4, -65, 61, -31}
+, {49, -62, 111, -33}
+, {-13, -58, 45, -50}
+, {66, -1, 67, -80}
+, {-56, -54, -2, 123}
+, {88, 16, 72, -7}
+, {185, 77, 108, -61}
+, {60, 3, 57, 54}
+, {88, 54, 34, 91}
+}
+, {{18, 72, -54, 34}
+, {1, -25, 26, 44}
+, {42, -36, 78, 46}
+, {28, 79, -51, -7}
+, {16, -84, 100, -36}
+, {26, -16, 42, -34}
+, {-55, -70, 15, -71}
+, {-70, -79, 9, 68}
+, {127, 67, 60, 41}
+, {1, -67, 68, 35}
+, {-107, -40, -67, 72}
+, {-11, 70, -81, 110}
+, {73, 32, 41, -84}
+, {-40, 34, -74, 45}
+, {-124, -85, -39, 28}
+, {-112, -60, -52, 1}
+}
+, {{67, -3, 70, -51}
+, {10, 81, -71, -74}
+, {-117, -45, -72, -97}
+, {100, 14, 86, -31}
+, {-23, 44, -67, -74}
+, {114, 18, 96, 96}
+, {62, 91, -29, -45}
+, {201, 95, 106, 42}
+, {132, 43, 89, -52}
+, {-50, 27, -77, -3}
+, {21, 46, -25, -112}
+, {-78, -34, -44, -48}
+, {-122, -34, -88, 71}
+, {105, 98, 7, 73}
+, {-39, 53, -92, -5}
+, {-63, -12, -51, -28}
+}
+, {{-140, -54, -86, 62}
+, {6, -24, 30, 16}
+, {53, 33, 20, -78}
+, {-25, -73, 48, -85}
+, {45, 11, 34, 32}
+, {157, 62, 95, 37}
+, {-198, -104, -94, -36}
+, {168, 80, 88, 3}
+, {-63, 18, -81, 38}
+, {29, -69, 98, -63}
+, {21, 1, 20, -60}
+, {-94, -17, -77, -39}
+, {6, -100, 106, -21}
+, {-157, -69, -88, 66}
+, {-70, -17, -53, 88}
+, {-32, -66, 34, -67}
+}
+, {{-20, -54, 34, -86}
+, {-117, -58, -59, -77}
+, {49, -2, 51, -96}
+, {16, 89, -73, 98}
+, {46, 30, 16, 21}
+, {9, 25, -16, -92}
+, {83, -16, 99, -105}
+, {161, 49, 112, 96}
+, {79, 11, 68, -32}
+, {123, 60, 63, 5}
+, {55, 8, 47, 5}
+, {41, 44, -3, -60}
+, {-167, -74, -93, -80}
+, {-42, 2, -44, -87}
+, {-1, 51, -52, 35}
+, {-53, -71, 18, 73}
+}
+, {{-164, -81, -83, 104}
+, {-104, -62, -42, -75}
+, {105, -20, 125, -39}
+, {-10, -70, 60, -85}
+, {109, 77, 32, 78}
+, {-77, -23, -54, 92}
+, {19, 94, -75, -63}
+, {30, 0, 30, -19}
+, {88, 79, 9, 34}
+, {-46, -82, 36, 42}
+, {-92, -24, -68, 122}
+, {117, 88, 29, 35}
+, {-84, -68, -16, -21}
+, {-1, 48, -49, 12}
+, {-47, -2, -45, 65}
+, {-134, -98, -36, -39}
+}
+, {{-112, -79, -33, 41}
+, {-10, -21, 11, -104}
+, {44, -22, 66, 43}
+, {-13, -2, -11, -34}
+, {-82, -53, -29, -7}
+, {11, -67, 78, 75}
+, {-19, -17, -2, -21}
+, {88, 103, -15, 88}
+, {-50, -69, 19, -93}
+, {35, 103, -68, 61}
+, {13, 100, -87, 69}
+, {-28, -80, 52, -70}
+, {-45, -75, 30, 10}
+, {9, 104, -95, 100}
+, {-55, -49, -6, 58}
+, {-155, -74, -81, 33}
+}
+, {{10, 65, -55, -64}
+, {112, 39, 73, -100}
+, {46, 60, -14, 68}
+, {-127, -77, -50, -49}
+, {-97, -106, 9, 42}
+, {83, 67, 16, 34}
+, {-7, -5, -2, -67}
+, {91, 23, 68, -100}
+, {18, -66, 84, 50}
+, {43, 23, 20, -4}
+, {62, 49, 13, 75}
+, {-92, -109, 17, -85}
+, {-100, 10, -110, -51}
+, {116, 70, 46, -24}
+, {78, 68, 10, 91}
+, {86, 90, -4, 105}
+}
+, {{65, -13, 78, -90}
+, {136, 99, 37, -93}
+, {-128, -44, -84, 42}
+, {48, 16, 32, -56}
+, {113, 87, 26, -83}
+, {16, 59, -43, 39}
+, {137, 81, 56, -20}
+, {-84, 2, -86, -35}
+, {26, -32, 58, 90}
+, {111, 67, 44, 49}
+, {-61, -70, 9, -26}
+, {-6, -74, 68, 20}
+, {-43, 27, -70, 37}
+, {98, 40, 58, -46}
+, {207, 85, 122, -15}
+, {193, 73, 120, 12}
+}
+, {{-61, -39, -22, 95}
+, {48, 22, 26, 14}
+, {140, 42, 98, 41}
+, {175, 85, 90, 94}
+, {67, 47, 20, -95}
+, {190, 113, 77, 53}
+, {-38, 10, -48, -56}
+, {-20, 28, -48, -26}
+, {103, 77, 26, 2}
+, {15, -62, 77, 59}
+, {111, 71, 40, -92}
+, {48, -58, 106, 94}
+, {16, -33, 49, -90}
+, {-76, -103, 27, 6}
+, {13, 52, -39, -33}
+, {-71, -82, 11, -90}
+}
+, {{12, 27, -15, 31}
+, {-119, -72, -47, -2}
+, {63, 98, -35, -24}
+, {90, 6, 84, -59}
+, {-69, -46, -23, -64}
+, {107, 35, 72, -13}
+, {-74, -1, -73, -82}
+, {-54, -43, -11, 90}
+, {38, 89, -51, 20}
+, {188, 93, 95, -12}
+, {-50, 11, -61, -9}
+, {-53, -26, -27, -50}
+, {-119, -37, -82, -90}
+, {-132, -53, -79, 42}
+, {-3, 83, -86, -29}
+, {13, 105, -92, 45}
+}
+}
+;
+
+#undef INPUT_CHANNELS
+#undef CONV_FILTERS
+#undef WINOGRAD_TAPS
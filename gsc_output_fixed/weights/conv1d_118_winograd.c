@@ -0,0 +1,2133 @@
+/**
+  ******************************************************************************
+  * @file    weights/conv1d_118_winograd.c
+  * @version 1.0.0
+  * @date    17 october 2026
+  * @brief   Even/odd phase (F(2,2) + direct) transformed kernel of conv1d_118, generated by tools/winograd_weights.py
+  */
+
+#define CONV1D_118_WINOGRAD
+
+#define INPUT_CHANNELS    32
+#define CONV_FILTERS      64
+#define WINOGRAD_TAPS     4
+
+
+const int16_t conv1d_118_winograd_kernel[CONV_FILTERS][INPUT_CHANNELS][WINOGRAD_TAPS] = {{{-22, 19, -41, -55}
+, {141, 64, 77, 68}
+, {-69, -62, -7, -1}
+, {16, 20, -4, 41}
+, {-11, -51, 40, 86}
+, {-5, 49, -54, 35}
+, {-134, -82, -52, 59}
+, {-70, -66, -4, 47}
+, {85, 37, 48, -67}
+, {11, 12, -1, -41}
+, {33, 68, -35, 1}
+, {-43, -71, 28, 31}
+, {89, 40, 49, -37}
+, {-8, -60, 52, 57}
+, {31, -15, 46, 44}
+, {78, 60, 18, 63}
+, {-14, 60, -74, -32}
+, {10, -48, 58, 75}
+, {-60, -57, -3, -21}
+, {100, 59, 41, -9}
+, {-88, -23, -65, -4}
+, {-14, 36, -50, 47}
+, {1, 26, -25, -44}
+, {47, -25, 72, -65}
+, {-15, -74, 59, 70}
+, {-112, -48, -64, 11}
+, {24, 33, -9, -63}
+, {91, 52, 39, -63}
+, {-19, 22, -41, -19}
+, {-24, 28, -52, -38}
+, {104, 57, 47, 9}
+, {133, 62, 71, -62}
+}
+, {{79, 36, 43, 19}
+, {131, 72, 59, 42}
+, {67, 8, 59, -19}
+, {-72, -40, -32, -61}
+, {22, 8, 14, -12}
+, {-134, -73, -61, -43}
+, {-13, 46, -59, -32}
+, {37, 18, 19, -21}
+, {84, 20, 64, 13}
+, {41, -21, 62, -45}
+, {81, 65, 16, 11}
+, {115, 70, 45, 9}
+, {27, 52, -25, -18}
+, {-10, 54, -64, 31}
+, {5, 36, -31, 28}
+, {72, 3, 69, 67}
+, {-134, -69, -65, 54}
+, {-96, -19, -77, 68}
+, {-26, -46, 20, -18}
+, {26, 7, 19, -14}
+, {-24, 11, -35, -22}
+, {-5, -39, 34, -8}
+, {54, -4, 58, 4}
+, {18, 61, -43, -55}
+, {111, 65, 46, 4}
+, {41, 74, -33, 75}
+, {112, 59, 53, -46}
+, {-42, -40, -2, -73}
+, {-101, -30, -71, -23}
+, {118, 58, 60, 12}
+, {52, 40, 12, 69}
+, {26, 62, -36, -75}
+}
+, {{107, 41, 66, 52}
+, {37, -4, 41, -8}
+, {-47, -21, -26, 77}
+, {-29, 62, -91, 39}
+, {-38, 14, -52, -23}
+, {-25, 3, -28, 53}
+, {31, -22, 53, -6}
+, {-11, 32, -43, 30}
+, {91, 21, 70, -2}
+, {0, 9, -9, -50}
+, {6, -32, 38, -39}
+, {-46, -53, 7, -1}
+, {101, 57, 44, -24}
+, {-44, -48, 4, 44}
+, {-18, -36, 18, 12}
+, {-12, 24, -36, -62}
+, {-83, -31, -52, 6}
+, {-4, 52, -56, 12}
+, {-20, -50, 30, -49}
+, {25, 25, 0, -47}
+, {-66, -40, -26, -1}
+, {40, 20, 20, -39}
+, {50, 10, 40, -38}
+, {-35, 27, -62, -4}
+, {95, 43, 52, 7}
+, {-13, -46, 33, -45}
+, {88, 72, 16, 33}
+, {24, 72, -48, 61}
+, {13, 64, -51, -4}
+, {41, -24, 65, -72}
+, {-2, 1, -3, -23}
+, {-76, -24, -52, -20}
+}
+, {{-7, -1, -6, 66}
+, {58, 27, 31, 23}
+, {-4, 64, -68, -32}
+, {-101, -39, -62, 50}
+, {26, -13, 39, -23}
+, {22, 10, 12, 41}
+, {74, 29, 45, 58}
+, {-75, -77, 2, -74}
+, {10, 8, 2, -60}
+, {3, 16, -13, -31}
+, {76, 47, 29, 62}
+, {67, 71, -4, -17}
+, {52, 46, 6, -55}
+, {-14, 32, -46, 22}
+, {-23, 7, -30, 43}
+, {-26, -73, 47, -69}
+, {67, 15, 52, 33}
+, {-40, -40, 0, -20}
+, {-6, -67, 61, -75}
+, {1, 40, -39, -30}
+, {58, 67, -9, 46}
+, {-105, -80, -25, -45}
+, {-20, 27, -47, 40}
+, {-78, -36, -42, -49}
+, {4, -33, 37, 40}
+, {14, -57, 71, -56}
+, {-45, 23, -68, 28}
+, {-47, -47, 0, 7}
+, {93, 37, 56, -64}
+, {86, 24, 62, -34}
+, {-44, -19, -25, 68}
+, {-57, -2, -55, -58}
+}
+, {{-10, 2, -12, 44}
+, {-36, -59, 23, -19}
+, {-28, 16, -44, 57}
+, {-122, -74, -48, -56}
+, {90, 57, 33, 43}
+, {29, 63, -34, -31}
+, {-17, -23, 6, 21}
+, {52, 43, 9, 8}
+, {69, 37, 32, -51}
+, {35, 30, 5, 5}
+, {49, 53, -4, 50}
+, {40, 13, 27, 0}
+, {40, 13, 27, 46}
+, {-11, 39, -50, -9}
+, {-43, 0, -43, 45}
+, {1, -40, 41, -77}
+, {-67, -8, -59, 0}
+, {-121, -42, -79, -45}
+, {-27, -45, 18, 22}
+, {47, 63, -16, -74}
+, {48, 64, -16, -5}
+, {-23, -59, 36, 52}
+, {-132, -69, -63, -59}
+, {-4, 54, -58, -70}
+, {-44, 32, -76, 8}
+, {-108, -69, -39, -55}
+, {55, 58, -3, -12}
+, {-27, -30, 3, -2}
+, {-3, -17, 14, -37}
+, {120, 80, 40, 75}
+, {83, 19, 64, -66}
+, {-44, -36, -8, -39}
+}
+, {{-86, -61, -25, 61}
+, {-55, 7, -62, -40}
+, {-66, -36, -30, -19}
+, {-1, -25, 24, 13}
+, {-18, -65, 47, -35}
+, {12, -45, 57, 19}
+, {-9, 25, -34, 7}
+, {-138, -67, -71, -24}
+, {-32, -63, 31, 70}
+, {136, 58, 78, 11}
+, {5, -51, 56, -61}
+, {33, 33, 0, 29}
+, {40, 74, -34, 0}
+, {44, -4, 48, 14}
+, {60, 8, 52, -57}
+, {1, -13, 14, 53}
+, {-69, -51, -18, 28}
+, {-52, -22, -30, -62}
+, {-17, -21, 4, -15}
+, {36, -40, 76, 76}
+, {16, -1, 17, 66}
+, {-35, -21, -14, 60}
+, {46, -16, 62, -46}
+, {2, 39, -37, 34}
+, {60, 79, -19, 24}
+, {-9, -31, 22, 30}
+, {42, 15, 27, 64}
+, {1, -46, 47, 62}
+, {131, 74, 57, -51}
+, {-71, -69, -2, -4}
+, {80, 11, 69, 4}
+, {15, 1, 14, -39}
+}
+, {{-98, -34, -64, -68}
+, {68, 38, 30, 29}
+, {144, 70, 74, 68}
+, {6, 29, -23, 49}
+, {-73, -44, -29, 49}
+, {-107, -36, -71, 45}
+, {-23, 48, -71, -25}
+, {10, -23, 33, -56}
+, {-55, 18, -73, -52}
+, {24, 28, -4, -15}
+, {37, 64, -27, -9}
+, {118, 61, 57, 66}
+, {-24, -65, 41, 19}
+, {22, -39, 61, -4}
+, {-112, -73, -39, 28}
+, {54, -9, 63, -34}
+, {119, 62, 57, -23}
+, {36, 22, 14, -47}
+, {-54, -15, -39, 11}
+, {50, 24, 26, -19}
+, {-80, -51, -29, -47}
+, {-133, -68, -65, 33}
+, {-98, -36, -62, 19}
+, {67, 50, 17, -3}
+, {0, -69, 69, -43}
+, {-105, -47, -58, 15}
+, {123, 64, 59, 64}
+, {-84, -64, -20, 15}
+, {50, 50, 0, -23}
+, {70, 71, -1, -39}
+, {-45, 2, -47, 21}
+, {16, 44, -28, -1}
+}
+, {{-32, 22, -54, -48}
+, {22, -25, 47, 49}
+, {102, 49, 53, -30}
+, {43, -7, 50, 28}
+, {-81, -20, -61, 5}
+, {-37, 23, -60, -12}
+, {-61, 2, -63, 27}
+, {129, 75, 54, 15}
+, {44, 45, -1, 20}
+, {-16, 20, -36, -11}
+, {41, 62, -21, 38}
+, {0, 69, -69, -51}
+, {-81, -48, -33, 10}
+, {17, 39, -22, 24}
+, {-24, -3, -21, -30}
+, {57, 34, 23, 33}
+, {25, 23, 2, 39}
+, {-2, 51, -53, -50}
+, {54, -28, 82, -79}
+, {36, 65, -29, -42}
+, {-51, -47, -4, -56}
+, {91, 51, 40, -33}
+, {-107, -45, -62, 67}
+, {16, 70, -54, -65}
+, {-126, -64, -62, -66}
+, {-21, 18, -39, -74}
+, {13, -29, 42, 8}
+, {74, 28, 46, -79}
+, {22, 21, 1, 26}
+, {109, 74, 35, -18}
+, {45, -24, 69, 20}
+, {-49, -13, -36, 0}
+}
+, {{-67, -4, -63, 8}
+, {-7, 63, -70, 81}
+, {110, 69, 41, -69}
+, {42, -43, 85, 57}
+, {-79, -38, -41, 15}
+, {-119, -50, -69, -53}
+, {-146, -75, -71, -42}
+, {-12, -43, 31, 38}
+, {100, 28, 72, -26}
+, {-32, 0, -32, -65}
+, {-3, 16, -19, 52}
+, {55, 43, 12, 15}
+, {-113, -57, -56, 60}
+, {-4, 4, -8, -29}
+, {97, 37, 60, 38}
+, {45, 66, -21, -41}
+, {-16, -36, 20, 9}
+, {9, 43, -34, 1}
+, {85, 12, 73, 31}
+, {18, -36, 54, -23}
+, {45, -8, 53, -17}
+, {-37, -64, 27, -9}
+, {-24, 5, -29, -8}
+, {-21, -24, 3, 47}
+, {-32, -33, 1, -70}
+, {-34, -72, 38, -71}
+, {31, -9, 40, 2}
+, {30, 65, -35, 55}
+, {-19, -53, 34, -73}
+, {78, 57, 21, 41}
+, {-34, -23, -11, 13}
+, {52, 40, 12, -22}
+}
+, {{51, 67, -16, -6}
+, {-93, -81, -12, -69}
+, {-77, -27, -50, 44}
+, {-60, -53, -7, -27}
+, {75, 25, 50, -28}
+, {6, -61, 67, -47}
+, {102, 58, 44, 50}
+, {55, 56, -1, 34}
+, {-21, -47, 26, -9}
+, {-99, -42, -57, 81}
+, {-26, -3, -23, -12}
+, {-21, -12, -9, -61}
+, {26, -49, 75, -8}
+, {21, 70, -49, -8}
+, {-106, -47, -59, -62}
+, {-73, -41, -32, -44}
+, {-85, -43, -42, -4}
+, {33, 17, 16, -27}
+, {-55, 15, -70, -7}
+, {-86, -84, -2, 80}
+, {-40, -30, -10, -70}
+, {-36, -8, -28, 30}
+, {38, 18, 20, 13}
+, {120, 75, 45, 14}
+, {17, -11, 28, -38}
+, {39, 59, -20, 52}
+, {-32, -7, -25, -54}
+, {13, 35, -22, -13}
+, {3, -40, 43, 26}
+, {-29, -26, -3, 51}
+, {-2, 37, -39, 27}
+, {-43, 15, -58, -60}
+}
+, {{-9, -4, -5, -21}
+, {62, -10, 72, 79}
+, {37, 69, -32, -59}
+, {-23, 6, -29, -20}
+, {22, 27, -5, 83}
+, {-38, 27, -65, -48}
+, {-83, -30, -53, -1}
+, {-36, 13, -49, -77}
+, {-22, -53, 31, -88}
+, {43, 26, 17, -47}
+, {-37, -34, -3, 33}
+, {-122, -69, -53, -36}
+, {61, 31, 30, -24}
+, {-20, 15, -35, 15}
+, {-41, -81, 40, -59}
+, {-37, 38, -75, 56}
+, {-90, -26, -64, -69}
+, {42, 31, 11, 37}
+, {13, 56, -43, 51}
+, {102, 39, 63, 54}
+, {97, 36, 61, 31}
+, {-18, 49, -67, -71}
+, {9, -15, 24, 6}
+, {110, 42, 68, 19}
+, {-48, -33, -15, -32}
+, {121, 39, 82, -27}
+, {72, 87, -15, 16}
+, {-111, -63, -48, 83}
+, {45, 41, 4, 39}
+, {-42, 24, -66, -22}
+, {79, 4, 75, 26}
+, {-84, -55, -29, 56}
+}
+, {{-66, -28, -38, 3}
+, {-59, -67, 8, 0}
+, {92, 57, 35, -24}
+, {-5, 4, -9, -39}
+, {84, 5, 79, -29}
+, {-80, -71, -9, 40}
+, {66, 43, 23, -44}
+, {-50, -14, -36, 16}
+, {-10, -45, 35, 13}
+, {-8, 25, -33, 0}
+, {127, 75, 52, -2}
+, {-28, -69, 41, -28}
+, {12, 68, -56, 18}
+, {-10, -61, 51, -51}
+, {-30, -58, 28, 1}
+, {-5, 62, -67, -5}
+, {84, 48, 36, 42}
+, {146, 75, 71, 29}
+, {-73, -47, -26, -61}
+, {-14, -60, 46, -50}
+, {-27, 21, -48, -49}
+, {-25, -31, 6, -12}
+, {21, -23, 44, -61}
+, {40, 20, 20, 24}
+, {30, 42, -12, -66}
+, {38, 6, 32, 30}
+, {55, -16, 71, 34}
+, {67, 39, 28, 16}
+, {-38, -46, 8, 21}
+, {88, 74, 14, -17}
+, {3, -36, 39, -50}
+, {-34, -27, -7, -52}
+}
+, {{-58, -54, -4, 35}
+, {-30, -64, 34, -2}
+, {58, 66, -8, 7}
+, {-69, -53, -16, 0}
+, {41, 36, 5, -52}
+, {-115, -60, -55, 4}
+, {27, 13, 14, 66}
+, {-16, 1, -17, 52}
+, {19, -31, 50, 13}
+, {-40, -50, 10, -53}
+, {5, 25, -20, -19}
+, {-65, -28, -37, 7}
+, {-16, -69, 53, -56}
+, {-115, -61, -54, -36}
+, {-109, -43, -66, 31}
+, {-39, -63, 24, -10}
+, {75, 43, 32, 39}
+, {17, 59, -42, -35}
+, {-140, -66, -74, -2}
+, {-31, -70, 39, -64}
+, {-63, -63, 0, -32}
+, {97, 44, 53, -27}
+, {-73, -15, -58, 26}
+, {-49, 11, -60, -38}
+, {128, 70, 58, -44}
+, {44, 55, -11, 0}
+, {-107, -41, -66, -28}
+, {-21, -48, 27, -6}
+, {-45, 2, -47, -17}
+, {-49, -50, 1, -43}
+, {-59, -38, -21, -52}
+, {-47, -72, 25, 66}
+}
+, {{40, 9, 31, 44}
+, {8, 36, -28, 29}
+, {9, -52, 61, -57}
+, {-84, -51, -33, 21}
+, {62, 59, 3, -13}
+, {-96, -59, -37, -62}
+, {67, 53, 14, 42}
+, {24, -45, 69, -28}
+, {11, 33, -22, 45}
+, {21, 34, -13, -26}
+, {6, -13, 19, 33}
+, {-64, -24, -40, 51}
+, {-76, -34, -42, 36}
+, {9, 64, -55, -44}
+, {-1, 23, -24, 38}
+, {-8, -40, 32, -31}
+, {121, 44, 77, 37}
+, {34, -6, 40, -13}
+, {99, 58, 41, 38}
+, {-131, -59, -72, -42}
+, {-46, 8, -54, -29}
+, {5, -10, 15, -47}
+, {38, 24, 14, 23}
+, {32, 32, 0, 1}
+, {-15, 20, -35, -67}
+, {-62, -59, -3, 5}
+, {2, 47, -45, -25}
+, {-104, -67, -37, -55}
+, {32, 14, 18, 22}
+, {94, 55, 39, -61}
+, {-84, -26, -58, -48}
+, {-25, 36, -61, -46}
+}
+, {{-129, -55, -74, -53}
+, {-111, -35, -76, 49}
+, {-60, -26, -34, -63}
+, {-17, 59, -76, 45}
+, {76, 65, 11, 37}
+, {24, -21, 45, -50}
+, {130, 63, 67, -31}
+, {89, 32, 57, -75}
+, {25, 62, -37, 24}
+, {-25, -22, -3, -66}
+, {66, 0, 66, 74}
+, {10, -54, 64, 38}
+, {-103, -26, -77, -34}
+, {51, -5, 56, -48}
+, {87, 13, 74, 6}
+, {0, -2, 2, 52}
+, {78, 62, 16, 29}
+, {-95, -75, -20, -23}
+, {126, 47, 79, 45}
+, {95, 32, 63, 13}
+, {-9, -57, 48, -59}
+, {-13, -67, 54, -5}
+, {43, 79, -36, -32}
+, {35, 64, -29, -5}
+, {33, -9, 42, -61}
+, {30, 68, -38, 56}
+, {40, 22, 18, 57}
+, {-56, -25, -31, 7}
+, {-8, -8, 0, -72}
+, {-27, -27, 0, -26}
+, {16, 19, -3, -37}
+, {-55, 10, -65, 0}
+}
+, {{12, 4, 8, -38}
+, {32, -18, 50, -9}
+, {99, 74, 25, -19}
+, {19, -53, 72, -8}
+, {-31, 29, -60, 5}
+, {-1, -12, 11, -73}
+, {46, 52, -6, -9}
+, {-15, 21, -36, -22}
+, {118, 70, 48, -6}
+, {27, 71, -44, -29}
+, {-121, -49, -72, 35}
+, {91, 64, 27, 26}
+, {-76, -28, -48, 23}
+, {66, 65, 1, 13}
+, {11, -3, 14, 52}
+, {-55, -7, -48, -15}
+, {-28, -54, 26, -56}
+, {-63, -70, 7, 48}
+, {51, 49, 2, 29}
+, {47, -7, 54, 30}
+, {56, 39, 17, -42}
+, {0, -66, 66, 32}
+, {35, 4, 31, 52}
+, {28, -27, 55, 34}
+, {82, 16, 66, 28}
+, {56, 50, 6, -31}
+, {-12, -62, 50, -24}
+, {-79, -62, -17, 36}
+, {15, -6, 21, 48}
+, {-25, -32, 7, 66}
+, {-77, -4, -73, 8}
+, {-106, -82, -24, 1}
+}
+, {{-37, 18, -55, 37}
+, {-8, 45, -53, 33}
+, {-43, -39, -4, 15}
+, {27, 4, 23, -35}
+, {-120, -36, -84, -40}
+, {40, -21, 61, -48}
+, {77, 3, 74, 64}
+, {52, 40, 12, -80}
+, {-78, -48, -30, 66}
+, {-88, -22, -66, 58}
+, {-24, -51, 27, 47}
+, {-3, -55, 52, -5}
+, {-47, -46, -1, 67}
+, {39, 37, 2, 59}
+, {-10, 28, -38, -15}
+, {0, 48, -48, 52}
+, {-77, -42, -35, -38}
+, {-7, 48, -55, -23}
+, {66, -7, 73, 16}
+, {25, -15, 40, 45}
+, {2, 45, -43, -5}
+, {76, 23, 53, -80}
+, {-20, -52, 32, -60}
+, {-16, -41, 25, -17}
+, {-17, 49, -66, -43}
+, {27, 39, -12, 17}
+, {-23, -50, 27, 71}
+, {19, 72, -53, 13}
+, {24, 24, 0, -53}
+, {71, 16, 55, 43}
+, {-13, 15, -28, -65}
+, {41, 34, 7, -52}
+}
+, {{-52, -27, -25, -1}
+, {-37, -25, -12, 69}
+, {-79, -15, -64, 74}
+, {71, 63, 8, -44}
+, {39, 1, 38, -28}
+, {34, 16, 18, -44}
+, {11, 47, -36, -24}
+, {25, 85, -60, 73}
+, {-6, -33, 27, 44}
+, {10, 74, -64, -29}
+, {4, -42, 46, -50}
+, {-58, -5, -53, -13}
+, {-27, -23, -4, 89}
+, {26, 62, -36, -19}
+, {19, 85, -66, -37}
+, {42, -21, 63, 4}
+, {-43, -70, 27, 25}
+, {-37, 8, -45, 76}
+, {-7, -5, -2, 18}
+, {-13, 13, -26, -86}
+, {-61, -5, -56, 17}
+, {-81, -19, -62, -43}
+, {37, 10, 27, 74}
+, {5, -11, 16, -3}
+, {79, 47, 32, 22}
+, {-34, 15, -49, 48}
+, {-7, -6, -1, -23}
+, {5, -10, 15, 38}
+, {-16, 44, -60, 1}
+, {60, -12, 72, -37}
+, {-35, -22, -13, -16}
+, {-63, 3, -66, 0}
+}
+, {{9, -32, 41, 37}
+, {-64, -16, -48, -59}
+, {-30, 36, -66, -13}
+, {-10, 18, -28, -78}
+, {52, 0, 52, -10}
+, {-33, 1, -34, 33}
+, {-6, 32, -38, 44}
+, {16, 45, -29, -38}
+, {-65, -64, -1, 37}
+, {65, 67, -2, 13}
+, {134, 60, 74, 54}
+, {-23, -58, 35, -70}
+, {1, 22, -21, 21}
+, {11, 9, 2, -42}
+, {102, 47, 55, 52}
+, {61, 13, 48, 12}
+, {-28, -18, -10, -3}
+, {67, -6, 73, -23}
+, {-30, 26, -56, 9}
+, {-80, -34, -46, 36}
+, {-100, -38, -62, -4}
+, {44, -1, 45, 70}
+, {69, 60, 9, 59}
+, {46, 54, -8, -10}
+, {-82, -35, -47, -47}
+, {-79, -67, -12, 62}
+, {-56, -61, 5, -42}
+, {36, -20, 56, 67}
+, {121, 66, 55, -50}
+, {29, -12, 41, -2}
+, {-71, -11, -60, -10}
+, {-24, 12, -36, 17}
+}
+, {{-29, -15, -14, 38}
+, {-40, -22, -18, 21}
+, {-80, -48, -32, 3}
+, {97, 24, 73, -26}
+, {32, 54, -22, 70}
+, {-5, -18, 13, 29}
+, {-41, -17, -24, 78}
+, {-41, 10, -51, 20}
+, {-73, -21, -52, 56}
+, {-31, 13, -44, -33}
+, {15, -68, 83, 42}
+, {-4, 27, -31, 25}
+, {54, 43, 11, -28}
+, {14, -40, 54, 66}
+, {-10, 14, -24, -28}
+, {-22, 24, -46, 29}
+, {-59, 3, -62, 35}
+, {63, 80, -17, -57}
+, {4, 59, -55, 42}
+, {51, 50, 1, 12}
+, {-114, -66, -48, -20}
+, {43, 26, 17, -33}
+, {-34, -28, -6, 23}
+, {31, 68, -37, 15}
+, {123, 52, 71, 49}
+, {4, -29, 33, -48}
+, {30, 54, -24, -49}
+, {68, 26, 42, -46}
+, {74, 23, 51, 16}
+, {90, 42, 48, -21}
+, {-68, -55, -13, -2}
+, {0, -21, 21, -39}
+}
+, {{-11, -19, 8, 18}
+, {14, 47, -33, -39}
+, {26, 22, 4, -35}
+, {98, 69, 29, 24}
+, {-66, -43, -23, -56}
+, {-101, -26, -75, 36}
+, {61, 20, 41, 1}
+, {89, 81, 8, 60}
+, {-44, -36, -8, -40}
+, {112, 47, 65, -37}
+, {-82, -56, -26, 1}
+, {-45, -57, 12, 34}
+, {-88, -60, -28, 44}
+, {-116, -63, -53, 34}
+, {70, 60, 10, 44}
+, {-72, -36, -36, 43}
+, {-3, 45, -48, -35}
+, {87, 29, 58, 66}
+, {61, 31, 30, 34}
+, {-5, 0, -5, 46}
+, {9, -33, 42, -50}
+, {-57, -17, -40, 51}
+, {38, 40, -2, 0}
+, {7, -11, 18, 22}
+, {-69, -29, -40, -7}
+, {79, 32, 47, -57}
+, {103, 45, 58, 53}
+, {-51, -20, -31, 10}
+, {16, -52, 68, 61}
+, {-117, -64, -53, 3}
+, {84, 39, 45, 34}
+, {40, -18, 58, 49}
+}
+, {{-93, -56, -37, -36}
+, {-10, -65, 55, 45}
+, {-1, -62, 61, -8}
+, {-23, -43, 20, -40}
+, {89, 50, 39, -55}
+, {16, -23, 39, 49}
+, {-52, 10, -62, -64}
+, {0, 28, -28, -63}
+, {-109, -15, -94, -21}
+, {31, 23, 8, -31}
+, {6, -22, 28, -13}
+, {19, -38, 57, 18}
+, {53, 67, -14, 16}
+, {-88, -52, -36, 19}
+, {-93, -38, -55, 1}
+, {25, 71, -46, 42}
+, {7, 3, 4, 20}
+, {-21, 16, -37, -66}
+, {-138, -63, -75, -49}
+, {45, 51, -6, 37}
+, {59, 18, 41, 64}
+, {-62, -12, -50, -39}
+, {-76, -51, -25, -23}
+, {-101, -26, -75, 26}
+, {-39, -26, -13, 42}
+, {62, 51, 11, -27}
+, {119, 50, 69, 68}
+, {-38, 2, -40, 55}
+, {90, 36, 54, -30}
+, {-56, -68, 12, -55}
+, {1, 74, -73, 66}
+, {-35, -60, 25, 30}
+}
+, {{-1, 65, -66, 68}
+, {23, -15, 38, 41}
+, {-29, 6, -35, 58}
+, {-84, -30, -54, 10}
+, {4, -22, 26, -43}
+, {-89, -65, -24, 61}
+, {76, 27, 49, -68}
+, {92, 28, 64, 57}
+, {64, 12, 52, -19}
+, {-119, -40, -79, -79}
+, {65, 27, 38, 69}
+, {12, -31, 43, -80}
+, {-8, 54, -62, 12}
+, {-2, 40, -42, 57}
+, {-48, -70, 22, -56}
+, {-26, 9, -35, -43}
+, {-20, 54, -74, 0}
+, {-54, -54, 0, -32}
+, {-79, -36, -43, 62}
+, {3, 56, -53, 29}
+, {47, 22, 25, -33}
+, {53, -6, 59, 53}
+, {89, 29, 60, 32}
+, {4, 30, -26, -37}
+, {65, 66, -1, -74}
+, {-26, 6, -32, -71}
+, {-131, -66, -65, -62}
+, {35, -5, 40, -65}
+, {125, 56, 69, 67}
+, {104, 53, 51, -20}
+, {10, 44, -34, 46}
+, {11, 34, -23, 25}
+}
+, {{-1, -46, 45, 69}
+, {-32, 27, -59, -50}
+, {-71, -45, -26, -46}
+, {-40, -26, -14, 5}
+, {112, 74, 38, 82}
+, {-26, -10, -16, 35}
+, {12, 61, -49, -50}
+, {-53, 2, -55, -42}
+, {41, -12, 53, 28}
+, {-13, 10, -23, 78}
+, {19, 54, -35, 8}
+, {1, 1, 0, -28}
+, {-19, 31, -50, 4}
+, {10, 44, -34, 19}
+, {-25, -22, -3, -6}
+, {-71, -69, -2, -75}
+, {-52, -17, -35, -50}
+, {67, 46, 21, 56}
+, {51, 1, 50, -6}
+, {3, -14, 17, -72}
+, {-14, -55, 41, 36}
+, {-54, 0, -54, -15}
+, {-38, -47, 9, 26}
+, {5, -12, 17, 0}
+, {-51, 6, -57, 64}
+, {-10, -36, 26, 34}
+, {54, 55, -1, -62}
+, {139, 62, 77, 35}
+, {-85, -64, -21, -21}
+, {-78, -64, -14, 35}
+, {96, 28, 68, -32}
+, {38, -8, 46, -4}
+}
+, {{54, 71, -17, -23}
+, {31, -12, 43, 78}
+, {-87, -25, -62, -24}
+, {-83, -36, -47, 10}
+, {32, -36, 68, 35}
+, {7, 40, -33, 26}
+, {-5, 7, -12, -45}
+, {-50, -43, -7, -13}
+, {43, 43, 0, 0}
+, {-7, -34, 27, -61}
+, {70, 42, 28, -27}
+, {20, -40, 60, -53}
+, {11, 60, -49, -44}
+, {115, 34, 81, -4}
+, {-130, -75, -55, -19}
+, {-3, -40, 37, 3}
+, {-78, -68, -10, -72}
+, {42, 18, 24, 63}
+, {40, -6, 46, -18}
+, {-13, 28, -41, 5}
+, {101, 46, 55, -63}
+, {-19, -8, -11, -16}
+, {-157, -68, -89, 26}
+, {-9, 12, -21, 57}
+, {15, -8, 23, -2}
+, {1, -2, 3, 41}
+, {3, 59, -56, 30}
+, {63, 24, 39, 52}
+, {24, 23, 1, 2}
+, {23, 11, 12, 11}
+, {86, 11, 75, -50}
+, {87, 45, 42, -70}
+}
+, {{-1, -1, 0, -1}
+, {64, 4, 60, 75}
+, {136, 74, 62, 28}
+, {-54, 5, -59, -7}
+, {40, 47, -7, -10}
+, {-34, -17, -17, -4}
+, {-100, -55, -45, 0}
+, {35, -32, 67, -87}
+, {-125, -64, -61, 66}
+, {0, 43, -43, 2}
+, {4, -42, 46, -34}
+, {69, -4, 73, -59}
+, {32, 50, -18, 87}
+, {-22, -1, -21, 53}
+, {-90, -26, -64, -65}
+, {56, 55, 1, -16}
+, {78, 29, 49, -14}
+, {-89, -53, -36, -47}
+, {-34, -56, 22, -30}
+, {131, 38, 93, 7}
+, {-60, -56, -4, -35}
+, {74, 11, 63, -23}
+, {40, 86, -46, -12}
+, {44, 19, 25, 18}
+, {39, -33, 72, 60}
+, {-63, 3, -66, -24}
+, {57, -3, 60, 52}
+, {30, 29, 1, 10}
+, {-52, -28, -24, 65}
+, {-64, -78, 14, 49}
+, {103, 67, 36, -49}
+, {-122, -51, -71, -18}
+}
+, {{1, 62, -61, 60}
+, {19, -7, 26, 37}
+, {-39, -54, 15, -46}
+, {-86, -46, -40, 70}
+, {-28, 22, -50, 4}
+, {1, 7, -6, -43}
+, {112, 54, 58, 68}
+, {34, 60, -26, 66}
+, {98, 54, 44, 24}
+, {51, 15, 36, -58}
+, {17, 8, 9, -60}
+, {50, 16, 34, 54}
+, {-41, -40, -1, 54}
+, {-27, -33, 6, -4}
+, {-64, -23, -41, -26}
+, {-98, -66, -32, -67}
+, {-50, -23, -27, 3}
+, {26, 78, -52, -3}
+, {58, 27, 31, -16}
+, {97, 80, 17, 33}
+, {10, 37, -27, 16}
+, {-1, -14, 13, 46}
+, {102, 12, 90, 57}
+, {24, 83, -59, -34}
+, {1, 50, -49, 4}
+, {81, 47, 34, -49}
+, {148, 81, 67, -40}
+, {-21, -35, 14, 3}
+, {-66, -54, -12, -78}
+, {-112, -46, -66, 3}
+, {0, 60, -60, 58}
+, {-15, -1, -14, -70}
+}
+, {{-55, -24, -31, -66}
+, {58, 69, -11, 73}
+, {-78, -2, -76, 40}
+, {28, -22, 50, -23}
+, {6, -26, 32, -3}
+, {35, 37, -2, -25}
+, {100, 29, 71, 22}
+, {5, -42, 47, -44}
+, {-166, -79, -87, -24}
+, {-28, 31, -59, 4}
+, {21, -37, 58, 18}
+, {21, -32, 53, 40}
+, {39, 13, 26, -34}
+, {14, 10, 4, 19}
+, {-32, 39, -71, -44}
+, {49, -15, 64, 40}
+, {-25, -24, -1, -7}
+, {65, 44, 21, 56}
+, {-87, -60, -27, -65}
+, {36, 19, 17, -12}
+, {26, -49, 75, -44}
+, {60, 1, 59, 43}
+, {82, 36, 46, -38}
+, {12, -10, 22, 42}
+, {-60, -61, 1, -53}
+, {104, 47, 57, 63}
+, {82, 4, 78, 18}
+, {-31, -1, -30, 22}
+, {58, 51, 7, -37}
+, {-39, 32, -71, -11}
+, {132, 62, 70, -4}
+, {60, 32, 28, 21}
+}
+, {{20, 53, -33, -47}
+, {11, -7, 18, -42}
+, {79, 56, 23, 17}
+, {-57, 3, -60, 11}
+, {-110, -61, -49, 0}
+, {-84, -45, -39, -23}
+, {-53, -12, -41, 42}
+, {-36, -45, 9, -84}
+, {-9, -45, 36, 2}
+, {-31, 0, -31, -46}
+, {-113, -47, -66, -57}
+, {99, 53, 46, -21}
+, {57, 52, 5, -29}
+, {-147, -82, -65, -3}
+, {44, 32, 12, -14}
+, {-21, -6, -15, -42}
+, {-6, 45, -51, 23}
+, {68, 63, 5, -16}
+, {23, 6, 17, -40}
+, {-53, -58, 5, 41}
+, {-95, -48, -47, -33}
+, {10, -31, 41, 31}
+, {123, 80, 43, 8}
+, {79, 31, 48, 56}
+, {-57, -11, -46, 10}
+, {18, -11, 29, -24}
+, {155, 80, 75, 15}
+, {7, 70, -63, -40}
+, {33, 0, 33, 12}
+, {93, 31, 62, 3}
+, {61, 6, 55, -5}
+, {33, -25, 58, -37}
+}
+, {{-37, -4, -33, 2}
+, {18, 66, -48, 6}
+, {-1, -27, 26, -3}
+, {72, 65, 7, -25}
+, {67, 50, 17, 29}
+, {83, 55, 28, -59}
+, {-24, -43, 19, 47}
+, {73, 1, 72, -50}
+, {106, 72, 34, 76}
+, {-13, -4, -9, 45}
+, {-15, -51, 36, -55}
+, {15, -42, 57, 63}
+, {77, 60, 17, 50}
+, {-133, -65, -68, -26}
+, {-19, -51, 32, 54}
+, {-97, -36, -61, -49}
+, {-93, -58, -35, 36}
+, {48, 73, -25, -62}
+, {-55, -73, 18, -24}
+, {-56, 8, -64, 45}
+, {-18, -47, 29, 57}
+, {-123, -80, -43, -27}
+, {-56, 7, -63, 44}
+, {66, 16, 50, 39}
+, {54, 36, 18, 11}
+, {27, 72, -45, 56}
+, {-36, -72, 36, 71}
+, {-98, -23, -75, -38}
+, {-40, -16, -24, -35}
+, {-11, 47, -58, 62}
+, {49, 39, 10, 26}
+, {-1, -54, 53, 38}
+}
+, {{-14, -22, 8, 31}
+, {-9, -4, -5, -9}
+, {-62, -53, -9, 21}
+, {-54, -38, -16, 80}
+, {-62, -2, -60, -34}
+, {28, 10, 18, 9}
+, {-17, -58, 41, -12}
+, {-46, -25, -21, -22}
+, {-42, 0, -42, -9}
+, {52, 21, 31, 6}
+, {117, 59, 58, 2}
+, {93, 69, 24, 35}
+, {-48, -1, -47, 41}
+, {-63, -58, -5, -25}
+, {-23, -50, 27, 15}
+, {-43, -38, -5, -62}
+, {31, -47, 78, 37}
+, {-45, 12, -57, -43}
+, {142, 73, 69, 38}
+, {-74, -67, -7, -13}
+, {-113, -36, -77, -33}
+, {-38, 5, -43, 6}
+, {31, 54, -23, -37}
+, {41, 3, 38, -63}
+, {-59, 0, -59, -24}
+, {72, 43, 29, -57}
+, {-2, 30, -32, -80}
+, {-70, -80, 10, 60}
+, {11, -35, 46, 50}
+, {54, 76, -22, -36}
+, {7, 59, -52, 50}
+, {-65, 12, -77, -43}
+}
+, {{-44, -7, -37, -49}
+, {-20, 34, -54, -14}
+, {74, 53, 21, -4}
+, {75, 87, -12, -48}
+, {-18, 14, -32, 56}
+, {39, 15, 24, 45}
+, {1, -31, 32, -61}
+, {-35, -55, 20, -36}
+, {85, 65, 20, 53}
+, {-44, -44, 0, -43}
+, {-103, -66, -37, 24}
+, {-28, 38, -66, 56}
+, {-26, -62, 36, 32}
+, {-60, -23, -37, 75}
+, {-100, -45, -55, 26}
+, {16, -33, 49, 0}
+, {-36, -41, 5, 53}
+, {95, 83, 12, -22}
+, {98, 37, 61, 8}
+, {-70, -26, -44, -60}
+, {-78, -32, -46, 65}
+, {42, 38, 4, 34}
+, {52, 73, -21, 48}
+, {-30, -28, -2, -56}
+, {-65, -55, -10, 14}
+, {-74, -24, -50, 6}
+, {26, -40, 66, -42}
+, {94, 86, 8, 57}
+, {52, 30, 22, -4}
+, {77, 11, 66, -60}
+, {-92, -22, -70, -8}
+, {-54, -3, -51, -22}
+}
+, {{32, -7, 39, -48}
+, {30, 20, 10, 39}
+, {-45, -44, -1, -23}
+, {43, -11, 54, 4}
+, {-16, -47, 31, -3}
+, {36, -43, 79, -36}
+, {101, 56, 45, -50}
+, {17, 35, -18, -32}
+, {-46, 37, -83, 26}
+, {87, 4, 83, 19}
+, {-29, -68, 39, 32}
+, {24, 61, -37, -21}
+, {-106, -34, -72, 44}
+, {-105, -47, -58, -46}
+, {95, 70, 25, 47}
+, {133, 75, 58, 64}
+, {17, -26, 43, 66}
+, {-43, -15, -28, 0}
+, {-120, -74, -46, 55}
+, {-63, -8, -55, 57}
+, {58, 48, 10, -31}
+, {110, 35, 75, 24}
+, {102, 17, 85, -42}
+, {16, 54, -38, -41}
+, {-16, -68, 52, -60}
+, {85, 74, 11, -26}
+, {68, 60, 8, 0}
+, {50, -35, 85, 29}
+, {50, -28, 78, -8}
+, {34, 31, 3, 47}
+, {-95, -24, -71, -62}
+, {-8, 58, -66, -37}
+}
+, {{-9, -15, 6, 55}
+, {16, -29, 45, -4}
+, {49, 5, 44, 21}
+, {61, 66, -5, 0}
+, {-29, -68, 39, -63}
+, {65, 3, 62, -57}
+, {-25, -30, 5, -35}
+, {-23, -66, 43, -16}
+, {-8, -51, 43, -32}
+, {-10, 1, -11, -52}
+, {-105, -63, -42, 52}
+, {92, 51, 41, 70}
+, {35, 31, 4, 60}
+, {-49, -16, -33, -70}
+, {-7, -61, 54, -21}
+, {-10, -10, 0, -58}
+, {-63, -60, -3, -10}
+, {-38, 4, -42, 5}
+, {-14, 60, -74, 62}
+, {-91, -59, -32, -32}
+, {9, -32, 41, 2}
+, {84, 78, 6, 15}
+, {47, -12, 59, 19}
+, {33, 79, -46, 40}
+, {-22, 24, -46, 43}
+, {100, 56, 44, -35}
+, {106, 65, 41, 35}
+, {-4, 60, -64, 4}
+, {-56, -63, 7, -72}
+, {29, 11, 18, -20}
+, {14, -48, 62, 58}
+, {-38, -36, -2, -35}
+}
+, {{23, 38, -15, 40}
+, {-100, -31, -69, -69}
+, {-58, -3, -55, -22}
+, {58, 61, -3, 60}
+, {124, 65, 59, 53}
+, {81, 38, 43, -62}
+, {-100, -50, -50, 53}
+, {22, -12, 34, 41}
+, {87, 50, 37, -37}
+, {69, 44, 25, -17}
+, {48, 37, 11, 18}
+, {-90, -67, -23, -60}
+, {-111, -54, -57, 75}
+, {117, 61, 56, 2}
+, {-56, -30, -26, -39}
+, {-79, -23, -56, -33}
+, {-39, -31, -8, -30}
+, {45, 70, -25, 88}
+, {73, 62, 11, 19}
+, {91, 49, 42, 13}
+, {8, -31, 39, -1}
+, {-37, -28, -9, 42}
+, {-74, -25, -49, -39}
+, {-78, -66, -12, 63}
+, {109, 54, 55, 10}
+, {81, 5, 76, 59}
+, {-65, -1, -64, -3}
+, {14, 4, 10, -43}
+, {-64, -58, -6, 26}
+, {-19, 0, -19, -66}
+, {-1, 7, -8, -16}
+, {57, -6, 63, 15}
+}
+, {{6, -16, 22, -68}
+, {41, -8, 49, 60}
+, {89, 31, 58, -32}
+, {22, -46, 68, -59}
+, {73, 6, 67, 11}
+, {6, -9, 15, -69}
+, {-5, 10, -15, -39}
+, {108, 39, 69, 16}
+, {159, 72, 87, 9}
+, {-35, -61, 26, 52}
+, {-44, -33, -11, -6}
+, {7, 78, -71, -23}
+, {4, -21, 25, 31}
+, {-21, -47, 26, -66}
+, {-5, 12, -17, 21}
+, {31, -23, 54, 73}
+, {-48, -25, -23, 52}
+, {-19, -38, 19, -60}
+, {35, 51, -16, -18}
+, {70, 52, 18, 23}
+, {-82, -61, -21, -36}
+, {36, 49, -13, 20}
+, {-35, -35, 0, 70}
+, {53, 44, 9, -24}
+, {-2, -77, 75, -59}
+, {7, 54, -47, 64}
+, {-82, -13, -69, -73}
+, {28, 63, -35, -56}
+, {-45, -21, -24, 38}
+, {21, 50, -29, -20}
+, {-48, -48, 0, -7}
+, {91, 58, 33, -17}
+}
+, {{-102, -45, -57, -9}
+, {-21, 26, -47, 41}
+, {76, 14, 62, 79}
+, {34, -27, 61, -17}
+, {20, -45, 65, 72}
+, {-35, 26, -61, 58}
+, {-67, -2, -65, 53}
+, {107, 47, 60, 28}
+, {-10, 4, -14, -6}
+, {-50, -17, -33, 75}
+, {-30, -60, 30, 58}
+, {18, -17, 35, 30}
+, {95, 30, 65, 21}
+, {47, 51, -4, 15}
+, {56, 36, 20, -61}
+, {-34, -82, 48, -25}
+, {71, 1, 70, 72}
+, {-74, -9, -65, -55}
+, {20, -43, 63, 45}
+, {10, 25, -15, -50}
+, {-28, -65, 37, -46}
+, {-45, 14, -59, 34}
+, {-73, -42, -31, 49}
+, {40, -19, 59, -37}
+, {-27, -16, -11, -16}
+, {-21, 34, -55, -39}
+, {-104, -68, -36, -45}
+, {3, 64, -61, 15}
+, {-58, -7, -51, 24}
+, {22, -9, 31, -52}
+, {-22, 22, -44, -46}
+, {-46, -79, 33, 43}
+}
+, {{80, 56, 24, 29}
+, {-35, 26, -61, 55}
+, {-39, -14, -25, -38}
+, {31, -18, 49, 26}
+, {98, 47, 51, -62}
+, {37, -8, 45, -31}
+, {-98, -32, -66, 40}
+, {88, 39, 49, -64}
+, {-45, 6, -51, -36}
+, {95, 39, 56, 37}
+, {13, -20, 33, -15}
+, {59, -1, 60, 32}
+, {64, 10, 54, -53}
+, {-27, -52, 25, -2}
+, {80, 63, 17, 79}
+, {41, 70, -29, 60}
+, {16, 37, -21, -69}
+, {-146, -63, -83, 36}
+, {9, -55, 64, 69}
+, {35, -14, 49, 0}
+, {1, 55, -54, -65}
+, {19, -21, 40, 0}
+, {40, 50, -10, -35}
+, {-90, -70, -20, 46}
+, {116, 50, 66, 12}
+, {13, 68, -55, -63}
+, {35, 24, 11, -34}
+, {80, 18, 62, 50}
+, {-54, 8, -62, 73}
+, {-93, -24, -69, 10}
+, {53, 52, 1, -51}
+, {111, 68, 43, -34}
+}
+, {{76, 8, 68, -20}
+, {21, 26, -5, 31}
+, {-109, -46, -63, -15}
+, {28, -8, 36, -66}
+, {-11, 12, -23, 90}
+, {-29, 37, -66, 44}
+, {-85, -63, -22, 32}
+, {-36, -66, 30, -59}
+, {-9, -56, 47, -78}
+, {-3, -23, 20, 8}
+, {114, 48, 66, -50}
+, {-77, -65, -12, 29}
+, {2, 11, -9, 48}
+, {46, 46, 0, 68}
+, {31, -22, 53, -82}
+, {-15, 5, -20, -28}
+, {-32, -66, 34, -67}
+, {21, 16, 5, 68}
+, {-92, -66, -26, -41}
+, {-42, 20, -62, 63}
+, {-53, -11, -42, -32}
+, {7, 26, -19, -73}
+, {-101, -59, -42, 31}
+, {33, 11, 22, 53}
+, {18, 24, -6, -2}
+, {31, -2, 33, 77}
+, {-53, -43, -10, 30}
+, {61, 51, 10, 27}
+, {94, 34, 60, -33}
+, {-1, 18, -19, -48}
+, {44, 53, -9, -2}
+, {27, 48, -21, 62}
+}
+, {{-36, -45, 9, 37}
+, {-53, -72, 19, 46}
+, {38, -29, 67, 4}
+, {55, 52, 3, 38}
+, {24, -21, 45, 77}
+, {54, 40, 14, 12}
+, {-72, -38, -34, -34}
+, {-53, 11, -64, 37}
+, {-109, -63, -46, 35}
+, {59, 15, 44, 49}
+, {10, 70, -60, -28}
+, {25, -32, 57, -50}
+, {27, -8, 35, -67}
+, {-33, -69, 36, -64}
+, {33, 18, 15, 50}
+, {-21, -35, 14, -60}
+, {10, -53, 63, 79}
+, {-44, 21, -65, -46}
+, {101, 71, 30, 66}
+, {48, 18, 30, 43}
+, {33, -21, 54, 3}
+, {52, 71, -19, 10}
+, {-5, -78, 73, 39}
+, {29, -20, 49, -23}
+, {-29, -59, 30, 35}
+, {57, -4, 61, 0}
+, {50, 59, -9, 17}
+, {-103, -54, -49, -51}
+, {-16, -66, 50, 62}
+, {-24, -18, -6, -53}
+, {-70, -31, -39, -3}
+, {-33, 32, -65, 48}
+}
+, {{54, -2, 56, -38}
+, {-123, -49, -74, -40}
+, {14, -52, 66, -60}
+, {3, 49, -46, -1}
+, {-16, -12, -4, 64}
+, {-74, -43, -31, 32}
+, {-55, 7, -62, 44}
+, {32, -37, 69, 20}
+, {-118, -47, -71, 27}
+, {-33, -11, -22, 9}
+, {-81, 0, -81, -70}
+, {5, -42, 47, 17}
+, {-108, -61, -47, -23}
+, {36, 24, 12, 35}
+, {-66, -56, -10, 49}
+, {-37, -5, -32, -16}
+, {-17, -52, 35, 38}
+, {86, 69, 17, -13}
+, {70, 64, 6, -35}
+, {-7, -35, 28, -11}
+, {-3, -68, 65, 37}
+, {-17, 10, -27, 14}
+, {-84, -25, -59, -42}
+, {-11, 43, -54, 64}
+, {6, 0, 6, 13}
+, {-81, -35, -46, -7}
+, {-98, -61, -37, 46}
+, {11, 31, -20, -11}
+, {91, 34, 57, -14}
+, {1, 70, -69, 66}
+, {-13, 49, -62, 38}
+, {8, -44, 52, -1}
+}
+, {{48, -7, 55, 11}
+, {39, 30, 9, -21}
+, {19, 12, 7, 34}
+, {8, -62, 70, -54}
+, {20, 19, 1, -33}
+, {113, 71, 42, 24}
+, {-74, -62, -12, 74}
+, {34, -18, 52, 26}
+, {10, 18, -8, 45}
+, {-76, -46, -30, 30}
+, {-43, -47, 4, -55}
+, {40, -18, 58, 40}
+, {87, 69, 18, 60}
+, {-40, -28, -12, -68}
+, {-16, 46, -62, -49}
+, {-80, -51, -29, -19}
+, {81, 28, 53, 49}
+, {-61, 3, -64, -45}
+, {-58, -41, -17, 34}
+, {12, -13, 25, -40}
+, {137, 80, 57, -41}
+, {36, 53, -17, 50}
+, {-68, -28, -40, 62}
+, {-14, -14, 0, -44}
+, {17, 26, -9, -76}
+, {-97, -66, -31, -9}
+, {-49, -51, 2, 57}
+, {-56, -29, -27, -35}
+, {106, 53, 53, -35}
+, {24, -7, 31, 25}
+, {-126, -61, -65, -13}
+, {2, 40, -38, -19}
+}
+, {{-74, -33, -41, -18}
+, {-120, -49, -71, -65}
+, {72, 13, 59, 66}
+, {10, 30, -20, 1}
+, {7, -4, 11, -6}
+, {19, -26, 45, -45}
+, {-14, 13, -27, 9}
+, {84, 33, 51, 57}
+, {54, 45, 9, 46}
+, {16, -10, 26, 69}
+, {-85, -14, -71, -12}
+, {-79, -36, -43, 31}
+, {-54, -62, 8, 40}
+, {-3, 55, -58, 37}
+, {60, 79, -19, -13}
+, {86, 43, 43, 55}
+, {101, 72, 29, -27}
+, {2, -35, 37, -5}
+, {92, 22, 70, -49}
+, {-15, -35, 20, 28}
+, {-18, -65, 47, 60}
+, {72, 43, 29, 59}
+, {-24, -55, 31, -1}
+, {68, 23, 45, -24}
+, {-114, -35, -79, -72}
+, {-47, -11, -36, -38}
+, {-15, -23, 8, 3}
+, {-14, 38, -52, 21}
+, {-36, -56, 20, 76}
+, {41, 12, 29, 7}
+, {7, -9, 16, 67}
+, {143, 72, 71, -24}
+}
+, {{106, 58, 48, 43}
+, {40, 63, -23, 29}
+, {-54, -70, 16, 13}
+, {-42, -19, -23, -30}
+, {33, 26, 7, 0}
+, {-40, 36, -76, 44}
+, {-74, -38, -36, 62}
+, {-36, 1, -37, -43}
+, {-74, -9, -65, 23}
+, {-11, -50, 39, -17}
+, {-111, -68, -43, 67}
+, {77, 14, 63, 49}
+, {30, 30, 0, -56}
+, {54, 20, 34, 0}
+, {62, 46, 16, 12}
+, {-23, 44, -67, 68}
+, {-17, -45, 28, 32}
+, {106, 74, 32, -70}
+, {74, 44, 30, -51}
+, {-74, -41, -33, -79}
+, {49, 33, 16, 29}
+, {5, -19, 24, -60}
+, {18, 56, -38, -69}
+, {-11, 50, -61, -4}
+, {42, 51, -9, -61}
+, {24, 49, -25, -55}
+, {-42, -30, -12, 26}
+, {21, 68, -47, 30}
+, {-9, 56, -65, -66}
+, {-65, -73, 8, 49}
+, {40, 33, 7, -37}
+, {-27, -32, 5, 49}
+}
+, {{-12, 20, -32, -43}
+, {9, -47, 56, -49}
+, {-1, -71, 70, 72}
+, {-74, -9, -65, -18}
+, {47, 52, -5, -14}
+, {46, -18, 64, -7}
+, {77, 18, 59, -26}
+, {31, 75, -44, 50}
+, {-91, -30, -61, -43}
+, {140, 66, 74, 1}
+, {42, 10, 32, 60}
+, {27, 52, -25, -63}
+, {85, 0, 85, -15}
+, {-90, -33, -57, -25}
+, {133, 74, 59, 48}
+, {-50, -18, -32, -27}
+, {39, -4, 43, -36}
+, {10, 63, -53, -49}
+, {-69, -2, -67, 66}
+, {3, 25, -22, -78}
+, {-36, 17, -53, -46}
+, {57, 77, -20, -40}
+, {13, -61, 74, 47}
+, {28, -28, 56, -31}
+, {-54, -45, -9, -10}
+, {-11, 30, -41, 26}
+, {-41, -58, 17, 59}
+, {17, 5, 12, -9}
+, {-141, -73, -68, 61}
+, {-37, -45, 8, 26}
+, {-49, -60, 11, 11}
+, {46, 50, -4, 46}
+}
+, {{-27, -45, 18, 50}
+, {-56, -82, 26, -7}
+, {-62, -50, -12, 10}
+, {-16, -18, 2, -42}
+, {-55, -64, 9, -55}
+, {-50, 11, -61, 7}
+, {-40, -79, 39, 48}
+, {97, 42, 55, -21}
+, {43, 64, -21, 33}
+, {52, 43, 9, -46}
+, {19, -4, 23, -6}
+, {-1, 33, -34, 65}
+, {-35, -12, -23, 84}
+, {-104, -67, -37, 55}
+, {75, 20, 55, -39}
+, {87, 16, 71, -17}
+, {95, 75, 20, 8}
+, {76, 40, 36, -3}
+, {17, 50, -33, -52}
+, {-13, -68, 55, 34}
+, {42, -24, 66, 29}
+, {-65, -59, -6, 51}
+, {65, 52, 13, -7}
+, {-39, 23, -62, -36}
+, {83, 37, 46, 86}
+, {-101, -71, -30, -60}
+, {69, 37, 32, -42}
+, {21, 6, 15, 3}
+, {67, -7, 74, 5}
+, {-10, -51, 41, 39}
+, {-58, -71, 13, -40}
+, {107, 65, 42, 75}
+}
+, {{-6, 31, -37, 53}
+, {-19, -19, 0, -60}
+, {100, 36, 64, 45}
+, {-3, 0, -3, -11}
+, {-22, 48, -70, 22}
+, {101, 53, 48, 30}
+, {2, 0, 2, -41}
+, {-136, -71, -65, -39}
+, {-4, -59, 55, 14}
+, {-114, -51, -63, 65}
+, {87, 25, 62, -54}
+, {-74, -56, -18, -65}
+, {-25, -48, 23, 13}
+, {60, 38, 22, 47}
+, {-35, 41, -76, 38}
+, {6, -16, 22, -64}
+, {65, 3, 62, 65}
+, {8, 12, -4, 23}
+, {-36, -12, -24, -3}
+, {-61, -18, -43, -32}
+, {-16, -60, 44, -8}
+, {-45, -41, -4, 36}
+, {-8, -48, 40, -61}
+, {-115, -73, -42, 17}
+, {-53, -61, 8, -30}
+, {-26, -27, 1, 55}
+, {91, 37, 54, 10}
+, {-13, -9, -4, -38}
+, {81, 66, 15, -35}
+, {111, 62, 49, 4}
+, {-74, -7, -67, -18}
+, {-18, 33, -51, 23}
+}
+, {{91, 52, 39, 59}
+, {-12, -24, 12, 50}
+, {-7, -4, -3, 52}
+, {85, -16, 101, 26}
+, {5, -57, 62, -21}
+, {17, -12, 29, 23}
+, {88, 42, 46, 65}
+, {43, 63, -20, -45}
+, {27, 67, -40, 66}
+, {-24, 31, -55, 5}
+, {-50, 16, -66, 67}
+, {-52, -35, -17, 10}
+, {1, 36, -35, 15}
+, {-98, -29, -69, -20}
+, {-92, -56, -36, 4}
+, {-58, -8, -50, 37}
+, {84, 26, 58, -65}
+, {-62, -68, 6, -18}
+, {-99, -59, -40, 44}
+, {93, 25, 68, 29}
+, {1, 22, -21, -59}
+, {-12, -23, 11, -41}
+, {19, -27, 46, 53}
+, {-14, -56, 42, 38}
+, {3, 49, -46, 3}
+, {-16, -17, 1, -8}
+, {38, 38, 0, 18}
+, {-66, -45, -21, 80}
+, {-104, -26, -78, 31}
+, {21, 14, 7, 3}
+, {-81, -69, -12, 5}
+, {135, 70, 65, -59}
+}
+, {{8, -27, 35, -2}
+, {128, 62, 66, -68}
+, {17, -28, 45, 34}
+, {-59, -35, -24, 46}
+, {63, 3, 60, 5}
+, {4, -33, 37, -14}
+, {-94, -31, -63, -35}
+, {51, -8, 59, -38}
+, {-48, -41, -7, 23}
+, {23, 36, -13, -30}
+, {-57, -58, 1, 20}
+, {-46, -61, 15, -9}
+, {38, 18, 20, -26}
+, {-16, 41, -57, 20}
+, {-27, -33, 6, -12}
+, {-3, -62, 59, -60}
+, {-35, 26, -61, 39}
+, {69, 8, 61, -40}
+, {100, 52, 48, -42}
+, {33, -1, 34, 43}
+, {-10, 8, -18, 28}
+, {125, 72, 53, -56}
+, {15, -13, 28, 41}
+, {17, -40, 57, 23}
+, {-53, -74, 21, -18}
+, {23, 27, -4, -56}
+, {-105, -43, -62, -3}
+, {-74, -79, 5, 56}
+, {-13, -17, 4, -3}
+, {5, 39, -34, -11}
+, {-18, -4, -14, -43}
+, {67, 27, 40, -7}
+}
+, {{-20, 48, -68, -13}
+, {4, 37, -33, 66}
+, {11, -17, 28, 2}
+, {-96, -66, -30, -55}
+, {-123, -61, -62, 18}
+, {60, 76, -16, 69}
+, {47, 25, 22, -52}
+, {94, 57, 37, 52}
+, {64, 34, 30, 0}
+, {-70, -26, -44, -21}
+, {-45, 17, -62, -19}
+, {78, 35, 43, 43}
+, {36, -11, 47, -60}
+, {38, 6, 32, 12}
+, {-21, 6, -27, -41}
+, {78, 49, 29, -46}
+, {46, 20, 26, -52}
+, {-55, -65, 10, 7}
+, {20, -34, 54, -61}
+, {-78, -59, -19, 59}
+, {105, 37, 68, -46}
+, {3, 43, -40, 25}
+, {-48, 9, -57, 41}
+, {14, -27, 41, 34}
+, {-27, -52, 25, -26}
+, {80, 64, 16, -24}
+, {29, 37, -8, 12}
+, {-86, -26, -60, 43}
+, {-22, -61, 39, 66}
+, {-30, -49, 19, -70}
+, {-74, -42, -32, -65}
+, {106, 65, 41, -4}
+}
+, {{56, 6, 50, -43}
+, {-19, 15, -34, 0}
+, {-100, -31, -69, -28}
+, {16, -29, 45, 71}
+, {44, 53, -9, -65}
+, {72, 70, 2, 51}
+, {-100, -68, -32, -50}
+, {36, 65, -29, -59}
+, {73, 39, 34, 0}
+, {72, 49, 23, 17}
+, {83, 36, 47, 53}
+, {35, -20, 55, -8}
+, {135, 66, 69, -76}
+, {-58, 10, -68, -8}
+, {-7, -13, 6, 18}
+, {20, 68, -48, 1}
+, {14, -12, 26, -9}
+, {-115, -61, -54, 63}
+, {24, -44, 68, 1}
+, {72, 43, 29, 54}
+, {81, 60, 21, -48}
+, {-42, 3, -45, -66}
+, {34, 63, -29, 32}
+, {8, -5, 13, -11}
+, {-22, -46, 24, 25}
+, {-39, -15, -24, -78}
+, {-4, 47, -51, -68}
+, {-65, -53, -12, -79}
+, {79, 60, 19, 61}
+, {-19, -40, 21, -8}
+, {52, -11, 63, 0}
+, {36, 45, -9, 10}
+}
+, {{99, 61, 38, 14}
+, {-110, -38, -72, 40}
+, {-117, -41, -76, -53}
+, {-84, -40, -44, -26}
+, {83, 45, 38, -57}
+, {9, -42, 51, 31}
+, {38, -16, 54, -1}
+, {104, 36, 68, -21}
+, {-15, 71, -86, -39}
+, {-4, 67, -71, -29}
+, {-139, -69, -70, 72}
+, {43, -3, 46, -35}
+, {-23, 53, -76, 5}
+, {-100, -29, -71, -23}
+, {1, -47, 48, -27}
+, {-100, -38, -62, 18}
+, {117, 66, 51, -19}
+, {70, 30, 40, 41}
+, {-26, -52, 26, -58}
+, {98, 60, 38, 46}
+, {-48, -59, 11, -44}
+, {-1, 16, -17, 27}
+, {150, 93, 57, -86}
+, {-31, -28, -3, -36}
+, {27, 78, -51, 18}
+, {-15, -66, 51, -20}
+, {149, 84, 65, -56}
+, {82, 82, 0, -62}
+, {77, 46, 31, 37}
+, {-1, -29, 28, 17}
+, {-38, 7, -45, -5}
+, {97, 22, 75, -71}
+}
+, {{53, 48, 5, -72}
+, {43, 15, 28, -35}
+, {14, -36, 50, -9}
+, {103, 54, 49, -27}
+, {-25, -74, 49, -45}
+, {-106, -41, -65, 44}
+, {-17, -13, -4, -60}
+, {68, 0, 68, -51}
+, {-11, 31, -42, -66}
+, {-18, 12, -30, 68}
+, {-105, -74, -31, -33}
+, {-75, -36, -39, 43}
+, {-60, -44, -16, 60}
+, {-33, 26, -59, 59}
+, {1, 28, -27, -29}
+, {44, 29, 15, -77}
+, {67, 5, 62, -13}
+, {-15, -49, 34, 57}
+, {36, 23, 13, 7}
+, {99, 50, 49, -45}
+, {94, 30, 64, 1}
+, {-58, -54, -4, 30}
+, {-58, -62, 4, 68}
+, {136, 70, 66, 11}
+, {33, 24, 9, -10}
+, {15, -31, 46, -69}
+, {19, 39, -20, 12}
+, {-51, -60, 9, 2}
+, {28, -31, 59, -19}
+, {83, 12, 71, 33}
+, {49, -4, 53, 19}
+, {-26, -10, -16, -63}
+}
+, {{125, 74, 51, 79}
+, {59, 60, -1, -34}
+, {19, 64, -45, -19}
+, {-122, -72, -50, -74}
+, {46, 32, 14, 67}
+, {47, 75, -28, 6}
+, {-12, 14, -26, -17}
+, {61, 38, 23, -47}
+, {-73, -48, -25, 70}
+, {-90, -31, -59, -70}
+, {69, 51, 18, 28}
+, {-71, -57, -14, 53}
+, {82, 28, 54, -50}
+, {128, 48, 80, 89}
+, {-69, -70, 1, 42}
+, {15, -34, 49, -39}
+, {-135, -58, -77, 21}
+, {-32, 13, -45, 36}
+, {34, 59, -25, 28}
+, {-15, -51, 36, 30}
+, {-13, -62, 49, 30}
+, {-115, -83, -32, -58}
+, {-6, 48, -54, -34}
+, {-5, -70, 65, -28}
+, {47, -30, 77, -45}
+, {-104, -52, -52, 15}
+, {-116, -55, -61, -9}
+, {26, 25, 1, -68}
+, {-3, -31, 28, -13}
+, {-78, -34, -44, -6}
+, {63, -14, 77, 57}
+, {13, 39, -26, -8}
+}
+, {{-10, 7, -17, 4}
+, {130, 39, 91, -50}
+, {14, -24, 38, 61}
+, {50, 8, 42, -36}
+, {6, -37, 43, -22}
+, {-41, -11, -30, 56}
+, {-4, -58, 54, -63}
+, {100, 83, 17, -46}
+, {56, -15, 71, -44}
+, {41, -2, 43, 46}
+, {83, 12, 71, 59}
+, {106, 78, 28, -50}
+, {33, 4, 29, -39}
+, {22, 28, -6, -24}
+, {15, 32, -17, -49}
+, {51, 56, -5, 66}
+, {74, 47, 27, 48}
+, {10, -31, 41, 26}
+, {82, 80, 2, 72}
+, {-86, -93, 7, -27}
+, {-145, -75, -70, -36}
+, {-95, -17, -78, -19}
+, {-80, -61, -19, 52}
+, {25, 78, -53, -66}
+, {156, 74, 82, 4}
+, {45, -28, 73, 11}
+, {-76, -26, -50, -73}
+, {-101, -28, -73, 35}
+, {-94, -53, -41, 5}
+, {86, 54, 32, 45}
+, {-95, -46, -49, -47}
+, {103, 77, 26, -31}
+}
+, {{-4, -53, 49, 72}
+, {19, -30, 49, -67}
+, {-1, -60, 59, -61}
+, {83, 86, -3, -63}
+, {111, 53, 58, 61}
+, {-77, -69, -8, -32}
+, {-94, -53, -41, -29}
+, {47, 34, 13, -15}
+, {34, -15, 49, 42}
+, {-56, -57, 1, 60}
+, {90, 39, 51, -32}
+, {-49, 32, -81, -72}
+, {67, 33, 34, 14}
+, {71, -5, 76, -14}
+, {-32, -33, 1, 41}
+, {27, -49, 76, 74}
+, {50, -12, 62, 43}
+, {69, 49, 20, -48}
+, {-66, -53, -13, -78}
+, {49, 47, 2, -74}
+, {-48, -14, -34, 70}
+, {-62, -63, 1, -45}
+, {25, 78, -53, -3}
+, {-103, -58, -45, -56}
+, {-26, 39, -65, -21}
+, {-27, 37, -64, 4}
+, {-42, -48, 6, 52}
+, {-55, -48, -7, -51}
+, {-23, -31, 8, -18}
+, {16, -19, 35, 67}
+, {46, 74, -28, 16}
+, {-67, -59, -8, 42}
+}
+, {{-25, -50, 25, 50}
+, {-84, -55, -29, 37}
+, {6, -11, 17, -29}
+, {22, 22, 0, -37}
+, {4, -23, 27, -43}
+, {130, 55, 75, 21}
+, {49, 8, 41, -70}
+, {-14, 47, -61, -31}
+, {-121, -69, -52, -33}
+, {28, -35, 63, 75}
+, {127, 65, 62, -14}
+, {38, 37, 1, 30}
+, {21, -25, 46, -45}
+, {97, 30, 67, 35}
+, {71, 57, 14, -79}
+, {-13, 32, -45, 20}
+, {-83, -45, -38, 20}
+, {59, 79, -20, 34}
+, {-36, -76, 40, 50}
+, {-10, -20, 10, -21}
+, {-34, -68, 34, -40}
+, {48, 16, 32, 37}
+, {-17, 36, -53, 1}
+, {62, 0, 62, 12}
+, {47, 12, 35, -24}
+, {59, 2, 57, -27}
+, {52, 42, 10, -19}
+, {110, 27, 83, 60}
+, {63, 8, 55, 70}
+, {-21, -60, 39, 15}
+, {1, 64, -63, -2}
+, {6, -38, 44, -61}
+}
+, {{-86, -17, -69, -28}
+, {32, -30, 62, 57}
+, {-29, 0, -29, 28}
+, {48, 87, -39, -10}
+, {63, 30, 33, -43}
+, {41, 13, 28, 37}
+, {-41, -44, 3, 21}
+, {-5, 18, -23, -60}
+, {-22, 52, -74, 60}
+, {-20, -2, -18, 50}
+, {-13, -72, 59, 33}
+, {30, -24, 54, -50}
+, {-37, 15, -52, -21}
+, {46, 45, 1, 44}
+, {-58, 10, -68, -11}
+, {79, 58, 21, -47}
+, {-27, 26, -53, 75}
+, {45, 67, -22, 34}
+, {94, 39, 55, -71}
+, {60, 31, 29, 31}
+, {123, 86, 37, -42}
+, {100, 62, 38, -59}
+, {-10, 12, -22, 28}
+, {42, -29, 71, 62}
+, {-99, -34, -65, 49}
+, {-50, -47, -3, -66}
+, {-74, -47, -27, -17}
+, {30, 77, -47, 62}
+, {-37, 4, -41, -11}
+, {-19, -61, 42, 36}
+, {-100, -73, -27, -56}
+, {43, -12, 55, -86}
+}
+, {{11, -1, 12, -70}
+, {-115, -55, -60, -26}
+, {-31, -68, 37, -37}
+, {-85, -76, -9, -78}
+, {-4, -26, 22, -2}
+, {25, 4, 21, 64}
+, {-61, -61, 0, -23}
+, {138, 79, 59, 73}
+, {-56, -23, -33, -50}
+, {-39, -36, -3, -6}
+, {11, 65, -54, 68}
+, {78, 8, 70, 23}
+, {-25, 50, -75, -67}
+, {-6, -2, -4, 7}
+, {25, 43, -18, -23}
+, {-63, -38, -25, 48}
+, {-63, -58, -5, -38}
+, {19, 6, 13, -75}
+, {117, 51, 66, 65}
+, {96, 62, 34, 64}
+, {-25, 9, -34, 53}
+, {19, 35, -16, 57}
+, {-88, -90, 2, -25}
+, {54, 29, 25, -74}
+, {58, 56, 2, -62}
+, {-103, -38, -65, 63}
+, {42, 3, 39, -27}
+, {89, 17, 72, 19}
+, {-84, -54, -30, 35}
+, {5, 10, -5, -2}
+, {-119, -48, -71, -68}
+, {87, 51, 36, -48}
+}
+, {{4, -43, 47, -26}
+, {-116, -63, -53, 73}
+, {-16, 26, -42, 17}
+, {-63, -74, 11, 65}
+, {14, -54, 68, 41}
+, {-78, -9, -69, 64}
+, {-71, -60, -11, 27}
+, {54, -3, 57, 15}
+, {73, -6, 79, -28}
+, {-78, -42, -36, -33}
+, {18, -50, 68, 6}
+, {43, 15, 28, -65}
+, {-68, -58, -10, -18}
+, {-98, -41, -57, 63}
+, {110, 43, 67, -23}
+, {-90, -24, -66, 64}
+, {38, 24, 14, 51}
+, {73, 48, 25, 51}
+, {-13, 13, -26, -24}
+, {-12, -46, 34, -5}
+, {76, 75, 1, 13}
+, {-62, -36, -26, -32}
+, {-57, 13, -70, -42}
+, {79, 51, 28, 42}
+, {-17, -2, -15, -53}
+, {-18, -42, 24, 61}
+, {51, 24, 27, 33}
+, {-11, 57, -68, -36}
+, {105, 46, 59, 28}
+, {-31, -5, -26, 26}
+, {120, 69, 51, -24}
+, {-5, 12, -17, -28}
+}
+, {{-11, -18, 7, -38}
+, {11, 64, -53, -14}
+, {75, 54, 21, -58}
+, {114, 44, 70, -69}
+, {56, 33, 23, 6}
+, {-82, -53, -29, 42}
+, {60, -16, 76, 68}
+, {58, 58, 0, -60}
+, {72, 22, 50, 20}
+, {-63, -35, -28, -3}
+, {111, 48, 63, 18}
+, {31, 20, 11, -2}
+, {-41, -68, 27, 5}
+, {-12, -43, 31, 73}
+, {2, 62, -60, 10}
+, {64, 40, 24, -21}
+, {-71, -12, -59, 60}
+, {105, 72, 33, 75}
+, {18, -13, 31, 5}
+, {-115, -84, -31, 42}
+, {65, 54, 11, -43}
+, {39, 40, -1, 16}
+, {-27, -25, -2, 28}
+, {122, 55, 67, -17}
+, {-40, -79, 39, -13}
+, {13, 58, -45, -56}
+, {-74, -21, -53, 10}
+, {20, 45, -25, -41}
+, {-13, -12, -1, 24}
+, {-49, 7, -56, 29}
+, {-9, 22, -31, -66}
+, {83, 64, 19, -76}
+}
+, {{60, 18, 42, 74}
+, {9, 65, -56, 67}
+, {94, 37, 57, 58}
+, {-102, -27, -75, 46}
+, {-18, -67, 49, 63}
+, {31, 61, -30, 71}
+, {126, 59, 67, 21}
+, {18, 66, -48, 3}
+, {54, 56, -2, 63}
+, {-27, 19, -46, 39}
+, {37, -34, 71, 40}
+, {123, 72, 51, -56}
+, {91, 23, 68, -41}
+, {50, 35, 15, 30}
+, {-18, -73, 55, 56}
+, {-5, -11, 6, -69}
+, {-43, 20, -63, 10}
+, {-34, -7, -27, 42}
+, {-1, 9, -10, 28}
+, {-136, -77, -59, -26}
+, {-17, -11, -6, -34}
+, {102, 66, 36, -62}
+, {3, 52, -49, -3}
+, {-62, -48, -14, -12}
+, {34, 0, 34, -54}
+, {-35, -13, -22, -13}
+, {45, 15, 30, -16}
+, {22, 17, 5, 50}
+, {-22, 8, -30, -2}
+, {125, 64, 61, 54}
+, {93, 36, 57, -17}
+, {13, -68, 81, 1}
+}
+, {{-110, -52, -58, 59}
+, {-52, 28, -80, -31}
+, {-71, -57, -14, -6}
+, {5, -58, 63, 17}
+, {-75, -69, -6, -4}
+, {43, -7, 50, 70}
+, {-53, -69, 16, -64}
+, {86, 31, 55, -43}
+, {90, 41, 49, -74}
+, {33, -45, 78, 47}
+, {75, 13, 62, 23}
+, {33, -1, 34, -68}
+, {-15, -4, -11, -43}
+, {3, 33, -30, 3}
+, {-2, -20, 18, 8}
+, {38, -25, 63, -64}
+, {-49, -49, 0, 14}
+, {64, 47, 17, 33}
+, {57, 13, 44, -73}
+, {58, 38, 20, 14}
+, {-27, -4, -23, 70}
+, {14, -54, 68, -23}
+, {-54, -58, 4, 49}
+, {8, 38, -30, 38}
+, {13, 0, 13, 43}
+, {-66, -23, -43, -21}
+, {40, 79, -39, 7}
+, {37, -23, 60, 11}
+, {40, 33, 7, 6}
+, {-85, -53, -32, -18}
+, {59, 3, 56, 22}
+, {-57, -32, -25, 21}
+}
+, {{-8, 50, -58, 10}
+, {83, 64, 19, -28}
+, {13, 39, -26, 32}
+, {8, -31, 39, 69}
+, {19, 28, -9, -63}
+, {-45, -30, -15, 11}
+, {-56, -51, -5, -29}
+, {52, -5, 57, -12}
+, {66, 18, 48, 27}
+, {0, 57, -57, -37}
+, {-84, -50, -34, 71}
+, {-62, -72, 10, -9}
+, {39, 39, 0, -17}
+, {-40, 28, -68, -38}
+, {92, 18, 74, 15}
+, {-57, 7, -64, -68}
+, {46, 77, -31, 45}
+, {58, 25, 33, -43}
+, {64, 15, 49, 78}
+, {-19, -44, 25, -64}
+, {-63, -76, 13, 47}
+, {-98, -73, -25, -13}
+, {16, -48, 64, 4}
+, {39, 39, 0, -6}
+, {4, 15, -11, 66}
+, {-111, -59, -52, -40}
+, {-37, -15, -22, -63}
+, {21, 62, -41, 30}
+, {53, 48, 5, 25}
+, {-43, -77, 34, 58}
+, {45, -7, 52, 68}
+, {-14, 2, -16, -75}
+}
+}
+;
+
+#undef INPUT_CHANNELS
+#undef CONV_FILTERS
+#undef WINOGRAD_TAPS
@@ -0,0 +1,8341 @@
+/**
+  ******************************************************************************
+  * @file    weights/conv1d_119_winograd.c
+  * @version 1.0.0
+  * @date    17 october 2026
+  * @brief   F(2,3) transformed kernel of conv1d_119, generated by tools/winograd_weights.py
+  */
+
+#define CONV1D_119_WINOGRAD
+
+#define INPUT_CHANNELS    64
+#define CONV_FILTERS      128
+#define WINOGRAD_TAPS     4
+
+
+const int16_t conv1d_119_winograd_kernel[CONV_FILTERS][INPUT_CHANNELS][WINOGRAD_TAPS] = {{{-64, -29, -25, 10}
+, {-80, -25, -129, -74}
+, {-42, 74, -44, 72}
+, {-82, -69, -47, -34}
+, {114, 124, 42, 52}
+, {48, 21, -65, -92}
+, {-10, -99, -13, -102}
+, {-76, -47, 13, 42}
+, {-68, -15, -65, -12}
+, {0, 14, 74, 88}
+, {-106, -117, -49, -60}
+, {-52, 47, -11, 88}
+, {-54, -24, 28, 58}
+, {-74, -9, -75, -10}
+, {-106, -33, -127, -54}
+, {30, 2, 86, 58}
+, {82, 120, 22, 60}
+, {-96, -1, -59, 36}
+, {-66, -14, -68, -16}
+, {-48, 32, 20, 100}
+, {-42, -68, -20, -46}
+, {64, -23, 39, -48}
+, {78, 59, 99, 80}
+, {30, 35, -47, -42}
+, {118, 34, 24, -60}
+, {66, -17, -27, -110}
+, {-58, -49, -13, -4}
+, {0, -36, -2, -38}
+, {-14, -81, -23, -90}
+, {70, 83, 67, 80}
+, {18, -27, -47, -92}
+, {-12, -24, -86, -98}
+, {-82, -36, 40, 86}
+, {-116, -66, 34, 84}
+, {-64, 41, -81, 24}
+, {0, 47, 53, 100}
+, {18, -23, -51, -92}
+, {50, -15, 59, -6}
+, {90, 117, 3, 30}
+, {-44, 72, -24, 92}
+, {-18, 16, 84, 118}
+, {38, -59, 23, -74}
+, {42, 0, 6, -36}
+, {8, -40, 54, 6}
+, {36, 35, 101, 100}
+, {-64, -92, -36, -64}
+, {60, 100, 24, 64}
+, {48, -54, 24, -78}
+, {-20, 42, 12, 74}
+, {-120, -153, -51, -84}
+, {78, 22, -36, -92}
+, {-120, -104, -78, -62}
+, {98, 68, 142, 112}
+, {82, 49, 29, -4}
+, {-10, 46, 4, 60}
+, {-4, -64, -2, -62}
+, {-42, -68, -62, -88}
+, {-86, -17, -81, -12}
+, {-12, 31, 3, 46}
+, {86, 83, 105, 102}
+, {0, 25, -7, 18}
+, {108, 39, 79, 10}
+, {54, 19, 89, 54}
+, {-4, -54, -26, -76}
+}
+, {{26, 88, -18, 44}
+, {38, 19, 51, 32}
+, {-46, -120, -48, -122}
+, {92, 29, 105, 42}
+, {-10, -93, 1, -82}
+, {46, 33, 73, 60}
+, {58, 8, 76, 26}
+, {-76, -27, -23, 26}
+, {46, -35, 17, -64}
+, {-60, -27, -13, 20}
+, {10, -23, 73, 40}
+, {10, 20, -76, -66}
+, {-94, -32, -84, -22}
+, {-34, 26, -56, 4}
+, {-96, -64, -80, -48}
+, {60, 19, 79, 38}
+, {-90, -76, 18, 32}
+, {-88, -118, -52, -82}
+, {74, 105, 43, 74}
+, {88, 67, 115, 94}
+, {16, 82, 28, 94}
+, {24, 17, 51, 44}
+, {-18, 42, 46, 106}
+, {-50, -13, 41, 78}
+, {58, 12, 30, -16}
+, {-4, 39, -3, 40}
+, {-92, -112, -16, -36}
+, {56, 21, -19, -54}
+, {74, 34, -22, -62}
+, {-94, -46, 26, 74}
+, {44, 45, 93, 94}
+, {6, -2, -52, -60}
+, {-56, -58, 26, 24}
+, {-74, -1, -23, 50}
+, {22, 28, 18, 24}
+, {-92, -25, -151, -84}
+, {-20, 50, -34, 36}
+, {106, 54, 92, 40}
+, {-20, -44, -34, -58}
+, {96, 105, 93, 102}
+, {-82, -57, 5, 30}
+, {-96, -95, 1, 2}
+, {-60, 4, -104, -40}
+, {62, 69, 27, 34}
+, {-32, -78, 2, -44}
+, {-82, 16, -66, 32}
+, {-66, -90, -76, -100}
+, {40, -71, 19, -92}
+, {-74, -49, -45, -20}
+, {64, -77, 51, -90}
+, {66, 138, 28, 100}
+, {-46, -91, 29, -16}
+, {-64, 20, -60, 24}
+, {-48, -93, -49, -94}
+, {-20, 63, -9, 74}
+, {56, -26, 32, -50}
+, {-96, -31, -105, -40}
+, {74, 26, 122, 74}
+, {34, 51, -23, -6}
+, {-78, 6, -54, 30}
+, {38, 25, -41, -54}
+, {-58, -6, -32, 20}
+, {26, 29, -13, -10}
+, {0, -12, -58, -70}
+}
+, {{-14, 40, -14, 40}
+, {-82, -21, -49, 12}
+, {46, -18, -32, -96}
+, {-82, -86, 38, 34}
+, {-76, -117, -59, -100}
+, {-20, 43, -37, 26}
+, {52, 39, -67, -80}
+, {82, 83, 27, 28}
+, {98, -10, 44, -64}
+, {82, 95, -11, 2}
+, {66, 118, 50, 102}
+, {-36, 45, -49, 32}
+, {-8, -73, -39, -104}
+, {28, 18, -2, -12}
+, {-86, 16, -80, 22}
+, {-58, -63, -41, -46}
+, {-28, 59, 9, 96}
+, {-38, -64, -94, -120}
+, {54, 58, -32, -28}
+, {0, -24, 34, 10}
+, {-70, -30, 58, 98}
+, {82, 58, 8, -16}
+, {6, 17, -59, -48}
+, {82, 78, -10, -14}
+, {18, 91, 47, 120}
+, {-114, -69, -65, -20}
+, {-32, 3, -23, 12}
+, {-18, 1, 21, 40}
+, {68, 0, 46, -22}
+, {-74, -6, -10, 58}
+, {18, 35, -5, 12}
+, {62, -8, 32, -38}
+, {-8, 49, -7, 50}
+, {2, -26, -50, -78}
+, {112, -8, 80, -40}
+, {-84, -127, -81, -124}
+, {-94, -94, -6, -6}
+, {18, -11, 53, 24}
+, {122, 31, 103, 12}
+, {-130, -97, -133, -100}
+, {84, 6, 22, -56}
+, {-10, -10, -42, -42}
+, {-6, -32, 42, 16}
+, {22, -29, -31, -82}
+, {-56, -61, -11, -16}
+, {60, 69, 69, 78}
+, {18, 42, -54, -30}
+, {-40, 59, -11, 88}
+, {98, 80, 122, 104}
+, {58, 75, 27, 44}
+, {-110, -147, -47, -84}
+, {118, 54, 50, -14}
+, {66, 48, -38, -56}
+, {-18, -32, 58, 44}
+, {88, 34, 128, 74}
+, {0, -13, -33, -46}
+, {26, -45, 1, -70}
+, {26, 136, 10, 120}
+, {-54, 5, -9, 50}
+, {-42, -30, -72, -60}
+, {0, 108, -8, 100}
+, {34, 75, 23, 64}
+, {18, -57, 1, -74}
+, {-22, -6, -24, -8}
+}
+, {{0, -6, 6, 0}
+, {-72, 35, -15, 92}
+, {34, -27, 67, 6}
+, {-2, 48, 30, 80}
+, {82, -2, 80, -4}
+, {56, 60, -20, -16}
+, {56, 32, 44, 20}
+, {58, 18, 78, 38}
+, {-52, 2, -90, -36}
+, {0, -14, -30, -44}
+, {-36, 83, -21, 98}
+, {12, 65, 39, 92}
+, {84, 59, 101, 76}
+, {0, 76, 16, 92}
+, {-82, -81, 15, 16}
+, {48, -4, -32, -84}
+, {-92, -51, -87, -46}
+, {54, 12, 62, 20}
+, {-6, 48, -54, 0}
+, {-102, 42, -50, 94}
+, {50, -16, -4, -70}
+, {-6, -21, -61, -76}
+, {46, 76, 20, 50}
+, {28, 122, -12, 82}
+, {48, 131, 21, 104}
+, {-122, -102, -82, -62}
+, {36, 113, -13, 64}
+, {-74, 5, -61, 18}
+, {74, 60, 26, 12}
+, {84, 35, 111, 62}
+, {-106, -77, -69, -40}
+, {56, 45, 7, -4}
+, {104, 49, 49, -6}
+, {48, 68, 36, 56}
+, {62, 141, 27, 106}
+, {-2, -77, 5, -70}
+, {6, -66, -34, -106}
+, {84, 25, -31, -90}
+, {-90, -84, -20, -14}
+, {0, -33, -3, -36}
+, {-112, -83, 15, 44}
+, {78, 57, 59, 38}
+, {24, 44, -2, 18}
+, {42, 14, -28, -56}
+, {96, 126, 84, 114}
+, {82, -27, 39, -70}
+, {-48, 22, -26, 44}
+, {-68, -63, 1, 6}
+, {2, 80, 18, 96}
+, {-14, 58, -8, 64}
+, {90, 40, 112, 62}
+, {54, 58, 80, 84}
+, {-66, -37, 49, 78}
+, {92, 21, 83, 12}
+, {-62, -18, -14, 30}
+, {30, -11, 41, 0}
+, {66, 82, 86, 102}
+, {6, -8, 10, -4}
+, {-80, -26, 46, 100}
+, {10, 66, 18, 74}
+, {-12, -7, 3, 8}
+, {-50, -84, 0, -34}
+, {102, 77, 5, -20}
+, {-94, -74, -50, -30}
+}
+, {{56, 52, 74, 70}
+, {-48, 5, 11, 64}
+, {66, 64, -34, -36}
+, {-84, -128, -16, -60}
+, {4, -17, 59, 38}
+, {-6, -38, -48, -80}
+, {26, 55, -3, 26}
+, {-20, -6, -70, -56}
+, {72, -21, 49, -44}
+, {-28, 29, 5, 62}
+, {-122, -54, -84, -16}
+, {-18, 17, 17, 52}
+, {-56, -64, -90, -98}
+, {-82, -64, -116, -98}
+, {50, 45, -27, -32}
+, {114, 13, 73, -28}
+, {10, 82, 24, 96}
+, {58, 14, 46, 2}
+, {-20, -69, -35, -84}
+, {-82, 39, -39, 82}
+, {-44, -30, 52, 66}
+, {-60, 17, -17, 60}
+, {-86, -16, 30, 100}
+, {0, -78, 6, -72}
+, {-4, 19, -9, 14}
+, {108, 45, 7, -56}
+, {-16, -9, -33, -26}
+, {56, 25, -53, -84}
+, {58, 72, 92, 106}
+, {82, 30, 66, 14}
+, {78, 69, 19, 10}
+, {-28, -43, -11, -26}
+, {-66, 43, -43, 66}
+, {-18, -48, -64, -94}
+, {48, 42, 40, 34}
+, {66, -3, 7, -62}
+, {-78, -34, 48, 92}
+, {96, 21, -15, -90}
+, {-60, -35, -75, -50}
+, {-64, 32, -48, 48}
+, {-80, -66, -56, -42}
+, {-66, -117, -5, -56}
+, {36, -4, 32, -8}
+, {38, 60, 36, 58}
+, {-40, 14, -2, 52}
+, {-60, 15, 45, 120}
+, {-54, -7, -81, -34}
+, {-8, 12, -12, 8}
+, {-44, -21, -73, -50}
+, {66, 48, 84, 66}
+, {-74, 36, -22, 88}
+, {18, 81, -5, 58}
+, {-70, 21, -69, 22}
+, {-14, -11, 23, 26}
+, {88, 80, 2, -6}
+, {28, -43, 39, -32}
+, {-62, -20, 50, 92}
+, {-42, 92, -10, 124}
+, {60, -43, 31, -72}
+, {-44, -17, 59, 86}
+, {90, 92, 106, 108}
+, {-18, 25, -57, -14}
+, {-22, -102, -28, -108}
+, {60, 29, -17, -48}
+}
+, {{2, 34, -46, -14}
+, {80, 4, 110, 34}
+, {-92, -21, -29, 42}
+, {112, 111, 73, 72}
+, {-70, -106, -30, -66}
+, {76, 116, 32, 72}
+, {62, 86, 48, 72}
+, {64, 40, 110, 86}
+, {92, -8, 84, -16}
+, {-48, -50, -52, -54}
+, {22, 30, -2, 6}
+, {-80, -10, -70, 0}
+, {-80, -15, 11, 76}
+, {-42, 50, -4, 88}
+, {18, -38, -34, -90}
+, {-38, -69, 19, -12}
+, {-82, -23, 27, 86}
+, {-106, -37, -13, 56}
+, {-20, -4, 60, 76}
+, {-18, 27, -87, -42}
+, {0, -73, 1, -72}
+, {116, 38, 96, 18}
+, {-78, 12, -22, 68}
+, {88, 3, 85, 0}
+, {80, 137, 27, 84}
+, {-8, 5, -69, -56}
+, {74, 12, 110, 48}
+, {20, 27, 59, 66}
+, {78, 32, 60, 14}
+, {66, 4, 18, -44}
+, {-14, 25, -5, 34}
+, {-24, -26, -4, -6}
+, {134, 90, 4, -40}
+, {-42, 3, -73, -28}
+, {48, 89, 25, 66}
+, {72, 17, 81, 26}
+, {32, 101, 5, 74}
+, {-26, 39, 15, 80}
+, {-36, -12, 14, 38}
+, {4, -76, 62, -18}
+, {-56, -97, 27, -14}
+, {72, 45, 27, 0}
+, {48, 43, 85, 80}
+, {-126, -55, -45, 26}
+, {36, 58, 32, 54}
+, {84, -22, 30, -76}
+, {-26, 12, 24, 62}
+, {-108, -53, -131, -76}
+, {-28, -49, 65, 44}
+, {-130, -82, -136, -88}
+, {10, -54, 8, -56}
+, {30, -28, -56, -114}
+, {-50, 13, 49, 112}
+, {-2, 78, -12, 68}
+, {-90, -11, -109, -30}
+, {30, 8, 42, 20}
+, {-94, -45, -125, -76}
+, {-80, -113, -37, -70}
+, {-32, 14, -20, 26}
+, {98, 56, 38, -4}
+, {22, -59, 23, -58}
+, {-94, 35, -37, 92}
+, {76, 56, 136, 116}
+, {70, -17, -29, -116}
+}
+, {{-56, 19, 21, 96}
+, {-84, -41, -97, -54}
+, {-68, -62, -128, -122}
+, {30, -24, 18, -36}
+, {-82, -87, -91, -96}
+, {86, 33, 119, 66}
+, {0, 68, 26, 94}
+, {82, 27, -11, -66}
+, {-72, -65, -43, -36}
+, {-80, -33, -109, -62}
+, {-36, -42, -56, -62}
+, {-84, -49, -29, 6}
+, {38, 94, 0, 56}
+, {-26, -27, 11, 10}
+, {-34, 30, 24, 88}
+, {-90, -66, -108, -84}
+, {10, 10, 90, 90}
+, {-68, 27, -55, 40}
+, {38, 9, 85, 56}
+, {-18, -46, 56, 28}
+, {68, 27, -45, -86}
+, {-76, -48, -48, -20}
+, {64, -37, 1, -100}
+, {-74, -33, 31, 72}
+, {12, -83, 3, -92}
+, {-100, -84, -92, -76}
+, {22, 69, 19, 66}
+, {-96, -3, -25, 68}
+, {-28, -39, -3, -14}
+, {56, 82, 10, 36}
+, {-42, 12, -50, 4}
+, {46, 30, 56, 40}
+, {-44, -71, 15, -12}
+, {70, 95, 69, 94}
+, {40, 89, 39, 88}
+, {-36, 43, -29, 50}
+, {-60, -55, -7, -2}
+, {0, 9, 9, 18}
+, {92, 7, 101, 16}
+, {106, 61, 61, 16}
+, {38, 108, 24, 94}
+, {-62, -43, 29, 48}
+, {26, 43, -41, -24}
+, {-88, -10, -28, 50}
+, {-64, -22, 14, 56}
+, {-100, -115, -71, -86}
+, {-2, 25, -49, -22}
+, {6, -27, 87, 54}
+, {-100, -29, -27, 44}
+, {-76, -63, -91, -78}
+, {30, -24, 62, 8}
+, {-60, -56, -6, -2}
+, {-8, -4, -40, -36}
+, {60, 24, 4, -32}
+, {-80, -35, 13, 58}
+, {-30, -61, -61, -92}
+, {-36, -56, -24, -44}
+, {-112, -13, -99, 0}
+, {-62, -2, 8, 68}
+, {72, 117, 49, 94}
+, {-80, -122, -20, -62}
+, {-88, -66, -72, -50}
+, {-50, -28, -14, 8}
+, {-8, -14, 20, 14}
+}
+, {{92, 44, 34, -14}
+, {0, 66, -6, 60}
+, {-36, -63, -45, -72}
+, {48, -22, 12, -58}
+, {-60, -24, -112, -76}
+, {36, 25, 7, -4}
+, {-34, 1, -89, -54}
+, {8, -12, 4, -16}
+, {18, -7, 95, 70}
+, {-42, 46, 26, 114}
+, {96, 117, 17, 38}
+, {32, -25, 47, -10}
+, {-8, -10, 86, 84}
+, {-122, -12, -44, 66}
+, {-4, -82, 16, -62}
+, {-28, 12, 4, 44}
+, {-62, 16, 20, 98}
+, {-22, 27, -69, -20}
+, {0, 58, 56, 114}
+, {-60, 17, -73, 4}
+, {-2, 73, 1, 76}
+, {0, 22, -22, 0}
+, {-88, 5, -39, 54}
+, {-4, 41, -13, 32}
+, {22, 101, -1, 78}
+, {10, -55, 1, -64}
+, {28, 63, 63, 98}
+, {12, 66, -22, 32}
+, {-66, -107, -27, -68}
+, {-4, 13, 53, 70}
+, {-100, -126, -28, -54}
+, {-86, -54, -72, -40}
+, {-54, -29, -123, -98}
+, {-72, 19, -59, 32}
+, {104, 87, 57, 40}
+, {36, -42, -30, -108}
+, {108, 53, -3, -58}
+, {-44, -18, 20, 46}
+, {-36, 45, 47, 128}
+, {8, -72, -6, -86}
+, {60, -35, 5, -90}
+, {-4, -54, -60, -110}
+, {-102, -127, -45, -70}
+, {36, 56, 20, 40}
+, {-48, -30, 18, 36}
+, {-98, -88, -16, -6}
+, {100, -3, 73, -30}
+, {98, 104, 34, 40}
+, {-36, 113, -11, 138}
+, {2, 43, -23, 18}
+, {-88, -126, -76, -114}
+, {110, 86, -10, -34}
+, {18, 31, -55, -42}
+, {102, 54, 4, -44}
+, {-42, 48, -6, 84}
+, {20, 32, 4, 16}
+, {-68, -42, 4, 30}
+, {-58, 12, 18, 88}
+, {-46, -22, -68, -44}
+, {98, 95, 7, 4}
+, {40, 71, 5, 36}
+, {-76, -46, -74, -44}
+, {58, 26, 30, -2}
+, {24, -58, 28, -54}
+}
+, {{14, -7, 57, 36}
+, {-86, -25, -67, -6}
+, {-72, -10, 30, 92}
+, {36, 112, 10, 86}
+, {96, 70, 64, 38}
+, {-54, 56, -10, 100}
+, {4, -6, 28, 18}
+, {106, 48, 74, 16}
+, {-48, -24, -8, 16}
+, {-48, -33, -15, 0}
+, {76, 50, 100, 74}
+, {-56, 17, -77, -4}
+, {0, 45, 1, 46}
+, {50, 11, -45, -84}
+, {40, 11, -5, -34}
+, {94, 8, 98, 12}
+, {-10, -8, -54, -52}
+, {-4, 2, 78, 84}
+, {-84, 6, -76, 14}
+, {-82, -119, -55, -92}
+, {-74, -33, -99, -58}
+, {-30, 6, 50, 86}
+, {56, 120, 32, 96}
+, {70, 59, 81, 70}
+, {36, 35, 5, 4}
+, {44, 20, -14, -38}
+, {68, 144, -12, 64}
+, {76, 127, 49, 100}
+, {72, -32, 12, -92}
+, {16, 8, 92, 84}
+, {38, -18, 16, -40}
+, {10, 21, 119, 130}
+, {62, 78, 90, 106}
+, {128, 129, 27, 28}
+, {-42, 8, -66, -16}
+, {-86, -51, -29, 6}
+, {-96, -79, -41, -24}
+, {94, -3, 55, -42}
+, {-22, 19, 59, 100}
+, {98, 51, 121, 74}
+, {0, 41, 1, 42}
+, {82, 38, 98, 54}
+, {58, 38, -38, -58}
+, {38, -22, 2, -58}
+, {-58, -59, -81, -82}
+, {-84, -74, -14, -4}
+, {96, 120, 58, 82}
+, {74, 51, 115, 92}
+, {-66, -67, -61, -62}
+, {82, 43, -29, -68}
+, {-72, -102, -38, -68}
+, {-76, -92, 6, -10}
+, {44, -36, -18, -98}
+, {102, 87, 47, 32}
+, {28, -4, 48, 16}
+, {74, 71, 7, 4}
+, {26, -17, 25, -18}
+, {4, -23, 59, 32}
+, {66, 64, 18, 16}
+, {-38, -55, -13, -30}
+, {-40, -112, -18, -90}
+, {-30, -10, -34, -14}
+, {90, 102, -4, 8}
+, {-16, -57, -17, -58}
+}
+, {{22, -21, 15, -28}
+, {94, 103, 59, 68}
+, {38, 69, 83, 114}
+, {-12, 9, -77, -56}
+, {-78, -65, -93, -80}
+, {-18, -31, -99, -112}
+, {34, -77, -3, -114}
+, {-100, 9, -25, 84}
+, {80, 48, 114, 82}
+, {8, -54, 24, -38}
+, {-52, -78, 8, -18}
+, {-52, -57, -9, -14}
+, {-36, -52, -42, -58}
+, {78, 100, -30, -8}
+, {-32, 17, -25, 24}
+, {50, 21, -37, -66}
+, {86, 8, 6, -72}
+, {-26, -40, 6, -8}
+, {-20, 0, 70, 90}
+, {54, 35, 35, 16}
+, {50, 2, -26, -74}
+, {-20, -55, 21, -14}
+, {-68, -25, -81, -38}
+, {-22, -58, 12, -24}
+, {-60, -30, -116, -86}
+, {42, 37, -15, -20}
+, {106, 7, -3, -102}
+, {34, -17, -51, -102}
+, {56, 28, -38, -66}
+, {-70, 1, -31, 40}
+, {50, 86, -36, 0}
+, {-30, -55, -37, -62}
+, {-42, -1, -49, -8}
+, {0, -24, 90, 66}
+, {54, 87, 43, 76}
+, {72, 84, 44, 56}
+, {90, 96, 2, 8}
+, {102, 10, 74, -18}
+, {100, 108, -8, 0}
+, {-30, 23, 13, 66}
+, {-24, -66, -2, -44}
+, {66, -50, 6, -110}
+, {-106, -34, -82, -10}
+, {-28, -44, -74, -90}
+, {-78, -112, -32, -66}
+, {22, -15, 59, 22}
+, {0, 29, 33, 62}
+, {32, 66, -20, 14}
+, {80, 118, -6, 32}
+, {32, -39, 15, -56}
+, {38, 109, 3, 74}
+, {-52, -44, -78, -70}
+, {86, 89, 91, 94}
+, {90, 43, 41, -6}
+, {-52, -14, 2, 40}
+, {84, 9, 39, -36}
+, {-40, -62, -12, -34}
+, {-100, -55, 15, 60}
+, {74, 58, -22, -38}
+, {-16, -46, 28, -2}
+, {-46, -23, -85, -62}
+, {-14, 45, -59, 0}
+, {-54, -41, -111, -98}
+, {84, 3, 57, -24}
+}
+, {{-56, 2, -120, -62}
+, {-52, 22, -26, 48}
+, {30, 35, 71, 76}
+, {-58, -40, -14, 4}
+, {-40, -48, 18, 10}
+, {44, -21, 65, 0}
+, {-10, -66, -18, -74}
+, {-82, -3, 33, 112}
+, {-2, -77, -47, -122}
+, {2, -44, 14, -32}
+, {74, 64, 82, 72}
+, {-60, -24, 50, 86}
+, {106, 28, 42, -36}
+, {-16, -2, -8, 6}
+, {42, 25, 99, 82}
+, {-14, 64, -20, 58}
+, {-6, 34, -76, -36}
+, {28, -12, 88, 48}
+, {-6, 91, -27, 70}
+, {72, 19, 55, 2}
+, {-64, -75, -61, -72}
+, {68, 37, -31, -62}
+, {-94, -121, -17, -44}
+, {46, 113, -15, 52}
+, {74, 54, 74, 54}
+, {-52, 65, -25, 92}
+, {-102, -36, -6, 60}
+, {-12, 23, 47, 82}
+, {4, 4, -46, -46}
+, {-68, -59, -5, 4}
+, {16, -12, -46, -74}
+, {30, 84, -4, 50}
+, {58, 80, 64, 86}
+, {4, -9, -47, -60}
+, {-64, 60, -4, 120}
+, {34, -105, 45, -94}
+, {2, -64, 22, -44}
+, {-76, 12, -2, 86}
+, {-12, 30, -44, -2}
+, {54, -39, 55, -38}
+, {-28, -41, -55, -68}
+, {90, 152, 72, 134}
+, {-70, 8, -34, 44}
+, {-54, -13, -105, -64}
+, {-62, -53, -45, -36}
+, {100, 45, 45, -10}
+, {70, 54, 78, 62}
+, {4, 41, 39, 76}
+, {4, 55, 23, 74}
+, {28, 25, 79, 76}
+, {30, -19, 77, 28}
+, {38, 74, 32, 68}
+, {-54, -91, -29, -66}
+, {44, -31, 41, -34}
+, {-16, -64, -62, -110}
+, {-66, -23, 11, 54}
+, {76, 90, 24, 38}
+, {140, 143, 49, 52}
+, {-146, -35, -61, 50}
+, {-44, -83, -3, -42}
+, {84, 82, 66, 64}
+, {-92, -27, -65, 0}
+, {-100, -2, -26, 72}
+, {60, 26, 90, 56}
+}
+, {{22, 38, -74, -58}
+, {-44, -80, -30, -66}
+, {-36, 71, -21, 86}
+, {-10, -46, -68, -104}
+, {-78, -108, -70, -100}
+, {4, 56, -30, 22}
+, {46, 45, -17, -18}
+, {-66, -1, -99, -34}
+, {22, 61, 7, 46}
+, {86, 71, 111, 96}
+, {-32, 10, 38, 80}
+, {34, -56, 4, -86}
+, {18, 12, 98, 92}
+, {6, -63, -37, -106}
+, {-74, -39, -31, 4}
+, {76, 52, 2, -22}
+, {106, 117, 15, 26}
+, {10, 66, 18, 74}
+, {88, 22, 96, 30}
+, {70, 40, 84, 54}
+, {-68, -78, -34, -44}
+, {-34, -46, -68, -80}
+, {-82, -17, -23, 42}
+, {-96, -72, -40, -16}
+, {-34, -19, -33, -18}
+, {28, -25, 61, 8}
+, {-66, -60, 6, 12}
+, {-58, 7, 19, 84}
+, {80, -5, 15, -70}
+, {-10, -63, 3, -50}
+, {-26, -45, 27, 8}
+, {-70, -18, -58, -6}
+, {78, 122, 34, 78}
+, {0, 18, 30, 48}
+, {46, 125, -13, 66}
+, {-56, 23, -1, 78}
+, {-100, -47, -77, -24}
+, {16, 31, -45, -30}
+, {-68, -95, -47, -74}
+, {96, 25, -9, -80}
+, {-90, -132, -42, -84}
+, {22, -8, -34, -64}
+, {10, -12, 36, 14}
+, {-92, 8, -102, -2}
+, {-6, 54, -36, 24}
+, {92, -33, 21, -104}
+, {42, -9, -27, -78}
+, {30, 10, -32, -52}
+, {-32, -53, -73, -94}
+, {26, -1, -57, -84}
+, {42, 41, 1, 0}
+, {-40, -41, -87, -88}
+, {70, -27, 49, -48}
+, {68, 43, 93, 68}
+, {80, 32, 32, -16}
+, {-46, -18, -70, -42}
+, {-80, -97, -21, -38}
+, {38, -10, 64, 16}
+, {12, 16, 50, 54}
+, {44, -49, 1, -92}
+, {72, 102, 76, 106}
+, {52, 18, 100, 66}
+, {76, 78, 94, 96}
+, {86, 40, 40, -6}
+}
+, {{30, 8, 30, 8}
+, {66, 39, -7, -34}
+, {-120, 4, -58, 66}
+, {-104, -34, -54, 16}
+, {-52, -8, -44, 0}
+, {-2, 32, 24, 58}
+, {26, 25, 33, 32}
+, {-92, 3, -71, 24}
+, {-56, -86, 32, 2}
+, {42, -41, 47, -36}
+, {-66, -8, 24, 82}
+, {32, 64, -42, -10}
+, {-100, -99, -31, -30}
+, {70, 42, 86, 58}
+, {4, -79, 39, -44}
+, {28, 45, 77, 94}
+, {-12, -25, -43, -56}
+, {58, 22, -80, -116}
+, {34, 44, 16, 26}
+, {-94, -44, 42, 92}
+, {12, 1, 71, 60}
+, {0, 39, -11, 28}
+, {42, -15, 83, 26}
+, {94, 61, 59, 26}
+, {96, 41, 111, 56}
+, {-92, -22, -44, 26}
+, {-4, -33, -53, -82}
+, {0, -50, 20, -30}
+, {-66, -28, -8, 30}
+, {-56, -34, -120, -98}
+, {2, 39, 7, 44}
+, {0, -21, 11, -10}
+, {82, -6, 54, -34}
+, {-114, -18, -12, 84}
+, {56, 123, 29, 96}
+, {-26, 29, 25, 80}
+, {14, 78, -6, 58}
+, {96, 91, -5, -10}
+, {-50, 23, -29, 44}
+, {50, 7, -37, -80}
+, {-78, -32, -8, 38}
+, {76, 16, -62, -122}
+, {22, -2, -12, -36}
+, {28, -2, 102, 72}
+, {66, -3, -33, -102}
+, {8, 62, -18, 36}
+, {-100, 28, -52, 76}
+, {-6, -80, -16, -90}
+, {-76, -43, 19, 52}
+, {8, 13, 73, 78}
+, {78, 10, 100, 32}
+, {88, 86, 86, 84}
+, {-26, 16, 24, 66}
+, {92, 43, 39, -10}
+, {-30, -23, 1, 8}
+, {-62, 27, -55, 34}
+, {44, 21, -61, -84}
+, {-84, -52, -30, 2}
+, {54, -35, 85, -4}
+, {38, 21, -7, -24}
+, {66, 113, 43, 90}
+, {28, -14, 8, -34}
+, {76, -6, 22, -60}
+, {-100, -24, -76, 0}
+}
+, {{106, 55, 133, 82}
+, {64, 19, 105, 60}
+, {-16, -55, -53, -92}
+, {-32, -19, -19, -6}
+, {-78, -97, 13, -6}
+, {28, 7, 27, 6}
+, {80, 66, 112, 98}
+, {104, 38, 88, 22}
+, {70, 116, 22, 68}
+, {52, -21, 7, -66}
+, {4, -27, 3, -28}
+, {50, 53, 7, 10}
+, {-92, 2, -26, 68}
+, {24, 75, 15, 66}
+, {-14, 17, -13, 18}
+, {-82, 4, -38, 48}
+, {86, 36, -30, -80}
+, {-62, -30, -4, 28}
+, {54, 11, 99, 56}
+, {92, 74, 108, 90}
+, {52, 28, -6, -30}
+, {110, 61, 55, 6}
+, {-38, 3, 19, 60}
+, {6, -57, 71, 8}
+, {-50, -28, 34, 56}
+, {0, 15, 97, 112}
+, {-124, -78, -14, 32}
+, {-46, -42, -86, -82}
+, {34, 42, -4, 4}
+, {-66, -9, -79, -22}
+, {48, 73, -23, 2}
+, {78, -17, 51, -44}
+, {-92, -69, -35, -12}
+, {64, 21, 125, 82}
+, {-48, -99, -63, -114}
+, {90, 91, 33, 34}
+, {-26, 20, 38, 84}
+, {86, 56, -54, -84}
+, {74, 37, 95, 58}
+, {-44, 15, 15, 74}
+, {26, -26, -40, -92}
+, {66, 71, 27, 32}
+, {-94, -79, -31, -16}
+, {18, 15, 15, 12}
+, {-52, -112, -28, -88}
+, {90, 73, 9, -8}
+, {-12, 12, -22, 2}
+, {50, 61, 71, 82}
+, {-20, -55, 49, 14}
+, {36, -28, 34, -30}
+, {-34, -1, -81, -48}
+, {-4, 21, -23, 2}
+, {56, 65, -37, -28}
+, {-74, -109, -69, -104}
+, {-6, -54, -52, -100}
+, {-80, -91, -41, -52}
+, {92, 127, 29, 64}
+, {114, 62, -34, -86}
+, {-34, -43, 1, -8}
+, {-96, -30, -44, 22}
+, {8, -31, 37, -2}
+, {90, 23, 51, -16}
+, {40, 11, -41, -70}
+, {16, 55, -25, 14}
+}
+, {{38, -23, -51, -112}
+, {48, -3, 27, -24}
+, {68, 115, 105, 152}
+, {74, 101, 67, 94}
+, {58, 7, -37, -88}
+, {118, 98, 98, 78}
+, {10, 14, 102, 106}
+, {18, -64, 2, -80}
+, {-16, -59, -53, -96}
+, {-98, -48, -20, 30}
+, {8, 72, 48, 112}
+, {8, 16, -22, -14}
+, {-70, 22, 6, 98}
+, {38, 51, 37, 50}
+, {72, 105, 21, 54}
+, {86, 84, 14, 12}
+, {66, 66, 62, 62}
+, {-14, -41, -43, -70}
+, {4, 10, -58, -52}
+, {10, -25, 77, 42}
+, {-76, -31, -79, -34}
+, {-12, 58, -40, 30}
+, {12, -41, 57, 4}
+, {74, -23, 7, -90}
+, {104, 81, 89, 66}
+, {-24, 50, 32, 106}
+, {-2, -22, -40, -60}
+, {-88, -137, -41, -90}
+, {56, 29, -53, -80}
+, {60, -42, 38, -64}
+, {2, 36, 26, 60}
+, {-56, -11, 13, 58}
+, {72, 16, -8, -64}
+, {-78, -87, -69, -78}
+, {4, -1, 9, 4}
+, {-22, 34, 28, 84}
+, {-46, -11, 21, 56}
+, {-64, 0, 34, 98}
+, {-12, -25, -75, -88}
+, {-48, -36, 32, 44}
+, {-32, -29, -71, -68}
+, {4, 25, -23, -2}
+, {32, 8, 82, 58}
+, {26, 73, 25, 72}
+, {-96, -39, 43, 100}
+, {76, 77, 77, 78}
+, {12, 99, 35, 122}
+, {-6, 112, -8, 110}
+, {-32, 62, -30, 64}
+, {-58, 17, -3, 72}
+, {92, -15, 31, -76}
+, {58, 57, -29, -30}
+, {0, 17, 19, 36}
+, {-84, -99, -1, -16}
+, {60, 22, 134, 96}
+, {-58, 55, -5, 108}
+, {86, 24, 22, -40}
+, {0, 105, 7, 112}
+, {30, 109, -39, 40}
+, {48, 28, -32, -52}
+, {-38, -81, -57, -100}
+, {96, 11, 111, 26}
+, {-32, -7, -7, 18}
+, {-2, -7, -7, -12}
+}
+, {{62, 51, 37, 26}
+, {-88, -62, -124, -98}
+, {102, 83, 115, 96}
+, {-42, -13, -11, 18}
+, {-32, 4, 62, 98}
+, {68, 48, -32, -52}
+, {-68, -13, -37, 18}
+, {46, -1, 7, -40}
+, {-18, 59, -7, 70}
+, {-102, -75, -33, -6}
+, {-82, -132, -22, -72}
+, {-104, -66, -56, -18}
+, {-56, 54, -38, 72}
+, {-80, -54, -32, -6}
+, {22, 46, -24, 0}
+, {4, -2, 26, 20}
+, {80, 67, 15, 2}
+, {24, 28, 12, 16}
+, {-34, -10, -36, -12}
+, {26, 31, 19, 24}
+, {-82, -45, -55, -18}
+, {36, 95, -9, 50}
+, {14, 74, -22, 38}
+, {6, -23, -25, -54}
+, {22, 37, 47, 62}
+, {58, 39, -57, -76}
+, {84, -15, 45, -54}
+, {-68, -114, -62, -108}
+, {-18, -6, 62, 74}
+, {-12, -35, -71, -94}
+, {16, 33, 63, 80}
+, {120, 39, 105, 24}
+, {24, 1, 65, 42}
+, {-34, -39, -41, -46}
+, {22, 5, -35, -52}
+, {56, 115, 53, 112}
+, {14, -23, 41, 4}
+, {-40, -39, -93, -92}
+, {-70, -118, -14, -62}
+, {-20, 96, 6, 122}
+, {-32, -39, -5, -12}
+, {6, -31, -17, -54}
+, {92, 17, -5, -80}
+, {-46, -96, -10, -60}
+, {-46, 41, 15, 102}
+, {36, -30, -24, -90}
+, {56, -28, 50, -34}
+, {2, 63, -19, 42}
+, {-10, 29, -41, -2}
+, {-6, -38, -78, -110}
+, {-64, -56, 34, 42}
+, {-56, -60, -34, -38}
+, {-38, 41, -53, 26}
+, {48, -19, 67, 0}
+, {-6, 15, -67, -46}
+, {6, -25, 39, 8}
+, {80, 11, 97, 28}
+, {62, 117, 57, 112}
+, {34, 9, -51, -76}
+, {102, 21, 83, 2}
+, {82, 66, 82, 66}
+, {-16, 73, -3, 86}
+, {-10, 6, -22, -6}
+, {-68, -11, -91, -34}
+}
+, {{78, -10, 58, -30}
+, {-60, -49, -33, -22}
+, {40, -27, 55, -12}
+, {-110, -81, -41, -12}
+, {-104, -27, 21, 98}
+, {36, 48, 6, 18}
+, {42, 14, -12, -40}
+, {-108, 34, -36, 106}
+, {0, 75, 29, 104}
+, {4, 63, -13, 46}
+, {0, -48, 0, -48}
+, {-36, -65, -65, -94}
+, {40, 67, 11, 38}
+, {-6, 83, -39, 50}
+, {-78, -22, 46, 102}
+, {-84, -60, 18, 42}
+, {52, 39, -17, -30}
+, {12, 3, 91, 82}
+, {-132, -56, -44, 32}
+, {88, -11, 77, -22}
+, {44, 60, -20, -4}
+, {88, 23, 93, 28}
+, {-50, -107, -7, -64}
+, {78, 65, 99, 86}
+, {20, -16, 34, -2}
+, {46, 81, 53, 88}
+, {70, 35, -29, -64}
+, {-56, -19, 39, 76}
+, {-54, 5, -59, 0}
+, {-30, -48, 18, 0}
+, {36, 37, -17, -16}
+, {-22, 13, 21, 56}
+, {-22, 10, 12, 44}
+, {-36, -34, -96, -94}
+, {38, 34, -50, -54}
+, {98, -10, 88, -20}
+, {58, 41, 89, 72}
+, {-76, -94, -6, -24}
+, {46, 62, 58, 74}
+, {60, 131, 33, 104}
+, {-48, -63, -85, -100}
+, {-14, -12, -88, -86}
+, {-80, -86, -54, -60}
+, {-6, -31, -69, -94}
+, {-108, -43, 25, 90}
+, {86, 52, 22, -12}
+, {14, 6, -18, -26}
+, {-94, -67, -67, -40}
+, {-86, -26, 6, 66}
+, {-92, -27, -33, 32}
+, {-14, -13, 41, 42}
+, {-54, -19, -113, -78}
+, {-20, 13, -59, -26}
+, {-62, -13, -87, -38}
+, {-88, -93, 17, 12}
+, {-96, -73, -69, -46}
+, {-42, 0, -12, 30}
+, {-84, -50, -70, -36}
+, {10, 49, 29, 68}
+, {-82, 14, -16, 80}
+, {-36, -55, 47, 28}
+, {34, 19, 9, -6}
+, {-124, -32, -54, 38}
+, {-8, -70, 20, -42}
+}
+, {{84, -24, 32, -76}
+, {-90, 16, -48, 58}
+, {-30, -134, -4, -108}
+, {108, 153, 59, 104}
+, {-58, 53, -35, 76}
+, {-64, -66, 32, 30}
+, {72, 35, 131, 94}
+, {-64, -1, 45, 108}
+, {30, -2, 54, 22}
+, {60, 6, 6, -48}
+, {-68, -9, -81, -22}
+, {84, 30, 42, -12}
+, {-58, 7, -95, -30}
+, {26, 27, -13, -12}
+, {2, -44, -8, -54}
+, {10, -16, -20, -46}
+, {36, -22, 26, -32}
+, {102, 28, -32, -106}
+, {82, 72, -16, -26}
+, {74, 26, -12, -60}
+, {-94, -100, -76, -82}
+, {-46, -68, 30, 8}
+, {98, 72, -22, -48}
+, {12, 34, -44, -22}
+, {82, 14, 98, 30}
+, {-24, -61, 3, -34}
+, {28, 30, 90, 92}
+, {90, 63, 55, 28}
+, {18, 1, -79, -96}
+, {-16, -35, 5, -14}
+, {108, 4, 114, 10}
+, {-78, -54, -50, -26}
+, {-30, -64, -62, -96}
+, {90, 85, 107, 102}
+, {92, 57, 37, 2}
+, {64, 51, 55, 42}
+, {-76, -41, -19, 16}
+, {102, 29, -19, -92}
+, {-80, -52, -28, 0}
+, {98, 34, 90, 26}
+, {-38, -85, 13, -34}
+, {48, 52, 28, 32}
+, {108, 84, 116, 92}
+, {18, -31, 53, 4}
+, {94, -10, 60, -44}
+, {-48, -72, -48, -72}
+, {-90, 23, -71, 42}
+, {-82, -24, -58, 0}
+, {-68, -26, 14, 56}
+, {-44, -51, 17, 10}
+, {-48, -42, -44, -38}
+, {76, 33, 101, 58}
+, {-68, -78, -78, -88}
+, {80, 49, 13, -18}
+, {-16, 13, -67, -38}
+, {24, -28, 8, -44}
+, {-6, -68, -38, -100}
+, {-16, -29, -101, -114}
+, {56, 17, 123, 84}
+, {80, 97, -1, 16}
+, {16, 14, 42, 40}
+, {52, 46, -20, -26}
+, {-82, -97, -27, -42}
+, {-40, -55, -45, -60}
+}
+, {{2, -18, -52, -72}
+, {-30, -41, -5, -16}
+, {0, 23, 41, 64}
+, {84, 100, 22, 38}
+, {52, 42, 104, 94}
+, {-66, -48, 38, 56}
+, {6, 35, -3, 26}
+, {-30, 3, 39, 72}
+, {6, 32, -10, 16}
+, {84, 102, 92, 110}
+, {-20, 45, -7, 58}
+, {-50, -15, -11, 24}
+, {-44, -54, 28, 18}
+, {-102, -58, -40, 4}
+, {-92, -72, -98, -78}
+, {78, -30, 24, -84}
+, {-68, -15, -91, -38}
+, {-58, -100, -30, -72}
+, {26, 85, -7, 52}
+, {-24, -51, -27, -54}
+, {26, 80, -12, 42}
+, {-94, -96, -88, -90}
+, {-74, 16, -84, 6}
+, {-44, -11, 33, 66}
+, {84, 134, 22, 72}
+, {-20, 32, 18, 70}
+, {-2, 91, -13, 80}
+, {-58, 23, -11, 70}
+, {-30, 16, -34, 12}
+, {-14, 25, -11, 28}
+, {-18, -72, 56, 2}
+, {-50, -15, 47, 82}
+, {78, 136, 30, 88}
+, {104, 46, 66, 8}
+, {-58, -103, -27, -72}
+, {-74, -48, 48, 74}
+, {30, 3, 105, 78}
+, {16, -31, 47, 0}
+, {-52, 23, 9, 84}
+, {-104, -39, -101, -36}
+, {-50, -33, -25, -8}
+, {94, 67, 51, 24}
+, {48, 27, 27, 6}
+, {102, 36, -26, -92}
+, {-42, 28, 32, 102}
+, {-60, -76, -38, -54}
+, {94, 24, 16, -54}
+, {-4, 83, -9, 78}
+, {8, -9, 91, 74}
+, {26, 26, 52, 52}
+, {8, -95, 7, -96}
+, {102, 71, 9, -22}
+, {-24, -68, 0, -44}
+, {-80, -75, -77, -72}
+, {10, 9, -19, -20}
+, {42, 48, 14, 20}
+, {-66, -53, -15, -2}
+, {-40, 29, -73, -4}
+, {-32, 1, 61, 94}
+, {82, 56, -40, -66}
+, {76, 38, 28, -10}
+, {-30, -21, 53, 62}
+, {30, 81, -27, 24}
+, {-76, -101, -37, -62}
+}
+, {{-54, -24, -104, -74}
+, {-56, -81, -1, -26}
+, {-78, 9, -9, 78}
+, {24, -20, 38, -6}
+, {-2, 3, 3, 8}
+, {-22, -38, -92, -108}
+, {48, 27, -47, -68}
+, {-100, -48, -98, -46}
+, {-68, -72, -90, -94}
+, {-40, 2, -72, -30}
+, {-114, -107, 1, 8}
+, {18, -5, 67, 44}
+, {-86, -94, -70, -78}
+, {106, 23, 103, 20}
+, {60, -60, 42, -78}
+, {-68, -55, -7, 6}
+, {-12, 64, 4, 80}
+, {28, 24, 74, 70}
+, {-54, -73, -85, -104}
+, {-42, -86, 0, -44}
+, {-66, -55, 1, 12}
+, {-22, 42, -24, 40}
+, {-16, -3, -3, 10}
+, {66, 36, -10, -40}
+, {-50, 8, -10, 48}
+, {32, 67, -29, 6}
+, {-124, -5, -77, 42}
+, {-24, 2, 66, 92}
+, {-54, 18, -84, -12}
+, {-30, -20, -86, -76}
+, {26, 34, -26, -18}
+, {38, -3, 19, -22}
+, {-26, 7, -27, 6}
+, {84, -34, 38, -80}
+, {-132, -24, -64, 44}
+, {-78, -36, -16, 26}
+, {-82, -31, 5, 56}
+, {64, 54, -44, -54}
+, {-18, -5, -13, 0}
+, {-14, -53, -29, -68}
+, {20, 10, -22, -32}
+, {44, -1, -15, -60}
+, {-14, 67, -23, 58}
+, {20, -28, -10, -58}
+, {-8, 0, -46, -38}
+, {80, -35, 69, -46}
+, {-52, 62, -14, 100}
+, {90, 9, 81, 0}
+, {-36, 52, 8, 96}
+, {28, 74, 30, 76}
+, {104, 33, 23, -48}
+, {98, 101, 81, 84}
+, {20, 23, -3, 0}
+, {24, -44, 12, -56}
+, {56, 77, -17, 4}
+, {68, 23, -65, -110}
+, {-28, -48, 42, 22}
+, {-84, -9, -63, 12}
+, {-50, -15, 23, 58}
+, {-28, -29, 23, 22}
+, {-112, -84, 14, 42}
+, {48, 38, 14, 4}
+, {62, 33, -9, -38}
+, {24, 0, 88, 64}
+}
+, {{20, -13, 13, -20}
+, {92, 34, -2, -60}
+, {-50, -28, -8, 14}
+, {70, -5, -1, -76}
+, {34, 53, 53, 72}
+, {62, 39, -41, -64}
+, {-98, -91, -75, -68}
+, {-40, 42, 26, 108}
+, {18, 25, -55, -48}
+, {26, 60, -14, 20}
+, {26, -5, 93, 62}
+, {18, 14, -36, -40}
+, {-68, -15, -77, -24}
+, {-64, 36, -44, 56}
+, {-56, -80, 4, -20}
+, {-2, 37, -39, 0}
+, {104, 95, 93, 84}
+, {44, 27, -31, -48}
+, {-78, -39, -105, -66}
+, {-16, 74, -22, 68}
+, {32, -25, -45, -102}
+, {102, 37, 87, 22}
+, {-36, -1, -89, -54}
+, {-86, -95, -19, -28}
+, {34, -62, 12, -84}
+, {84, 76, 32, 24}
+, {56, 87, 47, 78}
+, {52, -14, 36, -30}
+, {66, 140, 24, 98}
+, {-66, -75, -101, -110}
+, {72, 35, -17, -54}
+, {154, 148, 96, 90}
+, {-100, -38, -106, -44}
+, {-70, -39, -25, 6}
+, {70, -11, 63, -18}
+, {-50, -41, 67, 76}
+, {38, 61, 15, 38}
+, {-16, -68, -46, -98}
+, {-60, -12, 26, 74}
+, {4, 62, -12, 46}
+, {-84, -76, -92, -84}
+, {-26, -5, 45, 66}
+, {2, -36, -12, -50}
+, {92, 1, 15, -76}
+, {-68, -1, 3, 70}
+, {-16, -55, -29, -68}
+, {-94, -78, -106, -90}
+, {-56, 26, 14, 96}
+, {-64, 59, 7, 130}
+, {-84, 65, -45, 104}
+, {14, 40, -20, 6}
+, {128, 119, 27, 18}
+, {-54, -9, 27, 72}
+, {-98, -84, -10, 4}
+, {10, 40, 50, 80}
+, {26, 87, 25, 86}
+, {10, 6, 100, 96}
+, {128, 110, 154, 136}
+, {-54, 15, 63, 132}
+, {-60, 52, -44, 68}
+, {-20, 5, -27, -2}
+, {-94, 1, -51, 44}
+, {-28, -64, -50, -86}
+, {62, 78, 24, 40}
+}
+, {{126, 175, 67, 116}
+, {84, 55, 65, 36}
+, {54, 15, 71, 32}
+, {-90, -40, -126, -76}
+, {-56, -43, -11, 2}
+, {-54, -123, -9, -78}
+, {-16, -56, -4, -44}
+, {-112, -40, 26, 98}
+, {12, -12, -22, -46}
+, {40, 72, -26, 6}
+, {26, 71, 1, 46}
+, {12, 3, -95, -104}
+, {-104, -60, -36, 8}
+, {82, 116, 68, 102}
+, {8, -19, 3, -24}
+, {76, 63, 49, 36}
+, {52, 65, 15, 28}
+, {20, 41, 41, 62}
+, {60, -19, -1, -80}
+, {-56, -6, 44, 94}
+, {-28, 14, -22, 20}
+, {104, 33, -65, -136}
+, {4, 10, 18, 24}
+, {34, 85, -13, 38}
+, {0, -16, -36, -52}
+, {6, -55, 11, -50}
+, {-16, -19, -9, -12}
+, {-80, -51, -39, -10}
+, {-10, -28, -18, -36}
+, {-82, -60, -74, -52}
+, {76, 48, 16, -12}
+, {-70, 6, -24, 52}
+, {-80, -15, -67, -2}
+, {-78, -63, -17, -2}
+, {30, -4, 60, 26}
+, {12, 75, 7, 70}
+, {-54, 1, -25, 30}
+, {-78, -87, -45, -54}
+, {72, 91, 49, 68}
+, {90, 32, 80, 22}
+, {78, 57, -27, -48}
+, {-76, -46, -30, 0}
+, {44, 34, 0, -10}
+, {68, 31, -37, -74}
+, {-66, -47, -65, -46}
+, {-78, -36, -60, -18}
+, {-48, -45, -73, -70}
+, {62, -26, 20, -68}
+, {-32, -35, 11, 8}
+, {56, 16, -10, -50}
+, {16, -43, -17, -76}
+, {52, 30, -54, -76}
+, {-78, -69, -87, -78}
+, {-40, 53, -51, 42}
+, {106, 56, 8, -42}
+, {58, -12, 70, 0}
+, {36, 10, -54, -80}
+, {0, 56, -18, 38}
+, {-34, -60, -18, -44}
+, {30, 59, 57, 86}
+, {0, 9, -69, -60}
+, {-46, -21, 41, 66}
+, {90, -4, 52, -42}
+, {44, -49, 41, -52}
+}
+, {{16, 77, -9, 52}
+, {-54, -63, -63, -72}
+, {-8, 46, -56, -2}
+, {66, 31, 59, 24}
+, {-2, -63, 15, -46}
+, {-58, -25, -33, 0}
+, {-68, -37, 59, 90}
+, {0, 91, 1, 92}
+, {-8, 13, -67, -46}
+, {-16, 0, 26, 42}
+, {2, -12, 50, 36}
+, {76, 12, 14, -50}
+, {72, 96, 62, 86}
+, {-56, -33, -57, -34}
+, {-2, -7, -41, -46}
+, {106, 16, -4, -94}
+, {10, -29, -63, -102}
+, {-26, 49, -7, 68}
+, {-76, 8, 4, 88}
+, {60, 25, 89, 54}
+, {-98, 0, 0, 98}
+, {-24, 29, -71, -18}
+, {50, -35, 45, -40}
+, {-102, 10, -14, 98}
+, {-48, 75, -25, 98}
+, {6, -11, 33, 16}
+, {46, 22, 70, 46}
+, {-82, 4, -62, 24}
+, {90, 33, -21, -78}
+, {0, -69, -17, -86}
+, {-70, -16, -50, 4}
+, {76, -12, 22, -66}
+, {18, 44, 12, 38}
+, {14, 9, 15, 10}
+, {-42, 66, 10, 118}
+, {26, 54, 82, 110}
+, {90, 41, 21, -28}
+, {-2, 10, -76, -64}
+, {32, 17, 73, 58}
+, {28, 10, -52, -70}
+, {-6, -21, 55, 40}
+, {92, -10, 12, -90}
+, {-96, -56, -84, -44}
+, {12, -24, 36, 0}
+, {-88, 20, -70, 38}
+, {-12, -96, -16, -100}
+, {32, 65, 1, 34}
+, {66, -14, 34, -46}
+, {-24, 6, -92, -62}
+, {-4, -47, -39, -82}
+, {-102, -75, -7, 20}
+, {-40, -91, -47, -98}
+, {46, 61, -25, -10}
+, {64, -36, 26, -74}
+, {-94, -15, -37, 42}
+, {32, 48, -56, -40}
+, {20, 33, -7, 6}
+, {-62, -68, -22, -28}
+, {-150, -124, -20, 6}
+, {-96, -86, -22, -12}
+, {76, 3, -23, -96}
+, {-6, -12, -26, -32}
+, {40, 8, 48, 16}
+, {-40, -47, -51, -58}
+}
+, {{8, -69, -15, -92}
+, {-66, 1, 39, 106}
+, {40, 30, 94, 84}
+, {-22, 10, -52, -20}
+, {-12, 71, -25, 58}
+, {-76, -104, 6, -22}
+, {-52, 1, 11, 64}
+, {-82, -90, -94, -102}
+, {68, 32, -26, -62}
+, {-22, 2, -130, -106}
+, {2, -18, 36, 16}
+, {20, 58, 44, 82}
+, {78, 8, -2, -72}
+, {106, 152, 70, 116}
+, {90, 107, 57, 74}
+, {-58, -79, -1, -22}
+, {-104, -88, -92, -76}
+, {48, 67, 37, 56}
+, {10, 49, 71, 110}
+, {16, -9, 65, 40}
+, {72, 28, 44, 0}
+, {54, 4, 98, 48}
+, {68, 103, 71, 106}
+, {64, 51, 7, -6}
+, {-88, -66, -90, -68}
+, {-14, -6, 28, 36}
+, {80, 41, 123, 84}
+, {-100, -19, -27, 54}
+, {8, -101, 5, -104}
+, {2, 47, -29, 16}
+, {94, 69, 127, 102}
+, {-22, -62, -40, -80}
+, {6, 38, 50, 82}
+, {62, 40, 34, 12}
+, {28, 77, 5, 54}
+, {-18, -11, -1, 6}
+, {22, 86, 24, 88}
+, {-54, -55, -59, -60}
+, {2, -1, 41, 38}
+, {-2, 12, 64, 78}
+, {-60, -55, -73, -68}
+, {-76, -9, -49, 18}
+, {34, 49, -47, -32}
+, {14, -34, 6, -42}
+, {60, -5, 11, -54}
+, {-60, -16, -18, 26}
+, {-56, -75, -75, -94}
+, {0, -52, -52, -104}
+, {-18, -35, 7, -10}
+, {6, 76, -14, 56}
+, {-36, 4, -12, 28}
+, {-38, 7, 39, 84}
+, {-98, -93, -59, -54}
+, {106, 95, 117, 106}
+, {-70, -57, 11, 24}
+, {14, 19, 15, 20}
+, {52, 18, 60, 26}
+, {-110, -68, -46, -4}
+, {-64, 2, -90, -24}
+, {60, 39, 5, -16}
+, {20, 8, 4, -8}
+, {-60, -99, -47, -86}
+, {-26, 14, -54, -14}
+, {52, 1, 61, 10}
+}
+, {{10, -10, -26, -46}
+, {-4, 31, -65, -30}
+, {0, -6, 46, 40}
+, {110, 151, 79, 120}
+, {38, -16, 52, -2}
+, {-58, -30, 42, 70}
+, {-64, -53, -49, -38}
+, {4, -12, -10, -26}
+, {56, -29, 65, -20}
+, {36, 48, 58, 70}
+, {40, -41, -3, -84}
+, {-66, -8, -4, 54}
+, {-52, 56, -46, 62}
+, {-36, -62, -16, -42}
+, {128, 86, -34, -76}
+, {-44, -28, 2, 18}
+, {-8, -74, -8, -74}
+, {108, 164, 108, 164}
+, {6, -1, 91, 84}
+, {82, 37, 3, -42}
+, {26, 38, -34, -22}
+, {-22, -8, 8, 22}
+, {-2, 46, -26, 22}
+, {96, -33, 47, -82}
+, {-42, 15, -67, -10}
+, {42, 56, 20, 34}
+, {70, 45, -33, -58}
+, {98, 10, 10, -78}
+, {-104, -131, -35, -62}
+, {120, 8, 18, -94}
+, {104, 29, 53, -22}
+, {-72, -57, -55, -40}
+, {-80, -55, 33, 58}
+, {-48, -32, 24, 40}
+, {-68, -4, -66, -2}
+, {4, 95, 31, 122}
+, {60, -35, 57, -38}
+, {36, 37, 83, 84}
+, {-40, -6, 24, 58}
+, {70, 86, 6, 22}
+, {106, 98, 104, 96}
+, {-46, -44, -92, -90}
+, {-100, -81, -43, -24}
+, {48, 35, 37, 24}
+, {-32, 98, -22, 108}
+, {30, 29, 57, 56}
+, {-60, -98, -36, -74}
+, {90, 88, 12, 10}
+, {-42, -3, 5, 44}
+, {-72, -95, -61, -84}
+, {84, 89, 27, 32}
+, {4, 7, 11, 14}
+, {88, 40, 114, 66}
+, {130, 97, -15, -48}
+, {-70, -20, -12, 38}
+, {-36, 107, -9, 134}
+, {-74, 28, -8, 94}
+, {-38, -1, -39, -2}
+, {136, 43, 41, -52}
+, {-64, -40, -48, -24}
+, {44, 18, 40, 14}
+, {-2, -34, 72, 40}
+, {62, -68, 24, -106}
+, {110, 46, 140, 76}
+}
+, {{26, -16, 66, 24}
+, {50, 49, -59, -60}
+, {50, -1, 31, -20}
+, {-30, -73, -31, -74}
+, {-14, 90, -10, 94}
+, {18, 32, 20, 34}
+, {20, -5, 71, 46}
+, {-52, 25, -33, 44}
+, {-102, -57, -61, -16}
+, {-60, -37, -83, -60}
+, {-32, -28, -44, -40}
+, {22, 17, 57, 52}
+, {30, -81, 9, -102}
+, {-44, 60, -86, 18}
+, {92, 61, 41, 10}
+, {116, 88, 68, 40}
+, {58, 37, -37, -58}
+, {70, 77, 15, 22}
+, {-84, -27, -57, 0}
+, {96, -1, 19, -78}
+, {2, -20, -34, -56}
+, {-104, -168, -58, -122}
+, {22, -37, 23, -36}
+, {-52, 7, 11, 70}
+, {-64, -67, -45, -48}
+, {50, 73, 29, 52}
+, {134, 187, 91, 144}
+, {104, 61, 17, -26}
+, {-62, -31, 53, 84}
+, {24, 48, 36, 60}
+, {132, 94, 30, -8}
+, {-68, -8, 14, 74}
+, {102, 80, 22, 0}
+, {-52, 30, -44, 38}
+, {-54, -77, -37, -60}
+, {20, 14, -54, -60}
+, {82, 32, 118, 68}
+, {-10, 28, -52, -14}
+, {28, 19, 47, 38}
+, {-2, 73, 7, 82}
+, {-20, 23, 1, 44}
+, {-68, -26, 8, 50}
+, {-58, -42, 30, 46}
+, {86, 9, 27, -50}
+, {84, 110, -18, 8}
+, {14, -105, 9, -110}
+, {12, 80, 26, 94}
+, {-68, -16, -40, 12}
+, {30, 68, -8, 30}
+, {-2, 15, -31, -14}
+, {-66, 19, -57, 28}
+, {8, -6, 16, 2}
+, {82, 80, 44, 42}
+, {-104, -57, 39, 86}
+, {126, 85, 145, 104}
+, {10, -15, -15, -40}
+, {-32, -94, -30, -92}
+, {20, -39, 57, -2}
+, {-18, 79, 13, 110}
+, {-10, -45, 35, 0}
+, {-42, -62, 2, -18}
+, {-92, -50, -92, -50}
+, {-12, 36, -30, 18}
+, {-68, 2, -14, 56}
+}
+, {{-24, -70, -4, -50}
+, {-26, -59, -33, -66}
+, {-8, -8, 66, 66}
+, {92, 24, 108, 40}
+, {92, 5, 69, -18}
+, {70, 103, 11, 44}
+, {-22, 37, -31, 28}
+, {-40, -25, -111, -96}
+, {-32, -45, 17, 4}
+, {8, 2, -30, -36}
+, {44, -23, -15, -82}
+, {18, -46, -10, -74}
+, {-4, -19, -7, -22}
+, {-66, -84, 16, -2}
+, {-108, -41, -37, 30}
+, {18, -28, -48, -94}
+, {-46, -16, -108, -78}
+, {78, 68, 130, 120}
+, {-50, -49, -3, -2}
+, {94, -25, 39, -80}
+, {-82, 24, -74, 32}
+, {-6, -36, -76, -106}
+, {90, 70, 52, 32}
+, {-94, -93, 15, 16}
+, {12, -29, -25, -66}
+, {88, 33, -29, -84}
+, {-66, -31, -45, -10}
+, {-90, -19, -51, 20}
+, {-48, 39, -41, 46}
+, {-84, 37, -41, 80}
+, {-66, 14, -70, 10}
+, {-120, -29, -39, 52}
+, {-40, 40, 12, 92}
+, {70, 16, -62, -116}
+, {26, 65, 25, 64}
+, {18, 55, 35, 72}
+, {-24, -8, -34, -18}
+, {-24, 50, -40, 34}
+, {-54, -91, -21, -58}
+, {20, 35, 49, 64}
+, {-28, 65, -25, 68}
+, {0, -29, -51, -80}
+, {-38, -46, -48, -56}
+, {-32, 30, -82, -20}
+, {46, -27, 63, -10}
+, {48, 44, -66, -70}
+, {-2, 12, 92, 106}
+, {-116, -92, -120, -96}
+, {0, -33, -57, -90}
+, {-16, -17, -51, -52}
+, {80, 29, 45, -6}
+, {-96, -26, -44, 26}
+, {94, 0, 18, -76}
+, {66, 79, 65, 78}
+, {-16, 15, 33, 64}
+, {88, 40, 42, -6}
+, {-4, 82, -4, 82}
+, {-34, -50, -70, -86}
+, {-66, -58, -74, -66}
+, {-54, -83, -53, -82}
+, {-18, -1, -23, -6}
+, {2, 28, 0, 26}
+, {-10, -53, -25, -68}
+, {0, 33, 1, 34}
+}
+, {{72, 54, 120, 102}
+, {76, 92, 36, 52}
+, {50, 77, 37, 64}
+, {100, -33, 69, -64}
+, {50, -27, 81, 4}
+, {16, 3, -79, -92}
+, {-64, 50, -56, 58}
+, {54, -20, 66, -8}
+, {114, 73, -5, -46}
+, {-30, 18, 20, 68}
+, {-20, -29, -79, -88}
+, {20, 29, 69, 78}
+, {14, 82, 8, 76}
+, {90, -9, 9, -90}
+, {64, 66, 22, 24}
+, {-38, 18, 6, 62}
+, {110, 86, 16, -8}
+, {-46, 28, -70, 4}
+, {-54, -19, -51, -16}
+, {78, 79, 99, 100}
+, {2, 37, 31, 66}
+, {-38, 35, -31, 42}
+, {50, 25, 121, 96}
+, {-38, 30, -58, 10}
+, {90, 43, 59, 12}
+, {80, 8, 56, -16}
+, {10, 7, -13, -16}
+, {40, 31, -23, -32}
+, {60, -36, 44, -52}
+, {-64, -13, -41, 10}
+, {-78, -43, -19, 16}
+, {-108, -80, -26, 2}
+, {-20, -37, -39, -56}
+, {-16, -39, -47, -70}
+, {74, -14, 6, -82}
+, {-82, -109, -31, -58}
+, {30, -19, -23, -72}
+, {82, 105, 7, 30}
+, {26, -8, 6, -28}
+, {-100, -13, -101, -14}
+, {14, 70, -38, 18}
+, {34, -57, 41, -50}
+, {62, 83, 63, 84}
+, {-38, 10, 12, 60}
+, {-82, -70, -102, -90}
+, {-70, -10, -106, -46}
+, {-84, -81, -75, -72}
+, {32, -3, -53, -88}
+, {22, -7, 27, -2}
+, {40, 43, 73, 76}
+, {-2, -96, -8, -102}
+, {42, 47, -17, -12}
+, {82, -31, 7, -106}
+, {92, 100, -8, 0}
+, {-74, -85, -3, -14}
+, {34, -4, 6, -32}
+, {-72, -70, -106, -104}
+, {-10, -10, -60, -60}
+, {-80, -102, -94, -116}
+, {-76, -31, 53, 98}
+, {108, 24, 126, 42}
+, {-32, 13, -27, 18}
+, {70, 87, 49, 66}
+, {-8, -73, 3, -62}
+}
+, {{66, 67, 49, 50}
+, {102, 22, -14, -94}
+, {110, 160, 68, 118}
+, {70, 42, 76, 48}
+, {-20, -16, -16, -12}
+, {-94, 32, -28, 98}
+, {-26, 28, 24, 78}
+, {50, 26, -58, -82}
+, {84, 35, 115, 66}
+, {44, 47, 69, 72}
+, {84, -19, 61, -42}
+, {28, 22, 32, 26}
+, {-28, 2, -80, -50}
+, {-76, -21, 23, 78}
+, {102, 74, 60, 32}
+, {-68, 39, -23, 84}
+, {38, -47, 39, -46}
+, {46, 83, 51, 88}
+, {48, -22, 62, -8}
+, {-58, 13, -35, 36}
+, {26, 12, 52, 38}
+, {-12, -49, -39, -76}
+, {10, -43, 49, -4}
+, {46, -15, 67, 6}
+, {118, 76, 16, -26}
+, {68, 114, 24, 70}
+, {-116, -107, -73, -64}
+, {62, -4, 96, 30}
+, {-8, -12, -40, -44}
+, {38, 62, 60, 84}
+, {-40, -49, -81, -90}
+, {34, -67, 13, -88}
+, {74, 24, -24, -74}
+, {-48, -33, -129, -114}
+, {88, 76, -14, -26}
+, {0, -11, -71, -82}
+, {-28, -3, 73, 98}
+, {-88, -40, -36, 12}
+, {68, 95, 3, 30}
+, {-40, -21, -105, -86}
+, {-30, -78, -28, -76}
+, {-104, -98, -88, -82}
+, {10, 18, -20, -12}
+, {-28, -10, 68, 86}
+, {-78, 29, -47, 60}
+, {-44, 14, -20, 38}
+, {72, 116, 44, 88}
+, {-100, -90, -72, -62}
+, {20, -13, 19, -14}
+, {60, 57, 45, 42}
+, {30, 21, 105, 96}
+, {-102, -128, -60, -86}
+, {-80, -42, -80, -42}
+, {52, 16, 88, 52}
+, {96, 83, 111, 98}
+, {94, 8, 40, -46}
+, {0, 25, 25, 50}
+, {-56, -62, -40, -46}
+, {90, 72, -38, -56}
+, {24, 15, 43, 34}
+, {-78, -72, -112, -106}
+, {-2, 11, 41, 54}
+, {-24, 23, -39, 8}
+, {20, 39, 63, 82}
+}
+, {{-62, -54, -14, -6}
+, {-20, 0, -20, 0}
+, {-52, 11, -55, 8}
+, {-80, -6, -94, -20}
+, {-88, -89, -83, -84}
+, {-28, -82, -26, -80}
+, {-60, 4, 20, 84}
+, {-18, -40, 30, 8}
+, {-64, -61, -71, -68}
+, {128, 97, 31, 0}
+, {116, 150, -16, 18}
+, {28, 82, 0, 54}
+, {106, 42, 142, 78}
+, {-30, -37, -67, -74}
+, {84, 50, 106, 72}
+, {80, 10, 110, 40}
+, {12, 26, -50, -36}
+, {88, 36, 44, -8}
+, {50, 102, 16, 68}
+, {58, 4, 10, -44}
+, {-96, -90, -92, -86}
+, {8, -64, 12, -60}
+, {-16, 51, -47, 20}
+, {64, 140, 118, 194}
+, {-24, 37, 17, 78}
+, {-6, 33, 17, 56}
+, {-26, 40, -10, 56}
+, {-28, -32, -72, -76}
+, {-62, -92, 36, 6}
+, {94, 96, 10, 12}
+, {34, 6, 102, 74}
+, {104, 86, 24, 6}
+, {-96, -44, -54, -2}
+, {-34, -24, -84, -74}
+, {138, 181, -5, 38}
+, {0, -88, 28, -60}
+, {20, -28, -22, -70}
+, {-36, -56, -12, -32}
+, {-34, 1, -35, 0}
+, {-76, -54, -98, -76}
+, {18, 15, 53, 50}
+, {-48, 8, -44, 12}
+, {-4, -86, 22, -60}
+, {64, 41, 35, 12}
+, {-82, -32, -102, -52}
+, {84, -2, 94, 8}
+, {-2, 4, 70, 76}
+, {90, 35, -21, -76}
+, {-8, 46, -78, -24}
+, {-6, -35, 61, 32}
+, {50, -6, 2, -54}
+, {68, 26, -18, -60}
+, {-54, -12, -76, -34}
+, {102, 6, 70, -26}
+, {-18, 28, -76, -30}
+, {-26, 4, -98, -68}
+, {-50, 73, -47, 76}
+, {40, 63, 29, 52}
+, {-84, -126, -24, -66}
+, {-10, -17, -51, -58}
+, {-50, -34, -56, -40}
+, {-18, -11, 15, 22}
+, {0, 97, 11, 108}
+, {16, 26, 16, 26}
+}
+, {{16, -45, -9, -70}
+, {-92, -40, -24, 28}
+, {-108, -47, -93, -32}
+, {18, 17, -1, -2}
+, {24, 31, 107, 114}
+, {4, 9, -19, -14}
+, {62, 50, 48, 36}
+, {-58, -35, 7, 30}
+, {-76, -82, 6, 0}
+, {34, 47, 23, 36}
+, {6, -14, 58, 38}
+, {20, 95, 1, 76}
+, {28, 3, 61, 36}
+, {-98, -34, -126, -62}
+, {60, 71, 33, 44}
+, {-16, 57, -25, 48}
+, {56, -41, 15, -82}
+, {-108, -99, -99, -90}
+, {34, 42, -42, -34}
+, {-52, -19, -21, 12}
+, {-68, 10, 24, 102}
+, {-56, 4, -64, -4}
+, {82, 51, -7, -38}
+, {82, 31, 115, 64}
+, {-6, 47, 1, 54}
+, {-78, -77, -127, -126}
+, {108, 109, 15, 16}
+, {18, -18, -28, -64}
+, {112, 38, -24, -98}
+, {-40, -9, 35, 66}
+, {110, 52, 2, -56}
+, {-66, -94, -14, -42}
+, {-88, -43, -129, -84}
+, {-60, -41, -43, -24}
+, {-44, -50, 50, 44}
+, {50, -37, 27, -60}
+, {-32, -37, -29, -34}
+, {-4, -21, 23, 6}
+, {-66, -17, 15, 64}
+, {-36, -18, 34, 52}
+, {0, 71, -19, 52}
+, {18, 61, -17, 26}
+, {112, 52, -38, -98}
+, {0, -78, -24, -102}
+, {40, 48, 12, 20}
+, {-82, -145, -25, -88}
+, {84, 113, 3, 32}
+, {0, 2, 48, 50}
+, {-6, -10, 70, 66}
+, {44, 118, -24, 50}
+, {-22, 37, -47, 12}
+, {-24, -36, 2, -10}
+, {-2, -35, -39, -72}
+, {-114, -116, -86, -88}
+, {96, -7, 41, -62}
+, {-56, 62, -44, 74}
+, {60, 60, 114, 114}
+, {6, 57, -27, 24}
+, {0, -42, -22, -64}
+, {-80, -91, 9, -2}
+, {-4, 8, -30, -18}
+, {8, 1, -53, -60}
+, {-28, 76, -28, 76}
+, {72, -40, 48, -64}
+}
+, {{-26, -66, 6, -34}
+, {78, 22, 66, 10}
+, {46, -24, 36, -34}
+, {6, -57, 15, -48}
+, {-6, 47, -53, 0}
+, {98, 67, 67, 36}
+, {-62, -1, 37, 98}
+, {-14, 80, -36, 58}
+, {26, 94, -28, 40}
+, {-2, -81, 7, -72}
+, {68, 78, 64, 74}
+, {0, -29, 35, 6}
+, {-68, -6, -106, -44}
+, {-26, 20, -92, -46}
+, {-6, -9, 25, 22}
+, {38, 104, 36, 102}
+, {-80, -64, -52, -36}
+, {52, 36, -76, -92}
+, {-72, -44, -92, -64}
+, {-86, -74, 14, 26}
+, {-18, -22, -14, -18}
+, {-64, -53, -111, -100}
+, {-46, -77, -61, -92}
+, {-32, 8, 18, 58}
+, {-6, -102, -46, -142}
+, {96, 55, -9, -50}
+, {106, 83, 61, 38}
+, {96, 28, 28, -40}
+, {70, 34, 88, 52}
+, {50, 9, 39, -2}
+, {134, 130, 44, 40}
+, {-112, 49, -77, 84}
+, {26, -12, 48, 10}
+, {46, 101, -7, 48}
+, {16, 71, -1, 54}
+, {108, 179, 55, 126}
+, {-86, 29, -25, 90}
+, {86, 3, 65, -18}
+, {-90, -72, -140, -122}
+, {100, 39, 93, 32}
+, {-44, -60, 20, 4}
+, {30, -1, -1, -32}
+, {-60, -100, -20, -60}
+, {-56, -2, -6, 48}
+, {88, 70, -50, -68}
+, {46, -22, 34, -34}
+, {-2, -24, -72, -94}
+, {0, 43, -23, 20}
+, {-44, -20, 46, 70}
+, {-98, -91, -45, -38}
+, {6, 11, 1, 6}
+, {-26, -95, 1, -68}
+, {48, -45, 3, -90}
+, {18, 3, 13, -2}
+, {-44, 59, -23, 80}
+, {-66, -96, -38, -68}
+, {-84, -16, -30, 38}
+, {48, -14, 96, 34}
+, {28, 52, -42, -18}
+, {-18, 60, 0, 78}
+, {-52, 22, 8, 82}
+, {20, 10, -12, -22}
+, {-78, -58, 30, 50}
+, {66, 12, 26, -28}
+}
+, {{78, 99, 11, 32}
+, {32, 39, -7, 0}
+, {-12, 7, -9, 10}
+, {-54, 4, -4, 54}
+, {-96, -112, -84, -100}
+, {-116, -101, -129, -114}
+, {-76, -41, -93, -58}
+, {4, 11, 35, 42}
+, {84, 55, 15, -14}
+, {92, 80, 52, 40}
+, {-4, -11, -5, -12}
+, {-6, -47, -1, -42}
+, {-76, -34, -122, -80}
+, {-10, 0, 32, 42}
+, {14, 28, 10, 24}
+, {26, 25, -45, -46}
+, {-86, -112, -48, -74}
+, {-48, -7, -51, -10}
+, {-68, -52, 4, 20}
+, {74, 87, 19, 32}
+, {-10, -75, -41, -106}
+, {8, -22, -4, -34}
+, {104, 105, 61, 62}
+, {112, 120, 108, 116}
+, {-54, -11, 15, 58}
+, {30, -13, -23, -66}
+, {94, -23, 37, -80}
+, {92, 97, 1, 6}
+, {-48, -50, 38, 36}
+, {40, 65, 7, 32}
+, {6, -26, 50, 18}
+, {-34, -75, -1, -42}
+, {36, 31, 59, 54}
+, {-98, -58, -110, -70}
+, {120, 87, -5, -38}
+, {60, 38, 22, 0}
+, {102, 98, 108, 104}
+, {82, 77, 45, 40}
+, {-70, 10, -94, -14}
+, {4, 16, 36, 48}
+, {48, -5, -25, -78}
+, {-14, -14, 24, 24}
+, {10, -45, 53, -2}
+, {50, 53, 83, 86}
+, {100, 40, 0, -60}
+, {-10, 18, 28, 56}
+, {-36, 19, 17, 72}
+, {-54, -51, -23, -20}
+, {14, 52, 38, 76}
+, {-8, -57, -55, -104}
+, {-16, -51, 37, 2}
+, {-44, -56, 46, 34}
+, {-92, 16, -36, 72}
+, {42, 40, -36, -38}
+, {-58, -22, -2, 34}
+, {106, 22, 108, 24}
+, {62, 8, 96, 42}
+, {-74, -56, -66, -48}
+, {-112, -37, -15, 60}
+, {44, 86, -14, 28}
+, {-74, -77, -9, -12}
+, {-92, -56, -58, -22}
+, {98, 76, 86, 64}
+, {110, 45, 91, 26}
+}
+, {{46, -19, 3, -62}
+, {0, 25, -47, -22}
+, {-2, 0, 6, 8}
+, {-38, -79, 7, -34}
+, {8, -18, 60, 34}
+, {16, 3, -67, -80}
+, {84, 53, 13, -18}
+, {4, 30, 38, 64}
+, {-86, 1, -71, 16}
+, {-14, -27, -31, -44}
+, {-26, 18, -48, -4}
+, {6, 17, 25, 36}
+, {-44, -28, -34, -18}
+, {74, 52, -54, -76}
+, {-80, -41, 23, 62}
+, {-80, 41, -33, 88}
+, {8, -2, 56, 46}
+, {30, -51, 29, -52}
+, {-80, -57, -45, -22}
+, {108, 130, 64, 86}
+, {4, 6, -24, -22}
+, {96, 66, 84, 54}
+, {40, 81, 59, 100}
+, {-70, -46, 54, 78}
+, {-82, -11, -57, 14}
+, {-28, 9, -89, -52}
+, {0, -89, 23, -66}
+, {-58, -75, -57, -74}
+, {-54, 10, 8, 72}
+, {46, -18, 8, -56}
+, {88, 102, 92, 106}
+, {-42, -120, -26, -104}
+, {-32, -23, -9, 0}
+, {-76, -55, 23, 44}
+, {64, 104, 30, 70}
+, {26, 4, -32, -54}
+, {-70, 0, -8, 62}
+, {-26, 49, -45, 30}
+, {-28, -13, -9, 6}
+, {-44, -1, -37, 6}
+, {-94, 31, -25, 100}
+, {-94, -90, -82, -78}
+, {-38, 10, -26, 22}
+, {-16, -4, 96, 108}
+, {48, 52, 70, 74}
+, {34, 108, 12, 86}
+, {-42, 2, -78, -34}
+, {-14, 24, 16, 54}
+, {-58, -44, -46, -32}
+, {-6, -74, 22, -46}
+, {0, 27, -33, -6}
+, {72, -44, 24, -92}
+, {64, 52, 16, 4}
+, {94, 0, 46, -48}
+, {70, 113, 27, 70}
+, {84, 74, 60, 50}
+, {100, 140, 48, 88}
+, {-24, -73, -21, -70}
+, {-136, -35, -63, 38}
+, {-72, 21, -79, 14}
+, {8, 75, 11, 78}
+, {-18, 43, -27, 34}
+, {18, 50, -18, 14}
+, {18, 98, 24, 104}
+}
+, {{-26, -24, 66, 68}
+, {-74, -29, -51, -6}
+, {106, 106, 108, 108}
+, {-6, 19, 35, 60}
+, {100, 87, 65, 52}
+, {56, 20, -32, -68}
+, {86, 132, 42, 88}
+, {64, 32, 34, 2}
+, {94, 104, -24, -14}
+, {46, -64, 60, -50}
+, {-108, -57, 5, 56}
+, {-72, 15, -31, 56}
+, {20, 61, -27, 14}
+, {34, 5, 77, 48}
+, {-66, -54, 34, 46}
+, {16, 15, -45, -46}
+, {-8, 42, -12, 38}
+, {-86, -108, -20, -42}
+, {48, -31, 3, -76}
+, {-74, -23, -7, 44}
+, {92, 61, 139, 108}
+, {-10, -16, -52, -58}
+, {-12, 53, -17, 48}
+, {-10, -19, -17, -26}
+, {40, 74, -4, 30}
+, {86, 78, 60, 52}
+, {-48, -49, 3, 2}
+, {-16, 45, -55, 6}
+, {-22, -50, -60, -88}
+, {-102, -91, -63, -52}
+, {-18, 63, 3, 84}
+, {98, 63, 65, 30}
+, {-30, -50, 66, 46}
+, {62, 0, 78, 16}
+, {70, 91, -31, -10}
+, {-82, -25, 9, 66}
+, {-108, 33, -33, 108}
+, {-94, -80, -102, -88}
+, {-72, -17, -43, 12}
+, {92, 120, 64, 92}
+, {66, 6, 78, 18}
+, {-108, -141, -75, -108}
+, {16, -52, 50, -18}
+, {56, 21, 11, -24}
+, {6, 63, -7, 50}
+, {106, 37, 97, 28}
+, {-40, -72, -24, -56}
+, {-28, -63, -45, -80}
+, {62, 54, 34, 26}
+, {-50, -52, 46, 44}
+, {-62, -1, 5, 66}
+, {-86, -76, 12, 22}
+, {-76, -27, 13, 62}
+, {18, -26, 24, -20}
+, {-12, -29, -51, -68}
+, {-100, -56, 10, 54}
+, {-4, -48, -42, -86}
+, {-12, 52, -12, 52}
+, {-94, -68, -44, -18}
+, {-28, 72, -2, 98}
+, {6, 23, 65, 82}
+, {-30, -53, 21, -2}
+, {52, -70, 22, -100}
+, {-88, 2, -90, 0}
+}
+, {{-66, -91, -75, -100}
+, {8, 29, 23, 44}
+, {18, -5, 57, 34}
+, {60, 11, 3, -46}
+, {-102, -16, -94, -8}
+, {38, 10, 70, 42}
+, {98, 27, -21, -92}
+, {14, 35, -45, -24}
+, {-96, -62, -40, -6}
+, {-106, -109, 9, 6}
+, {-88, 50, -46, 92}
+, {-22, -41, -63, -82}
+, {46, 48, 70, 72}
+, {18, 34, 58, 74}
+, {60, 100, 30, 70}
+, {4, -2, 2, -4}
+, {32, 11, -41, -62}
+, {-48, -58, -86, -96}
+, {-36, -9, 19, 46}
+, {-18, -2, -2, 14}
+, {-22, -12, -12, -2}
+, {-12, 10, -106, -84}
+, {-74, -42, -54, -22}
+, {34, -14, -36, -84}
+, {42, 57, 57, 72}
+, {30, 76, -4, 42}
+, {-10, -14, 4, 0}
+, {80, 101, 47, 68}
+, {82, 27, -33, -88}
+, {-38, -36, 46, 48}
+, {10, 39, 17, 46}
+, {40, 28, -28, -40}
+, {6, -47, -15, -68}
+, {8, -46, 8, -46}
+, {74, 43, -29, -60}
+, {32, 26, 58, 52}
+, {54, 97, 5, 48}
+, {-2, 5, 75, 82}
+, {-14, -39, 31, 6}
+, {-56, -37, 41, 60}
+, {12, -75, 3, -84}
+, {22, 56, -18, 16}
+, {68, 72, 88, 92}
+, {-90, -127, -61, -98}
+, {-84, -64, -16, 4}
+, {0, -7, 33, 26}
+, {40, 26, -28, -42}
+, {46, 80, -6, 28}
+, {-40, 29, 51, 120}
+, {-80, -65, 1, 16}
+, {94, 86, 34, 26}
+, {68, -64, 34, -98}
+, {18, 39, -25, -4}
+, {18, 46, -60, -32}
+, {-76, -125, -63, -112}
+, {52, 50, -38, -40}
+, {24, 110, 16, 102}
+, {48, 8, -18, -58}
+, {-18, -27, -19, -28}
+, {26, -39, -31, -96}
+, {90, 27, 27, -36}
+, {96, 27, -11, -80}
+, {74, -16, 22, -68}
+, {-68, -29, 45, 84}
+}
+, {{68, 8, 64, 4}
+, {36, -41, 3, -74}
+, {120, 108, 88, 76}
+, {100, 123, 37, 60}
+, {-50, -55, -35, -40}
+, {-42, 55, -23, 74}
+, {-16, -19, 5, 2}
+, {-94, -115, -71, -92}
+, {-114, -14, -138, -38}
+, {-62, -29, 75, 108}
+, {-66, -18, 46, 94}
+, {-104, -113, -59, -68}
+, {-86, -53, 29, 62}
+, {-82, -35, -39, 8}
+, {20, 37, -61, -44}
+, {32, 1, -11, -42}
+, {36, -17, -1, -54}
+, {-50, -8, 32, 74}
+, {82, 24, 124, 66}
+, {0, 4, -46, -42}
+, {22, 13, 81, 72}
+, {10, 73, -25, 38}
+, {22, 44, 18, 40}
+, {64, -24, 8, -80}
+, {18, -5, -79, -102}
+, {126, 48, 40, -38}
+, {68, 111, 27, 70}
+, {92, -27, 63, -56}
+, {74, 55, -17, -36}
+, {-42, -9, -83, -50}
+, {94, 103, 59, 68}
+, {-68, -80, 28, 16}
+, {16, 33, 81, 98}
+, {28, -35, 57, -6}
+, {32, 78, 50, 96}
+, {78, 127, 105, 154}
+, {76, 24, -16, -68}
+, {70, 23, 67, 20}
+, {74, 122, 22, 70}
+, {82, 46, 80, 44}
+, {-106, -32, 40, 114}
+, {32, -70, 16, -86}
+, {-68, -66, -20, -18}
+, {86, -13, 1, -98}
+, {-48, -11, -41, -4}
+, {42, 29, 59, 46}
+, {-16, 46, -46, 16}
+, {-36, -81, -47, -92}
+, {22, 74, 24, 76}
+, {-138, -36, -76, 26}
+, {42, 36, 18, 12}
+, {-110, -60, -40, 10}
+, {34, 83, -15, 34}
+, {62, 50, -82, -94}
+, {100, 24, 96, 20}
+, {112, 57, 85, 30}
+, {-20, -29, -65, -74}
+, {-60, -5, -21, 34}
+, {88, 69, 85, 66}
+, {18, 35, 21, 38}
+, {34, 46, 36, 48}
+, {62, -9, 23, -48}
+, {-64, -26, 44, 82}
+, {-16, -74, 14, -44}
+}
+, {{68, -52, 16, -104}
+, {42, -11, -23, -76}
+, {24, -56, 76, -4}
+, {88, 82, 106, 100}
+, {-102, 28, -68, 62}
+, {-108, -46, -100, -38}
+, {82, 76, 108, 102}
+, {2, -76, -16, -94}
+, {-38, -99, -23, -84}
+, {44, 5, 97, 58}
+, {58, 17, -3, -44}
+, {-10, -20, -60, -70}
+, {-56, -22, 42, 76}
+, {-4, -34, 26, -4}
+, {-58, -61, 27, 24}
+, {30, 0, 8, -22}
+, {-100, -62, -90, -52}
+, {-68, -92, -84, -108}
+, {-46, 14, -14, 46}
+, {-100, -69, -103, -72}
+, {100, 77, 115, 92}
+, {-84, -70, -64, -50}
+, {38, 3, 21, -14}
+, {46, 20, 10, -16}
+, {60, 33, 101, 74}
+, {-32, -73, 41, 0}
+, {28, 37, -49, -40}
+, {16, 25, 19, 28}
+, {-16, -40, -80, -104}
+, {-62, 39, -45, 56}
+, {-88, -66, -62, -40}
+, {-108, 2, -80, 30}
+, {-90, 34, -60, 64}
+, {-2, 88, -14, 76}
+, {28, 70, 28, 70}
+, {-106, -84, -30, -8}
+, {-76, -68, -92, -84}
+, {-84, -38, 22, 68}
+, {-98, -5, -67, 26}
+, {-84, -82, -60, -58}
+, {-54, -21, -67, -34}
+, {130, 147, 25, 42}
+, {108, 103, -1, -6}
+, {-92, -43, -41, 8}
+, {106, 26, 22, -58}
+, {-30, -48, -92, -110}
+, {-68, 55, -23, 100}
+, {48, -15, 43, -20}
+, {-88, 42, -10, 120}
+, {106, 96, 110, 100}
+, {-78, 35, -23, 90}
+, {-58, -67, -109, -118}
+, {26, 38, 56, 68}
+, {-88, -59, -91, -62}
+, {-68, 44, -34, 78}
+, {-72, -72, -32, -32}
+, {-2, 51, -23, 30}
+, {-108, -30, -8, 70}
+, {-4, -10, -14, -20}
+, {20, 7, 89, 76}
+, {12, 37, 75, 100}
+, {52, 30, -34, -56}
+, {80, 77, 97, 94}
+, {-38, 57, -19, 76}
+}
+, {{-66, -47, -51, -32}
+, {26, 53, 59, 86}
+, {-42, 3, -41, 4}
+, {40, 74, 20, 54}
+, {94, 34, 116, 56}
+, {-86, -55, -23, 8}
+, {-44, -27, 13, 30}
+, {-106, -98, -98, -90}
+, {-6, 0, -28, -22}
+, {-62, 70, -30, 102}
+, {0, 50, -72, -22}
+, {130, 42, 112, 24}
+, {-14, -64, 28, -22}
+, {66, 47, 47, 28}
+, {-64, -67, -23, -26}
+, {-28, 31, 41, 100}
+, {88, -45, 49, -84}
+, {88, 89, 11, 12}
+, {-56, -19, 35, 72}
+, {90, 55, 53, 18}
+, {74, -65, 37, -102}
+, {-138, -59, -105, -26}
+, {-90, -80, 2, 12}
+, {-74, -47, 9, 36}
+, {-84, -22, -74, -12}
+, {-24, -69, -29, -74}
+, {120, 141, 71, 92}
+, {-84, -65, -61, -42}
+, {82, 63, 95, 76}
+, {-46, -36, 28, 38}
+, {-34, 51, -15, 70}
+, {56, 99, 35, 78}
+, {18, 33, -93, -78}
+, {86, 83, -15, -18}
+, {-36, -33, -1, 2}
+, {42, 92, 50, 100}
+, {30, 29, -17, -18}
+, {36, 50, -12, 2}
+, {-36, -71, -53, -88}
+, {2, 29, 89, 116}
+, {-16, -3, -19, -6}
+, {0, -27, 1, -26}
+, {12, 27, 33, 48}
+, {-56, -23, -27, 6}
+, {54, 98, 12, 56}
+, {-56, -112, -36, -92}
+, {-42, 13, -33, 22}
+, {134, 143, 51, 60}
+, {-66, -44, 16, 38}
+, {86, 41, 79, 34}
+, {62, 22, 56, 16}
+, {44, 27, -27, -44}
+, {-116, -30, -34, 52}
+, {-16, -4, -88, -76}
+, {-82, -79, -69, -66}
+, {-26, 5, 17, 48}
+, {64, -1, 47, -18}
+, {-28, -44, -38, -54}
+, {110, 150, 50, 90}
+, {-54, 22, -56, 20}
+, {24, 17, -17, -24}
+, {-84, 14, -48, 50}
+, {16, 16, -62, -62}
+, {46, 69, 23, 46}
+}
+, {{30, 14, 2, -14}
+, {46, 29, -65, -82}
+, {52, 16, 96, 60}
+, {50, 44, 24, 18}
+, {-4, 2, 82, 88}
+, {18, -17, -17, -52}
+, {-8, 66, -56, 18}
+, {96, 61, 13, -22}
+, {38, 29, -57, -66}
+, {26, 98, 30, 102}
+, {16, -14, 12, -18}
+, {46, 16, 62, 32}
+, {74, 30, 72, 28}
+, {102, 124, -2, 20}
+, {110, 83, 81, 54}
+, {-78, -19, -131, -72}
+, {-24, 15, 25, 64}
+, {46, 21, 61, 36}
+, {82, 0, 82, 0}
+, {-38, -45, 27, 20}
+, {46, 48, -26, -24}
+, {52, -35, 3, -84}
+, {-32, -105, -25, -98}
+, {-38, -31, -55, -48}
+, {-166, -122, -122, -78}
+, {72, 56, 12, -4}
+, {-2, -31, -25, -54}
+, {-82, -96, -24, -38}
+, {-4, -29, -51, -76}
+, {60, -23, 13, -70}
+, {-36, 39, 57, 132}
+, {108, 47, 153, 92}
+, {50, -15, 73, 8}
+, {78, 4, 4, -70}
+, {38, 7, 29, -2}
+, {46, 59, 9, 22}
+, {34, 42, -62, -54}
+, {100, 100, 24, 24}
+, {-40, -83, -69, -112}
+, {50, 45, -17, -22}
+, {-6, -34, -40, -68}
+, {-4, -38, 80, 46}
+, {96, 84, 12, 0}
+, {68, 35, 123, 90}
+, {104, 60, 76, 32}
+, {-50, -10, -14, 26}
+, {2, 6, 64, 68}
+, {-74, -52, 2, 24}
+, {-72, -17, -17, 38}
+, {54, -12, 10, -56}
+, {22, 16, 6, 0}
+, {-60, -97, -59, -96}
+, {-72, -52, -106, -86}
+, {50, -54, 12, -92}
+, {50, 84, 68, 102}
+, {-88, -49, -53, -14}
+, {0, -60, -14, -74}
+, {56, -32, 34, -54}
+, {84, 31, -21, -74}
+, {0, -50, -22, -72}
+, {0, 45, 67, 112}
+, {90, 51, 57, 18}
+, {62, 89, 71, 98}
+, {-58, 31, -61, 28}
+}
+, {{10, -6, -16, -32}
+, {66, -27, 5, -88}
+, {-72, 89, -11, 150}
+, {18, 46, 42, 70}
+, {-56, 42, -46, 52}
+, {48, -4, -8, -60}
+, {102, -4, 82, -24}
+, {100, 9, 107, 16}
+, {-38, -29, 15, 24}
+, {-118, -138, -58, -78}
+, {78, -18, 12, -84}
+, {90, -16, 66, -40}
+, {58, -32, 64, -26}
+, {-42, 56, -60, 38}
+, {106, 94, 46, 34}
+, {2, -2, 42, 38}
+, {0, 86, -2, 84}
+, {18, -5, 75, 52}
+, {-40, -73, -75, -108}
+, {66, 64, 48, 46}
+, {114, 122, 18, 26}
+, {-22, -9, -85, -72}
+, {-14, -16, -26, -28}
+, {-24, -97, -17, -90}
+, {6, 14, 46, 54}
+, {-6, -1, -83, -78}
+, {-36, -10, 16, 42}
+, {-22, -31, 59, 50}
+, {34, -32, 58, -8}
+, {-128, -46, -120, -38}
+, {62, 101, -13, 26}
+, {94, -10, -34, -138}
+, {-86, -122, -48, -84}
+, {-80, -101, -73, -94}
+, {40, 15, 41, 16}
+, {34, 75, 67, 108}
+, {-56, 15, -49, 22}
+, {-20, -23, -73, -76}
+, {54, 64, -10, 0}
+, {-16, -13, 13, 16}
+, {58, 59, -43, -42}
+, {-70, -95, -53, -78}
+, {-46, -91, 5, -40}
+, {116, 67, -33, -82}
+, {100, 14, 4, -82}
+, {106, 115, 11, 20}
+, {108, 43, 53, -12}
+, {66, 62, 92, 88}
+, {-42, -82, -46, -86}
+, {-50, -25, -83, -58}
+, {54, -11, -5, -70}
+, {-20, 53, -37, 36}
+, {4, -30, -56, -90}
+, {-36, 75, -1, 110}
+, {34, -28, 58, -4}
+, {-44, -76, -18, -50}
+, {-36, 62, -28, 70}
+, {72, -11, 3, -80}
+, {88, -43, 25, -106}
+, {56, -6, 58, -4}
+, {-80, -5, -1, 74}
+, {-50, -3, 55, 102}
+, {64, 5, 71, 12}
+, {90, 63, 109, 82}
+}
+, {{48, -41, 45, -44}
+, {-8, 27, 11, 46}
+, {4, -29, 15, -18}
+, {-44, -45, 19, 18}
+, {20, 54, 8, 42}
+, {-100, -86, -134, -120}
+, {44, 5, 39, 0}
+, {20, 34, 18, 32}
+, {90, -11, 69, -32}
+, {64, -4, 78, 10}
+, {98, 43, 65, 10}
+, {90, 49, 9, -32}
+, {-30, 6, -62, -26}
+, {-74, -54, -108, -88}
+, {0, -18, 22, 4}
+, {16, -19, 11, -24}
+, {82, -4, -4, -90}
+, {-134, -8, -48, 78}
+, {10, 83, -27, 46}
+, {12, 71, -9, 50}
+, {-100, -94, -104, -98}
+, {76, 74, 2, 0}
+, {4, 21, 41, 58}
+, {80, 51, 93, 64}
+, {10, 74, 16, 80}
+, {42, 66, 40, 64}
+, {74, 31, 5, -38}
+, {64, 46, -44, -62}
+, {72, -26, 52, -46}
+, {-56, -32, 62, 86}
+, {52, -11, 91, 28}
+, {96, -8, 32, -72}
+, {46, 117, 13, 84}
+, {58, -10, 74, 6}
+, {-24, 13, 77, 114}
+, {-92, -61, 5, 36}
+, {32, 85, 15, 68}
+, {26, -12, -28, -66}
+, {-44, 4, 8, 56}
+, {70, 24, 22, -24}
+, {-54, -38, -106, -90}
+, {-68, -3, -115, -50}
+, {-6, -17, 21, 10}
+, {66, 52, 60, 46}
+, {-16, 29, -41, 4}
+, {-44, -84, -32, -72}
+, {106, 64, -16, -58}
+, {74, 19, 7, -48}
+, {-82, 7, 15, 104}
+, {-30, 3, -37, -4}
+, {36, 33, 73, 70}
+, {4, 21, 11, 28}
+, {-54, -87, -65, -98}
+, {54, -28, 28, -54}
+, {48, -6, -32, -86}
+, {6, -109, 9, -106}
+, {76, 50, -30, -56}
+, {-40, -29, 11, 22}
+, {44, 4, 56, 16}
+, {72, 125, 27, 80}
+, {-46, 21, -33, 34}
+, {-90, 51, -35, 106}
+, {18, -8, 58, 32}
+, {-38, -41, -67, -70}
+}
+, {{54, -25, 43, -36}
+, {-46, -105, -33, -92}
+, {-42, -59, 45, 28}
+, {-50, 19, 27, 96}
+, {-6, 7, 83, 96}
+, {-96, -40, -52, 4}
+, {-18, -9, -73, -64}
+, {-70, 1, -83, -12}
+, {-6, 46, 10, 62}
+, {8, -26, -8, -42}
+, {-68, -133, -41, -106}
+, {88, 59, 129, 100}
+, {-100, -65, 19, 54}
+, {42, 6, 24, -12}
+, {-122, -159, -63, -100}
+, {-58, 1, -31, 28}
+, {6, 30, 42, 66}
+, {-118, -170, -14, -66}
+, {14, 96, -4, 78}
+, {68, 57, -9, -20}
+, {-90, -89, -29, -28}
+, {-86, -70, -68, -52}
+, {64, 37, 105, 78}
+, {52, 96, 6, 50}
+, {36, -9, -13, -58}
+, {-72, -54, -124, -106}
+, {-88, -28, -72, -12}
+, {-44, -16, 62, 90}
+, {-24, -61, 17, -20}
+, {16, -56, -10, -82}
+, {44, 12, 100, 68}
+, {-8, -67, -51, -110}
+, {16, -56, -18, -90}
+, {-42, -38, -52, -48}
+, {126, 0, 70, -56}
+, {-18, -91, -1, -74}
+, {-64, -82, -40, -58}
+, {74, 58, -60, -76}
+, {88, 46, 32, -10}
+, {-68, -77, -81, -90}
+, {-8, -6, -12, -10}
+, {64, 47, -15, -32}
+, {-8, 47, 29, 84}
+, {56, -21, -1, -78}
+, {74, 64, 82, 72}
+, {82, 112, 60, 90}
+, {-10, -65, -37, -92}
+, {-52, -131, -23, -102}
+, {36, 19, 19, 2}
+, {-34, 6, 42, 82}
+, {-26, -6, -88, -68}
+, {-44, -26, -70, -52}
+, {90, 55, 57, 22}
+, {-58, 24, -80, 2}
+, {-70, -2, -84, -16}
+, {-124, -136, -76, -88}
+, {34, 74, -18, 22}
+, {-30, -102, -26, -98}
+, {-62, -88, 48, 22}
+, {18, 99, 29, 110}
+, {102, 126, 14, 38}
+, {-22, -8, 84, 98}
+, {100, 132, 46, 78}
+, {-28, -4, -100, -76}
+}
+, {{66, -25, 29, -62}
+, {104, 111, 101, 108}
+, {-94, -126, -60, -92}
+, {-20, -45, 27, 2}
+, {54, -5, 7, -52}
+, {32, -11, -43, -86}
+, {0, -11, 85, 74}
+, {12, -24, -24, -60}
+, {46, -51, 15, -82}
+, {20, -68, 20, -68}
+, {-58, 51, -13, 96}
+, {108, -34, 68, -74}
+, {-66, 38, -50, 54}
+, {-36, 59, 3, 98}
+, {90, 120, 40, 70}
+, {-76, 23, -49, 50}
+, {8, 71, 15, 78}
+, {-92, -54, -48, -10}
+, {-104, -101, -83, -80}
+, {32, 79, 43, 90}
+, {-56, 24, -76, 4}
+, {20, 28, 58, 66}
+, {-16, -12, -72, -68}
+, {48, -8, 22, -34}
+, {34, -78, -24, -136}
+, {4, 17, 51, 64}
+, {-46, 34, 50, 130}
+, {40, -37, 55, -22}
+, {114, 82, 28, -4}
+, {98, 13, 111, 26}
+, {72, 57, -7, -22}
+, {-74, -54, -16, 4}
+, {74, 136, 14, 76}
+, {36, 24, 30, 18}
+, {-24, -36, -10, -22}
+, {36, 79, 3, 46}
+, {34, 104, 40, 110}
+, {42, -4, -48, -94}
+, {-4, -85, -15, -96}
+, {-28, -80, -10, -62}
+, {-92, -39, -147, -94}
+, {-78, -9, -1, 68}
+, {-10, -22, -14, -26}
+, {-82, -96, -10, -24}
+, {34, 5, 89, 60}
+, {-60, 18, -4, 74}
+, {-22, 46, -56, 12}
+, {84, 102, 48, 66}
+, {78, 44, 64, 30}
+, {2, -4, 28, 22}
+, {50, 58, -20, -12}
+, {90, 34, 82, 26}
+, {-30, -13, 41, 58}
+, {14, -37, -51, -102}
+, {26, 70, 32, 76}
+, {-38, -7, -37, -6}
+, {-10, 24, -54, -20}
+, {-80, -80, 14, 14}
+, {0, 78, -38, 40}
+, {-84, 21, -25, 80}
+, {58, -2, -32, -92}
+, {10, 34, 10, 34}
+, {-106, -53, 33, 86}
+, {-92, 16, -84, 24}
+}
+, {{26, 32, 52, 58}
+, {40, 37, 29, 26}
+, {-80, -31, -67, -18}
+, {-68, -29, 11, 50}
+, {-96, 23, -41, 78}
+, {-94, -100, -2, -8}
+, {76, 26, 68, 18}
+, {74, 62, 98, 86}
+, {14, 13, 1, 0}
+, {22, 50, 6, 34}
+, {32, 34, -60, -58}
+, {80, 62, 112, 94}
+, {-78, 5, -95, -12}
+, {10, -27, 53, 16}
+, {74, 29, 1, -44}
+, {90, -33, 33, -90}
+, {74, -5, -17, -96}
+, {-60, 87, -47, 100}
+, {-2, 4, -94, -88}
+, {26, 13, 83, 70}
+, {-28, -83, -25, -80}
+, {68, -59, 15, -112}
+, {92, 44, 32, -16}
+, {72, 52, -28, -48}
+, {76, -14, 60, -30}
+, {12, 50, 24, 62}
+, {-14, -53, -11, -50}
+, {-16, -7, -29, -20}
+, {-42, 59, -23, 78}
+, {-56, -16, 50, 90}
+, {42, -50, -40, -132}
+, {98, 5, 13, -80}
+, {78, 74, 28, 24}
+, {-20, -42, -26, -48}
+, {26, 18, 42, 34}
+, {16, 20, 94, 98}
+, {22, 72, -16, 34}
+, {90, 70, -2, -22}
+, {62, 17, -3, -48}
+, {84, 25, 87, 28}
+, {-20, -52, -20, -52}
+, {60, 91, 31, 62}
+, {-42, -42, 42, 42}
+, {-100, -25, -53, 22}
+, {94, 122, 58, 86}
+, {-46, -25, 37, 58}
+, {38, -15, 13, -40}
+, {-106, -89, -109, -92}
+, {-24, 9, -1, 32}
+, {116, 83, 123, 90}
+, {28, 61, 33, 66}
+, {0, 9, 29, 38}
+, {66, -3, 39, -30}
+, {-4, 67, -7, 64}
+, {-46, -18, -38, -10}
+, {0, 55, -57, -2}
+, {-24, -32, -6, -14}
+, {46, 35, -9, -20}
+, {-82, 55, -25, 112}
+, {-52, 34, -14, 72}
+, {56, 59, 59, 62}
+, {4, -75, -5, -84}
+, {-82, -28, -74, -20}
+, {-96, -58, -32, 6}
+}
+, {{-66, -61, -61, -56}
+, {-74, 8, 8, 90}
+, {-58, -96, -56, -94}
+, {50, -64, 18, -96}
+, {68, 18, -32, -82}
+, {62, -38, -14, -114}
+, {30, 81, -5, 46}
+, {54, 35, 53, 34}
+, {4, -31, 19, -16}
+, {-64, 44, -62, 46}
+, {-10, -103, -17, -110}
+, {84, 65, -5, -24}
+, {-52, -55, 23, 20}
+, {126, 83, -17, -60}
+, {66, 54, -36, -48}
+, {18, -15, -21, -54}
+, {-92, -116, -40, -64}
+, {48, 98, 24, 74}
+, {98, 33, 23, -42}
+, {20, -11, 37, 6}
+, {14, 3, -9, -20}
+, {-10, 43, -3, 50}
+, {-40, -31, -57, -48}
+, {102, 38, 108, 44}
+, {102, 88, 56, 42}
+, {-84, 3, -39, 48}
+, {-74, -53, -95, -74}
+, {6, -22, -58, -86}
+, {-52, -61, 13, 4}
+, {110, 88, 62, 40}
+, {26, -23, -37, -86}
+, {46, -65, 9, -102}
+, {-72, -1, -39, 32}
+, {92, -3, 67, -28}
+, {-42, -70, -4, -32}
+, {88, 52, -14, -50}
+, {70, 55, -11, -26}
+, {-96, -26, 18, 88}
+, {-2, -54, 8, -44}
+, {22, -12, -16, -50}
+, {2, -64, 44, -22}
+, {-100, -135, -49, -84}
+, {52, 4, 68, 20}
+, {92, 60, 62, 30}
+, {122, 26, 18, -78}
+, {96, 71, 1, -24}
+, {-84, -143, -47, -106}
+, {32, 42, -20, -10}
+, {92, 93, 93, 94}
+, {0, -41, -41, -82}
+, {-24, -4, 8, 28}
+, {-18, -6, -10, 2}
+, {32, -23, -39, -94}
+, {-36, -84, 12, -36}
+, {132, 75, 57, 0}
+, {10, -38, 32, -16}
+, {94, 102, 0, 8}
+, {24, -20, 26, -18}
+, {-92, -165, -45, -118}
+, {-66, -53, 11, 24}
+, {4, -66, 26, -44}
+, {28, 52, 6, 30}
+, {20, -15, -11, -46}
+, {-76, 49, -41, 84}
+}
+, {{-52, 41, -9, 84}
+, {-4, -1, 39, 42}
+, {-114, 14, -88, 40}
+, {-40, -8, 44, 76}
+, {-2, -7, -77, -82}
+, {76, 102, 22, 48}
+, {84, 111, 23, 50}
+, {-58, -73, -43, -58}
+, {-6, -60, -14, -68}
+, {-78, -101, -61, -84}
+, {-34, -48, -90, -104}
+, {52, 10, -72, -114}
+, {-86, -20, 14, 80}
+, {-64, -78, 6, -8}
+, {52, 70, -2, 16}
+, {-64, -31, 5, 38}
+, {-26, 31, 37, 94}
+, {-130, -62, -58, 10}
+, {-84, -88, -58, -62}
+, {96, 122, 2, 28}
+, {-32, 13, 3, 48}
+, {-82, -63, -97, -78}
+, {60, 98, 52, 90}
+, {86, -7, 35, -58}
+, {-56, -29, 55, 82}
+, {84, 52, 102, 70}
+, {48, -77, 21, -104}
+, {18, -26, 50, 6}
+, {-46, -34, -32, -20}
+, {-58, -46, -46, -34}
+, {78, 82, -22, -18}
+, {-34, 10, 54, 98}
+, {-86, -138, -50, -102}
+, {-34, -14, -74, -54}
+, {44, -34, 42, -36}
+, {-12, 59, -27, 44}
+, {8, -33, 13, -28}
+, {-14, 40, -42, 12}
+, {0, 16, -58, -42}
+, {-94, -29, -161, -96}
+, {-20, 67, -37, 50}
+, {32, 78, 30, 76}
+, {2, 43, 19, 60}
+, {-72, 54, -40, 86}
+, {-42, -65, 9, -14}
+, {-36, 14, 8, 58}
+, {-76, 2, -52, 26}
+, {-74, -41, -83, -50}
+, {58, -2, 68, 8}
+, {50, 74, -30, -6}
+, {-4, -55, 1, -50}
+, {122, 137, 119, 134}
+, {76, 72, 118, 114}
+, {6, -56, 20, -42}
+, {22, 44, 32, 54}
+, {-58, -48, -122, -112}
+, {60, 38, 56, 34}
+, {8, 133, -11, 114}
+, {-10, -100, 42, -48}
+, {-90, 2, 14, 106}
+, {-56, 26, -100, -18}
+, {-56, -30, -58, -32}
+, {-66, 25, -23, 68}
+, {-20, -72, -2, -54}
+}
+, {{38, -18, 34, -22}
+, {-68, 7, -5, 70}
+, {-16, -96, -28, -108}
+, {-28, -35, -95, -102}
+, {-16, 11, -41, -14}
+, {-22, -52, -30, -60}
+, {58, 39, 79, 60}
+, {-64, 13, -67, 10}
+, {26, 32, -46, -40}
+, {-96, -48, -88, -40}
+, {30, 64, 48, 82}
+, {-66, -36, 14, 44}
+, {98, 64, -26, -60}
+, {20, -64, 10, -74}
+, {118, 50, 166, 98}
+, {-2, -81, -19, -98}
+, {124, 149, 105, 130}
+, {-102, -14, -44, 44}
+, {0, 60, 54, 114}
+, {-44, 0, -66, -22}
+, {48, 72, -32, -8}
+, {-58, -129, -43, -114}
+, {10, 7, -73, -76}
+, {34, 58, -20, 4}
+, {-2, -16, -2, -16}
+, {74, 17, 111, 54}
+, {-76, -51, -41, -16}
+, {-18, 29, -25, 22}
+, {64, 121, 47, 104}
+, {-24, -92, 0, -68}
+, {-24, -19, -41, -36}
+, {-2, -74, 36, -36}
+, {18, 40, 42, 64}
+, {-50, -95, -23, -68}
+, {18, 45, -47, -20}
+, {-24, -71, -69, -116}
+, {-28, 70, 22, 120}
+, {6, 36, 56, 86}
+, {-94, 0, -116, -22}
+, {-30, -71, -51, -92}
+, {60, 7, 67, 14}
+, {38, 12, 22, -4}
+, {-80, -74, -36, -30}
+, {-30, -82, 42, -10}
+, {-12, 50, 4, 66}
+, {132, 8, 86, -38}
+, {-64, 21, -45, 40}
+, {-92, -30, 26, 88}
+, {-92, -21, -49, 22}
+, {-18, 43, -85, -24}
+, {84, 35, 69, 20}
+, {110, -25, 75, -60}
+, {100, 84, 104, 88}
+, {-42, -35, -91, -84}
+, {-4, -46, 26, -16}
+, {34, 42, 18, 26}
+, {-100, -6, -58, 36}
+, {-34, -49, -15, -30}
+, {4, -95, -25, -124}
+, {-76, -112, -34, -70}
+, {88, 121, 29, 62}
+, {-62, 4, 4, 70}
+, {-88, 12, -6, 94}
+, {52, 64, 38, 50}
+}
+, {{2, 53, -9, 42}
+, {20, 102, 12, 94}
+, {-86, 12, -66, 32}
+, {-36, -61, -35, -60}
+, {14, 8, -80, -86}
+, {-22, -17, -33, -28}
+, {32, -12, 80, 36}
+, {24, -32, -16, -72}
+, {88, 47, 133, 92}
+, {-56, 57, -59, 54}
+, {0, -22, 32, 10}
+, {20, 57, 33, 70}
+, {-2, -5, 89, 86}
+, {-28, -35, -5, -12}
+, {62, 46, 58, 42}
+, {90, 8, 56, -26}
+, {44, 11, -27, -60}
+, {30, 53, -69, -46}
+, {-92, 40, -40, 92}
+, {-24, -23, 15, 16}
+, {62, 110, 44, 92}
+, {-8, -92, -56, -140}
+, {6, 15, 63, 72}
+, {-76, -31, -1, 44}
+, {-46, -32, -26, -12}
+, {-28, 71, 11, 110}
+, {84, 0, 40, -44}
+, {24, 11, 91, 78}
+, {130, 86, 144, 100}
+, {112, 76, 88, 52}
+, {-84, 6, -88, 2}
+, {42, 10, 32, 0}
+, {36, 39, 41, 44}
+, {-14, -4, -2, 8}
+, {76, 10, -18, -84}
+, {0, -32, 20, -12}
+, {12, -9, 53, 32}
+, {-78, -39, -39, 0}
+, {-38, -27, -113, -102}
+, {28, 22, -56, -62}
+, {-36, -15, -51, -30}
+, {10, -5, -19, -34}
+, {-88, -20, 28, 96}
+, {0, 16, -34, -18}
+, {-76, 33, -65, 44}
+, {112, 28, 44, -40}
+, {-84, -71, -113, -100}
+, {-56, -46, 32, 42}
+, {60, 21, 69, 30}
+, {-26, 46, 16, 88}
+, {-96, -36, -68, -8}
+, {172, 157, 175, 160}
+, {-84, -81, -55, -52}
+, {34, -5, 39, 0}
+, {-26, 15, -3, 38}
+, {102, 70, 108, 76}
+, {0, -41, 25, -16}
+, {90, 92, -12, -10}
+, {54, 47, 51, 44}
+, {-46, -75, -55, -84}
+, {38, -38, -16, -92}
+, {88, -3, 43, -48}
+, {48, 15, 51, 18}
+, {-4, 10, 88, 102}
+}
+, {{0, 35, -79, -44}
+, {-110, -33, -3, 74}
+, {-48, -63, -59, -74}
+, {58, 87, 5, 34}
+, {76, 19, 89, 32}
+, {-96, -90, -90, -84}
+, {-80, -40, -46, -6}
+, {-10, 10, -68, -48}
+, {-2, -20, -30, -48}
+, {78, 47, 3, -28}
+, {88, 126, 74, 112}
+, {48, 77, 47, 76}
+, {-86, -136, -40, -90}
+, {64, 56, -4, -12}
+, {-44, -113, -29, -98}
+, {32, 47, -19, -4}
+, {42, 65, -25, -2}
+, {-56, -17, -31, 8}
+, {-72, -59, -107, -94}
+, {52, 53, -15, -14}
+, {-64, 16, -44, 36}
+, {-14, -52, -2, -40}
+, {74, 2, 14, -58}
+, {26, 38, -4, 8}
+, {98, -12, 42, -68}
+, {70, 83, 67, 80}
+, {144, 85, 141, 82}
+, {28, 25, -65, -68}
+, {-62, 2, -72, -8}
+, {50, -23, 33, -40}
+, {-86, 39, -39, 86}
+, {-78, -4, -30, 44}
+, {-80, -144, -50, -114}
+, {76, 26, 72, 22}
+, {4, 54, 22, 72}
+, {22, 20, -22, -24}
+, {-8, 28, 20, 56}
+, {-32, -2, 10, 40}
+, {-88, -11, -93, -16}
+, {-22, -76, -32, -86}
+, {80, 82, 94, 96}
+, {84, 47, 25, -12}
+, {94, -33, 71, -56}
+, {-6, 24, -50, -20}
+, {-40, -12, -2, 26}
+, {-56, -47, -59, -50}
+, {40, 78, 56, 94}
+, {-104, 55, -71, 88}
+, {-18, -24, 18, 12}
+, {-64, 43, -65, 42}
+, {12, 49, 39, 76}
+, {-30, -20, -4, 6}
+, {20, 30, 36, 46}
+, {2, 2, -60, -60}
+, {-84, -40, -12, 32}
+, {94, 118, 18, 42}
+, {-84, -66, -66, -48}
+, {46, 6, -54, -94}
+, {-32, -66, -82, -116}
+, {24, -10, 4, -30}
+, {26, -7, 53, 20}
+, {-4, -34, 52, 22}
+, {-90, -21, -31, 38}
+, {-16, 10, 12, 38}
+}
+, {{-48, 47, -75, 20}
+, {-68, -81, -55, -68}
+, {-134, 1, -69, 66}
+, {110, 46, 130, 66}
+, {2, 18, 76, 92}
+, {-84, -139, -61, -116}
+, {-72, -88, -58, -74}
+, {50, 32, 86, 68}
+, {40, 15, 105, 80}
+, {98, 31, 31, -36}
+, {2, -66, -8, -76}
+, {-94, -102, -60, -68}
+, {60, 23, 33, -4}
+, {68, -34, 72, -30}
+, {92, -1, 67, -26}
+, {0, -30, 78, 48}
+, {-58, 3, -3, 58}
+, {52, 76, 66, 90}
+, {-50, -76, -72, -98}
+, {-58, -6, -68, -16}
+, {-76, 5, -19, 62}
+, {48, 42, -24, -30}
+, {104, 55, 1, -48}
+, {82, 125, 21, 64}
+, {92, 118, 84, 110}
+, {-66, -125, -15, -74}
+, {38, 34, -36, -40}
+, {8, 90, -12, 70}
+, {0, -33, -85, -118}
+, {-64, -38, 2, 28}
+, {76, 28, 48, 0}
+, {-82, -49, -65, -32}
+, {-80, -23, -63, -6}
+, {22, 9, -41, -54}
+, {-34, 44, 34, 112}
+, {-84, -59, -59, -34}
+, {104, 108, 28, 32}
+, {-20, -5, 43, 58}
+, {14, 12, 86, 84}
+, {-66, -34, -90, -58}
+, {96, 85, 49, 38}
+, {-26, -31, -31, -36}
+, {88, 27, 11, -50}
+, {58, 28, -68, -98}
+, {-14, -39, -15, -40}
+, {-30, 37, -61, 6}
+, {8, 69, -27, 34}
+, {-96, -151, -53, -108}
+, {-62, -133, -37, -108}
+, {60, 93, 15, 48}
+, {-58, -70, -48, -60}
+, {6, -11, -19, -36}
+, {-26, 53, 15, 94}
+, {0, -34, 36, 2}
+, {22, 31, -33, -24}
+, {-94, -36, 2, 60}
+, {-100, 9, -67, 42}
+, {-38, -18, 30, 50}
+, {-54, -45, -25, -16}
+, {92, -16, 82, -26}
+, {94, 114, 44, 64}
+, {62, 14, 78, 30}
+, {106, 134, 52, 80}
+, {-4, -28, 66, 42}
+}
+, {{-44, -37, -57, -50}
+, {8, 34, -60, -34}
+, {-44, 58, -38, 64}
+, {-6, -48, -88, -130}
+, {-104, -20, -12, 72}
+, {96, 33, -3, -66}
+, {6, 36, 32, 62}
+, {74, -28, 42, -60}
+, {38, 28, 96, 86}
+, {-80, -84, -62, -66}
+, {44, 63, -11, 8}
+, {-32, 2, 48, 82}
+, {30, 5, -73, -98}
+, {-34, -6, 24, 52}
+, {28, 16, -12, -24}
+, {28, 23, 17, 12}
+, {92, 59, 21, -12}
+, {-76, 19, -41, 54}
+, {94, 22, 78, 6}
+, {94, 8, 44, -42}
+, {-44, 60, -30, 74}
+, {6, 59, -31, 22}
+, {-38, -52, -8, -22}
+, {-56, -18, -68, -30}
+, {-116, -42, -28, 46}
+, {-20, -70, -40, -90}
+, {-20, -107, 3, -84}
+, {-90, -9, -63, 18}
+, {100, 124, 96, 120}
+, {18, 59, 55, 96}
+, {-20, -19, 43, 44}
+, {-62, -5, -105, -48}
+, {-44, 41, -23, 62}
+, {-108, 32, -52, 88}
+, {-74, -81, 67, 60}
+, {-104, 23, -59, 68}
+, {-8, -57, 5, -44}
+, {64, 81, 63, 80}
+, {38, -14, 52, 0}
+, {102, 89, 77, 64}
+, {-66, -87, -63, -84}
+, {-4, -31, 63, 36}
+, {78, 47, -15, -46}
+, {30, 54, 6, 30}
+, {70, 50, 2, -18}
+, {110, 31, 105, 26}
+, {-40, 56, 12, 108}
+, {-82, -43, -79, -40}
+, {-70, -45, -23, 2}
+, {-62, 5, -109, -42}
+, {-48, -100, -32, -84}
+, {132, 82, 162, 112}
+, {66, 38, 96, 68}
+, {2, 13, -19, -8}
+, {-72, -48, -8, 16}
+, {-74, -61, -99, -86}
+, {38, -35, 57, -16}
+, {104, 63, 121, 80}
+, {-60, 28, -50, 38}
+, {42, -23, -9, -74}
+, {94, 34, 58, -2}
+, {42, -39, 45, -36}
+, {32, -4, -60, -96}
+, {-20, -10, -52, -42}
+}
+, {{-84, 8, 28, 120}
+, {8, -64, -14, -86}
+, {-46, -15, 51, 82}
+, {-114, -137, -87, -110}
+, {96, 77, 19, 0}
+, {100, 43, 9, -48}
+, {-44, -27, -81, -64}
+, {0, -58, 38, -20}
+, {0, 46, 54, 100}
+, {78, 99, 61, 82}
+, {-78, -80, 2, 0}
+, {-16, -95, -15, -94}
+, {-90, -57, 41, 74}
+, {-82, 6, -76, 12}
+, {60, 79, 9, 28}
+, {-22, 18, -82, -42}
+, {22, 33, 1, 12}
+, {84, 23, 111, 50}
+, {2, 12, -26, -16}
+, {84, 20, -28, -92}
+, {0, 71, -29, 42}
+, {-136, -102, -144, -110}
+, {2, -51, -21, -74}
+, {88, 114, 50, 76}
+, {-96, -6, -84, 6}
+, {110, 48, 50, -12}
+, {52, -45, 9, -88}
+, {-58, 17, -11, 64}
+, {26, -55, 13, -68}
+, {-40, 25, -85, -20}
+, {50, 49, 123, 122}
+, {22, -69, 17, -74}
+, {-100, -126, -46, -72}
+, {-48, -87, -15, -54}
+, {0, -50, 0, -50}
+, {-32, 39, -63, 8}
+, {-74, -91, 5, -12}
+, {80, 43, -55, -92}
+, {-82, -98, 6, -10}
+, {0, 6, -42, -36}
+, {12, -1, 59, 46}
+, {48, -5, 37, -16}
+, {-72, 27, -13, 86}
+, {-16, -42, -8, -34}
+, {88, -16, 86, -18}
+, {-16, 41, -15, 42}
+, {-84, -9, 23, 98}
+, {-44, -56, -98, -110}
+, {42, -15, 17, -40}
+, {136, 101, -1, -36}
+, {-42, -38, 62, 66}
+, {44, 135, 13, 104}
+, {-16, 51, -1, 66}
+, {36, -15, -13, -64}
+, {32, 44, -72, -60}
+, {-6, -24, -22, -40}
+, {52, 85, 15, 48}
+, {68, 66, -14, -16}
+, {-170, -140, -22, 8}
+, {54, 37, -67, -84}
+, {80, 7, 87, 14}
+, {12, -30, 60, 18}
+, {-54, 47, -5, 96}
+, {58, 41, 89, 72}
+}
+, {{94, 54, 118, 78}
+, {-16, -57, -9, -50}
+, {-60, -35, -133, -108}
+, {-2, 27, 49, 78}
+, {66, -60, 42, -84}
+, {4, -27, -3, -34}
+, {-2, -3, 97, 96}
+, {-96, -79, -103, -86}
+, {-70, -25, 35, 80}
+, {-34, -70, -18, -54}
+, {-44, 12, 24, 80}
+, {-50, 0, 0, 50}
+, {-66, -24, -90, -48}
+, {26, -46, 22, -50}
+, {40, 59, 63, 82}
+, {44, 38, 108, 102}
+, {-20, 105, -29, 96}
+, {120, 9, 13, -98}
+, {64, 24, -24, -64}
+, {72, -12, -8, -92}
+, {6, 3, 3, 0}
+, {56, 18, 110, 72}
+, {-40, -9, 31, 62}
+, {-76, -77, 23, 22}
+, {-10, 10, -44, -24}
+, {14, -31, -5, -50}
+, {96, 140, 74, 118}
+, {-62, 66, -18, 110}
+, {-70, 40, -58, 52}
+, {12, 19, -7, 0}
+, {-100, -109, -93, -102}
+, {-40, 56, -6, 90}
+, {-84, 49, -45, 88}
+, {118, 75, 161, 118}
+, {-84, -63, 43, 64}
+, {-56, -53, 17, 20}
+, {82, 0, 6, -76}
+, {-72, -67, -93, -88}
+, {62, -24, 28, -58}
+, {120, 40, -26, -106}
+, {58, -2, 20, -40}
+, {-34, 33, -41, 26}
+, {28, 29, 21, 22}
+, {74, 38, -20, -56}
+, {-26, -3, -101, -78}
+, {28, 50, -16, 6}
+, {50, 107, 33, 90}
+, {32, -9, 13, -28}
+, {0, -35, 107, 72}
+, {84, 46, 2, -36}
+, {8, 29, -57, -36}
+, {30, 98, 96, 164}
+, {-66, -48, -18, 0}
+, {6, -48, 78, 24}
+, {42, 72, 34, 64}
+, {72, 86, 56, 70}
+, {-64, -80, -26, -42}
+, {0, 119, -13, 106}
+, {-50, -41, -21, -12}
+, {10, 52, 2, 44}
+, {-32, -27, -97, -92}
+, {62, 64, -40, -38}
+, {-98, -120, -20, -42}
+, {82, -18, 56, -44}
+}
+, {{-52, -4, 62, 110}
+, {20, 21, 21, 22}
+, {0, -16, 34, 18}
+, {10, -45, -35, -90}
+, {34, -4, 38, 0}
+, {32, 9, 67, 44}
+, {-110, -42, -110, -42}
+, {52, 24, -40, -68}
+, {-14, -31, 39, 22}
+, {114, 39, 85, 10}
+, {82, 11, 81, 10}
+, {104, 58, -8, -54}
+, {-90, -34, -36, 20}
+, {-90, -92, -32, -34}
+, {-78, -28, -58, -8}
+, {66, 5, 67, 6}
+, {-66, -99, -11, -44}
+, {78, -26, 16, -88}
+, {34, 32, -66, -68}
+, {-98, -42, -132, -76}
+, {-56, -42, -20, -6}
+, {54, 35, 117, 98}
+, {88, 50, 30, -8}
+, {148, 36, 84, -28}
+, {36, 92, 68, 124}
+, {6, -6, -64, -76}
+, {-40, -70, -18, -48}
+, {96, 72, 110, 86}
+, {36, 28, -34, -42}
+, {-10, 84, 8, 102}
+, {50, 40, 0, -10}
+, {-10, -108, -14, -112}
+, {-20, -74, 4, -50}
+, {18, -42, -28, -88}
+, {-6, 96, -14, 88}
+, {-8, -68, -44, -104}
+, {-8, 79, -1, 86}
+, {-46, -15, -21, 10}
+, {74, 34, -10, -50}
+, {-10, 0, -48, -38}
+, {84, 60, 100, 76}
+, {-86, 2, -56, 32}
+, {46, -23, 33, -36}
+, {-92, -19, -113, -40}
+, {-80, -45, -111, -76}
+, {-18, -14, -106, -102}
+, {22, -36, -36, -94}
+, {58, 10, -52, -100}
+, {66, 31, 91, 56}
+, {26, 21, 27, 22}
+, {78, 15, 21, -42}
+, {36, 20, 8, -8}
+, {-78, 45, -43, 80}
+, {92, 131, 85, 124}
+, {92, 106, 48, 62}
+, {-80, -38, -138, -96}
+, {-76, -62, -12, 2}
+, {80, 6, -14, -88}
+, {-12, -52, -34, -74}
+, {-8, 19, 19, 46}
+, {104, 21, 107, 24}
+, {44, 119, 27, 102}
+, {42, -23, 39, -26}
+, {56, -32, 2, -86}
+}
+, {{18, -34, 24, -28}
+, {-10, -81, -27, -98}
+, {30, -42, -6, -78}
+, {2, 88, 16, 102}
+, {-98, -55, -77, -34}
+, {-2, -25, 33, 10}
+, {94, 106, 60, 72}
+, {58, 69, 37, 48}
+, {-84, 31, -13, 102}
+, {4, 49, 35, 80}
+, {48, -57, -7, -112}
+, {64, -41, 23, -82}
+, {-80, 12, -72, 20}
+, {-94, -26, 6, 74}
+, {74, 89, 35, 50}
+, {8, 16, 96, 104}
+, {88, 48, 108, 68}
+, {-2, -31, -41, -70}
+, {-72, -36, 48, 84}
+, {-36, -28, -52, -44}
+, {78, 94, 30, 46}
+, {-4, 51, 39, 94}
+, {-38, -34, -26, -22}
+, {50, -7, 45, -12}
+, {68, 43, -21, -46}
+, {-30, 58, -2, 86}
+, {-108, -107, 13, 14}
+, {56, -44, 12, -88}
+, {-32, -84, 0, -52}
+, {24, 90, -4, 62}
+, {-22, 42, -2, 62}
+, {-12, -109, 15, -82}
+, {16, -40, 88, 32}
+, {-60, -4, -54, 2}
+, {98, 100, 24, 26}
+, {-16, -5, 47, 58}
+, {-80, -95, -79, -94}
+, {112, 47, 81, 16}
+, {-84, -36, -36, 12}
+, {-30, 2, -106, -74}
+, {-76, -37, -37, 2}
+, {4, -29, 61, 28}
+, {52, 90, 42, 80}
+, {54, 85, 45, 76}
+, {56, 9, -53, -100}
+, {-12, -31, 45, 26}
+, {-34, -85, -69, -120}
+, {34, -28, -44, -106}
+, {0, -44, -48, -92}
+, {-84, -95, -95, -106}
+, {34, 61, -3, 24}
+, {-30, -34, 34, 30}
+, {10, -35, 27, -18}
+, {86, 48, 92, 54}
+, {66, 47, -23, -42}
+, {2, -52, -4, -58}
+, {-56, 42, -30, 68}
+, {72, 53, 53, 34}
+, {72, 65, 55, 48}
+, {14, 85, 27, 98}
+, {72, 58, 98, 84}
+, {-94, 4, -80, 18}
+, {-74, -73, 13, 14}
+, {54, 101, 65, 112}
+}
+, {{-42, -1, -77, -36}
+, {34, -61, 21, -74}
+, {-38, -36, -6, -4}
+, {-82, -54, -88, -60}
+, {74, 99, 87, 112}
+, {16, 21, 7, 12}
+, {-20, -44, 30, 6}
+, {64, 18, 106, 60}
+, {-18, 20, -2, 36}
+, {-2, -20, 4, -14}
+, {60, 58, 88, 86}
+, {60, -33, 7, -86}
+, {-32, -62, 12, -18}
+, {6, 35, -3, 26}
+, {82, 111, 27, 56}
+, {-110, -79, -51, -20}
+, {102, 74, 82, 54}
+, {-14, 48, -20, 42}
+, {24, -68, 28, -64}
+, {88, 133, 31, 76}
+, {94, -38, 30, -102}
+, {-92, -109, -75, -92}
+, {-46, -74, -14, -42}
+, {-68, -43, -31, -6}
+, {-50, 65, 1, 116}
+, {42, 63, -7, 14}
+, {-20, 61, -67, 14}
+, {114, 92, 20, -2}
+, {-18, 11, -23, 6}
+, {76, 85, -5, 4}
+, {-122, -45, -63, 14}
+, {102, 125, -27, -4}
+, {16, 78, 60, 122}
+, {8, 71, -13, 50}
+, {-2, 90, -12, 80}
+, {58, 43, 83, 68}
+, {-10, 11, -3, 18}
+, {-56, -47, -43, -34}
+, {102, 110, 56, 64}
+, {98, 9, 19, -70}
+, {-54, -4, -40, 10}
+, {132, 108, 38, 14}
+, {-28, 30, 14, 72}
+, {-64, 56, -30, 90}
+, {62, -9, -11, -82}
+, {38, 97, 5, 64}
+, {70, 74, 64, 68}
+, {-4, 60, 42, 106}
+, {-22, -17, -53, -48}
+, {60, 85, -39, -14}
+, {10, -23, 77, 44}
+, {-30, 42, -44, 28}
+, {-100, -28, 16, 88}
+, {46, -1, 69, 22}
+, {68, 33, 27, -8}
+, {-26, -29, 3, 0}
+, {4, -23, 79, 52}
+, {50, 51, 21, 22}
+, {70, 77, 47, 54}
+, {-92, -48, -56, -12}
+, {-98, -116, -30, -48}
+, {-36, -78, -24, -66}
+, {-44, 31, -11, 64}
+, {76, 48, 28, 0}
+}
+, {{-32, -89, -19, -76}
+, {68, 13, 53, -2}
+, {-78, -9, 3, 72}
+, {20, -17, 85, 48}
+, {-54, -3, -75, -24}
+, {40, -51, -7, -98}
+, {92, 29, 3, -60}
+, {92, 9, 89, 6}
+, {-24, -14, -22, -12}
+, {-36, -40, 4, 0}
+, {56, 50, 44, 38}
+, {68, 38, 72, 42}
+, {16, 15, -51, -52}
+, {74, 8, -10, -76}
+, {-92, -76, -16, 0}
+, {-60, -38, -86, -64}
+, {-68, -28, 2, 42}
+, {2, 21, -15, 4}
+, {86, -12, 64, -34}
+, {10, -7, 21, 4}
+, {-36, -108, -8, -80}
+, {-14, -51, 17, -20}
+, {-40, -126, -28, -114}
+, {66, -4, -4, -74}
+, {80, 109, 43, 72}
+, {-74, -47, 53, 80}
+, {4, 32, 2, 30}
+, {0, -55, 39, -16}
+, {82, 75, 75, 68}
+, {8, -11, -29, -48}
+, {-28, -58, -34, -64}
+, {98, 63, 55, 20}
+, {-56, 12, -2, 66}
+, {114, -1, 37, -78}
+, {-90, -90, -54, -54}
+, {-82, -31, -55, -4}
+, {26, 78, -16, 36}
+, {52, -57, 15, -94}
+, {-50, -74, -68, -92}
+, {-22, -80, -46, -104}
+, {-6, -22, 28, 12}
+, {18, -2, -10, -30}
+, {18, -20, -22, -60}
+, {60, 91, -9, 22}
+, {-2, 50, 10, 62}
+, {6, -39, 5, -40}
+, {-46, -108, -52, -114}
+, {92, 29, 93, 30}
+, {-14, -61, 35, -12}
+, {-60, -38, 64, 86}
+, {-24, -10, 10, 24}
+, {-50, -93, -63, -106}
+, {-58, -28, -58, -28}
+, {40, 1, 101, 62}
+, {-48, -58, -16, -26}
+, {-32, 7, 49, 88}
+, {82, 7, 79, 4}
+, {18, -86, -8, -112}
+, {-78, -29, -43, 6}
+, {56, 48, 70, 62}
+, {-16, -2, -66, -52}
+, {-16, -15, -11, -10}
+, {-78, 27, -55, 50}
+, {-80, -25, 33, 88}
+}
+, {{52, 45, 93, 86}
+, {22, 87, 39, 104}
+, {-22, 47, 17, 86}
+, {48, 87, 51, 90}
+, {10, 1, 45, 36}
+, {-68, -2, 10, 76}
+, {-96, -13, -73, 10}
+, {44, 5, 83, 44}
+, {-58, -60, -32, -34}
+, {48, -33, 47, -34}
+, {-30, -66, 0, -36}
+, {32, 41, 1, 10}
+, {66, -7, 45, -28}
+, {104, 48, 128, 72}
+, {78, 5, 45, -28}
+, {-26, 45, -17, 54}
+, {-52, -57, 11, 6}
+, {108, 92, -12, -28}
+, {18, 3, 81, 66}
+, {-58, -44, -44, -30}
+, {58, 56, 102, 100}
+, {-60, -85, -83, -108}
+, {-46, 41, -45, 42}
+, {-50, -88, -84, -122}
+, {-42, -16, 14, 40}
+, {-84, -30, -136, -82}
+, {-8, 0, 38, 46}
+, {-92, -58, -30, 4}
+, {-100, -79, 17, 38}
+, {32, 3, -55, -84}
+, {54, 71, 19, 36}
+, {90, 80, 58, 48}
+, {66, 121, 37, 92}
+, {0, -3, -21, -24}
+, {-92, -135, -19, -62}
+, {50, 101, -11, 40}
+, {-70, -18, -110, -58}
+, {66, 81, 65, 80}
+, {4, -15, 11, -8}
+, {116, 66, -6, -56}
+, {98, 92, 108, 102}
+, {-96, -74, -118, -96}
+, {76, 58, 6, -12}
+, {2, 66, 24, 88}
+, {52, 32, -50, -70}
+, {2, 36, -12, 22}
+, {20, -29, -5, -54}
+, {88, 27, -9, -70}
+, {-92, -101, -13, -22}
+, {-108, -97, -15, -4}
+, {84, 24, 0, -60}
+, {-16, 37, 43, 96}
+, {100, 63, 33, -4}
+, {38, 57, 31, 50}
+, {20, 14, 6, 0}
+, {-64, -88, -38, -62}
+, {54, -8, 36, -26}
+, {70, 86, 78, 94}
+, {86, 110, 56, 80}
+, {18, 10, 114, 106}
+, {8, -3, -53, -64}
+, {-80, -117, -59, -96}
+, {20, -46, 34, -32}
+, {94, 64, 32, 2}
+}
+, {{48, 36, 106, 94}
+, {-18, 5, 25, 48}
+, {102, 34, 88, 20}
+, {-20, -40, 4, -16}
+, {24, 19, 73, 68}
+, {88, 81, 71, 64}
+, {44, 97, 33, 86}
+, {4, -29, 39, 6}
+, {-96, -117, -51, -72}
+, {-64, -30, 64, 98}
+, {-8, 77, -7, 78}
+, {-48, -86, 10, -28}
+, {-78, 48, -28, 98}
+, {-96, -150, -58, -112}
+, {36, -16, 44, -8}
+, {60, 35, 73, 48}
+, {80, 95, 57, 72}
+, {50, 12, 90, 52}
+, {-26, -74, -10, -58}
+, {-72, -103, -15, -46}
+, {-20, -35, 45, 30}
+, {80, 8, 40, -32}
+, {70, -11, 35, -46}
+, {14, -66, 32, -48}
+, {-8, 0, -88, -80}
+, {-28, -44, 28, 12}
+, {58, 22, 30, -6}
+, {82, 73, 83, 74}
+, {-24, 23, -47, 0}
+, {-64, -28, 44, 80}
+, {42, -27, 61, -8}
+, {8, -7, -45, -60}
+, {88, 2, 70, -16}
+, {-72, -66, 30, 36}
+, {102, 74, -38, -66}
+, {-12, -74, -14, -76}
+, {18, 42, 48, 72}
+, {-54, 14, -20, 48}
+, {-18, -34, -30, -46}
+, {-66, -1, -1, 64}
+, {-98, -97, -71, -70}
+, {70, 4, 82, 16}
+, {98, 28, 38, -32}
+, {32, -33, 73, 8}
+, {32, 71, -19, 20}
+, {52, 7, 103, 58}
+, {38, 81, 15, 58}
+, {14, 82, 16, 84}
+, {-88, -56, -70, -38}
+, {70, -51, 15, -106}
+, {-92, 17, -61, 48}
+, {-14, -41, 39, 12}
+, {-28, -80, 18, -34}
+, {-98, -83, -19, -4}
+, {96, 54, -24, -66}
+, {50, -10, -22, -82}
+, {26, 26, 54, 54}
+, {84, 33, 29, -22}
+, {-100, -43, -77, -20}
+, {-46, 30, -48, 28}
+, {-70, -44, 2, 28}
+, {-80, -32, -20, 28}
+, {16, 0, 4, -12}
+, {-62, -85, -85, -108}
+}
+, {{-100, -29, -47, 24}
+, {-74, -58, 36, 52}
+, {-56, 1, -51, 6}
+, {-108, -110, -44, -46}
+, {-76, -120, -56, -100}
+, {66, 53, -41, -54}
+, {110, 60, -12, -62}
+, {46, 32, 18, 4}
+, {-32, 18, 58, 108}
+, {-54, -76, 18, -4}
+, {74, -14, 70, -18}
+, {-38, -45, 67, 60}
+, {-96, -14, -66, 16}
+, {80, 39, 97, 56}
+, {-92, -28, -14, 50}
+, {18, 0, 36, 18}
+, {74, 154, 42, 122}
+, {-50, -27, -3, 20}
+, {28, 95, -11, 56}
+, {0, 14, 68, 82}
+, {10, 66, 2, 58}
+, {-12, -79, -29, -96}
+, {-38, -85, -51, -98}
+, {-78, -91, -3, -16}
+, {-40, -66, -34, -60}
+, {76, 79, 73, 76}
+, {-78, -21, -7, 50}
+, {-4, 69, 27, 100}
+, {-62, -44, -58, -40}
+, {-38, -16, -58, -36}
+, {18, -64, -4, -86}
+, {104, 23, 41, -40}
+, {16, 29, -19, -6}
+, {68, 48, 10, -10}
+, {-56, -58, -66, -68}
+, {-116, -97, -119, -100}
+, {-46, 61, -1, 106}
+, {46, 16, -22, -52}
+, {32, 2, -62, -92}
+, {-48, -28, -92, -72}
+, {4, -15, -35, -54}
+, {58, 38, 66, 46}
+, {-24, -12, -80, -68}
+, {104, 88, 120, 104}
+, {88, 46, 96, 54}
+, {70, 77, 109, 116}
+, {78, 103, 61, 86}
+, {-42, -3, 71, 110}
+, {18, 43, -37, -12}
+, {-38, 44, -12, 70}
+, {-84, -21, 17, 80}
+, {4, 45, 29, 70}
+, {-48, -29, -19, 0}
+, {-106, -153, -59, -106}
+, {64, 18, 60, 14}
+, {-106, 1, -41, 66}
+, {54, 38, 52, 36}
+, {50, 75, 73, 98}
+, {-24, -59, 25, -10}
+, {-30, 47, 41, 118}
+, {-48, -49, -47, -48}
+, {0, -19, 33, 14}
+, {-58, -25, 21, 54}
+, {-34, -6, -10, 18}
+}
+, {{64, 96, 90, 122}
+, {108, 43, 39, -26}
+, {-28, -4, -30, -6}
+, {64, -53, 21, -96}
+, {62, 12, 72, 22}
+, {10, -47, -23, -80}
+, {20, -53, -9, -82}
+, {106, 102, 32, 28}
+, {44, 18, 0, -26}
+, {136, 87, 79, 30}
+, {-8, 99, 23, 130}
+, {90, 116, 16, 42}
+, {28, -34, 30, -32}
+, {-112, -84, 2, 30}
+, {58, 44, -12, -26}
+, {32, -48, 22, -58}
+, {90, 128, 52, 90}
+, {70, 78, 38, 46}
+, {102, 43, 79, 20}
+, {-74, -17, -133, -76}
+, {6, -47, 41, -12}
+, {-76, -41, -113, -78}
+, {-100, -68, -66, -34}
+, {54, 91, -15, 22}
+, {-16, 121, -15, 122}
+, {-24, 27, -73, -22}
+, {84, 59, 39, 14}
+, {50, 97, 33, 80}
+, {134, 96, 8, -30}
+, {-60, -35, 3, 28}
+, {-40, -85, -105, -150}
+, {120, 18, 40, -62}
+, {74, 50, 88, 64}
+, {-12, 55, -19, 48}
+, {94, 76, 16, -2}
+, {-60, 22, -16, 66}
+, {-76, -44, 40, 72}
+, {-60, -18, 44, 86}
+, {-18, 16, -30, 4}
+, {-46, 18, -42, 22}
+, {8, -49, -5, -62}
+, {110, 143, 119, 152}
+, {-92, -73, -95, -76}
+, {82, 87, 91, 96}
+, {-58, -77, -77, -96}
+, {30, -37, 37, -30}
+, {28, 47, -43, -24}
+, {48, 60, -30, -18}
+, {20, -1, -75, -96}
+, {-16, 32, 26, 74}
+, {32, -1, -53, -86}
+, {160, 133, 145, 118}
+, {-18, -2, -66, -50}
+, {-30, 9, 15, 54}
+, {-94, -129, -53, -88}
+, {28, 5, -43, -66}
+, {68, 25, 85, 42}
+, {114, 104, 20, 10}
+, {40, 24, 88, 72}
+, {-82, -14, -80, -12}
+, {80, 66, -22, -36}
+, {-72, -47, -3, 22}
+, {-34, -4, -56, -26}
+, {38, 13, -27, -52}
+}
+, {{-98, -145, -63, -110}
+, {58, 35, -27, -50}
+, {-132, -124, -8, 0}
+, {46, -34, -24, -104}
+, {16, 72, -28, 28}
+, {-52, 73, -25, 100}
+, {-10, -44, 42, 8}
+, {24, 41, 25, 42}
+, {4, -70, -18, -92}
+, {-60, -105, -31, -76}
+, {-52, -10, -42, 0}
+, {0, 34, 74, 108}
+, {0, -52, -2, -54}
+, {-72, -134, -50, -112}
+, {6, 15, 35, 44}
+, {-76, -16, -52, 8}
+, {-78, -119, -47, -88}
+, {66, 24, -8, -50}
+, {-18, 49, -51, 16}
+, {66, 22, 46, 2}
+, {-26, -22, 66, 70}
+, {84, -5, -23, -112}
+, {-14, 17, -23, 8}
+, {22, 2, -72, -92}
+, {-72, -116, -12, -56}
+, {-70, -78, 12, 4}
+, {82, 31, 33, -18}
+, {-24, 28, -44, 8}
+, {70, 66, 98, 94}
+, {88, 81, 5, -2}
+, {-58, -33, -43, -18}
+, {56, 74, 72, 90}
+, {-52, -14, -112, -74}
+, {-20, 13, -45, -12}
+, {-50, -75, -83, -108}
+, {46, 18, 10, -18}
+, {106, 54, 58, 6}
+, {-54, -68, -60, -74}
+, {-26, -64, -24, -62}
+, {-86, -56, -122, -92}
+, {70, 3, -15, -82}
+, {-18, -70, -34, -86}
+, {54, 72, -30, -12}
+, {16, -16, 70, 38}
+, {-40, -19, -113, -92}
+, {-78, 9, -25, 62}
+, {18, 16, 38, 36}
+, {92, 110, 46, 64}
+, {34, -3, -45, -82}
+, {-38, -25, -79, -66}
+, {80, 30, 106, 56}
+, {-60, -52, -76, -68}
+, {-68, 38, -4, 102}
+, {-8, 25, -5, 28}
+, {-10, -44, -78, -112}
+, {20, -75, 9, -86}
+, {104, 38, 66, 0}
+, {20, -10, -34, -64}
+, {38, -1, -97, -136}
+, {64, 108, 62, 106}
+, {-86, -79, -65, -58}
+, {102, 62, 8, -32}
+, {104, 74, 118, 88}
+, {34, -27, 5, -56}
+}
+, {{-74, -90, -86, -102}
+, {92, 38, -40, -94}
+, {32, -24, -60, -116}
+, {112, 41, 127, 56}
+, {16, 95, -17, 62}
+, {0, -46, 14, -32}
+, {0, -71, -35, -106}
+, {0, -5, 71, 66}
+, {68, -22, 36, -54}
+, {-48, -59, 11, 0}
+, {-10, 36, 30, 76}
+, {-16, 4, -36, -16}
+, {-70, 12, -78, 4}
+, {98, 53, 1, -44}
+, {60, 26, -22, -56}
+, {-54, 17, 11, 82}
+, {-72, -64, -56, -48}
+, {-106, -19, -109, -22}
+, {0, 33, -59, -26}
+, {56, -23, 89, 10}
+, {72, -3, 31, -44}
+, {88, -14, 68, -34}
+, {16, 5, -69, -80}
+, {86, 53, 101, 68}
+, {20, -62, 80, -2}
+, {-20, -26, 28, 22}
+, {134, 189, 57, 112}
+, {-60, -130, -22, -92}
+, {-32, 45, -13, 64}
+, {-14, -7, 63, 70}
+, {-46, 42, -26, 62}
+, {72, 30, 22, -20}
+, {42, 12, 96, 66}
+, {96, 98, 50, 52}
+, {78, 23, 53, -2}
+, {56, 108, -8, 44}
+, {66, 39, 59, 32}
+, {44, 10, 80, 46}
+, {-24, 7, -11, 20}
+, {122, 19, 91, -12}
+, {0, 48, 8, 56}
+, {72, 37, -69, -104}
+, {94, 91, 5, 2}
+, {-16, -6, 18, 28}
+, {-20, 31, 23, 74}
+, {96, 69, 45, 18}
+, {-54, -127, -17, -90}
+, {72, 44, 82, 54}
+, {-54, 23, 23, 100}
+, {-72, 7, -79, 0}
+, {-36, 33, 23, 92}
+, {-68, 44, -28, 84}
+, {-48, -110, -8, -70}
+, {-122, -65, -95, -38}
+, {42, 3, -47, -86}
+, {-62, -60, -46, -44}
+, {-10, -36, 52, 26}
+, {-92, -112, -20, -40}
+, {44, 44, -64, -64}
+, {70, -14, 58, -26}
+, {0, -27, -19, -46}
+, {-20, -46, -40, -66}
+, {-8, 50, -8, 50}
+, {74, 91, -3, 14}
+}
+, {{20, 48, -56, -28}
+, {-100, -71, -83, -54}
+, {38, 74, 22, 58}
+, {-66, -12, -4, 50}
+, {52, 30, 48, 26}
+, {-14, -54, -14, -54}
+, {40, 0, 50, 10}
+, {26, 65, 9, 48}
+, {78, -30, 50, -58}
+, {-48, -41, -107, -100}
+, {18, -28, 52, 6}
+, {-52, 53, -43, 62}
+, {-62, 21, -73, 10}
+, {44, -60, 6, -98}
+, {40, -45, 23, -62}
+, {-6, 20, -82, -56}
+, {-6, -28, -2, -24}
+, {66, -3, 117, 48}
+, {36, 29, -55, -62}
+, {-50, -112, -34, -96}
+, {70, -1, 91, 20}
+, {32, -20, -48, -100}
+, {42, -53, -9, -104}
+, {28, -12, 54, 14}
+, {56, 12, -12, -56}
+, {40, 27, 17, 4}
+, {-84, -66, -82, -64}
+, {16, 75, 19, 78}
+, {-58, -41, -69, -52}
+, {4, 30, -8, 18}
+, {92, 22, 2, -68}
+, {-38, 16, 26, 80}
+, {-10, -80, -6, -76}
+, {-42, 27, -49, 20}
+, {52, -2, -6, -60}
+, {2, -36, 2, -36}
+, {-12, 73, -9, 76}
+, {4, 72, -22, 46}
+, {66, 52, 42, 28}
+, {-8, -103, -17, -112}
+, {12, -8, -10, -30}
+, {100, -26, 24, -102}
+, {36, 13, 113, 90}
+, {74, 47, 17, -10}
+, {-64, -74, -78, -88}
+, {-56, -68, -66, -78}
+, {26, -18, -18, -62}
+, {46, -36, -6, -88}
+, {-8, 73, 5, 86}
+, {-62, -32, 32, 62}
+, {100, 1, 25, -74}
+, {-74, -10, -72, -8}
+, {60, -66, 26, -100}
+, {4, 1, 27, 24}
+, {-92, -85, -91, -84}
+, {-20, 46, -40, 26}
+, {-64, -109, -29, -74}
+, {-50, 41, -35, 56}
+, {-92, -133, -39, -80}
+, {0, 69, -31, 38}
+, {-92, -73, 25, 44}
+, {72, 32, 74, 34}
+, {-86, -78, -100, -92}
+, {-76, -85, -45, -54}
+}
+, {{64, 83, 91, 110}
+, {98, 63, -27, -62}
+, {60, 7, 27, -26}
+, {76, 94, 2, 20}
+, {-34, -37, -71, -74}
+, {26, 83, 39, 96}
+, {12, 19, -21, -14}
+, {40, -68, 26, -82}
+, {-60, -11, -57, -8}
+, {24, -14, 64, 26}
+, {14, 80, -46, 20}
+, {-60, -78, -50, -68}
+, {-78, -65, -13, 0}
+, {76, 4, 6, -66}
+, {24, 28, -2, 2}
+, {-62, 33, -19, 76}
+, {18, -8, 52, 26}
+, {96, 32, 74, 10}
+, {-36, -7, -65, -36}
+, {-62, 8, -4, 66}
+, {-18, 14, -12, 20}
+, {-4, 21, -5, 20}
+, {102, 62, 116, 76}
+, {90, 70, 104, 84}
+, {24, 6, 52, 34}
+, {-40, 2, -32, 10}
+, {48, 86, -32, 6}
+, {94, 22, 114, 42}
+, {-52, -7, 49, 94}
+, {-14, 12, -52, -26}
+, {46, 68, -12, 10}
+, {36, 95, 13, 72}
+, {-4, -17, -39, -52}
+, {48, 64, 34, 50}
+, {-44, -77, 15, -18}
+, {-30, 8, 22, 60}
+, {-80, -22, -80, -22}
+, {62, 49, -19, -32}
+, {82, 17, 17, -48}
+, {64, -30, -22, -116}
+, {84, 53, 111, 80}
+, {-10, -7, -39, -36}
+, {-106, -27, -89, -10}
+, {-18, -17, 47, 48}
+, {14, -29, -45, -88}
+, {10, -34, -4, -48}
+, {-66, 50, -26, 90}
+, {100, 68, 68, 36}
+, {-18, 45, 49, 112}
+, {-6, 6, -4, 8}
+, {-92, -74, -2, 16}
+, {50, 87, 31, 68}
+, {-54, -95, 15, -26}
+, {44, 18, -24, -50}
+, {-42, -79, -15, -52}
+, {-10, -28, -8, -26}
+, {-72, 41, -47, 66}
+, {-34, 90, 14, 138}
+, {-10, 60, -18, 52}
+, {22, 45, 67, 90}
+, {-80, -67, -17, -4}
+, {-22, -54, -64, -96}
+, {12, -9, -9, -30}
+, {-30, -21, 71, 80}
+}
+, {{58, 18, 96, 56}
+, {-60, -44, -90, -74}
+, {18, 45, 55, 82}
+, {-62, -82, -76, -96}
+, {-40, -8, -78, -46}
+, {66, -1, 83, 16}
+, {36, -11, -15, -62}
+, {60, 84, 42, 66}
+, {74, 74, -16, -16}
+, {-36, -94, 22, -36}
+, {-22, 21, -43, 0}
+, {-76, -14, -22, 40}
+, {-26, 11, 45, 82}
+, {42, 20, -6, -28}
+, {-24, -45, -73, -94}
+, {108, 124, 28, 44}
+, {108, 5, 11, -92}
+, {-56, 14, -60, 10}
+, {-84, -19, 7, 72}
+, {-14, 36, 26, 76}
+, {24, 28, 86, 90}
+, {90, 116, 80, 106}
+, {-40, -18, 78, 100}
+, {20, -14, 38, 4}
+, {72, 48, 54, 30}
+, {90, -9, 11, -88}
+, {-120, -151, -75, -106}
+, {-78, -41, 17, 54}
+, {-46, -51, -29, -34}
+, {78, 28, 8, -42}
+, {42, 84, -40, 2}
+, {0, 42, 16, 58}
+, {-40, -16, 44, 68}
+, {-76, -43, -41, -8}
+, {14, 76, -28, 34}
+, {-102, -37, -87, -22}
+, {-10, -6, 10, 14}
+, {0, -14, -32, -46}
+, {-34, 50, -60, 24}
+, {46, 64, 0, 18}
+, {-50, -60, -36, -46}
+, {-28, -48, 30, 10}
+, {86, 87, 47, 48}
+, {30, 30, -42, -42}
+, {-68, 15, -5, 78}
+, {0, 65, 35, 100}
+, {38, 63, -15, 10}
+, {-106, -105, -35, -34}
+, {66, -28, 26, -68}
+, {-62, -88, -54, -80}
+, {12, -23, 75, 40}
+, {74, 35, 47, 8}
+, {88, 55, 75, 42}
+, {20, -55, -15, -90}
+, {42, 45, 5, 8}
+, {-116, -28, -32, 56}
+, {-60, -52, -18, -10}
+, {-50, -60, -60, -70}
+, {30, 16, -46, -60}
+, {-102, -104, -4, -6}
+, {18, 49, -25, 6}
+, {-14, 8, 22, 44}
+, {-66, -83, 23, 6}
+, {76, 98, 22, 44}
+}
+, {{-14, -8, 70, 76}
+, {92, 118, 24, 50}
+, {12, -10, 80, 58}
+, {-100, -64, -16, 20}
+, {92, 8, 60, -24}
+, {90, 66, 118, 94}
+, {-40, -3, -43, -6}
+, {-100, 7, -21, 86}
+, {20, 59, 51, 90}
+, {100, 34, 74, 8}
+, {-30, 26, -22, 34}
+, {26, 2, 26, 2}
+, {-72, -35, 23, 60}
+, {96, 14, 46, -36}
+, {38, 84, -30, 16}
+, {34, -6, -18, -58}
+, {-66, -37, -93, -64}
+, {-10, 21, 49, 80}
+, {-18, -10, -28, -20}
+, {-66, -56, -66, -56}
+, {-40, -84, -6, -50}
+, {-6, -78, 8, -64}
+, {18, -82, 20, -80}
+, {14, 7, -43, -50}
+, {-4, -6, 46, 44}
+, {58, 61, 31, 34}
+, {140, 87, -1, -54}
+, {-32, 74, -12, 94}
+, {-66, -23, 19, 62}
+, {-86, 8, -50, 44}
+, {-6, 59, -55, 10}
+, {84, 59, 111, 86}
+, {94, 19, 111, 36}
+, {108, 85, -11, -34}
+, {-100, -77, -77, -54}
+, {-90, -16, -86, -12}
+, {-66, -43, -105, -82}
+, {-86, -37, -73, -24}
+, {4, -35, -9, -48}
+, {-20, -15, 67, 72}
+, {-12, 75, -23, 64}
+, {6, 78, 20, 92}
+, {-76, -10, 26, 92}
+, {32, 107, 15, 90}
+, {-24, -2, -50, -28}
+, {36, 22, -4, -18}
+, {2, 33, 5, 36}
+, {-44, 100, -36, 108}
+, {0, -74, 30, -44}
+, {-12, 66, 0, 78}
+, {6, 17, -43, -32}
+, {-18, 109, 3, 130}
+, {-82, 1, 25, 108}
+, {-66, -62, 12, 16}
+, {-18, 15, -71, -38}
+, {-80, -9, 31, 102}
+, {24, 2, 32, 10}
+, {-52, -19, -83, -50}
+, {70, 171, 57, 158}
+, {-54, -1, 25, 78}
+, {72, 30, 94, 52}
+, {-4, -29, 69, 44}
+, {-22, -92, -14, -84}
+, {96, 115, 83, 102}
+}
+, {{0, 97, 17, 114}
+, {-96, -41, -111, -56}
+, {-44, 23, -35, 32}
+, {64, 88, -18, 6}
+, {-6, -7, -53, -54}
+, {0, 3, 69, 72}
+, {24, -4, 84, 56}
+, {92, 126, 44, 78}
+, {82, 26, 32, -24}
+, {-66, 6, -16, 56}
+, {2, -35, 17, -20}
+, {-22, -5, -53, -36}
+, {100, 68, 70, 38}
+, {-24, 5, -43, -14}
+, {12, 10, -44, -46}
+, {86, -5, 13, -78}
+, {-22, 0, -18, 4}
+, {-72, -24, -94, -46}
+, {-12, -45, -49, -82}
+, {118, 49, 27, -42}
+, {32, 53, 41, 62}
+, {6, 88, 24, 106}
+, {-2, -63, -11, -72}
+, {76, 74, 72, 70}
+, {-20, 8, -96, -68}
+, {108, 10, 28, -70}
+, {70, -103, 49, -124}
+, {-36, 8, 30, 74}
+, {-72, -37, -105, -70}
+, {24, -33, -43, -100}
+, {-98, -44, -24, 30}
+, {-138, -182, -42, -86}
+, {-98, -35, -3, 60}
+, {-28, -45, 43, 26}
+, {-42, 2, 24, 68}
+, {66, 12, 4, -50}
+, {54, -24, -20, -98}
+, {114, 82, 76, 44}
+, {42, -18, -30, -90}
+, {-108, -73, -43, -8}
+, {-84, 30, -32, 82}
+, {32, 13, 7, -12}
+, {-34, -38, 20, 16}
+, {96, 68, 4, -24}
+, {-96, -72, -16, 8}
+, {52, -29, 69, -12}
+, {100, -1, 15, -86}
+, {-6, -69, -61, -124}
+, {-88, 17, -51, 54}
+, {-42, -82, -54, -94}
+, {108, 74, 56, 22}
+, {72, 31, 113, 72}
+, {-10, 16, 62, 88}
+, {78, 76, 76, 74}
+, {32, 42, 52, 62}
+, {-106, -42, -112, -48}
+, {-36, 35, -19, 52}
+, {-46, 0, -34, 12}
+, {-130, -49, -57, 24}
+, {-68, 55, -25, 98}
+, {-56, 27, -13, 70}
+, {58, -7, -43, -108}
+, {72, 78, 0, 6}
+, {0, 47, -35, 12}
+}
+, {{18, 16, -16, -18}
+, {78, 66, 68, 56}
+, {-78, -121, -19, -62}
+, {78, 106, 42, 70}
+, {-42, -24, -122, -104}
+, {30, 6, 24, 0}
+, {-68, 38, -38, 68}
+, {-12, 59, 33, 104}
+, {0, -54, -46, -100}
+, {64, 2, -16, -78}
+, {52, 147, 25, 120}
+, {40, 51, -51, -40}
+, {20, -60, 10, -70}
+, {-152, -37, -33, 82}
+, {-92, -58, -106, -72}
+, {66, 71, 95, 100}
+, {-38, 9, -43, 4}
+, {16, -13, 57, 28}
+, {-96, 17, -79, 34}
+, {80, 5, 63, -12}
+, {-94, -59, 17, 52}
+, {38, -43, 39, -42}
+, {86, 43, -33, -76}
+, {96, 17, 3, -76}
+, {-62, 73, -53, 82}
+, {114, -10, 24, -100}
+, {42, 7, 25, -10}
+, {-64, -57, -41, -34}
+, {42, 98, 4, 60}
+, {-62, -18, -100, -56}
+, {-52, -79, -19, -46}
+, {102, 84, 102, 84}
+, {78, 29, 61, 12}
+, {-50, -45, 29, 34}
+, {-18, 62, 16, 96}
+, {2, -9, 35, 24}
+, {96, -35, 39, -92}
+, {-90, -53, 37, 74}
+, {-50, -7, 33, 76}
+, {-54, -63, -5, -14}
+, {-86, -24, -128, -66}
+, {76, 20, 36, -20}
+, {-66, 3, 13, 82}
+, {-16, 52, -42, 26}
+, {76, -33, 77, -32}
+, {-70, -104, -62, -96}
+, {76, 10, 44, -22}
+, {-64, -17, -15, 32}
+, {-56, 13, -53, 16}
+, {54, 96, 100, 142}
+, {-32, -108, -18, -94}
+, {-38, 1, -101, -62}
+, {-24, 8, -54, -22}
+, {-60, 26, -34, 52}
+, {-48, -28, -80, -60}
+, {76, 27, -1, -50}
+, {-52, 28, -42, 38}
+, {24, -12, 4, -32}
+, {6, 51, 25, 70}
+, {104, 40, 84, 20}
+, {-10, -32, -2, -24}
+, {2, 11, 17, 26}
+, {-92, -50, -2, 40}
+, {42, 20, 94, 72}
+}
+, {{-36, -38, -8, -10}
+, {76, 97, 91, 112}
+, {0, 13, -89, -76}
+, {-32, -84, 2, -50}
+, {80, 65, 63, 48}
+, {72, 10, 116, 54}
+, {42, 32, -10, -20}
+, {-102, -93, -19, -10}
+, {54, 71, -13, 4}
+, {-50, -87, -11, -48}
+, {-94, -31, -97, -34}
+, {-64, -51, 21, 34}
+, {8, 31, 25, 48}
+, {36, 26, -24, -34}
+, {98, 66, 0, -32}
+, {-60, -22, 52, 90}
+, {-50, -34, -54, -38}
+, {-56, -2, -112, -58}
+, {90, 69, 107, 86}
+, {82, 42, 118, 78}
+, {-32, 32, 26, 90}
+, {-34, -15, 25, 44}
+, {-42, -72, -66, -96}
+, {-22, -31, -29, -38}
+, {64, 80, 44, 60}
+, {54, 92, 34, 72}
+, {-8, 32, 50, 90}
+, {-70, -59, -73, -62}
+, {108, 91, 63, 46}
+, {-58, 31, 17, 106}
+, {98, 84, 44, 30}
+, {66, 21, 7, -38}
+, {-14, 21, -31, 4}
+, {114, 94, 78, 58}
+, {-48, 17, -41, 24}
+, {-36, -16, -12, 8}
+, {-4, 1, 57, 62}
+, {22, 75, 9, 62}
+, {-22, -73, 21, -30}
+, {122, 115, 13, 6}
+, {46, -50, 0, -96}
+, {-72, -97, -19, -44}
+, {26, -23, 19, -30}
+, {26, 60, -18, 16}
+, {74, 58, -36, -52}
+, {-96, -25, -9, 62}
+, {-92, -70, -90, -68}
+, {32, 43, -65, -54}
+, {112, 56, 94, 38}
+, {58, -30, 74, -14}
+, {86, 71, 25, 10}
+, {-46, 18, -36, 28}
+, {-100, -67, 39, 72}
+, {54, 68, 30, 44}
+, {94, 129, 63, 98}
+, {44, 20, 18, -6}
+, {-70, -69, -51, -50}
+, {0, 32, 60, 92}
+, {122, 103, 55, 36}
+, {-98, -38, -116, -56}
+, {46, -37, 63, -20}
+, {54, -9, 41, -22}
+, {-76, -52, -122, -98}
+, {-98, -61, -43, -6}
+}
+, {{-114, -97, -17, 0}
+, {-84, -96, -56, -68}
+, {78, 35, 101, 58}
+, {128, 100, 122, 94}
+, {108, 28, 28, -52}
+, {94, 50, 134, 90}
+, {-88, -29, -131, -72}
+, {42, 18, 94, 70}
+, {-46, 18, -96, -32}
+, {16, -74, 22, -68}
+, {-60, -14, -22, 24}
+, {-80, -30, -64, -14}
+, {-10, 14, 54, 78}
+, {110, 90, -22, -42}
+, {0, -50, -26, -76}
+, {-74, -109, -35, -70}
+, {-14, -9, 25, 30}
+, {-110, -112, -102, -104}
+, {82, 24, -40, -98}
+, {-94, 26, -14, 106}
+, {18, 0, -66, -84}
+, {-82, -40, -2, 40}
+, {100, 38, 102, 40}
+, {-6, -48, 46, 4}
+, {114, 124, 48, 58}
+, {-128, -66, -96, -34}
+, {-58, 63, -31, 90}
+, {106, 73, -21, -54}
+, {-92, -43, -47, 2}
+, {-12, -104, 4, -88}
+, {-70, 12, -44, 38}
+, {-4, -15, 35, 24}
+, {8, 56, -54, -6}
+, {112, 168, 50, 106}
+, {-66, -122, -22, -78}
+, {-50, -23, -81, -54}
+, {74, 93, 53, 72}
+, {76, 36, 40, 0}
+, {48, 54, -18, -12}
+, {-38, 29, -45, 22}
+, {102, 63, -31, -70}
+, {-44, 17, 3, 64}
+, {104, 28, -6, -82}
+, {-20, -49, -41, -70}
+, {74, 74, 100, 100}
+, {84, -48, 30, -102}
+, {-34, 23, 51, 108}
+, {42, -1, -27, -70}
+, {38, 44, -24, -18}
+, {-2, -39, -55, -92}
+, {-74, 27, -41, 60}
+, {-112, -71, -27, 14}
+, {106, 100, 88, 82}
+, {6, 84, 10, 88}
+, {-92, 5, -55, 42}
+, {92, 134, 52, 94}
+, {32, 35, 103, 106}
+, {46, -32, 58, -20}
+, {26, 118, 0, 92}
+, {98, 81, -7, -24}
+, {-64, -91, -19, -46}
+, {-20, -53, 5, -28}
+, {-38, 19, 5, 62}
+, {-46, -88, -6, -48}
+}
+, {{48, -26, 16, -58}
+, {-40, -10, -110, -80}
+, {96, 50, 36, -10}
+, {82, 117, 57, 92}
+, {-40, -84, -4, -48}
+, {116, 61, 69, 14}
+, {-24, -89, -1, -66}
+, {58, 26, 70, 38}
+, {-4, 7, -11, 0}
+, {-100, -68, -52, -20}
+, {22, -68, 0, -90}
+, {-96, -133, -23, -60}
+, {-20, 10, 62, 92}
+, {84, 53, 21, -10}
+, {54, -25, 63, -16}
+, {12, -41, 13, -40}
+, {-6, 44, -70, -20}
+, {-28, 19, 3, 50}
+, {-4, 17, -57, -36}
+, {16, -62, -8, -86}
+, {22, 37, 23, 38}
+, {102, 99, 103, 100}
+, {0, 23, 55, 78}
+, {36, 8, 8, -20}
+, {24, 92, 20, 88}
+, {50, 31, -39, -58}
+, {-76, -12, -36, 28}
+, {-10, -58, 36, -12}
+, {-12, 10, 2, 24}
+, {-48, -80, 22, -10}
+, {-48, -82, 0, -34}
+, {-36, -11, -107, -82}
+, {18, 27, 27, 36}
+, {0, -17, 69, 52}
+, {14, 14, -20, -20}
+, {54, -13, 21, -46}
+, {-72, -34, -78, -40}
+, {30, -20, 60, 10}
+, {0, -46, -14, -60}
+, {-70, -65, -65, -60}
+, {-42, 13, -31, 24}
+, {-54, -37, 31, 48}
+, {90, 59, 23, -8}
+, {44, -30, 72, -2}
+, {14, -2, 104, 88}
+, {34, -45, 29, -50}
+, {-52, -65, 13, 0}
+, {-4, 10, -42, -28}
+, {74, 88, 34, 48}
+, {6, 18, 26, 38}
+, {-80, -1, -105, -26}
+, {-142, -12, -70, 60}
+, {-76, -38, -38, 0}
+, {116, 145, 59, 88}
+, {-2, -62, -8, -68}
+, {2, 3, -35, -34}
+, {70, -27, 19, -78}
+, {-100, -8, -62, 30}
+, {16, 4, 58, 46}
+, {-38, 33, -57, 14}
+, {54, 86, 20, 52}
+, {-16, -38, -38, -60}
+, {66, 65, -29, -30}
+, {86, 26, 52, -8}
+}
+, {{-20, -28, -16, -24}
+, {-30, -47, 1, -16}
+, {-14, -47, -29, -62}
+, {36, -10, -18, -64}
+, {40, 9, 71, 40}
+, {-88, -103, 7, -8}
+, {28, 3, 19, -6}
+, {88, 46, 134, 92}
+, {20, 7, -57, -70}
+, {-8, 40, 28, 76}
+, {56, -4, 52, -8}
+, {-26, 45, -13, 58}
+, {82, 59, 3, -20}
+, {4, 117, -3, 110}
+, {50, 67, 61, 78}
+, {-96, -61, -77, -42}
+, {-6, -32, -38, -64}
+, {4, 96, -34, 58}
+, {66, 53, -13, -26}
+, {-6, -60, 16, -38}
+, {20, 18, 20, 18}
+, {-100, -120, -20, -40}
+, {-40, 43, -47, 36}
+, {-56, -92, -8, -44}
+, {-12, -56, -56, -100}
+, {-66, -44, -90, -68}
+, {-76, -64, -64, -52}
+, {-72, 1, -65, 8}
+, {-104, -93, -135, -124}
+, {-58, -2, -86, -30}
+, {100, 94, -10, -16}
+, {-32, -35, 13, 10}
+, {10, 72, 42, 104}
+, {96, 117, 71, 92}
+, {100, 111, -3, 8}
+, {42, 7, 101, 66}
+, {24, 89, 21, 86}
+, {84, 21, 9, -54}
+, {-36, -23, -87, -74}
+, {-44, -1, -41, 2}
+, {92, 23, 55, -14}
+, {-72, -124, -82, -134}
+, {-28, -33, -45, -50}
+, {-76, -80, -28, -32}
+, {8, 47, 17, 56}
+, {-116, -3, -19, 94}
+, {-90, -42, -8, 40}
+, {-6, -15, 23, 14}
+, {-4, 46, -26, 24}
+, {-42, -32, -62, -52}
+, {-96, -57, -79, -40}
+, {76, 40, 32, -4}
+, {98, 6, 120, 28}
+, {-82, -51, -79, -48}
+, {106, 47, 85, 26}
+, {54, 37, 23, 6}
+, {-98, -10, -30, 58}
+, {-56, -50, 2, 8}
+, {-8, 45, 29, 82}
+, {-38, 32, 0, 70}
+, {46, -1, 59, 12}
+, {-10, -60, -54, -104}
+, {40, 55, 3, 18}
+, {-88, -84, -42, -38}
+}
+, {{-74, 63, -47, 90}
+, {-64, -95, -1, -32}
+, {20, -4, -42, -66}
+, {-96, 3, -41, 58}
+, {86, 110, 78, 102}
+, {48, 102, 54, 108}
+, {98, 104, 52, 58}
+, {54, 99, 19, 64}
+, {-66, 71, -29, 108}
+, {96, -1, 43, -54}
+, {20, -81, 27, -74}
+, {44, -37, 49, -32}
+, {-20, -109, -5, -94}
+, {32, 74, 56, 98}
+, {-80, -51, -105, -76}
+, {-10, 20, -88, -58}
+, {-68, -43, -3, 22}
+, {-12, 21, 35, 68}
+, {-76, -73, -9, -6}
+, {-86, -68, 2, 20}
+, {38, 87, -15, 34}
+, {92, 45, 3, -44}
+, {66, 25, 119, 78}
+, {20, -68, -2, -90}
+, {-50, 16, 8, 74}
+, {-102, -67, -31, 4}
+, {-78, -96, -100, -118}
+, {-62, -87, -71, -96}
+, {-82, -93, -111, -122}
+, {-76, -118, -30, -72}
+, {24, 37, -27, -14}
+, {76, 5, 97, 26}
+, {4, -91, -7, -102}
+, {-92, -143, -31, -82}
+, {10, -38, 14, -34}
+, {-14, -29, 45, 30}
+, {40, -37, 29, -48}
+, {84, 62, -54, -76}
+, {-46, -65, -49, -68}
+, {98, 78, 86, 66}
+, {24, -64, -8, -96}
+, {-44, -88, 0, -44}
+, {68, 116, 38, 86}
+, {104, 56, 10, -38}
+, {76, -26, 28, -74}
+, {60, 59, -49, -50}
+, {-64, -43, 59, 80}
+, {40, -12, -4, -56}
+, {48, 38, -2, -12}
+, {10, 10, -4, -4}
+, {88, 16, -20, -92}
+, {-48, -29, -75, -56}
+, {-42, -24, 12, 30}
+, {-72, -68, -46, -42}
+, {12, 35, -35, -12}
+, {-34, -99, -11, -76}
+, {74, 71, 73, 70}
+, {-4, -4, -44, -44}
+, {-38, -32, -8, -2}
+, {34, 30, 64, 60}
+, {62, 61, 27, 26}
+, {54, 16, 84, 46}
+, {78, 26, 10, -42}
+, {90, 57, -47, -80}
+}
+, {{48, 59, 7, 18}
+, {56, 58, 92, 94}
+, {64, -14, 72, -6}
+, {58, 17, 129, 88}
+, {30, -56, 10, -76}
+, {-86, -105, 13, -6}
+, {-34, -27, -9, -2}
+, {86, 28, 106, 48}
+, {-32, 9, -5, 36}
+, {28, 37, -83, -74}
+, {-10, 19, -9, 20}
+, {-60, -49, -39, -28}
+, {26, -50, -2, -78}
+, {80, 62, 76, 58}
+, {-80, -88, -16, -24}
+, {-92, 14, -28, 78}
+, {24, 69, 19, 64}
+, {54, 90, 18, 54}
+, {16, 12, 68, 64}
+, {42, 8, 108, 74}
+, {42, -48, 26, -64}
+, {86, 67, 53, 34}
+, {2, 9, -47, -40}
+, {-22, 23, -89, -44}
+, {-2, -44, 34, -8}
+, {-90, -60, -24, 6}
+, {64, 11, 57, 4}
+, {-28, 2, -2, 28}
+, {78, 20, 110, 52}
+, {68, -17, 1, -84}
+, {-30, -29, -23, -22}
+, {-60, 24, -80, 4}
+, {8, -84, -4, -96}
+, {-14, -38, 54, 30}
+, {74, 123, -3, 46}
+, {10, -22, -50, -82}
+, {98, 18, 48, -32}
+, {90, 60, 2, -28}
+, {-18, -62, -8, -52}
+, {-16, -2, 40, 54}
+, {18, 28, 4, 14}
+, {64, -21, 45, -40}
+, {0, 61, -17, 44}
+, {48, 10, 22, -16}
+, {82, 102, 76, 96}
+, {-28, -53, -31, -56}
+, {-18, -58, -62, -102}
+, {72, 13, 35, -24}
+, {-24, 45, 43, 112}
+, {-40, -85, 29, -16}
+, {-50, 17, 17, 84}
+, {-54, -18, -62, -26}
+, {64, 16, 10, -38}
+, {-82, -29, -11, 42}
+, {90, 27, -29, -92}
+, {56, -20, 34, -42}
+, {104, 97, 29, 22}
+, {-38, -25, -85, -72}
+, {-88, -62, -72, -46}
+, {34, -22, 58, 2}
+, {92, 116, 48, 72}
+, {56, 8, -36, -84}
+, {-68, -81, -69, -82}
+, {-16, 51, 27, 94}
+}
+, {{-68, -45, -3, 20}
+, {48, -70, 32, -86}
+, {90, 144, 48, 102}
+, {-48, 17, -63, 2}
+, {20, -40, -20, -80}
+, {32, 64, 62, 94}
+, {12, 19, 53, 60}
+, {18, -10, -30, -58}
+, {-60, -24, -82, -46}
+, {40, 103, 43, 106}
+, {-34, -31, -31, -28}
+, {-78, -3, 19, 94}
+, {36, -33, -15, -84}
+, {52, -80, 30, -102}
+, {58, -13, -29, -100}
+, {74, 4, 26, -44}
+, {-60, -33, -69, -42}
+, {70, 71, 47, 48}
+, {12, 53, -45, -4}
+, {28, -11, 35, -4}
+, {56, 11, -11, -56}
+, {-36, -36, 12, 12}
+, {-52, -42, -52, -42}
+, {-2, 66, 62, 130}
+, {126, 122, 8, 4}
+, {74, 37, 9, -28}
+, {92, 89, 45, 42}
+, {22, 18, -54, -58}
+, {68, 97, 21, 50}
+, {64, 50, 4, -10}
+, {-92, -64, -12, 16}
+, {24, 23, 47, 46}
+, {54, 22, 116, 84}
+, {46, 40, 70, 64}
+, {-50, 90, -16, 124}
+, {-24, -24, -24, -24}
+, {-64, -87, -47, -70}
+, {-56, -79, -39, -62}
+, {0, 45, -77, -32}
+, {72, -12, -44, -128}
+, {-44, -27, -71, -54}
+, {74, -37, -13, -124}
+, {-110, -75, 1, 36}
+, {96, 51, 25, -20}
+, {-80, -42, -2, 36}
+, {4, 13, -29, -20}
+, {2, -72, -40, -114}
+, {106, 126, 56, 76}
+, {48, 63, -65, -50}
+, {82, 34, 126, 78}
+, {22, -15, -15, -52}
+, {70, 45, 115, 90}
+, {-64, -64, 0, 0}
+, {-52, 53, 13, 118}
+, {8, 47, 27, 66}
+, {-46, 34, -16, 64}
+, {-88, -83, -23, -18}
+, {74, 123, 21, 70}
+, {56, 44, -32, -44}
+, {58, 44, 42, 28}
+, {-86, 23, -47, 62}
+, {52, 44, 80, 72}
+, {-36, 62, -12, 86}
+, {-110, -56, -60, -6}
+}
+, {{2, -46, -18, -66}
+, {-74, -34, 14, 54}
+, {28, -23, 41, -10}
+, {-28, -41, -31, -44}
+, {42, 23, 59, 40}
+, {0, -40, -14, -54}
+, {-102, -28, -106, -32}
+, {42, 5, 85, 48}
+, {-68, 26, -20, 74}
+, {-112, -32, -56, 24}
+, {0, -3, 81, 78}
+, {-90, -116, -58, -84}
+, {-58, 5, 27, 90}
+, {14, -30, -12, -56}
+, {2, 22, 76, 96}
+, {-84, -56, -102, -74}
+, {-102, -120, -72, -90}
+, {-86, -23, -53, 10}
+, {-30, 48, -58, 20}
+, {-26, -10, -30, -14}
+, {-50, -49, 11, 12}
+, {-56, 6, -10, 52}
+, {34, 21, -21, -34}
+, {-118, -91, -99, -72}
+, {-42, 39, 9, 90}
+, {-106, -70, -136, -100}
+, {-62, 0, -12, 50}
+, {94, 148, 56, 110}
+, {-74, -61, 53, 66}
+, {42, 50, 6, 14}
+, {46, 28, 38, 20}
+, {88, 62, 82, 56}
+, {2, 88, 28, 114}
+, {-28, 63, 25, 116}
+, {-80, -23, 19, 76}
+, {-12, 58, 14, 84}
+, {-14, 50, -26, 38}
+, {-44, 0, 36, 80}
+, {48, 77, -7, 22}
+, {-64, 0, 36, 100}
+, {26, -38, -12, -76}
+, {4, 53, 17, 66}
+, {54, -8, -14, -76}
+, {-102, 12, -66, 48}
+, {-14, 72, 12, 98}
+, {18, 63, 1, 46}
+, {30, 35, 19, 24}
+, {-140, -81, -1, 58}
+, {-44, -47, -69, -72}
+, {82, 40, 56, 14}
+, {102, 117, 9, 24}
+, {-72, -21, -81, -30}
+, {2, 2, -50, -50}
+, {-38, -36, -58, -56}
+, {-92, -14, -60, 18}
+, {-40, 6, -24, 22}
+, {-100, -23, 11, 88}
+, {-118, -85, -31, 2}
+, {-64, -24, -48, -8}
+, {-36, 35, 33, 104}
+, {24, -34, -8, -66}
+, {2, 29, 81, 108}
+, {8, -10, -40, -58}
+, {88, -2, 76, -14}
+}
+, {{-6, -21, 43, 28}
+, {86, 30, -22, -78}
+, {6, -29, 21, -14}
+, {38, 22, -54, -70}
+, {-4, 91, -5, 90}
+, {-52, 3, -37, 18}
+, {42, -58, 16, -84}
+, {-8, -29, 25, 4}
+, {-92, 28, -24, 96}
+, {-14, -93, -19, -98}
+, {-70, 25, -27, 68}
+, {-44, -18, 38, 64}
+, {-70, 12, -8, 74}
+, {58, 38, -32, -52}
+, {-90, -16, -102, -28}
+, {-98, -66, -82, -50}
+, {-16, -27, 79, 68}
+, {-118, -161, -41, -84}
+, {68, 116, 58, 106}
+, {50, -16, 92, 26}
+, {-70, -36, -64, -30}
+, {-96, -21, -57, 18}
+, {-76, -80, -24, -28}
+, {74, 34, 98, 58}
+, {-86, -133, -13, -60}
+, {-116, -83, -11, 22}
+, {12, 60, 38, 86}
+, {-50, -12, -8, 30}
+, {-40, -31, 71, 80}
+, {54, 33, 87, 66}
+, {12, 66, 14, 68}
+, {-86, -37, 19, 68}
+, {-10, -48, -18, -56}
+, {52, 39, -35, -48}
+, {-34, -54, 10, -10}
+, {0, -94, -32, -126}
+, {-54, -67, -51, -64}
+, {-12, 43, -39, 16}
+, {90, 135, 49, 94}
+, {68, 37, 89, 58}
+, {74, 22, 72, 20}
+, {-80, -40, 28, 68}
+, {2, -22, 14, -10}
+, {92, 108, 34, 50}
+, {-18, 29, 51, 98}
+, {-74, -13, -77, -16}
+, {-64, -32, -90, -58}
+, {-20, -40, 22, 2}
+, {104, 96, 78, 70}
+, {-20, -26, -16, -22}
+, {50, 43, -1, -8}
+, {12, -20, -74, -106}
+, {-46, 13, 35, 94}
+, {32, -18, -62, -112}
+, {-20, 68, -8, 80}
+, {-104, -64, -42, -2}
+, {54, 76, 54, 76}
+, {-142, -54, -20, 68}
+, {72, 60, -44, -56}
+, {-22, -67, -25, -70}
+, {74, 42, 128, 96}
+, {-70, 6, -104, -28}
+, {-14, 35, 19, 68}
+, {80, 125, 43, 88}
+}
+, {{96, 71, 39, 14}
+, {36, -66, 26, -76}
+, {104, 76, 122, 94}
+, {-70, -16, -60, -6}
+, {-100, -15, 19, 104}
+, {36, -28, -4, -68}
+, {-74, -119, -65, -110}
+, {76, 18, 70, 12}
+, {38, 41, -1, 2}
+, {0, 31, 75, 106}
+, {-66, -76, -30, -40}
+, {58, 76, 0, 18}
+, {-60, -60, -100, -100}
+, {-6, -38, 28, -4}
+, {-84, -20, -100, -36}
+, {-70, -1, 9, 78}
+, {26, 2, -6, -30}
+, {-10, -108, -10, -108}
+, {-26, -25, 11, 12}
+, {102, 27, -25, -100}
+, {0, 49, 49, 98}
+, {40, -15, 33, -22}
+, {-106, -36, 14, 84}
+, {0, 26, -84, -58}
+, {-54, 1, -3, 52}
+, {76, 140, 20, 84}
+, {4, -18, 54, 32}
+, {80, -31, 21, -90}
+, {78, 116, 38, 76}
+, {-28, -68, -4, -44}
+, {-110, -67, -69, -26}
+, {-90, -105, -15, -30}
+, {16, -3, -3, -22}
+, {-70, -88, -30, -48}
+, {-78, -2, -38, 38}
+, {-112, -83, 21, 50}
+, {-18, 1, 17, 36}
+, {-48, 43, -15, 76}
+, {102, 105, 75, 78}
+, {26, 14, 6, -6}
+, {-62, -67, -91, -96}
+, {58, 100, -10, 32}
+, {-48, -85, -43, -80}
+, {-88, -123, -71, -106}
+, {-6, 35, 13, 54}
+, {-84, 40, -46, 78}
+, {0, 12, -48, -36}
+, {-54, 32, -68, 18}
+, {-66, -3, 39, 102}
+, {0, 35, 31, 66}
+, {-62, -80, -70, -88}
+, {-50, -82, 4, -28}
+, {10, 40, -38, -8}
+, {20, 37, -67, -50}
+, {-110, -113, -5, -8}
+, {26, -48, 4, -70}
+, {12, 102, 8, 98}
+, {10, 4, -20, -26}
+, {70, 101, 49, 80}
+, {16, 22, -10, -4}
+, {44, -35, 49, -30}
+, {22, 82, -12, 48}
+, {24, -29, 9, -44}
+, {40, -20, 30, -30}
+}
+, {{40, 28, -38, -50}
+, {6, 31, -13, 12}
+, {-20, 12, -96, -64}
+, {-78, -53, -97, -72}
+, {0, -41, 49, 8}
+, {-60, -15, -81, -36}
+, {-16, 14, 24, 54}
+, {-32, -39, -13, -20}
+, {-52, -37, -57, -42}
+, {-28, -21, 47, 54}
+, {102, 54, 44, -4}
+, {2, 88, -12, 74}
+, {64, 12, -26, -78}
+, {16, 84, -2, 66}
+, {78, 79, 51, 52}
+, {56, 88, -2, 30}
+, {50, 0, -24, -74}
+, {-102, -62, -80, -40}
+, {-16, 43, -13, 46}
+, {-30, -3, -25, 2}
+, {80, 42, -44, -82}
+, {52, 44, 66, 58}
+, {72, 70, 40, 38}
+, {-48, -54, 34, 28}
+, {-48, 8, -50, 6}
+, {58, -13, 63, -8}
+, {22, 60, 20, 58}
+, {-102, -67, -39, -4}
+, {-80, 10, 4, 94}
+, {50, 59, -11, -2}
+, {-70, -84, -22, -36}
+, {68, 47, 111, 90}
+, {76, 56, 14, -6}
+, {-48, -17, -117, -86}
+, {8, -6, 70, 56}
+, {-62, -92, -72, -102}
+, {26, 65, -7, 32}
+, {-40, -13, -31, -4}
+, {-84, -7, -27, 50}
+, {-4, 26, -52, -22}
+, {-56, -25, -83, -52}
+, {-26, -76, -44, -94}
+, {34, 62, -20, 8}
+, {-88, -85, -7, -4}
+, {4, 23, 23, 42}
+, {80, 0, 0, -80}
+, {70, 65, 27, 22}
+, {-64, -78, -58, -72}
+, {86, 70, 56, 40}
+, {-102, -123, -65, -86}
+, {-46, -20, 52, 78}
+, {36, -32, -46, -114}
+, {-36, 0, -74, -38}
+, {-64, -91, 3, -24}
+, {16, 25, -57, -48}
+, {-108, -30, -88, -10}
+, {78, 46, 116, 84}
+, {-58, 6, -28, 36}
+, {-12, 37, 25, 74}
+, {-80, -57, -63, -40}
+, {18, 12, -74, -80}
+, {90, 103, 81, 94}
+, {56, -35, 5, -86}
+, {34, -31, -45, -110}
+}
+, {{60, -12, 108, 36}
+, {-32, 7, -19, 20}
+, {70, 40, 2, -28}
+, {78, 64, 134, 120}
+, {-14, 29, 67, 110}
+, {104, 88, 20, 4}
+, {66, 38, -66, -94}
+, {10, -11, -5, -26}
+, {56, 37, 125, 106}
+, {76, -9, -9, -94}
+, {106, 40, 2, -64}
+, {4, -47, 43, -8}
+, {18, -2, 94, 74}
+, {0, 17, -67, -50}
+, {-34, -63, 45, 16}
+, {-38, -75, 15, -22}
+, {6, 47, 69, 110}
+, {72, 42, 10, -20}
+, {-88, -82, -8, -2}
+, {12, 21, -43, -34}
+, {16, 24, -62, -54}
+, {-60, -65, -9, -14}
+, {84, 98, 72, 86}
+, {58, -7, 91, 26}
+, {22, 5, 29, 12}
+, {-64, 32, -86, 10}
+, {-34, -42, -26, -34}
+, {-56, -59, -95, -98}
+, {-34, 68, -20, 82}
+, {-64, -79, -19, -34}
+, {-10, -27, 17, 0}
+, {-84, -111, -125, -152}
+, {110, 26, 2, -82}
+, {78, 36, 94, 52}
+, {-94, -91, -29, -26}
+, {80, -11, 23, -68}
+, {44, -46, 50, -40}
+, {-60, -31, -131, -102}
+, {-106, -52, -70, -16}
+, {60, 25, -19, -54}
+, {68, 35, -53, -86}
+, {22, 18, 2, -2}
+, {58, 23, 89, 54}
+, {-60, -41, -103, -84}
+, {-78, -25, -81, -28}
+, {32, -38, 58, -12}
+, {-36, -52, -28, -44}
+, {60, 60, 124, 124}
+, {100, 11, 129, 40}
+, {60, 36, 36, 12}
+, {-76, 3, -99, -20}
+, {-20, 25, 29, 74}
+, {-92, -124, -26, -58}
+, {-64, 51, -47, 68}
+, {10, 2, -64, -72}
+, {-22, 12, -82, -48}
+, {-42, -70, -54, -82}
+, {28, -41, -1, -70}
+, {-66, -49, -51, -34}
+, {90, 50, 102, 62}
+, {46, 69, -17, 6}
+, {-68, 41, -51, 58}
+, {58, 31, 5, -22}
+, {0, -1, 9, 8}
+}
+, {{30, -48, -32, -110}
+, {88, 51, 37, 0}
+, {-126, -116, 6, 16}
+, {-48, -60, 26, 14}
+, {70, -20, 56, -34}
+, {-14, -130, -6, -122}
+, {-8, 30, 20, 58}
+, {44, 38, 106, 100}
+, {-110, -68, -6, 36}
+, {-98, 59, -51, 106}
+, {96, 37, 29, -30}
+, {-52, -32, -90, -70}
+, {52, 2, 98, 48}
+, {-84, -10, 18, 92}
+, {52, -11, 47, -16}
+, {-48, -21, -53, -26}
+, {4, 45, 51, 92}
+, {-96, -124, -112, -140}
+, {0, 74, 6, 80}
+, {-40, 50, 8, 98}
+, {-26, -23, 39, 42}
+, {22, 23, 3, 4}
+, {-46, -26, -60, -40}
+, {-2, 38, -24, 16}
+, {-48, -98, -28, -78}
+, {0, -89, 5, -84}
+, {-132, -106, -34, -8}
+, {62, 70, 86, 94}
+, {-50, -4, -56, -10}
+, {-46, 12, 34, 92}
+, {62, 50, 64, 52}
+, {54, 49, -5, -10}
+, {80, 39, 61, 20}
+, {52, -18, 40, -30}
+, {98, 87, 97, 86}
+, {-102, -81, -31, -10}
+, {-20, 17, -97, -60}
+, {-66, -9, -67, -10}
+, {-60, -54, -14, -8}
+, {0, 35, -13, 22}
+, {6, -8, 44, 30}
+, {-20, -32, 66, 54}
+, {-74, 15, -49, 40}
+, {-98, -54, 14, 58}
+, {4, 19, 77, 92}
+, {-42, -7, -63, -28}
+, {-68, -29, 29, 68}
+, {54, 9, 47, 2}
+, {-2, -37, -43, -78}
+, {-4, 62, -4, 62}
+, {-46, -17, -103, -74}
+, {-14, -8, 78, 84}
+, {42, -21, 1, -62}
+, {4, 11, 41, 48}
+, {54, -36, 36, -54}
+, {-44, -24, -84, -64}
+, {80, 83, -9, -6}
+, {52, 21, -3, -34}
+, {-76, -133, -61, -118}
+, {-80, 6, -12, 74}
+, {72, -9, 59, -22}
+, {12, 17, -89, -84}
+, {122, 78, -14, -58}
+, {-48, -66, 16, -2}
+}
+, {{-76, -30, 34, 80}
+, {-20, 45, -21, 44}
+, {24, -43, 67, 0}
+, {30, -26, -26, -82}
+, {-116, -112, -62, -58}
+, {-78, -127, -39, -88}
+, {76, 9, 41, -26}
+, {-44, -62, 6, -12}
+, {20, 63, 21, 64}
+, {-58, -18, 66, 106}
+, {-62, -16, -40, 6}
+, {-38, 0, -28, 10}
+, {-86, -72, -112, -98}
+, {2, -61, -13, -76}
+, {56, 30, 104, 78}
+, {92, 44, 56, 8}
+, {62, 143, 23, 104}
+, {-42, -134, 22, -70}
+, {-34, 30, -50, 14}
+, {54, 37, -47, -64}
+, {-14, 58, -46, 26}
+, {-34, -18, -6, 10}
+, {40, 17, -15, -38}
+, {66, 14, 46, -6}
+, {-64, -37, -3, 24}
+, {-98, -43, -37, 18}
+, {4, -6, 10, 0}
+, {-60, -96, -10, -46}
+, {80, -29, 45, -64}
+, {-24, -23, 13, 14}
+, {-110, -153, -51, -94}
+, {-18, -12, -42, -36}
+, {-44, 34, -14, 64}
+, {34, 68, 10, 44}
+, {-48, 10, -12, 46}
+, {-122, -111, 7, 18}
+, {-46, -20, 14, 40}
+, {48, 36, -62, -74}
+, {94, 107, 71, 84}
+, {-18, -81, -33, -96}
+, {-78, -60, -72, -54}
+, {42, 58, 56, 72}
+, {36, 6, 36, 6}
+, {40, 26, 54, 40}
+, {-24, 21, 49, 94}
+, {-2, 14, 60, 76}
+, {-62, -107, -47, -92}
+, {30, 56, 6, 32}
+, {78, 47, 103, 72}
+, {-76, -21, -127, -72}
+, {2, -35, 49, 12}
+, {72, 63, 119, 110}
+, {-38, -30, -70, -62}
+, {-82, -58, -8, 16}
+, {60, -13, 19, -54}
+, {-138, -131, -71, -64}
+, {2, 24, 84, 106}
+, {102, 89, 117, 104}
+, {-18, -42, 24, 0}
+, {100, 78, 14, -8}
+, {10, 58, 12, 60}
+, {-38, 49, -21, 66}
+, {104, 74, -20, -50}
+, {-62, -23, -23, 16}
+}
+, {{-50, 41, -19, 72}
+, {62, 25, -51, -88}
+, {0, -19, 55, 36}
+, {-30, -101, -1, -72}
+, {102, 54, 58, 10}
+, {82, 69, 15, 2}
+, {80, 74, 108, 102}
+, {-74, -52, -56, -34}
+, {-96, -73, 29, 52}
+, {30, 9, -35, -56}
+, {40, 77, 53, 90}
+, {-12, -45, 7, -26}
+, {100, 4, 92, -4}
+, {34, 36, 98, 100}
+, {-36, -32, -56, -52}
+, {58, 22, 52, 16}
+, {-66, 29, -45, 50}
+, {-90, -46, 12, 56}
+, {28, 16, 28, 16}
+, {42, 51, -13, -4}
+, {-28, 27, -71, -16}
+, {-2, -3, -15, -16}
+, {82, 36, 8, -38}
+, {-116, -54, -10, 52}
+, {-106, -31, -19, 56}
+, {-66, -51, 29, 44}
+, {14, 9, 49, 44}
+, {-2, 17, -63, -44}
+, {-40, -75, -25, -60}
+, {0, -24, -38, -62}
+, {34, 55, -57, -36}
+, {-22, 43, 47, 112}
+, {70, 23, 63, 16}
+, {-16, -58, -26, -68}
+, {-122, -127, -43, -48}
+, {-72, -25, 43, 90}
+, {18, 18, -32, -32}
+, {40, 5, -43, -78}
+, {16, -7, 65, 42}
+, {-16, 34, -66, -16}
+, {106, 4, 88, -14}
+, {-36, 27, 13, 76}
+, {-86, -29, -41, 16}
+, {88, 31, 117, 60}
+, {-92, -51, -109, -68}
+, {-6, 83, -19, 70}
+, {-22, -30, 16, 8}
+, {-78, -4, 46, 120}
+, {42, -27, -17, -86}
+, {106, 27, 37, -42}
+, {-76, -75, 15, 16}
+, {-36, 38, -76, -2}
+, {-88, -74, -74, -60}
+, {-62, -44, -8, 10}
+, {-44, -61, 19, 2}
+, {-38, -64, -64, -90}
+, {90, -3, 41, -52}
+, {76, 83, -9, -2}
+, {2, 63, 23, 84}
+, {-88, -9, -49, 30}
+, {60, 13, -1, -48}
+, {70, 109, 23, 62}
+, {-80, 2, -88, -6}
+, {100, 97, 3, 0}
+}
+, {{38, 25, 21, 8}
+, {0, 0, -22, -22}
+, {-34, -64, -42, -72}
+, {72, 8, -62, -126}
+, {-72, -85, -43, -56}
+, {44, 37, 59, 52}
+, {12, 98, -18, 68}
+, {108, 75, 113, 80}
+, {102, -6, 36, -72}
+, {64, 81, 7, 24}
+, {58, 40, 6, -12}
+, {102, -24, 58, -68}
+, {30, 48, 46, 64}
+, {50, 81, -21, 10}
+, {94, 118, 86, 110}
+, {92, 30, 62, 0}
+, {-62, -92, -44, -74}
+, {-108, -50, -110, -52}
+, {-84, -36, -112, -64}
+, {76, 73, 101, 98}
+, {56, 23, 33, 0}
+, {-112, -181, -59, -128}
+, {-76, -48, -8, 20}
+, {26, -83, 25, -84}
+, {-86, -149, -63, -126}
+, {78, 83, 85, 90}
+, {30, 93, 31, 94}
+, {90, 64, -22, -48}
+, {-12, -47, -31, -66}
+, {-2, 43, -41, 4}
+, {-8, -64, -8, -64}
+, {94, -1, 55, -40}
+, {86, 83, 59, 56}
+, {36, 65, 21, 50}
+, {24, -6, 32, 2}
+, {-16, -114, -14, -112}
+, {92, 112, 58, 78}
+, {96, 98, 98, 100}
+, {-24, -86, -20, -82}
+, {-80, -88, -44, -52}
+, {98, -41, 49, -90}
+, {38, 100, -4, 58}
+, {44, -63, 25, -82}
+, {94, 6, 86, -2}
+, {-84, -57, -7, 20}
+, {68, -28, 42, -54}
+, {-52, -35, -117, -100}
+, {-36, -78, 22, -20}
+, {0, -101, 29, -72}
+, {-32, 39, 21, 92}
+, {44, 105, 35, 96}
+, {-4, 18, 78, 100}
+, {26, -21, -7, -54}
+, {-66, -28, -66, -28}
+, {104, 57, 141, 94}
+, {-12, -97, -23, -108}
+, {104, 1, 39, -64}
+, {-54, 30, -48, 36}
+, {-134, -40, -36, 58}
+, {-2, 15, 23, 40}
+, {86, 40, -24, -70}
+, {24, 55, 7, 38}
+, {60, 60, 50, 50}
+, {96, 2, 12, -82}
+}
+, {{-72, -24, -82, -34}
+, {-12, -13, -63, -64}
+, {46, 76, 56, 86}
+, {-42, -6, -64, -28}
+, {-76, 50, -24, 102}
+, {-84, -34, -2, 48}
+, {0, -3, -3, -6}
+, {-70, 2, -88, -16}
+, {-108, -51, -71, -14}
+, {78, 89, 109, 120}
+, {-52, 93, -15, 130}
+, {-76, 25, -51, 50}
+, {36, 20, -12, -28}
+, {-10, 49, -11, 48}
+, {16, 22, 28, 34}
+, {-22, -6, -62, -46}
+, {-92, -132, -38, -78}
+, {-56, -22, -90, -56}
+, {-66, 26, -66, 26}
+, {52, -9, 47, -14}
+, {88, 41, 19, -28}
+, {-26, -41, -25, -40}
+, {-54, -54, 32, 32}
+, {38, 68, 80, 110}
+, {-62, -38, -74, -50}
+, {64, -31, 1, -94}
+, {32, -20, 20, -32}
+, {-48, -33, 15, 30}
+, {-64, -42, 26, 48}
+, {12, 66, -56, -2}
+, {-34, -16, -12, 6}
+, {0, -7, -39, -46}
+, {-84, -29, -119, -64}
+, {36, 90, -16, 38}
+, {92, 139, -7, 40}
+, {-6, -9, 31, 28}
+, {-26, 22, -74, -26}
+, {96, -17, 29, -84}
+, {-8, 8, -30, -14}
+, {-38, -25, -87, -74}
+, {-68, 2, -26, 44}
+, {-136, -130, -22, -16}
+, {-32, -36, -50, -54}
+, {20, 61, -15, 26}
+, {42, 52, 58, 68}
+, {-120, -131, -29, -40}
+, {12, -40, -40, -92}
+, {68, -45, 41, -72}
+, {128, 51, 45, -32}
+, {-60, -48, 58, 70}
+, {-84, -95, -47, -58}
+, {32, 92, 16, 76}
+, {86, 48, 98, 60}
+, {36, -44, 12, -68}
+, {48, 33, -53, -68}
+, {28, 107, 23, 102}
+, {78, 44, 56, 22}
+, {-80, -28, -106, -54}
+, {156, 135, 119, 98}
+, {98, 14, 84, 0}
+, {102, 48, -32, -86}
+, {8, -10, 18, 0}
+, {-68, 30, -8, 90}
+, {76, 81, 11, 16}
+}
+, {{14, 24, -48, -38}
+, {30, -58, 32, -56}
+, {32, 37, 103, 108}
+, {6, 50, 68, 112}
+, {8, 52, -48, -4}
+, {70, 37, 7, -26}
+, {20, 25, 33, 38}
+, {112, 100, 42, 30}
+, {-44, 4, 22, 70}
+, {70, -17, 85, -2}
+, {86, 76, -36, -46}
+, {-108, -21, -13, 74}
+, {58, 87, 7, 36}
+, {22, 49, -57, -30}
+, {-68, -71, -1, -4}
+, {46, 49, -45, -42}
+, {-38, -51, 39, 26}
+, {-78, 43, -43, 78}
+, {66, 45, 55, 34}
+, {34, 23, 105, 94}
+, {-108, -37, 13, 84}
+, {-50, 45, -15, 80}
+, {92, 4, 68, -20}
+, {-88, 19, -39, 68}
+, {90, 83, 47, 40}
+, {20, 18, -6, -8}
+, {-26, -42, 58, 42}
+, {20, 53, 73, 106}
+, {-22, -39, 3, -14}
+, {-86, -39, -71, -24}
+, {-44, -75, -61, -92}
+, {-40, -7, 57, 90}
+, {-86, 3, -19, 70}
+, {62, 6, 0, -56}
+, {10, 34, -28, -4}
+, {78, 68, -54, -64}
+, {50, -48, -24, -122}
+, {6, 41, 35, 70}
+, {98, 31, 85, 18}
+, {42, 31, 75, 64}
+, {20, -26, -14, -60}
+, {44, 20, -24, -48}
+, {-32, -28, -74, -70}
+, {-20, -17, -91, -88}
+, {-80, -39, -61, -20}
+, {-82, -36, -120, -74}
+, {-34, 53, -41, 46}
+, {0, 25, 41, 66}
+, {116, 70, 94, 48}
+, {-12, 27, 13, 52}
+, {-30, -36, 30, 24}
+, {-46, -107, -21, -82}
+, {8, 69, -5, 56}
+, {-44, -34, 14, 24}
+, {62, -20, 4, -78}
+, {2, 4, -52, -50}
+, {104, 31, 131, 58}
+, {86, 20, -42, -108}
+, {68, 15, -7, -60}
+, {-30, -67, -7, -44}
+, {-88, -87, -87, -86}
+, {-80, 4, -8, 76}
+, {32, -21, 31, -22}
+, {72, -49, 43, -78}
+}
+, {{48, 29, -51, -70}
+, {-28, 23, 23, 74}
+, {-76, -93, 33, 16}
+, {-18, -45, -89, -116}
+, {2, 24, 56, 78}
+, {66, -53, 17, -102}
+, {-32, 8, -20, 20}
+, {-10, 44, -24, 30}
+, {16, 5, -11, -22}
+, {74, 12, 80, 18}
+, {-40, -3, -65, -28}
+, {32, 118, 16, 102}
+, {2, 51, -39, 10}
+, {-44, -57, 21, 8}
+, {-76, -41, 53, 88}
+, {70, 31, 71, 32}
+, {-74, 10, 18, 102}
+, {102, -8, 48, -62}
+, {-20, 5, -17, 8}
+, {-68, -68, -28, -28}
+, {46, -10, -2, -58}
+, {-108, -76, 16, 48}
+, {28, 0, -18, -46}
+, {26, 46, 92, 112}
+, {-82, 44, -38, 88}
+, {50, 4, 8, -38}
+, {-36, -59, 33, 10}
+, {24, 104, 18, 98}
+, {-92, -85, -23, -16}
+, {56, 94, -20, 18}
+, {6, -13, 71, 52}
+, {-108, -118, -70, -80}
+, {-26, -81, -13, -68}
+, {66, -26, 84, -8}
+, {-30, 15, -93, -48}
+, {-76, -104, -40, -68}
+, {-12, -14, 10, 8}
+, {-38, 34, -38, 34}
+, {-2, 36, -2, 36}
+, {14, -35, 21, -28}
+, {-10, 6, 62, 78}
+, {64, 83, -15, 4}
+, {34, -2, -2, -38}
+, {-82, -100, -70, -88}
+, {-86, 41, -39, 88}
+, {-6, -31, -9, -34}
+, {-70, -18, 24, 76}
+, {-74, -41, -101, -68}
+, {86, 127, 61, 102}
+, {-52, -39, -87, -74}
+, {-64, -42, -36, -14}
+, {-2, -30, -62, -90}
+, {-70, -36, -14, 20}
+, {-76, -91, -57, -72}
+, {-32, -88, -10, -66}
+, {-38, -32, 52, 58}
+, {54, 47, 85, 78}
+, {86, 146, 36, 96}
+, {-90, -11, -69, 10}
+, {28, -40, 0, -68}
+, {50, 37, 117, 104}
+, {-6, 40, 52, 98}
+, {108, 16, 68, -24}
+, {56, -29, -19, -104}
+}
+, {{-80, -63, -95, -78}
+, {-84, -33, 1, 52}
+, {58, 65, 19, 26}
+, {80, 77, 101, 98}
+, {-70, 29, -25, 74}
+, {60, 1, -43, -102}
+, {28, 13, -27, -42}
+, {-56, 24, -22, 58}
+, {-98, -106, -68, -76}
+, {40, 18, 6, -16}
+, {-14, 18, 0, 32}
+, {116, 72, 42, -2}
+, {64, -7, 9, -62}
+, {32, -55, -7, -94}
+, {22, 28, 34, 40}
+, {-108, -9, -77, 22}
+, {96, 56, 118, 78}
+, {20, 14, 32, 26}
+, {50, 2, 14, -34}
+, {-26, 4, -36, -6}
+, {8, -30, 52, 14}
+, {84, 103, 29, 48}
+, {-16, 20, 20, 56}
+, {-36, 25, -89, -28}
+, {52, 33, 85, 66}
+, {38, 8, 42, 12}
+, {70, 100, 60, 90}
+, {-62, -26, -90, -54}
+, {62, 14, 48, 0}
+, {26, -49, -15, -90}
+, {-28, -100, -24, -96}
+, {-4, 10, 10, 24}
+, {-26, -15, 79, 90}
+, {-8, 41, 11, 60}
+, {-6, 56, -32, 30}
+, {-44, -28, -16, 0}
+, {-72, 11, -23, 60}
+, {70, -30, 62, -38}
+, {122, 143, 93, 114}
+, {-44, -66, 34, 12}
+, {-4, 71, -9, 66}
+, {32, -30, -10, -72}
+, {-26, -10, -84, -68}
+, {28, 18, 50, 40}
+, {104, 65, 133, 94}
+, {100, 29, 71, 0}
+, {-40, -100, -18, -78}
+, {38, -3, 59, 18}
+, {-52, -86, -28, -62}
+, {8, 70, -20, 42}
+, {-82, -68, 4, 18}
+, {126, 91, 139, 104}
+, {60, 33, 121, 94}
+, {-74, -25, -91, -42}
+, {30, -64, 8, -86}
+, {-32, 30, -38, 24}
+, {38, 11, -29, -56}
+, {96, 52, 68, 24}
+, {-76, -21, 33, 88}
+, {72, 37, -57, -92}
+, {74, 97, 39, 62}
+, {-40, -39, -47, -46}
+, {12, -31, 45, 2}
+, {58, -17, 53, -22}
+}
+, {{94, -15, 23, -86}
+, {-4, 26, 64, 94}
+, {80, 39, 37, -4}
+, {88, 31, 73, 16}
+, {10, -10, 70, 50}
+, {64, -12, -2, -78}
+, {-92, 39, -65, 66}
+, {40, -20, 68, 8}
+, {68, 32, -50, -86}
+, {56, -27, 23, -60}
+, {50, 94, 26, 70}
+, {82, 16, -20, -86}
+, {16, 33, 33, 50}
+, {-60, -32, -114, -86}
+, {20, -63, 11, -72}
+, {-48, -58, -42, -52}
+, {102, -6, 82, -26}
+, {-68, -13, -27, 28}
+, {-24, -17, -61, -54}
+, {-2, -11, 21, 12}
+, {58, 80, 14, 36}
+, {-12, -36, -88, -112}
+, {98, 90, 30, 22}
+, {4, -49, -15, -68}
+, {16, 80, 24, 88}
+, {102, 97, 101, 96}
+, {74, 69, -69, -74}
+, {100, 39, -13, -74}
+, {100, 36, 44, -20}
+, {16, -51, -29, -96}
+, {-96, -125, -51, -80}
+, {-16, 101, 25, 142}
+, {-56, 31, -25, 62}
+, {40, 95, -7, 48}
+, {44, 74, -14, 16}
+, {28, -59, 13, -74}
+, {-12, 36, 50, 98}
+, {-86, -78, -32, -24}
+, {-80, -44, 30, 66}
+, {-94, -38, -24, 32}
+, {64, 82, -14, 4}
+, {-50, -62, -12, -24}
+, {32, -1, -65, -98}
+, {-80, -50, -48, -18}
+, {-18, -12, 72, 78}
+, {50, 0, 24, -26}
+, {20, 15, -59, -64}
+, {136, 154, -10, 8}
+, {-62, -85, -45, -68}
+, {10, 37, 37, 64}
+, {-72, -66, -76, -70}
+, {2, 66, 66, 130}
+, {-36, -20, -86, -70}
+, {22, 22, 22, 22}
+, {-92, -65, -81, -54}
+, {-34, 89, -5, 118}
+, {96, 117, 39, 60}
+, {-56, 73, 11, 140}
+, {-46, -18, -74, -46}
+, {32, 24, 88, 80}
+, {-98, -64, -64, -30}
+, {84, 15, 15, -54}
+, {0, 28, 24, 52}
+, {58, -40, 72, -26}
+}
+, {{110, 58, 62, 10}
+, {-12, 37, -63, -14}
+, {40, 11, 43, 14}
+, {100, 60, -6, -46}
+, {-90, -48, -38, 4}
+, {-80, -54, -102, -76}
+, {24, -6, 46, 16}
+, {52, -14, 34, -32}
+, {2, -61, 53, -10}
+, {-46, 7, -29, 24}
+, {10, -29, 49, 10}
+, {54, -2, 56, 0}
+, {-76, -13, 33, 96}
+, {-106, -68, -134, -96}
+, {-52, -59, -67, -74}
+, {-86, -102, -70, -86}
+, {-78, -19, 9, 68}
+, {12, 20, -68, -60}
+, {64, -27, 67, -24}
+, {18, -29, 41, -6}
+, {22, 57, -9, 26}
+, {-80, -142, -38, -100}
+, {-80, -64, -60, -44}
+, {20, -3, -23, -46}
+, {-80, -33, -33, 14}
+, {-66, 12, -36, 42}
+, {-106, -48, 18, 76}
+, {10, -40, 44, -6}
+, {26, 33, 17, 24}
+, {74, 56, 52, 34}
+, {-20, 5, -27, -2}
+, {-8, 14, -14, 8}
+, {-92, -35, -19, 38}
+, {-12, 0, 42, 54}
+, {-6, -56, 26, -24}
+, {-62, -9, -9, 44}
+, {-10, 35, 9, 54}
+, {42, 16, 118, 92}
+, {24, 42, 74, 92}
+, {-70, 50, -38, 82}
+, {-38, -31, -115, -108}
+, {-66, -15, -93, -42}
+, {80, 81, -5, -4}
+, {62, -22, 40, -44}
+, {98, 88, 98, 88}
+, {-54, -15, -113, -74}
+, {-26, -26, 24, 24}
+, {-42, 14, -56, 0}
+, {-58, -48, -48, -38}
+, {16, -49, -9, -74}
+, {72, 11, 113, 52}
+, {70, 39, 109, 78}
+, {-54, -46, -62, -54}
+, {-10, -60, 22, -28}
+, {-72, -122, -36, -86}
+, {66, -7, 31, -42}
+, {68, 92, 20, 44}
+, {42, 108, 44, 110}
+, {-60, 20, -42, 38}
+, {-104, 11, -53, 62}
+, {18, 13, -93, -98}
+, {74, 31, 109, 66}
+, {-42, 24, -14, 52}
+, {28, -7, 41, 6}
+}
+, {{-128, -77, -55, -4}
+, {34, 76, 24, 66}
+, {90, 96, 58, 64}
+, {78, 103, 61, 86}
+, {12, 77, -15, 50}
+, {96, 91, -15, -20}
+, {46, 46, 24, 24}
+, {2, 6, 2, 6}
+, {-14, -45, -41, -72}
+, {-52, -126, -14, -88}
+, {90, -9, 59, -40}
+, {10, -28, 2, -36}
+, {-32, -46, -60, -74}
+, {20, 95, 19, 94}
+, {82, 34, 102, 54}
+, {-6, 27, -3, 30}
+, {-50, 28, -38, 40}
+, {104, 16, 50, -38}
+, {-54, -4, -14, 36}
+, {44, 29, -7, -22}
+, {-32, -16, 64, 80}
+, {-16, -59, -69, -112}
+, {-44, -92, -2, -50}
+, {44, 35, 15, 6}
+, {64, -28, 44, -48}
+, {122, 60, 78, 16}
+, {146, 72, 40, -34}
+, {-34, -75, -47, -88}
+, {30, 106, 34, 110}
+, {30, -53, -5, -88}
+, {64, 8, 18, -38}
+, {148, 130, 74, 56}
+, {-74, -30, -48, -4}
+, {-28, -11, -53, -36}
+, {52, 2, -64, -114}
+, {6, 2, 72, 68}
+, {18, 51, -43, -10}
+, {90, 16, 42, -32}
+, {48, -65, 55, -58}
+, {-36, 104, -6, 134}
+, {56, 66, 102, 112}
+, {90, 21, 7, -62}
+, {-74, -109, -45, -80}
+, {24, 101, 13, 90}
+, {0, 36, -66, -30}
+, {-40, -109, -43, -112}
+, {-68, 17, -35, 50}
+, {-44, -10, -42, -8}
+, {60, 115, 37, 92}
+, {-34, -30, -80, -76}
+, {-106, 2, -14, 94}
+, {-82, -41, -75, -34}
+, {-62, -32, -124, -94}
+, {52, -12, 2, -62}
+, {-56, -46, 2, 12}
+, {-4, -28, -44, -68}
+, {56, 99, -1, 42}
+, {-40, -13, 49, 76}
+, {94, 143, 1, 50}
+, {-64, -6, -36, 22}
+, {-24, -13, -31, -20}
+, {-78, 26, -30, 74}
+, {16, 35, 55, 74}
+, {-54, -58, -38, -42}
+}
+, {{86, 62, -30, -54}
+, {-58, 68, -32, 94}
+, {-108, -135, -31, -58}
+, {18, -14, -44, -76}
+, {42, 20, 30, 8}
+, {-36, -44, -60, -68}
+, {66, 93, 47, 74}
+, {64, 84, 58, 78}
+, {-94, -41, -23, 30}
+, {74, 144, 32, 102}
+, {78, 119, 13, 54}
+, {-26, 32, 54, 112}
+, {34, -81, 19, -96}
+, {72, 67, 89, 84}
+, {64, 48, 66, 50}
+, {66, -32, 20, -78}
+, {42, -11, -29, -82}
+, {24, -19, -3, -46}
+, {16, 94, 22, 100}
+, {20, 17, 11, 8}
+, {-82, -97, -11, -26}
+, {-68, -100, -92, -124}
+, {-58, -85, -67, -94}
+, {104, 78, 36, 10}
+, {86, -53, 45, -94}
+, {74, 52, 92, 70}
+, {78, 30, -2, -50}
+, {-52, 67, -41, 78}
+, {-16, 30, 0, 46}
+, {44, 120, 20, 96}
+, {104, 122, 18, 36}
+, {4, 20, 58, 74}
+, {-44, -84, -30, -70}
+, {-16, -41, 29, 4}
+, {24, 53, 49, 78}
+, {84, 62, -44, -66}
+, {-52, -32, -68, -48}
+, {-40, 60, -24, 76}
+, {54, 91, 71, 108}
+, {0, 22, 50, 72}
+, {64, 103, 39, 78}
+, {-24, 48, 20, 92}
+, {-74, -83, -65, -74}
+, {50, 24, -58, -84}
+, {108, 114, 36, 42}
+, {-48, -119, -39, -110}
+, {-12, 15, -67, -40}
+, {-36, 35, -59, 12}
+, {-20, 11, -21, 10}
+, {98, 156, 44, 102}
+, {-16, 19, -29, 6}
+, {-38, 13, -35, 16}
+, {-2, 31, -23, 10}
+, {-96, -14, -18, 64}
+, {104, 10, 62, -32}
+, {-2, -77, -1, -76}
+, {100, 76, -16, -40}
+, {80, 5, 33, -42}
+, {124, 31, 63, -30}
+, {-64, 38, -34, 68}
+, {-54, 4, 38, 96}
+, {-58, -34, 50, 74}
+, {78, 67, 29, 18}
+, {16, -9, 67, 42}
+}
+, {{90, 101, 3, 14}
+, {-68, -22, -10, 36}
+, {54, -2, 68, 12}
+, {-124, -127, -63, -66}
+, {60, 77, 61, 78}
+, {82, -21, 81, -22}
+, {-24, -22, 40, 42}
+, {108, 81, 111, 84}
+, {66, 33, 43, 10}
+, {-34, 0, 12, 46}
+, {-102, -68, -122, -88}
+, {-44, -29, -21, -6}
+, {-12, 30, 24, 66}
+, {-50, -58, -6, -14}
+, {58, 52, 86, 80}
+, {-76, 18, -12, 82}
+, {18, -72, -6, -96}
+, {-82, -46, -90, -54}
+, {-4, -7, 59, 56}
+, {82, 126, 24, 68}
+, {70, 42, 48, 20}
+, {-66, -8, -38, 20}
+, {-62, -103, -43, -84}
+, {48, 95, 39, 86}
+, {106, -16, 52, -70}
+, {-82, -86, 16, 12}
+, {76, -29, 3, -102}
+, {38, -11, -45, -94}
+, {-18, -30, 14, 2}
+, {16, 40, 28, 52}
+, {40, 76, -26, 10}
+, {-18, -15, -3, 0}
+, {-16, 57, -17, 56}
+, {62, 43, 117, 98}
+, {106, 24, 24, -58}
+, {38, -68, 4, -102}
+, {8, 30, -22, 0}
+, {72, 40, 14, -18}
+, {50, 14, -48, -84}
+, {56, 13, 99, 56}
+, {-96, -66, -66, -36}
+, {106, 74, -26, -58}
+, {50, 18, 94, 62}
+, {-2, 52, 42, 96}
+, {34, 54, 64, 84}
+, {-24, -46, -16, -38}
+, {-40, -54, 46, 32}
+, {-14, 12, -10, 16}
+, {38, 51, 89, 102}
+, {-50, 63, -11, 102}
+, {-78, -67, -41, -30}
+, {2, 9, 69, 76}
+, {-58, 29, -71, 16}
+, {50, 47, 51, 48}
+, {96, 128, 60, 92}
+, {-4, 61, 33, 98}
+, {90, 100, 76, 86}
+, {74, 90, 84, 100}
+, {38, 48, 46, 56}
+, {-92, -63, -9, 20}
+, {110, 44, -4, -70}
+, {-26, -19, 65, 72}
+, {44, -2, -54, -100}
+, {48, 79, 23, 54}
+}
+, {{-96, -62, -6, 28}
+, {106, 12, 56, -38}
+, {14, 43, 5, 34}
+, {62, 128, 64, 130}
+, {114, 3, 63, -48}
+, {100, 57, 51, 8}
+, {86, 84, 66, 64}
+, {14, 30, -70, -54}
+, {38, -11, -33, -82}
+, {-78, -56, 10, 32}
+, {-14, 13, -65, -38}
+, {38, 75, 75, 112}
+, {-4, -64, 36, -24}
+, {-4, -52, -66, -114}
+, {4, -32, 24, -12}
+, {40, -61, 23, -78}
+, {46, 6, 70, 30}
+, {-120, -95, -9, 16}
+, {8, 31, 21, 44}
+, {108, -9, 65, -52}
+, {-110, -43, -15, 52}
+, {-2, 46, 40, 88}
+, {36, 34, 54, 52}
+, {26, 23, -65, -68}
+, {-22, -37, 37, 22}
+, {-10, 24, -10, 24}
+, {-42, 74, -22, 94}
+, {98, 151, 51, 104}
+, {72, 64, 44, 36}
+, {44, -59, 43, -60}
+, {-24, -70, -76, -122}
+, {40, 49, 59, 68}
+, {62, 101, -9, 30}
+, {-44, -12, -8, 24}
+, {20, 30, -44, -34}
+, {-16, -11, 7, 12}
+, {-66, -77, -37, -48}
+, {-110, -120, -58, -68}
+, {104, 52, 34, -18}
+, {32, 12, -38, -58}
+, {76, 28, 30, -18}
+, {-30, -5, 57, 82}
+, {34, 88, 32, 86}
+, {-46, -56, 42, 32}
+, {-94, -45, 33, 82}
+, {-56, -57, -43, -44}
+, {50, 27, 107, 84}
+, {2, 19, 59, 76}
+, {-48, 17, -101, -36}
+, {-70, 19, -73, 16}
+, {84, 106, 68, 90}
+, {40, 35, 77, 72}
+, {68, 4, 76, 12}
+, {26, 7, 35, 16}
+, {-58, -85, 7, -20}
+, {52, -7, 47, -12}
+, {-82, -33, 33, 82}
+, {-14, -56, -42, -84}
+, {-48, -29, -61, -42}
+, {62, -26, -2, -90}
+, {30, 23, -11, -18}
+, {36, 10, -50, -76}
+, {66, 35, 39, 8}
+, {-78, -128, -16, -66}
+}
+, {{6, 3, -17, -20}
+, {-86, -11, 9, 84}
+, {0, 30, -14, 16}
+, {-122, -45, -53, 24}
+, {24, 19, -1, -6}
+, {82, -19, 47, -54}
+, {-50, 51, -15, 86}
+, {-88, -101, -49, -62}
+, {86, 76, 58, 48}
+, {36, -40, -10, -86}
+, {-8, -45, 31, -6}
+, {96, 51, -27, -72}
+, {-88, -55, 25, 58}
+, {-2, 12, 78, 92}
+, {96, 94, 48, 46}
+, {50, 26, 2, -22}
+, {26, 22, -78, -82}
+, {-30, 54, 36, 120}
+, {22, -25, -7, -54}
+, {16, 38, -70, -48}
+, {-88, -72, -48, -32}
+, {-110, -3, -47, 60}
+, {102, 88, 82, 68}
+, {-14, 15, -13, 16}
+, {28, -36, -32, -96}
+, {90, 54, 70, 34}
+, {-90, -51, -67, -28}
+, {88, 30, -8, -66}
+, {-80, -17, -35, 28}
+, {-8, -16, 56, 48}
+, {72, 78, 92, 98}
+, {-42, 32, 2, 76}
+, {-46, -27, 13, 32}
+, {48, 48, 10, 10}
+, {-68, -109, -27, -68}
+, {-4, 85, 21, 110}
+, {-64, -52, -2, 10}
+, {106, 107, 85, 86}
+, {22, -47, -27, -96}
+, {134, 108, 58, 32}
+, {102, 125, 27, 50}
+, {-6, -29, -73, -96}
+, {-34, -22, 56, 68}
+, {68, 86, 14, 32}
+, {-44, 17, 31, 92}
+, {48, -19, 33, -34}
+, {-64, -28, 16, 52}
+, {-62, -27, -7, 28}
+, {-90, -117, -27, -54}
+, {40, 22, 54, 36}
+, {84, 11, 91, 18}
+, {-56, 20, -66, 10}
+, {-54, -27, 63, 90}
+, {-102, -71, -117, -86}
+, {-18, 39, -41, 16}
+, {110, 81, 111, 82}
+, {-64, -66, -4, -6}
+, {-4, 16, 40, 60}
+, {-98, -159, -37, -98}
+, {-22, 3, -55, -30}
+, {84, 52, -28, -60}
+, {14, 20, 86, 92}
+, {-80, -35, 11, 56}
+, {72, 121, 19, 68}
+}
+, {{-86, -45, -71, -30}
+, {42, -32, 52, -22}
+, {-132, -17, -125, -10}
+, {32, 83, 59, 110}
+, {-16, 13, 39, 68}
+, {-102, -77, -21, 4}
+, {-50, -76, -76, -102}
+, {68, -42, 42, -68}
+, {20, -26, 20, -26}
+, {90, 106, 34, 50}
+, {-96, 25, -71, 50}
+, {-84, -41, 53, 96}
+, {-8, 69, 11, 88}
+, {-12, -3, 47, 56}
+, {28, 34, 52, 58}
+, {-60, -12, -74, -26}
+, {94, -31, 73, -52}
+, {14, 55, -5, 36}
+, {-72, 11, -69, 14}
+, {-90, 38, -42, 86}
+, {78, 9, 53, -16}
+, {-70, 10, -60, 20}
+, {-28, 30, -38, 20}
+, {104, 21, 69, -14}
+, {-62, -51, 25, 36}
+, {26, -7, 55, 22}
+, {78, 1, 1, -76}
+, {-32, -23, -81, -72}
+, {-50, -98, -44, -92}
+, {-24, 2, 0, 26}
+, {36, -58, 52, -42}
+, {-86, -96, 36, 26}
+, {12, -17, -35, -64}
+, {-66, -31, -7, 28}
+, {110, 20, 10, -80}
+, {96, 47, 75, 26}
+, {32, -7, 71, 32}
+, {-104, -32, -68, 4}
+, {-18, -15, -63, -60}
+, {-30, 22, 22, 74}
+, {60, -5, 45, -20}
+, {38, -68, 16, -90}
+, {46, 46, -18, -18}
+, {-94, -42, -28, 24}
+, {90, 69, 17, -4}
+, {8, 68, -16, 44}
+, {84, 13, 123, 52}
+, {-60, -133, -15, -88}
+, {-38, 67, -21, 84}
+, {-66, -25, 23, 64}
+, {0, 11, -57, -46}
+, {-26, -95, 15, -54}
+, {12, 68, 44, 100}
+, {94, 114, 62, 82}
+, {-16, 38, 2, 56}
+, {94, 45, 129, 80}
+, {-78, 1, -9, 70}
+, {16, 15, -7, -8}
+, {28, 110, -6, 76}
+, {10, -24, -46, -80}
+, {-10, 34, -38, 6}
+, {54, -4, 40, -18}
+, {108, 103, 113, 108}
+, {-44, -91, 19, -28}
+}
+, {{4, -24, 32, 4}
+, {4, 23, 23, 42}
+, {40, 24, 26, 10}
+, {-58, -43, 9, 24}
+, {58, -1, 19, -40}
+, {84, 56, 58, 30}
+, {62, 4, 30, -28}
+, {8, -75, -19, -102}
+, {34, 83, -13, 36}
+, {-36, -111, -35, -110}
+, {54, 70, 74, 90}
+, {-72, -50, 54, 76}
+, {56, -40, 6, -90}
+, {-2, -36, -50, -84}
+, {-94, -42, -114, -62}
+, {-16, 60, 28, 104}
+, {-6, 67, 1, 74}
+, {-110, -98, -98, -86}
+, {-30, 1, -57, -26}
+, {88, 99, 13, 24}
+, {54, 8, 82, 36}
+, {74, 15, 53, -6}
+, {-102, -58, 16, 60}
+, {70, 53, -11, -28}
+, {-98, -63, -5, 30}
+, {-82, 29, 5, 116}
+, {84, 82, -14, -16}
+, {-20, 4, -74, -50}
+, {-40, 71, 5, 116}
+, {4, -3, 17, 10}
+, {14, -33, 81, 34}
+, {50, 95, 93, 138}
+, {-22, 66, -8, 80}
+, {-36, -26, -66, -56}
+, {48, 19, 51, 22}
+, {-46, -67, 11, -10}
+, {-82, -101, -1, -20}
+, {104, 31, 47, -26}
+, {50, 63, 79, 92}
+, {-94, -19, -87, -12}
+, {-58, -78, -38, -58}
+, {-44, 7, 33, 84}
+, {-28, -34, 56, 50}
+, {34, 88, -18, 36}
+, {-14, 9, 59, 82}
+, {-22, 44, -10, 56}
+, {-20, 24, 36, 80}
+, {-62, 81, -33, 110}
+, {66, 91, 11, 36}
+, {-32, -45, 31, 18}
+, {-48, 3, -49, 2}
+, {74, 65, 25, 16}
+, {22, 37, 87, 102}
+, {88, 7, 43, -38}
+, {54, -9, 43, -20}
+, {-114, -39, -43, 32}
+, {6, 4, 54, 52}
+, {-34, -49, -15, -30}
+, {-6, -4, 30, 32}
+, {52, -63, 29, -86}
+, {-94, -64, 26, 56}
+, {-84, -17, -31, 36}
+, {50, 62, 40, 52}
+, {0, 28, -84, -56}
+}
+, {{62, -9, -3, -74}
+, {-78, -57, 15, 36}
+, {-2, 47, 7, 56}
+, {16, 8, -48, -56}
+, {4, 68, 36, 100}
+, {-42, -41, -89, -88}
+, {-92, -27, 31, 96}
+, {82, 23, 115, 56}
+, {28, 77, 67, 116}
+, {56, 48, 68, 60}
+, {-58, -80, -66, -88}
+, {34, 8, -8, -34}
+, {-20, -2, 48, 66}
+, {34, -1, -19, -54}
+, {72, 97, 17, 42}
+, {-28, -92, 2, -62}
+, {-18, -25, -99, -106}
+, {-64, -41, -29, -6}
+, {20, 5, 31, 16}
+, {-30, -85, 9, -46}
+, {-16, -57, 31, -10}
+, {46, 68, 38, 60}
+, {76, 31, -1, -46}
+, {-40, -41, -45, -46}
+, {30, -14, -6, -50}
+, {62, 30, -50, -82}
+, {14, 79, -45, 20}
+, {6, 76, 20, 90}
+, {110, 79, 43, 12}
+, {-12, -63, -45, -96}
+, {-38, 3, 65, 106}
+, {34, 68, 58, 92}
+, {-56, 18, -12, 62}
+, {-60, -39, 1, 22}
+, {-82, -44, -108, -70}
+, {-52, 5, 17, 74}
+, {0, -44, 42, -2}
+, {6, -39, -41, -86}
+, {76, 51, 95, 70}
+, {42, 3, 39, 0}
+, {44, -20, -40, -104}
+, {0, -74, -4, -78}
+, {96, 56, 16, -24}
+, {-46, -54, -42, -50}
+, {100, 67, -23, -56}
+, {-18, -50, 10, -22}
+, {-116, -97, -1, 18}
+, {34, -23, 1, -56}
+, {-92, -89, -25, -22}
+, {-54, -9, -67, -22}
+, {64, 60, 54, 50}
+, {46, 46, 44, 44}
+, {-10, -59, -49, -98}
+, {24, -83, -15, -122}
+, {30, 47, -25, -8}
+, {4, 19, 33, 48}
+, {42, -22, 10, -54}
+, {80, -19, 17, -82}
+, {70, 90, 12, 32}
+, {-62, 8, -36, 34}
+, {36, 31, -1, -6}
+, {-72, 9, -11, 70}
+, {-52, -58, -12, -18}
+, {-86, -20, -66, 0}
+}
+, {{16, 37, -45, -24}
+, {38, 35, 53, 50}
+, {44, 77, 17, 50}
+, {110, 59, -43, -94}
+, {-54, -28, -134, -108}
+, {38, 52, 102, 116}
+, {64, 15, -37, -86}
+, {-48, -2, -100, -54}
+, {10, -14, -68, -92}
+, {32, 41, -25, -16}
+, {12, 64, -12, 40}
+, {-28, 11, -33, 6}
+, {84, 83, 25, 24}
+, {-142, -143, -99, -100}
+, {-42, 81, -23, 100}
+, {0, -21, 65, 44}
+, {-58, 5, -5, 58}
+, {-36, 24, 70, 130}
+, {-36, -6, -78, -48}
+, {-16, 24, 20, 60}
+, {-58, 29, 17, 104}
+, {66, 25, 21, -20}
+, {84, -22, 64, -42}
+, {0, 75, 9, 84}
+, {68, 11, 19, -38}
+, {74, 42, -10, -42}
+, {32, 106, 46, 120}
+, {-22, 44, 2, 68}
+, {70, 118, 60, 108}
+, {-18, 91, -15, 94}
+, {2, -42, -46, -90}
+, {34, 4, 52, 22}
+, {6, -3, 83, 74}
+, {0, 48, -2, 46}
+, {-56, -15, -61, -20}
+, {72, 12, 102, 42}
+, {-62, -43, 61, 80}
+, {-14, -51, 31, -6}
+, {86, 21, 55, -10}
+, {-36, 43, -23, 56}
+, {-102, -105, -29, -32}
+, {52, -26, 4, -74}
+, {90, 25, 105, 40}
+, {68, 92, 64, 88}
+, {-10, -43, 3, -30}
+, {-4, -3, -23, -22}
+, {46, 33, -73, -86}
+, {132, 61, 7, -64}
+, {-130, -115, -79, -64}
+, {-40, -71, -21, -52}
+, {8, -83, 23, -68}
+, {100, 146, 22, 68}
+, {86, 47, -3, -42}
+, {-34, 16, -60, -10}
+, {-108, -105, -95, -92}
+, {48, 76, 82, 110}
+, {82, -44, 38, -88}
+, {124, 104, 42, 22}
+, {92, 41, 43, -8}
+, {-4, -45, -49, -90}
+, {6, -37, 7, -36}
+, {38, 61, 61, 84}
+, {-70, -36, -32, 2}
+, {-34, 9, -17, 26}
+}
+, {{68, 111, 79, 122}
+, {100, 12, 68, -20}
+, {-14, 33, -3, 44}
+, {34, 19, 89, 74}
+, {-72, -71, -93, -92}
+, {-48, -22, 8, 34}
+, {-18, -29, 55, 44}
+, {-58, -23, -15, 20}
+, {12, -61, 45, -28}
+, {64, 15, 71, 22}
+, {110, 116, 90, 96}
+, {-54, -54, 16, 16}
+, {4, -74, -10, -88}
+, {-34, 1, -37, -2}
+, {92, 105, 33, 46}
+, {100, 32, 14, -54}
+, {76, 14, 28, -34}
+, {-42, 38, -38, 42}
+, {-26, 5, 41, 72}
+, {60, 117, 25, 82}
+, {88, -28, 64, -52}
+, {50, -59, 9, -100}
+, {-46, -73, 21, -6}
+, {72, 34, -44, -82}
+, {98, 13, 55, -30}
+, {134, 147, 117, 130}
+, {108, 175, 59, 126}
+, {118, 94, 140, 116}
+, {78, 112, 72, 106}
+, {92, 140, 74, 122}
+, {-84, -43, -105, -64}
+, {-82, 13, -95, 0}
+, {2, -70, -20, -92}
+, {-76, 24, 24, 124}
+, {-34, -61, 15, -12}
+, {-54, 16, -68, 2}
+, {54, -44, 26, -72}
+, {-78, -78, -86, -86}
+, {104, 29, 27, -48}
+, {-68, -32, -112, -76}
+, {-80, -12, 18, 86}
+, {0, 66, 2, 68}
+, {-4, -66, -18, -80}
+, {-80, -43, -121, -84}
+, {50, 15, 25, -10}
+, {-64, -43, -101, -80}
+, {50, -30, -24, -104}
+, {-40, 9, 57, 106}
+, {-100, -90, -14, -4}
+, {40, 80, 66, 106}
+, {68, 3, 63, -2}
+, {14, 93, -5, 74}
+, {32, -23, 35, -20}
+, {22, 66, 22, 66}
+, {-42, 46, -12, 76}
+, {-36, 6, 0, 42}
+, {36, 3, -23, -56}
+, {-32, 133, -19, 146}
+, {100, 22, 94, 16}
+, {4, 75, 31, 102}
+, {-22, 68, 6, 96}
+, {-92, -29, -119, -56}
+, {-66, -35, -99, -68}
+, {-24, 59, -31, 52}
+}
+, {{-74, -24, 48, 98}
+, {56, 52, -54, -58}
+, {44, 132, 14, 102}
+, {-48, -34, -14, 0}
+, {88, 6, 86, 4}
+, {-32, -104, -18, -90}
+, {-72, -73, -67, -68}
+, {-84, 1, -3, 82}
+, {-52, -24, 36, 64}
+, {66, -24, 52, -38}
+, {-90, -34, 16, 72}
+, {-12, -60, 6, -42}
+, {72, 19, 91, 38}
+, {-84, -74, -46, -36}
+, {-94, -24, -64, 6}
+, {102, 115, 53, 66}
+, {42, -2, 30, -14}
+, {90, 34, 30, -26}
+, {22, -17, 27, -12}
+, {96, 51, 9, -36}
+, {-50, 16, -62, 4}
+, {-34, -82, -10, -58}
+, {-54, -31, -87, -64}
+, {-70, -78, -24, -32}
+, {102, 94, -26, -34}
+, {34, 36, 34, 36}
+, {10, -15, 79, 54}
+, {-28, -17, -31, -20}
+, {12, -24, 36, 0}
+, {-10, -85, -11, -86}
+, {56, 84, 18, 46}
+, {-112, -89, 1, 24}
+, {82, 51, 41, 10}
+, {-108, -19, -37, 52}
+, {-84, -25, -105, -46}
+, {-20, -16, 8, 12}
+, {28, -6, 38, 4}
+, {-34, -28, 48, 54}
+, {82, 73, -37, -46}
+, {6, 100, -14, 80}
+, {-28, 29, -13, 44}
+, {62, 16, 16, -30}
+, {-16, 40, -22, 34}
+, {60, -23, 1, -82}
+, {84, 104, 64, 84}
+, {-72, 11, -71, 12}
+, {-2, -23, -41, -62}
+, {84, 23, 25, -36}
+, {50, 128, 26, 104}
+, {-28, -49, -29, -50}
+, {94, 42, 40, -12}
+, {-102, -133, -53, -84}
+, {82, 104, 34, 56}
+, {162, 141, 35, 14}
+, {-38, -89, 7, -44}
+, {120, 129, 79, 88}
+, {-62, -63, -41, -42}
+, {48, 24, -26, -50}
+, {38, 72, -82, -48}
+, {-88, 8, -52, 44}
+, {60, -8, 26, -42}
+, {-22, -53, 43, 12}
+, {88, 43, 121, 76}
+, {-68, -37, -127, -96}
+}
+, {{-92, -64, -74, -46}
+, {58, 111, 21, 74}
+, {10, -9, 87, 68}
+, {12, 19, -65, -58}
+, {-52, -29, 71, 94}
+, {28, 57, 73, 102}
+, {-8, -3, 93, 98}
+, {30, 104, 20, 94}
+, {120, 110, 74, 64}
+, {-116, -80, -40, -4}
+, {-26, 41, -45, 22}
+, {-102, -88, -14, 0}
+, {-64, 0, 4, 68}
+, {88, -20, 16, -92}
+, {88, -23, -13, -124}
+, {-4, -66, 12, -50}
+, {-22, -45, 49, 26}
+, {46, -38, -8, -92}
+, {58, -5, -37, -100}
+, {98, 47, 27, -24}
+, {4, -19, 29, 6}
+, {-26, 55, -15, 66}
+, {46, -45, 53, -38}
+, {-54, -38, -76, -60}
+, {-38, -38, -38, -38}
+, {-36, -18, 26, 44}
+, {-100, -90, -86, -76}
+, {0, -8, -90, -98}
+, {78, -56, 32, -102}
+, {-74, -88, 12, -2}
+, {-30, -71, -53, -94}
+, {24, -77, -5, -106}
+, {-22, 22, 8, 52}
+, {14, -24, 64, 26}
+, {30, 69, -51, -12}
+, {18, 9, -71, -80}
+, {48, 69, 35, 56}
+, {74, 60, 76, 62}
+, {-66, -80, -72, -86}
+, {-84, -56, -66, -38}
+, {-22, -41, 3, -16}
+, {24, 29, -41, -36}
+, {92, 82, -22, -32}
+, {102, 36, -12, -78}
+, {-70, -17, -85, -32}
+, {-94, -23, -41, 30}
+, {36, 37, 57, 58}
+, {-44, 16, -42, 18}
+, {-40, -58, -30, -48}
+, {-22, -63, 51, 10}
+, {72, -2, 26, -48}
+, {-74, -76, -96, -98}
+, {-50, 65, -33, 82}
+, {68, 88, -2, 18}
+, {50, -6, -28, -84}
+, {-92, -59, -135, -102}
+, {0, 14, -44, -30}
+, {54, 30, -18, -42}
+, {-100, -49, -113, -62}
+, {86, -2, 8, -80}
+, {68, 53, 103, 88}
+, {76, -38, 34, -80}
+, {56, 84, 2, 30}
+, {-80, -21, -49, 10}
+}
+, {{-98, -169, -39, -110}
+, {0, -1, 57, 56}
+, {-14, 74, -38, 50}
+, {88, 43, 117, 72}
+, {-28, 4, 62, 94}
+, {92, 30, -16, -78}
+, {-30, -64, -30, -64}
+, {38, -12, -48, -98}
+, {-88, -67, 29, 50}
+, {-34, -1, 67, 100}
+, {-24, 5, 45, 74}
+, {16, 68, 22, 74}
+, {-52, 54, -42, 64}
+, {110, 68, 120, 78}
+, {52, 38, -26, -40}
+, {-40, 64, -16, 88}
+, {20, -13, -33, -66}
+, {80, 61, 49, 30}
+, {78, 49, 79, 50}
+, {4, 2, -26, -28}
+, {70, 55, 87, 72}
+, {112, 89, -1, -24}
+, {60, -37, 57, -40}
+, {-62, 12, -70, 4}
+, {-2, 30, -18, 14}
+, {-40, -52, 28, 16}
+, {42, 142, 26, 126}
+, {80, 36, -2, -46}
+, {58, -33, 51, -40}
+, {-58, -85, -25, -52}
+, {70, 85, 57, 72}
+, {20, 45, -35, -10}
+, {80, 27, 51, -2}
+, {62, 22, -26, -66}
+, {-40, -48, 10, 2}
+, {-34, 16, -100, -50}
+, {56, -52, 20, -88}
+, {88, 49, 133, 94}
+, {2, -58, -42, -102}
+, {40, -18, -30, -88}
+, {-54, -30, -114, -90}
+, {80, 115, 21, 56}
+, {96, 75, 91, 70}
+, {0, -19, -7, -26}
+, {120, 49, 81, 10}
+, {50, -53, 11, -92}
+, {-104, -70, -2, 32}
+, {4, 31, -1, 26}
+, {8, 59, 67, 118}
+, {-18, 43, -25, 36}
+, {44, 41, 27, 24}
+, {-36, -80, -58, -102}
+, {28, 75, -17, 30}
+, {72, -27, 41, -58}
+, {102, 42, 92, 32}
+, {-4, 43, -15, 32}
+, {48, -30, 54, -24}
+, {-54, -62, -68, -76}
+, {-32, 87, -55, 64}
+, {-60, -53, -109, -102}
+, {-8, 18, -22, 4}
+, {100, 15, 35, -50}
+, {-54, -47, -95, -88}
+, {-96, -58, -54, -16}
+}
+, {{-96, -29, -53, 14}
+, {88, 86, 28, 26}
+, {2, 64, -22, 40}
+, {-24, -4, -18, 2}
+, {-46, -27, -63, -44}
+, {44, 77, 41, 74}
+, {-48, -29, -59, -40}
+, {-88, 31, -47, 72}
+, {-34, -4, 20, 50}
+, {-32, -69, -23, -60}
+, {-102, -78, -120, -96}
+, {14, -36, 22, -28}
+, {-44, -99, -5, -60}
+, {-44, 0, 58, 102}
+, {4, -28, 46, 14}
+, {32, 57, 51, 76}
+, {-66, 58, -28, 96}
+, {-102, -70, 10, 42}
+, {54, 17, -13, -50}
+, {-28, 9, -57, -20}
+, {-74, 13, 13, 100}
+, {72, 51, 41, 20}
+, {-50, -23, -51, -24}
+, {-124, -144, -88, -108}
+, {72, 21, -23, -74}
+, {-4, -91, 9, -78}
+, {58, 19, 35, -4}
+, {-60, 51, -47, 64}
+, {6, -14, 6, -14}
+, {14, 3, 89, 78}
+, {-66, -18, -18, 30}
+, {2, 19, -1, 16}
+, {100, 39, 143, 82}
+, {62, -19, -5, -86}
+, {-88, -70, 46, 64}
+, {-70, -16, -126, -72}
+, {14, -47, -25, -86}
+, {-70, -23, -9, 38}
+, {-6, -66, -42, -102}
+, {86, 126, 12, 52}
+, {72, 27, 5, -40}
+, {-12, 29, -37, 4}
+, {-92, 15, -59, 48}
+, {74, 38, 26, -10}
+, {38, -15, 53, 0}
+, {90, 62, 148, 120}
+, {-14, -4, 50, 60}
+, {-20, -37, 69, 52}
+, {-30, -11, -29, -10}
+, {-92, -97, -103, -108}
+, {94, 18, 88, 12}
+, {-72, -64, 18, 26}
+, {0, 53, 27, 80}
+, {92, 64, 68, 40}
+, {-44, 52, 2, 98}
+, {-54, -68, -94, -108}
+, {44, -49, 41, -52}
+, {26, 15, 39, 28}
+, {-72, -65, -1, 6}
+, {58, -27, 1, -84}
+, {-92, -54, -6, 32}
+, {26, 76, 20, 70}
+, {96, 72, -34, -58}
+, {74, 72, 80, 78}
+}
+, {{-46, -62, -60, -76}
+, {16, -12, 84, 56}
+, {-42, -42, -32, -32}
+, {18, -8, -42, -68}
+, {8, 85, -25, 52}
+, {38, 93, -27, 28}
+, {-22, 20, -42, 0}
+, {-18, -30, 16, 4}
+, {64, 79, 51, 66}
+, {-118, -65, -93, -40}
+, {16, 38, -4, 18}
+, {96, 88, 34, 26}
+, {18, -51, -33, -102}
+, {60, 28, 64, 32}
+, {102, 4, 8, -90}
+, {-32, -27, 53, 58}
+, {68, 46, 8, -14}
+, {74, 26, 4, -44}
+, {-88, -101, -15, -28}
+, {38, -29, -25, -92}
+, {-12, 8, 62, 82}
+, {-8, -11, 25, 22}
+, {-32, -41, -59, -68}
+, {-32, -18, -90, -76}
+, {4, 21, 1, 18}
+, {20, 84, -16, 48}
+, {38, 71, -43, -10}
+, {36, 82, 0, 46}
+, {-16, -21, -45, -50}
+, {-102, -50, -108, -56}
+, {36, -36, 10, -62}
+, {-26, 84, -66, 44}
+, {72, 34, 34, -4}
+, {-90, -79, -23, -12}
+, {-74, 5, -49, 30}
+, {-88, -59, -17, 12}
+, {-112, -90, -20, 2}
+, {28, -41, 53, -16}
+, {58, 35, 25, 2}
+, {-74, 8, -2, 80}
+, {108, 65, 37, -6}
+, {-46, 54, -42, 58}
+, {74, 56, -34, -52}
+, {38, 32, -82, -88}
+, {42, -2, 100, 56}
+, {-14, -11, -31, -28}
+, {-58, -28, -60, -30}
+, {-18, 87, -39, 66}
+, {18, 26, 0, 8}
+, {-64, -3, -49, 12}
+, {100, 28, 44, -28}
+, {100, 110, 86, 96}
+, {58, 58, 42, 42}
+, {100, 40, 76, 16}
+, {-88, -95, -89, -96}
+, {-30, 35, -11, 54}
+, {40, 14, -72, -98}
+, {60, 95, 49, 84}
+, {6, 63, -1, 56}
+, {-20, 11, 55, 86}
+, {22, 6, 106, 90}
+, {8, 2, 100, 94}
+, {30, -34, 72, 8}
+, {80, -35, 55, -60}
+}
+, {{-34, -9, 1, 26}
+, {-46, -8, -96, -58}
+, {70, 27, 79, 36}
+, {-22, 17, 63, 102}
+, {-52, -77, 11, -14}
+, {20, -44, 76, 12}
+, {-50, -43, -81, -74}
+, {8, -16, -26, -50}
+, {-48, 6, -90, -36}
+, {92, 20, 36, -36}
+, {-68, -36, -106, -74}
+, {-68, 60, -36, 92}
+, {-28, -4, -12, 12}
+, {42, 23, -19, -38}
+, {-72, -57, 37, 52}
+, {60, 24, 122, 86}
+, {50, -85, 15, -120}
+, {-50, -79, -55, -84}
+, {70, 98, 4, 32}
+, {46, 43, 93, 90}
+, {58, 13, 33, -12}
+, {-20, -82, -14, -76}
+, {36, 42, 68, 74}
+, {-4, -64, -2, -62}
+, {-78, -28, 48, 98}
+, {-88, -82, 24, 30}
+, {-52, 52, 16, 120}
+, {-4, 19, 25, 48}
+, {-90, -26, -60, 4}
+, {56, 43, 7, -6}
+, {-4, 77, -11, 70}
+, {-80, -75, 1, 6}
+, {76, 47, -57, -86}
+, {-68, -30, -42, -4}
+, {134, 85, 71, 22}
+, {62, 21, 29, -12}
+, {14, 23, -19, -10}
+, {-84, -34, -30, 20}
+, {24, -73, 9, -88}
+, {-62, -79, -5, -22}
+, {64, 82, 4, 22}
+, {96, 79, 83, 66}
+, {12, 1, -55, -66}
+, {46, 93, 7, 54}
+, {112, 88, 74, 50}
+, {-16, -56, -22, -62}
+, {42, 98, 36, 92}
+, {0, -72, 0, -72}
+, {0, 57, 45, 102}
+, {-68, -11, -77, -20}
+, {-22, 45, 5, 72}
+, {-138, -142, -20, -24}
+, {-40, 52, 16, 108}
+, {-38, -87, -3, -52}
+, {68, 101, 21, 54}
+, {-14, -14, 70, 70}
+, {38, -23, -25, -86}
+, {6, -97, 9, -94}
+, {-18, -17, 19, 20}
+, {-16, -51, -51, -86}
+, {-52, -36, -20, -4}
+, {-2, 3, 11, 16}
+, {108, 141, 43, 76}
+, {54, 6, 38, -10}
+}
+, {{-20, 29, -43, 6}
+, {8, -22, -56, -86}
+, {172, 54, 96, -22}
+, {-4, -50, -18, -64}
+, {2, -42, -16, -60}
+, {54, 9, -21, -66}
+, {104, -4, 60, -48}
+, {28, 26, -76, -78}
+, {50, 73, 109, 132}
+, {-16, -32, 12, -4}
+, {98, -14, 94, -18}
+, {78, 69, -25, -34}
+, {26, 2, 90, 66}
+, {-46, 49, 41, 136}
+, {-68, -2, -6, 60}
+, {-58, 55, -71, 42}
+, {96, 91, 21, 16}
+, {-14, -15, 67, 66}
+, {-24, -78, 20, -34}
+, {120, 58, 134, 72}
+, {112, 82, 122, 92}
+, {-12, -48, 14, -22}
+, {-58, -26, 8, 40}
+, {46, 19, -63, -90}
+, {-64, -76, -32, -44}
+, {116, 98, 4, -14}
+, {-72, -14, -38, 20}
+, {-16, 72, 2, 90}
+, {-36, -53, -3, -20}
+, {-96, -103, -109, -116}
+, {-10, 44, 48, 102}
+, {34, -8, 118, 76}
+, {-2, -57, -3, -58}
+, {-24, -49, -9, -34}
+, {-44, -13, -39, -8}
+, {74, 102, -6, 22}
+, {-70, 41, -65, 46}
+, {118, 147, 81, 110}
+, {-74, 27, -69, 32}
+, {88, 10, 92, 14}
+, {-56, 79, -29, 106}
+, {22, -4, 54, 28}
+, {-24, -50, 24, -2}
+, {100, 127, 25, 52}
+, {26, 1, 119, 94}
+, {92, 7, 7, -78}
+, {62, 4, -10, -68}
+, {-74, -61, -127, -114}
+, {22, 78, -8, 48}
+, {-70, -34, -102, -66}
+, {-92, -55, -141, -104}
+, {-40, -84, 34, -10}
+, {-52, 32, -14, 70}
+, {-26, -9, -119, -102}
+, {-52, 34, -24, 62}
+, {6, 27, -37, -16}
+, {-24, 59, 9, 92}
+, {-100, -42, -32, 26}
+, {-46, 5, 73, 124}
+, {-70, -34, -112, -76}
+, {-60, -50, -64, -54}
+, {-18, -67, -45, -94}
+, {-2, -66, 20, -44}
+, {34, 18, -86, -102}
+}
+, {{28, 68, 2, 42}
+, {-42, -25, -69, -52}
+, {36, -14, 28, -22}
+, {28, -40, 26, -42}
+, {-2, -60, -18, -76}
+, {100, -33, 47, -86}
+, {-54, -31, 11, 34}
+, {-4, 41, 45, 90}
+, {-38, -29, -11, -2}
+, {-60, -5, -119, -64}
+, {-42, -21, -29, -8}
+, {78, -16, 26, -68}
+, {-60, -69, -49, -58}
+, {-10, 8, 0, 18}
+, {76, 44, 60, 28}
+, {-10, 20, -88, -58}
+, {-72, -70, -50, -48}
+, {-6, 31, -43, -6}
+, {-70, -110, -34, -74}
+, {34, 109, 5, 80}
+, {-74, 15, 19, 108}
+, {28, 27, -65, -66}
+, {78, 101, 73, 96}
+, {-66, -54, -6, 6}
+, {88, 39, 107, 58}
+, {54, 34, 6, -14}
+, {-22, -124, 14, -88}
+, {32, -30, -8, -70}
+, {78, -42, 66, -54}
+, {-24, -38, -24, -38}
+, {80, 43, 53, 16}
+, {-36, -104, -2, -70}
+, {-80, -90, -36, -46}
+, {-100, -99, -119, -118}
+, {124, 95, 71, 42}
+, {-18, -40, -64, -86}
+, {24, 18, 18, 12}
+, {-10, -20, 42, 32}
+, {-28, 39, -73, -6}
+, {-80, -85, -57, -62}
+, {-78, -94, -50, -66}
+, {-66, -58, -120, -112}
+, {84, 65, 97, 78}
+, {0, -14, 64, 50}
+, {-12, -10, 14, 16}
+, {120, 95, 103, 78}
+, {-90, -50, -44, -4}
+, {-68, -64, 16, 20}
+, {68, 47, 57, 36}
+, {52, 26, 58, 32}
+, {38, -40, 44, -34}
+, {-48, 63, 3, 114}
+, {52, 103, 21, 72}
+, {-22, 37, -59, 0}
+, {-68, -11, -131, -74}
+, {-74, -127, -67, -120}
+, {0, 14, -76, -62}
+, {94, 62, 108, 76}
+, {-114, -147, -45, -78}
+, {16, 8, 58, 50}
+, {-24, -31, 49, 42}
+, {86, 105, 49, 68}
+, {-96, -84, 4, 16}
+, {104, 48, 126, 70}
+}
+, {{-120, -101, 5, 24}
+, {-106, -44, -26, 36}
+, {0, 26, -16, 10}
+, {36, -47, -9, -92}
+, {90, 96, 32, 38}
+, {24, 0, 22, -2}
+, {32, -64, 18, -78}
+, {-58, -72, -24, -38}
+, {-50, -32, -96, -78}
+, {34, 80, 22, 68}
+, {0, -9, 45, 36}
+, {-60, 34, -22, 72}
+, {98, 33, 19, -46}
+, {-24, 41, 15, 80}
+, {114, 128, 48, 62}
+, {14, 46, 70, 102}
+, {-10, 38, 20, 68}
+, {34, -8, 12, -30}
+, {-68, -45, 43, 66}
+, {0, 13, 49, 62}
+, {58, 115, 33, 90}
+, {58, -67, 25, -100}
+, {-2, 41, -43, 0}
+, {-100, -77, -73, -50}
+, {62, 20, -20, -62}
+, {-74, -103, -21, -50}
+, {-42, 26, -74, -6}
+, {-8, -4, 26, 30}
+, {66, 54, 134, 122}
+, {-18, -31, -43, -56}
+, {36, -23, 43, -16}
+, {8, -32, 20, -20}
+, {-72, -101, -57, -86}
+, {-28, 12, -110, -70}
+, {-106, -14, -56, 36}
+, {-58, -16, 40, 82}
+, {50, 71, 85, 106}
+, {62, 24, 44, 6}
+, {54, -26, -8, -88}
+, {114, 103, 83, 72}
+, {-92, -58, -104, -70}
+, {68, 93, -3, 22}
+, {62, 7, 71, 16}
+, {-26, -59, -29, -62}
+, {4, -42, 26, -20}
+, {0, -39, -55, -94}
+, {-88, -5, -67, 16}
+, {72, 34, -2, -40}
+, {-90, -96, -4, -10}
+, {14, 83, 37, 106}
+, {-68, 23, -71, 20}
+, {24, 0, 88, 64}
+, {16, 1, -21, -36}
+, {2, -116, 2, -116}
+, {34, -62, 0, -96}
+, {106, 121, 59, 74}
+, {42, 37, 101, 96}
+, {98, 74, 120, 96}
+, {58, 10, 36, -12}
+, {-60, 54, -40, 74}
+, {-6, 48, -32, 22}
+, {-76, -54, -14, 8}
+, {92, 57, 5, -30}
+, {50, 20, 42, 12}
+}
+, {{-56, -55, -65, -64}
+, {-84, -114, -14, -44}
+, {-48, -62, 2, -12}
+, {66, 94, -10, 18}
+, {-86, -46, -40, 0}
+, {26, 67, 3, 44}
+, {-4, -42, 2, -36}
+, {74, -25, 67, -32}
+, {6, -5, 81, 70}
+, {-20, -75, 7, -48}
+, {-34, -2, 60, 92}
+, {-36, -76, -76, -116}
+, {-72, -11, 31, 92}
+, {-36, -58, -36, -58}
+, {6, 39, 17, 50}
+, {52, 41, -21, -32}
+, {-16, -28, -58, -70}
+, {118, 34, 98, 14}
+, {-72, -31, 31, 72}
+, {-84, -106, -48, -70}
+, {102, 65, -13, -50}
+, {34, 29, 101, 96}
+, {90, 5, 95, 10}
+, {96, 66, 54, 24}
+, {-102, -87, -67, -52}
+, {-10, -38, -14, -42}
+, {-76, -57, -115, -96}
+, {58, -3, 81, 20}
+, {30, 61, -29, 2}
+, {76, 47, -35, -64}
+, {48, 42, 60, 54}
+, {66, 63, 19, 16}
+, {114, -29, 67, -76}
+, {66, 50, 16, 0}
+, {104, 32, 68, -4}
+, {-56, -45, 33, 44}
+, {-52, -18, -18, 16}
+, {-32, -44, -62, -74}
+, {12, 101, 11, 100}
+, {-44, -115, -27, -98}
+, {-32, -37, 25, 20}
+, {-58, -45, -33, -20}
+, {110, 108, 78, 76}
+, {30, 9, -19, -40}
+, {-24, -17, 59, 66}
+, {-40, -23, -101, -84}
+, {4, 5, 7, 8}
+, {74, 42, 4, -28}
+, {-4, -84, 54, -26}
+, {-96, -73, -135, -112}
+, {92, 102, 48, 58}
+, {56, 20, 106, 70}
+, {82, 9, -1, -74}
+, {32, 38, -74, -68}
+, {58, 84, 46, 72}
+, {-36, -93, -55, -112}
+, {16, 67, -37, 14}
+, {32, 32, 82, 82}
+, {40, 41, 79, 80}
+, {-14, -52, 30, -8}
+, {-50, 25, -23, 52}
+, {-30, -98, -16, -84}
+, {86, 28, 56, -2}
+, {-44, 11, -57, -2}
+}
+, {{24, -52, -34, -110}
+, {50, 84, 64, 98}
+, {16, 30, 8, 22}
+, {78, 107, 3, 32}
+, {82, 49, -43, -76}
+, {70, 2, 82, 14}
+, {-60, -16, -30, 14}
+, {30, 1, -3, -32}
+, {-60, -111, -37, -88}
+, {-14, 54, 16, 84}
+, {56, 118, 24, 86}
+, {-60, 35, -1, 94}
+, {-46, -40, 30, 36}
+, {-22, -13, -71, -62}
+, {-32, -47, -65, -80}
+, {-46, 20, -30, 36}
+, {-6, -13, -87, -94}
+, {16, 27, 33, 44}
+, {-36, -31, -99, -94}
+, {-62, 17, -51, 28}
+, {-106, -60, 2, 48}
+, {-8, -43, -7, -42}
+, {58, 55, -11, -14}
+, {-112, -82, -80, -50}
+, {-28, 6, 28, 62}
+, {122, 62, 48, -12}
+, {122, 177, 57, 112}
+, {-80, -50, -74, -44}
+, {-6, -31, 13, -12}
+, {88, 62, 12, -14}
+, {-72, -48, 26, 50}
+, {8, 63, 13, 68}
+, {-2, 33, 49, 84}
+, {102, 125, 89, 112}
+, {-50, -42, -96, -88}
+, {120, 58, 36, -26}
+, {-44, -18, 58, 84}
+, {-50, 15, -31, 34}
+, {90, -37, 19, -108}
+, {76, 52, 68, 44}
+, {-22, 44, -48, 18}
+, {0, 2, 38, 40}
+, {-12, 6, -40, -22}
+, {92, -10, 10, -92}
+, {-18, -19, 77, 76}
+, {-40, -34, 32, 38}
+, {80, 74, 4, -2}
+, {-6, 0, 78, 84}
+, {12, 31, -17, 2}
+, {-36, -20, 18, 34}
+, {0, -44, 30, -14}
+, {84, 31, 21, -32}
+, {20, 24, -72, -68}
+, {82, 68, 20, 6}
+, {14, -42, 4, -52}
+, {24, 29, 45, 50}
+, {20, 5, 81, 66}
+, {-30, -13, -49, -32}
+, {-10, 119, 13, 142}
+, {-36, -39, -23, -26}
+, {10, -21, 13, -18}
+, {94, 60, 92, 58}
+, {-104, -124, -60, -80}
+, {-12, 13, -35, -10}
+}
+, {{108, 61, 27, -20}
+, {-58, -58, -36, -36}
+, {114, 71, 29, -14}
+, {-28, -3, -89, -64}
+, {14, -29, -31, -74}
+, {-26, 30, 2, 58}
+, {-60, 3, -7, 56}
+, {-62, -45, 11, 28}
+, {-58, -96, -28, -66}
+, {24, -48, -2, -74}
+, {-16, 31, 43, 90}
+, {-104, -48, 38, 94}
+, {24, 34, 0, 10}
+, {108, 22, 32, -54}
+, {-6, 51, 17, 74}
+, {54, 104, 48, 98}
+, {72, 35, 23, -14}
+, {86, 62, 26, 2}
+, {-42, 47, -19, 70}
+, {-68, -22, 46, 92}
+, {82, 32, -10, -60}
+, {-38, -65, -63, -90}
+, {-68, 26, -70, 24}
+, {68, 92, 42, 66}
+, {-68, -54, -42, -28}
+, {78, -22, 84, -16}
+, {-116, -22, -18, 76}
+, {-88, -46, -116, -74}
+, {-84, -87, -85, -88}
+, {6, -30, 2, -34}
+, {36, -43, -11, -90}
+, {-60, 10, -22, 48}
+, {48, -61, 25, -84}
+, {40, 42, 8, 10}
+, {-16, 19, 15, 50}
+, {52, 127, 51, 126}
+, {76, 25, -35, -86}
+, {-108, -80, -10, 18}
+, {22, -4, -34, -60}
+, {40, 57, -63, -46}
+, {46, -28, -36, -110}
+, {-104, -10, -34, 60}
+, {36, -2, 64, 26}
+, {74, 47, 69, 42}
+, {16, 42, 44, 70}
+, {36, -63, 37, -62}
+, {-2, -68, 14, -52}
+, {-52, -4, -18, 30}
+, {82, 46, 48, 12}
+, {42, 22, -48, -68}
+, {-24, 58, -34, 48}
+, {58, 97, 69, 108}
+, {10, -52, -22, -84}
+, {54, 73, 31, 50}
+, {42, 78, -16, 20}
+, {-84, -82, 8, 10}
+, {100, 17, 65, -18}
+, {-28, 59, -17, 70}
+, {52, 24, 86, 58}
+, {-94, -70, -104, -80}
+, {2, -7, -79, -88}
+, {-28, -19, 45, 54}
+, {38, -16, -8, -62}
+, {100, 39, 131, 70}
+}
+, {{-6, -90, -6, -90}
+, {2, 9, 37, 44}
+, {-56, -5, -15, 36}
+, {6, -8, 86, 72}
+, {-36, -3, -31, 2}
+, {-78, -16, 0, 62}
+, {-6, 15, -75, -54}
+, {4, 34, 12, 42}
+, {-76, -45, -67, -36}
+, {-42, 4, -54, -8}
+, {-26, -88, -38, -100}
+, {-70, -77, -15, -22}
+, {-22, -52, 16, -14}
+, {110, 93, -35, -52}
+, {28, -11, 39, 0}
+, {46, 76, 32, 62}
+, {-88, -95, -17, -24}
+, {-28, -70, 2, -40}
+, {-42, 51, -55, 38}
+, {-8, 4, -2, 10}
+, {12, -16, 82, 54}
+, {86, 95, 39, 48}
+, {36, 25, -25, -36}
+, {-84, -31, 53, 106}
+, {-138, -121, -159, -142}
+, {-116, -17, -27, 72}
+, {6, 71, 11, 76}
+, {-64, -54, -110, -100}
+, {104, 92, 56, 44}
+, {-50, -77, -81, -108}
+, {92, 52, -4, -44}
+, {106, -8, 60, -54}
+, {82, 56, -10, -36}
+, {80, 45, 83, 48}
+, {6, 64, 32, 90}
+, {70, 15, 61, 6}
+, {-70, 28, -52, 46}
+, {110, 80, 12, -18}
+, {86, 128, 36, 78}
+, {42, 70, 62, 90}
+, {-72, -26, -66, -20}
+, {114, 133, 51, 70}
+, {-38, -24, -52, -38}
+, {-20, -11, 59, 68}
+, {-14, 91, 11, 116}
+, {-80, 25, -39, 66}
+, {-32, -73, 41, 0}
+, {-92, -78, -118, -104}
+, {-68, 34, -42, 60}
+, {12, -37, 83, 34}
+, {70, 82, 10, 22}
+, {30, 81, 45, 96}
+, {6, 7, 71, 72}
+, {36, -8, 60, 16}
+, {68, 90, 76, 98}
+, {-8, 31, 7, 46}
+, {-2, -19, 69, 52}
+, {8, -39, -65, -112}
+, {30, -6, 8, -28}
+, {40, 82, 50, 92}
+, {22, 18, 74, 70}
+, {-20, 44, 28, 92}
+, {94, 22, 96, 24}
+, {-2, -35, -9, -42}
+}
+, {{-22, 50, 28, 100}
+, {-54, 9, 29, 92}
+, {-74, -2, -14, 58}
+, {80, 95, 99, 114}
+, {88, 23, 75, 10}
+, {-64, 21, -17, 68}
+, {-22, -77, 13, -42}
+, {18, 37, -47, -28}
+, {-46, -2, 34, 78}
+, {130, 30, 106, 6}
+, {50, 86, 74, 110}
+, {80, 124, 66, 110}
+, {-72, -29, 47, 90}
+, {-40, -48, -26, -34}
+, {-60, -34, -84, -58}
+, {-84, -137, -41, -94}
+, {-48, -8, -96, -56}
+, {-48, 35, -13, 70}
+, {-42, -54, 34, 22}
+, {92, 20, 112, 40}
+, {14, 23, 75, 84}
+, {8, -9, -71, -88}
+, {64, 75, -29, -18}
+, {136, 56, 96, 16}
+, {26, -21, 15, -32}
+, {-74, -32, -4, 38}
+, {-42, -5, -31, 6}
+, {88, 41, -3, -50}
+, {28, -22, 72, 22}
+, {-74, -94, -16, -36}
+, {-36, -35, -5, -4}
+, {4, -46, -76, -126}
+, {6, 95, 7, 96}
+, {-82, -85, -17, -20}
+, {-40, 20, 50, 110}
+, {-26, 26, -52, 0}
+, {16, -82, 2, -96}
+, {74, 60, 108, 94}
+, {110, 42, 6, -62}
+, {-64, -50, -6, 8}
+, {-40, -99, -5, -64}
+, {-38, -2, -62, -26}
+, {-14, 8, -94, -72}
+, {26, -12, 52, 14}
+, {-58, -28, 42, 72}
+, {66, 67, 79, 80}
+, {-44, 12, -32, 24}
+, {26, -40, 48, -18}
+, {102, 24, 10, -68}
+, {-38, -22, -100, -84}
+, {102, 137, 43, 78}
+, {42, 41, 27, 26}
+, {32, 15, -41, -58}
+, {-64, -74, -74, -84}
+, {-80, -65, 21, 36}
+, {-2, -7, -7, -12}
+, {-94, -24, -12, 58}
+, {4, 20, 54, 70}
+, {78, 40, 38, 0}
+, {-92, 26, -22, 96}
+, {96, 97, 87, 88}
+, {24, -18, 74, 32}
+, {-30, -21, -5, 4}
+, {-86, -73, -105, -92}
+}
+, {{2, -15, -43, -60}
+, {40, -44, 36, -48}
+, {52, 70, 26, 44}
+, {-64, 15, -77, 2}
+, {-6, 8, -4, 10}
+, {-12, -51, 5, -34}
+, {88, 9, 29, -50}
+, {-42, -32, 34, 44}
+, {54, 66, -50, -38}
+, {0, -38, 36, -2}
+, {14, 32, 0, 18}
+, {2, 50, 8, 56}
+, {42, -8, 54, 4}
+, {70, 97, 81, 108}
+, {34, 40, 86, 92}
+, {76, -7, -1, -84}
+, {-10, -57, 21, -26}
+, {-12, -38, -28, -54}
+, {-60, -51, -51, -42}
+, {28, 30, -70, -68}
+, {-30, -46, -48, -64}
+, {4, 66, 42, 104}
+, {58, 112, 30, 84}
+, {-92, -37, -89, -34}
+, {70, 79, 59, 68}
+, {-34, -35, 9, 8}
+, {-76, -63, 19, 32}
+, {76, 7, 27, -42}
+, {-108, -56, -20, 32}
+, {-84, -123, -9, -48}
+, {-62, -68, -22, -28}
+, {-112, -51, -79, -18}
+, {-96, -10, -48, 38}
+, {-96, -15, -115, -34}
+, {8, 16, 68, 76}
+, {-74, 39, -39, 74}
+, {68, 1, 43, -24}
+, {-76, -33, 51, 94}
+, {46, 58, 38, 50}
+, {-44, -57, -17, -30}
+, {-38, -25, 59, 72}
+, {-2, -41, -31, -70}
+, {-58, -14, -68, -24}
+, {-32, -26, 22, 28}
+, {-86, 0, 18, 104}
+, {90, 52, -38, -76}
+, {52, 10, 78, 36}
+, {-8, -28, -62, -82}
+, {-80, -49, -69, -38}
+, {-32, -33, -35, -36}
+, {108, 126, 40, 58}
+, {-100, -51, -1, 48}
+, {92, 9, 33, -50}
+, {30, 11, 81, 62}
+, {22, 24, -76, -74}
+, {-50, 44, 12, 106}
+, {80, -28, 64, -44}
+, {-50, -98, -70, -118}
+, {-106, -2, -104, 0}
+, {88, 26, 106, 44}
+, {44, 51, 73, 80}
+, {48, -16, -10, -74}
+, {-46, 62, -12, 96}
+, {76, 58, 36, 18}
+}
+, {{0, 44, 98, 142}
+, {-76, -35, 9, 50}
+, {36, 7, -71, -100}
+, {-80, -57, -43, -20}
+, {36, 31, 105, 100}
+, {8, 93, 17, 102}
+, {40, -32, 40, -32}
+, {-32, -25, 41, 48}
+, {-20, 11, -95, -64}
+, {72, 44, 70, 42}
+, {28, -112, 2, -138}
+, {40, -21, 67, 6}
+, {-32, -39, 1, -6}
+, {-60, 49, -13, 96}
+, {6, 77, -27, 44}
+, {84, 50, 94, 60}
+, {98, 17, 85, 4}
+, {-22, -29, -49, -56}
+, {-46, -81, -23, -58}
+, {100, 80, 24, 4}
+, {-106, -53, -65, -12}
+, {22, 36, -24, -10}
+, {90, 76, 20, 6}
+, {-96, -98, -82, -84}
+, {32, 13, -43, -62}
+, {-42, 32, -78, -4}
+, {-80, -56, -106, -82}
+, {-16, -10, 2, 8}
+, {-36, -60, -50, -74}
+, {-28, 51, -31, 48}
+, {108, 58, 64, 14}
+, {68, 15, -25, -78}
+, {-54, -11, -71, -28}
+, {-26, -37, 71, 60}
+, {48, 62, 100, 114}
+, {76, -9, 53, -32}
+, {-30, 9, -5, 34}
+, {16, -30, -2, -48}
+, {-4, 12, -52, -36}
+, {68, 67, -43, -44}
+, {-76, -37, -31, 8}
+, {-10, 11, -39, -18}
+, {-22, 63, 13, 98}
+, {-30, -38, -58, -66}
+, {20, -14, 30, -4}
+, {-80, 12, -50, 42}
+, {22, 50, 26, 54}
+, {28, 76, 30, 78}
+, {-54, -38, 18, 34}
+, {-118, -62, -52, 4}
+, {58, 35, 49, 26}
+, {-52, 1, 71, 124}
+, {16, 53, -35, 2}
+, {0, -23, -29, -52}
+, {8, -1, -77, -86}
+, {78, 41, 105, 68}
+, {-28, -35, -69, -76}
+, {-44, 93, -49, 88}
+, {18, -2, 44, 24}
+, {-56, -19, -85, -48}
+, {-30, -18, -32, -20}
+, {-14, -74, -4, -64}
+, {-20, 44, -20, 44}
+, {-74, -86, -42, -54}
+}
+, {{-82, -77, 21, 26}
+, {-82, -53, -73, -44}
+, {-40, -64, 10, -14}
+, {-68, -35, -67, -34}
+, {4, -35, 35, -4}
+, {92, 54, 112, 74}
+, {-58, -52, -6, 0}
+, {-74, -77, -43, -46}
+, {-104, -68, -44, -8}
+, {-56, 5, -23, 38}
+, {-76, -4, -66, 6}
+, {-28, -44, -38, -54}
+, {-40, 11, -61, -10}
+, {-116, -55, -87, -26}
+, {56, -35, 7, -84}
+, {8, 35, -17, 10}
+, {-106, -134, -66, -94}
+, {6, 100, 22, 116}
+, {-32, -69, -37, -74}
+, {-24, -31, 89, 82}
+, {-74, 12, -36, 50}
+, {48, 16, 52, 20}
+, {-112, -86, -26, 0}
+, {-82, -139, -31, -88}
+, {26, -30, -40, -96}
+, {4, 34, 54, 84}
+, {88, 33, -17, -72}
+, {-44, 11, -67, -12}
+, {-62, 35, 7, 104}
+, {-76, -77, -63, -64}
+, {8, 63, 41, 96}
+, {-102, 12, -40, 74}
+, {-44, 10, -12, 42}
+, {26, 26, 22, 22}
+, {78, 96, 18, 36}
+, {-40, -7, -115, -82}
+, {-32, -34, 42, 40}
+, {-66, -74, -18, -26}
+, {-82, -90, -92, -100}
+, {14, -16, -30, -60}
+, {70, 119, 55, 104}
+, {70, 8, -28, -90}
+, {-12, 77, 19, 108}
+, {26, 9, 79, 62}
+, {-80, -28, 22, 74}
+, {6, -17, -27, -50}
+, {-62, -23, -95, -56}
+, {100, 66, 124, 90}
+, {-50, -33, 9, 26}
+, {68, 113, 29, 74}
+, {-32, -43, 33, 22}
+, {-90, -48, -94, -52}
+, {-52, -84, -40, -72}
+, {-80, -98, -90, -108}
+, {-90, -41, 9, 58}
+, {24, 38, 26, 40}
+, {12, 50, -38, 0}
+, {-14, -56, 6, -36}
+, {48, 106, 18, 76}
+, {36, 12, 112, 88}
+, {68, 37, 105, 74}
+, {-86, 2, -84, 4}
+, {98, 101, 83, 86}
+, {-84, -97, -97, -110}
+}
+, {{-90, -35, 1, 56}
+, {-22, -53, -77, -108}
+, {-48, -32, -68, -52}
+, {82, 50, 122, 90}
+, {-22, 26, 4, 52}
+, {76, 55, 121, 100}
+, {84, 26, 2, -56}
+, {-26, 49, -1, 74}
+, {-92, -12, -98, -18}
+, {42, -85, 19, -108}
+, {130, 116, 28, 14}
+, {24, 61, 21, 58}
+, {-10, 57, -47, 20}
+, {-24, -42, -110, -128}
+, {96, 92, 12, 8}
+, {28, -6, 96, 62}
+, {-56, -24, -46, -14}
+, {26, 78, 52, 104}
+, {88, -35, 17, -106}
+, {104, 35, 69, 0}
+, {50, 48, 12, 10}
+, {-74, -49, -29, -4}
+, {30, 7, 97, 74}
+, {8, -12, 92, 72}
+, {0, 31, 69, 100}
+, {108, 170, 62, 124}
+, {-32, 6, -40, -2}
+, {64, 47, -33, -50}
+, {2, 67, -7, 58}
+, {-94, -1, -89, 4}
+, {-54, -73, -53, -72}
+, {-8, 14, -64, -42}
+, {4, -71, -17, -92}
+, {-18, -9, -47, -38}
+, {-102, -129, -95, -122}
+, {-94, -82, -38, -26}
+, {-8, -16, 44, 36}
+, {36, 7, 109, 80}
+, {10, 9, -69, -70}
+, {54, 99, 53, 98}
+, {-12, -6, 4, 10}
+, {-82, -83, -9, -10}
+, {-40, 19, 25, 84}
+, {-76, -72, -72, -68}
+, {-62, 23, -13, 72}
+, {-20, -99, 9, -70}
+, {108, 53, 119, 64}
+, {96, 57, 63, 24}
+, {-88, -43, 35, 80}
+, {20, 76, 6, 62}
+, {2, -26, 48, 20}
+, {80, 110, 92, 122}
+, {2, 60, 42, 100}
+, {88, 70, 62, 44}
+, {-102, -51, -127, -76}
+, {-68, 47, -37, 78}
+, {92, 31, 103, 42}
+, {126, 102, 164, 140}
+, {-4, -18, -22, -36}
+, {64, 12, -10, -62}
+, {-30, -1, -75, -46}
+, {40, 12, 70, 42}
+, {68, 7, 53, -8}
+, {-70, -64, -50, -44}
+}
+, {{60, 75, 27, 42}
+, {-76, 9, -61, 24}
+, {-62, 16, 32, 110}
+, {38, 0, 22, -16}
+, {26, 8, 82, 64}
+, {18, -28, 38, -8}
+, {0, -44, -4, -48}
+, {50, -57, 25, -82}
+, {26, 37, 67, 78}
+, {-52, -66, -74, -88}
+, {-16, -26, -32, -42}
+, {-26, 39, -51, 14}
+, {56, 54, 50, 48}
+, {-26, -40, -50, -64}
+, {38, -44, 0, -82}
+, {78, 66, 48, 36}
+, {8, 23, 21, 36}
+, {92, 26, 90, 24}
+, {0, 22, -42, -20}
+, {28, 32, -74, -70}
+, {-66, 53, -27, 92}
+, {4, 1, -45, -48}
+, {34, 35, 101, 102}
+, {104, -9, 17, -96}
+, {-6, 37, 7, 50}
+, {32, -20, 68, 16}
+, {-36, -27, -81, -72}
+, {46, -29, -9, -84}
+, {-56, -105, -25, -74}
+, {-50, -7, -73, -30}
+, {80, 91, -5, 6}
+, {-30, -123, -29, -122}
+, {-4, 26, -66, -36}
+, {50, 73, -15, 8}
+, {104, 35, 71, 2}
+, {-4, -59, 19, -36}
+, {96, 48, -6, -54}
+, {38, 67, 67, 96}
+, {86, 54, -40, -72}
+, {14, -56, -2, -72}
+, {34, 9, 77, 52}
+, {-22, -130, -12, -120}
+, {-24, -97, -11, -84}
+, {-100, -38, -34, 28}
+, {-60, 46, -50, 56}
+, {66, 34, -62, -94}
+, {32, -35, 11, -56}
+, {50, -49, 71, -28}
+, {104, 164, 68, 128}
+, {36, -32, 94, 26}
+, {84, 25, 75, 16}
+, {-118, -101, 31, 48}
+, {22, -8, -10, -40}
+, {-36, -16, -70, -50}
+, {50, 48, 56, 54}
+, {-104, -68, 28, 64}
+, {8, 66, 24, 82}
+, {-18, -84, 14, -52}
+, {0, -46, 46, 0}
+, {64, -3, 77, 10}
+, {-6, 65, 31, 102}
+, {68, 35, -21, -54}
+, {-48, 40, -34, 54}
+, {-90, -46, -120, -76}
+}
+, {{106, 65, 33, -8}
+, {80, 50, 114, 84}
+, {-56, -81, -53, -78}
+, {-108, -78, -122, -92}
+, {-80, -36, -74, -30}
+, {64, 42, -34, -56}
+, {96, -22, 52, -66}
+, {4, 106, -8, 94}
+, {-52, -64, -60, -72}
+, {-34, 79, -19, 94}
+, {16, 90, 40, 114}
+, {-42, 79, -37, 84}
+, {-74, 10, 0, 84}
+, {-32, -66, -66, -100}
+, {-50, -45, 3, 8}
+, {48, -6, 24, -30}
+, {-6, -45, -37, -76}
+, {-46, -49, -119, -122}
+, {42, 19, -7, -30}
+, {30, 90, 26, 86}
+, {-16, 52, 20, 88}
+, {38, 8, 30, 0}
+, {6, 41, 51, 86}
+, {106, 80, 0, -26}
+, {18, 77, -1, 58}
+, {-58, 17, 17, 92}
+, {60, 0, 110, 50}
+, {34, 21, 65, 52}
+, {0, -37, 19, -18}
+, {-38, 10, -96, -48}
+, {28, -5, 79, 46}
+, {-56, 11, -67, 0}
+, {-32, -22, 14, 24}
+, {0, -17, 17, 0}
+, {144, 15, 69, -60}
+, {26, 4, -8, -30}
+, {-72, -75, -43, -46}
+, {-44, 45, -33, 56}
+, {34, 125, 29, 120}
+, {-104, -119, -53, -68}
+, {74, 5, 43, -26}
+, {26, 57, 17, 48}
+, {-78, -44, -112, -78}
+, {76, 63, -1, -14}
+, {-104, -118, -96, -110}
+, {78, -24, 62, -40}
+, {96, 103, 91, 98}
+, {50, 1, -7, -56}
+, {-90, -118, -28, -56}
+, {108, 92, 120, 104}
+, {88, 30, 20, -38}
+, {-62, -29, 3, 36}
+, {50, -27, -19, -96}
+, {-98, -102, 6, 2}
+, {-62, -83, -49, -70}
+, {36, 5, -53, -84}
+, {92, 62, -48, -78}
+, {100, 70, 8, -22}
+, {60, 40, -16, -36}
+, {-82, -23, 23, 82}
+, {8, 64, -6, 50}
+, {-26, 12, -34, 4}
+, {-46, -47, 9, 8}
+, {54, 43, -3, -14}
+}
+, {{-34, -1, 15, 48}
+, {68, 113, 33, 78}
+, {94, -36, 46, -84}
+, {106, 87, 9, -10}
+, {86, 130, 34, 78}
+, {70, 11, 101, 42}
+, {-52, 27, -11, 68}
+, {18, -69, -7, -94}
+, {-86, -54, 2, 34}
+, {80, 118, 60, 98}
+, {-4, 96, 18, 118}
+, {80, 22, -16, -74}
+, {94, 101, 7, 14}
+, {-142, -95, -23, 24}
+, {-78, -82, -30, -34}
+, {-22, -9, 39, 52}
+, {-28, -64, -24, -60}
+, {-92, 51, -37, 106}
+, {-74, -91, -37, -54}
+, {-16, -94, -24, -102}
+, {-84, -120, -40, -76}
+, {40, -1, -21, -62}
+, {-78, 36, -34, 80}
+, {-82, 29, -55, 56}
+, {30, -31, 17, -44}
+, {66, 32, -22, -56}
+, {-20, 77, -17, 80}
+, {8, 7, -85, -86}
+, {-88, -90, -70, -72}
+, {28, -13, 47, 6}
+, {-48, -24, 20, 44}
+, {26, 54, 36, 64}
+, {-90, -45, -75, -30}
+, {32, -67, 23, -76}
+, {36, 144, 20, 128}
+, {-18, -4, -60, -46}
+, {28, -27, 59, 4}
+, {28, -15, -7, -50}
+, {-4, -12, 12, 4}
+, {-16, -66, 50, 0}
+, {88, 1, 7, -80}
+, {-52, 2, -108, -54}
+, {18, 28, -66, -56}
+, {-8, -40, 54, 22}
+, {-106, 2, -18, 90}
+, {64, -6, 50, -20}
+, {112, 75, 9, -28}
+, {-18, 5, -75, -52}
+, {88, 22, 116, 50}
+, {74, 120, -14, 32}
+, {-58, -76, -76, -94}
+, {86, -32, 14, -104}
+, {2, 28, -42, -16}
+, {110, 69, 71, 30}
+, {14, -20, -54, -88}
+, {30, -41, 49, -22}
+, {18, 31, 71, 84}
+, {-44, -43, 33, 34}
+, {32, 51, 55, 74}
+, {44, 70, 32, 58}
+, {-24, -42, -44, -62}
+, {-40, 37, -3, 74}
+, {104, 131, 79, 106}
+, {-14, -61, 41, -6}
+}
+, {{108, 166, 46, 104}
+, {28, -34, 46, -16}
+, {98, 87, -27, -38}
+, {98, 29, -33, -102}
+, {-42, 36, 6, 84}
+, {-80, -8, -42, 30}
+, {-38, -58, 40, 20}
+, {-26, 34, -12, 48}
+, {76, 104, 4, 32}
+, {-22, -9, -37, -24}
+, {-64, -70, -100, -106}
+, {40, 39, 91, 90}
+, {70, -19, 81, -8}
+, {26, 87, -21, 40}
+, {-56, -25, -5, 26}
+, {-30, 37, -7, 60}
+, {48, -12, 62, 2}
+, {126, 109, 7, -10}
+, {78, -26, 72, -32}
+, {68, -23, 27, -64}
+, {0, 76, 4, 80}
+, {-78, -23, -95, -40}
+, {86, 35, -47, -98}
+, {-42, -20, -14, 8}
+, {86, 71, 67, 52}
+, {22, 20, 104, 102}
+, {16, -12, 10, -18}
+, {-24, -110, -10, -96}
+, {82, 50, 88, 56}
+, {-80, -8, -88, -16}
+, {10, 48, -74, -36}
+, {-98, -44, 10, 64}
+, {36, -8, 20, -24}
+, {58, 93, 19, 54}
+, {22, 48, 40, 66}
+, {46, 53, 113, 120}
+, {4, -9, 67, 54}
+, {66, 56, 40, 30}
+, {96, -7, 55, -48}
+, {40, 44, 110, 114}
+, {-88, -71, -33, -16}
+, {54, 4, 86, 36}
+, {-50, -64, -16, -30}
+, {-46, -27, -43, -24}
+, {42, 73, -15, 16}
+, {34, -17, 51, 0}
+, {0, -61, 17, -44}
+, {-54, -49, -111, -106}
+, {2, -25, -19, -46}
+, {-32, -20, -78, -66}
+, {18, -20, -26, -64}
+, {30, -64, 10, -84}
+, {-16, -43, 61, 34}
+, {60, 70, -56, -46}
+, {-52, 58, -6, 104}
+, {-4, 50, -44, 10}
+, {-54, -16, -106, -68}
+, {-80, 3, -57, 26}
+, {-80, -25, -95, -40}
+, {16, 47, 33, 64}
+, {60, 69, 61, 70}
+, {32, -27, 37, -22}
+, {52, 20, 88, 56}
+, {-46, -7, -101, -62}
+}
+, {{-16, -19, -89, -92}
+, {76, -23, -1, -100}
+, {-106, -60, -48, -2}
+, {42, 81, 1, 40}
+, {-18, -14, -18, -14}
+, {6, -59, 45, -20}
+, {44, 62, 72, 90}
+, {-26, -21, -51, -46}
+, {-40, -28, -30, -18}
+, {82, 22, 26, -34}
+, {32, 2, 30, 0}
+, {-16, 62, 18, 96}
+, {86, 59, 11, -16}
+, {24, -11, 57, 22}
+, {-76, 14, -56, 34}
+, {-62, 31, 5, 98}
+, {44, -31, -13, -88}
+, {138, 68, 80, 10}
+, {-82, -92, -44, -54}
+, {88, 31, -39, -96}
+, {0, -26, -72, -98}
+, {-104, -34, -58, 12}
+, {-100, -88, -28, -16}
+, {48, -31, 49, -30}
+, {34, 56, 22, 44}
+, {-62, 33, -5, 90}
+, {-74, 26, -82, 18}
+, {-28, 13, -57, -16}
+, {60, -40, 4, -96}
+, {4, 24, 74, 94}
+, {28, -3, 33, 2}
+, {86, 88, 88, 90}
+, {24, 3, -57, -78}
+, {-58, 28, 8, 94}
+, {-76, -93, -39, -56}
+, {-56, -48, 24, 32}
+, {100, 111, 83, 94}
+, {-82, -47, -49, -14}
+, {48, 89, 7, 48}
+, {34, -3, 57, 20}
+, {-54, 17, -39, 32}
+, {100, 7, 51, -42}
+, {88, 69, 25, 6}
+, {-48, -64, -36, -52}
+, {-52, -49, 59, 62}
+, {30, 37, 19, 26}
+, {-66, 3, -11, 58}
+, {28, 2, -42, -68}
+, {48, 22, -34, -60}
+, {36, 29, -49, -56}
+, {-8, 20, 38, 66}
+, {38, 104, -14, 52}
+, {-102, -55, 9, 56}
+, {54, 16, 22, -16}
+, {90, 94, 78, 82}
+, {-78, -17, -43, 18}
+, {68, 122, 38, 92}
+, {68, 20, -18, -66}
+, {-70, 7, -39, 38}
+, {-70, -57, -45, -32}
+, {-48, -44, -62, -58}
+, {-32, -62, -70, -100}
+, {-94, 6, -70, 30}
+, {-58, -53, -117, -112}
+}
+, {{86, 69, -5, -22}
+, {58, -9, 27, -40}
+, {120, 6, 46, -68}
+, {2, 39, 27, 64}
+, {72, 48, 26, 2}
+, {-92, -133, -53, -94}
+, {60, 109, 11, 60}
+, {-92, -42, -84, -34}
+, {-74, -12, -14, 48}
+, {4, 54, 2, 52}
+, {32, 45, -65, -52}
+, {24, 12, -78, -90}
+, {6, 28, 54, 76}
+, {-28, 54, 10, 92}
+, {-106, -92, -12, 2}
+, {4, 67, 13, 76}
+, {-32, -77, -13, -58}
+, {-94, -89, -65, -60}
+, {110, 67, 77, 34}
+, {104, 52, 2, -50}
+, {-60, -77, -89, -106}
+, {34, 53, -39, -20}
+, {50, 37, 63, 50}
+, {124, 119, 45, 40}
+, {-58, -69, -41, -52}
+, {-4, -55, 67, 16}
+, {62, 84, 84, 106}
+, {86, 69, 87, 70}
+, {62, 15, 39, -8}
+, {-76, 12, -76, 12}
+, {-96, -82, -30, -16}
+, {-52, -19, 5, 38}
+, {-96, -56, -70, -30}
+, {-56, -92, -62, -98}
+, {106, 69, 13, -24}
+, {56, 41, 61, 46}
+, {84, 49, -45, -80}
+, {22, 8, 26, 12}
+, {28, -21, 11, -38}
+, {76, 44, 10, -22}
+, {-30, -6, 62, 86}
+, {-78, -15, 21, 84}
+, {0, 15, 37, 52}
+, {-94, -32, -102, -40}
+, {-6, 49, -55, 0}
+, {-68, -58, -38, -28}
+, {36, 32, 38, 34}
+, {-38, -41, -17, -20}
+, {42, 128, 44, 130}
+, {70, 39, 85, 54}
+, {82, -8, 0, -90}
+, {42, 6, -36, -72}
+, {42, -19, 47, -14}
+, {-50, 23, 5, 78}
+, {-60, -14, -2, 44}
+, {74, -12, 18, -68}
+, {94, 94, 56, 56}
+, {-64, -48, -90, -74}
+, {-48, -12, -50, -14}
+, {68, -57, 49, -76}
+, {82, 65, 99, 82}
+, {16, 69, 5, 58}
+, {-8, -51, -49, -92}
+, {-22, -32, 50, 40}
+}
+, {{-4, 62, -8, 58}
+, {28, -25, -9, -62}
+, {-46, 14, -72, -12}
+, {66, 91, 39, 64}
+, {18, 54, 22, 58}
+, {0, 46, -58, -12}
+, {28, 112, 10, 94}
+, {-28, -8, 0, 20}
+, {108, 0, 32, -76}
+, {-90, 20, -30, 80}
+, {10, 67, -21, 36}
+, {-26, -40, -36, -50}
+, {10, 92, 0, 82}
+, {92, 21, 77, 6}
+, {4, -64, 30, -38}
+, {-66, 8, -66, 8}
+, {-28, -23, -45, -40}
+, {-60, -118, -72, -130}
+, {30, 21, -11, -20}
+, {-34, 47, -37, 44}
+, {108, 61, -49, -96}
+, {-50, 9, -135, -76}
+, {-92, -96, 0, -4}
+, {-78, -33, -45, 0}
+, {128, 105, 169, 146}
+, {-6, 56, 22, 84}
+, {26, 20, -62, -68}
+, {106, 45, 63, 2}
+, {-16, -67, 29, -22}
+, {-92, -96, -84, -88}
+, {-124, -186, -46, -108}
+, {-26, -113, -29, -116}
+, {96, 10, -16, -102}
+, {2, 12, -80, -70}
+, {54, 39, 17, 2}
+, {0, 9, -3, 6}
+, {-108, -68, -12, 28}
+, {96, 114, 4, 22}
+, {-76, 51, -47, 80}
+, {58, -5, 59, -4}
+, {12, -74, 32, -54}
+, {88, 71, 63, 46}
+, {108, 5, 57, -46}
+, {-88, -82, 16, 22}
+, {80, 5, -47, -122}
+, {-20, -3, 19, 36}
+, {38, 113, -3, 72}
+, {-32, 40, -24, 48}
+, {8, -8, -68, -84}
+, {36, -50, 56, -30}
+, {-10, 15, -37, -12}
+, {-36, -71, -15, -50}
+, {-34, -46, -44, -56}
+, {-82, 9, 47, 138}
+, {-98, -67, -11, 20}
+, {-6, -18, -16, -28}
+, {76, 44, 26, -6}
+, {10, -22, -22, -54}
+, {54, 96, 36, 78}
+, {-68, -80, 6, -6}
+, {68, -27, 63, -32}
+, {38, 67, 25, 54}
+, {100, 17, 99, 16}
+, {-86, -82, -14, -10}
+}
+, {{-56, -23, 43, 76}
+, {30, 25, 61, 56}
+, {-14, -89, 3, -72}
+, {22, 14, -14, -22}
+, {-60, -62, 42, 40}
+, {90, 29, 11, -50}
+, {112, 67, 31, -14}
+, {26, 3, -29, -52}
+, {-22, -51, 35, 6}
+, {-104, -75, -21, 8}
+, {94, 51, -33, -76}
+, {66, 24, 24, -18}
+, {8, 17, -9, 0}
+, {20, -68, -32, -120}
+, {44, 48, -10, -6}
+, {12, 46, 16, 50}
+, {20, -25, 29, -16}
+, {-20, 65, 29, 114}
+, {22, 4, 76, 58}
+, {68, 31, 73, 36}
+, {-8, 52, -40, 20}
+, {6, -49, -17, -72}
+, {36, 1, -49, -84}
+, {68, 82, 18, 32}
+, {-74, -3, 11, 82}
+, {70, 17, 93, 40}
+, {-30, -32, -102, -104}
+, {98, 153, 43, 98}
+, {-46, -42, -110, -106}
+, {8, -50, 10, -48}
+, {-96, 7, -67, 36}
+, {4, 43, 21, 60}
+, {-40, -21, -1, 18}
+, {-66, -98, -16, -48}
+, {-104, -70, -140, -106}
+, {64, 14, -66, -116}
+, {-104, -22, -122, -40}
+, {70, 29, 53, 12}
+, {-28, -50, 16, -6}
+, {-104, -125, -87, -108}
+, {-76, -115, -61, -100}
+, {16, 6, 40, 30}
+, {64, 70, 8, 14}
+, {-106, -86, -126, -106}
+, {-16, -44, -16, -44}
+, {92, 61, 57, 26}
+, {66, 52, 86, 72}
+, {92, 14, 116, 38}
+, {22, -27, -9, -58}
+, {56, 31, 15, -10}
+, {-56, 1, 1, 58}
+, {42, -48, 20, -70}
+, {-70, -28, -36, 6}
+, {72, 88, 60, 76}
+, {-36, -106, 10, -60}
+, {-38, 46, -26, 58}
+, {-72, -45, -71, -44}
+, {-12, -7, 11, 16}
+, {-50, 0, -82, -32}
+, {84, 25, 17, -42}
+, {86, 30, -24, -80}
+, {-26, 26, 36, 88}
+, {62, 53, -43, -52}
+, {36, 6, 8, -22}
+}
+}
+;
+
+#undef INPUT_CHANNELS
+#undef CONV_FILTERS
+#undef WINOGRAD_TAPS
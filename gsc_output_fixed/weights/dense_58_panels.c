@@ -0,0 +1,338 @@
+/**
+  ******************************************************************************
+  * @file    weights/dense_58_panels.c
+  * @version 1.0.0
+  * @date    17 october 2026
+  * @brief   Kernel of dense_58 packed in panels of 8 units for dense_gemm.h, generated by
+  *          tools/dense_panels.py
+  */
+
+#define DENSE_58_PANELS
+
+const int16_t dense_58_panels[5][64][16] = {{{49, 31, -71, 81, -60, 13, -68, -8, -27, -8, -23, -58, 37, -64, 55, -7}
+, {-50, 62, 60, -27, 111, 71, 15, -40, -57, -58, -80, 60, -69, 76, 82, -39}
+, {-23, 4, 87, -34, 66, 25, 36, -48, 61, -119, -13, -66, -29, -32, 92, -21}
+, {48, -8, 18, -69, -80, 74, -80, 29, 19, -16, -22, -10, -19, -26, 13, 75}
+, {-75, -13, -8, 48, -47, 70, 75, -75, -71, -33, 102, 35, 3, 18, -26, 67}
+, {91, -10, -50, 15, 58, -12, -51, 48, 75, 70, 21, 83, -85, -79, 22, 88}
+, {-50, 40, 58, 80, -82, -11, -59, 24, -50, -79, -82, 84, -57, -72, -58, 58}
+, {-7, -85, -49, 22, -25, 95, 82, 90, -77, -81, -62, -72, 61, -53, -71, 75}
+, {-45, -61, 0, 80, -57, -25, 69, -32, -65, 56, -36, -6, 25, -81, 35, -33}
+, {44, 15, -44, -16, 59, 46, -59, -3, -53, 90, 28, 71, 102, -102, -88, -70}
+, {38, -9, -3, 11, 82, -5, 82, -1, -72, -53, 58, 53, 88, 2, 90, -44}
+, {127, -59, 89, 80, 83, -63, 33, -77, -15, -100, -108, 66, -25, -77, -26, -23}
+, {-102, -57, -61, -1, -68, -102, -90, 85, 42, -87, 55, 105, 41, 32, 59, -25}
+, {68, 86, -60, 55, -76, 76, -12, 43, 29, -6, 66, 17, -8, -31, -24, 10}
+, {-71, -95, -44, 30, 7, 90, 5, 22, -27, -66, -49, 62, -30, -12, 73, 69}
+, {6, 17, 91, -41, 34, -100, -25, 92, -43, 106, -79, 54, 93, 42, 23, -8}
+, {-54, 65, -46, 32, -15, -49, -20, -21, -81, 5, 32, 89, 6, -90, 95, 59}
+, {31, -65, 9, 92, -2, -21, -94, 67, -86, 46, 34, -3, 91, 12, 37, -71}
+, {-25, 45, -5, 42, 24, 82, 39, -73, 71, -20, 89, -79, 40, 42, -42, 17}
+, {-84, 64, 42, -16, 60, -55, 53, 52, 27, 102, 15, 12, 31, 35, 24, -37}
+, {35, -95, -87, -3, 76, 59, 6, -96, 41, -25, -28, -74, 7, 14, -63, 64}
+, {21, 86, 5, 76, -3, 69, -102, 85, -48, 77, -64, 74, -67, 66, -17, -96}
+, {-14, -84, 16, -60, -82, 65, -89, -75, 52, 42, -28, 37, -65, -83, -30, 9}
+, {116, 80, -23, -25, 20, -21, 111, 55, 106, -32, -76, -66, -62, -92, 88, -8}
+, {-46, 87, -27, -71, -36, -51, 68, -2, 42, 2, -3, -35, 10, 50, 77, -48}
+, {87, -58, -36, 33, -73, -34, -100, -4, -83, 95, -60, -25, -80, -41, 55, 87}
+, {-21, -34, 74, 22, 40, -33, 70, -49, 51, 91, -89, -63, 45, 76, -20, -46}
+, {-74, 57, -86, -6, -20, -56, -45, 71, 59, -88, -94, 8, 3, -50, -59, 13}
+, {-9, -47, 68, -29, 19, 44, 17, 52, 17, 74, 101, -85, 72, -33, 20, 79}
+, {-70, 0, 17, -30, -94, 108, 92, 65, -41, 57, 70, -57, -67, -50, 51, 23}
+, {115, -33, 66, -26, -74, 17, -45, 74, 7, 41, 19, -101, 43, 62, -53, 32}
+, {56, 16, -67, 67, -33, -13, 15, -29, -49, 94, 11, 20, -2, 54, -24, 54}
+, {14, -2, 19, -20, -43, -11, -38, 21, 73, 80, 39, -56, -60, 76, 59, -52}
+, {-50, 83, 72, 30, 63, -57, 53, 20, -71, 42, -96, 50, -28, 85, -45, 70}
+, {75, -89, -23, -70, 20, 2, -88, 12, -42, -9, -57, 31, -106, 44, 30, 15}
+, {-94, 9, 73, 8, 47, -52, 60, -102, 60, -63, -63, 78, 88, -75, -16, -52}
+, {-29, 7, 58, 22, -44, -37, -44, 32, 4, 14, 15, 101, 66, -71, 8, 60}
+, {-43, 38, 49, 33, -77, -28, -89, -21, 9, 46, -35, 68, -108, -26, -1, 0}
+, {64, -32, 68, 16, 40, -65, -24, -40, -50, 44, 41, -41, -46, -9, 79, 12}
+, {-79, -5, 21, 16, 39, 78, 48, -35, -42, -60, -61, -55, 92, 55, -66, -33}
+, {66, -58, 11, -40, 34, 12, -82, -14, 42, -90, -37, -56, 45, 28, -74, -100}
+, {-70, 110, -77, 57, 21, 14, 3, -66, -68, 75, 66, 42, 99, -59, -79, -77}
+, {-28, 33, -86, 21, -80, -11, -7, -19, 55, 53, 89, 74, -43, 52, 11, 1}
+, {-25, -12, 93, 53, 27, -54, 79, -32, 29, -63, -16, -11, 54, -41, 12, -43}
+, {96, -7, 80, -41, -13, -85, -71, 6, 8, -18, -53, 63, -77, 69, -90, -78}
+, {44, -58, 46, -27, 21, -45, 79, 14, -98, -36, 40, 60, 2, -65, -31, -10}
+, {-77, -96, 106, -42, -74, 38, 30, 7, 9, 29, 105, -20, 54, -48, -85, -92}
+, {40, 17, 77, -53, 12, 57, -4, -4, 37, -71, 98, 22, 12, 66, 15, -54}
+, {-44, -25, 15, -60, -62, -64, 58, -95, 10, -35, 31, 17, -80, -41, 27, -56}
+, {4, -65, 56, -34, -41, 63, -62, 41, -28, 5, -58, 47, 3, 81, -59, -93}
+, {38, 20, -20, 74, -4, -15, 25, 93, -86, 30, -74, 63, 81, 5, -12, 23}
+, {18, 24, -2, 93, -46, 22, 73, -78, -9, -100, -15, -42, 88, -94, -25, -3}
+, {-48, 82, 34, -6, -74, -77, 31, 49, -15, 19, 19, -52, 71, 17, -89, -24}
+, {-53, 14, 81, -5, 48, 56, -16, -85, 62, -10, 36, 58, 23, 69, -91, -27}
+, {-29, 23, -75, -66, -18, 86, 89, 35, -70, 73, 66, -18, -79, -75, -79, 73}
+, {14, 62, -13, 110, -54, -109, -31, -36, -34, 41, 36, 37, 92, 56, -64, -69}
+, {-56, 55, -64, -76, -2, 16, 79, 62, 69, 28, 87, 2, 49, -46, -18, -10}
+, {-83, -53, 47, 31, 48, 40, -18, 38, 11, -41, 12, 48, -43, -33, 85, 24}
+, {-36, 51, 36, -96, -20, -42, 26, 56, -83, 65, -28, -75, -32, -64, -60, 69}
+, {36, 27, 19, -22, 64, 11, 21, 24, -48, 59, -4, 4, -38, 59, -43, -59}
+, {36, 84, -29, -83, -70, 93, 37, -32, 48, 74, 36, -75, 13, -36, -83, -19}
+, {2, -94, 50, 42, -31, 63, -19, 84, -44, -9, 70, -34, 27, 89, 30, 69}
+, {44, -74, -46, 17, -56, 46, 109, -94, 15, -78, 92, -53, -69, 12, -30, 53}
+, {-50, 72, 77, 90, 94, -39, -74, -33, -47, -22, -9, -5, -20, 19, 1, -2}
+}
+, {{-1, 72, -13, -16, 50, 62, -78, -29, -54, 78, 52, 63, 5, 10, 30, -35}
+, {-107, 11, -66, -14, -83, 27, 74, 27, 62, -24, -50, -6, 87, -70, -71, -68}
+, {88, -21, -68, 91, 10, 100, -69, -12, 50, -41, -23, 57, -28, 28, 79, -10}
+, {36, -71, 16, 21, 64, -76, 61, 75, 36, -53, 65, -2, 100, 47, -19, 29}
+, {-107, 90, 30, 59, 39, -13, 4, -40, -69, 26, -12, 91, 61, 2, 87, -76}
+, {43, 83, 59, 32, 21, 21, 36, -81, -4, 21, -32, -17, 54, -36, 17, 100}
+, {-17, 38, 76, -21, -31, -10, 68, -51, 68, 35, -27, 37, 66, 94, 68, 12}
+, {27, 87, 82, -43, -51, -95, 15, 10, 85, 72, -62, 21, 88, 15, 106, 65}
+, {53, -75, -36, 67, -100, 27, -20, 48, 75, -4, -47, 49, -47, 55, -57, 38}
+, {-5, 64, 80, 42, -35, 0, 4, 58, 44, 49, -38, -20, 92, 8, 22, 49}
+, {21, -55, -93, -12, 10, 93, 95, -32, 0, 79, 18, -60, -59, 50, 22, 67}
+, {-26, -28, 51, 23, -89, -50, -29, -58, 30, 69, 0, -26, 29, 47, -74, -70}
+, {34, 85, -62, 77, 1, -70, 12, 24, 14, 40, 22, 106, -100, -63, 69, 30}
+, {80, -58, 81, -15, -82, -103, 68, -21, 31, 28, -74, -101, -61, 64, 57, 24}
+, {-55, -60, 17, -90, 48, -30, 10, 69, -96, 44, 6, 0, -72, 30, -83, -72}
+, {-56, 100, -17, -17, 46, -59, 33, 91, 63, -107, 63, 107, 70, -65, 9, -24}
+, {-66, -11, 39, -85, -30, -36, -73, -8, -38, 9, 68, -41, 58, -53, 57, -83}
+, {53, -90, -80, -62, -41, -35, -45, -42, -55, -95, -7, -52, -13, 81, -17, 74}
+, {92, -83, 8, 67, -53, 87, -70, 71, -6, 54, 0, 18, 20, -76, 15, -82}
+, {-54, 83, 82, 9, 39, -28, -2, -61, -41, -51, -60, 86, 11, 45, -92, -81}
+, {62, -20, 38, -80, -121, 90, -8, 75, 52, -33, 61, 27, -15, -72, 37, 17}
+, {-22, 84, 17, -40, -77, 87, 87, -92, 57, 93, -88, 29, 67, 33, -22, -17}
+, {37, 79, -46, -43, 7, 87, 11, 64, 68, -76, -40, -5, -92, 12, 89, -101}
+, {65, -97, 6, -44, 65, 78, -99, 29, 82, 110, -90, 47, 84, 46, -6, 1}
+, {-31, -3, 35, -68, -78, 3, -28, 51, -71, 15, -65, -15, 57, 58, -30, -49}
+, {-47, 32, 94, 4, 38, -82, -95, -90, -81, 27, -95, -59, 16, 35, -66, 66}
+, {42, -57, -44, -79, -53, -62, -85, 5, 84, 72, -62, -97, -56, 14, 4, 43}
+, {-76, 47, -5, 92, 77, -31, 88, -95, 90, -57, -10, -76, 74, 12, -67, 66}
+, {-14, 59, 19, -19, -77, -43, -33, -57, -12, 50, -105, -94, -73, -2, -12, -14}
+, {6, -5, -93, 60, -77, 17, -53, 106, -79, -79, -51, -39, -28, 0, 93, 34}
+, {-92, -33, -18, 71, -97, 64, 99, 22, 21, 90, -76, -74, -43, 84, -49, 56}
+, {2, 34, 58, 70, 57, 54, 90, -83, 46, 18, 85, 72, 31, 45, 41, -28}
+, {-23, -30, 42, 67, 69, -88, -38, -57, 35, -32, 90, -26, -82, 44, 15, 106}
+, {61, -37, -25, -17, -93, -17, 12, -45, 51, -91, 15, 67, 31, -58, -21, 83}
+, {98, -41, 3, -9, 39, -6, -88, 56, 43, 36, -21, -57, -37, -71, 86, -15}
+, {107, 52, -59, 16, -66, -34, 11, 51, 52, 60, 90, 17, -17, -7, 15, -80}
+, {17, 63, 50, 1, 67, 85, -108, -53, -40, -47, -43, 115, -34, -12, 30, 29}
+, {-82, 30, -68, 69, -53, 38, -71, 88, -52, 18, 31, 57, -53, 29, 80, 26}
+, {-73, -23, 80, 88, 33, 16, -28, -61, -9, -48, -116, 23, -33, 0, 51, 48}
+, {61, -89, -6, 62, -15, -57, 30, -43, 44, -1, 32, 21, 9, -39, -92, 89}
+, {-61, -42, -42, -38, 17, -99, 37, -45, -13, 29, -10, -90, -69, -31, -41, -55}
+, {-21, -62, -74, 2, 75, -35, 98, 69, 79, 14, 61, -82, 100, 3, 13, -61}
+, {-81, -61, 40, -8, 38, -41, 89, -75, -45, 28, 85, 83, 4, 63, 3, -83}
+, {-37, 27, 21, -11, 97, -11, -57, -50, -13, -96, 78, -86, -59, -27, 43, 94}
+, {-39, -68, -74, 86, 32, 91, -11, -25, 59, -20, -8, -84, -44, -34, -6, 58}
+, {-38, -22, -10, -13, -86, -76, 89, 56, 53, 43, -71, 82, 24, -65, -71, -93}
+, {-53, 32, -51, 7, 23, 100, -95, 3, 32, 64, -43, 79, 98, -75, 38, -36}
+, {-38, -94, -85, 28, -33, -73, 8, 20, 53, -101, 45, -88, -15, -43, -71, 101}
+, {32, 83, -93, 72, 4, -1, -46, -99, -46, -37, -13, 35, -1, 28, 30, -68}
+, {-24, 67, -77, 83, -75, 0, -39, -70, -73, 18, 90, 68, 106, 39, -56, -79}
+, {44, -17, -89, 3, -29, -81, -20, -9, 72, -2, -17, -70, -40, -97, 87, -67}
+, {-33, 59, 55, -87, 31, -45, -78, 70, 68, -82, -7, -3, -21, -26, 34, -25}
+, {74, 82, -40, -41, 30, 28, -53, 37, -90, 25, -67, -25, -9, -42, -38, -54}
+, {-23, 76, 70, -14, -65, 69, -19, -92, -86, 64, -91, 80, -28, -48, 65, -107}
+, {83, 28, -71, 18, 70, 14, -49, 48, -23, -40, -84, 10, -15, -3, 77, 53}
+, {5, -28, 96, -57, -19, 15, 12, 3, -53, -106, 22, 90, -26, 29, 2, 10}
+, {60, 9, -53, -30, 48, 35, 5, 57, -63, -72, -50, 97, 82, 7, -3, -12}
+, {70, -68, 21, 52, 88, 84, 6, -85, 79, 33, 83, 58, -44, 60, -86, -26}
+, {84, 116, 50, -103, 1, -1, 20, 57, -96, 29, -77, 25, 8, 81, -6, 81}
+, {17, -58, 14, -34, 18, -78, -48, 39, 19, 40, -21, -89, -25, 80, 70, 51}
+, {-12, -103, 35, 56, 30, -88, 0, -23, -21, 74, 51, -43, 35, -22, -92, -37}
+, {-68, 6, 87, 58, -86, -75, 30, -49, 3, 24, -93, -16, 10, 24, -56, 87}
+, {-80, -17, 68, 45, 68, 47, 0, 47, 59, 68, -91, 1, -97, -1, 10, 27}
+, {-8, -31, 6, -20, 35, -35, -72, -38, 43, 27, -100, 22, 4, -69, -51, -35}
+}
+, {{71, 43, -79, 0, -36, -109, 25, -84, 62, 19, -24, -30, -61, -21, 20, -63}
+, {59, -68, 58, -42, 85, 72, -12, -68, -11, 81, 34, 30, -46, -91, -82, -85}
+, {-47, 60, -80, -30, -6, -30, -14, -35, 16, -17, -55, 91, 66, 95, 88, -105}
+, {82, 61, -25, -25, -43, 103, -80, 137, -14, 19, -41, 26, -99, -55, 87, 85}
+, {41, 27, -55, -94, 36, 35, 19, -28, -43, -4, 44, -31, -12, -2, -35, 78}
+, {-86, 70, 92, -48, 82, 85, 17, 49, -63, 77, -22, -25, -101, 31, 6, 26}
+, {-35, 37, 13, -42, -57, 56, 37, -60, -38, 33, 3, 50, 61, 8, -42, -26}
+, {75, -26, 31, -19, -24, 13, -92, -67, -63, -40, 4, -85, 34, 52, 37, 91}
+, {-39, -63, -53, -67, 14, 18, 85, 36, -39, 67, -59, -86, -104, 71, 105, 34}
+, {-26, 27, 58, -55, -3, 13, 85, 42, -7, 99, 6, -7, -51, -27, -109, -66}
+, {-38, 36, 91, -91, 74, -17, -27, 78, 30, 111, -52, -63, -16, 67, -29, -74}
+, {52, -96, 48, -89, -10, 66, -26, 22, 72, 1, -29, 24, 15, 0, 90, -14}
+, {-6, -20, -45, -22, 79, 90, -94, 30, -18, -53, 6, 40, -20, -72, 90, 46}
+, {4, 5, -41, -81, 26, -22, -96, -24, -16, -2, 17, -69, -50, 55, -32, -3}
+, {-6, -27, -30, -81, -16, 110, -32, 87, -21, -19, -27, -4, 2, -33, -101, -64}
+, {51, 53, 88, 33, 28, -11, 98, -73, -23, -22, 10, -58, 26, 35, 80, -53}
+, {54, -40, -97, -6, -44, -7, 49, -72, 72, 96, 26, 34, -62, 66, 69, 63}
+, {50, 95, -76, 48, -35, -50, -99, -59, 94, 21, 97, 39, 22, 3, 80, 54}
+, {90, 46, -101, -60, 84, -68, 72, 80, 48, -24, 4, 8, 107, 82, -58, -66}
+, {-56, 5, -22, 43, -58, -54, -37, -63, -15, -7, 52, 4, 26, 2, 49, -88}
+, {57, -95, 32, -17, -10, 26, -109, -84, 24, 69, 61, 41, 48, -59, -26, -47}
+, {94, -51, -59, 40, -29, 27, 24, 4, 95, -55, -55, -50, -39, 92, -90, 65}
+, {-100, 80, -81, -22, 76, -21, 97, 75, -79, 64, 39, 9, -34, -25, 86, 60}
+, {9, -83, 69, 84, 23, -98, 50, 0, 53, 38, 21, 30, 0, -111, 86, 19}
+, {-87, -98, -45, 23, -42, 50, 71, 39, 8, 45, 61, 91, 3, 14, 46, 17}
+, {66, -53, -60, 69, -27, 94, 38, -90, 59, -38, -5, 95, 35, -51, -96, -56}
+, {17, -79, -62, -29, 45, 20, 33, -52, -48, -50, -101, -14, -53, 55, 14, 54}
+, {-15, -49, 9, -18, 87, -3, -7, -31, -27, -78, -65, -46, -28, -38, -24, -16}
+, {-69, 27, 93, 33, 76, 45, 66, 45, -33, -12, 86, 85, -34, -71, 19, 8}
+, {-66, 24, -79, -63, -79, 14, -86, 99, 43, 96, -88, 63, 79, -83, 92, -84}
+, {-22, -30, 83, 91, -51, 96, 98, 105, -29, 81, -77, -48, -22, 7, -90, -54}
+, {48, -96, 2, 25, -1, -7, -51, -41, 4, -49, -37, 52, -86, -72, 43, 26}
+, {-7, 54, -47, -57, 46, 84, 38, 81, -57, -18, -15, 56, -58, 37, -40, 48}
+, {92, -48, 66, 90, 27, -10, -42, -8, 92, -15, -51, -75, 62, 47, -48, -60}
+, {64, 89, 9, 27, 52, 73, -69, 43, -51, -88, 3, 18, -25, 11, 13, 14}
+, {-90, 43, 68, 17, 43, 35, -29, 16, -41, 59, -14, -82, 59, 95, -69, -81}
+, {36, -95, -65, -95, -24, 15, -85, -14, 79, 92, -8, -71, 34, 65, -21, -74}
+, {100, 3, -4, 32, 63, 42, -70, 38, 88, 88, -82, 36, -31, -6, -26, 74}
+, {-3, 0, 22, 1, 74, -61, -17, 77, 64, 6, -47, -69, -54, -68, 99, 22}
+, {27, -32, 90, 90, -58, 60, 51, -64, 51, 43, 77, 5, 10, 11, 15, -69}
+, {87, 27, -2, -75, -89, -49, -84, -86, 34, -27, 56, -10, 48, -6, 12, -100}
+, {78, -32, -48, 17, -29, -71, 86, -73, 94, -24, -44, -36, 33, -111, -28, 38}
+, {4, -69, 76, 73, -8, 4, -42, -7, -78, 82, -88, -88, -35, 36, 50, -71}
+, {-21, 49, -78, -19, 17, 76, 67, -55, 11, 20, 53, 94, -90, 58, 43, 14}
+, {-10, 83, 4, 50, 105, 47, 75, 65, -30, -39, 2, -12, -3, -89, 17, 25}
+, {-88, -3, -82, 27, 43, 26, 41, 89, -91, 64, 46, 25, 52, 56, -46, 86}
+, {-37, -68, 36, 51, 41, 50, -67, 83, -48, -35, -18, -1, -2, -46, -54, 80}
+, {-26, 94, 68, -80, -43, -50, 83, 65, 94, 25, 33, -7, -20, -7, 21, -34}
+, {-30, 60, 81, -83, 74, 65, -1, 83, -9, -40, 47, -34, 40, -1, 57, -60}
+, {-75, 49, -44, 1, 95, -86, -76, 13, -57, 15, 74, -26, 0, -26, 33, -99}
+, {78, -106, -24, -17, 53, 66, 99, -16, -82, -31, 88, 76, 27, 11, -6, 103}
+, {67, -37, -92, 51, 85, -77, -10, 20, 30, 18, -82, -16, 74, -24, 0, -58}
+, {-58, 77, 53, 49, 64, 24, 12, -95, -15, -41, -91, 47, -25, 76, 66, -95}
+, {68, 45, -17, -37, -10, 57, -58, 12, -90, 22, 5, 41, -9, -55, 83, -89}
+, {-17, 74, -68, 101, -87, -48, -66, -95, 93, -1, -13, -72, 104, -104, 6, 78}
+, {-62, -53, 102, -60, -90, -25, 4, -44, -58, -38, -3, 15, 55, -26, -37, 68}
+, {66, -72, -27, -54, -56, 64, 39, 14, -101, -71, 9, 37, 40, -3, -78, 58}
+, {69, 82, 91, -65, 37, 65, -70, 73, 42, 14, 62, 16, 4, 66, -37, -56}
+, {88, -52, -14, 16, 50, -30, -85, -40, -49, 94, -4, 24, -28, -24, 35, -40}
+, {79, -67, 90, 30, -99, 87, 10, 17, 113, 41, 39, 47, -26, 5, 43, 50}
+, {15, 43, -85, 64, 0, 98, -30, 90, 89, -40, -59, 75, 25, -90, 67, -65}
+, {71, -49, 39, -48, 70, -93, 27, 90, 54, -14, -68, -93, -86, 70, 64, -22}
+, {-17, 17, -62, -33, 36, 13, 92, -24, 51, -2, 10, 5, 116, -82, -82, 93}
+, {83, 77, -11, -32, 55, 43, -42, -27, 13, -85, 74, -47, -4, -99, -99, -54}
+}
+, {{45, -28, 2, -51, 39, -1, 19, 0, 72, 21, 15, -34, 86, 42, -5, -48}
+, {17, -27, -43, -95, 78, -51, 48, 6, -95, -62, 51, 73, -45, 87, 122, 38}
+, {78, 23, -14, -75, 78, -15, 88, 54, 37, 40, -81, -63, -55, 75, 64, 7}
+, {-75, 74, 36, 77, -48, 65, 46, 9, -50, -67, 17, -55, -65, 79, 2, 57}
+, {-75, 87, 29, -6, -76, 22, -29, 72, -31, 24, 0, -44, 58, 25, 39, -106}
+, {-24, 4, 13, 53, 12, 26, 87, 37, 25, 37, -74, 33, 58, -106, 58, 74}
+, {14, -97, 82, 56, -57, 0, -95, 70, 4, 40, 72, -29, -71, -53, 31, 33}
+, {-15, 10, 35, -39, -54, -51, 19, 69, -27, 30, -54, -68, -58, -34, -55, 19}
+, {71, -50, -12, -53, 24, 32, 57, -62, 78, -29, 0, 35, -67, 6, 79, -47}
+, {-63, -50, -69, -41, 82, -44, 33, 82, -76, -52, 20, -45, 40, -48, 12, -37}
+, {-16, 74, 65, 70, 27, -16, -13, -42, -10, 48, -101, 55, -49, -6, -47, -63}
+, {39, 93, 76, -74, 47, 14, 75, 48, 79, -59, -5, 33, 55, -78, -31, 39}
+, {-20, 45, -17, -37, -64, -72, -88, 74, 46, 63, 23, -53, 72, 22, -27, 69}
+, {-87, 38, -87, 103, 28, 3, -16, -56, -3, 96, 30, 21, 9, 54, 51, -44}
+, {79, -72, 25, -75, 38, 94, 31, 40, 40, -20, -38, 66, 99, 11, 12, 49}
+, {39, 72, -13, -111, -25, -43, -80, 3, 83, -86, 15, 56, 31, 82, 22, -2}
+, {-6, 74, 72, -26, 4, -11, -80, 37, 54, 60, -78, -29, -57, -13, -56, 0}
+, {4, -82, 34, 21, -5, 20, -86, -32, -55, 25, -80, -18, 78, 46, 45, -50}
+, {86, -82, -18, -26, -23, -40, -51, 53, -76, -58, 54, -19, 69, -75, -73, 58}
+, {47, 100, 26, -95, -47, -26, -8, -100, -5, 99, 92, -27, -86, -54, -113, -100}
+, {88, -64, -44, -36, -8, 75, 22, -14, -37, 75, -54, -39, 94, 59, -97, 86}
+, {-34, -64, -95, 37, -72, -86, -27, -34, 88, -45, 67, -20, 69, 31, 25, -90}
+, {-39, 55, 45, -45, -45, -104, -1, 21, -53, -40, 73, -34, 20, -90, 25, 83}
+, {-79, 0, -19, 69, 29, -1, 57, -67, -70, 10, -73, -15, -79, 26, -13, 13}
+, {-82, -60, 77, -82, 15, 44, -20, 27, 33, 4, -94, -55, -113, 59, 36, 46}
+, {12, -54, -79, -87, 33, -66, -70, 6, -14, -5, 5, -23, 66, -112, 53, 111}
+, {73, -71, -94, -15, -38, 67, 2, -84, 27, -38, -53, -99, 54, -91, 97, -31}
+, {47, 49, 42, 80, 92, 35, 28, -98, 34, 94, 7, -52, 26, 56, -88, -14}
+, {-69, -71, 81, 8, 60, -69, 4, -56, -95, 43, -51, -41, -90, -8, -31, 23}
+, {-70, -65, 9, -82, -44, -81, -53, -18, -95, 27, 21, -32, 36, -15, 0, -84}
+, {27, -6, 20, -3, -3, -32, 86, -18, 64, 42, -79, 85, 17, -90, 52, -1}
+, {-33, -22, -56, -64, 31, -69, 21, -5, -99, -44, -4, 41, 50, -33, -30, -9}
+, {-79, 47, -36, 3, 37, -70, 77, -63, 16, -76, 42, -67, -95, -3, -11, 88}
+, {82, 91, 87, -98, 19, 70, -1, 90, -69, -64, 21, 8, -41, -107, -40, 85}
+, {21, -51, -18, 35, 32, -42, -75, -79, 55, -74, 37, 26, 6, 64, -59, 18}
+, {73, 20, -70, 61, -32, 67, 71, 69, -94, -88, 14, 100, -42, 92, 60, 23}
+, {-77, -4, -80, 38, 50, -6, 81, -53, 18, -14, -46, 27, -35, 88, 11, -89}
+, {-58, -6, 14, 59, -82, 2, -6, 87, 0, 89, -81, -44, -79, -47, 0, -78}
+, {29, 10, 16, 18, 95, -100, 64, -22, 15, -29, 104, 3, 21, -24, 34, -14}
+, {54, 32, -57, 49, -75, 4, 61, 87, 32, -97, -68, 91, 93, 41, -29, 4}
+, {2, 19, -9, -82, -97, -8, 27, 22, 15, 16, 74, -68, 12, 34, -15, -19}
+, {23, -87, -19, 81, -78, -13, -50, -88, -13, 71, -35, 73, -11, 13, 78, 29}
+, {-94, -67, 67, 62, 31, -90, -64, -93, -70, 90, -17, -87, 21, 74, -71, 26}
+, {67, -83, 38, -83, -13, -68, 78, 78, -21, -84, -36, 87, 25, -41, -61, 81}
+, {-18, 36, -39, 62, -35, 111, 41, -36, -12, 30, 87, -37, -84, 53, -33, 29}
+, {-26, 37, -20, 11, 82, 63, 0, -89, -99, -8, 47, 42, 0, -43, 97, 28}
+, {21, 69, 2, 54, -42, 59, -8, 40, -42, 55, -24, -81, -70, -84, -87, -33}
+, {90, -104, -44, 49, -15, 27, 5, -62, 69, -23, -53, -2, 21, 69, 50, -11}
+, {59, 5, -57, -7, -30, -83, -50, 31, 75, 24, -73, 101, -80, 0, 8, 60}
+, {27, -39, 26, -69, -18, 9, 18, -90, -2, -58, 42, -69, -89, -49, 113, -34}
+, {-57, 26, -72, 48, 96, 82, 0, -49, -96, -88, 21, -6, 19, -82, -3, 98}
+, {32, -36, -25, 74, 105, 90, 31, 33, 53, 48, -68, 28, -22, 100, -84, 14}
+, {61, -16, -86, -72, -79, -4, -57, -5, -24, 78, 59, -21, 81, 31, 52, -76}
+, {-48, -9, -67, -24, 17, -22, -20, -19, 57, -20, 1, 49, -55, 67, 37, -55}
+, {-45, 35, 98, -62, 38, 19, -1, -90, -46, 6, 4, -56, 73, 24, -86, -59}
+, {10, 20, -95, 60, -87, -40, -26, 54, -91, -102, 9, -55, -99, 93, 62, -81}
+, {-10, 72, 74, -53, -15, -8, 27, 39, -102, 69, 43, -91, -35, -78, 17, -63}
+, {18, -30, -12, 13, -86, -43, -62, -44, -33, -37, 35, 49, -47, 47, 29, 94}
+, {-27, 98, 83, -27, -1, 93, -35, -31, 7, 28, 46, -13, 65, 4, 0, 61}
+, {92, 85, 37, -35, -55, 35, 88, -18, 56, -19, 12, 84, -15, -67, 9, 18}
+, {-47, -23, -25, -7, 29, -12, 46, 41, 67, 46, 4, 84, -76, -47, -46, 35}
+, {-98, 82, 66, 60, 91, -75, -82, -19, -82, 20, 59, -97, -10, 72, -75, -33}
+, {-97, 72, 11, -77, 68, -16, -17, 70, -78, -39, 45, 34, -41, 11, 54, -25}
+, {-61, -66, 45, 47, 0, 98, 68, -45, -22, 86, 55, -27, 119, 96, -54, 73}
+}
+, {{55, -19, -90, -37, -29, 20, -91, 40, 86, 35, -33, -75, -41, 7, -62, -66}
+, {-44, 24, -28, 95, -71, -18, 12, 3, 27, 81, -38, -74, 82, 59, -44, -30}
+, {-20, -22, 75, 43, 32, 83, 30, -27, -1, 19, 42, -76, -3, -48, 1, 68}
+, {-26, -6, 73, 12, 23, -52, 8, 1, -42, -12, -71, -15, -22, 33, 48, 19}
+, {-13, -24, -60, 12, 62, 29, 67, -24, -80, -72, 37, -51, -94, -76, 50, 4}
+, {82, -75, -3, -1, -28, 29, -24, -58, 18, 74, -6, 26, -58, -69, 43, 78}
+, {-70, -97, -31, 92, 23, 97, -48, -54, 59, -24, -75, -23, -47, 82, 36, -73}
+, {51, 72, 28, -32, 74, -45, -94, 37, -89, -93, 29, -46, 0, 47, -47, -54}
+, {-33, -64, -28, 5, -19, 0, -49, 38, 2, 78, -101, 55, 5, -11, -87, 59}
+, {102, -85, 15, -74, 76, -85, 60, -92, 48, 75, 91, 90, 82, -75, 38, -79}
+, {64, -9, -69, 54, 91, 37, -72, 106, 1, 103, -22, -20, -59, -58, -56, -8}
+, {-33, 50, 79, -71, 32, -46, -3, 76, 41, 37, -3, -92, 72, -11, -36, -70}
+, {41, 76, 43, -61, -28, -105, -46, 20, -12, 20, -20, 79, 32, 29, 52, -78}
+, {-20, 1, 14, 84, 90, -6, 0, -50, 89, 43, -72, -53, -1, 8, 52, -70}
+, {-67, -54, 24, 53, 30, -22, -75, 74, -32, 96, -34, -38, -3, 68, 72, 69}
+, {83, -87, -3, 54, -57, 1, -55, -74, -30, -63, 70, -68, -60, 70, -89, -51}
+, {8, -28, 64, 81, 25, -67, 26, 29, -83, 80, -49, -62, 71, -28, -69, -17}
+, {9, 6, -26, 35, -55, -97, 49, 15, 4, 10, -59, 68, 18, -9, 5, -29}
+, {-66, -57, -88, -74, -14, -64, -81, 67, 39, 84, 37, 74, -101, -89, 84, 20}
+, {-11, -25, 60, -18, 18, 53, -47, -42, -82, -77, 82, 69, 35, 26, -52, -17}
+, {-70, -72, -6, 2, 8, -76, -41, 79, 33, -64, -57, 36, 66, 59, -71, 27}
+, {-29, -9, -79, 32, 72, -95, -14, 50, -72, -101, -15, 38, 56, -86, 24, -32}
+, {31, 75, -77, -56, 62, 82, 90, -23, -67, 26, -96, 8, -67, 74, 65, -81}
+, {-69, 40, -66, -13, 65, 100, 38, 59, -26, 17, -13, 20, 63, -40, 47, -30}
+, {48, 54, 33, 58, -70, 34, 72, 16, 2, -45, 41, -86, 39, 29, -100, -47}
+, {37, -49, 58, 71, -50, -19, 78, -17, 72, 10, -62, 87, 51, 29, -4, -34}
+, {-91, 40, 58, 100, 66, -35, -34, 72, 100, 65, 63, -12, 22, 2, -21, -89}
+, {85, -36, -70, -46, 83, 86, -24, -30, 90, 62, -74, 81, -22, 20, 28, 15}
+, {5, 45, -69, 82, 40, -3, -43, -43, -44, 24, 13, 11, -79, 75, 90, 40}
+, {-18, -23, 90, -3, -47, 6, -4, -52, -6, 85, 95, -96, 32, 27, 89, 24}
+, {34, 9, -29, -6, 79, 45, -31, -88, 5, -51, 76, -8, 29, 40, -92, 7}
+, {-22, -53, 78, -50, 31, -42, 15, -70, -2, -9, 75, -21, -46, -36, -78, 10}
+, {-30, 97, -59, -69, 51, 85, 97, 4, 61, 26, 59, 77, -33, 1, -6, -52}
+, {-64, 96, 30, 31, -89, 16, 10, -17, 71, -80, 0, -51, 22, 42, -98, -30}
+, {-14, -28, -94, 24, -86, 40, -70, -83, 101, 7, -40, 4, -97, -85, 11, 54}
+, {33, -13, -66, 41, -59, -70, 16, -119, 44, -12, -59, 72, 45, -96, 47, -50}
+, {-93, -64, -80, -81, 58, 18, -23, 104, -25, 5, -46, -19, -6, -12, -13, 54}
+, {-117, 63, 20, 10, -55, 34, 62, 23, 53, 18, -21, 55, -54, -67, 35, 2}
+, {31, 77, -59, -49, -77, -88, -109, 94, 55, 7, -58, 63, 106, -97, 74, -21}
+, {52, -17, 55, -95, -3, 76, 44, -62, 2, 84, 55, 21, -47, -61, -98, -67}
+, {89, -74, -92, 82, -72, 31, 44, -69, 26, -59, 69, 9, 88, 7, -39, -58}
+, {-27, -10, -13, -5, 73, 32, 100, -82, 31, -53, -7, -92, -5, 70, 28, 16}
+, {-51, 75, 62, 37, 68, 61, -53, 99, -40, 57, 32, 80, 92, 83, -49, -66}
+, {-14, 76, -62, -56, 0, -52, 47, -90, -14, -7, 36, -54, -13, -2, 66, -77}
+, {-31, -70, -75, 60, 57, 43, 59, 53, 32, 37, -44, 16, 39, 49, 94, -56}
+, {2, -40, 41, 29, 55, 42, 12, -38, -52, -32, -90, -8, -11, -35, -44, 70}
+, {98, 82, 12, -56, -89, 21, 0, 38, -82, -77, -82, 84, 16, 5, -54, 75}
+, {92, 57, -33, 83, -73, -9, 58, -41, 73, -39, 2, -25, 75, -86, -51, 31}
+, {-65, -7, -40, -17, 45, 37, 60, 66, -79, -33, 19, -5, 75, -36, 70, 85}
+, {17, 75, -90, 109, -46, 32, -73, 0, 2, 55, -45, 29, -94, 20, -55, -91}
+, {-33, -3, 54, 113, 8, 15, -5, 44, 58, -45, 47, -44, -29, 83, 22, 49}
+, {-3, -97, -95, -36, -10, 45, 37, -36, -53, -73, -66, 17, -26, 40, 72, 33}
+, {93, -25, -51, -48, -105, 37, 66, 41, -40, -5, 2, 56, -72, 51, -21, -33}
+, {-24, -12, -32, -90, 89, 44, -60, -55, 17, 1, 12, -15, -71, 18, -50, -64}
+, {-62, -93, -74, 72, 0, -70, -77, -17, -74, 94, 37, -50, 77, -35, 32, 82}
+, {-20, 23, 0, -7, 87, -28, -59, 51, 77, 24, -12, 1, 34, -86, -56, 54}
+, {50, -87, 2, -44, -72, 70, 12, -34, 72, -10, 54, -92, 19, -10, 97, 17}
+, {-72, 34, 1, -56, -32, -73, -33, 55, -71, 31, -62, -62, 43, 67, -29, 64}
+, {-21, -47, -85, 90, -102, -52, -56, -2, 30, -65, -59, -4, 66, 6, 68, 42}
+, {80, -91, -97, -86, -18, 24, 64, -75, -58, -91, -111, -18, -12, -3, -2, 61}
+, {-6, 47, -39, 86, -56, 19, -5, 61, 11, 84, -97, 31, 32, 0, -11, -81}
+, {55, -95, 51, 23, 10, -57, 19, -51, 78, 69, 23, -70, -45, -62, 58, -42}
+, {-70, 15, 84, -63, 30, -22, -27, 55, 34, 2, -3, -18, 109, 2, -44, 5}
+, {-67, 31, -38, -16, 14, 66, -3, -39, -18, -76, 80, 64, 26, 9, 33, 65}
+}
+}
+;
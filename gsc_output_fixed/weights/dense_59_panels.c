@@ -0,0 +1,34 @@
+/**
+  ******************************************************************************
+  * @file    weights/dense_59_panels.c
+  * @version 1.0.0
+  * @date    17 october 2026
+  * @brief   Kernel of dense_59 packed in panels of 8 units for dense_gemm.h, generated by
+  *          tools/dense_panels.py
+  */
+
+#define DENSE_59_PANELS
+
+const int16_t dense_59_panels[1][20][16] = {{{-202, 178, 42, 169, -14, -153, 61, -24, 14, -54, -12, -72, 9, -160, 0, 0}
+, {-36, 48, 124, -162, -151, -2, -177, 123, -160, -106, -127, -7, -23, 149, 0, 0}
+, {46, 186, -84, -37, -174, 17, 170, 108, -48, -106, -106, -65, 127, -60, 0, 0}
+, {220, -1, 164, -31, 114, -3, -53, 36, -142, 26, -10, -8, -165, 194, 0, 0}
+, {187, -81, -179, -39, -106, 211, 195, -113, 75, 96, 201, -78, 129, -90, 0, 0}
+, {36, 42, 54, 154, -29, -49, -151, -26, 142, 87, -182, -130, -139, -6, 0, 0}
+, {-179, 132, -75, 31, 65, -153, 130, 5, 90, 159, -146, -110, 149, -181, 0, 0}
+, {-22, -18, 156, 0, -85, 144, -14, 129, 34, -154, 65, 96, -41, 146, 0, 0}
+, {-190, -127, -16, 205, -155, -96, -125, 169, 6, -117, 169, -108, -140, -40, 0, 0}
+, {-42, 37, 34, 156, 122, 153, -161, -96, -138, 86, -76, -176, 37, 123, 0, 0}
+, {-33, 73, 116, 93, -111, 74, -78, -112, 167, -102, 129, -6, 90, 2, 0, 0}
+, {114, 137, -142, 3, 141, -139, 153, -5, -157, -93, 96, 10, 36, 81, 0, 0}
+, {109, -86, -207, -108, -181, 21, -82, -166, -53, -16, -1, 95, 161, 80, 0, 0}
+, {-127, 112, 7, 45, 165, -159, -36, -113, -65, -153, 56, 124, 40, -84, 0, 0}
+, {-4, -16, -1, 98, -123, 39, -6, -192, 150, 17, 7, -33, 150, -134, 0, 0}
+, {-21, -155, 67, 98, 134, -37, -107, 61, 138, -83, 169, -173, -79, -14, 0, 0}
+, {133, -62, 187, 14, 52, 123, -128, 154, -130, -22, -124, -151, -65, 105, 0, 0}
+, {-187, -16, -51, -22, 31, -118, 45, -52, -80, 142, -95, -204, 127, 67, 0, 0}
+, {-199, -108, -107, -8, -129, 166, -172, 197, 113, -66, 12, -124, 160, -180, 0, 0}
+, {-61, -167, -129, -158, -6, 182, 44, -181, -67, -9, -168, 57, 145, 20, 0, 0}
+}
+}
+;
@@ -0,0 +1,11232 @@
+/**
+  ******************************************************************************
+  * @file    weights/formats.c
+  * @version 1.0.0
+  * @date    17 october 2026
+  * @brief   Weights and biases of the conv1d and dense layers in per-layer fixed-point formats,
+  *          generated by tools/fixed_point_formats.py from lab_gsc.h5 and 385 calibration
+  *          clips (headroom 2.0), used with -DCNN_LAYER_FORMATS
+  */
+
+#define CONV1D_116_FORMATS
+#define CONV1D_116_REQUANT_SHIFT 16 // input Q9, weights Q15, output and bias Q8
+
+const int16_t conv1d_116_bias[16] = {5, 5, -2, 9, 11, -1, -12, 7, 11, 3, -4, 0, 4, 3, -1, 0}
+;
+
+const int16_t conv1d_116_kernel[16][1][20] = {{{4868, 3239, 352, 4479, -702, 3217, -1899, -1904, 2246, 1787, -514, 4253, -1427, -1228, -473, -3786, -3888, 977, 447, 2138}}
+, {{-1096, -870, -3180, -3566, 1837, -1192, -1785, 1199, 4164, 260, -1438, -428, -2381, -1179, 2291, 4825, -1397, 3266, 2589, -3993}}
+, {{4483, 5698, 1018, -1818, 2472, 1335, -250, 1143, 1809, -3212, -1481, 2452, 2972, -4674, -4124, -3337, -1484, 1675, -523, -5244}}
+, {{-989, 1936, 2351, -338, 4659, -81, -2692, 3883, 1632, 4189, -3353, -3440, 553, 1433, -779, -4771, -2311, -1169, -2041, -2353}}
+, {{-4384, -2752, -1805, 1395, -2958, 2604, 2540, 2565, -4013, -621, 4408, 2789, 4003, 4284, 289, -473, 5518, 2019, 4267, -911}}
+, {{-4317, -4334, -4913, 2486, -2935, -193, -2752, -4356, 1192, 2033, -1698, -1786, -810, -1570, -3928, -1420, 4229, -3046, 3854, 2216}}
+, {{1981, 2493, -3730, 1290, -1218, 15, 4631, -1198, -133, 457, -77, 1196, 451, -1172, 322, 112, -1931, 4576, 198, -2918}}
+, {{606, -2275, 1452, 2613, -295, -5298, -3148, -5233, -2213, -2330, 4896, 4036, 2514, 4708, 4146, 1456, -1521, -3334, -4951, -2382}}
+, {{-3422, 4165, -1892, 5114, 4306, -990, -2491, 2850, -678, -3017, -3843, -266, -1088, -3817, 499, -1270, -5261, -2272, -2906, -3751}}
+, {{-1924, 3941, 3165, 2609, -3557, -3874, -340, -64, 214, 1254, 2446, 4069, 2332, 4736, 3749, 930, -4388, -611, -2813, 308}}
+, {{-1525, 1082, -828, 92, 3543, 4190, 4189, 279, 1450, -213, -361, -684, -2537, 3033, 4277, 2632, 3979, -1274, 1796, 565}}
+, {{-3518, -1520, -2178, 2835, -3346, -1594, 4421, -2276, -2761, 580, 2946, 2954, -2939, -3347, -2109, 757, -2071, 3967, -2482, 5195}}
+, {{3021, 965, -153, 954, 1968, 4274, -140, -1839, 2005, 2871, -2822, -221, 1478, -3139, -3807, 87, 3336, -1102, 3680, 2522}}
+, {{-2853, 3158, 1920, 1936, 932, 5408, 5127, 3161, 535, 2230, -788, 4957, 4407, -2533, 641, -1132, -266, 1946, -3716, 1127}}
+, {{3125, -614, 1928, 2467, 4658, 1552, -3217, 4327, -3030, 4923, 4142, 4080, 515, -307, -1091, 2524, 2466, -1985, -206, 967}}
+, {{-3349, 2457, -873, -2130, 4499, 2204, -898, 4574, 4402, 1372, 3093, 3303, 267, 2626, -2464, 4759, 2953, 3587, -354, -2046}}}
+;
+
+#define CONV1D_117_FORMATS
+#define CONV1D_117_REQUANT_SHIFT 13 // input Q8, weights Q13, output and bias Q8
+
+const int16_t conv1d_117_bias[32] = {4, 19, 0, 4, 7, -4, -3, -2, 10, 2, 0, 9, 12, -2, 5, -1, 2, -5, 9, 0, -9, 4, 18, 5, 10, 1, 8, 0, -11, 5, -6, -4}
+;
+
+const int16_t conv1d_117_kernel[32][16][3] = {{{117, 815, -1060}
+, {575, -1581, 814}
+, {-281, 175, -503}
+, {432, -399, -855}
+, {-158, -1639, 975}
+, {1760, 1270, -190}
+, {-384, -962, -1194}
+, {-692, 1472, 1066}
+, {762, 225, 817}
+, {-51, 529, -316}
+, {622, 1022, 1560}
+, {871, 471, 587}
+, {1426, -641, -895}
+, {-206, 222, 1087}
+, {-732, 1026, -703}
+, {-1435, -732, -611}}
+, {{-376, 1001, 103}
+, {1185, -205, -247}
+, {-798, -825, -995}
+, {1449, -1275, 4}
+, {1457, -1092, -726}
+, {1323, -763, 1941}
+, {-446, -891, -978}
+, {1268, -1108, -182}
+, {-585, 1735, -1421}
+, {355, -1490, 510}
+, {1223, -1049, -1594}
+, {311, 1049, 486}
+, {910, -1249, 1385}
+, {-1245, -651, -215}
+, {-370, 143, 380}
+, {-1326, -946, 997}}
+, {{1125, 283, 1298}
+, {1119, -997, 199}
+, {-357, -446, -1738}
+, {786, 1246, 12}
+, {1040, -399, 681}
+, {259, 71, 1332}
+, {4, -1596, 17}
+, {-837, 696, -1286}
+, {974, 1145, -1143}
+, {1129, -1205, -165}
+, {977, -1600, -541}
+, {16, 573, 465}
+, {1365, -1164, 665}
+, {-1843, 1671, -1656}
+, {-1589, 1174, 1123}
+, {188, 812, -1429}}
+, {{226, -965, -1511}
+, {181, -1580, 553}
+, {1693, -97, -98}
+, {790, -691, 397}
+, {-1186, -1265, -1339}
+, {467, 1645, 419}
+, {-785, 930, 674}
+, {-1019, 573, -191}
+, {1337, 447, -1365}
+, {-821, -1487, 370}
+, {-1078, -592, -678}
+, {-1109, 786, -1127}
+, {-965, 562, 543}
+, {-1418, -363, 1064}
+, {615, 1104, -301}
+, {-9, 1432, -912}}
+, {{315, -478, -1038}
+, {-1511, 1053, -44}
+, {-244, -1013, -1486}
+, {-472, 1010, 926}
+, {-925, 962, 192}
+, {-1344, -761, 1655}
+, {-1040, 389, -911}
+, {1790, -76, 1571}
+, {235, -612, -622}
+, {462, 738, 71}
+, {-468, 1152, 1236}
+, {692, 248, -821}
+, {-752, 1414, 1510}
+, {-924, 295, -981}
+, {1125, -616, 212}
+, {-1064, -563, -745}}
+, {{-955, 672, -1589}
+, {-995, 592, -1237}
+, {1173, -907, -1443}
+, {-536, 1543, -713}
+, {-1222, -88, 1719}
+, {1655, 802, -311}
+, {-285, 799, -934}
+, {-132, -1526, -1304}
+, {-490, 1340, -1253}
+, {-279, 1085, 698}
+, {172, -411, 1154}
+, {1022, -1185, -649}
+, {-338, 952, 360}
+, {1709, 554, -453}
+, {1625, -1328, 690}
+, {790, 1531, -592}}
+, {{-1452, -1145, 438}
+, {-1392, -159, -68}
+, {1250, 476, -424}
+, {-398, 329, 1013}
+, {-910, -1266, 181}
+, {1271, 50, -138}
+, {126, 1045, 1718}
+, {578, -1318, 851}
+, {263, 605, 1265}
+, {1728, 498, 817}
+, {-132, -1219, 304}
+, {1006, 1246, 712}
+, {-327, -1416, -424}
+, {-726, 159, 1712}
+, {-1239, -547, 118}
+, {-580, -1154, 440}}
+, {{1308, -488, 1758}
+, {1086, 2007, -1356}
+, {-305, -1367, 1521}
+, {1888, 1469, -1335}
+, {-238, -114, -1233}
+, {-1798, 761, -252}
+, {548, -475, 1265}
+, {35, 84, 167}
+, {1728, -1303, 365}
+, {129, -1576, -23}
+, {-1237, -854, 1508}
+, {-1921, -79, 233}
+, {343, 143, -1516}
+, {1048, 1661, 82}
+, {1632, 507, -55}
+, {362, 1469, -420}}
+, {{-1163, 180, -1847}
+, {864, -1166, 974}
+, {-359, 1268, -998}
+, {-1254, 1265, 952}
+, {1441, -625, -1574}
+, {-123, 478, -1227}
+, {976, -356, -1268}
+, {-252, 1484, -952}
+, {232, 1156, -1305}
+, {-1334, -491, 7}
+, {-1663, 1126, 413}
+, {-1361, -1605, -1014}
+, {1435, 1098, 518}
+, {-1201, -1443, -744}
+, {-1990, -361, 1065}
+, {-610, -336, -283}}
+, {{300, 16, -864}
+, {-312, -553, 498}
+, {443, 721, -487}
+, {903, 1300, -1363}
+, {-1792, 1223, -796}
+, {37, -1309, -509}
+, {-501, 6, -88}
+, {239, 1012, 41}
+, {169, -215, 922}
+, {1249, 1142, 1614}
+, {-1406, -882, -55}
+, {-848, 847, -671}
+, {-109, 9, -845}
+, {-878, 1015, 1439}
+, {-586, 1513, 487}
+, {816, -167, -772}}
+, {{946, -284, -556}
+, {286, 888, -93}
+, {-497, 848, -526}
+, {-1081, 1386, 457}
+, {668, 157, 298}
+, {17, -708, 771}
+, {-357, -798, -1391}
+, {1525, -12, 1180}
+, {194, 209, -204}
+, {455, -939, 1180}
+, {548, -1383, -1447}
+, {1704, 438, -560}
+, {-978, 1491, 1112}
+, {-587, -306, 1666}
+, {-246, -1093, -1020}
+, {1693, 520, 273}}
+, {{-346, -1135, 724}
+, {960, -314, 1556}
+, {85, -1223, -230}
+, {-135, 23, 793}
+, {919, 1705, -1389}
+, {1120, -197, -155}
+, {1200, 195, -1302}
+, {1282, -276, -1111}
+, {-641, 1659, 1302}
+, {1298, -1170, 491}
+, {-560, -253, 647}
+, {-1323, 432, -262}
+, {-1486, -553, 337}
+, {896, -1583, -993}
+, {-1067, 1227, 1445}
+, {-1463, 243, 1308}}
+, {{853, -1176, -825}
+, {1179, -255, 1603}
+, {-380, 1140, -1413}
+, {-1129, 56, -1612}
+, {529, -316, 1541}
+, {1657, -1662, 848}
+, {-273, 1147, -1321}
+, {-491, -50, 1566}
+, {795, 882, -686}
+, {-1084, 1541, -782}
+, {-976, 1049, -893}
+, {856, 756, -1178}
+, {-590, -587, -397}
+, {910, 271, 1141}
+, {-864, -1357, 577}
+, {677, -944, 1378}}
+, {{-1522, -577, -1594}
+, {1754, -1613, 380}
+, {-452, 901, -687}
+, {883, 962, 134}
+, {1001, -973, 1233}
+, {1485, -1616, -197}
+, {-872, -554, 896}
+, {1391, -491, -868}
+, {-1659, -1005, 274}
+, {-1233, 304, 1848}
+, {1752, 411, -401}
+, {1493, 1378, -484}
+, {-619, -1159, -1372}
+, {1562, -831, 1060}
+, {495, 872, 1139}
+, {368, -439, 1822}}
+, {{1483, 191, 1212}
+, {1224, -667, -1395}
+, {-940, -705, 1514}
+, {1635, -234, -1249}
+, {535, -191, -76}
+, {-444, -1431, 878}
+, {213, 388, -150}
+, {-845, -1572, 1012}
+, {414, -380, 955}
+, {-798, 1349, -247}
+, {-770, -52, 1281}
+, {-559, -1093, -387}
+, {856, -915, 28}
+, {1516, -1121, -1345}
+, {651, 374, 968}
+, {525, 937, -1379}}
+, {{1207, 759, -599}
+, {-455, 546, 1284}
+, {469, -626, -648}
+, {79, 1243, 567}
+, {1253, -579, -1517}
+, {-1314, 468, 930}
+, {581, -653, -1462}
+, {-983, 25, -1173}
+, {1275, -279, 100}
+, {-696, -1446, -1613}
+, {1332, 765, -145}
+, {282, -93, -862}
+, {-526, -358, 353}
+, {-1389, 341, 1075}
+, {-1224, 1112, 1595}
+, {-637, 1442, 1171}}
+, {{223, -758, 1135}
+, {848, -238, -613}
+, {-1104, 1401, 1002}
+, {497, 879, -1472}
+, {-776, 836, 1524}
+, {-427, -215, -472}
+, {-954, 648, 970}
+, {-1674, 1531, 369}
+, {1554, 244, 161}
+, {-1836, 1650, -1290}
+, {-431, -1432, 133}
+, {-1215, -1619, 553}
+, {-575, -302, -1072}
+, {563, 563, 1386}
+, {2, 638, -155}
+, {255, -644, 771}}
+, {{-1149, 608, 889}
+, {-1390, 976, -868}
+, {1673, -1324, 68}
+, {1574, 174, -1337}
+, {-1319, -1011, -1123}
+, {989, 1139, -1009}
+, {1356, -1532, -1367}
+, {875, 491, 1000}
+, {1091, 381, 108}
+, {783, 351, -867}
+, {153, -1417, 526}
+, {-1130, 1771, 804}
+, {1517, 1147, 1779}
+, {308, -799, 1107}
+, {-1343, -1162, -790}
+, {-551, -496, -537}}
+, {{1114, 621, 742}
+, {822, -284, 417}
+, {724, 974, 504}
+, {-527, 1207, 1679}
+, {-529, -364, -728}
+, {-388, -915, -1249}
+, {113, -928, -22}
+, {-1236, 1416, -520}
+, {-1096, -545, 1175}
+, {1292, 88, -1129}
+, {-638, -1210, -151}
+, {-1133, -1234, -138}
+, {1113, 1330, -174}
+, {1333, -647, 1729}
+, {19, 102, -1471}
+, {1035, -1370, 370}}
+, {{-789, -134, 1494}
+, {-1476, 1210, -1073}
+, {-1361, 1462, -1375}
+, {-807, -854, 1542}
+, {-854, 203, -151}
+, {-1254, 1559, 1457}
+, {-217, 43, -845}
+, {-939, -936, 149}
+, {-919, 527, -1878}
+, {110, -1526, 388}
+, {-199, -116, 1097}
+, {1178, -389, 1150}
+, {-1420, -1131, -1198}
+, {-851, -217, -246}
+, {-120, 1117, -157}
+, {891, 60, 584}}
+, {{-544, 978, 26}
+, {1388, 1369, -1527}
+, {666, 645, -579}
+, {-615, -792, -625}
+, {163, 1136, -690}
+, {-295, 1504, 1133}
+, {1041, 1017, -1206}
+, {-1201, 582, -1728}
+, {226, 1347, -1434}
+, {1503, -500, -1314}
+, {382, -1507, 1635}
+, {-698, 935, -225}
+, {-1251, -1691, 1156}
+, {914, -1197, 1573}
+, {1467, 643, 1004}
+, {-81, 323, -1099}}
+, {{1309, -1641, 1781}
+, {-611, 1232, 1028}
+, {378, -1359, 1181}
+, {-538, -1202, 1582}
+, {-1699, -384, -1487}
+, {-559, 1704, -950}
+, {-1336, 9, -494}
+, {-1048, -512, 990}
+, {-1001, -536, 1779}
+, {-939, -809, 735}
+, {-17, -1286, 1073}
+, {-869, 1971, -40}
+, {259, -118, 1162}
+, {1237, -987, 1742}
+, {56, 867, 927}
+, {879, 1461, 556}}
+, {{1158, 547, -876}
+, {-401, 719, 422}
+, {-588, 746, 1252}
+, {1266, -115, -827}
+, {-1345, -584, 1612}
+, {-268, -547, 685}
+, {-1136, -1144, 247}
+, {-1264, 1097, 160}
+, {1085, 662, 966}
+, {-1072, 569, 1094}
+, {-642, 1160, -1076}
+, {1124, 1774, -1305}
+, {517, -1355, 666}
+, {545, 731, -1194}
+, {-1373, 460, -639}
+, {-960, 26, -848}}
+, {{-58, -829, 1134}
+, {1304, -1188, -1136}
+, {-721, -1562, -1162}
+, {225, -501, 1380}
+, {718, -1194, -1079}
+, {303, 1548, 1552}
+, {1470, -726, -465}
+, {1526, 678, 1704}
+, {693, -838, 1438}
+, {444, -62, -1238}
+, {749, -1801, -404}
+, {-553, -770, -716}
+, {-557, 1149, -1412}
+, {1570, 1170, 115}
+, {863, -94, -1472}
+, {-204, -459, -817}}
+, {{-868, 1007, -1391}
+, {-393, 257, 496}
+, {539, -1249, 330}
+, {-1171, -1368, 780}
+, {192, 527, 546}
+, {994, 606, 1534}
+, {-1680, -576, -1519}
+, {1290, 53, 1421}
+, {301, 617, -1298}
+, {-1115, -1020, 1579}
+, {18, -975, 332}
+, {-281, -634, -1237}
+, {-1609, -346, 1701}
+, {-1107, 1063, -1413}
+, {-280, 1418, -864}
+, {-1066, -1083, 549}}
+, {{-872, -1377, 554}
+, {-933, -1232, -958}
+, {-41, -1541, 816}
+, {1425, 1582, -1176}
+, {489, 342, 259}
+, {408, -1483, -265}
+, {-268, -1685, 1590}
+, {790, 1541, 1794}
+, {186, -527, 1093}
+, {968, 90, 1009}
+, {133, 83, 763}
+, {705, -965, -53}
+, {-1197, -1295, -1490}
+, {33, -1404, -712}
+, {816, 572, -837}
+, {-1151, 1174, 291}}
+, {{-1310, 1668, -1332}
+, {-998, -1202, -672}
+, {-335, -633, 2006}
+, {-1121, -1365, 976}
+, {1245, 1254, 517}
+, {-370, 1488, -869}
+, {1508, -1011, -1213}
+, {-5, -312, 484}
+, {1266, 559, 147}
+, {-1316, 675, 579}
+, {-396, 1964, -1098}
+, {1420, 572, 471}
+, {-1103, -342, -260}
+, {782, 207, -798}
+, {-47, 1040, -733}
+, {-1573, -636, -590}}
+, {{-1268, 661, -532}
+, {-347, -1664, 187}
+, {-357, 698, 1072}
+, {-39, -550, -189}
+, {-861, -123, -469}
+, {-1079, 1205, 1258}
+, {-283, -337, -34}
+, {1653, 1422, -245}
+, {-1119, -1504, 309}
+, {1659, 988, -1095}
+, {1601, 1109, -1397}
+, {-1282, -1134, 836}
+, {-1209, 175, 494}
+, {1679, 1613, -1530}
+, {-793, 936, -107}
+, {-1192, 537, -1306}}
+, {{1049, -1029, -896}
+, {625, -1605, 1172}
+, {975, 1104, -230}
+, {-1245, -786, -808}
+, {-1704, 680, 149}
+, {1084, 552, 264}
+, {-85, -1078, -38}
+, {382, -1602, 1095}
+, {-1068, 801, 1348}
+, {377, -74, 323}
+, {786, 1212, 221}
+, {-1746, -1375, 280}
+, {166, -823, -1773}
+, {1122, -396, 746}
+, {1102, 1468, 168}
+, {1443, 1684, -68}}
+, {{-222, -1453, 1255}
+, {1591, -1489, 602}
+, {-709, 685, -1356}
+, {265, -900, 519}
+, {1394, -1333, 427}
+, {958, 628, -691}
+, {1309, -332, 909}
+, {33, -561, -1391}
+, {-527, 1444, 942}
+, {1077, 792, 710}
+, {-1131, -420, 154}
+, {-1187, 336, 1089}
+, {441, 595, -1130}
+, {653, -746, 944}
+, {1363, -256, 1955}
+, {1184, 205, 1922}}
+, {{-626, 1526, -363}
+, {355, 226, 418}
+, {673, 666, 1577}
+, {1373, 1517, 1443}
+, {758, -1528, 324}
+, {1818, 864, 1232}
+, {167, -899, -784}
+, {450, -423, -782}
+, {1236, 34, 417}
+, {-995, 950, 1237}
+, {1140, -1480, 641}
+, {-931, 1519, 1707}
+, {-537, -1444, 791}
+, {-1657, 107, 446}
+, {835, -530, -633}
+, {-1322, -1452, 176}}
+, {{438, 497, -255}
+, {-1157, -48, -755}
+, {1569, -391, -569}
+, {105, -955, 1347}
+, {-751, -1036, -381}
+, {565, -224, 1158}
+, {-19, -1313, -1176}
+, {-691, 1450, -185}
+, {1439, 327, -830}
+, {1498, -197, 1534}
+, {188, -151, -977}
+, {-422, -802, -434}
+, {-602, -1454, -1319}
+, {-853, 678, -1272}
+, {1340, -475, -1388}
+, {1682, 726, -1481}}}
+;
+
+#define CONV1D_118_FORMATS
+#define CONV1D_118_REQUANT_SHIFT 12 // input Q8, weights Q12, output and bias Q8
+
+const int16_t conv1d_118_bias[64] = {4, 6, 8, -2, 6, 5, 0, -3, 5, -7, 5, 3, -1, 11, 10, 5, 4, 6, -1, 8, -1, -3, -10, -2, 8, 11, 11, -2, 7, 0, 9, 8, 3, 6, -5, 7, -2, -1, 0, 12, 2, 0, -9, 4, 6, -5, 0, 18, 12, 3, 0, 7, 0, 1, 2, 13, 2, 7, 8, -9, -4, -6, -8, 5}
+;
+
+const int16_t conv1d_118_kernel[64][32][3] = {{{156, -446, -335}
+, {517, 548, 623}
+, {-500, -10, -63}
+, {164, 328, -36}
+, {-410, 689, 325}
+, {397, 288, -435}
+, {-663, 477, -421}
+, {-529, 378, -39}
+, {297, -541, 391}
+, {102, -332, -15}
+, {551, 11, -281}
+, {-573, 249, 225}
+, {323, -302, 397}
+, {-485, 462, 418}
+, {-121, 355, 369}
+, {487, 506, 149}
+, {482, -258, -595}
+, {-391, 606, 467}
+, {-463, -168, -30}
+, {477, -77, 331}
+, {-190, -33, -524}
+, {291, 383, -407}
+, {215, -353, -208}
+, {-201, -522, 581}
+, {-598, 564, 475}
+, {-388, 89, -517}
+, {267, -508, -78}
+, {422, -508, 313}
+, {179, -153, -330}
+, {226, -310, -423}
+, {459, 74, 377}
+, {501, -502, 571}}
+, {{293, 155, 350}
+, {577, 343, 474}
+, {66, -160, 473}
+, {-325, -493, -261}
+, {66, -103, 119}
+, {-586, -345, -492}
+, {375, -258, -474}
+, {148, -171, 154}
+, {160, 108, 516}
+, {-176, -363, 502}
+, {527, 92, 129}
+, {563, 78, 361}
+, {417, -148, -202}
+, {438, 256, -514}
+, {292, 229, -251}
+, {25, 536, 557}
+, {-557, 434, -524}
+, {-159, 545, -618}
+, {-372, -151, 161}
+, {61, -119, 154}
+, {95, -177, -283}
+, {-312, -69, 276}
+, {-33, 40, 465}
+, {495, -443, -350}
+, {527, 36, 369}
+, {597, 601, -267}
+, {472, -375, 425}
+, {-320, -585, -24}
+, {-241, -185, -571}
+, {464, 101, 488}
+, {325, 559, 104}
+, {500, -601, -294}}
+, {{329, 418, 535}
+, {-35, -66, 334}
+, {-172, 617, -211}
+, {500, 314, -732}
+, {119, -188, -421}
+, {28, 431, -226}
+, {-177, -52, 431}
+, {257, 244, -350}
+, {176, -24, 565}
+, {77, -403, -76}
+, {-257, -318, 308}
+, {-426, -12, 64}
+, {462, -197, 354}
+, {-386, 354, 33}
+, {-291, 100, 149}
+, {192, -504, -293}
+, {-249, 54, -417}
+, {421, 98, -454}
+, {-406, -398, 243}
+, {202, -382, 1}
+, {-325, -16, -209}
+, {160, -314, 161}
+, {83, -306, 323}
+, {222, -39, -501}
+, {345, 58, 424}
+, {-368, -363, 268}
+, {579, 268, 133}
+, {578, 489, -386}
+, {517, -36, -412}
+, {-199, -581, 524}
+, {12, -186, -28}
+, {-197, -165, -423}}
+, {{-15, 531, -54}
+, {217, 186, 249}
+, {520, -257, -551}
+, {-320, 402, -498}
+, {-105, -184, 315}
+, {85, 335, 104}
+, {240, 470, 363}
+, {-623, -596, 23}
+, {65, -487, 21}
+, {132, -251, -112}
+, {378, 502, 237}
+, {574, -139, -34}
+, {370, -441, 53}
+, {260, 184, -373}
+, {61, 351, -246}
+, {-585, -554, 377}
+, {124, 269, 420}
+, {-327, -167, 3}
+, {-540, -607, 494}
+, {324, -245, -313}
+, {542, 372, -77}
+, {-643, -367, -200}
+, {219, 323, -377}
+, {-291, -398, -341}
+, {-272, 322, 298}
+, {-458, -452, 568}
+, {188, 225, -551}
+, {-381, 62, 4}
+, {301, -520, 455}
+, {194, -278, 500}
+, {-158, 546, -206}
+, {-19, -467, -441}}
+, {{20, 353, -103}
+, {-473, -160, 188}
+, {135, 462, -355}
+, {-597, -448, -386}
+, {464, 347, 270}
+, {510, -251, -275}
+, {-187, 175, 52}
+, {348, 69, 77}
+, {299, -416, 260}
+, {242, 46, 41}
+, {424, 404, -39}
+, {107, -7, 218}
+, {105, 371, 218}
+, {313, -77, -405}
+, {4, 364, -346}
+, {-322, -619, 330}
+, {-65, -4, -473}
+, {-337, -365, -638}
+, {-365, 180, 148}
+, {504, -597, -134}
+, {513, -44, -132}
+, {-475, 422, 293}
+, {-557, -473, -510}
+, {438, -562, -464}
+, {260, 69, -608}
+, {-557, -447, -313}
+, {466, -98, -25}
+, {-245, -18, 29}
+, {-144, -303, 119}
+, {643, 603, 324}
+, {158, -536, 517}
+, {-291, -319, -68}}
+, {{-493, 489, -200}
+, {60, -326, -503}
+, {-293, -155, -247}
+, {-202, 104, 194}
+, {-524, -281, 383}
+, {-364, 155, 460}
+, {203, 58, -279}
+, {-539, -193, -572}
+, {-508, 566, 250}
+, {465, 92, 626}
+, {-409, -495, 450}
+, {269, 238, 7}
+, {595, 0, -274}
+, {-36, 119, 389}
+, {66, -457, 422}
+, {-110, 427, 115}
+, {-414, 229, -145}
+, {-178, -500, -241}
+, {-169, -125, 39}
+, {-328, 616, 616}
+, {-9, 532, 138}
+, {-173, 486, -116}
+, {-130, -370, 498}
+, {320, 276, -302}
+, {632, 194, -152}
+, {-254, 248, 184}
+, {124, 520, 220}
+, {-374, 498, 382}
+, {594, -409, 461}
+, {-555, -36, -16}
+, {91, 32, 556}
+, {12, -319, 118}}
+, {{-278, -550, -516}
+, {306, 236, 246}
+, {565, 549, 597}
+, {237, 399, -190}
+, {-355, 394, -240}
+, {-290, 363, -569}
+, {392, -203, -570}
+, {-189, -450, 267}
+, {145, -422, -588}
+, {231, -122, -33}
+, {512, -72, -217}
+, {494, 531, 461}
+, {-521, 158, 335}
+, {-320, -39, 495}
+, {-587, 224, -316}
+, {-79, -280, 507}
+, {498, -191, 464}
+, {180, -379, 116}
+, {-125, 89, -317}
+, {197, -154, 213}
+, {-413, -381, -232}
+, {-544, 272, -524}
+, {-290, 153, -500}
+, {407, -27, 140}
+, {-553, -349, 555}
+, {-381, 125, -469}
+, {514, 520, 475}
+, {-514, 121, -163}
+, {400, -187, -1}
+, {573, -313, -13}
+, {16, 171, -383}
+, {358, -10, -226}}
+, {{181, -389, -435}
+, {-205, 399, 382}
+, {397, -243, 432}
+, {-64, 229, 402}
+, {-167, 42, -490}
+, {185, -100, -486}
+, {16, 220, -508}
+, {601, 123, 432}
+, {362, 160, -16}
+, {167, -89, -289}
+, {496, 308, -173}
+, {555, -413, -557}
+, {-385, 84, -268}
+, {316, 192, -178}
+, {-29, -246, -174}
+, {278, 269, 187}
+, {191, 313, 18}
+, {410, -404, -424}
+, {-228, -636, 657}
+, {523, -342, -239}
+, {-377, -455, -33}
+, {414, -268, 323}
+, {-365, 539, -499}
+, {566, -526, -437}
+, {-513, -534, -497}
+, {151, -598, -319}
+, {-240, 68, 341}
+, {229, -636, 371}
+, {174, 211, 16}
+, {594, -150, 283}
+, {-198, 166, 558}
+, {-109, -3, -292}}
+, {{-36, 67, -511}
+, {504, 654, -564}
+, {554, -555, 330}
+, {-351, 459, 686}
+, {-310, 128, -333}
+, {-405, -426, -556}
+, {-606, -336, -572}
+, {-346, 308, 254}
+, {227, -213, 579}
+, {6, -521, -261}
+, {133, 421, -159}
+, {352, 127, 101}
+, {-457, 484, -450}
+, {34, -234, -67}
+, {302, 306, 483}
+, {533, -336, -174}
+, {-295, 74, 165}
+, {350, 15, -279}
+, {102, 255, 591}
+, {-290, -192, 438}
+, {-65, -142, 424}
+, {-514, -78, 224}
+, {46, -70, -235}
+, {-200, 378, 29}
+, {-270, -561, 15}
+, {-581, -569, 312}
+, {-79, 19, 325}
+, {524, 440, -286}
+, {-426, -585, 274}
+, {458, 332, 168}
+, {-185, 106, -94}
+, {327, -182, 102}}
+, {{544, -56, -136}
+, {-648, -556, -96}
+, {-218, 358, -403}
+, {-431, -217, -59}
+, {203, -228, 401}
+, {-495, -381, 541}
+, {466, 405, 352}
+, {452, 276, -12}
+, {-381, -75, 210}
+, {-339, 652, -460}
+, {-27, -101, -185}
+, {-98, -490, -78}
+, {-399, -68, 603}
+, {563, -70, -398}
+, {-380, -496, -474}
+, {-333, -353, -263}
+, {-347, -35, -344}
+, {141, -220, 128}
+, {120, -60, -563}
+, {-679, 643, -19}
+, {-243, -565, -81}
+, {-71, 241, -230}
+, {149, 106, 167}
+, {603, 112, 365}
+, {-91, -311, 228}
+, {477, 417, -161}
+, {-61, -437, -208}
+, {281, -112, -177}
+, {-326, 215, 348}
+, {-216, 414, -32}
+, {301, 220, -314}
+, {126, -484, -470}}
+, {{-39, -169, -41}
+, {-82, 633, 583}
+, {558, -480, -258}
+, {51, -166, -235}
+, {223, 671, -44}
+, {222, -388, -524}
+, {-246, -10, -428}
+, {105, -621, -399}
+, {-431, -709, 252}
+, {208, -383, 138}
+, {-273, 268, -32}
+, {-557, -295, -425}
+, {254, -194, 247}
+, {122, 121, -283}
+, {-652, -472, 324}
+, {305, 449, -606}
+, {-210, -554, -512}
+, {250, 304, 90}
+, {448, 409, -345}
+, {317, 437, 506}
+, {291, 251, 490}
+, {399, -570, -540}
+, {-128, 50, 193}
+, {338, 155, 549}
+, {-272, -261, -123}
+, {319, -224, 663}
+, {701, 132, -123}
+, {-511, 665, -385}
+, {329, 318, 35}
+, {193, -181, -534}
+, {37, 213, 602}
+, {-443, 454, -238}}
+, {{-232, 24, -307}
+, {-542, 0, 68}
+, {461, -200, 283}
+, {32, -318, -75}
+, {45, -236, 635}
+, {-572, 326, -76}
+, {350, -356, 187}
+, {-114, 134, -294}
+, {-366, 107, 288}
+, {203, 3, -272}
+, {604, -17, 416}
+, {-557, -226, 334}
+, {549, 152, -456}
+, {-492, -412, 411}
+, {-467, 15, 229}
+, {499, -47, -541}
+, {385, 336, 290}
+, {607, 238, 573}
+, {-376, -492, -212}
+, {-480, -407, 374}
+, {170, -399, -388}
+, {-253, -103, 55}
+, {-191, -492, 358}
+, {167, 198, 161}
+, {340, -534, -104}
+, {53, 240, 258}
+, {-131, 276, 571}
+, {313, 129, 230}
+, {-371, 173, 70}
+, {595, -141, 118}
+, {-293, -406, 318}
+, {-217, -418, -57}}
+, {{-437, 280, -36}
+, {-517, -19, 277}
+, {533, 60, -68}
+, {-428, -2, -133}
+, {293, -416, 43}
+, {-483, 37, -443}
+, {106, 535, 115}
+, {9, 417, -136}
+, {-254, 110, 403}
+, {-402, -431, 86}
+, {207, -153, -166}
+, {-231, 62, -302}
+, {-556, -456, 432}
+, {-489, -293, -437}
+, {-351, 252, -536}
+, {-511, -84, 199}
+, {351, 317, 256}
+, {474, -284, -339}
+, {-535, -22, -596}
+, {-562, -517, 313}
+, {-512, -259, 2}
+, {359, -217, 427}
+, {-125, 214, -467}
+, {89, -304, -486}
+, {567, -356, 468}
+, {445, -6, -94}
+, {-331, -228, -531}
+, {-388, -49, 221}
+, {23, -136, -378}
+, {-406, -350, 13}
+, {-312, -423, -170}
+, {-577, 531, 201}}
+, {{75, 356, 254}
+, {289, 238, -226}
+, {-417, -459, 495}
+, {-416, 174, -270}
+, {474, -112, 30}
+, {-477, -503, -303}
+, {428, 340, 112}
+, {-361, -228, 559}
+, {265, 366, -178}
+, {279, -213, -105}
+, {-110, 266, 159}
+, {-197, 414, -325}
+, {-279, 291, -337}
+, {519, -355, -440}
+, {186, 309, -192}
+, {-323, -256, 262}
+, {353, 303, 621}
+, {-55, -108, 328}
+, {465, 308, 336}
+, {-474, -343, -581}
+, {67, -232, -436}
+, {-84, -380, 128}
+, {193, 186, 114}
+, {264, 14, -6}
+, {163, -540, -284}
+, {-474, 40, -31}
+, {376, -201, -364}
+, {-537, -444, -302}
+, {114, 179, 151}
+, {448, -496, 314}
+, {-209, -386, -469}
+, {293, -368, -496}}
+, {{-447, -427, -598}
+, {-288, 393, -608}
+, {-215, -505, -279}
+, {478, 365, -615}
+, {527, 300, 95}
+, {-169, -403, 366}
+, {510, -254, 540}
+, {260, -605, 458}
+, {500, 194, -300}
+, {-180, -530, -27}
+, {-7, 595, 532}
+, {-433, 312, 518}
+, {-209, -278, -619}
+, {-47, -389, 455}
+, {112, 55, 596}
+, {-22, 420, 18}
+, {500, 236, 134}
+, {-603, -192, -163}
+, {383, 367, 637}
+, {257, 110, 510}
+, {-460, -474, 385}
+, {-541, -42, 439}
+, {638, -258, -295}
+, {519, -42, -234}
+, {-80, -489, 340}
+, {549, 455, -308}
+, {183, 463, 147}
+, {-207, 61, -249}
+, {-67, -577, 6}
+, {-219, -211, -4}
+, {155, -302, -31}
+, {86, 2, -524}}
+, {{40, -311, 69}
+, {-147, -75, 403}
+, {594, -153, 202}
+, {-428, -70, 580}
+, {233, 46, -485}
+, {-103, -586, 94}
+, {421, -75, -48}
+, {174, -176, -295}
+, {564, -49, 390}
+, {569, -236, -355}
+, {-398, 286, -583}
+, {513, 212, 222}
+, {-230, 190, -388}
+, {527, 108, 13}
+, {-26, 423, 120}
+, {-62, -121, -390}
+, {-439, -449, 214}
+, {-564, 384, 62}
+, {399, 237, 24}
+, {-57, 247, 434}
+, {318, -341, 143}
+, {-535, 257, 535}
+, {33, 419, 249}
+, {-217, 273, 447}
+, {134, 230, 534}
+, {401, -254, 51}
+, {-502, -199, 406}
+, {-502, 295, -142}
+, {-56, 386, 171}
+, {-264, 530, 62}
+, {-35, 64, -584}
+, {-660, 9, -196}}
+, {{152, 298, -447}
+, {362, 270, -432}
+, {-317, 126, -33}
+, {38, -280, 186}
+, {-289, -325, -680}
+, {-168, -385, 490}
+, {28, 519, 599}
+, {327, -642, 97}
+, {-384, 531, -241}
+, {-184, 470, -530}
+, {-411, 380, 216}
+, {-444, -46, 421}
+, {-375, 537, -14}
+, {300, 476, 18}
+, {231, -128, -309}
+, {387, 421, -385}
+, {-340, -308, -286}
+, {388, -190, -440}
+, {-57, 133, 589}
+, {-122, 364, 325}
+, {362, -40, -352}
+, {191, -647, 424}
+, {-419, -486, 258}
+, {-334, -141, 203}
+, {393, -346, -532}
+, {317, 139, -98}
+, {-400, 576, 217}
+, {582, 111, -431}
+, {193, -424, 8}
+, {129, 350, 443}
+, {121, -524, -225}
+, {274, -418, 61}}
+, {{-218, -11, -207}
+, {-201, 555, -103}
+, {-122, 594, -514}
+, {512, -353, 71}
+, {13, -228, 312}
+, {135, -357, 152}
+, {379, -194, -290}
+, {683, 586, -485}
+, {-270, 359, 222}
+, {600, -234, -512}
+, {-337, -400, 375}
+, {-45, -107, -427}
+, {-187, 719, -34}
+, {504, -153, -293}
+, {682, -298, -533}
+, {-168, 33, 508}
+, {-564, 208, 222}
+, {66, 608, -366}
+, {-46, 150, -21}
+, {112, -694, -214}
+, {-43, 136, -448}
+, {-155, -346, -502}
+, {81, 595, 223}
+, {-93, -26, 136}
+, {378, 178, 263}
+, {127, 390, -393}
+, {-48, -190, -11}
+, {-83, 308, 123}
+, {357, 8, -485}
+, {-104, -304, 582}
+, {-180, -131, -109}
+, {26, 7, -528}}
+, {{-258, 302, 331}
+, {-131, -472, -388}
+, {293, -105, -531}
+, {145, -631, -231}
+, {-7, -81, 423}
+, {12, 270, -275}
+, {257, 353, -309}
+, {362, -311, -237}
+, {-517, 303, -9}
+, {540, 104, -22}
+, {481, 437, 593}
+, {-466, -566, 286}
+, {178, 172, -169}
+, {77, -340, 20}
+, {378, 419, 446}
+, {110, 99, 388}
+, {-151, -31, -83}
+, {-52, -185, 587}
+, {213, 74, -449}
+, {-278, 291, -376}
+, {-311, -35, -497}
+, {-11, 563, 366}
+, {485, 476, 74}
+, {435, -87, -70}
+, {-283, -379, -380}
+, {-538, 502, -98}
+, {-489, -341, 42}
+, {-163, 543, 455}
+, {530, -406, 441}
+, {-99, -20, 335}
+, {-92, -85, -484}
+, {101, 139, -294}}
+, {{-126, 309, -113}
+, {-182, 173, -147}
+, {-392, 30, -260}
+, {198, -216, 590}
+, {435, 564, -177}
+, {-146, 237, 112}
+, {-141, 626, -199}
+, {87, 164, -408}
+, {-173, 452, -423}
+, {104, -268, -358}
+, {-548, 340, 665}
+, {221, 202, -256}
+, {347, -229, 95}
+, {-325, 536, 435}
+, {119, -229, -199}
+, {198, 232, -375}
+, {26, 280, -500}
+, {648, -464, -137}
+, {478, 340, -442}
+, {404, 100, 11}
+, {-529, -166, -392}
+, {211, -268, 140}
+, {-230, 192, -55}
+, {549, 124, -300}
+, {422, 394, 575}
+, {-237, -389, 268}
+, {433, -394, -194}
+, {208, -369, 342}
+, {186, 133, 415}
+, {339, -170, 385}
+, {-447, -16, -105}
+, {-175, -319, 176}}
+, {{-157, 147, 70}
+, {376, -314, -270}
+, {181, -286, 39}
+, {560, 200, 234}
+, {-344, -455, -192}
+, {-212, 288, -600}
+, {165, 13, 328}
+, {651, 483, 64}
+, {-290, -328, -69}
+, {377, -303, 521}
+, {-449, 8, -210}
+, {-460, 276, 100}
+, {-482, 359, -227}
+, {-507, 274, -424}
+, {481, 359, 87}
+, {-292, 346, -289}
+, {368, -280, -389}
+, {238, 533, 472}
+, {248, 280, 240}
+, {1, 376, -47}
+, {-267, -403, 338}
+, {-136, 412, -322}
+, {320, 2, -16}
+, {-91, 180, 148}
+, {-235, -60, -328}
+, {264, -460, 378}
+, {364, 430, 472}
+, {-166, 86, -253}
+, {-422, 488, 548}
+, {-516, 32, -430}
+, {314, 279, 365}
+, {-147, 395, 471}}
+, {{-454, -294, -301}
+, {-521, 364, 444}
+, {-498, -66, 488}
+, {-345, -328, 162}
+, {403, -444, 317}
+, {-191, 397, 316}
+, {88, -517, -502}
+, {225, -511, -224}
+, {-124, -171, -760}
+, {190, -254, 68}
+, {-179, -111, 229}
+, {-310, 147, 462}
+, {544, 133, -115}
+, {-416, 159, -290}
+, {-308, 11, -441}
+, {574, 340, -371}
+, {27, 166, 38}
+, {130, -528, -303}
+, {-510, -400, -607}
+, {415, 297, -54}
+, {149, 513, 335}
+, {-101, -319, -406}
+, {-408, -189, -201}
+, {-215, 216, -605}
+, {-213, 341, -107}
+, {412, -223, 95}
+, {400, 545, 555}
+, {18, 441, -322}
+, {295, -246, 433}
+, {-551, -441, 104}
+, {595, 533, -590}
+, {-487, 241, 205}}
+, {{523, 552, -533}
+, {-123, 329, 307}
+, {50, 470, -287}
+, {-246, 84, -433}
+, {-182, -350, 211}
+, {-527, 492, -196}
+, {222, -551, 395}
+, {225, 463, 518}
+, {102, -152, 420}
+, {-327, -634, -633}
+, {218, 553, 306}
+, {-250, -640, 346}
+, {434, 100, -501}
+, {324, 463, -341}
+, {-563, -453, 180}
+, {73, -346, -282}
+, {439, 4, -592}
+, {-439, -258, 7}
+, {-292, 501, -348}
+, {452, 237, -432}
+, {178, -271, 208}
+, {-51, 429, 478}
+, {233, 261, 481}
+, {241, -297, -212}
+, {536, -597, -15}
+, {52, -576, -263}
+, {-533, -497, -526}
+, {-41, -527, 321}
+, {452, 537, 553}
+, {427, -163, 415}
+, {357, 373, -279}
+, {278, 201, -186}}
+, {{-369, 558, 361}
+, {223, -401, -476}
+, {-366, -369, -215}
+, {-213, 40, -117}
+, {600, 656, 309}
+, {-85, 285, -134}
+, {490, -404, -398}
+, {17, -344, -448}
+, {-98, 225, 425}
+, {82, 624, -187}
+, {439, 71, -284}
+, {15, -225, 3}
+, {254, 38, -403}
+, {359, 154, -277}
+, {-177, -49, -27}
+, {-558, -604, -21}
+, {-139, -401, -286}
+, {373, 453, 169}
+, {15, -56, 405}
+, {-117, -579, 137}
+, {-441, 291, 333}
+, {-8, -122, -434}
+, {-378, 213, 77}
+, {-96, 3, 142}
+, {51, 514, -460}
+, {-292, 273, 214}
+, {445, -500, -10}
+, {502, 286, 617}
+, {-518, -168, -172}
+, {-519, 287, -113}
+, {224, -263, 550}
+, {-64, -40, 368}}
+, {{574, -192, -137}
+, {-98, 630, 352}
+, {-208, -193, -498}
+, {-291, 81, -383}
+, {-289, 286, 550}
+, {320, 210, -269}
+, {59, -362, -97}
+, {-345, -105, -61}
+, {349, 5, -4}
+, {-279, -495, 219}
+, {339, -217, 229}
+, {-326, -431, 486}
+, {480, -357, -393}
+, {277, -39, 652}
+, {-600, -152, -441}
+, {-322, 25, 302}
+, {-549, -579, -83}
+, {144, 510, 194}
+, {-49, -152, 369}
+, {227, 41, -331}
+, {370, -511, 444}
+, {-67, -133, -93}
+, {-545, 215, -718}
+, {97, 463, -174}
+, {-70, -21, 185}
+, {-20, 331, 30}
+, {475, 245, -449}
+, {192, 423, 319}
+, {190, 16, 15}
+, {92, 94, 97}
+, {92, -406, 607}
+, {365, -561, 339}}
+, {{-12, -13, 4}
+, {33, 604, 485}
+, {598, 231, 500}
+, {45, -58, -478}
+, {381, -83, -63}
+, {-138, -38, -139}
+, {-440, -2, -362}
+, {-261, -698, 541}
+, {-518, 533, -495}
+, {346, 17, -344}
+, {-338, -279, 373}
+, {-39, -479, 591}
+, {404, 699, -148}
+, {-8, 429, -174}
+, {-215, -526, -513}
+, {443, -132, 10}
+, {238, -112, 395}
+, {-425, -381, -294}
+, {-455, -243, 179}
+, {311, 61, 751}
+, {-450, -287, -37}
+, {89, -186, 510}
+, {695, -97, -368}
+, {158, 152, 205}
+, {-268, 483, 576}
+, {31, -198, -534}
+, {-26, 420, 484}
+, {239, 87, 13}
+, {-226, 527, -199}
+, {-627, 397, 115}
+, {539, -398, 290}
+, {-412, -151, -576}}
+, {{502, 486, -489}
+, {-62, 303, 213}
+, {-433, -376, 121}
+, {-373, 564, -321}
+, {181, 38, -407}
+, {63, -352, -51}
+, {436, 546, 471}
+, {484, 530, -211}
+, {434, 194, 359}
+, {122, -466, 290}
+, {71, -485, 75}
+, {136, 439, 274}
+, {-325, 433, -12}
+, {-269, -37, 54}
+, {-191, -215, -331}
+, {-534, -543, -261}
+, {-191, 26, -220}
+, {626, -29, -419}
+, {217, -130, 251}
+, {647, 269, 139}
+, {304, 128, -220}
+, {-116, 369, 107}
+, {102, 457, 720}
+, {669, -274, -474}
+, {401, 38, -397}
+, {379, -393, 273}
+, {655, -323, 541}
+, {-281, 32, 115}
+, {-439, -628, -98}
+, {-374, 25, -533}
+, {487, 469, -484}
+, {-9, -560, -113}}
+, {{-197, -530, -255}
+, {556, 588, -91}
+, {-20, 327, -616}
+, {-182, -191, 404}
+, {-214, -29, 262}
+, {304, -206, -20}
+, {236, 178, 574}
+, {-338, -358, 376}
+, {-633, -199, -699}
+, {249, 32, -480}
+, {-304, 148, 469}
+, {-259, 321, 431}
+, {110, -273, 215}
+, {86, 156, 36}
+, {312, -358, -569}
+, {-120, 324, 515}
+, {-193, -63, -14}
+, {355, 453, 174}
+, {-487, -526, -224}
+, {155, -101, 137}
+, {-399, -357, 602}
+, {10, 346, 475}
+, {291, -307, 370}
+, {-86, 338, 177}
+, {-494, -427, 10}
+, {378, 510, 463}
+, {35, 152, 631}
+, {-12, 181, -248}
+, {411, -297, 58}
+, {259, -96, -574}
+, {499, -33, 567}
+, {263, 172, 229}}
+, {{431, -383, -266}
+, {-59, -343, 145}
+, {455, 138, 192}
+, {25, 91, -487}
+, {-494, -4, -399}
+, {-361, -189, -316}
+, {-101, 343, -329}
+, {-365, -673, 76}
+, {-368, 19, 293}
+, {2, -375, -249}
+, {-384, -457, -535}
+, {427, -172, 373}
+, {421, -238, 44}
+, {-661, -28, -525}
+, {260, -115, 96}
+, {-52, -344, -122}
+, {362, 191, -415}
+, {508, -134, 41}
+, {51, -326, 138}
+, {-469, 335, 43}
+, {-391, -272, -383}
+, {-249, 250, 330}
+, {641, 67, 345}
+, {253, 451, 387}
+, {-90, 84, -371}
+, {-95, -194, 238}
+, {647, 124, 606}
+, {568, -323, -508}
+, {4, 103, 265}
+, {250, 28, 497}
+, {51, -42, 446}
+, {-202, -298, 470}}
+, {{-37, 19, -268}
+, {536, 51, -390}
+, {-220, -24, 215}
+, {524, -202, 56}
+, {404, 239, 141}
+, {447, -475, 227}
+, {-345, 377, 159}
+, {8, -407, 579}
+, {583, 615, 279}
+, {-35, 368, -73}
+, {-409, -445, 292}
+, {-341, 511, 460}
+, {480, 401, 140}
+, {-522, -215, -551}
+, {-413, 439, 261}
+, {-292, -393, -489}
+, {-464, 294, -286}
+, {588, -497, -200}
+, {-587, -196, 150}
+, {71, 362, -514}
+, {-378, 464, 239}
+, {-644, -219, -346}
+, {64, 358, -507}
+, {134, 316, 402}
+, {288, 91, 148}
+, {577, 453, -366}
+, {-583, 572, 292}
+, {-184, -310, -606}
+, {-133, -280, -196}
+, {377, 498, -471}
+, {312, 215, 87}
+, {-432, 309, 431}}
+, {{-176, 251, 67}
+, {-38, -79, -41}
+, {-426, 173, -73}
+, {-308, 641, -129}
+, {-24, -276, -485}
+, {85, 74, 152}
+, {-469, -98, 331}
+, {-205, -182, -174}
+, {-5, -74, -339}
+, {174, 53, 251}
+, {477, 21, 469}
+, {558, 280, 198}
+, {-9, 330, -379}
+, {-471, -205, -43}
+, {-405, 127, 218}
+, {-306, -498, -41}
+, {-382, 302, 629}
+, {104, -348, -458}
+, {589, 309, 556}
+, {-541, -112, -60}
+, {-293, -267, -622}
+, {42, 51, -351}
+, {436, -300, -185}
+, {28, -506, 310}
+, {0, -194, -474}
+, {351, -460, 240}
+, {247, -640, -263}
+, {-643, 481, 84}
+, {-287, 406, 376}
+, {611, -295, -181}
+, {475, 403, -418}
+, {100, -347, -621}}
+, {{-60, -395, -301}
+, {277, -115, -440}
+, {429, -34, 176}
+, {700, -386, -104}
+, {119, 450, -257}
+, {122, 361, 197}
+, {-250, -489, 264}
+, {-440, -288, 162}
+, {522, 428, 162}
+, {-352, -347, -2}
+, {-533, 199, -297}
+, {310, 456, -534}
+, {-499, 258, 295}
+, {-185, 603, -299}
+, {-368, 208, -448}
+, {-267, 8, 393}
+, {-335, 425, 43}
+, {672, -180, 102}
+, {298, 70, 494}
+, {-208, -486, -358}
+, {-261, 522, -372}
+, {309, 276, 35}
+, {588, 391, -174}
+, {-226, -452, -20}
+, {-442, 120, -82}
+, {-200, 56, -404}
+, {-324, -337, 532}
+, {690, 457, 71}
+, {241, -33, 181}
+, {90, -487, 530}
+, {-183, -66, -567}
+, {-26, -178, -411}}
+, {{-61, -389, 317}
+, {160, 318, 88}
+, {-359, -191, -16}
+, {-91, 35, 434}
+, {-379, -32, 249}
+, {-344, -296, 633}
+, {452, -404, 361}
+, {287, -258, -145}
+, {297, 211, -670}
+, {34, 154, 671}
+, {-546, 258, 318}
+, {493, -174, -304}
+, {-275, 358, -577}
+, {-383, -374, -469}
+, {565, 378, 203}
+, {605, 518, 471}
+, {-212, 535, 346}
+, {-125, 4, -232}
+, {-594, 444, -373}
+, {-64, 463, -444}
+, {390, -249, 85}
+, {283, 195, 607}
+, {139, -342, 685}
+, {433, -334, -307}
+, {-548, -487, 419}
+, {598, -214, 90}
+, {487, -5, 67}
+, {-284, 238, 686}
+, {-231, -72, 629}
+, {253, 381, 25}
+, {-196, -502, -569}
+, {470, -300, -530}}
+, {{-122, 444, 53}
+, {-232, -39, 367}
+, {44, 171, 354}
+, {531, 7, -44}
+, {-550, -509, 319}
+, {32, -463, 499}
+, {-244, -287, 42}
+, {-530, -131, 350}
+, {-412, -257, 348}
+, {12, -416, -95}
+, {-504, 420, -339}
+, {409, 568, 332}
+, {255, 482, 39}
+, {-129, -561, -270}
+, {-495, -176, 433}
+, {-85, -471, -1}
+, {-487, -86, -29}
+, {38, 46, -336}
+, {481, 502, -592}
+, {-479, -257, -262}
+, {-261, 24, 328}
+, {629, 121, 53}
+, {-103, 155, 475}
+, {635, 325, -371}
+, {193, 346, -371}
+, {454, -282, 353}
+, {521, 284, 335}
+, {480, 38, -512}
+, {-508, -581, 61}
+, {90, -166, 144}
+, {-392, 467, 501}
+, {-290, -282, -16}}
+, {{308, 324, -121}
+, {-250, -557, -556}
+, {-27, -180, -443}
+, {488, 487, -29}
+, {521, 425, 472}
+, {312, -502, 345}
+, {-400, 424, -402}
+, {-102, 331, 275}
+, {403, -304, 299}
+, {354, -143, 200}
+, {303, 148, 93}
+, {-539, -483, -186}
+, {-433, 601, -462}
+, {493, 22, 453}
+, {-244, -320, -216}
+, {-190, -268, -450}
+, {-254, -246, -67}
+, {568, 707, -201}
+, {497, 157, 89}
+, {393, 104, 340}
+, {-250, -8, 319}
+, {-230, 338, -77}
+, {-203, -319, -395}
+, {-531, 509, -99}
+, {434, 86, 444}
+, {45, 478, 614}
+, {-12, -29, -519}
+, {32, -351, 87}
+, {-471, 209, -49}
+, {-3, -532, -157}
+, {58, -131, -71}
+, {-50, 127, 510}}
+, {{-134, -551, 183}
+, {-69, 485, 392}
+, {248, -262, 466}
+, {-368, -476, 545}
+, {55, 92, 541}
+, {-73, -560, 120}
+, {86, -314, -127}
+, {317, 131, 560}
+, {581, 77, 701}
+, {-495, 419, 209}
+, {-268, -52, -91}
+, {630, -187, -575}
+, {-176, 253, 203}
+, {-381, -535, 210}
+, {99, 175, -143}
+, {-185, 586, 434}
+, {-202, 419, -185}
+, {-311, -481, 153}
+, {412, -146, -136}
+, {420, 189, 146}
+, {-489, -291, -173}
+, {399, 163, -107}
+, {-280, 566, -1}
+, {358, -199, 79}
+, {-616, -475, 601}
+, {436, 515, -383}
+, {-106, -585, -554}
+, {506, -448, -287}
+, {-168, 307, -199}
+, {403, -165, -239}
+, {-388, -63, -1}
+, {466, -139, 265}}
+, {{-364, -80, -459}
+, {209, 332, -379}
+, {116, 635, 496}
+, {-219, -141, 489}
+, {-364, 581, 526}
+, {215, 468, -495}
+, {-20, 428, -525}
+, {377, 228, 481}
+, {38, -54, -118}
+, {-141, 606, -264}
+, {-487, 471, 240}
+, {-142, 243, 287}
+, {246, 168, 521}
+, {414, 126, -34}
+, {292, -492, 164}
+, {-663, -203, 390}
+, {12, 580, 567}
+, {-77, -443, -525}
+, {-345, 362, 509}
+, {205, -400, -124}
+, {-521, -372, 297}
+, {117, 274, -475}
+, {-337, 399, -249}
+, {-158, -298, 480}
+, {-131, -133, -89}
+, {274, -314, -444}
+, {-547, -361, -291}
+, {515, 121, -490}
+, {-61, 200, -410}
+, {-74, -422, 250}
+, {179, -375, -360}
+, {-633, 346, 266}}
+, {{455, 235, 195}
+, {214, 446, -494}
+, {-117, -307, -201}
+, {-145, 208, 393}
+, {381, -503, 414}
+, {-69, -252, 366}
+, {-262, 324, -528}
+, {315, -513, 395}
+, {52, -291, -410}
+, {319, 302, 456}
+, {-163, -125, 271}
+, {-11, 257, 480}
+, {88, -427, 440}
+, {-420, -22, 204}
+, {510, 637, 139}
+, {564, 484, -237}
+, {299, -557, -170}
+, {-506, 295, -669}
+, {-445, 554, 519}
+, {-117, -6, 394}
+, {443, -521, -440}
+, {-169, 0, 325}
+, {403, -285, -83}
+, {-560, 372, -165}
+, {401, 101, 535}
+, {551, -511, -441}
+, {193, -274, 96}
+, {146, 403, 503}
+, {67, 591, -496}
+, {-193, 84, -558}
+, {421, -408, 12}
+, {550, -278, 345}}
+, {{70, -165, 550}
+, {213, 252, -47}
+, {-372, -128, -508}
+, {-68, -536, 294}
+, {98, 725, -187}
+, {297, 357, -528}
+, {-505, 262, -183}
+, {-528, -479, 248}
+, {-453, -626, 383}
+, {-186, 72, 160}
+, {388, -404, 532}
+, {-521, 235, -96}
+, {89, 391, -77}
+, {371, 549, 0}
+, {-181, -658, 429}
+, {48, -224, -162}
+, {-528, -539, 272}
+, {130, 549, 48}
+, {-532, -334, -209}
+, {166, 504, -501}
+, {-90, -263, -339}
+, {210, -591, -158}
+, {-473, 251, -343}
+, {94, 429, 180}
+, {200, -19, -55}
+, {-20, 624, 270}
+, {-350, 242, -88}
+, {412, 216, 86}
+, {275, -267, 482}
+, {144, -390, -155}
+, {431, -18, -77}
+, {390, 498, -169}}
+, {{-360, 302, 78}
+, {-583, 375, 152}
+, {-235, 38, 543}
+, {417, 307, 32}
+, {-173, 618, 366}
+, {325, 103, 119}
+, {-305, -279, -274}
+, {91, 302, -518}
+, {-508, 282, -376}
+, {123, 393, 353}
+, {567, -226, -486}
+, {-258, -408, 459}
+, {-71, -543, 282}
+, {-552, -515, 288}
+, {145, 408, 123}
+, {-280, -485, 116}
+, {-431, 633, 506}
+, {170, -371, -526}
+, {571, 531, 245}
+, {151, 347, 245}
+, {-175, 32, 440}
+, {572, 80, -160}
+, {-632, 313, 592}
+, {-167, -187, 397}
+, {-479, 282, 244}
+, {-39, 8, 492}
+, {473, 142, -79}
+, {-437, -410, -400}
+, {-536, 500, 404}
+, {-147, -427, -48}
+, {-252, -24, -318}
+, {256, 386, -525}}
+, {{-21, -308, 452}
+, {-397, -323, -598}
+, {-420, -484, 532}
+, {393, -9, -373}
+, {-102, 515, -34}
+, {-352, 263, -250}
+, {56, 356, -501}
+, {-301, 160, 554}
+, {-383, 224, -574}
+, {-91, 76, -180}
+, {6, -568, -654}
+, {-342, 143, 384}
+, {-490, -185, -376}
+, {199, 284, 100}
+, {-452, 395, -86}
+, {-47, -131, -256}
+, {-420, 304, 282}
+, {558, -111, 142}
+, {518, -287, 55}
+, {-283, -95, 225}
+, {-546, 300, 528}
+, {83, 116, -221}
+, {-207, -343, -477}
+, {347, 512, -433}
+, {-7, 109, 56}
+, {-284, -62, -371}
+, {-492, 376, -302}
+, {249, -95, -162}
+, {275, -114, 462}
+, {567, 528, -560}
+, {393, 311, -498}
+, {-359, -11, 418}}
+, {{-60, 95, 444}
+, {248, -174, 73}
+, {102, 278, 58}
+, {-500, -437, 564}
+, {159, -264, 15}
+, {574, 199, 342}
+, {-504, 596, -100}
+, {-151, 212, 419}
+, {152, 365, -71}
+, {-372, 247, -242}
+, {-376, -447, 34}
+, {-147, 327, 469}
+, {556, 485, 149}
+, {-227, -547, -99}
+, {370, -397, -503}
+, {-409, -157, -233}
+, {231, 397, 431}
+, {24, -367, -520}
+, {-334, 275, -139}
+, {-110, -320, 208}
+, {645, -336, 462}
+, {425, 404, -140}
+, {-228, 500, -321}
+, {-114, -356, 7}
+, {211, -613, -79}
+, {-533, -74, -254}
+, {-408, 458, 18}
+, {-239, -286, -218}
+, {432, -282, 428}
+, {-58, 204, 250}
+, {-494, -111, -528}
+, {327, -155, -312}}
+, {{-265, -144, -332}
+, {-396, -523, -571}
+, {106, 528, 473}
+, {243, 15, -162}
+, {-32, -48, 93}
+, {-213, -361, 363}
+, {109, 77, -224}
+, {269, 460, 409}
+, {367, 373, 73}
+, {-83, 560, 209}
+, {-118, -98, -575}
+, {-293, 254, -345}
+, {-498, 321, 71}
+, {444, 304, -464}
+, {635, -112, -156}
+, {346, 447, 345}
+, {577, -219, 236}
+, {-285, -44, 299}
+, {184, -400, 562}
+, {-282, 231, 164}
+, {-526, 485, 383}
+, {345, 478, 236}
+, {-446, -11, 253}
+, {190, -195, 365}
+, {-281, -577, -637}
+, {-93, -306, -290}
+, {-188, 31, 68}
+, {304, 168, -421}
+, {-456, 613, 162}
+, {103, 56, 237}
+, {-76, 540, 135}
+, {581, -199, 568}}
+, {{466, 345, 386}
+, {505, 233, -191}
+, {-562, 108, 136}
+, {-155, -240, -189}
+, {209, -2, 58}
+, {292, 355, -612}
+, {-305, 498, -289}
+, {9, -345, -303}
+, {-76, 188, -528}
+, {-401, -140, 314}
+, {-551, 542, -349}
+, {114, 398, 507}
+, {245, -454, -1}
+, {161, 6, 278}
+, {373, 97, 131}
+, {360, 547, -541}
+, {-367, 261, 228}
+, {596, -561, 258}
+, {354, -411, 245}
+, {-332, -639, -265}
+, {272, 238, 128}
+, {-159, -485, 196}
+, {449, -555, -307}
+, {402, -33, -490}
+, {408, -495, -79}
+, {395, -441, -206}
+, {-242, 215, -100}
+, {545, 244, -380}
+, {454, -528, -522}
+, {-591, 400, 65}
+, {267, -298, 59}
+, {-263, 396, 41}}
+, {{164, -346, -263}
+, {-381, -399, 453}
+, {-568, 579, 564}
+, {-73, -145, -524}
+, {416, -115, -44}
+, {-147, -62, 515}
+, {146, -212, 473}
+, {601, 401, -358}
+, {-241, -344, -492}
+, {528, 9, 599}
+, {81, 484, 263}
+, {418, -512, -202}
+, {7, -122, 685}
+, {-267, -208, -461}
+, {592, 387, 474}
+, {-150, -219, -258}
+, {-38, -289, 346}
+, {505, -393, -426}
+, {-19, 532, -541}
+, {207, -632, -178}
+, {139, -371, -427}
+, {617, -323, -163}
+, {-491, 379, 597}
+, {-226, -253, 454}
+, {-364, -83, -77}
+, {243, 213, -335}
+, {-471, 478, 138}
+, {46, -76, 101}
+, {-584, 489, -550}
+, {-365, 212, 67}
+, {-486, 95, 89}
+, {407, 370, -36}}
+, {{-367, 401, 146}
+, {-662, -62, 212}
+, {-401, 81, -99}
+, {-151, -338, 20}
+, {-515, -442, 72}
+, {96, 57, -494}
+, {-637, 389, 318}
+, {337, -174, 446}
+, {519, 265, -169}
+, {345, -374, 74}
+, {-36, -55, 184}
+, {266, 525, -277}
+, {-96, 676, -192}
+, {-536, 440, -299}
+, {162, -312, 441}
+, {129, -141, 574}
+, {601, 69, 167}
+, {320, -32, 290}
+, {407, -419, -267}
+, {-549, 276, 441}
+, {-194, 238, 535}
+, {-476, 414, -49}
+, {422, -58, 104}
+, {188, -291, -496}
+, {304, 690, 372}
+, {-571, -484, -240}
+, {304, -338, 263}
+, {50, 28, 127}
+, {-59, 42, 594}
+, {-414, 312, 334}
+, {-571, -325, 112}
+, {528, 602, 337}}
+, {{248, 426, -297}
+, {-158, -481, 5}
+, {295, 360, 519}
+, {-4, -94, -25}
+, {385, 182, -565}
+, {430, 244, 392}
+, {3, -330, 16}
+, {-573, -314, -522}
+, {-476, 118, 445}
+, {-412, 521, -509}
+, {207, -437, 498}
+, {-449, -522, -148}
+, {-388, 111, 190}
+, {310, 383, 178}
+, {330, 308, -612}
+, {-134, -514, 179}
+, {27, 527, 502}
+, {99, 187, -40}
+, {-98, -30, -194}
+, {-150, -257, -347}
+, {-484, -71, 356}
+, {-333, 292, -35}
+, {-389, -489, 321}
+, {-587, 137, -340}
+, {-495, -245, 64}
+, {-219, 440, 13}
+, {300, 88, 434}
+, {-80, -306, -36}
+, {536, -284, 125}
+, {499, 40, 393}
+, {-57, -150, -537}
+, {264, 185, -414}}
+, {{421, 478, 320}
+, {-200, 402, 99}
+, {-35, 420, -28}
+, {-128, 211, 810}
+, {-458, -170, 497}
+, {-99, 189, 238}
+, {343, 528, 370}
+, {508, -363, -168}
+, {539, 533, -325}
+, {249, 40, -446}
+, {129, 542, -534}
+, {-286, 82, -136}
+, {290, 122, -286}
+, {-233, -167, -559}
+, {-449, 33, -296}
+, {-71, 299, -402}
+, {210, -525, 464}
+, {-548, -146, 55}
+, {-479, 357, -324}
+, {203, 232, 552}
+, {177, -473, -174}
+, {-186, -336, 90}
+, {-216, 425, 369}
+, {-449, 306, 338}
+, {398, 25, -375}
+, {-139, -66, 16}
+, {308, 150, 2}
+, {-367, 643, -174}
+, {-214, 253, -627}
+, {118, 30, 62}
+, {-556, 42, -103}
+, {561, -480, 525}}
+, {{-222, -21, 283}
+, {500, -548, 530}
+, {-227, 278, 365}
+, {-283, 372, -193}
+, {30, 45, 484}
+, {-270, -117, 304}
+, {-253, -285, -512}
+, {-69, -311, 477}
+, {-333, 187, -58}
+, {295, -244, -106}
+, {-465, 161, 9}
+, {-491, -78, 128}
+, {151, -214, 162}
+, {335, 164, -459}
+, {-264, -98, 52}
+, {-502, -481, 479}
+, {212, 313, -490}
+, {70, -326, 494}
+, {420, -337, 391}
+, {-12, 345, 275}
+, {71, 227, -151}
+, {582, -451, 426}
+, {-110, 330, 232}
+, {-325, 186, 457}
+, {-599, -150, 172}
+, {223, -453, -36}
+, {-346, -30, -503}
+, {-634, 449, 47}
+, {-141, -29, 34}
+, {318, -90, -274}
+, {-39, -351, -119}
+, {219, -62, 327}}
+, {{390, -106, -545}
+, {299, 530, -265}
+, {-141, 18, 228}
+, {-532, -447, -247}
+, {-496, 152, -498}
+, {611, 555, -135}
+, {207, -416, 183}
+, {458, 418, 298}
+, {274, -7, 242}
+, {-210, -173, -354}
+, {136, -156, -498}
+, {286, 348, 349}
+, {-89, -486, 381}
+, {54, 97, 258}
+, {50, -330, -221}
+, {395, -369, 236}
+, {167, -422, 209}
+, {-527, 63, 84}
+, {-275, -494, 432}
+, {-477, 479, -156}
+, {303, -375, 550}
+, {345, 202, -326}
+, {77, 329, -463}
+, {-219, 274, 331}
+, {-422, -214, 202}
+, {519, -198, 131}
+, {303, 98, -68}
+, {-210, 347, -484}
+, {-493, 535, 316}
+, {-396, -564, 153}
+, {-338, -526, -257}
+, {523, -33, 328}}
+, {{55, -351, 404}
+, {122, 6, -274}
+, {-254, -230, -555}
+, {-233, 575, 362}
+, {427, -526, -74}
+, {563, 410, 19}
+, {-551, -400, -264}
+, {527, -477, -232}
+, {316, 7, 276}
+, {395, 142, 191}
+, {291, 426, 379}
+, {-166, -68, 443}
+, {535, -611, 553}
+, {87, -67, -552}
+, {-106, 152, 48}
+, {551, 9, -390}
+, {-101, -77, 212}
+, {-496, 504, -432}
+, {-358, 15, 546}
+, {349, 435, 233}
+, {482, -385, 170}
+, {31, -529, -364}
+, {507, 261, -237}
+, {-43, -93, 107}
+, {-369, 208, 196}
+, {-125, -625, -195}
+, {378, -550, -411}
+, {-425, -639, -98}
+, {484, 494, 154}
+, {-321, -65, 169}
+, {-89, 5, 507}
+, {366, 87, -77}}
+, {{496, 116, 308}
+, {-310, 322, -577}
+, {-331, -427, -611}
+, {-324, -212, -358}
+, {361, -461, 305}
+, {-338, 255, 409}
+, {-130, -9, 438}
+, {296, -171, 550}
+, {575, -315, -696}
+, {543, -234, -574}
+, {-553, 581, -564}
+, {-27, -288, 370}
+, {431, 47, -614}
+, {-239, -188, -575}
+, {-381, -221, 391}
+, {-307, 150, -502}
+, {534, -154, 411}
+, {241, 332, 322}
+, {-420, -471, 209}
+, {485, 375, 311}
+, {-474, -360, 92}
+, {135, 221, -141}
+, {750, -693, 461}
+, {-232, -292, -26}
+, {629, 145, -410}
+, {-529, -161, 410}
+, {675, -453, 522}
+, {663, -499, 6}
+, {372, 302, 249}
+, {-233, 142, 225}
+, {59, -47, -362}
+, {184, -576, 605}}
+, {{391, -578, 44}
+, {124, -280, 225}
+, {-296, -75, 400}
+, {436, -222, 397}
+, {-594, -364, 397}
+, {-335, 360, -522}
+, {-107, -486, -40}
+, {0, -411, 552}
+, {255, -532, -337}
+, {103, 549, -246}
+, {-594, -269, -254}
+, {-294, 351, -317}
+, {-353, 482, -135}
+, {215, 476, -472}
+, {230, -233, -221}
+, {236, -616, 122}
+, {41, -106, 504}
+, {-393, 458, 273}
+, {189, 60, 110}
+, {405, -361, 396}
+, {246, 13, 520}
+, {-438, 243, -33}
+, {-497, 550, 33}
+, {563, 92, 528}
+, {198, -82, 77}
+, {-250, -557, 372}
+, {318, 103, -165}
+, {-488, 16, 80}
+, {-255, -155, 478}
+, {102, 264, 572}
+, {-40, 154, 428}
+, {-83, -507, -130}}
+, {{593, 637, 416}
+, {481, -274, -12}
+, {514, -156, -365}
+, {-576, -592, -407}
+, {261, 536, 119}
+, {603, 55, -228}
+, {113, -139, -211}
+, {307, -383, 189}
+, {-390, 565, -205}
+, {-250, -567, -477}
+, {411, 230, 152}
+, {-462, 429, -120}
+, {228, -406, 438}
+, {391, 717, 648}
+, {-566, 338, 12}
+, {-275, -319, 398}
+, {-472, 171, -622}
+, {108, 289, -364}
+, {476, 228, -204}
+, {-413, 241, 288}
+, {-504, 244, 397}
+, {-671, -470, -258}
+, {384, -276, -435}
+, {-562, -226, 521}
+, {-247, -364, 623}
+, {-422, 123, -416}
+, {-440, -73, -489}
+, {203, -550, 14}
+, {-250, -106, 230}
+, {-275, -55, -358}
+, {-115, 457, 622}
+, {317, -68, -209}}
+, {{60, 33, -138}
+, {317, -405, 729}
+, {-192, 491, 304}
+, {70, -291, 341}
+, {-303, -184, 345}
+, {-93, 451, -247}
+, {-467, -512, 440}
+, {670, -374, 143}
+, {-125, -353, 574}
+, {-21, 370, 346}
+, {97, 478, 570}
+, {626, -404, 226}
+, {35, -313, 236}
+, {227, -197, -55}
+, {258, -394, -143}
+, {453, 532, -41}
+, {380, 391, 220}
+, {-250, 209, 333}
+, {644, 584, 19}
+, {-745, -219, 63}
+, {-604, -295, -565}
+, {-140, -154, -627}
+, {-490, 419, -154}
+, {628, -531, -425}
+, {597, 39, 664}
+, {-228, 88, 587}
+, {-210, -589, -402}
+, {-227, 288, -588}
+, {-431, 44, -334}
+, {435, 366, 259}
+, {-369, -376, -397}
+, {618, -254, 208}}
+, {{-430, 580, 399}
+, {-243, -540, 399}
+, {-483, -493, 476}
+, {689, -505, -32}
+, {428, 494, 467}
+, {-555, -259, -71}
+, {-429, -240, -335}
+, {275, -123, 105}
+, {-128, 338, 396}
+, {-460, 482, 14}
+, {315, -257, 415}
+, {256, -581, -649}
+, {268, 117, 280}
+, {-40, -113, 612}
+, {-270, 330, 14}
+, {-393, 599, 613}
+, {-103, 350, 501}
+, {398, -389, 160}
+, {-425, -627, -104}
+, {379, -599, 18}
+, {-112, 566, -276}
+, {-507, -362, 9}
+, {629, -32, -426}
+, {-467, -448, -363}
+, {315, -172, -522}
+, {301, 39, -514}
+, {-388, 419, 50}
+, {-388, -409, -59}
+, {-251, -147, 64}
+, {-156, 542, 283}
+, {594, 134, -230}
+, {-472, 341, -67}}
+, {{-402, 402, 204}
+, {-446, 297, -239}
+, {-92, -238, 136}
+, {178, -297, -6}
+, {-192, -345, 218}
+, {446, 170, 604}
+, {72, -560, 335}
+, {380, -249, -493}
+, {-555, -270, -421}
+, {-282, 606, 509}
+, {520, -114, 501}
+, {302, 247, 15}
+, {-202, -361, 372}
+, {247, 287, 540}
+, {463, -638, 115}
+, {260, 163, -368}
+, {-366, 166, -310}
+, {635, 272, -162}
+, {-613, 400, 324}
+, {-162, -171, 87}
+, {-551, -326, 273}
+, {132, 300, 256}
+, {291, 14, -429}
+, {-1, 104, 502}
+, {102, -198, 280}
+, {23, -219, 459}
+, {343, -155, 85}
+, {220, 484, 664}
+, {69, 560, 446}
+, {-485, 125, 312}
+, {516, -19, -509}
+, {-309, -492, 358}}
+, {{-142, -229, -555}
+, {-244, 460, 500}
+, {-5, 227, -238}
+, {701, -82, -318}
+, {245, -345, 265}
+, {109, 300, 230}
+, {-358, 168, 29}
+, {145, -487, -191}
+, {418, 481, -596}
+, {-20, 406, -151}
+, {-582, 268, 477}
+, {-195, -405, 437}
+, {123, -176, -418}
+, {365, 358, 9}
+, {84, -92, -546}
+, {468, -383, 175}
+, {216, 607, -425}
+, {539, 278, -181}
+, {317, -570, 447}
+, {252, 249, 238}
+, {692, -337, 304}
+, {500, -476, 306}
+, {104, 229, -181}
+, {-234, 501, 569}
+, {-277, 398, -525}
+, {-380, -529, -31}
+, {-378, -137, -217}
+, {623, 500, -382}
+, {35, -90, -331}
+, {-490, 290, 343}
+, {-588, -453, -218}
+, {-99, -695, 444}}
+, {{-9, -565, 104}
+, {-442, -210, -488}
+, {-547, -299, 297}
+, {-615, -628, -74}
+, {-213, -24, 182}
+, {35, 517, 169}
+, {-496, -187, -7}
+, {638, 590, 476}
+, {-188, -405, -268}
+, {-293, -52, -31}
+, {523, 548, -440}
+, {67, 185, 565}
+, {404, -537, -602}
+, {-19, 60, -33}
+, {348, -191, -147}
+, {-307, 385, -205}
+, {-470, -308, -47}
+, {48, -606, 104}
+, {413, 527, 533}
+, {499, 519, 274}
+, {73, 431, -275}
+, {281, 460, -132}
+, {-723, -207, 20}
+, {235, -595, 205}
+, {451, -503, 19}
+, {-309, 510, -525}
+, {30, -219, 317}
+, {142, 154, 576}
+, {-432, 287, -247}
+, {87, -20, -41}
+, {-385, -550, -570}
+, {410, -385, 289}}
+, {{-351, -214, 377}
+, {-508, 586, -429}
+, {210, 136, -342}
+, {-596, 527, 89}
+, {-433, 331, 546}
+, {-77, 514, -558}
+, {-482, 223, -96}
+, {-27, 123, 460}
+, {-52, -229, 636}
+, {-337, -270, -292}
+, {-400, 52, 549}
+, {128, -527, 230}
+, {-471, -149, -88}
+, {-335, 507, -457}
+, {347, -187, 544}
+, {-195, 514, -529}
+, {198, 409, 120}
+, {388, 416, 205}
+, {105, -194, -209}
+, {-373, -47, 280}
+, {606, 111, 15}
+, {-296, -261, -215}
+, {112, -336, -566}
+, {414, 343, 228}
+, {-18, -431, -127}
+, {-343, 496, 197}
+, {200, 269, 218}
+, {459, -289, -545}
+, {375, 224, 473}
+, {-44, 210, -210}
+, {554, -199, 413}
+, {99, -227, -141}}
+, {{-145, -305, 61}
+, {518, -112, -428}
+, {435, -470, 171}
+, {356, -556, 564}
+, {269, 48, 189}
+, {-426, 344, -232}
+, {-136, 548, 609}
+, {467, -484, 7}
+, {180, 166, 407}
+, {-282, -25, -229}
+, {385, 144, 507}
+, {163, -16, 94}
+, {-551, 44, 216}
+, {-352, 589, 249}
+, {501, 87, -486}
+, {325, -168, 193}
+, {-102, 482, -478}
+, {583, 602, 267}
+, {-105, 44, 254}
+, {-675, 340, -252}
+, {434, -347, 93}
+, {322, 132, -15}
+, {-205, 228, -19}
+, {443, -141, 540}
+, {-637, -108, 314}
+, {464, -456, -367}
+, {-175, 88, -432}
+, {368, -329, -207}
+, {-99, 199, -9}
+, {60, 235, -454}
+, {179, -530, -249}
+, {519, -615, 157}}
+, {{146, 598, 340}
+, {520, 543, -452}
+, {296, 467, 457}
+, {-218, 370, -604}
+, {-536, 505, 400}
+, {488, 576, -245}
+, {480, 172, 541}
+, {530, 26, -388}
+, {448, 510, -23}
+, {159, 314, -375}
+, {-273, 323, 571}
+, {577, -453, 415}
+, {189, -333, 544}
+, {284, 241, 125}
+, {-588, 451, 442}
+, {-95, -553, 49}
+, {163, 85, -507}
+, {-57, 343, -221}
+, {73, 228, -87}
+, {-618, -215, -476}
+, {-93, -279, -52}
+, {536, -497, 295}
+, {421, -26, -399}
+, {-385, -97, -120}
+, {4, -437, 280}
+, {-110, -106, -182}
+, {123, -129, 243}
+, {139, 400, 44}
+, {72, -17, -242}
+, {515, 440, 493}
+, {291, -140, 461}
+, {-547, 13, 652}}
+, {{-416, 474, -467}
+, {226, -251, -645}
+, {-460, -54, -120}
+, {-471, 142, 510}
+, {-555, -40, -52}
+, {-61, 563, 402}
+, {-553, -519, 132}
+, {253, -344, 442}
+, {333, -595, 399}
+, {-368, 378, 630}
+, {108, 188, 503}
+, {-13, -547, 278}
+, {-38, -345, -96}
+, {267, 31, -245}
+, {-168, 71, 149}
+, {-206, -516, 508}
+, {-394, 117, 7}
+, {380, 264, 141}
+, {111, -590, 355}
+, {305, 113, 164}
+, {-39, 568, -186}
+, {-437, -187, 547}
+, {-472, 396, 35}
+, {306, 308, -244}
+, {6, 350, 110}
+, {-191, -169, -349}
+, {633, 59, -319}
+, {-185, 92, 484}
+, {265, 49, 57}
+, {-431, -151, -261}
+, {29, 176, 449}
+, {-262, 176, -203}}
+, {{405, 83, -465}
+, {513, -229, 158}
+, {314, 258, -214}
+, {-251, 558, 314}
+, {229, -507, -76}
+, {-242, 94, -121}
+, {-414, -236, -48}
+, {-47, -98, 461}
+, {152, 221, 389}
+, {457, -303, -457}
+, {-406, 569, -273}
+, {-577, -78, 81}
+, {317, -141, -2}
+, {225, -312, -546}
+, {149, 121, 593}
+, {62, -546, -519}
+, {618, 361, -251}
+, {202, -347, 270}
+, {125, 627, 398}
+, {-360, -519, 208}
+, {-610, 380, 112}
+, {-585, -111, -206}
+, {-388, 34, 518}
+, {316, -55, -7}
+, {128, 529, -89}
+, {-476, -326, -420}
+, {-121, -510, -181}
+, {500, 247, -328}
+, {387, 206, 42}
+, {-619, 465, 274}
+, {-59, 549, 417}
+, {19, -607, -129}}}
+;
+
+#define CONV1D_119_FORMATS
+#define CONV1D_119_REQUANT_SHIFT 10 // input Q8, weights Q12, output and bias Q10
+
+const int16_t conv1d_119_bias[128] = {-5, -21, 30, 2, 18, -23, -10, 41, 6, 9, 20, 13, -34, 0, 13, 24, -10, -32, 0, -12, 38, -33, -2, 18, 9, 29, -17, 6, -20, 4, 30, 25, 1, -1, 4, 13, 4, -19, 44, 6, 13, -14, -27, 15, 7, 24, 13, -26, 35, 15, -30, 9, 2, 24, -12, -17, 45, -2, 3, -11, 11, 20, -21, 8, -4, 32, -1, 39, -14, 6, 43, -12, -5, -30, 0, 14, 14, -17, 19, 19, 5, -7, -32, -19, -12, -14, 11, 44, -4, -11, 21, -8, 45, 11, 27, 9, 16, -31, 34, -7, 1, 35, 6, -12, 29, -18, 25, -9, 5, -11, 8, -7, 13, 4, -9, -8, 15, -6, 23, 31, -8, -1, -8, 8, -8, 4, -10, -17}
+;
+
+const int16_t conv1d_119_kernel[128][64][3] = {{{-260, -18, 47}
+, {-328, 416, -297}
+, {-171, 480, 296}
+, {-334, -88, -138}
+, {458, 333, 210}
+, {194, 347, -369}
+, {-45, -349, -413}
+, {-309, -244, 175}
+, {-272, 200, -53}
+, {-5, -242, 357}
+, {-427, -273, -243}
+, {-213, 236, 360}
+, {-222, -212, 234}
+, {-300, 265, -46}
+, {-427, 383, -219}
+, {123, -340, 235}
+, {332, 394, 242}
+, {-386, 236, 148}
+, {-271, 221, -65}
+, {-193, 48, 407}
+, {-171, -196, -190}
+, {260, -250, -199}
+, {314, -167, 324}
+, {126, 331, -169}
+, {477, 44, -244}
+, {267, 44, -441}
+, {-233, -146, -20}
+, {-8, -139, -158}
+, {-64, -236, -364}
+, {281, 68, 327}
+, {72, 88, -369}
+, {-53, 253, -395}
+, {-333, -311, 348}
+, {-467, -402, 343}
+, {-261, 494, 103}
+, {7, -28, 401}
+, {75, 115, -369}
+, {205, -297, -30}
+, {363, 459, 122}
+, {-181, 388, 374}
+, {-76, -279, 475}
+, {157, -329, -299}
+, {173, -24, -145}
+, {35, -381, 29}
+, {150, -268, 401}
+, {-258, -231, -257}
+, {242, 305, 257}
+, {199, -317, -315}
+, {-87, 120, 301}
+, {-482, -410, -337}
+, {316, 232, -375}
+, {-487, -111, -252}
+, {397, -301, 455}
+, {328, 84, -20}
+, {-41, 175, 248}
+, {-23, -256, -251}
+, {-175, -28, -360}
+, {-344, 263, -50}
+, {-49, 118, 192}
+, {349, -96, 411}
+, {-5, 132, 74}
+, {432, -165, 42}
+, {223, -281, 222}
+, {-21, -117, -309}}
+, {{110, 428, 182}
+, {154, -134, 128}
+, {-186, -288, -493}
+, {371, -311, 170}
+, {-47, -381, -330}
+, {190, -165, 240}
+, {237, -275, 104}
+, {-312, -18, 107}
+, {190, -212, -264}
+, {-247, -59, 81}
+, {41, -390, 164}
+, {40, 391, -271}
+, {-382, 215, -92}
+, {-143, 335, 22}
+, {-390, 66, -199}
+, {244, -244, 160}
+, {-361, -380, 134}
+, {-355, -269, -336}
+, {296, 249, 296}
+, {357, -198, 383}
+, {65, 218, 379}
+, {100, -140, 181}
+, {-79, -21, 427}
+, {-205, -218, 314}
+, {233, -73, -69}
+, {-23, 172, 167}
+, {-372, -384, -146}
+, {231, 167, -221}
+, {298, 228, -248}
+, {-377, -294, 297}
+, {182, -196, 376}
+, {27, 207, -248}
+, {-232, -337, 101}
+, {-300, 94, 203}
+, {92, 48, 103}
+, {-376, 511, -343}
+, {-85, 339, 148}
+, {426, -154, 166}
+, {-85, -43, -232}
+, {389, 51, 410}
+, {-334, -254, 128}
+, {-392, -386, 9}
+, {-242, 435, -160}
+, {250, 168, 140}
+, {-129, -321, -177}
+, {-331, 331, 132}
+, {-267, -57, -404}
+, {166, -363, -369}
+, {-300, -18, -80}
+, {263, -518, -360}
+, {265, 442, 403}
+, {-186, -486, -71}
+, {-261, 325, 99}
+, {-195, -183, -383}
+, {-85, 293, 303}
+, {228, -236, -206}
+, {-387, 299, -163}
+, {301, -385, 301}
+, {143, 298, -31}
+, {-317, 245, 123}
+, {155, 271, -222}
+, {-239, 109, 86}
+, {109, 172, -41}
+, {3, 184, -281}}
+, {{-61, 217, 164}
+, {-329, 117, 53}
+, {188, 57, -387}
+, {-334, -497, 140}
+, {-312, -232, -401}
+, {-84, 325, 106}
+, {211, 427, -324}
+, {333, 230, 114}
+, {395, -216, -259}
+, {332, 430, 10}
+, {267, 278, 410}
+, {-148, 380, 129}
+, {-39, -141, -417}
+, {114, 84, -54}
+, {-348, 385, 89}
+, {-238, -95, -187}
+, {-114, 206, 386}
+, {-158, 120, -484}
+, {218, 365, -116}
+, {-1, -238, 44}
+, {-283, -355, 400}
+, {332, 204, -69}
+, {31, 311, -195}
+, {328, 358, -64}
+, {77, 182, 484}
+, {-462, -19, -81}
+, {-129, 111, 49}
+, {-79, -87, 162}
+, {280, -186, -95}
+, {-298, 17, 238}
+, {76, 167, 53}
+, {255, -161, -158}
+, {-35, 231, 205}
+, {12, 101, -318}
+, {450, -357, -168}
+, {-342, -187, -502}
+, {-379, -358, -26}
+, {78, -258, 103}
+, {493, -288, 52}
+, {-523, 148, -407}
+, {337, -66, -228}
+, {-43, 129, -175}
+, {-25, -302, 68}
+, {94, 12, -331}
+, {-228, -204, -67}
+, {247, 0, 314}
+, {80, 384, -123}
+, {-161, 281, 360}
+, {393, -171, 422}
+, {234, 199, 182}
+, {-440, -405, -337}
+, {479, 22, -61}
+, {271, 349, -229}
+, {-76, -361, 182}
+, {356, -383, 301}
+, {-5, 86, -185}
+, {104, -192, -287}
+, {112, 511, 481}
+, {-224, 62, 203}
+, {-172, 169, -243}
+, {2, 469, 402}
+, {139, 214, 262}
+, {76, -234, -303}
+, {-89, 73, -37}}
+, {{2, -54, -3}
+, {-289, 201, 376}
+, {137, -377, 30}
+, {-11, 76, 321}
+, {332, -329, -22}
+, {225, 325, -71}
+, {225, -49, 80}
+, {232, -240, 152}
+, {-213, 369, -150}
+, {-2, 66, -177}
+, {-151, 418, 397}
+, {52, 106, 369}
+, {337, -169, 310}
+, {8, 241, 370}
+, {-329, -385, 71}
+, {196, 118, -343}
+, {-369, 150, -186}
+, {218, -203, 87}
+, {-29, 415, 7}
+, {-411, 370, 379}
+, {204, -49, -282}
+, {-26, 162, -310}
+, {184, 229, 207}
+, {118, 541, 331}
+, {196, 445, 418}
+, {-490, -86, -255}
+, {146, 506, 262}
+, {-302, 271, 72}
+, {301, 140, 51}
+, {339, -312, 255}
+, {-431, -37, -166}
+, {229, 156, -17}
+, {417, -7, -31}
+, {198, 135, 231}
+, {254, 462, 425}
+, {-14, -333, -280}
+, {29, -131, -429}
+, {337, 229, -366}
+, {-365, -262, -61}
+, {-7, -122, -146}
+, {-450, -392, 182}
+, {314, -10, 158}
+, {103, 186, 78}
+, {171, 170, -228}
+, {388, 170, 461}
+, {330, -266, -284}
+, {-194, 194, 182}
+, {-273, -261, 32}
+, {14, 251, 389}
+, {-61, 267, 257}
+, {367, -296, 249}
+, {220, -92, 344}
+, {-266, -344, 315}
+, {370, -251, 49}
+, {-255, -22, 126}
+, {124, -209, 6}
+, {264, -22, 413}
+, {30, -78, -18}
+, {-327, -292, 401}
+, {43, 197, 300}
+, {-48, -40, 36}
+, {-202, -342, -143}
+, {410, 293, -86}
+, {-380, -98, -124}}
+, {{232, -93, 282}
+, {-195, -24, 259}
+, {269, 398, -148}
+, {-341, -455, -242}
+, {20, -308, 157}
+, {-25, 42, -323}
+, {112, 236, 108}
+, {-81, 262, -226}
+, {294, -282, -176}
+, {-113, 99, 249}
+, {-495, 125, -66}
+, {-79, 6, 214}
+, {-230, 104, -393}
+, {-335, 209, -397}
+, {205, 288, -131}
+, {459, -241, -112}
+, {41, 233, 390}
+, {234, -130, 8}
+, {-80, -139, -340}
+, {-334, 319, 333}
+, {-183, -331, 271}
+, {-242, 143, 240}
+, {-348, -192, 400}
+, {1, -343, -290}
+, {-23, 115, 60}
+, {435, 160, -227}
+, {-66, 98, -108}
+, {232, 319, -337}
+, {232, -87, 428}
+, {329, -152, 60}
+, {316, 202, 42}
+, {-117, -130, -112}
+, {-271, 347, 270}
+, {-78, 71, -384}
+, {194, 12, 138}
+, {268, -44, -256}
+, {-314, -336, 371}
+, {387, 147, -365}
+, {-245, 160, -207}
+, {-257, 326, 199}
+, {-325, -40, -169}
+, {-266, -448, -228}
+, {151, -151, -33}
+, {157, 104, 238}
+, {-161, 70, 215}
+, {-247, -124, 482}
+, {-220, 298, -138}
+, {-36, 104, 32}
+, {-181, 211, -204}
+, {264, -148, 271}
+, {-297, 238, 360}
+, {76, 345, 236}
+, {-282, 364, 93}
+, {-63, -140, 108}
+, {352, 316, -28}
+, {114, -330, -134}
+, {-252, -280, 368}
+, {-171, 411, 501}
+, {247, -302, -295}
+, {-183, -305, 345}
+, {365, -63, 433}
+, {-74, 333, -57}
+, {-93, -303, -435}
+, {245, 192, -195}}
+, {{11, 321, -64}
+, {321, -428, 142}
+, {-370, 36, 168}
+, {456, 154, 291}
+, {-286, -309, -269}
+, {310, 341, 292}
+, {250, 158, 291}
+, {263, -282, 347}
+, {370, -370, -66}
+, {-194, 10, -221}
+, {91, 134, 26}
+, {-325, 246, -2}
+, {-328, -104, 311}
+, {-175, 222, 353}
+, {73, -18, -362}
+, {-152, -358, -49}
+, {-333, -200, 350}
+, {-427, -102, 229}
+, {-82, -257, 311}
+, {-75, 457, -173}
+, {4, -298, -295}
+, {466, -240, 77}
+, {-316, 141, 275}
+, {354, -332, -8}
+, {325, 440, 339}
+, {-32, 301, -226}
+, {301, -399, 192}
+, {83, -134, 267}
+, {316, -114, 62}
+, {271, -59, -177}
+, {-56, 125, 144}
+, {-99, -89, -30}
+, {537, 349, -164}
+, {-171, 306, -118}
+, {197, 260, 264}
+, {294, -259, 111}
+, {132, 387, 299}
+, {-106, 98, 321}
+, {-151, -105, 156}
+, {18, -554, -76}
+, {-225, -499, -61}
+, {291, 77, 2}
+, {198, -172, 320}
+, {-506, -46, 110}
+, {148, 111, 222}
+, {339, -214, -310}
+, {-105, -54, 249}
+, {-437, 312, -308}
+, {-113, -457, 179}
+, {-523, 217, -358}
+, {40, -254, -227}
+, {126, 113, -464}
+, {-200, -148, 451}
+, {-10, 363, 277}
+, {-361, 393, -124}
+, {125, -144, 86}
+, {-381, 320, -309}
+, {-327, -309, -286}
+, {-133, 142, 111}
+, {392, 73, -23}
+, {88, -328, -239}
+, {-382, 290, 370}
+, {309, -321, 469}
+, {282, 49, -467}}
+, {{-230, -10, 390}
+, {-340, 230, -223}
+, {-274, 266, -492}
+, {126, -171, -150}
+, {-332, 23, -386}
+, {350, -346, 269}
+, {7, 172, 378}
+, {331, 155, -268}
+, {-290, -94, -145}
+, {-320, 311, -250}
+, {-147, 62, -250}
+, {-341, -85, 26}
+, {153, 380, 225}
+, {-106, -153, 47}
+, {-141, 28, 354}
+, {-363, 172, -340}
+, {40, -327, 366}
+, {-279, 334, 165}
+, {155, -311, 227}
+, {-76, -409, 115}
+, {277, 292, -350}
+, {-307, -2, -83}
+, {258, -154, -402}
+, {-298, -259, 295}
+, {55, -346, -369}
+, {-405, 37, -307}
+, {93, 204, 265}
+, {-389, 90, 274}
+, {-115, -151, -60}
+, {227, 289, 144}
+, {-168, 251, 18}
+, {189, -105, 167}
+, {-182, -344, -53}
+, {284, 107, 378}
+, {161, 200, 356}
+, {-147, 291, 205}
+, {-242, -195, -15}
+, {-6, -8, 79}
+, {370, -378, 71}
+, {431, 1, 66}
+, {155, 344, 376}
+, {-252, -293, 195}
+, {108, 342, -102}
+, {-359, 73, 200}
+, {-256, -148, 225}
+, {-403, -181, -346}
+, {-14, 303, -92}
+, {30, -463, 223}
+, {-403, -9, 181}
+, {-308, 117, -315}
+, {121, -351, 37}
+, {-247, -206, -9}
+, {-36, 150, -146}
+, {246, 81, -133}
+, {-326, -199, 234}
+, {-124, 7, -371}
+, {-152, -135, -183}
+, {-452, 347, 6}
+, {-255, -47, 278}
+, {295, 273, 379}
+, {-328, -414, -250}
+, {-358, 29, -207}
+, {-204, -59, 33}
+, {-32, -138, 57}}
+, {{373, 46, -57}
+, {-7, 295, 247}
+, {-152, -75, -289}
+, {199, -141, -238}
+, {-241, 359, -310}
+, {147, 78, -20}
+, {-144, 362, -221}
+, {36, -70, -70}
+, {77, -410, 281}
+, {-172, 86, 461}
+, {387, 402, 160}
+, {130, -289, -40}
+, {-38, -390, 341}
+, {-492, 129, 268}
+, {-19, -398, -250}
+, {-119, 38, 177}
+, {-249, -23, 397}
+, {-88, 388, -84}
+, {-5, 9, 458}
+, {-247, 367, 20}
+, {-16, 294, 310}
+, {8, 179, 8}
+, {-358, 180, 219}
+, {-17, 223, 136}
+, {93, 409, 315}
+, {44, -230, -264}
+, {113, 0, 393}
+, {49, 352, 136}
+, {-268, -323, -274}
+, {-21, -161, 286}
+, {-407, -399, -217}
+, {-345, 76, -162}
+, {-219, 377, -394}
+, {-293, 317, 130}
+, {416, 122, 161}
+, {145, -53, -436}
+, {439, 225, -237}
+, {-177, -159, 191}
+, {-152, -12, 515}
+, {36, -265, -349}
+, {241, -161, -364}
+, {-20, 28, -447}
+, {-416, -331, -282}
+, {152, 148, 166}
+, {-196, -196, 145}
+, {-394, -295, -31}
+, {402, -311, -124}
+, {393, 281, 166}
+, {-152, 500, 560}
+, {14, 270, 75}
+, {-352, -203, -459}
+, {448, 386, -142}
+, {79, 346, -174}
+, {416, 200, -184}
+, {-168, 223, 337}
+, {82, 113, 69}
+, {-275, -186, 120}
+, {-239, -27, 353}
+, {-187, 192, -178}
+, {399, 352, 20}
+, {164, 269, 146}
+, {-305, 119, -179}
+, {234, -22, -15}
+, {104, -348, -221}}
+, {{60, -262, 151}
+, {-345, 169, -26}
+, {-290, -162, 372}
+, {146, 414, 348}
+, {386, 29, 153}
+, {-222, 266, 402}
+, {18, -142, 75}
+, {429, -108, 65}
+, {-196, -67, 65}
+, {-199, -77, 7}
+, {308, -207, 301}
+, {-232, 378, -22}
+, {0, 181, 187}
+, {200, 228, -338}
+, {164, 71, -137}
+, {377, -368, 55}
+, {-47, 188, -209}
+, {-22, -304, 336}
+, {-337, 333, 58}
+, {-336, -264, -373}
+, {-301, 268, -233}
+, {-122, -183, 349}
+, {226, 356, 387}
+, {281, -94, 281}
+, {150, 127, 20}
+, {178, 141, -157}
+, {278, 627, 263}
+, {309, 316, 402}
+, {288, -183, -372}
+, {69, -344, 339}
+, {157, -142, -165}
+, {43, -396, 524}
+, {249, -49, 426}
+, {516, 412, 116}
+, {-176, 299, -70}
+, {-346, -89, 25}
+, {-386, -156, -104}
+, {381, -234, -175}
+, {-92, -168, 402}
+, {395, -285, 298}
+, {-2, 167, 169}
+, {335, -246, 222}
+, {239, 307, -238}
+, {157, -99, -238}
+, {-235, 94, -330}
+, {-336, -244, -21}
+, {385, 256, 335}
+, {301, -256, 369}
+, {-267, -30, -254}
+, {329, 293, -280}
+, {-289, -257, -276}
+, {-309, -397, -48}
+, {179, -76, -393}
+, {410, 162, 130}
+, {118, -208, 70}
+, {297, 259, 24}
+, {112, -170, -77}
+, {24, -336, 129}
+, {268, 187, 71}
+, {-155, -176, -123}
+, {-161, -380, -367}
+, {-125, 103, -60}
+, {362, 430, 39}
+, {-72, -166, -239}}
+, {{89, -149, -115}
+, {383, 178, 275}
+, {157, -56, 456}
+, {-55, 351, -231}
+, {-312, 114, -324}
+, {-77, 278, -454}
+, {143, -299, -456}
+, {-405, 142, 339}
+, {325, -265, 331}
+, {37, -312, -154}
+, {-214, -351, -76}
+, {-214, -197, -59}
+, {-146, -41, -238}
+, {312, 527, -39}
+, {-134, 169, 99}
+, {202, 235, -267}
+, {352, 14, -295}
+, {-108, -185, -36}
+, {-85, -287, 364}
+, {219, 5, 67}
+, {205, 116, -302}
+, {-83, -310, -58}
+, {-275, 225, -156}
+, {-91, -281, -100}
+, {-246, 347, -350}
+, {175, 215, -80}
+, {425, 41, -414}
+, {143, 141, -415}
+, {227, 266, -270}
+, {-283, 133, 164}
+, {208, 491, -4}
+, {-120, -73, -252}
+, {-173, 199, -33}
+, {7, -458, 271}
+, {224, 176, 311}
+, {291, 164, 227}
+, {362, 380, 37}
+, {416, -261, -77}
+, {401, 468, -7}
+, {-128, 48, 266}
+, {-101, -260, -181}
+, {270, -226, -448}
+, {-431, 200, -44}
+, {-114, 123, -361}
+, {-313, -321, -268}
+, {95, -302, 91}
+, {-4, -20, 256}
+, {129, 347, 56}
+, {328, 498, 132}
+, {136, -219, -229}
+, {153, 430, 301}
+, {-213, 141, -282}
+, {349, -10, 381}
+, {361, 15, -26}
+, {-213, -69, 166}
+, {339, -120, -149}
+, {-162, -202, -144}
+, {-407, -285, 246}
+, {302, 324, -155}
+, {-66, -297, -13}
+, {-186, 251, -254}
+, {-61, 420, -4}
+, {-216, 286, -400}
+, {339, -222, -97}}
+, {{-228, 488, -252}
+, {-212, 198, 197}
+, {125, -149, 309}
+, {-237, -109, 19}
+, {-161, -270, 46}
+, {178, -346, -7}
+, {-42, -197, -304}
+, {-334, -149, 450}
+, {-13, -127, -489}
+, {14, -240, -130}
+, {303, -77, 291}
+, {-245, -301, 350}
+, {427, -64, -149}
+, {-72, 29, 24}
+, {170, -299, 328}
+, {-61, 341, 234}
+, {-29, 444, -144}
+, {120, -407, 195}
+, {-31, 474, 285}
+, {291, -145, 10}
+, {-262, -62, -291}
+, {274, 278, -255}
+, {-379, -420, -177}
+, {184, 512, 208}
+, {301, -84, 220}
+, {-210, 360, 372}
+, {-411, -123, 246}
+, {-54, -104, 329}
+, {18, 202, -186}
+, {-276, -222, 17}
+, {66, 142, -299}
+, {125, 359, 205}
+, {232, 64, 348}
+, {16, 159, -245}
+, {-260, 263, 483}
+, {136, -606, -384}
+, {9, -351, -176}
+, {-310, 63, 344}
+, {-49, 297, -11}
+, {219, -383, -153}
+, {-120, 63, -278}
+, {363, 322, 538}
+, {-287, 174, 181}
+, {-218, 374, -262}
+, {-252, -32, -151}
+, {406, -6, -45}
+, {287, -103, 253}
+, {17, 9, 310}
+, {19, 133, 302}
+, {120, -217, 307}
+, {127, -386, 119}
+, {153, 173, 274}
+, {-224, -249, -264}
+, {178, -291, -142}
+, {-65, -11, -445}
+, {-269, -144, 217}
+, {306, 269, 157}
+, {567, 384, 213}
+, {-585, 104, 205}
+, {-184, -323, -173}
+, {337, 71, 261}
+, {-368, 157, 6}
+, {-402, 96, 289}
+, {245, -257, 230}}
+, {{93, 450, -233}
+, {-179, -204, -272}
+, {-150, 370, 346}
+, {-44, 95, -423}
+, {-314, -159, -406}
+, {16, 346, 96}
+, {186, 250, -78}
+, {-267, 397, -138}
+, {95, 218, 185}
+, {347, -160, 390}
+, {-131, -120, 325}
+, {142, -244, -349}
+, {79, -348, 369}
+, {32, -111, -424}
+, {-298, -38, 19}
+, {306, 204, -95}
+, {424, 410, 109}
+, {42, 200, 298}
+, {357, -301, 126}
+, {284, -183, 218}
+, {-276, -178, -178}
+, {-137, 90, -325}
+, {-329, 28, 176}
+, {-390, -131, -70}
+, {-136, 62, -78}
+, {118, -350, 37}
+, {-265, -269, 56}
+, {-239, -50, 342}
+, {326, -81, -282}
+, {-40, -271, -204}
+, {-111, -294, 33}
+, {-281, 163, -25}
+, {314, 354, 313}
+, {-7, -49, 193}
+, {189, 554, 265}
+, {-230, 99, 313}
+, {-401, 121, -101}
+, {66, 307, -121}
+, {-274, -198, -296}
+, {384, 138, -323}
+, {-366, -364, -341}
+, {93, 108, -260}
+, {41, -193, 60}
+, {-371, 441, -11}
+, {-30, 362, 97}
+, {375, -218, -420}
+, {175, 72, -313}
+, {122, 168, -211}
+, {-131, 81, -378}
+, {109, 228, -337}
+, {172, 165, 3}
+, {-160, 188, -353}
+, {284, -311, -193}
+, {275, -203, 279}
+, {326, 4, -70}
+, {-186, 208, -173}
+, {-325, -309, -158}
+, {152, -298, 67}
+, {53, -138, 223}
+, {181, -201, -376}
+, {290, 106, 427}
+, {213, -332, 266}
+, {306, -65, 391}
+, {349, -6, -26}}
+, {{120, -88, 37}
+, {267, 187, -140}
+, {-487, 251, 266}
+, {-420, 83, 68}
+, {-212, 146, 5}
+, {-11, 38, 236}
+, {108, -35, 130}
+, {-374, 296, 100}
+, {-231, -475, 9}
+, {168, -359, -146}
+, {-269, -135, 330}
+, {131, 425, -43}
+, {-407, -278, -121}
+, {282, -177, 239}
+, {23, -479, -176}
+, {112, -132, 378}
+, {-54, 78, -230}
+, {234, 415, -468}
+, {137, 117, 109}
+, {-376, -351, 374}
+, {55, -287, 246}
+, {4, 202, 119}
+, {173, -396, 105}
+, {382, 10, 112}
+, {390, -287, 227}
+, {-371, 92, 105}
+, {-19, 87, -334}
+, {5, -281, -123}
+, {-267, -88, 123}
+, {-229, 351, -397}
+, {15, 133, 181}
+, {2, -129, -47}
+, {334, -241, -136}
+, {-456, -31, 340}
+, {226, 378, 385}
+, {-107, 20, 327}
+, {57, 340, 237}
+, {390, 391, -41}
+, {-206, 213, 179}
+, {208, 181, -322}
+, {-316, -103, 158}
+, {305, 313, -490}
+, {89, 48, -147}
+, {119, -422, 290}
+, {265, 121, -414}
+, {35, 324, 150}
+, {-403, 323, 306}
+, {-28, -261, -366}
+, {-304, -251, 210}
+, {33, -242, 318}
+, {318, -361, 133}
+, {358, -1, 337}
+, {-111, -32, 272}
+, {370, 18, -48}
+, {-127, -101, 39}
+, {-252, 335, 138}
+, {179, 334, -336}
+, {-337, -92, 14}
+, {220, -484, -23}
+, {153, 116, -102}
+, {272, 287, 367}
+, {119, -92, -142}
+, {311, -120, -244}
+, {-401, 215, -4}}
+, {{425, -316, 331}
+, {260, -350, 247}
+, {-70, -9, -371}
+, {-133, 7, -24}
+, {-318, -446, -24}
+, {114, -83, 28}
+, {327, -190, 393}
+, {418, -205, 92}
+, {282, 383, 280}
+, {209, -112, -272}
+, {19, -123, -119}
+, {203, 189, 42}
+, {-376, 116, 278}
+, {100, 241, 266}
+, {-62, 120, 77}
+, {-331, 172, 196}
+, {349, 267, -325}
+, {-249, -104, 119}
+, {217, -353, 230}
+, {370, -139, 361}
+, {212, 140, -127}
+, {447, 24, 25}
+, {-152, -68, 244}
+, {25, -519, 38}
+, {-201, -250, 232}
+, {-3, -330, 448}
+, {-499, -261, 136}
+, {-191, 177, -335}
+, {143, 187, 24}
+, {-270, 282, -92}
+, {194, 387, 12}
+, {319, -274, -177}
+, {-372, -137, -55}
+, {262, -421, 330}
+, {-193, -148, -464}
+, {363, 232, 136}
+, {-106, -72, 342}
+, {352, 444, -343}
+, {301, -232, 236}
+, {-183, 2, 303}
+, {111, 56, -372}
+, {265, 179, 130}
+, {-383, -193, -70}
+, {78, -8, 49}
+, {-210, -338, -360}
+, {363, 263, -37}
+, {-50, 141, 8}
+, {208, -47, 328}
+, {-81, -420, 57}
+, {150, -253, -123}
+, {-139, 326, -196}
+, {-24, 178, 15}
+, {226, 412, -112}
+, {-304, -161, -419}
+, {-28, -14, -403}
+, {-324, -201, -212}
+, {375, 396, 264}
+, {457, 385, -349}
+, {-143, -181, -34}
+, {-384, 56, 95}
+, {36, -274, -10}
+, {365, -119, -68}
+, {168, 212, -284}
+, {70, 327, 59}}
+, {{152, 113, -452}
+, {194, -126, -98}
+, {277, 43, 611}
+, {299, 140, 377}
+, {237, 179, -360}
+, {476, -4, 314}
+, {41, -353, 429}
+, {76, -270, -323}
+, {-71, -29, -391}
+, {-394, -116, 124}
+, {33, 102, 449}
+, {34, 159, -58}
+, {-281, 70, 398}
+, {154, 58, 204}
+, {295, 337, 221}
+, {350, 282, 52}
+, {269, 18, 250}
+, {-57, 8, -288}
+, {20, 278, -213}
+, {47, -413, 174}
+, {-312, 196, -137}
+, {-53, 395, 127}
+, {52, -394, 23}
+, {302, -126, -366}
+, {418, -37, 270}
+, {-104, 79, 425}
+, {-11, 73, -240}
+, {-357, -386, -367}
+, {226, 333, -325}
+, {245, -326, -261}
+, {9, 46, 245}
+, {-229, -101, 239}
+, {294, 100, -257}
+, {-315, -80, -315}
+, {20, -45, 19}
+, {-90, 31, 338}
+, {-184, -132, 228}
+, {-260, -144, 399}
+, {-53, 203, -360}
+, {-195, -278, 179}
+, {-131, 171, -276}
+, {21, 200, -9}
+, {129, -300, 238}
+, {104, 193, 295}
+, {-389, -335, 408}
+, {310, 2, 317}
+, {50, 258, 488}
+, {-31, 481, 447}
+, {-131, 371, 256}
+, {-234, 86, 290}
+, {371, -188, -309}
+, {234, 349, -121}
+, {-6, -14, 150}
+, {-342, -398, -68}
+, {246, -455, 388}
+, {-239, 246, 437}
+, {345, 11, -161}
+, {2, 394, 449}
+, {122, 597, 165}
+, {199, 247, -213}
+, {-158, -103, -401}
+, {392, -405, 110}
+, {-132, 0, 76}
+, {-11, -6, -51}}
+, {{256, 61, 107}
+, {-353, 248, -392}
+, {413, -129, 388}
+, {-170, -12, 73}
+, {-133, -237, 392}
+, {277, 323, -215}
+, {-279, 101, 77}
+, {190, -37, -161}
+, {-74, 265, 283}
+, {-409, -170, -31}
+, {-330, -447, -291}
+, {-416, -40, -73}
+, {-229, 375, 292}
+, {-321, -94, -32}
+, {90, 284, 5}
+, {21, -117, 87}
+, {326, 215, 16}
+, {103, 68, 65}
+, {-137, 104, -54}
+, {104, 48, 98}
+, {-328, 48, -79}
+, {151, 419, 202}
+, {63, 385, 159}
+, {30, 10, -219}
+, {94, -44, 254}
+, {238, 386, -310}
+, {342, -243, -222}
+, {-278, -215, -438}
+, {-78, -274, 303}
+, {-56, 151, -377}
+, {66, -121, 321}
+, {484, -266, 103}
+, {103, -256, 172}
+, {-138, 15, -190}
+, {89, 166, -210}
+, {231, 252, 453}
+, {62, -264, 20}
+, {-163, 223, -371}
+, {-284, -418, -252}
+, {-80, 365, 492}
+, {-131, -142, -53}
+, {26, -57, -219}
+, {371, 92, -321}
+, {-189, -348, -241}
+, {-192, 110, 408}
+, {144, -31, -365}
+, {225, -314, -137}
+, {11, 333, 173}
+, {-40, 286, -15}
+, {-27, 162, -446}
+, {-259, -365, 172}
+, {-227, -107, -160}
+, {-157, 379, 106}
+, {193, -350, -6}
+, {-25, 335, -186}
+, {27, -261, 39}
+, {324, -345, 113}
+, {250, 247, 451}
+, {139, 248, -311}
+, {411, -253, 12}
+, {331, -71, 269}
+, {-67, 304, 344}
+, {-42, 119, -24}
+, {-276, 323, -139}}
+, {{316, -278, -126}
+, {-246, -68, -91}
+, {162, -333, -54}
+, {-444, -167, -54}
+, {-418, -195, 399}
+, {144, 173, 74}
+, {169, 106, -167}
+, {-437, 284, 431}
+, {1, 189, 423}
+, {23, 307, 187}
+, {-5, -200, -198}
+, {-145, -3, -378}
+, {163, 229, 159}
+, {-30, 492, 203}
+, {-312, -277, 409}
+, {-343, -319, 168}
+, {215, 230, -125}
+, {56, -357, 330}
+, {-528, -53, 130}
+, {358, -353, -91}
+, {184, 323, -22}
+, {352, -283, 118}
+, {-205, -408, -259}
+, {319, -141, 347}
+, {82, -202, -12}
+, {187, 114, 354}
+, {285, 262, -258}
+, {-225, -234, 310}
+, {-216, 257, -7}
+, {-122, -271, 4}
+, {150, 217, -71}
+, {-95, -38, 229}
+, {-90, -15, 182}
+, {-145, 253, -379}
+, {159, 339, -219}
+, {399, -400, -82}
+, {234, -197, 291}
+, {-309, -358, -99}
+, {191, 21, 297}
+, {242, 393, 423}
+, {-197, 95, -402}
+, {-62, 311, -344}
+, {-325, -128, -240}
+, {-29, 155, -378}
+, {-440, -280, 364}
+, {350, 128, -48}
+, {60, 98, -106}
+, {-382, -1, -167}
+, {-345, -134, 268}
+, {-369, 30, 136}
+, {-56, -219, 176}
+, {-219, 378, -317}
+, {-84, 289, -109}
+, {-252, 302, -159}
+, {-353, -442, 50}
+, {-387, -23, -190}
+, {-172, 48, 120}
+, {-340, 83, -144}
+, {45, 84, 278}
+, {-335, 122, 325}
+, {-146, -409, 120}
+, {144, 42, -28}
+, {-497, 88, 159}
+, {-36, -361, -174}}
+, {{339, -228, -307}
+, {-367, 264, 240}
+, {-127, -526, -439}
+, {436, 382, 421}
+, {-239, 360, 306}
+, {-257, -398, 126}
+, {294, -387, 382}
+, {-261, -192, 434}
+, {120, -231, 90}
+, {245, -1, -193}
+, {-280, 292, -88}
+, {342, -48, -55}
+, {-237, 408, -123}
+, {110, 163, -54}
+, {12, -149, -223}
+, {45, 18, -192}
+, {148, -198, -129}
+, {409, 245, -431}
+, {331, 359, -106}
+, {300, 153, -243}
+, {-381, -104, -332}
+, {-191, -394, 37}
+, {393, 380, -194}
+, {52, 315, -89}
+, {331, -339, 124}
+, {-102, -256, -136}
+, {115, -247, 373}
+, {367, 33, 115}
+, {77, 324, -392}
+, {-69, -165, -58}
+, {440, -441, 41}
+, {-320, -16, -112}
+, {-121, -10, -391}
+, {361, -89, 415}
+, {372, 81, 14}
+, {262, -21, 176}
+, {-310, -89, 72}
+, {413, 194, -372}
+, {-326, -97, -3}
+, {393, -231, 111}
+, {-152, -395, -144}
+, {196, 97, 132}
+, {434, -135, 371}
+, {74, -337, 20}
+, {376, -286, -179}
+, {-200, -99, -288}
+, {-367, 383, 175}
+, {-331, 139, -8}
+, {-277, -165, 224}
+, {-178, -276, 47}
+, {-199, 16, -155}
+, {310, -274, 238}
+, {-280, 6, -357}
+, {326, 149, -73}
+, {-69, 321, -160}
+, {99, -151, -177}
+, {-30, -124, -402}
+, {-67, 288, -459}
+, {230, -431, 338}
+, {322, 396, 67}
+, {65, -117, 165}
+, {215, 264, -104}
+, {-334, -285, -173}
+, {-163, -42, -241}}
+, {{11, 142, -295}
+, {-126, -146, -69}
+, {-4, -77, 264}
+, {342, 313, 156}
+, {211, -255, 379}
+, {-265, -348, 230}
+, {25, 159, 109}
+, {-124, -147, 288}
+, {27, 171, 67}
+, {342, 44, 445}
+, {-80, 215, 232}
+, {-202, -19, 101}
+, {-180, -336, 76}
+, {-414, -74, 20}
+, {-371, 105, -316}
+, {314, -217, -343}
+, {-275, 312, -156}
+, {-233, -288, -288}
+, {107, 375, 215}
+, {-104, -98, -216}
+, {106, 369, 173}
+, {-379, -33, -367}
+, {-297, 407, 27}
+, {-181, -182, 268}
+, {343, 453, 294}
+, {-84, 61, 284}
+, {-12, 417, 323}
+, {-236, 141, 286}
+, {-123, 201, 52}
+, {-57, 147, 116}
+, {-77, -517, 11}
+, {-200, -256, 336}
+, {320, 428, 354}
+, {421, -82, 36}
+, {-237, -309, -290}
+, {-296, -387, 297}
+, {122, -414, 316}
+, {71, -315, -5}
+, {-214, 61, 336}
+, {-419, 253, -144}
+, {-200, -33, -37}
+, {381, 66, 100}
+, {200, 0, 30}
+, {416, 251, -375}
+, {-172, -19, 411}
+, {-243, -153, -220}
+, {376, 37, -219}
+, {-21, 371, 314}
+, {40, -402, 303}
+, {110, -111, 216}
+, {39, -415, -384}
+, {412, 256, -93}
+, {-98, -278, -177}
+, {-326, 11, -292}
+, {47, 118, -83}
+, {171, 141, 88}
+, {-268, -154, -8}
+, {-167, 411, -21}
+, {-135, -244, 382}
+, {333, 387, -270}
+, {311, 43, -43}
+, {-122, -304, 251}
+, {127, 435, 98}
+, {-306, -257, -252}}
+, {{-219, 321, -301}
+, {-230, -324, -109}
+, {-313, 77, 315}
+, {101, -235, -26}
+, {-15, -8, 34}
+, {-92, 216, -434}
+, {193, 304, -277}
+, {-402, 206, -192}
+, {-272, 75, -377}
+, {-163, 297, -121}
+, {-459, -433, 39}
+, {75, -295, 177}
+, {-350, -96, -312}
+, {431, -328, 86}
+, {242, -409, -317}
+, {-277, -199, 27}
+, {-52, 241, 327}
+, {112, -203, 285}
+, {-219, 56, -422}
+, {-170, -350, -177}
+, {-270, -227, 51}
+, {-96, 268, 164}
+, {-65, 1, 41}
+, {266, 190, -164}
+, {-203, 74, 199}
+, {135, 390, 26}
+, {-501, 294, 170}
+, {-98, -256, 376}
+, {-217, 409, -54}
+, {-120, 265, -310}
+, {111, 241, -80}
+, {159, -95, -91}
+, {-109, 136, 28}
+, {339, -288, -321}
+, {-533, 162, 183}
+, {-319, -84, 109}
+, {-332, -148, 230}
+, {263, 397, -222}
+, {-72, 39, -1}
+, {-56, -101, -277}
+, {84, 132, -132}
+, {182, 62, -241}
+, {-62, 362, 239}
+, {85, -75, -234}
+, {-39, 185, -160}
+, {324, -420, -189}
+, {-212, 306, 405}
+, {364, -295, -5}
+, {-145, 180, 387}
+, {118, 183, 307}
+, {420, 44, -196}
+, {397, 84, 344}
+, {85, 106, -3}
+, {99, -226, -225}
+, {225, 384, 17}
+, {280, 355, -444}
+, {-118, -368, 91}
+, {-343, 218, 50}
+, {-206, -160, 238}
+, {-115, -212, 88}
+, {-449, -398, 169}
+, {193, 99, 21}
+, {254, 176, -159}
+, {101, -355, 262}}
+, {{84, -111, -88}
+, {371, 150, -245}
+, {-204, -85, 57}
+, {281, -19, -305}
+, {140, 7, 294}
+, {248, 325, -262}
+, {-393, -72, -274}
+, {-167, 67, 440}
+, {79, 321, -198}
+, {112, 299, 86}
+, {109, -393, 255}
+, {77, 203, -163}
+, {-279, 252, -103}
+, {-260, 325, 231}
+, {-230, -341, -81}
+, {-15, 305, 6}
+, {424, 11, 344}
+, {180, 240, -194}
+, {-316, 268, -267}
+, {-71, 388, 278}
+, {135, 85, -414}
+, {408, -207, 94}
+, {-150, 356, -223}
+, {-347, -312, -118}
+, {141, -304, -338}
+, {336, 182, 101}
+, {230, 161, 320}
+, {213, -204, -121}
+, {267, 468, 395}
+, {-267, 106, -442}
+, {295, 208, -218}
+, {624, 211, 366}
+, {-402, 275, -183}
+, {-284, -62, 30}
+, {282, -297, -75}
+, {-207, -436, 304}
+, {155, 186, 158}
+, {-66, -92, -398}
+, {-244, -156, 300}
+, {21, 301, 185}
+, {-342, 66, -340}
+, {-111, -204, 270}
+, {11, -100, -202}
+, {373, -63, -305}
+, {-275, -24, 283}
+, {-66, -110, -272}
+, {-377, 118, -363}
+, {-231, 53, 384}
+, {-259, 215, 522}
+, {-337, 445, 418}
+, {60, 246, 27}
+, {519, 370, 77}
+, {-220, -148, 288}
+, {-392, -301, 17}
+, {47, -44, 327}
+, {104, 249, 345}
+, {44, -377, 388}
+, {519, -177, 551}
+, {-216, -199, 529}
+, {-243, 385, 277}
+, {-85, 129, -15}
+, {-383, 214, 184}
+, {-113, -58, -350}
+, {251, 222, 165}}
+, {{511, 433, 467}
+, {336, -45, 144}
+, {217, -230, 128}
+, {-365, 347, -310}
+, {-227, -130, 15}
+, {-216, -459, -320}
+, {-64, -210, -176}
+, {-453, -266, 396}
+, {52, 46, -185}
+, {162, 397, 28}
+, {107, 287, 191}
+, {49, 398, -423}
+, {-416, -97, 37}
+, {335, 198, 413}
+, {34, -92, -103}
+, {304, 58, 150}
+, {211, 208, 113}
+, {81, 5, 250}
+, {247, -77, -320}
+, {-231, -201, 376}
+, {-117, 149, 82}
+, {422, 396, -549}
+, {23, -37, 101}
+, {139, 395, 158}
+, {-8, 87, -210}
+, {29, -265, -206}
+, {-64, -43, -52}
+, {-323, -49, -44}
+, {-41, -47, -150}
+, {-328, 63, -215}
+, {309, 134, -53}
+, {-285, 125, 213}
+, {-326, 215, -12}
+, {-319, -190, -10}
+, {121, -263, 105}
+, {49, 273, 288}
+, {-221, 110, 123}
+, {-315, -171, -217}
+, {291, 175, 276}
+, {361, -198, 94}
+, {320, 344, -196}
+, {-309, -68, -1}
+, {178, 141, -43}
+, {280, 280, -304}
+, {-267, 79, -190}
+, {-315, 98, -76}
+, {-199, 117, -283}
+, {251, -191, -276}
+, {-136, -192, 40}
+, {227, 112, -202}
+, {66, -109, -308}
+, {213, 341, -308}
+, {-318, 79, -319}
+, {-167, 422, 169}
+, {432, 193, -168}
+, {233, -329, 6}
+, {151, 263, -320}
+, {-5, 301, 160}
+, {-143, -169, -184}
+, {126, 13, 344}
+, {3, 315, -242}
+, {-185, -249, 270}
+, {366, -230, -174}
+, {179, -367, -215}}
+, {{67, 349, 215}
+, {-222, -7, -292}
+, {-40, 414, -14}
+, {269, -118, 103}
+, {-12, -316, -187}
+, {-237, 32, -7}
+, {-275, -391, 367}
+, {-8, 368, 370}
+, {-33, 327, -189}
+, {-71, -109, 169}
+, {11, -254, 149}
+, {308, -13, -206}
+, {292, 138, 348}
+, {-231, 96, -138}
+, {-11, 139, -185}
+, {431, 85, -376}
+, {45, 141, -414}
+, {-110, 227, 278}
+, {-307, 17, 354}
+, {241, -256, 221}
+, {-397, 5, 394}
+, {-101, 403, -78}
+, {205, -325, -163}
+, {-409, 99, 393}
+, {-195, 407, 397}
+, {31, -181, 67}
+, {189, -196, 187}
+, {-336, 271, 97}
+, {364, 222, -319}
+, {1, -209, -344}
+, {-287, 136, 21}
+, {305, -138, -265}
+, {79, 134, 159}
+, {61, -30, 47}
+, {-173, 224, 476}
+, {109, -114, 443}
+, {368, 80, -116}
+, {-13, 349, -263}
+, {128, -224, 233}
+, {112, 248, -282}
+, {-25, -310, 161}
+, {372, -95, -368}
+, {-388, 118, -179}
+, {54, -248, -4}
+, {-356, 364, 158}
+, {-49, -322, -407}
+, {133, 258, 142}
+, {265, -195, -190}
+, {-97, 399, -251}
+, {-24, -33, -335}
+, {-413, -280, 86}
+, {-167, -181, -393}
+, {188, 345, -41}
+, {261, -252, -304}
+, {-379, 93, 176}
+, {136, 421, -167}
+, {83, 161, 30}
+, {-254, -190, -113}
+, {-605, -422, 27}
+, {-386, -261, -55}
+, {311, 110, -390}
+, {-25, 60, -128}
+, {162, -164, 70}
+, {-161, 18, -236}}
+, {{35, -221, -372}
+, {-270, -158, 428}
+, {166, -263, 342}
+, {-92, 253, -84}
+, {-52, 388, 236}
+, {-308, -447, -92}
+, {-211, -43, 260}
+, {-334, 21, -414}
+, {273, 232, -253}
+, {-88, 536, -427}
+, {13, -219, 68}
+, {82, 58, 333}
+, {313, 42, -292}
+, {429, 334, 465}
+, {365, 207, 304}
+, {-232, -314, -92}
+, {-417, 22, -307}
+, {194, 122, 225}
+, {48, -95, 440}
+, {70, -297, 165}
+, {290, -69, -2}
+, {223, -380, 200}
+, {274, 134, 425}
+, {263, 179, -25}
+, {-356, 104, -274}
+, {-58, -137, 145}
+, {323, -330, 343}
+, {-401, 33, 223}
+, {38, -430, -417}
+, {15, 309, 68}
+, {383, -238, 410}
+, {-91, -95, -324}
+, {30, -54, 328}
+, {251, 25, 55}
+, {120, 294, 218}
+, {-76, -43, 26}
+, {88, 251, 353}
+, {-217, 21, -246}
+, {8, -170, 160}
+, {-15, -216, 316}
+, {-245, 78, -278}
+, {-306, 161, 77}
+, {142, 386, -128}
+, {60, -161, -174}
+, {245, -68, -218}
+, {-241, 10, 108}
+, {-230, 1, -384}
+, {7, 4, -421}
+, {-75, -170, -47}
+, {28, 361, 230}
+, {-148, 65, 115}
+, {-155, -129, 337}
+, {-399, -137, -222}
+, {431, -95, 430}
+, {-283, -279, 100}
+, {62, 18, 82}
+, {215, -173, 111}
+, {-443, -91, -18}
+, {-261, 376, -100}
+, {242, 140, -64}
+, {81, 17, -40}
+, {-247, -209, -350}
+, {-110, 280, -59}
+, {215, -248, 46}}
+, {{45, 64, -189}
+, {-18, 390, -124}
+, {6, -212, 166}
+, {446, 295, 484}
+, {159, -276, -9}
+, {-235, -292, 284}
+, {-256, -19, -154}
+, {21, -13, -110}
+, {232, -382, -84}
+, {150, -48, 285}
+, {165, -153, -337}
+, {-264, -17, 222}
+, {-213, 415, 249}
+, {-147, -191, -169}
+, {514, 486, -305}
+, {-180, -121, 74}
+, {-36, -264, -304}
+, {439, 225, 660}
+, {24, -372, 343}
+, {334, 139, -173}
+, {105, 295, -88}
+, {-94, -71, 94}
+, {-9, 291, 95}
+, {385, -327, -334}
+, {-171, 331, -46}
+, {170, 148, 138}
+, {281, 319, -238}
+, {392, 8, -316}
+, {-422, -389, -256}
+, {481, -43, -381}
+, {419, -102, -92}
+, {-291, -11, -165}
+, {-321, -353, 237}
+, {-192, -229, 165}
+, {-279, 249, -12}
+, {21, 259, 493}
+, {242, -373, -152}
+, {149, -190, 339}
+, {-168, -121, 234}
+, {288, 321, 89}
+, {426, -30, 389}
+, {-185, 193, -367}
+, {-403, -158, -103}
+, {195, -9, 96}
+, {-134, 485, 437}
+, {126, -113, 225}
+, {-241, -249, -303}
+, {366, 308, 47}
+, {-169, -37, 178}
+, {-295, -136, -337}
+, {337, 255, 134}
+, {20, -23, 62}
+, {357, -296, 266}
+, {524, 455, -192}
+, {-283, -40, 155}
+, {-145, 464, 540}
+, {-300, 146, 381}
+, {-159, 155, -15}
+, {549, 13, -210}
+, {-262, 33, -100}
+, {181, -88, 63}
+, {-14, -427, 160}
+, {250, -374, -431}
+, {444, -376, 311}}
+, {{109, -329, 101}
+, {204, 437, -242}
+, {208, -134, -86}
+, {-125, -176, -299}
+, {-60, 402, 377}
+, {79, 49, 137}
+, {84, -310, 185}
+, {-208, 233, 178}
+, {-412, 22, -65}
+, {-240, 186, -244}
+, {-131, 68, -165}
+, {94, -162, 210}
+, {122, -365, -415}
+, {-179, 584, 76}
+, {376, 81, 43}
+, {470, 82, 163}
+, {236, 303, -235}
+, {282, 250, 94}
+, {-336, 124, 7}
+, {390, -81, -316}
+, {12, 62, -228}
+, {-421, -441, -491}
+, {93, -248, -144}
+, {-212, -22, 288}
+, {-261, -91, -195}
+, {204, 176, 213}
+, {539, 387, 576}
+, {416, 180, -112}
+, {-251, -339, 343}
+, {99, 52, 242}
+, {529, 261, -33}
+, {-273, -89, 300}
+, {412, 240, -6}
+, {-208, 297, 158}
+, {-221, -167, -248}
+, {84, 278, -240}
+, {330, -345, 276}
+, {-46, 320, -64}
+, {116, -113, 156}
+, {-14, 266, 333}
+, {-87, 94, 176}
+, {-280, -138, 202}
+, {-240, -292, 186}
+, {352, -78, -201}
+, {342, 516, 37}
+, {62, -457, -446}
+, {51, 220, 377}
+, {-276, 100, 52}
+, {127, 312, 127}
+, {-9, 186, -63}
+, {-265, 309, 118}
+, {39, -91, 12}
+, {335, 147, 170}
+, {-422, -389, 344}
+, {507, -240, 418}
+, {47, 3, -162}
+, {-134, -257, -373}
+, {83, -389, -14}
+, {-75, 268, 441}
+, {-47, -323, -2}
+, {-172, -259, -73}
+, {-369, 174, -204}
+, {-51, 265, 75}
+, {-277, 69, 226}}
+, {{-101, -264, -202}
+, {-105, -110, -270}
+, {-32, -302, 268}
+, {374, -337, 162}
+, {372, -263, -74}
+, {282, 370, 176}
+, {-96, 278, 113}
+, {-160, 345, -391}
+, {-130, -255, 17}
+, {33, 132, -148}
+, {180, -33, -335}
+, {76, -147, -301}
+, {-17, -55, -91}
+, {-266, -404, -12}
+, {-435, -18, 121}
+, {79, 83, -383}
+, {-188, 371, -319}
+, {319, -254, 481}
+, {-203, -185, -8}
+, {382, -259, -321}
+, {-334, 395, 133}
+, {-26, 167, -428}
+, {363, 77, 135}
+, {-376, -437, 71}
+, {50, -16, -269}
+, {358, 252, -341}
+, {-271, 64, -45}
+, {-364, 136, 86}
+, {-197, 325, 189}
+, {-338, 316, 326}
+, {-267, 340, 44}
+, {-481, 43, 216}
+, {-164, 120, 374}
+, {284, 314, -471}
+, {104, 167, 257}
+, {79, 88, 289}
+, {-96, 105, -76}
+, {-98, 362, 142}
+, {-218, -286, -235}
+, {84, -60, 259}
+, {-113, 361, 276}
+, {-6, 95, -323}
+, {-156, 8, -230}
+, {-131, 448, -84}
+, {187, -364, -47}
+, {200, 446, -283}
+, {-14, -320, 430}
+, {-467, 116, -384}
+, {7, 98, -362}
+, {-69, 140, -216}
+, {320, -64, -32}
+, {-388, 76, 109}
+, {381, -77, -305}
+, {268, 57, 316}
+, {-64, -76, 262}
+, {353, -8, -29}
+, {-19, 345, 333}
+, {-143, 85, -348}
+, {-269, 65, -268}
+, {-220, -124, -329}
+, {-80, 95, -31}
+, {10, 116, 107}
+, {-44, -120, -275}
+, {-6, 133, 142}}
+, {{292, -270, 408}
+, {308, 231, 209}
+, {205, 167, 258}
+, {400, -414, -263}
+, {206, -437, 24}
+, {72, 331, -372}
+, {-259, 431, 235}
+, {220, -344, -36}
+, {459, 316, -184}
+, {-127, -10, 275}
+, {-87, 204, -354}
+, {88, -168, 316}
+, {61, 299, 309}
+, {364, -80, -361}
+, {263, 181, 101}
+, {-155, 54, 250}
+, {443, 285, -35}
+, {-190, 395, 23}
+, {-217, 133, -66}
+, {314, -80, 408}
+, {8, 26, 268}
+, {-160, 268, 169}
+, {202, -392, 385}
+, {-159, 358, 43}
+, {366, -69, 56}
+, {323, -197, -66}
+, {45, 87, -68}
+, {163, 218, -129}
+, {244, -328, -210}
+, {-256, 117, 46}
+, {-313, -100, 65}
+, {-433, -219, 10}
+, {-80, 12, -224}
+, {-67, 38, -287}
+, {298, -82, -331}
+, {-332, -317, -233}
+, {127, 21, -288}
+, {334, 393, 122}
+, {105, -60, -113}
+, {-408, 356, -59}
+, {62, 438, 78}
+, {138, -392, -208}
+, {249, 81, 338}
+, {-158, -10, 247}
+, {-331, 134, -362}
+, {-280, 389, -185}
+, {-344, -30, -290}
+, {131, 202, -358}
+, {89, -137, -13}
+, {166, -122, 306}
+, {-11, -353, -411}
+, {175, 259, -52}
+, {332, -159, -428}
+, {372, 438, -5}
+, {-298, -335, -61}
+, {139, -44, -133}
+, {-295, 146, -424}
+, {-41, 206, -243}
+, {-321, -33, -470}
+, {-307, -336, 394}
+, {432, -411, 172}
+, {-128, 163, 73}
+, {286, 152, 270}
+, {-35, -310, -250}}
+, {{268, 78, 201}
+, {416, 144, -377}
+, {446, 373, 472}
+, {281, -138, 196}
+, {-88, -6, -54}
+, {-380, 244, 398}
+, {-108, 18, 318}
+, {204, 339, -334}
+, {339, -324, 271}
+, {181, -96, 295}
+, {341, -324, -173}
+, {116, -43, 107}
+, {-115, 334, -201}
+, {-308, -182, 312}
+, {416, 63, 133}
+, {-276, 254, 339}
+, {155, -349, -187}
+, {185, 133, 358}
+, {195, -344, -38}
+, {-234, 195, 145}
+, {107, -163, 159}
+, {-55, -44, -309}
+, {42, -371, -18}
+, {189, -328, 29}
+, {476, 244, -111}
+, {272, 366, 281}
+, {-467, -140, -258}
+, {254, -408, 125}
+, {-36, 116, -180}
+, {159, 10, 343}
+, {-161, 133, -361}
+, {139, -327, -356}
+, {302, 196, -301}
+, {-193, 390, -457}
+, {358, 365, -110}
+, {7, 240, -329}
+, {-115, -312, 393}
+, {-357, -18, 52}
+, {279, 370, 126}
+, {-167, 337, -350}
+, {-126, -204, -312}
+, {-418, -46, -330}
+, {45, 155, -52}
+, {-115, -319, 347}
+, {-314, 307, 248}
+, {-182, 139, 156}
+, {295, 290, 359}
+, {-405, -73, -252}
+, {85, -130, -59}
+, {247, 48, 171}
+, {121, -340, 385}
+, {-413, -275, -350}
+, {-321, 152, -171}
+, {214, -291, 214}
+, {386, -113, 395}
+, {377, -133, -186}
+, {-6, 3, 202}
+, {-228, -93, -192}
+, {365, 445, -228}
+, {98, -119, 143}
+, {-319, 162, -425}
+, {-8, -125, 223}
+, {-97, 256, 40}
+, {82, -103, 329}}
+, {{-250, -168, -26}
+, {-87, 85, 7}
+, {-209, 270, 32}
+, {-322, 355, -85}
+, {-358, -27, -343}
+, {-118, -226, -320}
+, {-244, -69, 339}
+, {-78, -286, 36}
+, {-259, 48, -274}
+, {514, 271, 6}
+, {468, 665, 79}
+, {114, 330, 219}
+, {427, -401, 318}
+, {-124, 126, -301}
+, {340, -226, 289}
+, {326, -406, 167}
+, {52, 308, -151}
+, {354, -33, -38}
+, {205, 346, 272}
+, {232, -27, -183}
+, {-391, 14, -352}
+, {38, -304, -241}
+, {-69, 394, 83}
+, {258, 92, 779}
+, {-96, 81, 317}
+, {-29, 68, 229}
+, {-106, 201, 228}
+, {-120, 163, -305}
+, {-251, -516, 30}
+, {377, 346, 51}
+, {138, -392, 301}
+, {423, 250, 30}
+, {-388, 44, -14}
+, {-140, 242, -299}
+, {552, 752, 152}
+, {7, -465, -247}
+, {84, -27, -285}
+, {-150, -179, -131}
+, {-140, 147, 2}
+, {-312, 176, -309}
+, {76, -155, 206}
+, {-195, 208, 53}
+, {-18, -436, -243}
+, {257, 27, 56}
+, {-334, 284, -213}
+, {338, -387, 36}
+, {-16, -267, 309}
+, {365, 226, -311}
+, {-35, 496, -102}
+, {-30, -385, 129}
+, {203, -36, -220}
+, {278, 177, -244}
+, {-223, 257, -143}
+, {408, -257, -108}
+, {-74, 420, -125}
+, {-105, 412, -279}
+, {-201, 485, 312}
+, {165, 140, 209}
+, {-338, -413, -270}
+, {-43, 141, -234}
+, {-204, 96, -166}
+, {-78, -107, 93}
+, {6, 345, 434}
+, {65, 42, 111}}
+, {{67, -148, -282}
+, {-374, -70, 117}
+, {-437, 185, -133}
+, {73, 73, -12}
+, {103, -308, 459}
+, {23, 116, -57}
+, {248, 9, 146}
+, {-237, -169, 123}
+, {-310, -356, 1}
+, {140, 99, 151}
+, {25, -296, 156}
+, {81, 383, 305}
+, {118, -234, 144}
+, {-398, 368, -252}
+, {247, 155, 181}
+, {-69, 333, 197}
+, {230, -224, -334}
+, {-437, 2, -361}
+, {140, 340, -141}
+, {-213, 11, 53}
+, {-278, -64, 413}
+, {-224, 277, -17}
+, {334, 239, -157}
+, {332, -336, 260}
+, {-28, 189, 222}
+, {-314, 206, -511}
+, {433, 383, 71}
+, {78, 40, -260}
+, {456, 252, -396}
+, {-165, -182, 267}
+, {441, 205, -231}
+, {-264, -328, -174}
+, {-360, 349, -338}
+, {-244, 8, -98}
+, {-183, -408, 183}
+, {207, -257, -248}
+, {-135, -33, -136}
+, {-20, -176, 31}
+, {-271, -135, 262}
+, {-148, -208, 215}
+, {5, 368, 210}
+, {80, 319, 111}
+, {452, 364, -397}
+, {-4, -218, -412}
+, {160, 150, 86}
+, {-332, -487, -356}
+, {338, 444, 132}
+, {-3, -189, 202}
+, {-25, -324, 265}
+, {181, 572, 205}
+, {-94, 341, 52}
+, {-98, -159, -47}
+, {-11, 19, -296}
+, {-457, -121, -356}
+, {388, -197, -256}
+, {-225, 426, 302}
+, {242, -219, 459}
+, {29, 340, 102}
+, {-1, -87, -257}
+, {-321, -406, -12}
+, {-18, 157, -77}
+, {38, 219, -246}
+, {-114, 416, 308}
+, {294, -357, -259}}
+, {{-107, -289, -138}
+, {315, -179, 47}
+, {186, -248, -137}
+, {27, -295, -196}
+, {-29, 402, -4}
+, {393, -2, 145}
+, {-250, -157, 394}
+, {-59, 469, 233}
+, {111, 492, 168}
+, {-10, -358, -288}
+, {278, 61, 303}
+, {-1, -261, 31}
+, {-279, 405, -183}
+, {-106, 450, -186}
+, {-27, -144, 91}
+, {160, 278, 415}
+, {-325, -50, -149}
+, {214, 450, -370}
+, {-293, 199, -262}
+, {-348, -358, 105}
+, {-78, -38, -72}
+, {-260, 236, -407}
+, {-186, -68, -371}
+, {-133, -44, 239}
+, {-28, -230, -572}
+, {386, 262, -207}
+, {431, 91, 160}
+, {386, -5, -166}
+, {288, -220, 215}
+, {202, -123, -8}
+, {540, 346, 167}
+, {-452, 505, 341}
+, {106, -241, 44}
+, {186, 436, 198}
+, {69, 289, 222}
+, {438, 503, 509}
+, {-348, 218, 362}
+, {349, -254, -73}
+, {-363, 274, -494}
+, {403, -217, 132}
+, {-181, -322, 21}
+, {121, -5, -136}
+, {-242, -322, -246}
+, {-224, 20, 196}
+, {358, 482, -272}
+, {184, -225, -141}
+, {-11, 199, -382}
+, {-4, 269, 86}
+, {-181, -266, 283}
+, {-398, -188, -152}
+, {32, 40, 32}
+, {-109, -388, -275}
+, {199, -198, -368}
+, {78, -41, -13}
+, {-177, 332, 327}
+, {-268, -234, -272}
+, {-341, 60, 152}
+, {195, -442, 136}
+, {119, 382, -77}
+, {-74, 243, 319}
+, {-212, 60, 335}
+, {84, 92, -96}
+, {-319, -359, 204}
+, {269, -62, -116}}
+, {{318, 357, 133}
+, {129, 185, -6}
+, {-52, 70, 45}
+, {-219, 33, 221}
+, {-391, -117, -408}
+, {-469, 116, -460}
+, {-309, 210, -239}
+, {21, -96, 170}
+, {339, 161, -59}
+, {368, 113, 162}
+, {-19, -25, -51}
+, {-26, -189, -173}
+, {-310, 356, -324}
+, {-42, -133, 173}
+, {60, 76, 98}
+, {112, 285, -192}
+, {-351, -260, -303}
+, {-199, 180, -41}
+, {-277, -226, 86}
+, {296, 276, 128}
+, {-48, -143, -425}
+, {33, -75, -140}
+, {416, 183, 253}
+, {452, 55, 467}
+, {-217, -111, 233}
+, {126, 43, -268}
+, {382, -240, -326}
+, {371, 388, 32}
+, {-195, -356, 150}
+, {162, 238, 130}
+, {27, -308, 75}
+, {-137, -302, -173}
+, {151, -117, 221}
+, {-398, 211, -283}
+, {486, 374, -156}
+, {243, 70, 1}
+, {412, -45, 417}
+, {335, 132, 164}
+, {-280, 419, -60}
+, {16, -85, 195}
+, {200, 87, -313}
+, {-59, -158, 98}
+, {42, -394, -16}
+, {202, -121, 347}
+, {400, 161, -246}
+, {-40, -44, 225}
+, {-147, 12, 289}
+, {-220, -113, -85}
+, {64, 58, 305}
+, {-35, -9, -423}
+, {-65, -358, 12}
+, {-181, -413, 138}
+, {-372, 209, 293}
+, {170, 307, -154}
+, {-237, -84, 142}
+, {432, -347, 98}
+, {251, -360, 172}
+, {-303, 42, -195}
+, {-456, -89, 246}
+, {182, 402, 114}
+, {-296, -274, -56}
+, {-374, 9, -93}
+, {395, -44, 257}
+, {443, -185, 105}}
+, {{188, -93, -254}
+, {-5, 291, -95}
+, {-9, -26, 38}
+, {-157, -347, -136}
+, {39, -316, 138}
+, {71, 280, -327}
+, {339, 166, -79}
+, {23, -37, 258}
+, {-346, 292, 70}
+, {-63, 21, -180}
+, {-111, 270, -23}
+, {26, -37, 152}
+, {-181, 30, -75}
+, {299, 424, -305}
+, {-322, -258, 255}
+, {-321, 303, 357}
+, {36, -234, 185}
+, {124, -322, -209}
+, {-325, -54, -93}
+, {436, 264, 352}
+, {21, 126, -96}
+, {391, -78, 218}
+, {161, 90, 402}
+, {-284, -402, 315}
+, {-329, 190, 56}
+, {-115, 398, -215}
+, {-2, -450, -266}
+, {-237, -78, -300}
+, {-222, 9, 292}
+, {187, -111, -225}
+, {359, 46, 430}
+, {-173, -382, -419}
+, {-135, -62, -3}
+, {-309, -317, 179}
+, {260, 302, 287}
+, {110, 152, -219}
+, {-283, 36, 255}
+, {-104, 383, 128}
+, {-112, -23, 24}
+, {-179, 149, 28}
+, {-382, 230, 407}
+, {-379, -38, -315}
+, {-153, 152, 88}
+, {-68, -405, 439}
+, {197, -73, 300}
+, {142, 387, 348}
+, {-173, 322, -139}
+, {-60, 32, 221}
+, {-233, 16, -136}
+, {-30, -388, -186}
+, {5, 240, -31}
+, {290, -274, -375}
+, {257, 149, 17}
+, {381, -186, -198}
+, {286, 351, 285}
+, {337, 58, 201}
+, {403, 373, 353}
+, {-96, -214, -287}
+, {-546, 114, 153}
+, {-293, 401, 58}
+, {37, 264, 318}
+, {-75, 280, 143}
+, {75, 272, 63}
+, {73, 303, 417}}
+, {{-104, -362, 279}
+, {-301, 90, -29}
+, {429, -15, 433}
+, {-29, -64, 246}
+, {400, 94, 208}
+, {226, 211, -278}
+, {350, 362, 355}
+, {257, -14, 11}
+, {381, 515, -61}
+, {184, -501, -201}
+, {-434, -250, 231}
+, {-295, 187, 225}
+, {85, 355, 60}
+, {139, -292, 197}
+, {-267, -352, 190}
+, {71, 245, -191}
+, {-33, 222, 159}
+, {-348, -355, -175}
+, {196, -138, -306}
+, {-297, -70, 179}
+, {374, -316, 432}
+, {-48, 150, -234}
+, {-56, 280, 198}
+, {-40, -11, -111}
+, {166, 314, 120}
+, {348, 72, 209}
+, {-195, -215, 15}
+, {-67, 402, 25}
+, {-91, 41, -355}
+, {-413, -117, -214}
+, {-77, 241, 337}
+, {400, -14, 124}
+, {-128, -464, 186}
+, {254, -313, 72}
+, {287, 489, -43}
+, {-333, -138, 272}
+, {-438, 265, 434}
+, {-380, 90, -360}
+, {-291, 105, 49}
+, {370, 228, 375}
+, {264, -290, 74}
+, {-432, -268, -439}
+, {68, -413, -73}
+, {230, 46, -98}
+, {29, 280, 202}
+, {428, -245, 117}
+, {-162, -197, -224}
+, {-115, -77, -325}
+, {252, 88, 105}
+, {-207, -396, 177}
+, {-250, -29, 266}
+, {-347, -356, 94}
+, {-307, -167, 251}
+, {74, -207, -85}
+, {-51, 89, -275}
+, {-406, -264, 223}
+, {-24, -27, -349}
+, {-54, 261, 210}
+, {-379, -99, -73}
+, {-117, 298, 394}
+, {28, -170, 336}
+, {-122, -299, -12}
+, {210, -370, -400}
+, {-359, 369, -2}}
+, {{-265, -66, -405}
+, {38, 31, 179}
+, {76, -248, 142}
+, {245, 33, -192}
+, {-411, 316, -35}
+, {159, -241, 172}
+, {393, 196, -371}
+, {64, 325, -100}
+, {-387, -95, -24}
+, {-426, -475, 25}
+, {-359, 384, 371}
+, {-94, 89, -330}
+, {187, -90, 290}
+, {79, -100, 301}
+, {240, 281, 286}
+, {22, -19, -23}
+, {129, 209, -253}
+, {-199, 112, -385}
+, {-151, -115, 186}
+, {-73, -5, 56}
+, {-91, -4, -8}
+, {-55, 471, -340}
+, {-302, 50, -96}
+, {142, 90, -339}
+, {173, -4, 288}
+, {126, 328, 172}
+, {-44, -80, -8}
+, {322, 222, 276}
+, {332, 242, -353}
+, {-159, -330, 193}
+, {46, 95, 187}
+, {165, 232, -168}
+, {27, -135, -275}
+, {36, -223, -189}
+, {298, 288, -243}
+, {130, -131, 211}
+, {221, 374, 194}
+, {-12, -287, 331}
+, {-60, -281, 28}
+, {-226, -312, 240}
+, {48, -319, -342}
+, {92, 300, 64}
+, {275, -71, 369}
+, {-365, -265, -399}
+, {-340, -198, 18}
+, {3, -161, 111}
+, {162, 224, -175}
+, {186, 348, 114}
+, {-164, -92, 482}
+, {-324, -266, 65}
+, {381, 211, 107}
+, {278, -399, -394}
+, {72, 260, -20}
+, {75, 425, -135}
+, {-310, -249, -449}
+, {208, 359, -160}
+, {99, 376, 412}
+, {194, 104, -238}
+, {-79, -34, -118}
+, {108, -33, -386}
+, {364, 5, -145}
+, {391, 159, -323}
+, {297, -153, -272}
+, {-278, -302, 342}}
+, {{275, -232, 17}
+, {145, -178, -297}
+, {488, 87, 311}
+, {401, 350, 243}
+, {-204, -82, -161}
+, {-168, 316, 300}
+, {-71, -96, 12}
+, {-381, -183, -368}
+, {-457, 504, -157}
+, {-255, -424, 440}
+, {-270, -260, 384}
+, {-418, -223, -276}
+, {-345, -333, 249}
+, {-333, 23, 36}
+, {85, 393, -177}
+, {132, 55, -168}
+, {148, -68, -222}
+, {-205, -167, 297}
+, {333, -404, 269}
+, {-3, 203, -170}
+, {92, -274, 292}
+, {41, 395, 154}
+, {94, 104, 167}
+, {259, -132, -321}
+, {77, 300, -408}
+, {507, 34, -157}
+, {276, 338, 281}
+, {369, -367, -229}
+, {301, 290, -147}
+, {-175, 301, -206}
+, {381, 183, 276}
+, {-275, -437, 69}
+, {67, -199, 397}
+, {118, -371, -24}
+, {132, 118, 384}
+, {316, 89, 619}
+, {310, 162, -280}
+, {286, -183, 80}
+, {303, 408, 281}
+, {329, -142, 179}
+, {-431, -291, 464}
+, {133, -351, -346}
+, {-280, -189, -74}
+, {352, -64, -395}
+, {-197, 127, -18}
+, {170, -122, 185}
+, {-71, 369, 65}
+, {-147, -140, -372}
+, {93, 204, 311}
+, {-553, 165, 109}
+, {175, 77, 48}
+, {-446, -87, 46}
+, {139, 395, 139}
+, {252, 535, -381}
+, {405, -293, 83}
+, {448, -120, 122}
+, {-84, 144, -302}
+, {-243, 71, 142}
+, {360, -71, 267}
+, {74, 61, 155}
+, {141, 47, 196}
+, {251, -131, -193}
+, {-257, -287, 330}
+, {-71, -357, -181}}
+, {{276, -277, -418}
+, {174, 52, -308}
+, {98, -529, -20}
+, {355, -100, 407}
+, {-410, 387, 256}
+, {-437, 223, -160}
+, {333, -129, 412}
+, {15, -248, -382}
+, {-156, -308, -338}
+, {178, -374, 234}
+, {237, 85, -180}
+, {-42, 162, -282}
+, {-232, -263, 311}
+, {-20, -243, -18}
+, {-232, -359, 103}
+, {122, -38, -93}
+, {-401, 114, -211}
+, {-275, -37, -434}
+, {-186, 116, 191}
+, {-406, 137, -290}
+, {401, -154, 372}
+, {-341, -26, -205}
+, {156, -78, -59}
+, {191, 44, -68}
+, {245, -274, 301}
+, {-131, -456, -5}
+, {118, 345, -165}
+, {69, 31, 115}
+, {-70, 162, -422}
+, {-249, 343, 227}
+, {-360, -23, -161}
+, {-439, 330, 123}
+, {-362, 378, 260}
+, {-11, 414, 307}
+, {118, 168, 282}
+, {-431, -218, -36}
+, {-307, 99, -340}
+, {-342, -244, 275}
+, {-395, 248, 105}
+, {-341, -89, -233}
+, {-220, 190, -137}
+, {527, 494, 174}
+, {433, 417, -30}
+, {-369, -10, 37}
+, {428, 22, -236}
+, {-126, 184, -441}
+, {-275, 313, 404}
+, {194, -234, -87}
+, {-359, 214, 481}
+, {431, -57, 408}
+, {-317, 236, 361}
+, {-239, 175, -478}
+, {106, -74, 277}
+, {-356, 131, -249}
+, {-275, 314, 319}
+, {-293, -162, -134}
+, {-12, 298, 122}
+, {-435, -95, 285}
+, {-21, 16, -81}
+, {88, -333, 304}
+, {48, -158, 401}
+, {216, 261, -227}
+, {326, -87, 376}
+, {-155, 305, 309}}
+, {{-268, 21, -133}
+, {111, -32, 345}
+, {-170, 182, 23}
+, {166, 217, 217}
+, {381, -334, 225}
+, {-345, -132, 35}
+, {-176, -168, 127}
+, {-425, 6, -363}
+, {-30, 118, -91}
+, {-251, 407, 415}
+, {-3, 491, -91}
+, {528, -287, 103}
+, {-60, -371, -95}
+, {266, 2, 118}
+, {-257, -180, -106}
+, {-117, -46, 402}
+, {356, -378, -340}
+, {357, 313, 55}
+, {-229, -217, 291}
+, {362, 13, 74}
+, {304, -409, -408}
+, {-554, 188, -106}
+, {-364, -332, 51}
+, {-303, -225, 146}
+, {-343, 212, -52}
+, {-97, -160, -300}
+, {486, 283, 376}
+, {-338, -18, -176}
+, {329, -130, 304}
+, {-187, -258, 156}
+, {-140, 268, 281}
+, {225, 262, 317}
+, {78, 505, -312}
+, {351, 393, -76}
+, {-147, -131, 12}
+, {170, 176, 401}
+, {121, 190, -74}
+, {151, 253, 15}
+, {-147, -80, -353}
+, {10, -244, 472}
+, {-70, 67, -29}
+, {2, -113, -112}
+, {55, -25, 193}
+, {-227, 20, 30}
+, {220, 351, 226}
+, {-226, -310, -373}
+, {-172, 191, 93}
+, {540, 372, 247}
+, {-265, -243, 159}
+, {351, -153, 139}
+, {252, -139, 67}
+, {183, 222, -182}
+, {-467, 20, 213}
+, {-68, 341, -307}
+, {-334, -41, -272}
+, {-111, -48, 197}
+, {257, -195, -77}
+, {-119, -30, -223}
+, {441, 407, 368}
+, {-219, 313, 82}
+, {101, 137, -103}
+, {-336, 256, 202}
+, {70, 318, -249}
+, {184, 191, 186}}
+, {{127, 51, -62}
+, {187, 379, -336}
+, {215, -327, 242}
+, {205, 88, 76}
+, {-18, -326, 359}
+, {73, -4, -210}
+, {-33, 491, 74}
+, {389, 197, -95}
+, {154, 350, -269}
+, {104, 277, 410}
+, {70, -107, -73}
+, {184, -185, 128}
+, {301, -171, 117}
+, {411, 505, 87}
+, {447, 13, 219}
+, {-318, 452, -290}
+, {-97, -41, 257}
+, {188, -163, 151}
+, {331, -332, -8}
+, {-156, -292, 85}
+, {191, 302, -96}
+, {213, -156, -341}
+, {-135, -327, -393}
+, {-155, 103, -196}
+, {-666, -5, -315}
+, {293, 184, -19}
+, {-15, -25, -220}
+, {-332, -293, -158}
+, {-22, 94, -304}
+, {247, -148, -282}
+, {-145, -78, 532}
+, {434, -429, 373}
+, {202, -358, 39}
+, {314, 0, -283}
+, {159, -94, -13}
+, {190, 207, 93}
+, {141, 422, -223}
+, {401, 309, 97}
+, {-161, -59, -453}
+, {206, 254, -89}
+, {-29, 26, -279}
+, {-23, -478, 187}
+, {389, 296, 4}
+, {280, -354, 361}
+, {422, -70, 130}
+, {-202, 23, 108}
+, {9, -233, 275}
+, {-296, -220, 104}
+, {-288, -3, 159}
+, {218, -93, -228}
+, {94, 47, -1}
+, {-241, -153, -386}
+, {-290, 222, -347}
+, {204, -265, -375}
+, {204, 65, 415}
+, {-358, 19, -60}
+, {-5, -188, -301}
+, {226, -269, -222}
+, {338, 212, -300}
+, {-3, -120, -288}
+, {-6, -89, 449}
+, {366, -31, 73}
+, {254, 78, 396}
+, {-240, 371, 115}}
+, {{47, 45, -129}
+, {266, -135, -359}
+, {-288, 404, 606}
+, {78, 20, 283}
+, {-231, 357, 208}
+, {195, 19, -244}
+, {413, -351, -97}
+, {406, -396, 66}
+, {-159, -179, 101}
+, {-473, -325, -312}
+, {313, -120, -343}
+, {365, -332, -164}
+, {238, -385, -109}
+, {-171, 469, 157}
+, {424, 195, 142}
+, {10, -177, 160}
+, {-6, 358, 338}
+, {76, -322, 213}
+, {-164, 8, -437}
+, {271, 68, 185}
+, {463, 423, 105}
+, {-95, 309, -289}
+, {-61, 44, -120}
+, {-97, -322, -367}
+, {32, -135, 219}
+, {-29, 333, -315}
+, {-147, -112, 172}
+, {-90, -366, 207}
+, {139, -367, -34}
+, {-514, 296, -159}
+, {255, 461, 107}
+, {377, 101, -554}
+, {-344, -302, -336}
+, {-324, -119, -382}
+, {167, -106, 67}
+, {143, 34, 438}
+, {-228, 257, 92}
+, {-87, 205, -308}
+, {216, 303, 4}
+, {-71, -105, 67}
+, {236, 408, -169}
+, {-285, -173, -312}
+, {-185, -390, -165}
+, {467, 407, -333}
+, {404, 42, -334}
+, {431, 423, 83}
+, {438, -45, -51}
+, {268, -125, 354}
+, {-171, -150, -346}
+, {-200, 240, -233}
+, {223, -28, -281}
+, {-86, 364, 146}
+, {22, 109, -365}
+, {-150, 306, 445}
+, {138, -348, -18}
+, {-178, -233, -205}
+, {-149, 361, 282}
+, {294, -58, -322}
+, {354, -279, -428}
+, {226, -262, -23}
+, {-321, -16, 300}
+, {-205, -235, 412}
+, {264, -272, 50}
+, {360, -192, 329}}
+, {{200, -349, -177}
+, {-39, 68, 189}
+, {20, -180, -73}
+, {-183, -261, 72}
+, {85, 188, 176}
+, {-406, 194, -486}
+, {181, -142, 6}
+, {84, 68, 133}
+, {361, -323, -133}
+, {262, -332, 41}
+, {394, -90, 45}
+, {362, 167, -133}
+, {-125, 273, -106}
+, {-299, 219, -357}
+, {-3, -161, 20}
+, {65, -128, -97}
+, {333, -6, -361}
+, {-538, 166, 312}
+, {42, 441, 188}
+, {54, 322, 207}
+, {-402, 44, -400}
+, {308, 294, 3}
+, {20, -86, 233}
+, {323, -171, 259}
+, {47, 238, 321}
+, {170, 109, 260}
+, {299, 110, -153}
+, {260, 364, -254}
+, {296, -316, -191}
+, {-231, -381, 348}
+, {213, -415, 117}
+, {391, -165, -294}
+, {186, 417, 343}
+, {240, -343, 29}
+, {-103, -259, 464}
+, {-368, -268, 148}
+, {133, 288, 275}
+, {105, 70, -267}
+, {-182, -16, 226}
+, {288, 10, -97}
+, {-219, 278, -364}
+, {-278, 448, -202}
+, {-29, -152, 44}
+, {265, -34, 186}
+, {-68, 287, 18}
+, {-184, -211, -288}
+, {425, 326, -237}
+, {302, 53, -193}
+, {-333, -39, 418}
+, {-121, 167, -20}
+, {144, -162, 281}
+, {16, 47, 117}
+, {-223, -91, -394}
+, {216, -228, -220}
+, {200, 105, -346}
+, {27, -479, -431}
+, {309, 321, -225}
+, {-163, -167, 91}
+, {176, -210, 64}
+, {292, 394, 327}
+, {-191, 219, 143}
+, {-367, 348, 427}
+, {74, -269, 136}
+, {-157, 107, -286}}
+, {{221, -275, -145}
+, {-192, -289, -374}
+, {-175, -417, 117}
+, {-205, -38, 384}
+, {-31, -311, 385}
+, {-388, 53, 19}
+, {-77, 259, -259}
+, {-282, 338, -54}
+, {-32, 145, 252}
+, {35, -73, -175}
+, {-277, -371, -425}
+, {353, -287, 401}
+, {-401, -343, 219}
+, {171, -74, -49}
+, {-494, -387, -402}
+, {-240, 135, 117}
+, {31, -50, 269}
+, {-479, -625, -265}
+, {61, 404, 313}
+, {278, 270, -85}
+, {-362, -242, -112}
+, {-347, -13, -209}
+, {262, -274, 315}
+, {212, 362, 200}
+, {146, 17, -232}
+, {-293, 284, -425}
+, {-354, 177, -53}
+, {-181, -318, 363}
+, {-99, -317, -82}
+, {66, -188, -335}
+, {182, -359, 278}
+, {-38, -72, -441}
+, {66, -156, -367}
+, {-169, 59, -199}
+, {507, -287, -229}
+, {-78, -365, -296}
+, {-260, -175, -238}
+, {303, 475, -309}
+, {353, 60, -45}
+, {-276, 22, -365}
+, {-35, 30, -44}
+, {257, 255, -132}
+, {-37, 80, 340}
+, {229, -83, -319}
+, {302, -75, 294}
+, {328, 214, 362}
+, {-43, -120, -376}
+, {-211, -438, -408}
+, {145, -7, 13}
+, {-138, -147, 331}
+, {-111, 331, -275}
+, {-182, 182, -208}
+, {360, -10, 94}
+, {-236, 418, 12}
+, {-287, 331, -65}
+, {-501, -247, -353}
+, {138, 368, 94}
+, {-128, -312, -395}
+, {-255, -550, 89}
+, {75, 285, 446}
+, {411, 453, 157}
+, {-94, -371, 395}
+, {400, 352, 317}
+, {-114, 387, -308}}
+, {{270, -217, -251}
+, {418, 41, 437}
+, {-383, -271, -369}
+, {-85, -293, 15}
+, {218, -51, -211}
+, {135, 134, -346}
+, {-4, -390, 301}
+, {55, 8, -242}
+, {190, -268, -335}
+, {86, -353, -276}
+, {-238, 257, 387}
+, {433, -416, -299}
+, {-271, 356, 222}
+, {-145, 229, 394}
+, {364, 323, 287}
+, {-310, 289, 203}
+, {38, 228, 318}
+, {-375, -25, -41}
+, {-420, -74, -326}
+, {131, 146, 367}
+, {-230, 407, 19}
+, {83, -128, 267}
+, {-68, 241, -276}
+, {196, -126, -139}
+, {138, -221, -549}
+, {17, -139, 263}
+, {-189, -66, 525}
+, {160, -374, -94}
+, {459, 217, -18}
+, {399, -397, 106}
+, {289, 261, -91}
+, {-299, -156, 18}
+, {302, 493, 305}
+, {150, -29, 73}
+, {-97, -108, -94}
+, {146, 304, 189}
+, {141, 260, 441}
+, {174, 181, -378}
+, {-21, -285, -384}
+, {-114, -287, -249}
+, {-370, 437, -378}
+, {-315, -35, 278}
+, {-47, -36, -107}
+, {-330, -348, -101}
+, {140, -341, 244}
+, {-245, 90, 296}
+, {-92, 412, 48}
+, {344, 222, 269}
+, {319, -83, 126}
+, {13, -135, 91}
+, {204, 317, -51}
+, {363, -200, 110}
+, {-120, -220, 239}
+, {58, 56, -415}
+, {105, 158, 305}
+, {-158, 124, -25}
+, {-41, 320, -88}
+, {-326, -380, 63}
+, {-7, 472, 166}
+, {-340, 186, 324}
+, {238, 126, -373}
+, {41, 101, 140}
+, {-428, -344, 347}
+, {-370, 405, 99}}
+, {{109, -84, 234}
+, {167, 32, 110}
+, {-324, 147, -78}
+, {-278, -168, 204}
+, {-386, 260, 316}
+, {-383, -397, -38}
+, {309, -173, 77}
+, {302, -151, 348}
+, {63, 48, 2}
+, {96, 178, 137}
+, {133, 377, -238}
+, {322, -205, 384}
+, {-317, 405, -51}
+, {45, -327, 64}
+, {302, 116, -182}
+, {367, -267, -367}
+, {302, 55, -388}
+, {-244, 544, 406}
+, {-12, 395, -356}
+, {106, -286, 281}
+, {-117, -239, -324}
+, {272, -304, -453}
+, {373, 50, -71}
+, {294, 327, -194}
+, {306, -297, -125}
+, {53, 111, 256}
+, {-61, -169, -203}
+, {-66, 89, -85}
+, {-175, 334, 315}
+, {-224, -265, 362}
+, {175, -48, -533}
+, {399, -39, -320}
+, {316, 188, 99}
+, {-82, -70, -193}
+, {106, -102, 137}
+, {70, -297, 398}
+, {88, 360, 140}
+, {368, 295, -88}
+, {253, 88, -195}
+, {342, -253, 115}
+, {-85, -131, -214}
+, {241, 243, 250}
+, {-171, -337, 169}
+, {-402, 114, 88}
+, {381, 263, 345}
+, {-189, -251, 235}
+, {155, -115, -163}
+, {-424, 87, -371}
+, {-102, 47, 130}
+, {467, -164, 364}
+, {112, 113, 266}
+, {1, -84, 160}
+, {270, -169, -125}
+, {-19, 300, 263}
+, {-191, 84, -42}
+, {0, 453, -14}
+, {-102, -110, -57}
+, {187, 181, -84}
+, {-331, 327, 452}
+, {-215, 199, 294}
+, {226, -5, 253}
+, {18, -287, -344}
+, {-334, 186, -80}
+, {-387, -106, 26}}
+, {{-265, 5, -231}
+, {-300, 8, 363}
+, {-237, -162, -382}
+, {207, -334, -385}
+, {276, 206, -335}
+, {253, -98, -460}
+, {120, 347, 185}
+, {217, -74, 139}
+, {18, -203, -65}
+, {-260, 428, 184}
+, {-44, -349, -445}
+, {336, 281, -97}
+, {-214, -314, 84}
+, {505, 401, -242}
+, {272, 366, -192}
+, {74, 27, -220}
+, {-375, -305, -263}
+, {197, 303, 303}
+, {394, 42, -174}
+, {85, -199, 29}
+, {59, 51, -81}
+, {-47, 191, 203}
+, {-166, 105, -192}
+, {412, -285, 182}
+, {408, 128, 173}
+, {-339, 175, 197}
+, {-302, 172, -304}
+, {26, 150, -347}
+, {-214, -302, 23}
+, {448, 105, 165}
+, {106, 62, -345}
+, {189, -301, -409}
+, {-288, 154, 133}
+, {372, -282, -115}
+, {-171, -265, -130}
+, {354, 264, -207}
+, {287, 269, -110}
+, {-391, -181, 358}
+, {-12, -250, -179}
+, {95, 17, -206}
+, {8, -434, -90}
+, {-402, -350, -343}
+, {213, -263, 84}
+, {374, -14, 120}
+, {496, 40, -320}
+, {388, 284, -102}
+, {-340, -389, -431}
+, {130, 254, -45}
+, {373, 7, 384}
+, {3, -7, -336}
+, {-101, -51, 117}
+, {-78, 18, 16}
+, {129, 70, -380}
+, {-149, -390, -145}
+, {534, 80, 6}
+, {40, -285, -67}
+, {378, 410, 32}
+, {100, -190, -73}
+, {-375, -488, -473}
+, {-269, -260, 100}
+, {21, -369, -176}
+, {118, 191, 120}
+, {82, -19, -185}
+, {-306, 366, 342}}
+, {{-213, 204, 342}
+, {-19, -164, 170}
+, {-461, 415, 161}
+, {-165, -213, 308}
+, {-13, 281, -333}
+, {310, 323, 193}
+, {342, 357, 205}
+, {-239, -122, -239}
+, {-29, -188, -272}
+, {-313, -166, -336}
+, {-142, 176, -419}
+, {213, 335, -462}
+, {-347, -137, 326}
+, {-264, -343, -33}
+, {210, 293, 67}
+, {-258, -148, 159}
+, {-108, -27, 379}
+, {-526, -19, 46}
+, {-344, -121, -250}
+, {388, 481, 118}
+, {-131, 47, 199}
+, {-328, 141, -320}
+, {243, 189, 362}
+, {345, -170, -235}
+, {-228, -337, 333}
+, {340, -204, 285}
+, {198, -396, -416}
+, {79, -306, 26}
+, {-186, -11, -83}
+, {-234, 6, -143}
+, {320, 422, -73}
+, {-141, -183, 397}
+, {-344, -355, -413}
+, {-140, 244, -220}
+, {181, -308, -147}
+, {-49, 350, 182}
+, {38, -187, -120}
+, {-56, 334, 54}
+, {-5, 303, -168}
+, {-381, 534, -386}
+, {-81, 422, 202}
+, {135, 192, 308}
+, {15, 102, 246}
+, {-294, 379, 352}
+, {-172, -302, -62}
+, {-149, 27, 238}
+, {-308, 222, 110}
+, {-297, 170, -204}
+, {239, -287, 40}
+, {206, 421, -30}
+, {-17, -224, -202}
+, {488, 73, 540}
+, {312, -186, 463}
+, {30, -311, -169}
+, {92, 53, 217}
+, {-239, 303, -455}
+, {243, -73, 144}
+, {39, 583, 462}
+, {-40, -572, -194}
+, {-366, -50, 428}
+, {-224, 507, -72}
+, {-228, 112, -132}
+, {-271, 196, 277}
+, {-80, -281, -218}}
+, {{154, -213, -94}
+, {-274, 48, 285}
+, {-72, -279, -439}
+, {-114, 246, -412}
+, {-70, 208, -60}
+, {-94, -94, -241}
+, {238, -167, 247}
+, {-261, 325, 46}
+, {108, 312, -165}
+, {-388, 162, -164}
+, {120, 66, 329}
+, {-266, -207, 183}
+, {394, 363, -240}
+, {82, -302, -299}
+, {474, -465, 398}
+, {-11, -249, -395}
+, {501, 177, 524}
+, {-416, 122, 182}
+, {-4, 29, 459}
+, {-179, 265, -93}
+, {193, 419, -38}
+, {-238, -352, -459}
+, {47, 326, -309}
+, {139, 313, 22}
+, {-11, -62, -64}
+, {301, -383, 221}
+, {-307, -45, -71}
+, {-74, 224, 90}
+, {261, 304, 421}
+, {-103, -372, -274}
+, {-100, 93, -150}
+, {-15, -444, -151}
+, {73, -14, 257}
+, {-207, -292, -275}
+, {72, 373, -85}
+, {-101, -14, -466}
+, {-114, 199, 481}
+, {30, -81, 349}
+, {-382, 464, -91}
+, {-121, -83, -372}
+, {241, -246, 57}
+, {154, -42, -24}
+, {-322, -153, -120}
+, {-128, -501, -44}
+, {-55, 191, 271}
+, {531, -314, -158}
+, {-256, 270, 168}
+, {-370, -227, 353}
+, {-375, 119, 91}
+, {-76, 520, -101}
+, {338, -138, 81}
+, {444, -401, -244}
+, {408, -80, 355}
+, {-174, 230, -340}
+, {-16, -291, -68}
+, {141, 103, 107}
+, {-403, 213, 148}
+, {-141, -137, -126}
+, {22, -284, -498}
+, {-306, -316, -287}
+, {354, 368, 250}
+, {-256, -2, 286}
+, {-354, 77, 381}
+, {216, 105, 205}}
+, {{11, 248, 172}
+, {82, 368, 382}
+, {-351, 314, 135}
+, {-152, -109, -244}
+, {61, 359, -350}
+, {-94, 68, -117}
+, {131, -372, 151}
+, {97, -66, -295}
+, {359, -349, 375}
+, {-231, 469, 218}
+, {5, -219, 46}
+, {85, 101, 282}
+, {-15, -378, 345}
+, {-120, -121, -52}
+, {249, -55, 170}
+, {365, -197, -108}
+, {182, 160, -248}
+, {123, 494, -191}
+, {-374, 327, 369}
+, {-99, -154, 65}
+, {249, 266, 369}
+, {-33, -149, -562}
+, {30, -199, 292}
+, {-308, -123, 182}
+, {-189, -29, -56}
+, {-116, 241, 442}
+, {342, -168, -176}
+, {101, -328, 315}
+, {527, -236, 407}
+, {451, -52, 209}
+, {-336, 381, 12}
+, {171, -89, 8}
+, {152, -13, 181}
+, {-60, -13, 37}
+, {308, 113, -338}
+, {7, -215, -53}
+, {50, -249, 134}
+, {-316, 5, -6}
+, {-159, 348, -410}
+, {119, 317, -255}
+, {-149, 150, -124}
+, {46, 57, -141}
+, {-352, -199, 386}
+, {-6, 207, -77}
+, {-310, 395, 180}
+, {451, -71, -163}
+, {-341, 169, -404}
+, {-227, -319, 173}
+, {248, -200, 124}
+, {-110, 122, 359}
+, {-391, 131, -33}
+, {691, -76, 646}
+, {-340, -108, -210}
+, {140, -183, 6}
+, {-112, 79, 154}
+, {411, -160, 310}
+, {-7, -267, -67}
+, {366, 423, -41}
+, {223, -23, 184}
+, {-186, -84, -337}
+, {153, -93, -370}
+, {357, -192, -195}
+, {198, -148, 80}
+, {-18, -317, 409}}
+, {{-3, 456, -179}
+, {-441, -121, 301}
+, {-193, -23, -298}
+, {235, 330, 141}
+, {308, -285, 135}
+, {-384, 0, -343}
+, {-327, 32, -25}
+, {-43, 314, -195}
+, {-15, 43, -193}
+, {314, 177, -118}
+, {352, 212, 450}
+, {194, 127, 309}
+, {-352, -389, -362}
+, {264, 242, -52}
+, {-180, -342, -395}
+, {129, 266, -18}
+, {169, 361, -13}
+, {-229, 63, 36}
+, {-296, 196, -381}
+, {211, 276, -57}
+, {-259, 241, 150}
+, {-58, -206, -160}
+, {300, -53, -233}
+, {107, 174, 33}
+, {392, -216, -277}
+, {285, 70, 322}
+, {578, -228, 334}
+, {116, 363, -276}
+, {-251, 300, -40}
+, {201, -225, -161}
+, {-350, 315, 350}
+, {-312, 107, 182}
+, {-324, -381, -457}
+, {307, -190, 96}
+, {23, 129, 295}
+, {91, 171, -103}
+, {-38, 37, 226}
+, {-132, -49, 164}
+, {-355, 335, -67}
+, {-89, -182, -346}
+, {325, -50, 389}
+, {338, 91, -55}
+, {376, -421, -226}
+, {-30, 298, -87}
+, {-161, -45, 110}
+, {-226, 49, -203}
+, {163, 93, 381}
+, {-423, 505, 355}
+, {-78, -174, 55}
+, {-260, 436, 168}
+, {52, 47, 307}
+, {-125, -66, 29}
+, {84, -30, 189}
+, {9, 248, -241}
+, {-336, -115, 128}
+, {381, 404, 168}
+, {-338, 8, -198}
+, {184, 240, -379}
+, {-135, 69, -472}
+, {98, -59, -122}
+, {106, -243, 87}
+, {-18, -345, 89}
+, {-368, 41, 159}
+, {-64, -11, 156}}
+, {{-195, 492, 88}
+, {-280, -107, -273}
+, {-538, 285, 272}
+, {446, -343, 266}
+, {14, -236, 374}
+, {-337, -314, -469}
+, {-291, -128, -297}
+, {205, -216, 276}
+, {167, -364, 324}
+, {400, -7, -146}
+, {15, -235, -311}
+, {-379, -172, -279}
+, {244, -48, -22}
+, {275, -431, -127}
+, {368, -274, -105}
+, {-3, -436, 197}
+, {-234, 25, 238}
+, {208, 44, 362}
+, {-201, -23, -399}
+, {-235, 251, -67}
+, {-305, 99, 256}
+, {195, 270, -126}
+, {419, 220, -195}
+, {329, 421, 258}
+, {374, 138, 441}
+, {-271, -443, -296}
+, {157, 281, -162}
+, {38, 410, 281}
+, {3, 212, -477}
+, {-259, -166, 120}
+, {312, -86, -5}
+, {-330, 68, -130}
+, {-324, 163, -31}
+, {90, 201, -217}
+, {-142, 48, 454}
+, {-337, 4, -139}
+, {420, 321, 131}
+, {-85, -200, 236}
+, {59, -302, 340}
+, {-267, 229, -239}
+, {388, 149, 159}
+, {-106, 3, -151}
+, {354, 65, -205}
+, {234, 392, -400}
+, {-57, -104, -166}
+, {-120, 396, 26}
+, {37, 387, 141}
+, {-388, -398, -433}
+, {-255, -385, -434}
+, {246, 315, 196}
+, {-234, -90, -246}
+, {24, 35, -149}
+, {-107, 159, 379}
+, {1, -283, 9}
+, {93, 257, -103}
+, {-379, -156, 247}
+, {-404, 309, 173}
+, {-156, -194, 207}
+, {-220, -82, -69}
+, {373, -396, -107}
+, {376, 285, 261}
+, {256, -260, 123}
+, {432, 330, 327}
+, {-19, -383, 174}}
+, {{-181, 81, -205}
+, {38, 383, -138}
+, {-177, 389, 256}
+, {-29, 164, -520}
+, {-419, -35, 293}
+, {390, 150, -271}
+, {26, 17, 251}
+, {303, -282, -244}
+, {154, -272, 345}
+, {-327, -95, -269}
+, {176, 301, 40}
+, {-133, -185, 335}
+, {125, 318, -397}
+, {-141, -126, 209}
+, {120, 117, -103}
+, {114, 31, 54}
+, {371, 152, -52}
+, {-309, 244, 217}
+, {379, -225, 29}
+, {384, -144, -171}
+, {-182, 360, 302}
+, {29, 361, 95}
+, {-159, -176, -91}
+, {-230, 203, -123}
+, {-470, -60, 190}
+, {-82, -127, -362}
+, {-85, -440, -339}
+, {-364, 223, 73}
+, {404, 120, 481}
+, {75, 17, 389}
+, {-81, -250, 179}
+, {-253, 400, -197}
+, {-178, 260, 253}
+, {-437, 337, 357}
+, {-298, -592, 247}
+, {-423, 331, 274}
+, {-36, -251, -178}
+, {263, 79, 323}
+, {159, -269, 8}
+, {411, 53, 262}
+, {-266, -104, -339}
+, {-22, -377, 144}
+, {314, 249, -186}
+, {121, 197, 127}
+, {288, 192, -79}
+, {442, -302, 107}
+, {-164, 179, 439}
+, {-335, 151, -164}
+, {-284, -92, 15}
+, {-256, 460, -173}
+, {-198, -278, -339}
+, {529, -324, 448}
+, {267, -234, 277}
+, {13, 133, -38}
+, {-288, -163, 72}
+, {-301, 159, -344}
+, {158, -374, -70}
+, {418, -233, 326}
+, {-244, 314, 155}
+, {169, -64, -298}
+, {379, -98, -14}
+, {175, -340, -148}
+, {129, 230, -387}
+, {-82, 171, -172}}
+, {{-338, -83, 481}
+, {40, -204, -348}
+, {-187, -271, 331}
+, {-463, -206, -447}
+, {389, 236, 0}
+, {402, 143, -197}
+, {-176, 221, -258}
+, {-7, -387, -83}
+, {6, -34, 403}
+, {316, 153, 330}
+, {-320, -332, 5}
+, {-71, -326, -382}
+, {-367, -399, 304}
+, {-331, 329, 51}
+, {241, 282, 119}
+, {-91, 403, -171}
+, {93, 136, 50}
+, {340, -355, 207}
+, {11, 152, -66}
+, {343, 198, -372}
+, {6, 407, 169}
+, {-546, 170, -443}
+, {10, -125, -299}
+, {356, 259, 310}
+, {-388, 313, 24}
+, {441, -9, -50}
+, {212, -222, -358}
+, {-235, 119, 258}
+, {109, -280, -272}
+, {-165, 441, -87}
+, {203, -296, 491}
+, {89, -347, -300}
+, {-404, -325, -289}
+, {-193, -294, -223}
+, {-5, -200, -207}
+, {-130, 414, 40}
+, {-302, -391, -53}
+, {326, 396, -372}
+, {-328, -417, -41}
+, {-3, 193, -148}
+, {50, -242, 188}
+, {199, -174, -67}
+, {-291, 164, 346}
+, {-70, -138, -140}
+, {357, -411, -76}
+, {-68, 225, 171}
+, {-341, -129, 396}
+, {-183, 170, -448}
+, {173, -134, -167}
+, {551, 412, -149}
+, {-174, -407, 267}
+, {182, 490, 418}
+, {-70, 213, 265}
+, {148, -12, -258}
+, {132, 464, -244}
+, {-25, -10, -163}
+, {209, 286, 198}
+, {275, 322, -69}
+, {-684, -472, 39}
+, {219, 424, -341}
+, {328, -323, 57}
+, {54, -360, 75}
+, {-217, 215, 384}
+, {237, -197, 291}}
+, {{383, -259, 316}
+, {-65, -197, -201}
+, {-244, 399, -437}
+, {-12, -92, 316}
+, {265, -415, -337}
+, {18, -97, -143}
+, {-13, -401, 386}
+, {-391, 103, -347}
+, {-286, -245, 322}
+, {-142, -215, -220}
+, {-177, -56, 320}
+, {-204, 5, 203}
+, {-272, 267, -200}
+, {105, -275, -205}
+, {164, -23, 329}
+, {178, -282, 409}
+, {-84, 539, 392}
+, {487, -17, -395}
+, {261, 194, -261}
+, {296, -16, -371}
+, {29, -3, -4}
+, {229, -372, 296}
+, {-161, -163, 248}
+, {-305, -403, 89}
+, {-44, 216, -100}
+, {56, -108, -208}
+, {388, 267, 475}
+, {-248, 344, 445}
+, {-280, 394, 212}
+, {52, 112, 2}
+, {-404, -68, -411}
+, {-163, 254, 364}
+, {-339, 378, 353}
+, {472, -351, 473}
+, {-340, -431, 260}
+, {-229, -282, 88}
+, {336, -28, -305}
+, {-288, 112, -353}
+, {254, -211, -239}
+, {481, 272, -431}
+, {237, -92, -160}
+, {-140, 300, 112}
+, {115, 33, 90}
+, {303, 233, -230}
+, {-104, 392, -318}
+, {119, 269, 25}
+, {203, 300, 363}
+, {132, -92, -114}
+, {-7, -569, 293}
+, {339, 179, -145}
+, {35, 344, -151}
+, {123, 12, 659}
+, {-268, -124, -6}
+, {31, -510, 99}
+, {168, 158, 262}
+, {296, 127, 282}
+, {-263, -221, -169}
+, {-2, 533, 426}
+, {-206, -85, -55}
+, {46, 204, 182}
+, {-132, 282, -372}
+, {250, 417, -157}
+, {-399, -406, -169}
+, {334, -297, -181}}
+, {{-210, -266, 442}
+, {84, 3, 89}
+, {5, -207, 80}
+, {42, -47, -361}
+, {143, -175, -6}
+, {136, -234, 176}
+, {-441, 278, -171}
+, {215, 258, -274}
+, {-60, -287, 92}
+, {460, -185, 46}
+, {331, -282, 41}
+, {422, 268, -217}
+, {-364, 14, 86}
+, {-367, -243, -139}
+, {-312, 125, -34}
+, {268, -256, 28}
+, {-266, -359, -182}
+, {315, -170, -353}
+, {140, 395, -279}
+, {-394, 365, -309}
+, {-229, -96, -28}
+, {220, -331, 396}
+, {357, 81, -39}
+, {594, -194, -114}
+, {149, 97, 500}
+, {27, 235, -305}
+, {-162, -215, -194}
+, {385, -155, 350}
+, {146, 254, -172}
+, {-48, 306, 413}
+, {207, 166, -42}
+, {-43, -377, -452}
+, {-81, -313, -208}
+, {77, -62, -359}
+, {-27, 446, 354}
+, {-37, -100, -422}
+, {-38, 326, 347}
+, {-187, 32, 41}
+, {297, 178, -208}
+, {-46, 199, -159}
+, {339, -164, 312}
+, {-349, 236, 131}
+, {187, -226, -146}
+, {-371, 378, -164}
+, {-327, 268, -305}
+, {-72, 373, -414}
+, {95, 7, -382}
+, {236, 249, -401}
+, {268, -246, 228}
+, {112, -31, 89}
+, {314, -28, -169}
+, {146, 50, -38}
+, {-315, 356, 323}
+, {369, 191, 496}
+, {374, 236, 249}
+, {-326, 406, -389}
+, {-309, -205, 13}
+, {320, 88, -353}
+, {-51, -79, -301}
+, {-36, -6, 191}
+, {423, -348, 100}
+, {178, 375, 412}
+, {175, -253, -112}
+, {228, -142, -349}}
+, {{74, -235, -115}
+, {-40, -222, -397}
+, {121, -145, -312}
+, {10, 294, 412}
+, {-400, 92, -142}
+, {-12, -236, 48}
+, {383, 190, 292}
+, {239, 135, 193}
+, {-342, 179, 410}
+, {19, 58, 326}
+, {194, -201, -451}
+, {260, -263, -336}
+, {-326, 343, 80}
+, {-383, -133, 299}
+, {300, 217, 204}
+, {38, -323, 419}
+, {355, -240, 277}
+, {-16, 44, -281}
+, {-294, -344, 337}
+, {-144, 101, -180}
+, {318, 260, 187}
+, {-21, 52, 383}
+, {-153, -37, -91}
+, {204, -215, -55}
+, {272, 262, -191}
+, {-123, 245, 352}
+, {-436, -482, 59}
+, {226, -225, -355}
+, {-132, -342, -213}
+, {103, 381, 252}
+, {-93, 183, 254}
+, {-48, -502, -332}
+, {64, -518, 132}
+, {-240, 206, 16}
+, {398, 305, 109}
+, {-67, -213, 235}
+, {-323, -69, -382}
+, {449, -142, 67}
+, {-337, 4, 50}
+, {-124, 435, -302}
+, {-310, -7, 10}
+, {17, -365, 116}
+, {211, 195, 328}
+, {221, 167, 310}
+, {228, 252, -401}
+, {-49, -310, 112}
+, {-140, -66, -486}
+, {139, 66, -431}
+, {-4, 20, -372}
+, {-341, 2, -424}
+, {143, 264, 100}
+, {-127, -277, 121}
+, {41, -250, -79}
+, {351, -181, 221}
+, {269, 284, -171}
+, {10, -196, -233}
+, {-232, 291, 277}
+, {292, 5, 138}
+, {295, 43, 193}
+, {61, 233, 395}
+, {289, -163, 342}
+, {-382, 336, 78}
+, {-304, -345, 58}
+, {223, 150, 452}}
+, {{-174, 307, -151}
+, {142, -332, -299}
+, {-156, -124, -24}
+, {-335, 138, -247}
+, {299, 50, 454}
+, {68, 61, 53}
+, {-86, -302, 30}
+, {262, -358, 244}
+, {-73, 93, 151}
+, {-15, -97, -62}
+, {242, -123, 351}
+, {245, -162, -349}
+, {-134, -300, -75}
+, {32, 153, 105}
+, {333, 339, 228}
+, {-446, -114, -87}
+, {413, -33, 220}
+, {-59, 278, 174}
+, {98, -384, -260}
+, {356, 411, 307}
+, {383, -275, -414}
+, {-376, -137, -372}
+, {-185, -245, -171}
+, {-280, -55, -25}
+, {-200, 260, 465}
+, {169, 288, 63}
+, {-85, 515, 61}
+, {462, 294, -10}
+, {-77, 138, 31}
+, {306, 361, 19}
+, {-490, 74, 61}
+, {408, 609, -18}
+, {68, 73, 495}
+, {36, 343, 207}
+, {-15, 410, 326}
+, {237, -162, 276}
+, {-43, 63, 74}
+, {-227, -17, -143}
+, {412, 223, 259}
+, {397, -42, -285}
+, {-218, 145, 41}
+, {529, 283, 57}
+, {-117, 68, 291}
+, {-257, 350, 365}
+, {255, 11, -335}
+, {152, 371, 259}
+, {281, 41, 278}
+, {-22, 80, 428}
+, {-93, 151, -195}
+, {243, 501, -59}
+, {47, -407, 179}
+, {-120, 345, 114}
+, {-405, -179, 353}
+, {189, -282, 94}
+, {274, 25, -34}
+, {-104, -131, 2}
+, {19, -415, 215}
+, {204, 123, 94}
+, {284, 122, 217}
+, {-374, 35, -53}
+, {-396, -345, -198}
+, {-146, -219, -271}
+, {-179, 169, 260}
+, {306, 85, -1}}
+, {{-128, -287, -304}
+, {280, -166, -9}
+, {-316, -55, 294}
+, {83, -414, 199}
+, {-216, 288, -98}
+, {161, -182, -394}
+, {374, 107, -241}
+, {374, -321, 24}
+, {-102, 33, -56}
+, {-147, -179, -7}
+, {226, 32, 155}
+, {276, -140, 176}
+, {72, 264, -210}
+, {298, 77, -307}
+, {-371, -245, 4}
+, {-241, 197, -263}
+, {-279, -127, 169}
+, {9, 152, 21}
+, {348, -311, -141}
+, {41, -115, 23}
+, {-147, -403, -321}
+, {-57, -273, -87}
+, {-164, -395, -457}
+, {271, -2, -299}
+, {325, 266, 289}
+, {-297, -406, 323}
+, {19, 127, 122}
+, {8, -377, -67}
+, {330, -5, 275}
+, {39, 78, -198}
+, {-114, -98, -257}
+, {400, 38, 86}
+, {-228, 56, 272}
+, {464, -153, -319}
+, {-365, -144, -224}
+, {-332, 101, -18}
+, {111, 382, 151}
+, {209, -291, -384}
+, {-202, -29, -370}
+, {-93, -142, -423}
+, {-25, -205, 54}
+, {75, 39, -124}
+, {78, 11, -242}
+, {247, 406, 94}
+, {-9, 161, 255}
+, {24, -177, -160}
+, {-190, -231, -463}
+, {375, -260, 127}
+, {-59, -389, -55}
+, {-242, -415, 349}
+, {-102, -81, 96}
+, {-205, -121, -425}
+, {-240, 122, -115}
+, {167, -404, 248}
+, {-194, -176, -105}
+, {-134, -175, 355}
+, {332, -290, 19}
+, {74, -315, -448}
+, {-315, 56, 30}
+, {225, -88, 254}
+, {-69, 257, -216}
+, {-70, -19, -47}
+, {-319, 334, 205}
+, {-321, -236, 357}}
+, {{215, -194, 350}
+, {91, 192, 421}
+, {-91, 120, 348}
+, {198, 149, 368}
+, {47, -176, 149}
+, {-274, -48, 310}
+, {-391, 246, 45}
+, {182, -317, 183}
+, {-240, -114, -142}
+, {198, -327, -141}
+, {-126, -264, -149}
+, {135, 166, 42}
+, {266, -211, -113}
+, {423, -325, 296}
+, {319, -161, -115}
+, {-104, 252, 219}
+, {-213, -273, 30}
+, {439, 423, -114}
+, {77, -315, 266}
+, {-236, 5, -124}
+, {235, -188, 405}
+, {-243, -9, -433}
+, {-185, 350, 173}
+, {-207, -21, -488}
+, {-171, -124, 163}
+, {-338, 429, -328}
+, {-36, -158, 188}
+, {-372, -117, 21}
+, {-403, -391, 153}
+, {132, 235, -339}
+, {224, 208, 150}
+, {362, 90, 193}
+, {270, 344, 374}
+, {1, 75, -99}
+, {-370, -468, -254}
+, {206, 451, 164}
+, {-287, 373, -237}
+, {271, 69, 321}
+, {20, -109, -40}
+, {466, 289, -232}
+, {393, -67, 415}
+, {-390, 183, -391}
+, {308, 209, -54}
+, {15, 169, 356}
+, {211, 332, -281}
+, {14, 200, 90}
+, {81, -103, -219}
+, {358, 151, -281}
+, {-375, -353, -95}
+, {-433, -334, -23}
+, {343, 97, -245}
+, {-65, -30, 387}
+, {401, 127, -24}
+, {158, 105, 205}
+, {86, 36, 7}
+, {-257, -204, -252}
+, {216, -178, -109}
+, {280, 36, 377}
+, {352, 218, 325}
+, {72, -422, 429}
+, {33, 203, -259}
+, {-326, -238, -390}
+, {86, -321, -135}
+, {382, 129, 12}}
+, {{199, -281, 377}
+, {-72, -84, 199}
+, {408, -222, 82}
+, {-82, -182, -69}
+, {100, -221, 277}
+, {358, 47, 259}
+, {178, 261, 347}
+, {20, -275, 29}
+, {-390, -269, -290}
+, {-263, -377, 397}
+, {-33, 340, 316}
+, {-192, -387, -119}
+, {-312, 310, 397}
+, {-388, -371, -452}
+, {151, -243, -39}
+, {241, -159, 198}
+, {324, 154, 294}
+, {204, -314, 215}
+, {-105, -259, -235}
+, {-290, -355, -189}
+, {-88, -327, 122}
+, {328, -130, -130}
+, {283, -185, -185}
+, {64, -397, -199}
+, {-34, 359, -328}
+, {-116, -295, 52}
+, {233, -37, -24}
+, {330, -47, 302}
+, {-98, 286, -8}
+, {-258, -289, 321}
+, {169, -356, -34}
+, {34, 157, -241}
+, {353, -279, -68}
+, {-291, -385, 147}
+, {414, 455, -271}
+, {-51, -243, -310}
+, {77, -28, 295}
+, {-223, 138, 196}
+, {-76, -17, -188}
+, {-265, 0, 260}
+, {-393, -108, -287}
+, {288, -320, 70}
+, {395, -45, -129}
+, {134, -428, 35}
+, {133, 363, 84}
+, {212, -388, 237}
+, {159, 268, 233}
+, {61, 270, 341}
+, {-359, 58, -156}
+, {286, -267, -427}
+, {-376, 318, 199}
+, {-59, -322, 55}
+, {-116, -395, -143}
+, {-393, -262, -17}
+, {385, 319, -265}
+, {201, 51, -330}
+, {107, -116, 222}
+, {343, 22, -92}
+, {-401, 138, -82}
+, {-189, 315, 117}
+, {-283, -191, 119}
+, {-323, -56, 117}
+, {70, -21, -56}
+, {-255, 6, -438}}
+, {{-402, 79, 104}
+, {-304, -384, 214}
+, {-225, 211, 26}
+, {-437, -268, -186}
+, {-308, -259, -402}
+, {267, 383, -222}
+, {444, 294, -251}
+, {188, 58, 21}
+, {-134, -164, 433}
+, {-224, -384, -20}
+, {300, -337, -74}
+, {-153, -450, 244}
+, {-389, 214, 67}
+, {323, -238, 227}
+, {-370, -62, 206}
+, {74, -148, 76}
+, {298, 455, 494}
+, {-203, -98, 81}
+, {120, 431, 228}
+, {-1, -219, 334}
+, {43, 261, 235}
+, {-48, -207, -386}
+, {-153, -141, -393}
+, {-313, -353, -67}
+, {-167, -134, -241}
+, {310, 32, 308}
+, {-317, -63, 202}
+, {-20, 173, 401}
+, {-254, 59, -165}
+, {-159, 171, -145}
+, {77, -246, -346}
+, {419, -78, -160}
+, {66, 198, -26}
+, {276, 153, -47}
+, {-231, 37, -273}
+, {-472, 92, -405}
+, {-190, 254, 428}
+, {186, 159, -215}
+, {134, 263, -371}
+, {-200, 263, -291}
+, {22, 88, -222}
+, {232, -117, 186}
+, {-100, 273, -274}
+, {422, -129, 418}
+, {354, -206, 221}
+, {282, -130, 472}
+, {315, 175, 352}
+, {-175, -300, 444}
+, {76, 325, -54}
+, {-157, 226, 285}
+, {-343, -159, 321}
+, {19, 70, 283}
+, {-194, -46, 2}
+, {-426, -379, -426}
+, {258, -175, 62}
+, {-426, 171, 270}
+, {219, -62, 149}
+, {203, 10, 394}
+, {-103, -340, -45}
+, {-122, 25, 472}
+, {-193, -9, -193}
+, {-8, -210, 61}
+, {-233, -189, 220}
+, {-139, 18, 75}}
+, {{260, 30, 493}
+, {434, 24, -108}
+, {-118, 109, -26}
+, {257, -301, -389}
+, {253, -245, 95}
+, {48, -96, -324}
+, {82, -177, -331}
+, {429, 285, 117}
+, {178, 79, -112}
+, {552, 37, 124}
+, {-35, 306, 523}
+, {360, 408, 168}
+, {113, -257, -129}
+, {-456, -351, 122}
+, {235, 231, -104}
+, {136, -285, -238}
+, {362, 309, 363}
+, {285, 167, 191}
+, {409, -151, 81}
+, {-299, 471, -306}
+, {25, -355, -50}
+, {-309, 289, -316}
+, {-405, -9, -143}
+, {216, 428, 96}
+, {-68, 548, 495}
+, {-99, 402, -90}
+, {338, 81, 61}
+, {203, 260, 327}
+, {539, 357, -124}
+, {-240, -157, 113}
+, {-168, 83, -601}
+, {480, -90, -251}
+, {299, -157, 264}
+, {-51, 297, 199}
+, {377, 247, -11}
+, {-245, 159, 265}
+, {-311, -341, 292}
+, {-240, -252, 345}
+, {-75, 187, 19}
+, {-192, 243, 89}
+, {39, -179, -256}
+, {441, 97, 608}
+, {-372, 90, -311}
+, {331, -18, 386}
+, {-233, 8, -384}
+, {125, -302, -127}
+, {114, 360, -102}
+, {197, 360, -72}
+, {80, 303, -387}
+, {-69, 31, 302}
+, {134, 213, -345}
+, {647, -54, 479}
+, {-75, 256, -204}
+, {-126, -25, 216}
+, {-383, -310, -354}
+, {116, 196, -269}
+, {277, -247, 170}
+, {464, 343, 47}
+, {164, -257, 290}
+, {-332, 271, -54}
+, {328, 353, -150}
+, {-295, -177, 90}
+, {-137, 214, -104}
+, {153, 163, -209}}
+, {{-400, -333, -441}
+, {239, 248, -206}
+, {-533, -471, 0}
+, {187, -42, -422}
+, {71, 407, 113}
+, {-210, 400, 401}
+, {-47, -352, 37}
+, {100, 68, 173}
+, {18, -212, -369}
+, {-241, -299, -307}
+, {-210, 130, -3}
+, {1, -163, 432}
+, {-5, -207, -222}
+, {-289, -341, -450}
+, {32, -83, 176}
+, {-310, 146, 37}
+, {-318, -288, -354}
+, {267, 135, -207}
+, {-73, 406, 67}
+, {271, -101, 13}
+, {-112, -359, 288}
+, {342, 73, -455}
+, {-63, 167, 37}
+, {89, 298, -370}
+, {-290, -417, -227}
+, {-284, -361, 24}
+, {329, -16, -79}
+, {-101, 292, 37}
+, {284, -133, 384}
+, {355, 309, -11}
+, {-234, 41, -76}
+, {226, 14, 362}
+, {-212, 399, -300}
+, {-85, 237, -51}
+, {-205, 34, -437}
+, {185, 37, -73}
+, {427, -22, 27}
+, {-216, -35, -299}
+, {-109, -163, -252}
+, {-351, 272, -370}
+, {286, 75, -336}
+, {-78, -148, -351}
+, {217, 408, -50}
+, {70, -349, 158}
+, {-168, 378, -369}
+, {-319, 139, 253}
+, {76, -90, 146}
+, {374, 263, 259}
+, {137, 170, -329}
+, {-159, 216, -268}
+, {321, -309, 230}
+, {-246, 98, -276}
+, {-280, 169, 414}
+, {-34, 125, 113}
+, {-41, 140, -448}
+, {80, -343, -348}
+, {418, -116, 1}
+, {83, 102, -261}
+, {155, 385, -544}
+, {257, 184, 428}
+, {-346, -60, -236}
+, {410, 222, -131}
+, {419, -178, 358}
+, {136, -131, -224}}
+, {{-301, -20, -414}
+, {374, 314, -381}
+, {131, 145, -470}
+, {455, -350, 225}
+, {65, 449, 249}
+, {4, -241, -130}
+, {-6, -146, -431}
+, {4, -304, 271}
+, {273, -237, -220}
+, {-196, -287, 1}
+, {-42, 28, 306}
+, {-70, 166, -71}
+, {-287, 363, 23}
+, {400, 211, -180}
+, {247, 194, -232}
+, {-222, 32, 330}
+, {-292, -33, -198}
+, {-427, 364, -90}
+, {4, 370, -106}
+, {224, -448, 48}
+, {289, -144, -183}
+, {356, -332, -139}
+, {68, 297, -325}
+, {347, -193, 279}
+, {80, -570, -13}
+, {-83, -221, 95}
+, {539, 529, 452}
+, {-243, -436, -371}
+, {-128, 234, 258}
+, {-64, -285, 284}
+, {-186, 276, 250}
+, {292, 39, -87}
+, {170, -338, 268}
+, {385, 193, 213}
+, {320, -127, -14}
+, {227, 466, 183}
+, {264, -83, 132}
+, {178, -285, 189}
+, {-100, 77, 81}
+, {488, -291, -51}
+, {-6, 167, 229}
+, {292, 427, -421}
+, {383, 347, 10}
+, {-66, -97, 118}
+, {-83, 33, 303}
+, {384, 97, 79}
+, {-217, -445, -364}
+, {296, -159, 222}
+, {-219, -3, 408}
+, {-289, 344, 0}
+, {-149, 43, 373}
+, {-274, 296, 343}
+, {-195, -410, -284}
+, {-489, 123, -154}
+, {169, 208, -352}
+, {-251, -57, -181}
+, {-42, -357, 107}
+, {-372, -371, -166}
+, {180, 437, -262}
+, {284, -290, -112}
+, {5, -34, -186}
+, {-87, -30, -266}
+, {-34, 232, 201}
+, {304, 381, 63}}
+, {{87, 417, -113}
+, {-404, 54, -219}
+, {159, 212, 236}
+, {-271, -33, 201}
+, {214, -77, 106}
+, {-62, -165, -222}
+, {166, -205, 48}
+, {111, 232, 195}
+, {317, -323, -238}
+, {-193, 271, -406}
+, {74, -322, 26}
+, {-211, 390, 253}
+, {-254, 376, 44}
+, {181, -265, -397}
+, {165, -279, -250}
+, {-30, 414, -232}
+, {-30, -110, -101}
+, {272, -485, 198}
+, {149, 341, -251}
+, {-202, -313, -388}
+, {287, -375, 83}
+, {132, 114, -404}
+, {168, -180, -417}
+, {119, -266, 57}
+, {231, 97, -229}
+, {161, 44, 21}
+, {-339, 68, -258}
+, {65, 230, 318}
+, {-234, 115, -211}
+, {23, 155, 75}
+, {372, 81, -279}
+, {-156, -47, 321}
+, {-47, -301, -309}
+, {-172, 306, 88}
+, {208, 22, -246}
+, {9, -159, -150}
+, {-52, 332, 308}
+, {20, 377, 189}
+, {270, 46, 115}
+, {-38, -349, -454}
+, {56, 12, -120}
+, {406, -200, -411}
+, {145, -400, 362}
+, {297, 124, -43}
+, {-260, 23, -352}
+, {-225, -9, -317}
+, {109, 6, -252}
+, {188, -125, -358}
+, {-34, 277, 349}
+, {-252, -262, 251}
+, {404, -97, -303}
+, {-304, 254, -34}
+, {244, -370, -401}
+, {16, -112, 104}
+, {-371, 28, -338}
+, {-87, 347, 108}
+, {-261, -324, -296}
+, {-204, 310, 231}
+, {-374, -382, -323}
+, {3, 402, 159}
+, {-375, -400, 181}
+, {293, -175, 144}
+, {-344, 90, -368}
+, {-306, -161, -221}}
+, {{261, -39, 443}
+, {394, 362, -250}
+, {241, -85, -105}
+, {308, 368, 82}
+, {-137, 141, -299}
+, {107, 184, 386}
+, {55, 164, -59}
+, {165, -380, -335}
+, {-241, 188, -34}
+, {103, -316, 106}
+, {61, 504, 88}
+, {-245, -113, -273}
+, {-313, -213, 2}
+, {309, -15, -264}
+, {100, 121, 15}
+, {-254, 215, 312}
+, {79, -241, 111}
+, {389, -168, 43}
+, {-149, 240, -151}
+, {-251, 54, 267}
+, {-78, 108, 81}
+, {-22, 106, 86}
+, {410, -223, 307}
+, {361, -138, 338}
+, {97, -188, 144}
+, {-160, 137, 44}
+, {200, 474, 28}
+, {381, -374, 172}
+, {-213, -227, 381}
+, {-57, 256, -106}
+, {187, 324, 41}
+, {144, 332, 294}
+, {-19, 95, -211}
+, {193, 127, 207}
+, {-181, -374, -72}
+, {-121, -59, 246}
+, {-320, 239, -93}
+, {256, 275, -135}
+, {328, 1, -197}
+, {257, -39, -466}
+, {337, -239, 322}
+, {-42, 131, -145}
+, {-428, 248, -40}
+, {-78, -259, 199}
+, {58, 71, -356}
+, {47, -124, -197}
+, {-266, 312, 365}
+, {405, 6, 152}
+, {-72, -20, 449}
+, {-31, 41, 33}
+, {-369, -289, 70}
+, {204, 228, 276}
+, {-217, -445, -112}
+, {184, 169, -205}
+, {-170, -260, -215}
+, {-41, -84, -110}
+, {-291, 356, 265}
+, {-142, 309, 560}
+, {-42, 317, 209}
+, {96, -91, 362}
+, {-321, -204, -22}
+, {-92, 41, -390}
+, {52, -8, -122}
+, {-125, -374, 323}}
+, {{238, -318, 224}
+, {-241, 184, -302}
+, {72, -47, 330}
+, {-253, -27, -388}
+, {-167, 280, -185}
+, {266, -343, 68}
+, {146, 21, -251}
+, {247, 174, 271}
+, {299, 364, -69}
+, {-149, -466, -146}
+, {-89, 258, 6}
+, {-309, 32, 164}
+, {-106, -139, 336}
+, {169, 106, -113}
+, {-103, 119, -384}
+, {439, 387, 179}
+, {434, -30, -370}
+, {-231, 301, 40}
+, {-337, -104, 294}
+, {-62, 41, 307}
+, {102, -236, 365}
+, {362, 148, 425}
+, {-161, -392, 403}
+, {88, -209, 16}
+, {289, -28, 125}
+, {365, -85, -359}
+, {-480, -310, -427}
+, {-319, -239, 222}
+, {-189, -96, -138}
+, {319, 83, -169}
+, {171, 498, 9}
+, {-1, 106, 238}
+, {-160, -240, 279}
+, {-309, -11, -36}
+, {61, 419, 140}
+, {-410, 201, -95}
+, {-47, -71, 63}
+, {7, 77, -187}
+, {-143, 444, 99}
+, {187, 263, 78}
+, {-206, -98, -189}
+, {-114, -320, 46}
+, {348, 164, 195}
+, {122, 288, -172}
+, {-275, 87, 319}
+, {-8, 124, 406}
+, {159, 318, 41}
+, {-424, -287, -144}
+, {265, -223, -273}
+, {-248, -136, -322}
+, {48, -394, 164}
+, {303, -55, 40}
+, {358, -88, 172}
+, {81, -165, -360}
+, {170, 167, 33}
+, {-466, 22, 232}
+, {-242, -142, -40}
+, {-207, -6, -283}
+, {120, 256, -242}
+, {-413, -401, -28}
+, {77, 301, 31}
+, {-61, -63, 177}
+, {-272, -431, 30}
+, {306, 310, 182}}
+, {{-61, -315, 310}
+, {374, 383, 202}
+, {56, -361, 236}
+, {-407, -199, 86}
+, {375, -214, -97}
+, {364, -209, 383}
+, {-167, 167, -27}
+, {-401, 117, 344}
+, {82, 34, 362}
+, {402, -162, 39}
+, {-123, 199, 140}
+, {112, -104, 16}
+, {-293, -234, 241}
+, {385, -134, -150}
+, {160, 459, 70}
+, {139, 52, -235}
+, {-272, 230, -259}
+, {-45, -117, 327}
+, {-74, 80, -83}
+, {-269, 41, -230}
+, {-163, -320, -203}
+, {-29, -346, -262}
+, {77, -415, -324}
+, {57, 206, -204}
+, {-23, -215, 180}
+, {235, 124, 139}
+, {560, 354, -216}
+, {-135, 349, 382}
+, {-266, -169, 252}
+, {-351, 232, 176}
+, {-28, 463, 42}
+, {340, -209, 349}
+, {381, -369, 152}
+, {439, 389, -144}
+, {-407, 6, -220}
+, {-363, 287, -49}
+, {-270, 250, -331}
+, {-351, 148, -99}
+, {19, -106, -195}
+, {-84, -334, 292}
+, {-48, 397, 262}
+, {25, 233, 373}
+, {-308, -149, 373}
+, {136, 371, 366}
+, {-101, 195, -120}
+, {147, 110, -78}
+, {12, 120, 149}
+, {-182, 549, 437}
+, {5, -417, -181}
+, {-51, 264, 313}
+, {30, 241, -129}
+, {-75, 427, 526}
+, {-335, -100, 438}
+, {-272, -303, 70}
+, {-75, 344, -157}
+, {-325, -161, 411}
+, {99, -125, 40}
+, {-213, 259, -202}
+, {282, 460, 637}
+, {-224, -107, 314}
+, {291, -256, 211}
+, {-22, -398, 178}
+, {-93, -312, -338}
+, {389, 132, 411}}
+, {{5, 321, 458}
+, {-388, 284, -225}
+, {-182, 237, 133}
+, {260, 429, 26}
+, {-26, 187, -224}
+, {-1, -268, 295}
+, {103, -355, 225}
+, {372, 332, 317}
+, {331, -26, -97}
+, {-266, 93, 228}
+, {15, -215, -80}
+, {-89, 194, -149}
+, {407, -12, 155}
+, {-102, 195, -61}
+, {54, 218, -186}
+, {347, -78, -315}
+, {-92, 78, 22}
+, {-295, 288, -190}
+, {-53, 21, -329}
+, {478, 90, -174}
+, {129, 53, 256}
+, {28, 263, 427}
+, {-13, -211, -290}
+, {309, 11, 285}
+, {-83, 420, -280}
+, {440, -76, -287}
+, {283, -613, -500}
+, {-145, -92, 303}
+, {-291, 276, -281}
+, {104, 41, -403}
+, {-400, -85, 127}
+, {-558, -565, -349}
+, {-394, -129, 247}
+, {-120, -354, 104}
+, {-169, -95, 276}
+, {271, 37, -200}
+, {221, -24, -399}
+, {463, 31, 178}
+, {174, 56, -364}
+, {-435, -125, -36}
+, {-337, 249, 331}
+, {135, 28, -49}
+, {-139, -235, 71}
+, {385, 260, -96}
+, {-389, -230, 39}
+, {210, -394, -53}
+, {406, -70, -349}
+, {-25, -38, -499}
+, {-353, 276, 217}
+, {-170, -118, -378}
+, {436, 80, 89}
+, {292, -329, 295}
+, {-42, -184, 354}
+, {313, -2, 297}
+, {132, -45, 251}
+, {-427, 280, -192}
+, {-151, 223, 209}
+, {-191, 140, 52}
+, {-521, 38, 96}
+, {-279, 320, 398}
+, {-229, 162, 287}
+, {239, 150, -438}
+, {291, 314, 31}
+, {-2, 331, 55}}
+, {{78, 135, -80}
+, {316, -13, 226}
+, {-315, -413, -255}
+, {318, 260, 282}
+, {-168, 399, -416}
+, {124, -74, 1}
+, {-277, 306, 274}
+, {-52, 110, 416}
+, {-4, -34, -401}
+, {259, 74, -313}
+, {212, 495, 485}
+, {166, 408, -165}
+, {87, -286, -282}
+, {-611, -17, 330}
+, {-370, 194, -290}
+, {265, -104, 401}
+, {-155, 214, 17}
+, {67, -281, 118}
+, {-387, 389, 143}
+, {327, -239, -52}
+, {-384, -311, 209}
+, {154, -336, -172}
+, {351, 308, -305}
+, {385, 64, -309}
+, {-252, 511, 330}
+, {457, -141, -400}
+, {173, -80, -41}
+, {-260, -64, -144}
+, {174, 377, 241}
+, {-256, 330, -231}
+, {-213, -247, -186}
+, {412, -76, 340}
+, {314, -135, 55}
+, {-206, -296, 136}
+, {-78, 187, 391}
+, {14, -178, 99}
+, {390, -303, -371}
+, {-364, -364, 300}
+, {-203, -164, 305}
+, {-218, -239, -59}
+, {-351, 422, -271}
+, {310, -70, -88}
+, {-267, -40, 334}
+, {-69, 377, 107}
+, {306, -447, -135}
+, {-283, -172, -388}
+, {305, -140, -93}
+, {-263, -16, 130}
+, {-232, 265, 68}
+, {218, -20, 571}
+, {-132, -364, -382}
+, {-158, 410, -250}
+, {-99, 252, -94}
+, {-242, 240, 212}
+, {-193, 215, -243}
+, {311, 115, -204}
+, {-213, 281, 154}
+, {96, -66, -129}
+, {26, 111, 286}
+, {419, -183, 81}
+, {-46, -122, -100}
+, {16, -24, 110}
+, {-371, -194, 168}
+, {175, -303, 294}}
+, {{-150, -124, -47}
+, {312, 31, 453}
+, {6, 412, -309}
+, {-135, -346, -201}
+, {323, 15, 192}
+, {292, -429, 221}
+, {173, 170, -86}
+, {-415, -302, -42}
+, {223, 343, 19}
+, {-203, -309, -197}
+, {-376, 267, -139}
+, {-264, -293, 137}
+, {32, 25, 198}
+, {145, 205, -142}
+, {397, 267, -131}
+, {-245, -301, 366}
+, {-203, 87, -156}
+, {-232, 444, -238}
+, {360, -159, 347}
+, {329, -310, 317}
+, {-132, 30, 366}
+, {-137, -164, 180}
+, {-169, -31, -390}
+, {-88, -13, -158}
+, {262, 147, 243}
+, {223, 240, 294}
+, {-35, -74, 365}
+, {-282, 62, -253}
+, {436, 117, 186}
+, {-232, 56, 429}
+, {395, 163, 124}
+, {265, 57, -159}
+, {-60, 216, 22}
+, {464, 65, 239}
+, {-194, 240, 101}
+, {-144, -21, 36}
+, {-18, -224, 248}
+, {95, 267, 252}
+, {-93, -383, -123}
+, {490, 409, 32}
+, {188, -201, -390}
+, {-296, -317, -180}
+, {108, -169, -120}
+, {109, 319, 71}
+, {303, 381, -208}
+, {-390, -70, 255}
+, {-371, 87, -276}
+, {133, 432, -218}
+, {456, -155, 156}
+, {232, -419, -56}
+, {348, 192, 43}
+, {-186, 219, 117}
+, {-406, -427, 293}
+, {216, 152, 182}
+, {381, 266, 397}
+, {182, 13, -25}
+, {-283, -75, -208}
+, {-7, -117, 372}
+, {489, 194, 150}
+, {-397, 315, -230}
+, {184, -405, -84}
+, {224, -202, -94}
+, {-309, 280, -393}
+, {-399, -75, -26}}
+, {{-457, -322, -1}
+, {-342, -168, -275}
+, {313, -269, 238}
+, {519, -90, 380}
+, {437, -7, -210}
+, {380, -342, 362}
+, {-356, 414, -295}
+, {172, -310, 286}
+, {-188, 463, -132}
+, {72, -388, -274}
+, {-248, 38, 100}
+, {-327, 143, -62}
+, {-47, -162, 312}
+, {443, 452, -170}
+, {-6, -100, -307}
+, {-298, -300, -287}
+, {-57, -137, 123}
+, {-442, -40, -422}
+, {334, 263, -397}
+, {-377, 161, 426}
+, {77, 272, -339}
+, {-332, -159, 165}
+, {403, -263, 161}
+, {-25, -378, 19}
+, {457, 306, 239}
+, {-515, 127, -141}
+, {-236, 383, 361}
+, {426, 381, -220}
+, {-373, 22, 8}
+, {-51, -435, -356}
+, {-283, 226, 156}
+, {-20, -200, 100}
+, {33, 441, -31}
+, {450, 478, 429}
+, {-265, -400, -317}
+, {-200, 234, -217}
+, {300, 162, 289}
+, {307, -18, 5}
+, {194, 293, -55}
+, {-154, 296, 89}
+, {409, 383, -280}
+, {-176, 63, 261}
+, {417, 141, -333}
+, {-85, -34, -281}
+, {302, -106, 403}
+, {344, -317, -411}
+, {-136, -119, 436}
+, {172, 107, -284}
+, {157, 277, -80}
+, {-9, 67, -371}
+, {-299, 279, 244}
+, {-454, -182, 58}
+, {426, 55, 336}
+, {25, 300, 353}
+, {-374, 245, 168}
+, {371, 335, 380}
+, {129, -275, 430}
+, {190, -366, -87}
+, {105, 472, 375}
+, {397, 360, -100}
+, {-257, -293, -191}
+, {-85, -234, -117}
+, {-160, 62, 253}
+, {-190, -333, -194}}
+, {{194, -170, -238}
+, {-167, 401, -321}
+, {388, 60, -46}
+, {332, 242, 375}
+, {-166, -322, -194}
+, {471, -39, 58}
+, {-103, -355, -269}
+, {236, -179, 153}
+, {-17, 78, -4}
+, {-406, -65, -86}
+, {92, -276, -362}
+, {-387, -443, -246}
+, {-80, -212, 376}
+, {340, 128, -47}
+, {222, -352, -71}
+, {50, -217, -162}
+, {-26, 463, -83}
+, {-113, 65, 201}
+, {-18, 298, -152}
+, {66, -217, -346}
+, {95, 60, 154}
+, {409, -17, 402}
+, {6, -128, 317}
+, {148, 5, -82}
+, {98, 290, 354}
+, {207, 284, -233}
+, {-305, 100, 117}
+, {-46, -383, -49}
+, {-51, 38, 99}
+, {-193, -414, -46}
+, {-200, -332, -137}
+, {-150, 387, -331}
+, {76, 4, 144}
+, {7, -351, 216}
+, {56, 142, -87}
+, {216, -140, -184}
+, {-293, 179, -165}
+, {121, -327, 48}
+, {-7, -129, -245}
+, {-285, -1, -246}
+, {-171, 181, 103}
+, {-217, -277, 199}
+, {361, 152, -38}
+, {177, -414, -12}
+, {62, -428, 355}
+, {144, -299, -205}
+, {-210, -312, -5}
+, {-21, 212, -115}
+, {304, 216, 196}
+, {24, -40, 158}
+, {-321, 418, -107}
+, {-570, 232, 241}
+, {-311, 4, -6}
+, {471, 349, 355}
+, {-13, -222, -275}
+, {9, 157, -144}
+, {285, -185, -315}
+, {-404, 223, 122}
+, {64, -218, 185}
+, {-156, 361, 62}
+, {223, 266, 215}
+, {-67, -6, -243}
+, {269, 381, -122}
+, {351, -108, -35}}
+, {{-82, -51, -100}
+, {-125, -197, -69}
+, {-59, -79, -250}
+, {146, 36, -258}
+, {161, -255, 164}
+, {-356, -445, -33}
+, {120, -64, -29}
+, {357, -354, 372}
+, {84, 261, -283}
+, {-35, 52, 311}
+, {226, -230, -34}
+, {-109, 236, 232}
+, {331, 231, -80}
+, {20, 486, 447}
+, {203, 27, 318}
+, {-384, 64, -173}
+, {-31, 26, -257}
+, {18, 526, 237}
+, {272, 266, -107}
+, {-25, -308, -157}
+, {83, -9, 73}
+, {-403, -404, -162}
+, {-162, 365, 147}
+, {-228, -336, -176}
+, {-51, -2, -401}
+, {-265, 191, -280}
+, {-310, -6, -212}
+, {-295, 271, 34}
+, {-424, 173, -502}
+, {-236, 337, -121}
+, {403, 423, -68}
+, {-130, -199, 46}
+, {43, 121, 416}
+, {391, 190, 368}
+, {402, 460, 40}
+, {171, -378, 271}
+, {98, 278, 345}
+, {339, 51, -219}
+, {-151, 262, -304}
+, {-179, 165, 9}
+, {373, -130, -61}
+, {-291, -168, -543}
+, {-120, 48, -206}
+, {-307, -208, -135}
+, {32, 120, 229}
+, {-467, 69, 382}
+, {-361, -138, 161}
+, {-26, -157, 57}
+, {-22, 288, 101}
+, {-172, 122, -213}
+, {-386, 88, -164}
+, {305, 38, -21}
+, {395, -461, 117}
+, {-328, 120, -199}
+, {428, -158, 109}
+, {221, 59, 32}
+, {-396, 86, 235}
+, {-229, -208, 37}
+, {-34, 70, 328}
+, {-159, 132, 281}
+, {184, -241, 54}
+, {-47, -32, -420}
+, {165, 209, 76}
+, {-358, -170, -160}}
+, {{-301, 446, 366}
+, {-258, -383, -133}
+, {81, 153, -268}
+, {-387, 184, 239}
+, {349, 134, 413}
+, {199, 196, 435}
+, {394, 212, 238}
+, {222, 323, 259}
+, {-267, 407, 439}
+, {390, -180, -217}
+, {86, -438, -302}
+, {179, -347, -129}
+, {-85, -419, -379}
+, {132, 77, 399}
+, {-324, 219, -305}
+, {-40, 439, -233}
+, {-273, -164, 94}
+, {-51, -57, 279}
+, {-311, -262, -28}
+, {-348, -282, 85}
+, {158, 409, 137}
+, {371, 170, -182}
+, {270, -379, 313}
+, {84, -271, -366}
+, {-206, 40, 296}
+, {-412, -150, 17}
+, {-317, 16, -477}
+, {-249, -70, -385}
+, {-334, 80, -490}
+, {-310, -353, -291}
+, {103, 263, -61}
+, {305, -373, 107}
+, {22, -338, -408}
+, {-369, -454, -333}
+, {40, -215, -137}
+, {-61, -302, 127}
+, {162, -268, -199}
+, {339, 465, -304}
+, {-187, -64, -278}
+, {395, -37, 269}
+, {104, -225, -384}
+, {-180, -354, -179}
+, {277, 319, 349}
+, {418, 186, -154}
+, {310, -219, -304}
+, {242, 437, -203}
+, {-261, -414, 321}
+, {163, -38, -224}
+, {193, 162, -49}
+, {47, 60, -21}
+, {357, 152, -370}
+, {-198, 189, -227}
+, {-169, -151, 126}
+, {-290, -93, -169}
+, {52, 288, -55}
+, {-139, -358, -306}
+, {303, -10, 280}
+, {-20, 164, -177}
+, {-154, -103, -11}
+, {137, -143, 244}
+, {255, 141, 107}
+, {221, -278, 191}
+, {317, 66, -176}
+, {361, 421, -326}}
+, {{193, 209, 75}
+, {230, -142, 379}
+, {264, -345, -27}
+, {239, -455, 359}
+, {126, -268, -307}
+, {-345, -476, -30}
+, {-138, -73, -13}
+, {349, -315, 193}
+, {-129, 61, 151}
+, {116, 487, -298}
+, {-46, 115, 86}
+, {-242, -43, -117}
+, {107, -195, -316}
+, {327, -58, 233}
+, {-328, -294, -96}
+, {-370, 170, 312}
+, {101, 208, 258}
+, {219, 295, 218}
+, {70, -224, 263}
+, {174, -408, 303}
+, {173, -297, -264}
+, {348, 64, 143}
+, {16, 228, -165}
+, {-89, 450, -182}
+, {-12, -313, -40}
+, {-365, -146, 24}
+, {264, -188, 18}
+, {-112, 19, 116}
+, {317, -364, 215}
+, {280, -75, -342}
+, {-123, -30, -89}
+, {-247, 420, 23}
+, {38, -323, -391}
+, {-57, -373, 125}
+, {299, 507, 191}
+, {45, 115, -332}
+, {396, -126, -129}
+, {364, 234, -116}
+, {-77, -219, -216}
+, {-70, -170, 222}
+, {75, 97, 57}
+, {264, -268, -165}
+, {-7, 318, 180}
+, {197, -55, -71}
+, {333, 109, 389}
+, {-120, -93, -226}
+, {-80, 21, -413}
+, {291, -89, -101}
+, {-99, 13, 454}
+, {-167, -461, -66}
+, {-208, -3, 339}
+, {-219, 179, -105}
+, {258, 29, -153}
+, {-333, -75, 169}
+, {361, 227, -375}
+, {230, -223, -169}
+, {422, 280, 93}
+, {-153, 245, -290}
+, {-354, 41, -187}
+, {143, -321, 13}
+, {374, 276, 294}
+, {231, 182, -339}
+, {-276, -52, -329}
+, {-67, 101, 377}}
+, {{-274, -168, 83}
+, {195, -416, -350}
+, {367, 390, 414}
+, {-196, 322, 15}
+, {85, -85, -321}
+, {132, 10, 376}
+, {54, -142, 243}
+, {73, 88, -233}
+, {-243, 236, -188}
+, {168, 244, 427}
+, {-142, -7, -117}
+, {-317, -92, 377}
+, {144, -79, -339}
+, {209, -447, -408}
+, {236, 66, -408}
+, {299, -94, -181}
+, {-246, 144, -173}
+, {281, 103, 198}
+, {53, 393, -21}
+, {120, -185, -20}
+, {225, 90, -225}
+, {-151, -195, 55}
+, {-216, 41, -172}
+, {-10, 21, 520}
+, {510, 456, 22}
+, {297, 114, -118}
+, {374, 181, 174}
+, {94, 291, -240}
+, {279, 306, 200}
+, {258, 190, -42}
+, {-369, -211, 68}
+, {98, -104, 192}
+, {216, -383, 340}
+, {189, -120, 262}
+, {-200, 425, 499}
+, {-101, 3, -102}
+, {-257, -165, -283}
+, {-225, -160, -250}
+, {-8, 494, -134}
+, {294, 130, -514}
+, {-179, 180, -219}
+, {302, -99, -498}
+, {-447, -310, 145}
+, {391, 107, -87}
+, {-321, -163, 145}
+, {22, 174, -86}
+, {14, -134, -464}
+, {431, 281, 312}
+, {196, 512, -205}
+, {329, -372, 314}
+, {90, -1, -212}
+, {286, -280, 360}
+, {-264, -259, 0}
+, {-214, 163, 474}
+, {33, 81, 267}
+, {-189, 204, 257}
+, {-360, -247, -74}
+, {301, 416, 284}
+, {226, 306, -177}
+, {238, 13, 120}
+, {-350, 283, 249}
+, {208, -149, 296}
+, {-148, 304, 351}
+, {-443, 18, -30}}
+, {{12, -112, -268}
+, {-299, -198, 223}
+, {120, -262, -46}
+, {-116, -44, -179}
+, {174, -150, 165}
+, {7, -104, -222}
+, {-415, 314, -131}
+, {171, -322, 200}
+, {-274, 189, 301}
+, {-454, 99, 98}
+, {-2, -343, 313}
+, {-363, -240, -337}
+, {-236, -93, 362}
+, {57, -74, -227}
+, {13, -217, 390}
+, {-339, 188, -303}
+, {-409, -193, -367}
+, {-349, 122, 48}
+, {-124, 430, 84}
+, {-104, 88, -62}
+, {-206, -246, 54}
+, {-226, 70, 212}
+, {141, 174, -144}
+, {-479, 36, -293}
+, {-169, 124, 362}
+, {-428, 270, -404}
+, {-252, 53, 201}
+, {379, 375, 441}
+, {-302, -457, 271}
+, {174, 178, 57}
+, {188, -42, 88}
+, {359, -81, 224}
+, {8, 246, 463}
+, {-116, 157, 466}
+, {-321, -175, 305}
+, {-51, 181, 341}
+, {-60, 306, 152}
+, {-182, -151, 323}
+, {193, 337, 94}
+, {-257, -146, 404}
+, {106, -107, -304}
+, {18, 148, 272}
+, {222, 27, -304}
+, {-414, 320, 193}
+, {-62, 243, 399}
+, {73, 249, 186}
+, {123, 68, 104}
+, {-560, -326, 233}
+, {-177, 92, -294}
+, {335, -67, 58}
+, {415, 435, 102}
+, {-291, 243, -120}
+, {8, 209, -201}
+, {-158, 92, -225}
+, {-374, 186, 78}
+, {-168, 125, 88}
+, {-406, -140, 353}
+, {-479, -218, 12}
+, {-257, 102, -32}
+, {-147, 13, 417}
+, {100, -105, -270}
+, {15, -213, 436}
+, {39, 123, -236}
+, {357, -313, -61}}
+, {{-24, -259, 114}
+, {347, 208, -315}
+, {26, -207, -58}
+, {160, 307, -284}
+, {-22, 388, 366}
+, {-215, 162, 76}
+, {175, -303, -339}
+, {-33, -223, 20}
+, {-368, 214, 387}
+, {-57, -298, -397}
+, {-281, 210, 280}
+, {-177, -230, 263}
+, {-287, 84, 296}
+, {237, 282, -209}
+, {-365, 351, -115}
+, {-392, 69, -208}
+, {-70, -428, 277}
+, {-475, -480, -342}
+, {274, 236, 428}
+, {203, -437, 109}
+, {-288, 117, -122}
+, {-384, 145, 74}
+, {-306, -225, -116}
+, {302, -262, 235}
+, {-347, -484, -246}
+, {-470, -288, 92}
+, {50, 89, 350}
+, {-204, -21, 121}
+, {-167, -408, 322}
+, {219, -220, 267}
+, {52, 210, 274}
+, {-349, -229, 274}
+, {-45, -121, -229}
+, {210, 302, -197}
+, {-137, -261, -47}
+, {1, -252, -509}
+, {-222, -67, -260}
+, {-53, 336, 71}
+, {363, 350, 378}
+, {275, -214, 233}
+, {300, -206, 87}
+, {-322, -273, 280}
+, {13, -146, -41}
+, {371, 300, 207}
+, {-72, -91, 396}
+, {-302, 262, -65}
+, {-262, 240, -232}
+, {-88, -252, 12}
+, {418, 75, 280}
+, {-88, -40, -95}
+, {202, 182, -34}
+, {53, 219, -428}
+, {-192, -96, 382}
+, {131, 182, -453}
+, {-82, 308, 321}
+, {-422, -95, -11}
+, {222, 93, 308}
+, {-571, -138, 279}
+, {291, 423, -228}
+, {-94, -173, -281}
+, {296, -344, 387}
+, {-284, 441, -117}
+, {-64, 70, 279}
+, {325, 335, 355}}
+, {{390, 136, 58}
+, {148, -371, -309}
+, {424, -191, 384}
+, {-281, 179, -26}
+, {-407, -143, 421}
+, {151, -98, -279}
+, {-296, -220, -444}
+, {305, -213, 56}
+, {160, 173, 13}
+, {4, -182, 430}
+, {-267, -187, -164}
+, {237, 306, 78}
+, {-242, 166, -400}
+, {-27, -265, -22}
+, {-342, 325, -151}
+, {-280, -45, 316}
+, {108, 38, -127}
+, {-41, -397, -438}
+, {-111, -145, 50}
+, {416, 215, -401}
+, {6, 1, 392}
+, {162, -200, -88}
+, {-428, -205, 342}
+, {-5, 444, -234}
+, {-219, 22, 213}
+, {305, 487, 339}
+, {22, -295, 133}
+, {326, -214, -362}
+, {319, 314, 311}
+, {-118, -262, -180}
+, {-447, 12, -105}
+, {-367, -366, -122}
+, {71, -6, -90}
+, {-283, -235, -193}
+, {-317, 146, 159}
+, {-451, -424, 204}
+, {-75, -69, 145}
+, {-195, 240, 304}
+, {415, 122, 313}
+, {106, 36, -30}
+, {-250, 102, -389}
+, {237, 446, 135}
+, {-197, -170, -323}
+, {-356, -214, -430}
+, {-29, 92, 219}
+, {-340, 344, 315}
+, {7, 242, -150}
+, {-217, 402, 74}
+, {-265, -176, 412}
+, {-8, 23, 270}
+, {-254, -41, -352}
+, {-208, -349, -119}
+, {48, 319, -39}
+, {80, 421, -204}
+, {-440, -437, -37}
+, {111, -213, -282}
+, {55, 380, 399}
+, {47, 102, -106}
+, {285, 213, 323}
+, {70, 132, -19}
+, {180, -339, -127}
+, {88, 379, 199}
+, {102, -153, -182}
+, {161, -207, -123}}
+, {{165, 272, -204}
+, {28, 183, 48}
+, {-88, 435, -256}
+, {-317, 183, -290}
+, {4, -367, 35}
+, {-241, 268, -151}
+, {-68, -42, 217}
+, {-135, -104, -84}
+, {-210, 81, -168}
+, {-114, -279, 218}
+, {411, 44, -24}
+, {8, 405, 298}
+, {262, 154, -319}
+, {70, 346, 271}
+, {313, 117, 215}
+, {230, 361, 127}
+, {203, 96, -299}
+, {-409, 77, -165}
+, {-65, 228, 188}
+, {-126, 95, 10}
+, {324, 348, -332}
+, {212, -91, 240}
+, {293, 126, 154}
+, {-198, -354, 114}
+, {-199, 239, 29}
+, {237, -310, -38}
+, {91, 161, 234}
+, {-411, -117, -23}
+, {-323, 31, 382}
+, {204, 288, -11}
+, {-281, -250, -147}
+, {274, -258, 368}
+, {309, 176, -28}
+, {-199, 400, -352}
+, {35, -309, 228}
+, {-249, -81, -413}
+, {110, 292, 132}
+, {-166, 77, -23}
+, {-338, 83, 205}
+, {-24, 315, -94}
+, {-230, 237, -211}
+, {-108, -131, -380}
+, {140, 331, 37}
+, {-354, -318, -19}
+, {21, -6, 175}
+, {323, 5, -320}
+, {282, 155, 92}
+, {-263, -87, -294}
+, {350, 57, 162}
+, {-414, -238, -344}
+, {-186, -291, 314}
+, {148, 60, -462}
+, {-146, 304, -153}
+, {-262, -383, -102}
+, {64, 332, -193}
+, {-434, 232, -48}
+, {315, -282, 340}
+, {-237, 136, 148}
+, {-49, 52, 302}
+, {-324, 27, -164}
+, {73, 347, -324}
+, {366, 92, 377}
+, {225, -164, -346}
+, {139, 63, -446}}
+, {{247, -483, 151}
+, {-132, 110, 86}
+, {284, 155, -113}
+, {319, -286, 487}
+, {-63, -154, 440}
+, {417, 275, 20}
+, {266, 420, -382}
+, {40, -29, -108}
+, {228, -357, 427}
+, {307, -6, -383}
+, {427, 153, -257}
+, {24, -367, -32}
+, {76, -384, 302}
+, {-2, 337, -202}
+, {-139, -436, 65}
+, {-159, -363, -90}
+, {30, -93, 448}
+, {289, 135, -87}
+, {-354, -304, -15}
+, {50, 259, -136}
+, {68, 350, -222}
+, {-243, -226, -63}
+, {342, 107, 345}
+, {233, -397, 106}
+, {88, -97, 50}
+, {-260, 478, 43}
+, {-139, -67, -140}
+, {-228, 147, -399}
+, {-138, 358, 328}
+, {-257, -244, -139}
+, {-40, -177, -8}
+, {-337, 63, -611}
+, {442, 102, -334}
+, {313, -235, 211}
+, {-380, -252, -110}
+, {320, -140, -272}
+, {182, -391, -160}
+, {-244, 403, -415}
+, {-425, 78, -65}
+, {245, 177, -217}
+, {272, 356, -351}
+, {89, 72, -16}
+, {235, -270, 219}
+, {-240, 254, -338}
+, {-317, 230, -117}
+, {133, -387, -52}
+, {-147, -100, -178}
+, {240, -257, 502}
+, {408, -477, 163}
+, {245, 2, 50}
+, {-307, 413, -87}
+, {-85, -18, 303}
+, {-374, -398, -234}
+, {-257, 392, 274}
+, {46, 271, -294}
+, {-92, 380, -194}
+, {-171, -68, -329}
+, {118, -166, -287}
+, {-269, 11, -138}
+, {361, -216, 255}
+, {187, 344, 28}
+, {-280, 372, 240}
+, {235, 111, -88}
+, {0, -40, 36}}
+, {{125, -69, -445}
+, {354, 62, 3}
+, {-510, -493, 65}
+, {-198, -348, 62}
+, {284, -310, -140}
+, {-60, -498, -491}
+, {-33, 46, 238}
+, {181, -276, 404}
+, {-448, -251, 149}
+, {-397, 446, 426}
+, {385, 40, -126}
+, {-209, 237, -281}
+, {210, -390, 194}
+, {-342, -120, 372}
+, {215, -239, -64}
+, {-193, 128, -110}
+, {20, -31, 376}
+, {-386, -54, -563}
+, {5, 275, 327}
+, {-166, 176, 395}
+, {-105, -252, 175}
+, {95, 86, 19}
+, {-185, 140, -164}
+, {-9, 249, 66}
+, {-197, -283, -312}
+, {-7, -378, -340}
+, {-529, -288, -36}
+, {249, -69, 382}
+, {-204, 214, -45}
+, {-190, -88, 375}
+, {254, -60, 215}
+, {223, 218, -47}
+, {321, -93, 80}
+, {215, -233, -121}
+, {395, -47, 351}
+, {-409, -204, -47}
+, {-83, 463, -246}
+, {-267, 233, -47}
+, {-247, -168, -34}
+, {0, 194, 96}
+, {27, -209, 127}
+, {-87, -394, 222}
+, {-303, 261, 165}
+, {-397, -280, 235}
+, {23, -234, 372}
+, {-173, 228, -116}
+, {-273, -240, 276}
+, {220, -154, 11}
+, {-9, 28, -315}
+, {-16, 264, 252}
+, {-184, 347, -303}
+, {-62, -347, 343}
+, {173, -93, -250}
+, {20, -124, 196}
+, {222, -289, -222}
+, {-177, 241, -260}
+, {325, 375, -28}
+, {212, 102, -138}
+, {-306, -295, -472}
+, {-325, 74, 300}
+, {293, -274, -88}
+, {53, 428, -338}
+, {490, 369, -233}
+, {-197, -335, -9}}
+, {{-309, -263, 326}
+, {-81, 270, 178}
+, {104, -447, 1}
+, {126, 6, -330}
+, {-469, -203, -236}
+, {-317, -355, -359}
+, {311, -129, -111}
+, {-179, -275, -53}
+, {85, 170, 256}
+, {-236, -343, 430}
+, {-249, 97, 28}
+, {-159, 113, 42}
+, {-348, 168, -397}
+, {11, -193, -308}
+, {226, -298, 315}
+, {370, -52, 39}
+, {254, 486, 419}
+, {-173, -627, -281}
+, {-144, 324, 58}
+, {221, 338, -258}
+, {-63, 421, 105}
+, {-140, -52, 46}
+, {167, 131, -153}
+, {267, -129, -25}
+, {-259, -142, 101}
+, {-395, -30, 75}
+, {22, -65, 1}
+, {-243, -350, -188}
+, {327, -301, -261}
+, {-103, -144, 62}
+, {-441, -411, -381}
+, {-74, 123, -147}
+, {-177, 198, 262}
+, {141, 236, 180}
+, {-197, 91, 189}
+, {-496, -479, 75}
+, {-185, -137, 166}
+, {194, 397, -299}
+, {379, 150, 344}
+, {-78, -195, -391}
+, {-314, 50, -221}
+, {175, 14, 290}
+, {152, -125, 28}
+, {163, -119, 167}
+, {-100, -117, 376}
+, {-16, -191, 311}
+, {-252, -244, -368}
+, {124, 201, 129}
+, {316, -228, 293}
+, {-312, 429, -295}
+, {8, -338, 50}
+, {295, -230, 448}
+, {-154, 162, -251}
+, {-333, -204, 65}
+, {244, -129, -223}
+, {-553, -244, -259}
+, {14, -240, 428}
+, {408, -113, 418}
+, {-74, -266, 5}
+, {402, 262, -38}
+, {43, 188, 243}
+, {-160, 286, 264}
+, {421, 376, -202}
+, {-254, 1, 65}}
+, {{-203, 246, 289}
+, {251, 307, -356}
+, {-1, -296, 150}
+, {-127, -402, -288}
+, {408, -20, 46}
+, {333, 223, 12}
+, {325, -138, 413}
+, {-301, 22, -137}
+, {-387, -413, 216}
+, {120, 178, -232}
+, {166, 97, 365}
+, {-51, -211, -109}
+, {402, -358, -24}
+, {138, -251, 406}
+, {-147, 98, -210}
+, {235, -122, 67}
+, {-266, 304, 201}
+, {-361, -239, 226}
+, {113, -53, 66}
+, {171, 262, -19}
+, {-116, 397, -68}
+, {-15, 48, -65}
+, {333, 115, -158}
+, {-471, -176, 209}
+, {-429, -54, 227}
+, {-264, -321, 180}
+, {63, -165, 183}
+, {-15, 325, -179}
+, {-167, -206, -246}
+, {0, 58, -251}
+, {143, 453, -151}
+, {-92, -19, 450}
+, {283, -165, 64}
+, {-67, -129, -276}
+, {-493, -341, -197}
+, {-288, -278, 368}
+, {74, 201, -136}
+, {168, 195, -314}
+, {70, -294, 170}
+, {-70, 407, -72}
+, {429, -337, -58}
+, {-147, 59, 307}
+, {-346, 56, 68}
+, {353, -348, 246}
+, {-371, 240, -279}
+, {-24, 411, 282}
+, {-90, -185, 34}
+, {-316, -203, 485}
+, {170, -42, -345}
+, {429, -47, -169}
+, {-306, -363, 68}
+, {-146, 459, -14}
+, {-358, 0, -246}
+, {-251, -149, 47}
+, {-184, -321, 9}
+, {-154, 0, -367}
+, {361, -181, -212}
+, {312, 369, -11}
+, {12, 162, 338}
+, {-357, 165, 122}
+, {244, 57, -196}
+, {284, 344, 251}
+, {-328, 363, -26}
+, {407, 384, 1}}
+, {{158, 18, 37}
+, {6, 95, -95}
+, {-142, -92, -292}
+, {289, 281, -511}
+, {-292, -171, -231}
+, {181, -89, 214}
+, {51, 468, 278}
+, {436, -158, 324}
+, {409, -174, -290}
+, {259, 298, 103}
+, {236, 141, -54}
+, {414, -330, -275}
+, {121, 12, 260}
+, {204, 409, 44}
+, {376, 132, 443}
+, {371, -131, 0}
+, {-255, -197, -302}
+, {-435, 240, -210}
+, {-340, 305, -260}
+, {310, -113, 395}
+, {224, -41, -6}
+, {-456, -489, -513}
+, {-306, -165, 84}
+, {107, -438, -343}
+, {-351, -351, -510}
+, {319, -12, 367}
+, {125, 255, 383}
+, {362, 350, -195}
+, {-52, -67, -271}
+, {-15, 340, 22}
+, {-37, -230, -264}
+, {380, -224, -167}
+, {351, 101, 232}
+, {151, 177, 207}
+, {102, -157, 14}
+, {-68, -404, -454}
+, {375, 218, 318}
+, {390, 8, 402}
+, {-103, -264, -329}
+, {-325, -179, -213}
+, {394, -363, -364}
+, {159, 418, 233}
+, {180, -354, -336}
+, {379, -328, -8}
+, {-338, -206, 81}
+, {279, -280, -219}
+, {-209, 332, -404}
+, {-150, -404, -81}
+, {0, -523, -289}
+, {-132, 77, 375}
+, {180, 281, 385}
+, {-17, -247, 403}
+, {105, -63, -221}
+, {-270, 158, -119}
+, {423, -338, 379}
+, {-53, -299, -433}
+, {423, -159, -261}
+, {-223, 318, 149}
+, {-538, -22, 238}
+, {-11, -36, 162}
+, {345, 257, -285}
+, {96, 194, 160}
+, {247, 42, 204}
+, {389, -44, -330}}
+, {{-295, 237, -136}
+, {-54, 203, -259}
+, {187, 87, 349}
+, {-170, 233, -117}
+, {-309, 303, 415}
+, {-344, -136, 199}
+, {-5, -5, -29}
+, {-288, 367, -68}
+, {-440, 84, -64}
+, {315, -84, 483}
+, {-213, 432, 523}
+, {-309, 304, 203}
+, {145, 133, -114}
+, {-43, 246, 198}
+, {72, -30, 140}
+, {-96, 228, -191}
+, {-372, -379, -319}
+, {-224, 276, -229}
+, {-270, 372, 107}
+, {208, -229, -62}
+, {357, 90, -117}
+, {-106, -70, -164}
+, {-223, -344, 136}
+, {154, -50, 442}
+, {-252, 149, -207}
+, {263, -133, -379}
+, {135, -162, -132}
+, {-199, -195, 121}
+, {-259, -274, 199}
+, {53, 489, -12}
+, {-139, -18, 26}
+, {-5, 135, -187}
+, {-341, 364, -258}
+, {150, 425, 159}
+, {372, 590, 165}
+, {-24, -163, 120}
+, {-107, 385, -110}
+, {387, -190, -339}
+, {-40, 154, -62}
+, {-153, 254, -300}
+, {-272, 115, 183}
+, {-544, -432, -68}
+, {-130, 59, -219}
+, {83, 305, 106}
+, {175, -29, 278}
+, {-485, -415, -163}
+, {55, -6, -375}
+, {276, -348, -294}
+, {519, 27, -129}
+, {-241, -430, 283}
+, {-344, -194, -239}
+, {130, 309, 309}
+, {346, -203, 245}
+, {150, -225, -278}
+, {199, 351, -280}
+, {117, 339, 409}
+, {317, -52, 93}
+, {-327, 316, -221}
+, {630, 67, 396}
+, {396, -287, -4}
+, {408, 321, -345}
+, {33, -118, -4}
+, {-279, 159, 367}
+, {307, 285, 67}}
+, {{59, 293, -160}
+, {120, -365, -228}
+, {132, -265, 433}
+, {27, -75, 455}
+, {38, 405, -16}
+, {283, 123, -105}
+, {87, -33, 159}
+, {456, 239, 128}
+, {-182, -79, 288}
+, {282, -410, -16}
+, {344, 449, -186}
+, {-436, -39, 302}
+, {235, 327, 147}
+, {92, 429, -127}
+, {-279, -281, -19}
+, {184, 383, -175}
+, {-152, -367, 112}
+, {-317, 352, 315}
+, {267, -41, 139}
+, {144, -334, 377}
+, {-437, -202, 343}
+, {-204, 246, 325}
+, {368, -257, -88}
+, {-357, 236, 279}
+, {367, 150, 167}
+, {87, 104, -36}
+, {-105, -406, 172}
+, {86, -81, 427}
+, {-93, -176, -58}
+, {-345, 136, -100}
+, {-182, -62, -369}
+, {-162, -260, 361}
+, {-346, 91, 281}
+, {254, 28, -228}
+, {45, 252, -16}
+, {313, 489, -260}
+, {202, -100, -494}
+, {27, 27, 282}
+, {397, -218, 76}
+, {172, -180, 259}
+, {80, -55, -245}
+, {179, 183, -193}
+, {-135, 190, -283}
+, {-83, 301, -360}
+, {-324, 89, -87}
+, {-328, 337, -304}
+, {-141, 380, 184}
+, {5, -64, 269}
+, {472, -99, 197}
+, {-53, 56, 213}
+, {-123, -269, 100}
+, {-189, -350, -329}
+, {35, 299, 231}
+, {-182, -195, 97}
+, {255, -102, -319}
+, {9, 228, -204}
+, {419, -405, 232}
+, {345, 255, -439}
+, {276, 92, -248}
+, {-128, -248, -179}
+, {-357, 6, -349}
+, {-322, 54, 308}
+, {129, -212, -95}
+, {293, -369, -314}}
+, {{198, 321, -282}
+, {-120, 0, 302}
+, {-308, -512, 66}
+, {-73, 177, -465}
+, {15, -130, 316}
+, {266, -284, -408}
+, {-129, 119, 83}
+, {-44, 278, 125}
+, {66, 68, -91}
+, {299, -276, 77}
+, {-164, 255, -112}
+, {132, 412, 409}
+, {12, 366, 47}
+, {-181, -314, 36}
+, {-311, -381, 356}
+, {280, -161, 130}
+, {-301, -37, 412}
+, {415, -232, -252}
+, {-87, 90, 37}
+, {-276, -167, -117}
+, {186, -39, -239}
+, {-437, -373, 196}
+, {114, 73, -188}
+, {106, -186, 455}
+, {-329, 331, 356}
+, {206, -20, -153}
+, {-147, -372, 41}
+, {99, 351, 399}
+, {-376, -248, -68}
+, {230, 460, 76}
+, {25, -344, 210}
+, {-434, -199, -324}
+, {-112, -275, -279}
+, {269, -447, -33}
+, {-124, 439, -199}
+, {-312, -262, -274}
+, {-55, -96, 39}
+, {-159, 291, 142}
+, {-12, 156, 151}
+, {63, -228, -117}
+, {-44, -230, 317}
+, {260, 397, 17}
+, {143, -2, -152}
+, {-329, -123, -357}
+, {-349, 323, 354}
+, {-27, -89, -141}
+, {-282, -169, 308}
+, {-296, 247, -279}
+, {347, 270, 410}
+, {-211, 196, -303}
+, {-257, -30, -61}
+, {-13, 131, -368}
+, {-286, -91, 81}
+, {-311, -144, -294}
+, {-134, -320, -266}
+, {-154, -339, 239}
+, {216, -154, 315}
+, {345, 444, 390}
+, {-366, 235, 45}
+, {119, -163, -273}
+, {202, -321, 419}
+, {-25, -52, 397}
+, {432, -216, -101}
+, {231, -47, -416}}
+, {{-327, 132, -313}
+, {-338, -140, 212}
+, {238, 190, 112}
+, {323, -99, 397}
+, {-287, 223, 301}
+, {241, 179, -411}
+, {117, 163, -171}
+, {-225, 186, 239}
+, {-394, -155, -308}
+, {161, 56, -69}
+, {-63, 78, 135}
+, {468, 124, -13}
+, {261, -72, -253}
+, {132, -196, -378}
+, {91, -26, 168}
+, {-440, 274, 94}
+, {386, -255, 318}
+, {85, -78, 109}
+, {204, -53, -144}
+, {-111, 166, -29}
+, {33, -328, 60}
+, {336, 301, 193}
+, {-72, -7, 224}
+, {-152, 460, -116}
+, {212, -216, 267}
+, {156, -141, 51}
+, {286, 167, 366}
+, {-250, 264, -224}
+, {256, -141, -4}
+, {112, -139, -365}
+, {-113, -309, -385}
+, {-21, -2, 96}
+, {-105, -383, 365}
+, {-32, 121, 248}
+, {-24, 356, 122}
+, {-177, -53, -5}
+, {-289, 137, 243}
+, {285, -369, -152}
+, {493, 200, 459}
+, {-177, -404, 48}
+, {-24, 322, 270}
+, {132, -82, -292}
+, {-105, 297, -277}
+, {114, -129, 162}
+, {424, -277, 377}
+, {407, -174, 0}
+, {-162, -329, -317}
+, {156, -253, 77}
+, {-213, -237, -251}
+, {38, 367, 172}
+, {-330, -289, 75}
+, {506, -194, 417}
+, {241, -356, 382}
+, {-300, 265, -168}
+, {123, -288, -351}
+, {-134, 275, 96}
+, {154, 167, -224}
+, {390, -67, 98}
+, {-312, -220, 357}
+, {288, 381, -371}
+, {302, 239, 252}
+, {-160, 33, -190}
+, {53, -305, 13}
+, {233, -282, -94}}
+, {{380, -154, -346}
+, {-19, -156, 379}
+, {321, 15, -16}
+, {356, -171, 66}
+, {41, -328, 208}
+, {260, -42, -314}
+, {-369, 423, 266}
+, {163, -353, 32}
+, {274, 330, -347}
+, {229, -207, -243}
+, {200, 275, 286}
+, {336, 144, -351}
+, {69, 7, 204}
+, {-243, 333, -349}
+, {80, -300, -290}
+, {-198, -70, -211}
+, {409, -354, -110}
+, {-275, 61, 117}
+, {-98, 181, -219}
+, {-15, -135, 49}
+, {237, 266, 146}
+, {-55, 215, -449}
+, {393, 245, 95}
+, {22, -140, -274}
+, {66, 224, 353}
+, {408, -18, 392}
+, {302, 557, -298}
+, {408, 209, -299}
+, {405, -35, -87}
+, {67, -88, -391}
+, {-391, -302, -322}
+, {-71, 307, 572}
+, {-225, 224, 251}
+, {160, 409, 192}
+, {179, 359, 67}
+, {119, -291, -300}
+, {-50, -61, 394}
+, {-349, -190, -97}
+, {-328, -299, 266}
+, {-382, -60, 130}
+, {257, 387, 18}
+, {-205, -206, -101}
+, {130, 258, -393}
+, {-322, -9, -79}
+, {-78, -342, 314}
+, {201, -102, -110}
+, {81, 300, -258}
+, {550, 657, 36}
+, {-255, -161, -273}
+, {47, 2, 257}
+, {-290, 48, -282}
+, {14, -1, 528}
+, {-151, 264, -284}
+, {94, 0, 96}
+, {-369, 70, -220}
+, {-140, 379, 479}
+, {385, 314, 244}
+, {-230, 249, 566}
+, {-188, 226, -189}
+, {136, -257, 327}
+, {-396, -4, -128}
+, {344, 5, -223}
+, {-1, 17, 213}
+, {240, -448, -108}}
+, {{444, -20, 45}
+, {-51, 403, -62}
+, {165, -129, 58}
+, {403, 268, -189}
+, {-360, -44, 18}
+, {-320, 198, -311}
+, {100, -208, 65}
+, {213, -198, -133}
+, {9, -456, -47}
+, {-186, 145, 102}
+, {43, -318, 43}
+, {219, -234, -1}
+, {-305, -186, 389}
+, {-430, 271, -387}
+, {-214, 38, -301}
+, {-350, -135, -351}
+, {-320, -119, 278}
+, {49, 353, -240}
+, {263, -382, -96}
+, {75, -287, -25}
+, {89, 267, 106}
+, {-326, -419, -400}
+, {-327, -18, -183}
+, {85, 87, -187}
+, {-321, -4, 62}
+, {-267, 192, 171}
+, {-428, -272, 311}
+, {43, -343, -30}
+, {108, 70, 102}
+, {302, 20, 141}
+, {-85, 129, -10}
+, {-34, 114, 35}
+, {-374, -70, 158}
+, {-51, -175, 219}
+, {-31, -333, -103}
+, {-252, -1, 180}
+, {-43, 105, 220}
+, {176, -412, 373}
+, {96, -136, 373}
+, {-282, 358, 335}
+, {-153, 337, -437}
+, {-268, 318, -173}
+, {321, 348, -23}
+, {248, -256, -178}
+, {397, -47, 355}
+, {-223, 398, -301}
+, {-107, -205, 97}
+, {-170, 287, -8}
+, {-234, 0, -155}
+, {68, -161, -302}
+, {293, -412, 213}
+, {282, -281, 313}
+, {-224, 71, -223}
+, {-43, -328, -117}
+, {-294, -349, -348}
+, {269, -154, -174}
+, {274, 296, 177}
+, {173, 261, 441}
+, {-244, 255, 159}
+, {-417, 258, 255}
+, {74, 424, -397}
+, {297, -319, 268}
+, {-176, 159, 212}
+, {116, -200, 26}}
+, {{-519, -90, -22}
+, {139, 214, 270}
+, {367, 153, 259}
+, {318, 171, 350}
+, {49, 375, 205}
+, {392, 431, -83}
+, {186, 91, 98}
+, {16, 22, 25}
+, {-63, -24, -293}
+, {-211, -452, -355}
+, {361, -278, -166}
+, {44, -125, -145}
+, {-135, 58, -301}
+, {82, 310, 380}
+, {331, -275, 224}
+, {-27, 121, 125}
+, {-206, 272, 160}
+, {420, -137, -155}
+, {-218, 41, 148}
+, {184, 151, -95}
+, {-129, -321, 327}
+, {-66, 47, -451}
+, {-179, -362, -201}
+, {177, 87, 26}
+, {262, -289, -195}
+, {491, -75, 70}
+, {585, 129, -141}
+, {-142, -116, -354}
+, {126, 290, 447}
+, {122, -198, -352}
+, {263, -46, -158}
+, {597, 229, 231}
+, {-304, 76, -23}
+, {-118, 169, -148}
+, {216, 267, -458}
+, {31, -280, 275}
+, {78, 382, -45}
+, {362, -109, -134}
+, {194, -484, -236}
+, {-152, 444, 542}
+, {230, -151, 451}
+, {367, 64, -256}
+, {-297, -264, -327}
+, {103, 357, 361}
+, {-6, 414, -127}
+, {-162, -264, -448}
+, {-275, 211, 202}
+, {-182, 134, -37}
+, {244, 318, 372}
+, {-137, 201, -310}
+, {-425, 68, 378}
+, {-333, 144, -136}
+, {-255, 371, -383}
+, {215, -57, -249}
+, {-227, -199, 51}
+, {-16, 70, -272}
+, {226, 402, 170}
+, {-162, -252, 305}
+, {378, 568, 203}
+, {-257, 126, 90}
+, {-98, 80, -85}
+, {-317, 232, 302}
+, {67, -83, 302}
+, {-220, -84, -168}}
+, {{347, 376, -218}
+, {-239, 408, 384}
+, {-435, -418, -232}
+, {78, 126, -309}
+, {169, -42, 37}
+, {-145, 66, -276}
+, {270, 186, 301}
+, {260, 111, 319}
+, {-378, -77, 121}
+, {297, 450, 409}
+, {319, 430, 220}
+, {-110, -94, 454}
+, {137, -402, -387}
+, {288, -92, 339}
+, {262, -78, 203}
+, {266, -216, -314}
+, {176, 73, -334}
+, {102, -67, -187}
+, {69, 289, 400}
+, {84, 29, 37}
+, {-328, -346, -105}
+, {-276, -40, -499}
+, {-240, -79, -382}
+, {417, 175, 45}
+, {346, -399, -381}
+, {297, -168, 281}
+, {318, 131, -205}
+, {-212, 434, 316}
+, {-70, 127, 190}
+, {177, 402, 389}
+, {418, 419, 144}
+, {21, -153, 300}
+, {-183, -223, -282}
+, {-64, -287, 21}
+, {102, 22, 314}
+, {339, 426, -266}
+, {-214, 150, -198}
+, {-166, 342, 308}
+, {223, 84, 437}
+, {0, -115, 295}
+, {262, 259, 320}
+, {-102, 114, 368}
+, {-297, -80, -302}
+, {200, 333, -342}
+, {432, 317, 170}
+, {-199, -323, -440}
+, {-48, 332, -163}
+, {-147, 384, 53}
+, {-81, 134, 43}
+, {399, 449, 415}
+, {-70, 193, 31}
+, {-154, 198, 69}
+, {-10, 220, 46}
+, {-386, 20, 257}
+, {424, -211, -130}
+, {-11, -311, -305}
+, {402, 369, -166}
+, {324, -112, -174}
+, {503, -129, -127}
+, {-264, 292, 274}
+, {-218, -139, 385}
+, {-239, -338, 297}
+, {313, 154, 78}
+, {69, -311, 174}}
+, {{361, 393, 56}
+, {-276, -52, 147}
+, {218, -281, 48}
+, {-503, -258, -270}
+, {246, 65, 314}
+, {333, -411, -90}
+, {-98, -251, 174}
+, {432, -125, 341}
+, {265, -44, 43}
+, {-137, -54, 186}
+, {-414, 218, -356}
+, {-179, -33, -29}
+, {-53, 28, 270}
+, {-205, -214, -59}
+, {238, -138, 321}
+, {-306, 125, 334}
+, {75, -266, -384}
+, {-334, 184, -217}
+, {-19, -266, 226}
+, {335, 412, 278}
+, {280, -32, 84}
+, {-271, 122, 87}
+, {-253, -244, -339}
+, {193, 226, 344}
+, {432, -273, -285}
+, {-332, -416, 56}
+, {306, -133, -409}
+, {153, 144, -383}
+, {-77, -178, 14}
+, {69, 49, 212}
+, {162, 415, 47}
+, {-74, -48, 3}
+, {-70, 296, 226}
+, {253, -302, 395}
+, {432, 0, -235}
+, {153, -295, -414}
+, {37, 213, 2}
+, {296, 112, -78}
+, {203, 249, -340}
+, {230, -348, 224}
+, {-391, 2, -151}
+, {430, 408, -233}
+, {206, -306, 248}
+, {-13, 44, 391}
+, {136, -41, 339}
+, {-101, -126, -153}
+, {-165, -402, 135}
+, {-60, 95, 66}
+, {159, -158, 410}
+, {-205, 301, 409}
+, {-313, -108, -126}
+, {10, -240, 305}
+, {-237, 402, 72}
+, {200, -23, 197}
+, {391, 280, 373}
+, {-17, 113, 394}
+, {362, 100, 348}
+, {302, 26, 402}
+, {153, 9, 226}
+, {-369, -220, 82}
+, {441, 194, -281}
+, {-109, -336, 288}
+, {178, 212, -405}
+, {193, 231, 224}}
+, {{-385, -229, 115}
+, {425, -177, -155}
+, {62, 160, 137}
+, {255, 261, 525}
+, {460, -246, -194}
+, {402, 30, 34}
+, {349, 77, 263}
+, {58, 405, -217}
+, {153, 96, -333}
+, {-318, -271, 130}
+, {-57, 319, -159}
+, {157, -4, 449}
+, {-19, -404, -103}
+, {-19, 63, -463}
+, {19, -232, -49}
+, {161, -342, -313}
+, {188, -260, 126}
+, {-486, -351, 70}
+, {35, 46, 180}
+, {438, -297, -212}
+, {-442, -119, 211}
+, {-15, 26, 358}
+, {149, -85, 213}
+, {109, 355, -276}
+, {-95, -297, 92}
+, {-42, 142, 103}
+, {-173, 391, 381}
+, {398, 403, 419}
+, {292, 87, 148}
+, {182, -411, -248}
+, {-102, 24, -492}
+, {167, -45, 276}
+, {251, 447, 122}
+, {-178, -17, 99}
+, {86, 297, -138}
+, {-70, -75, 50}
+, {-269, -162, -196}
+, {-447, -253, -274}
+, {422, 72, -77}
+, {131, 206, -238}
+, {309, -9, -79}
+, {-124, -251, 329}
+, {136, 228, 347}
+, {-188, -398, 135}
+, {-379, -314, 329}
+, {-229, -64, -179}
+, {205, -325, 338}
+, {14, -165, 310}
+, {-193, 474, -149}
+, {-282, 371, 68}
+, {341, 154, 364}
+, {168, -173, 295}
+, {273, -291, 49}
+, {106, -117, 68}
+, {-234, -371, -85}
+, {209, -221, -52}
+, {-334, -270, 329}
+, {-62, -63, -343}
+, {-198, 131, -176}
+, {250, -103, -363}
+, {126, 143, -78}
+, {149, 242, -309}
+, {271, -19, 35}
+, {-319, -453, -269}}
+, {{31, 86, -84}
+, {-350, -85, 336}
+, {1, 182, 71}
+, {-496, 35, 97}
+, {102, 84, -24}
+, {330, -267, -223}
+, {-205, 265, 347}
+, {-356, -216, -251}
+, {347, 74, 196}
+, {149, -128, -350}
+, {-37, -305, -26}
+, {388, 314, -289}
+, {-353, -325, 237}
+, {-12, -266, 373}
+, {388, 191, 192}
+, {201, 96, -89}
+, {106, 407, -330}
+, {-128, 72, 487}
+, {91, -74, -221}
+, {69, 437, -197}
+, {-354, -100, -130}
+, {-442, 182, 246}
+, {411, 29, 278}
+, {-63, 113, 71}
+, {116, -23, -389}
+, {364, -69, 140}
+, {-366, 70, -113}
+, {358, 155, -268}
+, {-324, 72, 116}
+, {-39, -293, 194}
+, {295, -60, 400}
+, {-169, 128, 308}
+, {-187, -165, 132}
+, {195, 157, 41}
+, {-275, -331, -275}
+, {-21, 262, 442}
+, {-264, -201, 42}
+, {431, 89, 349}
+, {93, -88, -390}
+, {543, 202, 130}
+, {408, 394, 205}
+, {-27, 182, -390}
+, {-139, -318, 273}
+, {275, 293, 130}
+, {-179, -60, 370}
+, {199, -209, -140}
+, {-260, -179, 210}
+, {-251, -88, 119}
+, {-364, -368, -223}
+, {162, -132, 145}
+, {337, -324, 73}
+, {-231, 349, 44}
+, {-219, -365, 363}
+, {-412, 185, -346}
+, {-76, 322, 70}
+, {444, -120, 335}
+, {-259, -254, -29}
+, {-17, -99, 247}
+, {-395, -490, -395}
+, {-88, 233, -127}
+, {337, 324, -241}
+, {63, -266, 370}
+, {-327, -189, 229}
+, {290, 414, 275}}
+, {{-346, 105, -123}
+, {169, -340, -94}
+, {-534, 433, -48}
+, {131, 102, 440}
+, {-67, -111, 273}
+, {-414, -228, 18}
+, {-202, -4, -411}
+, {278, -339, -273}
+, {84, -186, -107}
+, {367, 291, 205}
+, {-390, 388, 204}
+, {-340, -384, 387}
+, {-33, 232, 352}
+, {-52, -201, 227}
+, {113, -73, 239}
+, {-245, 249, -108}
+, {378, -423, -213}
+, {59, 243, 150}
+, {-293, 322, 57}
+, {-362, 325, 345}
+, {315, -181, -65}
+, {-285, 280, 86}
+, {-115, 275, 86}
+, {420, -197, -59}
+, {-255, -305, 145}
+, {112, -250, 94}
+, {317, 7, -305}
+, {-136, 233, -290}
+, {-206, -222, -369}
+, {-99, 14, 108}
+, {147, -443, -176}
+, {-345, -531, 106}
+, {51, 76, -257}
+, {-266, -103, 119}
+, {447, 41, -326}
+, {385, -116, 107}
+, {132, -318, 130}
+, {-422, 146, 19}
+, {-77, 196, -247}
+, {-121, -7, 299}
+, {240, -203, -81}
+, {155, -340, -364}
+, {188, 258, -73}
+, {-379, -58, 102}
+, {364, 212, -17}
+, {37, 338, 179}
+, {341, -444, 211}
+, {-242, -479, -352}
+, {-158, 359, 343}
+, {-269, -192, 257}
+, {2, 278, -190}
+, {-111, -446, -218}
+, {55, 96, 408}
+, {379, 213, 330}
+, {-65, 149, 228}
+, {383, -339, 324}
+, {-316, 47, 283}
+, {68, 95, -38}
+, {115, 466, 309}
+, {44, 93, -324}
+, {-45, 293, 30}
+, {220, -178, -75}
+, {435, -41, 438}
+, {-176, -443, -119}}
+, {{18, -224, 24}
+, {22, -2, 174}
+, {161, -14, 44}
+, {-240, -211, 97}
+, {240, -85, -164}
+, {342, -8, 123}
+, {253, -107, -116}
+, {33, -227, -413}
+, {141, 385, 146}
+, {-146, -304, -440}
+, {217, -18, 361}
+, {-293, -418, 304}
+, {231, -186, -364}
+, {-11, 63, -337}
+, {-382, 288, -250}
+, {-67, 136, 417}
+, {-26, 265, 302}
+, {-444, -5, -351}
+, {-125, 240, -104}
+, {357, 345, 103}
+, {223, -300, 150}
+, {300, -155, -30}
+, {-410, -301, 243}
+, {284, 262, -116}
+, {-394, -239, 122}
+, {-329, 98, 467}
+, {338, 388, -69}
+, {-81, 313, -205}
+, {-160, 268, 464}
+, {23, -81, 43}
+, {61, -458, 138}
+, {207, 9, 557}
+, {-89, 303, 323}
+, {-151, 161, -231}
+, {196, -135, 93}
+, {-188, -316, -40}
+, {-329, -400, -88}
+, {420, -68, -112}
+, {201, -71, 374}
+, {-384, 277, -51}
+, {-233, -161, -239}
+, {-181, -109, 342}
+, {-119, -363, 204}
+, {143, 425, 148}
+, {-62, -203, 329}
+, {-96, 216, 224}
+, {-85, -51, 326}
+, {-253, 460, 447}
+, {265, 324, 144}
+, {-130, -305, 80}
+, {-196, 209, 14}
+, {299, 165, 71}
+, {90, -206, 410}
+, {354, -151, -159}
+, {224, -212, -88}
+, {-464, 22, 136}
+, {30, -203, 216}
+, {-141, -140, -122}
+, {-29, -140, 135}
+, {210, -371, -352}
+, {-378, -363, 231}
+, {-340, 62, 151}
+, {204, 90, 213}
+, {-3, 449, -224}}
+, {{248, -27, -302}
+, {-318, -291, 149}
+, {-12, 161, 229}
+, {70, 228, -225}
+, {17, 131, 405}
+, {-175, 196, -352}
+, {-372, -236, 387}
+, {335, -371, 230}
+, {112, 41, 468}
+, {228, -87, 245}
+, {-237, -62, -353}
+, {141, 69, -138}
+, {-88, -204, 266}
+, {144, 76, -222}
+, {294, 323, 170}
+, {-114, -379, -254}
+, {-77, 299, -429}
+, {-264, -49, -31}
+, {82, -109, 70}
+, {-126, -382, -184}
+, {-70, -360, -44}
+, {190, 124, 246}
+, {310, 129, -185}
+, {-162, 21, -185}
+, {124, -39, -203}
+, {249, 325, -334}
+, {60, 499, 83}
+, {29, 232, 361}
+, {444, 151, 55}
+, {-54, -72, -385}
+, {-158, -248, 432}
+, {139, 40, 372}
+, {-227, 126, 255}
+, {-242, -166, 89}
+, {-328, 259, -281}
+, {-208, -52, 301}
+, {-4, -350, -14}
+, {24, 15, -346}
+, {305, -182, 288}
+, {172, -149, 8}
+, {176, 85, -422}
+, {-5, -284, -316}
+, {390, 161, -103}
+, {-191, -49, -203}
+, {402, 360, -230}
+, {-73, -245, -92}
+, {-466, -385, 79}
+, {137, -97, -225}
+, {-372, -257, -96}
+, {-217, 233, -90}
+, {262, 25, 200}
+, {188, 16, 176}
+, {-48, -43, -395}
+, {100, -278, -496}
+, {127, 292, -35}
+, {20, -60, 197}
+, {176, -132, -223}
+, {324, -145, -329}
+, {280, 316, 130}
+, {-249, 181, 139}
+, {146, 130, -26}
+, {-294, 83, 282}
+, {-216, -192, -73}
+, {-347, 190, -3}}
+, {{64, 331, -99}
+, {153, -79, 204}
+, {182, 248, 201}
+, {447, 415, -376}
+, {-219, 427, -437}
+, {154, -208, 470}
+, {256, 210, -348}
+, {-194, 396, -222}
+, {43, 217, -369}
+, {128, 266, -67}
+, {50, 306, 164}
+, {-112, 177, 27}
+, {339, 238, 97}
+, {-572, -183, -401}
+, {-174, 424, 400}
+, {-1, -352, 183}
+, {-232, 46, 239}
+, {-151, -189, 526}
+, {-146, 295, -198}
+, {-65, 20, 246}
+, {-236, 51, 423}
+, {265, 23, -84}
+, {341, -345, -169}
+, {6, 268, 342}
+, {274, -36, -157}
+, {304, 212, -173}
+, {129, 247, 482}
+, {-91, 170, 272}
+, {286, 238, 437}
+, {-73, 428, 379}
+, {10, 16, -366}
+, {144, -198, 91}
+, {29, -351, 302}
+, {-3, 200, 191}
+, {-225, 188, -83}
+, {295, -364, 176}
+, {-249, -422, 325}
+, {-57, -335, -31}
+, {347, -137, -43}
+, {-147, 265, 227}
+, {-409, -312, -134}
+, {214, -121, -300}
+, {366, -321, 163}
+, {274, 115, 354}
+, {-44, -187, -122}
+, {-20, 86, -90}
+, {187, 425, -347}
+, {531, 223, -256}
+, {-520, -147, -263}
+, {-167, -205, -211}
+, {37, -427, -274}
+, {403, 503, 279}
+, {352, 204, -171}
+, {-137, 304, -40}
+, {-432, -43, -370}
+, {193, -30, 445}
+, {333, -328, -360}
+, {498, 252, 94}
+, {369, -15, -35}
+, {-20, 16, -366}
+, {27, -181, -146}
+, {152, 5, 340}
+, {-281, -21, 15}
+, {-140, 108, 106}}
+, {{274, 130, 493}
+, {402, -226, -82}
+, {-60, 146, 179}
+, {139, -282, 298}
+, {-295, 94, -370}
+, {-195, -128, 143}
+, {-77, -342, 181}
+, {-239, -37, 85}
+, {53, -431, -112}
+, {260, -225, 90}
+, {445, 108, 387}
+, {-220, -281, 71}
+, {21, -261, -355}
+, {-141, 160, -9}
+, {374, 291, 185}
+, {402, 73, -221}
+, {308, -58, -141}
+, {-173, 306, 173}
+, {-110, -150, 295}
+, {244, 370, 332}
+, {355, -376, -214}
+, {201, -276, -405}
+, {-191, -379, -29}
+, {292, 314, -330}
+, {399, -175, -120}
+, {536, 125, 525}
+, {440, 470, 506}
+, {474, -189, 468}
+, {320, 163, 431}
+, {371, 265, 493}
+, {-341, 249, -262}
+, {-334, 439, 8}
+, {13, -206, -368}
+, {-309, 1, 503}
+, {-139, -305, -53}
+, {-224, 338, 14}
+, {224, -281, -295}
+, {-320, 37, -346}
+, {424, 10, -198}
+, {-275, 326, -311}
+, {-325, -128, 347}
+, {7, 260, 276}
+, {-23, -193, -325}
+, {-322, 318, -341}
+, {201, -47, -46}
+, {-258, 239, -327}
+, {202, -32, -416}
+, {-161, -195, 429}
+, {-402, -308, -20}
+, {163, 62, 431}
+, {273, -243, -15}
+, {56, 399, 298}
+, {129, -237, -85}
+, {93, 179, 269}
+, {-171, 238, 308}
+, {-146, 27, 175}
+, {147, 112, -226}
+, {-134, 608, 585}
+, {408, -290, 68}
+, {20, 183, 414}
+, {-90, 253, 388}
+, {-375, 366, -230}
+, {-268, 259, -275}
+, {-97, 361, 212}}
+, {{-302, -294, 397}
+, {229, 428, -238}
+, {178, 475, 415}
+, {-196, -85, -5}
+, {359, -325, 19}
+, {-130, -351, -367}
+, {-291, -26, -279}
+, {-337, 21, 331}
+, {-210, -244, 260}
+, {271, -306, -156}
+, {-363, -204, 294}
+, {-54, -267, -169}
+, {295, -295, 157}
+, {-341, -117, -151}
+, {-383, 165, 30}
+, {413, 255, 269}
+, {176, -135, -62}
+, {366, 21, -105}
+, {96, -183, -53}
+, {390, 172, -151}
+, {-201, 317, 24}
+, {-140, -294, -233}
+, {-224, 225, -263}
+, {-286, -221, -134}
+, {415, 486, -139}
+, {141, 14, 148}
+, {41, -379, 221}
+, {-118, 60, -82}
+, {50, -242, 5}
+, {-43, -304, -352}
+, {225, 270, 185}
+, {-453, -361, 96}
+, {335, 46, 41}
+, {-433, 75, 211}
+, {-343, 324, -186}
+, {-87, -97, 50}
+, {112, -180, 23}
+, {-137, -308, 222}
+, {332, 443, -191}
+, {25, 459, 326}
+, {-115, 169, 176}
+, {250, 8, -127}
+, {-64, 249, 136}
+, {244, -96, -332}
+, {338, 166, 340}
+, {-290, 328, 52}
+, {-15, 73, -256}
+, {339, -9, -149}
+, {201, 416, 418}
+, {-115, -82, -202}
+, {380, 15, -48}
+, {-413, -325, -337}
+, {335, 284, 226}
+, {653, 431, 60}
+, {-154, -392, -179}
+, {480, 205, 356}
+, {-254, -89, -172}
+, {193, 206, -201}
+, {154, 623, -195}
+, {-355, 246, 177}
+, {247, -142, -170}
+, {-88, -384, 55}
+, {357, -319, 311}
+, {-275, 362, -387}}
+, {{-373, 44, -191}
+, {236, 364, 298}
+, {41, -391, 277}
+, {54, 339, -238}
+, {-212, -407, 378}
+, {113, -71, 409}
+, {-38, -388, 398}
+, {121, 341, 379}
+, {486, 147, 262}
+, {-464, -167, -24}
+, {-110, 345, 90}
+, {-409, -302, 0}
+, {-263, -20, 279}
+, {353, -150, -369}
+, {355, -44, -503}
+, {-21, -318, -206}
+, {-90, -378, 112}
+, {188, -124, -375}
+, {237, 130, -407}
+, {393, 88, -102}
+, {18, -196, 29}
+, {-107, 286, 268}
+, {191, -392, -152}
+, {-224, 154, -245}
+, {-154, -5, -159}
+, {-151, -176, 180}
+, {-402, -21, -309}
+, {-1, 335, -398}
+, {320, -352, -411}
+, {-298, -403, -13}
+, {-127, -76, -378}
+, {97, -289, -424}
+, {-96, 60, 212}
+, {58, -359, 112}
+, {123, 488, -51}
+, {74, 325, -323}
+, {192, 142, 227}
+, {299, -67, 250}
+, {-267, -35, -348}
+, {-342, 46, -152}
+, {-94, -183, -68}
+, {97, 285, -147}
+, {371, 423, -129}
+, {411, 194, -316}
+, {-287, 272, -136}
+, {-383, 74, 128}
+, {145, -87, 234}
+, {-179, 236, 74}
+, {-162, -113, -195}
+, {-94, -459, 44}
+, {292, -118, -195}
+, {-301, 82, -395}
+, {-201, 397, 332}
+, {277, 363, 78}
+, {206, 93, -343}
+, {-369, 305, -412}
+, {-6, 240, -125}
+, {223, 195, -175}
+, {-408, 263, -254}
+, {349, -42, -321}
+, {276, -200, 352}
+, {305, -289, -323}
+, {228, 330, 126}
+, {-328, 119, 46}}
+, {{-399, -521, -446}
+, {-3, -236, 232}
+, {-56, 450, 207}
+, {359, -301, 293}
+, {-118, -233, 382}
+, {374, 191, -315}
+, {-123, -140, -262}
+, {153, 148, -394}
+, {-359, -387, 204}
+, {-136, -273, 402}
+, {-100, -160, 304}
+, {66, 185, 298}
+, {-209, 390, 263}
+, {445, -210, 315}
+, {213, 262, -165}
+, {-164, 321, 353}
+, {85, 81, -272}
+, {326, 51, 126}
+, {316, -125, 204}
+, {17, 113, -113}
+, {281, -134, 293}
+, {450, 368, -97}
+, {240, -381, -163}
+, {-250, 330, 22}
+, {-11, 193, 58}
+, {-166, -323, 67}
+, {168, 464, 504}
+, {323, 160, -184}
+, {235, -340, -162}
+, {-234, -240, -209}
+, {286, 113, 294}
+, {82, 324, -40}
+, {326, -99, -15}
+, {249, 196, -268}
+, {-161, -235, 11}
+, {-139, 466, -203}
+, {226, -295, -354}
+, {359, -339, 378}
+, {13, -67, -408}
+, {160, 50, -356}
+, {-220, 340, -365}
+, {322, 383, 226}
+, {390, -66, 284}
+, {-7, -54, -105}
+, {487, -134, 43}
+, {207, -260, -372}
+, {-418, -276, 132}
+, {23, 130, 108}
+, {38, -37, 474}
+, {-79, 274, 152}
+, {178, 58, 96}
+, {-145, -93, -410}
+, {118, 376, 126}
+, {294, -275, -239}
+, {412, -207, 136}
+, {-21, 234, 136}
+, {196, -337, -102}
+, {-222, 30, -306}
+, {-133, 570, 259}
+, {-241, 225, -409}
+, {-34, 161, 17}
+, {402, -82, -201}
+, {-218, 200, -354}
+, {-388, -21, -69}}
+, {{-390, 103, 56}
+, {357, 232, 111}
+, {12, 347, 165}
+, {-101, 62, 13}
+, {-192, 147, -180}
+, {184, 145, 296}
+, {-198, 127, -168}
+, {-360, 317, 290}
+, {-144, -99, 205}
+, {-135, -186, -246}
+, {-412, 172, -389}
+, {62, -236, -119}
+, {-176, -376, -242}
+, {-179, -232, 413}
+, {21, -298, 64}
+, {131, 27, 306}
+, {-266, 349, 387}
+, {-413, -320, 171}
+, {219, 126, -204}
+, {-114, 269, -81}
+, {-303, -5, 404}
+, {292, 45, 81}
+, {-202, 116, -103}
+, {-497, -232, -437}
+, {290, 181, -304}
+, {-24, -405, -320}
+, {234, -66, -22}
+, {-246, 394, 263}
+, {27, -82, -60}
+, {58, -348, 314}
+, {-264, 7, 122}
+, {10, 82, 69}
+, {406, -423, 334}
+, {254, -62, -351}
+, {-359, -466, 258}
+, {-284, 441, -290}
+, {63, -90, -345}
+, {-281, -61, 153}
+, {-27, -100, -412}
+, {346, 459, 212}
+, {288, 88, -165}
+, {-48, 265, 24}
+, {-369, 304, 197}
+, {297, 50, -45}
+, {157, -277, 3}
+, {361, -345, 486}
+, {-59, -221, 241}
+, {-88, -428, 213}
+, {-122, 80, -46}
+, {-370, 30, -438}
+, {382, -283, 54}
+, {-291, -335, 111}
+, {-6, 104, 324}
+, {374, -17, 163}
+, {-184, 206, 398}
+, {-218, 109, -438}
+, {181, -367, -212}
+, {107, -103, 115}
+, {-294, -258, 28}
+, {235, -114, -337}
+, {-369, -199, 133}
+, {105, 227, 287}
+, {391, 429, -233}
+, {302, -36, 315}}
+, {{-191, -10, -311}
+, {65, -389, 224}
+, {-172, -43, -131}
+, {73, 138, -274}
+, {35, 443, 213}
+, {156, 485, 117}
+, {-94, 252, 3}
+, {-73, -189, 21}
+, {262, 119, 269}
+, {-478, 119, -161}
+, {70, 174, 74}
+, {391, 222, 109}
+, {78, -79, -408}
+, {240, -146, 130}
+, {412, -21, -363}
+, {-130, -326, 235}
+, {279, 155, -60}
+, {300, 88, -177}
+, {-352, -351, -114}
+, {156, -19, -376}
+, {-53, -224, 331}
+, {-38, -145, 90}
+, {-132, 75, -274}
+, {-134, 294, -305}
+, {17, 82, 73}
+, {86, 407, 194}
+, {156, 456, -48}
+, {145, 334, 191}
+, {-65, 96, -206}
+, {-411, 236, -229}
+, {149, -186, -250}
+, {-107, 607, 179}
+, {295, 7, -20}
+, {-363, -230, -50}
+, {-298, 218, 122}
+, {-352, -173, 49}
+, {-452, -284, 13}
+, {116, -377, -70}
+, {232, 48, 14}
+, {-303, 42, 325}
+, {438, 119, -25}
+, {-191, 386, 234}
+, {303, 366, -213}
+, {159, 462, -358}
+, {171, -413, 226}
+, {-63, 84, -119}
+, {-235, 135, -125}
+, {-80, 512, 265}
+, {79, 112, 37}
+, {-261, 184, 54}
+, {408, -69, -120}
+, {403, 101, 390}
+, {233, 66, 173}
+, {401, -147, 65}
+, {-355, -31, -386}
+, {-126, 186, 217}
+, {162, 347, -399}
+, {244, 190, 339}
+, {29, 256, 225}
+, {-81, -183, 351}
+, {90, -407, 361}
+, {38, -395, 379}
+, {126, -426, 36}
+, {324, -363, -247}}
+, {{-142, -44, 105}
+, {-189, 355, -238}
+, {283, -208, 151}
+, {-95, -186, 410}
+, {-216, -356, -57}
+, {84, -480, 55}
+, {-207, 154, -304}
+, {38, 40, -206}
+, {-196, 391, -147}
+, {369, -66, -144}
+, {-276, 285, -298}
+, {-278, 388, 374}
+, {-120, 34, 53}
+, {176, 172, -158}
+, {-294, -377, 216}
+, {248, -396, 348}
+, {207, -406, -486}
+, {-204, -97, -339}
+, {282, 383, 134}
+, {188, -204, 363}
+, {234, -84, -53}
+, {-84, -272, -304}
+, {148, -106, 300}
+, {-23, -254, -251}
+, {-312, -308, 392}
+, {-359, -428, 121}
+, {-213, 147, 481}
+, {-24, -31, 194}
+, {-362, 139, 20}
+, {224, 148, -24}
+, {-16, 354, 283}
+, {-325, -309, 31}
+, {310, 423, -349}
+, {-280, 51, -22}
+, {542, 58, 88}
+, {250, -36, -52}
+, {63, 168, -46}
+, {-343, -23, 86}
+, {102, -328, -355}
+, {-252, -303, -89}
+, {262, 315, 95}
+, {385, -20, 268}
+, {54, 230, -271}
+, {191, 350, 216}
+, {453, 57, 205}
+, {-66, -143, -255}
+, {171, 249, 373}
+, {2, -295, -289}
+, {4, 51, 411}
+, {-278, 266, -83}
+, {-89, 163, 295}
+, {-558, -494, -102}
+, {-163, 147, 440}
+, {-157, -344, -210}
+, {274, 321, 222}
+, {-59, -338, 285}
+, {156, 12, -345}
+, {28, -432, -381}
+, {-74, -148, 82}
+, {-65, 5, -351}
+, {-211, -66, -16}
+, {-11, -36, 68}
+, {439, 393, 310}
+, {218, -135, -43}}
+, {{-83, 295, 26}
+, {35, 138, -345}
+, {694, -176, -91}
+, {-20, -131, -260}
+, {10, -105, -245}
+, {218, 126, -270}
+, {421, -257, -198}
+, {114, 412, -319}
+, {204, -148, 528}
+, {-65, -181, -18}
+, {393, -439, -78}
+, {314, 379, -138}
+, {105, -356, 267}
+, {-192, 38, 547}
+, {-278, 20, 247}
+, {-236, 511, 175}
+, {389, 287, 68}
+, {-59, -330, 268}
+, {-97, -397, -138}
+, {484, -309, 292}
+, {448, -166, 371}
+, {-52, -253, -93}
+, {-238, -138, 165}
+, {186, 332, -362}
+, {-261, -184, -180}
+, {464, 384, -61}
+, {-294, 99, 85}
+, {-66, 281, 366}
+, {-150, -207, -82}
+, {-391, 32, -469}
+, {-46, -23, 408}
+, {136, -512, 308}
+, {-14, -219, -239}
+, {-99, -166, -137}
+, {-178, 109, -36}
+, {302, 437, 93}
+, {-281, 430, 189}
+, {478, 266, 444}
+, {-302, 384, 130}
+, {359, -329, 62}
+, {-227, 436, 428}
+, {90, -238, 114}
+, {-99, -301, -12}
+, {401, 415, 214}
+, {104, -474, 382}
+, {371, -7, -319}
+, {249, 57, -275}
+, {-303, 267, -464}
+, {88, 347, 193}
+, {-287, 279, -268}
+, {-368, 346, -423}
+, {-167, -473, -44}
+, {-211, 189, 283}
+, {-112, 441, -414}
+, {-214, 240, 251}
+, {24, 258, -67}
+, {-98, 203, 372}
+, {-406, -45, 111}
+, {-190, -276, 502}
+, {-284, 316, -304}
+, {-247, 62, -217}
+, {-73, -88, -380}
+, {-9, -349, -179}
+, {139, 417, -415}}
+, {{119, 265, 171}
+, {-173, 183, -216}
+, {150, -170, -91}
+, {117, -267, -169}
+, {-15, -173, -306}
+, {405, -325, -350}
+, {-218, -168, 139}
+, {-21, -21, 365}
+, {-156, -74, -16}
+, {-244, 456, -260}
+, {-174, 35, -33}
+, {317, -174, -280}
+, {-241, -86, -236}
+, {-41, 40, 79}
+, {310, -72, 113}
+, {-46, 439, -234}
+, {-291, -81, -199}
+, {-31, 299, -28}
+, {-285, -304, -301}
+, {140, 418, 321}
+, {-299, -17, 438}
+, {119, 369, -266}
+, {317, 117, 390}
+, {-269, -200, 30}
+, {358, -272, 234}
+, {221, 119, -57}
+, {-93, -559, -356}
+, {130, -92, -285}
+, {315, -438, -217}
+, {-101, -57, -158}
+, {324, -46, 69}
+, {-144, -409, -287}
+, {-320, -221, -188}
+, {-403, 83, -480}
+, {502, 103, 175}
+, {-77, 103, -344}
+, {98, -6, 56}
+, {-44, -251, 133}
+, {-119, 453, -25}
+, {-328, -117, -253}
+, {-317, -180, -265}
+, {-265, 249, -450}
+, {344, -131, 318}
+, {-6, -319, 201}
+, {-51, -102, 70}
+, {484, -35, 317}
+, {-365, -26, -23}
+, {-273, -324, 81}
+, {275, -41, 150}
+, {216, -131, 130}
+, {153, -338, -137}
+, {-198, 244, 460}
+, {213, 329, 292}
+, {-91, 390, 7}
+, {-280, 481, -296}
+, {-299, -247, -488}
+, {-4, 368, -252}
+, {378, -186, 306}
+, {-458, -413, -319}
+, {66, -206, 201}
+, {-97, -321, 169}
+, {350, 226, 275}
+, {-385, -358, 69}
+, {417, -318, 280}}
+, {{-484, -426, 99}
+, {-431, -80, 150}
+, {6, 172, 40}
+, {145, -159, -370}
+, {362, 256, 155}
+, {99, -89, -14}
+, {135, -331, -313}
+, {-235, -199, -160}
+, {-201, 259, -318}
+, {138, 233, 276}
+, {5, -219, 146}
+, {-243, 230, 294}
+, {396, 62, -191}
+, {-97, 110, 321}
+, {461, 322, 250}
+, {57, -101, 413}
+, {-47, 72, 276}
+, {142, -84, -122}
+, {-275, -352, 267}
+, {8, -148, 255}
+, {232, 330, 365}
+, {236, -371, -401}
+, {-10, 342, 7}
+, {-400, -19, -202}
+, {252, 166, -254}
+, {-303, -334, -202}
+, {-169, 407, -25}
+, {-33, -120, 124}
+, {268, -327, 491}
+, {-73, 50, -226}
+, {150, -271, -69}
+, {34, -214, -87}
+, {-295, -182, -346}
+, {-118, 494, -283}
+, {-430, 175, 145}
+, {-238, -226, 334}
+, {200, -62, 427}
+, {253, -85, 30}
+, {216, -76, -356}
+, {461, 83, 288}
+, {-372, 190, -282}
+, {276, 387, 90}
+, {250, -263, 69}
+, {-106, -123, -252}
+, {23, -278, -82}
+, {-7, 66, -382}
+, {-354, 256, 65}
+, {290, 145, -163}
+, {-362, -369, -47}
+, {62, 186, 431}
+, {-276, 381, 88}
+, {97, -359, 262}
+, {71, 93, -152}
+, {14, -473, -465}
+, {136, -251, -389}
+, {429, 250, 298}
+, {168, -264, 391}
+, {397, -190, 386}
+, {237, -108, -49}
+, {-246, 382, 302}
+, {-28, 321, 89}
+, {-310, -165, 40}
+, {374, 212, -125}
+, {204, -90, 55}}
+, {{-226, 47, -262}
+, {-338, -401, -178}
+, {-198, -260, -51}
+, {268, 422, 76}
+, {-350, -28, -5}
+, {111, 260, 184}
+, {-23, -184, -148}
+, {302, -376, -132}
+, {29, -346, 282}
+, {-81, -333, -193}
+, {-136, -250, 372}
+, {-146, -6, -469}
+, {-291, -170, 375}
+, {-149, -91, -233}
+, {28, 89, 203}
+, {211, 248, -133}
+, {-72, 126, -287}
+, {472, -260, 60}
+, {-288, -248, 292}
+, {-340, -237, -283}
+, {415, 316, -204}
+, {136, -289, 391}
+, {361, -360, 46}
+, {384, 51, 103}
+, {-413, -86, -214}
+, {-47, -102, -173}
+, {-306, 236, -391}
+, {233, -339, 85}
+, {123, 362, 14}
+, {306, 331, -256}
+, {193, -76, 224}
+, {267, 183, 65}
+, {460, -387, -311}
+, {272, 136, 8}
+, {422, -149, -17}
+, {-229, -313, 180}
+, {-212, -6, 65}
+, {-135, 77, -296}
+, {50, 364, 403}
+, {-178, -355, -393}
+, {-129, -248, 82}
+, {-238, -55, -82}
+, {442, 128, 306}
+, {127, 112, -164}
+, {-98, -307, 268}
+, {-166, 318, -340}
+, {23, -11, 37}
+, {300, 158, -113}
+, {-18, -555, -108}
+, {-389, 252, -455}
+, {372, 222, 233}
+, {231, -348, 284}
+, {330, 45, -299}
+, {135, 455, -276}
+, {239, 156, 291}
+, {-149, -156, -455}
+, {67, 419, 57}
+, {134, -201, 329}
+, {160, -156, 322}
+, {-56, -332, -40}
+, {-207, 195, 216}
+, {-120, -330, -338}
+, {346, -117, -13}
+, {-180, 278, -15}}
+, {{101, -72, -441}
+, {206, 80, 395}
+, {71, 91, 91}
+, {317, 423, 133}
+, {335, 369, -309}
+, {283, -322, 62}
+, {-244, 57, 58}
+, {121, 19, -130}
+, {-244, -297, -353}
+, {-62, 158, 344}
+, {231, 380, 345}
+, {-246, 149, 377}
+, {-185, -281, 144}
+, {-89, 238, -256}
+, {-135, 75, -325}
+, {-188, 203, 145}
+, {-30, 303, -383}
+, {68, -30, 177}
+, {-146, 274, -381}
+, {-249, 274, 119}
+, {-427, -256, 198}
+, {-37, -146, -169}
+, {236, 270, -63}
+, {-452, -16, -205}
+, {-112, -92, 255}
+, {490, 60, -49}
+, {492, 481, 455}
+, {-325, 104, -184}
+, {-30, -177, -48}
+, {354, 206, -59}
+, {-292, -297, 205}
+, {36, 206, 277}
+, {-10, -65, 342}
+, {411, 148, 450}
+, {-207, 219, -354}
+, {485, 93, -108}
+, {-179, -309, 336}
+, {-203, 190, 137}
+, {362, -227, -435}
+, {307, -68, 181}
+, {-91, 369, 77}
+, {-4, -149, 162}
+, {-54, 186, -94}
+, {370, -82, -372}
+, {-77, -391, 308}
+, {-168, -269, 152}
+, {326, 281, -15}
+, {-26, -319, 338}
+, {49, 193, 14}
+, {-148, -160, 137}
+, {1, -299, -64}
+, {339, 44, -131}
+, {83, 389, -276}
+, {328, 199, 30}
+, {57, -187, -213}
+, {101, -71, 203}
+, {88, -308, 270}
+, {-126, 144, -132}
+, {-42, 427, 574}
+, {-151, -69, -108}
+, {40, -141, -75}
+, {380, -130, 239}
+, {-417, -260, -320}
+, {-50, 195, -45}}
+, {{434, 141, -84}
+, {-234, -90, -145}
+, {459, 169, -60}
+, {-115, 346, -258}
+, {61, 11, -299}
+, {-111, 113, 233}
+, {-248, 48, 232}
+, {-252, -225, 116}
+, {-232, -275, -267}
+, {99, -188, -296}
+, {-71, -50, 365}
+, {-418, -346, 377}
+, {101, 141, 47}
+, {436, -47, -216}
+, {-29, 142, 299}
+, {219, 226, 394}
+, {292, 55, -58}
+, {350, 150, 13}
+, {-174, 266, 285}
+, {-273, -273, 372}
+, {331, 171, -244}
+, {-159, -15, -363}
+, {-272, 385, 99}
+, {276, 200, 265}
+, {-274, -49, -120}
+, {313, -431, -69}
+, {-464, -23, 309}
+, {-352, 281, -302}
+, {-341, -13, -359}
+, {26, -136, -138}
+, {150, -131, -365}
+, {-244, 135, 196}
+, {198, -346, -342}
+, {161, 143, 45}
+, {-71, 22, 207}
+, {213, 309, 511}
+, {305, 243, -349}
+, {-435, -284, 77}
+, {92, 125, -246}
+, {166, 486, -189}
+, {185, 33, -446}
+, {-419, 97, 247}
+, {151, -270, 110}
+, {299, -91, 173}
+, {67, -9, 288}
+, {148, -406, -251}
+, {-14, -330, -212}
+, {-216, 64, 125}
+, {329, -10, 48}
+, {170, 285, -274}
+, {-104, 373, 193}
+, {237, 119, 438}
+, {42, -126, -338}
+, {223, 175, 203}
+, {174, 379, 81}
+, {-343, -368, 44}
+, {403, -199, -79}
+, {-112, 310, 287}
+, {214, -255, 236}
+, {-384, 140, -327}
+, {13, 295, -355}
+, {-113, -260, 219}
+, {155, -36, -256}
+, {407, -374, 284}}
+, {{-32, -342, -367}
+, {12, -115, 177}
+, {-230, 48, 150}
+, {26, -381, 290}
+, {-145, 112, 12}
+, {-317, -69, 255}
+, {-29, 368, -223}
+, {24, 89, 174}
+, {-305, 94, -151}
+, {-171, 237, -39}
+, {-107, -207, -402}
+, {-286, -252, -90}
+, {-94, -279, -59}
+, {441, 515, -210}
+, {116, -203, -4}
+, {191, 177, 250}
+, {-359, -318, -102}
+, {-114, -292, -167}
+, {-171, 430, 156}
+, {-38, 26, 48}
+, {54, -393, 218}
+, {345, 227, 197}
+, {146, 201, -146}
+, {-340, -343, 425}
+, {-558, 153, -569}
+, {-468, 44, 293}
+, {32, 240, 311}
+, {-263, 229, -408}
+, {419, 144, 182}
+, {-205, 23, -434}
+, {375, 226, -182}
+, {431, -280, -220}
+, {334, 267, -147}
+, {322, -156, 196}
+, {29, 134, 367}
+, {286, -188, 27}
+, {-286, 322, 190}
+, {442, 276, -76}
+, {345, 373, 317}
+, {169, 35, 363}
+, {-289, 163, -81}
+, {457, 331, 285}
+, {-159, 120, -159}
+, {-86, -280, 279}
+, {-56, 322, 471}
+, {-323, 260, 272}
+, {-131, -459, 0}
+, {-369, 167, -418}
+, {-279, 307, 247}
+, {50, -483, 143}
+, {283, 288, 93}
+, {122, 149, 389}
+, {28, -264, 292}
+, {145, -274, 68}
+, {273, 57, 392}
+, {-35, 100, 190}
+, {-11, -357, 211}
+, {37, 111, -454}
+, {124, -58, -114}
+, {163, 135, 370}
+, {92, -225, 284}
+, {-87, 72, 370}
+, {378, -301, 100}
+, {-16, -109, -174}}
+, {{-94, 90, 405}
+, {-221, -86, 370}
+, {-298, 55, 235}
+, {324, -17, 456}
+, {354, -211, 44}
+, {-257, 154, 276}
+, {-90, -368, -174}
+, {76, 343, -119}
+, {-188, -147, 315}
+, {521, -311, 25}
+, {207, 51, 447}
+, {325, 234, 441}
+, {-289, -312, 364}
+, {-165, -93, -141}
+, {-245, 204, -238}
+, {-341, -388, -377}
+, {-195, 357, -224}
+, {-199, 195, 285}
+, {-172, -354, 89}
+, {368, -369, 168}
+, {63, -214, 336}
+, {39, 252, -355}
+, {259, 418, -77}
+, {545, -162, 70}
+, {109, -145, -131}
+, {-300, -113, 156}
+, {-174, 106, 27}
+, {353, 177, -200}
+, {119, -384, 94}
+, {-300, -319, -146}
+, {-148, -125, -17}
+, {17, 127, -510}
+, {29, 353, 391}
+, {-331, -278, -87}
+, {-166, -124, 445}
+, {-107, 317, 5}
+, {69, -337, -388}
+, {296, -199, 384}
+, {442, 151, -252}
+, {-263, -180, 36}
+, {-163, -380, -258}
+, {-158, 247, -105}
+, {-58, 409, -290}
+, {111, -263, 61}
+, {-232, -280, 293}
+, {264, -48, 320}
+, {-184, 182, 97}
+, {111, -360, -76}
+, {414, 62, -274}
+, {-158, 315, -338}
+, {412, 381, 318}
+, {170, 61, 111}
+, {136, 230, -238}
+, {-258, 7, -337}
+, {-327, -351, 151}
+, {-9, 7, -52}
+, {-382, -55, 235}
+, {17, -140, 288}
+, {314, 14, -4}
+, {-372, 194, 387}
+, {385, 46, 356}
+, {97, -372, 132}
+, {-124, -66, 17}
+, {-347, 129, -369}}
+, {{14, 115, -240}
+, {163, -324, -193}
+, {214, 184, 182}
+, {-258, 373, 10}
+, {-31, 52, 44}
+, {-49, -231, -143}
+, {354, -87, -200}
+, {-172, -264, 179}
+, {222, 466, -154}
+, {-7, -304, -11}
+, {59, 134, 74}
+, {14, 175, 225}
+, {172, -254, 21}
+, {282, 65, 435}
+, {142, -188, 368}
+, {308, -25, -343}
+, {-43, -313, -106}
+, {-54, -40, -216}
+, {-245, 5, -174}
+, {115, 407, -278}
+, {-125, 13, -262}
+, {23, 103, 419}
+, {235, 334, 337}
+, {-369, 216, -138}
+, {280, 82, 279}
+, {-141, -180, 38}
+, {-307, -328, 129}
+, {309, -83, -171}
+, {-435, -147, 133}
+, {-340, -462, -192}
+, {-254, -188, -112}
+, {-451, 117, -73}
+, {-385, 157, 159}
+, {-390, 402, -139}
+, {32, -211, 311}
+, {-299, 314, 301}
+, {272, -169, -102}
+, {-308, -342, 383}
+, {187, 87, 203}
+, {-183, -165, -124}
+, {-153, -336, 292}
+, {-8, -41, -282}
+, {-238, 222, -101}
+, {-130, -196, 115}
+, {-347, -77, 424}
+, {361, 365, -309}
+, {213, -274, 150}
+, {-40, 142, -330}
+, {-320, 80, -160}
+, {-134, 13, -148}
+, {437, 349, 239}
+, {-407, -203, 199}
+, {371, -98, -204}
+, {121, -282, 252}
+, {95, 402, -302}
+, {-204, 131, 425}
+, {326, -374, -183}
+, {-207, -115, -477}
+, {-426, 410, -3}
+, {360, -323, 182}
+, {178, -93, 321}
+, {194, -25, -301}
+, {-191, 300, 384}
+, {311, 95, 72}}
+, {{7, -217, 575}
+, {-305, -183, 202}
+, {151, 315, -405}
+, {-326, -56, -83}
+, {144, -298, 402}
+, {34, 312, 408}
+, {167, -292, -135}
+, {-134, -270, 196}
+, {-86, 430, -257}
+, {290, -108, 169}
+, {117, -459, -555}
+, {165, -356, 32}
+, {-132, -162, -31}
+, {-240, 251, 390}
+, {29, 420, 181}
+, {339, -177, 246}
+, {393, -279, 23}
+, {-88, 84, -231}
+, {-187, -237, -240}
+, {408, 230, 21}
+, {-430, 49, -54}
+, {92, 242, -44}
+, {368, 231, 29}
+, {-386, -66, -338}
+, {134, 225, -255}
+, {-171, 442, -19}
+, {-320, 206, -329}
+, {-69, -49, 39}
+, {-150, -43, -300}
+, {-119, 330, 198}
+, {433, -30, 62}
+, {272, 165, -314}
+, {-219, 241, -116}
+, {-110, -434, 247}
+, {197, -153, 461}
+, {308, -254, -135}
+, {-121, 63, 137}
+, {67, -119, -199}
+, {-19, 258, -148}
+, {278, 442, -182}
+, {-308, -26, 32}
+, {-43, 207, -75}
+, {-89, 205, 398}
+, {-122, 87, -269}
+, {86, -180, -24}
+, {-327, 253, 175}
+, {90, 97, 219}
+, {113, 189, 316}
+, {-222, -228, 144}
+, {-472, -48, 18}
+, {236, -59, 105}
+, {-211, -284, 499}
+, {69, 359, 9}
+, {2, 31, -213}
+, {38, 310, -350}
+, {315, -261, 276}
+, {-115, 139, -306}
+, {-177, 571, 359}
+, {74, -190, 102}
+, {-232, 266, -194}
+, {-123, 63, -85}
+, {-58, -288, -257}
+, {-83, 256, 178}
+, {-303, -179, -223}}
+, {{-330, -400, 110}
+, {-334, 82, -177}
+, {-167, -303, -57}
+, {-275, 134, -143}
+, {22, -287, -23}
+, {372, -236, 303}
+, {-236, -185, 6}
+, {-299, -139, -189}
+, {-420, -102, -36}
+, {-231, 116, 154}
+, {-312, 252, 25}
+, {-115, -25, -223}
+, {-166, 291, -44}
+, {-470, 134, -106}
+, {227, -172, -339}
+, {34, 214, 40}
+, {-431, -274, -378}
+, {31, 312, 471}
+, {-132, -134, -300}
+, {-99, -487, 332}
+, {-303, 197, 205}
+, {196, -146, 83}
+, {-451, -241, 2}
+, {-331, -432, -356}
+, {106, 46, -387}
+, {24, -80, 343}
+, {352, 207, -293}
+, {-184, 315, -49}
+, {-252, 112, 423}
+, {-311, -59, -256}
+, {35, 94, 387}
+, {-409, 215, 301}
+, {-176, 91, 175}
+, {107, 17, 89}
+, {312, 314, 146}
+, {-163, 436, -334}
+, {-134, -311, 161}
+, {-266, -227, -109}
+, {-330, 12, -408}
+, {58, 62, -245}
+, {285, 259, 424}
+, {283, 150, -364}
+, {-53, 238, 433}
+, {106, -283, 249}
+, {-323, -205, 299}
+, {26, 41, -205}
+, {-251, 295, -230}
+, {404, -236, 363}
+, {-202, -175, 110}
+, {272, 337, 300}
+, {-132, -305, 92}
+, {-362, 191, -215}
+, {-216, -179, -295}
+, {-321, -35, -432}
+, {-361, -207, 234}
+, {101, 52, 162}
+, {55, 354, 4}
+, {-60, -249, -149}
+, {197, 356, 310}
+, {146, -402, 355}
+, {274, -275, 300}
+, {-348, 349, 23}
+, {393, 74, 345}
+, {-337, -3, -446}}
+, {{-363, -147, 229}
+, {-95, 99, -435}
+, {-198, 145, -213}
+, {332, -293, 367}
+, {-95, 93, 213}
+, {305, -270, 401}
+, {337, 99, -229}
+, {-106, 206, 302}
+, {-372, 345, -75}
+, {171, -416, -435}
+, {525, 355, 60}
+, {97, 163, 239}
+, {-41, 422, 84}
+, {-99, 273, -516}
+, {384, 324, 32}
+, {113, -411, 252}
+, {-232, 91, -64}
+, {111, 110, 420}
+, {358, -213, -431}
+, {420, -139, 1}
+, {203, 150, 46}
+, {-298, -85, -19}
+, {124, -367, 302}
+, {34, -418, 294}
+, {-5, -158, 407}
+, {435, 433, 503}
+, {-136, 191, -13}
+, {260, 321, -206}
+, {14, 296, 237}
+, {-384, 358, 18}
+, {-217, -88, -295}
+, {-35, 315, -175}
+, {20, -220, -371}
+, {-78, 156, -154}
+, {-411, -142, -493}
+, {-383, -180, -104}
+, {-34, -242, 147}
+, {150, -414, 320}
+, {41, 318, -284}
+, {219, 187, 397}
+, {-52, -43, 44}
+, {-333, -303, -47}
+, {-160, -30, 340}
+, {-312, -3, -280}
+, {-249, 150, 288}
+, {-80, -437, -284}
+, {440, -269, 263}
+, {391, -28, 103}
+, {-359, -319, 327}
+, {84, 285, 256}
+, {10, -298, 84}
+, {320, 77, 494}
+, {9, 77, 400}
+, {354, 34, 177}
+, {-415, 308, -307}
+, {-273, 337, 312}
+, {369, -295, 169}
+, {506, -255, 565}
+, {-23, 23, -145}
+, {263, 91, -253}
+, {-122, 304, -186}
+, {167, -232, 174}
+, {277, -186, -37}
+, {-282, -61, -177}}
+, {{244, 193, 169}
+, {-309, 282, 102}
+, {-255, -66, 444}
+, {158, -89, -67}
+, {110, -300, 262}
+, {77, -268, -38}
+, {0, -160, -192}
+, {208, -329, -332}
+, {111, -122, 318}
+, {-212, 35, -358}
+, {-71, 31, -172}
+, {-111, 361, 57}
+, {229, 17, 198}
+, {-109, 48, -256}
+, {160, -182, -332}
+, {319, 78, 145}
+, {36, 10, 146}
+, {375, -258, 102}
+, {-6, 260, -87}
+, {115, 426, -283}
+, {-267, 323, 368}
+, {19, 185, -197}
+, {139, -269, 412}
+, {419, -111, -385}
+, {-25, 123, 205}
+, {128, -352, 67}
+, {-149, 221, -290}
+, {184, -81, -342}
+, {-228, -326, -302}
+, {-203, 268, -127}
+, {323, 384, 31}
+, {-120, -382, -490}
+, {-17, 368, -147}
+, {206, 356, 35}
+, {423, -145, 15}
+, {-17, -318, -150}
+, {384, 221, -224}
+, {159, -7, 387}
+, {352, 378, -291}
+, {59, -221, -290}
+, {141, -278, 214}
+, {-88, -473, -485}
+, {-97, -350, -339}
+, {-402, -18, 115}
+, {-244, 389, 227}
+, {265, 390, -379}
+, {133, -190, -229}
+, {205, -485, -113}
+, {416, 392, 512}
+, {150, -510, 111}
+, {341, -204, 67}
+, {-475, -536, 192}
+, {92, 9, -165}
+, {-150, 217, -206}
+, {204, -37, 217}
+, {-418, -385, 261}
+, {39, 172, 331}
+, {-73, -397, -211}
+, {2, -371, -5}
+, {260, -326, 41}
+, {-31, 144, 410}
+, {273, 229, -221}
+, {-194, 298, 223}
+, {-362, 298, -309}}
+, {{424, 129, -39}
+, {323, -264, 337}
+, {-228, -112, -319}
+, {-436, 177, -373}
+, {-324, 155, -122}
+, {261, 309, -232}
+, {387, -301, -268}
+, {24, 461, 383}
+, {-208, -18, -288}
+, {-140, 399, 380}
+, {67, 203, 460}
+, {-169, 469, 343}
+, {-304, 47, 339}
+, {-129, 2, -404}
+, {-205, -198, 32}
+, {197, -121, -121}
+, {-27, -33, -307}
+, {-185, 285, -496}
+, {172, 105, -121}
+, {123, 261, 351}
+, {-64, 130, 359}
+, {156, -89, -1}
+, {32, -45, 348}
+, {427, 323, -111}
+, {78, 320, 238}
+, {-237, 5, 376}
+, {245, -447, 206}
+, {140, -181, 212}
+, {2, -227, -79}
+, {-159, 429, -198}
+, {114, -338, 191}
+, {-230, 318, 7}
+, {-136, -147, 96}
+, {-1, -144, 3}
+, {578, -218, -247}
+, {106, 55, -122}
+, {-288, -134, -191}
+, {-180, 318, 225}
+, {142, 384, 486}
+, {-416, -270, -275}
+, {299, -157, -107}
+, {110, 165, 194}
+, {-314, 279, -312}
+, {310, 261, -58}
+, {-419, -88, -447}
+, {315, -348, -167}
+, {390, 51, 399}
+, {207, 39, -231}
+, {-368, -361, -229}
+, {432, -112, 419}
+, {355, 47, -156}
+, {-253, -135, 151}
+, {207, -37, -390}
+, {-399, -436, 10}
+, {-255, -138, -286}
+, {150, 236, -340}
+, {374, 443, -319}
+, {408, 252, -94}
+, {244, 226, -147}
+, {-333, -189, 334}
+, {33, 283, 203}
+, {-106, 188, 20}
+, {-185, -227, 39}
+, {221, 191, -61}}
+, {{-139, -70, 199}
+, {273, 327, 314}
+, {377, -333, -338}
+, {428, 319, -40}
+, {347, 388, 319}
+, {282, -362, 171}
+, {-210, 156, 278}
+, {73, -256, -377}
+, {-346, -225, 143}
+, {327, 237, 399}
+, {-23, 317, 478}
+, {326, 154, -299}
+, {376, 377, 56}
+, {-574, -295, 103}
+, {-318, -213, -138}
+, {-93, -193, 214}
+, {-117, -166, -247}
+, {-374, 353, 431}
+, {-297, -218, -216}
+, {-69, -281, -408}
+, {-343, -322, -307}
+, {160, 84, -256}
+, {-315, 282, 327}
+, {-332, 342, 226}
+, {126, -195, -180}
+, {272, 217, -226}
+, {-84, 379, 323}
+, {33, 372, -348}
+, {-356, -86, -288}
+, {116, -243, 26}
+, {-200, -179, 181}
+, {107, 76, 262}
+, {-366, 120, -127}
+, {135, -361, -310}
+, {147, 497, 516}
+, {-72, 231, -184}
+, {115, -348, 19}
+, {120, -38, -202}
+, {-22, -103, 19}
+, {-69, -469, 2}
+, {357, -24, -327}
+, {-209, 443, -220}
+, {79, 378, -231}
+, {-32, -383, 89}
+, {-431, 86, 362}
+, {262, -228, -84}
+, {456, 269, -120}
+, {-79, 322, -215}
+, {354, -377, 206}
+, {299, 541, 135}
+, {-233, -4, -378}
+, {349, -191, -419}
+, {11, 283, -68}
+, {440, -10, 124}
+, {57, 138, -358}
+, {123, -366, -92}
+, {73, -167, 339}
+, {-181, -308, 141}
+, {133, -20, 299}
+, {180, 153, 237}
+, {-104, 12, -256}
+, {-162, 164, 303}
+, {417, 210, 427}
+, {-57, -410, -25}}
+, {{434, 483, 418}
+, {118, -322, -68}
+, {400, 460, -158}
+, {396, 253, -413}
+, {-169, 125, 343}
+, {-327, 140, 120}
+, {-157, -395, 82}
+, {-111, 184, 193}
+, {306, 402, 130}
+, {-88, 119, -99}
+, {-259, 124, -426}
+, {164, -209, 366}
+, {284, -405, -36}
+, {104, 433, 165}
+, {-231, -81, 104}
+, {-125, 180, 248}
+, {195, -297, 11}
+, {509, 416, -42}
+, {317, -397, -132}
+, {275, -208, -256}
+, {-4, 290, 323}
+, {-318, 291, -167}
+, {350, 331, -395}
+, {-173, -30, 35}
+, {345, 16, 210}
+, {90, -341, 411}
+, {69, -90, -76}
+, {-102, -402, -387}
+, {331, -160, 231}
+, {-324, 322, -71}
+, {43, 496, -148}
+, {-399, -217, 260}
+, {149, -118, -99}
+, {239, 296, 219}
+, {89, 34, 269}
+, {191, -242, 482}
+, {19, -309, 222}
+, {271, 71, 128}
+, {386, -250, -196}
+, {165, -268, 462}
+, {-355, -157, -71}
+, {217, -333, 150}
+, {-207, -193, -122}
+, {-189, 69, -99}
+, {169, 356, 71}
+, {142, -280, -4}
+, {-6, -315, -179}
+, {-219, 254, -430}
+, {11, -31, -187}
+, {-130, 236, -267}
+, {78, 28, -260}
+, {121, -296, -341}
+, {-68, -420, 141}
+, {246, 504, -184}
+, {-213, 257, 420}
+, {-18, 382, 42}
+, {-223, 366, -274}
+, {-322, 248, 110}
+, {-323, 284, -161}
+, {71, 61, 262}
+, {241, 35, 282}
+, {135, -260, -94}
+, {212, -279, 231}
+, {-186, 379, -251}}
+, {{-70, 287, -373}
+, {311, -95, -407}
+, {-430, -54, -13}
+, {172, 325, 163}
+, {-74, 21, -62}
+, {31, -421, -85}
+, {176, -41, 368}
+, {-108, 121, -186}
+, {-164, 10, -73}
+, {335, -22, -142}
+, {129, -118, -3}
+, {-65, 182, 384}
+, {351, 200, -66}
+, {102, -277, 89}
+, {-305, 288, 141}
+, {-255, 108, 392}
+, {184, -73, -354}
+, {553, -56, 42}
+, {-335, -197, -218}
+, {358, 283, -389}
+, {0, 190, -399}
+, {-419, 99, 51}
+, {-406, -246, -71}
+, {193, -325, -121}
+, {143, 141, 179}
+, {-252, 155, 364}
+, {-303, 437, 73}
+, {-115, 283, -70}
+, {246, -183, -386}
+, {23, -200, 383}
+, {120, -146, 14}
+, {347, 0, 365}
+, {99, 241, -315}
+, {-235, 87, 378}
+, {-308, -218, -229}
+, {-230, -290, 130}
+, {408, 120, 381}
+, {-336, 11, -57}
+, {194, 328, 194}
+, {141, -244, 81}
+, {-219, 225, 133}
+, {401, -181, -169}
+, {354, 176, 29}
+, {-197, -114, -208}
+, {-212, -437, 248}
+, {127, 79, 105}
+, {-267, 63, 239}
+, {114, 181, -274}
+, {197, 226, -241}
+, {151, 318, -232}
+, {-34, -76, 267}
+, {153, 474, 211}
+, {-416, -257, 232}
+, {219, -28, -68}
+, {367, 65, 331}
+, {-314, 105, 72}
+, {272, 336, 368}
+, {274, 158, -270}
+, {-284, 189, 158}
+, {-282, -55, -131}
+, {-193, 77, -236}
+, {-130, 32, -403}
+, {-380, 307, 125}
+, {-239, 259, -449}}
+, {{352, 299, -92}
+, {235, -152, -166}
+, {486, -164, -277}
+, {9, 50, 261}
+, {294, 92, 15}
+, {-373, -327, -380}
+, {246, 398, 247}
+, {-368, 170, -144}
+, {-300, 14, 197}
+, {17, 215, 212}
+, {129, 443, -212}
+, {96, 367, -365}
+, {27, -105, 308}
+, {-116, 178, 373}
+, {-427, -323, 13}
+, {19, 222, 306}
+, {-131, -263, -232}
+, {-380, -101, -243}
+, {442, -42, 140}
+, {420, 206, -207}
+, {-242, 55, -427}
+, {142, 371, -86}
+, {200, -105, 203}
+, {500, 298, 161}
+, {-235, -117, -215}
+, {-23, -490, 64}
+, {252, -3, 426}
+, {351, -75, 281}
+, {255, -102, -35}
+, {-310, 357, 48}
+, {-391, -212, -70}
+, {-213, -100, 153}
+, {-388, 63, -125}
+, {-231, -123, -398}
+, {430, 231, -101}
+, {227, -80, 184}
+, {338, 376, -326}
+, {91, -77, 50}
+, {117, -131, -155}
+, {309, 140, -94}
+, {-122, -273, 351}
+, {-317, -148, 343}
+, {-3, -95, 209}
+, {-377, 281, -166}
+, {-31, 422, 3}
+, {-272, -82, -118}
+, {148, -26, 137}
+, {-160, -100, -87}
+, {171, 340, 520}
+, {280, -191, 219}
+, {329, -39, -368}
+, {171, 174, -289}
+, {175, -269, -56}
+, {-205, 74, 314}
+, {-246, -48, 181}
+, {304, -126, -276}
+, {379, 158, 228}
+, {-260, 174, -300}
+, {-194, 152, -62}
+, {273, -426, -309}
+, {333, -139, 333}
+, {65, 258, 239}
+, {-40, -13, -371}
+, {-94, -330, 168}}
+, {{-16, 285, 232}
+, {119, -68, -253}
+, {-189, 351, -54}
+, {265, 209, 262}
+, {75, 135, 239}
+, {0, 419, -49}
+, {117, 415, 383}
+, {-116, -37, 85}
+, {433, -129, -307}
+, {-363, 201, 322}
+, {41, 358, 145}
+, {-104, -16, -204}
+, {42, 370, 335}
+, {370, -232, 27}
+, {17, -377, -156}
+, {-270, 302, 40}
+, {-120, 91, -160}
+, {-244, -185, -520}
+, {122, 136, -81}
+, {-138, 339, 181}
+, {434, 442, -387}
+, {-201, 577, -305}
+, {-375, -387, -20}
+, {-313, 49, 0}
+, {518, -258, 589}
+, {-24, 139, 341}
+, {109, 333, -275}
+, {430, -76, 11}
+, {-68, -388, -90}
+, {-369, -48, -353}
+, {-500, -563, -437}
+, {-104, -341, -470}
+, {390, 104, -412}
+, {12, 375, -287}
+, {218, 94, 13}
+, {-5, 52, 28}
+, {-439, -227, 117}
+, {389, 440, 91}
+, {-311, 397, 327}
+, {236, -262, -20}
+, {53, -431, -217}
+, {352, 33, 191}
+, {439, -214, -187}
+, {-353, -392, 91}
+, {323, 213, -489}
+, {-81, -93, 151}
+, {160, 466, 296}
+, {-132, 262, 197}
+, {39, 246, -337}
+, {151, -424, -127}
+, {-44, 211, -49}
+, {-147, -225, -205}
+, {-144, -12, -231}
+, {-331, -160, 555}
+, {-395, -225, 86}
+, {-26, -15, -113}
+, {305, 80, -28}
+, {43, 5, -221}
+, {222, 245, 319}
+, {-272, -345, -31}
+, {272, -360, -130}
+, {153, 172, 224}
+, {405, -331, 65}
+, {-349, -274, -42}}
+, {{-224, -269, 307}
+, {121, -145, 229}
+, {-58, -372, -288}
+, {95, 119, -92}
+, {-241, -423, 164}
+, {366, 75, -205}
+, {452, 150, -57}
+, {109, 132, -214}
+, {-88, -347, 27}
+, {-422, -217, 40}
+, {381, 340, -306}
+, {265, 6, -80}
+, {38, 107, -7}
+, {81, -151, -485}
+, {180, 236, -25}
+, {54, 123, 208}
+, {82, -216, -65}
+, {-88, 149, 456}
+, {92, -295, 234}
+, {278, -170, 147}
+, {-35, 373, 83}
+, {27, -131, -294}
+, {145, 201, -338}
+, {273, 257, 129}
+, {-303, -59, 331}
+, {285, -311, 164}
+, {-120, 287, -422}
+, {396, 445, 397}
+, {-188, 279, -425}
+, {36, -242, -195}
+, {-387, 304, 150}
+, {22, 88, 243}
+, {-162, -81, 76}
+, {-264, -328, -193}
+, {-416, 285, -431}
+, {264, 326, -472}
+, {-417, 402, -167}
+, {285, -104, 50}
+, {-112, -265, -28}
+, {-424, -156, -434}
+, {-310, -220, -405}
+, {71, -140, 126}
+, {263, 251, 64}
+, {-427, 167, -430}
+, {-68, -120, -181}
+, {374, 17, 107}
+, {270, -143, 293}
+, {370, -414, 158}
+, {92, -74, -237}
+, {227, 69, -46}
+, {-226, -6, 240}
+, {174, -279, -288}
+, {-288, 37, 31}
+, {293, 118, 309}
+, {-146, -472, -244}
+, {-157, 293, 239}
+, {-292, 109, -179}
+, {-50, -77, 70}
+, {-207, 333, -129}
+, {343, 38, -171}
+, {348, 218, -321}
+, {-106, -47, 355}
+, {253, 384, -211}
+, {150, -13, -88}}}
+;
+
+#define DENSE_58_FORMATS
+#define DENSE_58_REQUANT_SHIFT 12 // input Q10, weights Q12, output and bias Q10
+
+const int16_t dense_58_bias[40] = {-18, 21, 29, 9, 8, 23, 26, 1, -5, -20, -9, 4, -19, -9, 1, 19, -16, 10, 19, 6, -11, 29, 16, 29, 9, -7, -2, 23, -12, 1, -21, 4, 30, 1, -2, -16, -17, -7, 3, -16}
+;
+
+const int16_t dense_58_kernel[40][128] = {{397, 255, -401, 498, -191, 33, 389, -72, -601, -109, 731, -82, -404, 327, -60, -687, -363, -493, 352, 120, 307, -80, 1017, -479, -821, -463, 552, 695, -572, -764, 54, 138, -437, 526, 249, -521, -206, 363, -674, 513, 287, -766, 169, 689, -117, -677, 931, 640, -375, 701, 702, -472, -176, -274, -598, 462, -73, -380, -561, -3, 926, -265, 450, 130, 118, -19, -404, 668, 607, -714, -757, 74, -234, 63, -344, 307, 520, -261, -637, -42, 534, -470, -567, 882, -231, 271, -203, -101, 770, -59, 359, -468, -618, -769, 327, 139, -356, -203, 35, -522, 306, 168, 146, 192, -391, 659, -425, 114, -239, 186, 116, 502, -452, 447, -671, -430, -292, 414, 289, 221, 290, 680, 20, -753, 356, -599, -403, 582}
+, {-571, 653, 480, -217, 698, -275, 148, -557, -69, 387, -404, 123, 467, 646, -395, 178, 5, 641, -359, -136, -25, 90, 713, 648, -493, -14, -487, 442, -355, 245, 728, -329, -373, 262, 77, 738, -46, 339, 343, -128, -699, -25, 44, 612, 129, -487, -187, -201, -218, -569, -292, 269, 600, 179, -695, -49, 547, -232, 140, -244, 532, -213, -539, 540, 156, -165, 580, 241, -186, -564, 587, 68, 469, 176, 394, 269, 545, 133, 175, 130, 96, -327, -622, 458, -695, 175, 744, 429, 644, -332, 373, -219, 854, -339, 623, -426, 123, -486, 450, -273, -161, 599, -24, 748, 279, -50, 652, -47, -600, -536, -106, 881, -515, -616, 383, 250, 295, -774, 153, -181, -234, -668, 405, 343, -370, 138, 622, 726}
+, {-482, 109, 895, 575, 532, 201, -642, 596, -380, 561, 464, -98, -659, -90, -201, 763, -456, -202, 479, 370, 656, -43, 671, -511, -550, -819, -612, 614, 64, 721, 278, -807, -128, -399, -17, -171, 197, 658, 488, -448, 611, 476, -28, 559, -661, 523, 164, -174, -289, -413, -589, -272, 326, -265, -165, -450, 160, 358, -755, 871, -599, 136, -266, -108, -349, -90, 505, -458, 166, 18, 383, -422, -355, -302, -620, -230, 324, -521, 317, 627, 278, 102, 172, 118, -642, -93, 218, -438, -108, -682, 174, -366, -598, 308, 103, 460, -503, -513, -328, 508, -40, -121, -376, 180, -600, -621, 386, 453, -152, 693, -436, -872, -18, 130, 387, 324, -161, -342, 513, 93, -564, 747, -252, 511, -454, 371, 755, -314}
+, {-545, -70, 123, -324, 289, -390, -641, 238, 605, -603, -413, 385, -474, 198, 658, 723, 555, -259, -477, -26, 659, -10, 267, -619, -725, 681, -98, 344, 48, 176, -208, 742, -162, -170, -757, 537, 317, -588, 430, 422, 56, -772, -817, 681, -715, -602, 894, 447, 547, -23, -801, -40, 563, -398, -365, 574, 142, 418, 743, 523, -366, 595, 125, -238, -305, 175, 427, 166, -708, 98, 483, -821, -359, 261, -719, -175, -200, -323, 389, -281, -663, -112, 26, -528, -64, -152, 634, -261, -572, 52, 639, 117, 241, 62, -33, -33, 469, -763, -500, 329, 204, 746, 587, -626, 254, 397, -135, -686, 713, 283, -250, -295, 636, 496, -149, 308, 213, 449, 170, 193, 304, -259, -153, 675, 874, -759, -598, -267}
+, {-220, -65, -462, -471, 488, -959, 154, -135, -569, -268, 601, 563, -405, -640, -621, -653, -521, 451, -424, 724, -582, -430, -124, -800, 339, -698, 240, -55, -217, -534, -347, 848, -648, 46, -695, 369, 574, -161, 218, 822, 330, -201, -387, 623, 417, 339, 852, -256, 342, 16, -666, 762, 413, 730, 479, -704, 139, 595, -332, 457, 62, 330, -396, 757, 592, 645, -575, 342, -342, -76, 487, -509, 37, 113, 80, 373, -407, 353, -339, -486, 344, -724, -552, 607, 442, 428, 234, -504, 64, -148, -786, -292, 79, 237, 299, -573, 80, -282, -230, 44, -689, 240, -78, -802, -127, 155, 501, -80, -563, 588, -275, 330, 559, 231, 90, -330, -670, 521, -390, 479, 389, 599, -357, -80, 125, -625, -382, -177}
+, {-192, -471, -644, 486, -105, -530, -179, -81, 822, 287, 172, 671, -657, 678, -502, -582, -295, -50, 225, 573, 469, 430, -866, 535, 445, 842, 529, 140, -393, 503, -636, 435, 264, 719, 276, -28, 712, -638, 125, 96, -227, -597, -515, 599, -227, 297, -611, -531, -28, -282, -483, -207, -717, -512, -759, 71, 812, -684, 566, -462, 158, -815, 94, 165, 312, -450, -774, 405, -460, 255, -506, 631, 121, 811, -285, 547, 332, -331, -495, -447, -302, -449, 533, 338, 719, 594, -129, -90, -431, 511, 321, 481, 848, -166, 786, 180, 256, 143, -471, 382, -596, 507, -127, -343, 156, -420, 293, 467, 530, -151, 290, 304, 698, 17, 101, 389, -225, -602, -32, 34, 291, -601, 560, -275, 738, -429, -74, -45}
+, {304, -517, -558, 611, -236, -260, -157, -209, 27, 146, -680, -635, -460, -583, 494, -426, 204, -648, 822, -817, 709, 16, -203, -622, 334, 259, -71, -255, -246, -97, 749, 343, 50, -723, 732, 103, 327, 343, 250, 280, 57, 117, -542, 536, -523, -666, -501, -737, 81, 407, -646, -335, 360, 612, 24, -407, 582, -264, -540, -406, 346, 497, -18, 435, -487, 614, -227, 688, -852, 353, 711, -601, 532, -575, -870, -214, -371, -79, 742, 444, 366, 226, 795, -473, -347, 418, 434, -334, -619, 559, 19, -525, 437, -392, 100, 534, -640, -331, 31, 656, 652, 43, 708, -759, 572, 142, 188, 556, -635, -607, 742, 450, 399, -370, -352, -270, -258, -514, -312, 477, 110, -293, 216, 718, -558, 98, -166, 158}
+, {445, -57, 657, -316, 740, -169, 109, 602, -214, 538, 180, 709, -471, 469, -571, 601, 285, -265, -707, -566, 720, -356, -210, -188, 477, -206, -196, 88, 591, 558, 186, -71, 767, 476, 299, -572, -338, 143, 195, -303, -510, 512, -136, -773, -243, 73, 707, -66, 619, -388, 446, 697, -160, -374, -476, 109, 161, 638, 409, 186, -429, 257, -197, 437, 476, -421, -361, 563, 240, 120, -136, -421, 70, 483, -12, 6, 639, 99, -531, -266, -594, -802, -634, -621, 95, 13, 101, -345, -727, -627, -249, -81, -682, -744, 126, -434, 219, -451, -479, -748, -103, 185, -204, -27, -715, -200, -732, -220, -635, 588, -518, -559, -144, -85, 687, 196, -487, 554, -345, -472, -665, -160, 245, 554, -242, 431, 14, -21}
+, {-15, 583, -864, 89, 712, -174, 292, -576, -860, 722, 350, 666, -139, 306, 222, 699, 425, -600, -41, 520, 169, -448, -208, -232, 277, 688, 646, -469, -443, -481, -453, 800, -533, -89, 430, -724, 737, -670, -432, 666, 498, -163, -184, 678, 298, 638, 524, -782, -251, -25, -381, 259, 341, -458, -612, 381, -115, 473, 50, -46, -738, -264, 20, 273, -190, -241, 495, -298, 786, -333, 861, 419, 137, 508, -662, 243, -587, -186, 491, -718, -496, -339, -169, -496, -652, -494, -299, 219, -314, -549, -311, -179, -426, 259, -306, -758, 259, 671, -194, 539, 355, -137, -268, 473, 595, 662, -188, 613, 665, 231, 41, -228, 484, 78, 562, -546, 673, 932, 143, -468, -100, -828, -546, 56, -643, -138, -72, -253}
+, {-104, -133, -530, -120, -548, 729, 132, 175, 240, 478, 474, 262, 615, -171, 657, -345, -290, 540, 645, 342, -750, -104, 409, 185, -503, 618, 649, -124, 137, -724, -142, -144, 319, -685, -647, -497, 71, 542, 662, 73, 308, -643, 143, -327, -375, -351, 53, -359, 283, -548, 756, 40, -353, -634, -46, 742, 156, -157, -746, 488, -149, 570, 468, 567, 337, 538, -202, -137, 26, -74, -477, 131, 407, 16, -548, 552, 644, 706, -54, 499, -343, -309, -598, 22, 327, -67, 176, -94, -600, 690, -83, -108, -409, 63, -683, 229, -746, 580, -618, 665, -715, 25, 443, -698, -327, -329, 563, -115, -576, 149, 768, -456, -428, -247, 171, 422, 406, -826, 118, -279, 281, 449, 701, 470, 548, 361, 52, -163}
+, {401, 501, -664, 219, 83, 806, 515, -609, 318, -105, 172, 169, -256, -80, -408, -765, -804, 218, -285, 1, 88, 748, -713, -408, 14, -567, -659, -829, 392, -245, 369, -473, -246, -294, -334, -286, -430, 697, 312, -228, -969, 725, -618, 696, 59, 703, 527, 627, -629, 24, 312, -657, -429, -497, 618, -255, -617, -345, -620, 137, -783, 518, 460, 439, 553, -709, -750, -140, 316, -55, -531, -278, 538, 682, -426, 305, 267, 131, -123, -461, 140, -796, 602, -285, 309, -332, 776, -95, 264, 731, -694, -609, 188, 801, -264, -591, 38, -8, -602, -7, -237, -648, 250, -366, 241, 225, -520, 552, 565, 116, -157, 124, 386, 288, 707, 675, 9, -14, 151, -632, 242, -709, -693, -607, 546, 382, 284, -281}
+, {-629, -238, 595, 217, -559, -103, 488, 603, 40, -325, 290, -648, 546, -409, 120, 86, -165, 384, 35, 471, 768, -257, -233, -470, 100, 197, 550, -168, 86, 559, 268, 731, -591, -70, -361, -342, -560, 572, -21, -493, -67, 606, 698, -737, 91, 515, -797, 237, -231, 412, -761, -725, -686, 45, 704, -765, -265, -462, -431, 851, 795, 176, 728, -667, -308, -458, 102, -361, -705, 448, 90, 408, -870, -430, -570, 711, -225, -492, 243, -349, 296, -364, 787, 555, 718, -603, -462, -401, -92, -202, 719, 455, -767, 28, 68, 165, -375, -798, -312, -561, -165, -78, -626, 562, -424, 298, -158, -737, -399, 385, 104, 31, 44, 459, 49, -686, 166, 460, -390, 313, 6, -187, 243, -400, 6, 383, -579, -309}
+, {-433, 630, 499, -195, 406, -329, 295, -428, -556, 210, -36, 170, 545, 281, 682, 577, 602, -33, 357, 396, 6, 635, 245, 558, 120, 323, 252, 228, -768, 354, 507, -863, -311, 79, -447, -768, -48, 436, -334, -414, 417, -270, 460, 746, 549, -613, 658, 885, -570, 126, -654, 217, 674, 582, 724, -457, -100, 404, -634, -637, 170, 724, 370, 146, 286, -263, 414, -733, 349, 290, 421, 482, -322, -376, -421, 145, -73, -388, 356, -8, -107, 235, 639, 118, -366, 228, -106, -773, 474, -163, 425, 348, 260, 517, 425, -810, -369, -302, -591, 151, 578, -21, 551, -663, -724, 208, -691, 517, -184, -322, -428, -854, -506, -581, 640, 268, -769, 236, 155, 324, -172, 595, 26, 193, 472, 545, 349, 221}
+, {417, 506, -406, -51, -186, 461, 521, -21, -97, 735, -258, -141, -219, 300, -499, 175, -382, 399, -308, -167, 147, -488, 6, -212, 180, 856, -600, -809, 48, -7, 507, 864, 551, -334, -60, -419, -5, 148, -480, 691, 493, 216, -709, 234, -327, -43, -722, 383, -524, -125, -763, -475, -498, -777, -86, -610, -842, -759, -413, -312, -611, -597, 688, 578, 722, -216, 128, 537, -174, -460, 727, 138, -346, 927, 252, 459, -930, 187, 259, 172, -87, -721, 491, -660, 683, 671, 626, -689, -68, -679, -572, 664, -351, 637, 368, -705, -107, 281, 726, 547, -141, -563, -63, -32, -536, -208, -729, 642, -675, 85, 184, 727, -408, 781, 670, 466, -619, 205, -168, -715, 412, -348, -751, -130, -730, 16, -800, 181}
+, {41, 84, 697, -565, -224, 226, 803, 381, 493, 16, 435, -294, 530, 754, 708, 121, -379, 442, 740, 72, -477, 407, 236, 381, -806, -511, -493, 517, -576, 241, 565, -521, 466, -425, -111, 653, 168, -615, 90, 364, -124, -584, 537, 271, -736, 97, 678, 375, 463, 469, 130, 287, -454, 115, 598, 98, -588, -17, -231, 0, -345, 673, 250, 367, -658, 360, 254, -467, -303, -571, -140, -61, -279, -101, -431, 240, -267, -5, 75, -319, -556, -252, 802, 25, 37, 508, -476, -219, -359, -275, 197, -521, 784, -601, -123, -345, -14, 225, 851, 315, -321, -784, -170, -212, -74, -340, -230, -391, -127, -27, -213, 239, 659, 58, -352, 484, 69, 648, -205, 643, 283, -178, 84, 193, -777, -16, 35, -556}
+, {246, -283, -575, -550, 638, -88, -154, 232, 701, -614, 136, 805, 545, 100, 849, 524, -461, 305, 179, 399, 177, 536, -597, -568, 558, 247, 456, 198, -666, -582, 74, -198, 463, -665, -138, 595, 124, -661, -739, -656, 301, 140, -179, -141, 719, -811, -50, 16, -241, -397, -531, 530, 38, 346, -536, 529, -103, -116, 749, 277, -396, 452, 329, -231, 123, 853, -171, 671, 693, -122, 128, -646, 245, 236, 643, 213, 411, 391, -740, 715, -332, -441, 110, -489, 26, -666, 351, 758, -52, 468, -575, -747, 307, -291, -569, 812, 243, -546, -451, -632, 702, -542, 279, -200, -309, -433, 528, -858, 617, 429, 18, 88, -28, -103, -689, -215, -49, 653, 567, 415, -743, -299, -451, 702, 81, 219, -410, -285}
+, {572, 347, 473, -548, -378, 486, 659, 491, 330, 217, -694, 563, -283, 299, 604, -210, -312, -509, -212, 219, -310, 292, 420, -768, -48, -168, 36, 48, -54, -220, 413, 427, 435, -323, 401, 766, 723, 370, -451, 41, 460, -761, 760, -416, -800, 644, 74, -669, -701, -790, 530, -432, 140, -636, -126, -396, -554, 224, -533, 193, -181, -244, 389, -774, -57, 436, 742, -390, 513, 720, -721, 351, 290, -766, 806, 26, -26, -7, 224, -262, 702, 221, 627, -262, 36, -555, -171, 397, -83, 664, -708, -32, -301, -550, -213, 755, -246, 487, -601, 394, 628, -850, 536, -303, -466, 622, 548, 363, -141, 597, -503, -431, 530, -578, 553, 661, 711, -417, 634, -541, 123, 345, 572, -399, -136, 143, 667, 616}
+, {-635, -4, 467, -336, -644, -241, -207, -201, -444, -754, 738, -386, 109, -337, 250, -158, -427, -539, 466, -441, 734, -735, 388, -713, -367, -183, -334, -655, -246, -652, 711, 267, -781, -51, -616, 392, -809, -482, -182, 348, 261, -137, -475, 321, -656, -180, 552, 675, -366, 190, -481, 557, -504, -239, 77, -152, 749, 270, -638, -507, 669, 734, 16, 202, -377, -460, 534, 725, 78, 223, 544, 140, -524, -763, -35, 262, 182, 14, 721, 725, -21, -602, -390, 141, 615, 589, -626, -159, 34, 405, -659, 223, 294, 415, 549, -644, 648, -672, -354, 14, -193, -140, -737, 411, 428, 396, -140, -300, -545, 813, 824, -485, -219, -439, 734, -524, -113, 130, 721, 248, -682, 516, 316, -391, -498, -271, -89, -259}
+, {-291, -874, 686, 581, -54, -242, -347, 830, 288, 286, 659, 687, -459, 454, -196, 109, 119, 147, -27, 108, 598, -142, -88, 534, 634, 720, 214, -183, -132, 887, 232, -93, -357, -60, -283, -405, 680, -546, -464, -439, -88, 209, -236, 219, 611, -170, 185, -789, -344, 408, -221, 759, 364, 165, 699, -28, 611, 367, -632, 117, -410, 772, -15, -59, 374, 679, 221, -82, 420, 592, 348, 283, -195, 122, 509, 339, 599, -489, -470, 483, -717, -393, -240, -569, -71, 35, 137, 608, 841, 380, 350, 212, 336, 406, -345, -400, 599, 527, 765, -689, 428, 534, 683, -620, 515, 198, -84, 461, -701, -388, -727, -201, -452, 517, 304, 520, 402, -244, -795, 699, -3, 788, 561, -749, 296, 108, 447, 351}
+, {204, -679, -98, -547, -115, -286, -648, 1100, 157, -231, 142, 400, 301, -486, -741, -536, 685, 290, 687, 337, -220, 628, -210, 183, -758, 244, -769, -198, -258, 697, 789, -589, 393, -576, -799, -477, 579, 643, -298, -506, -877, -676, 195, 37, 784, 604, 402, 4, 571, 318, 309, -724, 265, -419, -60, -252, 534, 360, -691, 798, 784, 841, -409, -332, 306, 655, -341, -68, -554, 349, -240, 133, -684, -113, -561, 310, -138, 617, 413, -519, -675, -689, 696, -587, -342, -64, 539, -442, 603, 526, 329, 720, -542, 672, 669, 527, -16, 669, -615, 110, 799, -133, -88, 163, 100, -767, -467, 101, -528, -763, 38, -360, 317, 115, -565, 585, -683, -328, 85, 139, -245, 728, 220, 724, 740, -194, -341, -218}
+, {504, 152, -92, 651, 135, -141, -115, 154, -351, -37, -511, 622, -304, 267, -509, -326, -313, 538, -59, 793, 241, 894, 580, 11, -149, -426, -130, -21, -174, -152, -184, -182, 581, 776, 754, 168, 387, -197, -121, -61, 193, 559, 764, -448, -632, 514, 430, 305, 64, 365, 474, -311, -387, -407, -223, -630, -268, -97, 351, 776, -234, 654, 37, -397, -463, -144, 743, -126, -412, -704, -332, 480, 639, 737, 706, 709, 515, 53, 412, 351, 276, -223, 754, -196, -632, 664, 92, 161, -244, -316, -736, 520, -387, -285, 759, 201, -75, -321, -460, 124, -660, -249, 243, 146, -121, -331, -725, 182, 747, -14, -469, -311, -813, -571, 339, 120, -396, 756, 912, 332, 719, -320, 439, -118, 412, -18, 108, -688}
+, {-192, -245, 279, 241, -445, 735, -331, 211, 357, -251, -182, -205, 30, 408, 34, -686, -478, -693, 53, -64, -424, -510, -232, 196, 49, 328, 141, -555, -217, -35, 82, -471, 209, 280, 779, 319, 33, 72, 423, 32, 496, 331, -444, -403, 316, 78, 172, 243, 493, 732, -45, 766, -811, -113, -523, -369, 691, 685, -709, 504, -618, -390, -304, 419, -123, 454, -414, -607, 31, 149, -112, -663, -70, -570, -659, 295, -378, -558, 619, 42, 451, -84, -353, -290, -707, -704, 427, 753, 17, -97, 375, 206, -148, -13, 265, -60, 377, -275, 593, -208, 708, 613, -658, -135, -736, 380, 43, 334, -111, -582, -27, 123, 74, 298, 498, 130, -40, 194, 319, 383, -473, 607, -547, -747, 87, 44, 596, -377}
+, {-495, -170, -369, -733, 532, 765, -800, -441, -104, -17, -808, 251, 490, 67, 277, 416, -832, 576, -413, -221, -130, 539, 123, 4, -167, -577, -408, 442, 20, -271, 212, 287, -499, 535, 177, 28, 860, 660, 209, 22, 391, -473, -316, 737, -276, -207, -4, -891, 29, 119, 283, -413, -425, 440, -225, -307, -274, -576, 638, -669, -179, 58, -689, -581, -469, 300, 502, 377, -202, 91, 474, 764, 274, 527, -255, -50, -440, -552, 87, 95, 385, -53, 266, -889, -280, 292, -724, 471, -24, -718, 416, 452, -18, -372, -165, -56, 324, -14, 6, -210, 222, 90, 596, -193, -206, 616, -76, -442, 839, -834, 445, -213, 321, -32, 39, 533, -226, -196, -211, 44, 201, -724, -691, 566, 934, -662, -36, -793}
+, {163, -506, -657, -681, 708, -846, 702, 687, -282, 631, 55, 214, -340, -209, 302, 734, 848, 273, -876, -535, -234, -595, 722, -115, 726, 370, -260, -30, -808, -519, 641, -426, 555, 508, 644, 439, -469, -528, 394, -705, -215, -382, -725, 522, 692, 484, 692, 157, 368, 136, -771, -456, 120, 436, -199, -129, 155, 64, 742, -673, -723, -433, 349, 210, -323, 390, -391, -481, 109, 114, -559, -649, -169, -592, -210, 595, 794, 178, 126, -555, 100, -807, -229, 310, 406, -572, 348, 116, 140, 204, -372, 694, -438, 643, 172, -277, 459, -480, 271, -799, -50, 829, -5, -469, 532, -762, 667, -716, 49, 629, -304, 545, -630, 465, -298, -448, 283, -328, 346, 406, 543, -524, 515, -181, -660, 746, -794, -439}
+, {366, -229, 139, -223, 626, 191, -601, 598, -607, 702, -200, 34, 113, -782, -128, 84, 571, -407, -504, -403, -128, 595, 319, 748, -161, 365, -697, 307, 639, -582, 317, 582, -56, 593, 38, -660, 693, -660, 382, 801, 705, -517, -280, -514, -318, 447, -637, -4, -657, -485, 100, -436, 590, -574, 382, 396, -553, -569, -564, -523, 220, -52, -269, -184, -640, 378, 658, 729, 172, -409, 585, 163, -624, -37, -465, -51, 236, 82, 440, 260, 20, 157, 192, -699, -753, -538, 541, -668, -148, 294, -210, 304, 174, 560, 726, -834, 472, 41, 217, -317, -459, 210, 260, -294, 491, -132, -386, -76, -365, 283, 85, 162, -85, 584, 145, -242, -222, 784, 740, 686, -384, -190, -788, 657, -780, 581, -491, -535}
+, {23, -415, -350, -767, -117, -606, 291, 617, 239, -52, 111, 431, 659, 452, 282, -312, -98, -428, -559, -334, 523, 561, 616, -598, -138, -300, -699, 825, 202, -607, -110, -891, 581, -214, 277, 170, -147, -209, 214, -765, -359, -294, -764, 304, 362, -360, -160, 554, 622, -657, -635, -696, -758, -124, 342, 647, 654, 67, 76, -664, 167, -28, -455, -517, -289, 26, 701, -786, -145, 280, -562, 491, -644, 308, 114, 479, 128, 148, -461, 398, -79, -657, -158, 653, 544, 496, 307, -667, -315, 503, -164, 92, 23, 439, -356, 392, -458, -58, 213, -554, -579, 388, -203, 593, -689, -577, -539, -193, 788, -504, -768, 485, 592, -425, -97, 110, 668, -217, 301, -285, -201, -63, 535, 481, 95, -623, 362, 380}
+, {312, -15, 624, -411, 625, -124, -389, 525, -612, 180, 96, 216, -456, -6, -440, -408, 193, 259, 661, -357, 216, -131, 378, 117, -513, -580, 224, 28, 309, 752, -200, -350, 33, -94, -47, 162, -187, -327, -379, -210, -72, 601, -582, -696, -362, -834, 234, -10, 128, 359, 266, -529, -308, 540, 737, 285, 483, -555, -357, -650, -30, -261, 252, -556, 297, -563, 152, 566, 260, -344, -264, 537, 401, -55, -658, 18, 766, -807, -605, 40, -784, -70, -629, -107, 252, -724, -110, -545, -283, 895, 661, 507, -340, 477, -127, 219, -241, -672, -149, 74, 769, 658, 843, 722, -633, -39, 138, -178, 309, 153, -699, -325, -126, -66, -692, -352, -12, 749, -443, 286, 238, -99, 729, -602, 544, -132, -6, 790}
+, {160, 4, 385, 53, 711, 436, 372, 78, -232, 580, 703, 302, -762, 567, 155, 557, 457, -498, 271, 659, -105, -339, 602, 389, -707, 599, -135, -454, 254, 322, -643, 25, -643, 297, -689, -259, -409, 431, -66, -805, 182, -120, -224, -275, -11, 173, 460, -542, -164, 218, -566, 51, 19, -675, 231, -784, 33, -448, -426, -152, 691, -148, 171, -43, 617, -508, -16, 727, -603, -634, 569, 554, 651, -425, -52, 702, 516, -179, 491, 700, 222, 179, -402, -712, -517, -752, 625, 631, 332, -295, 6, -714, -67, 327, 44, -503, -406, 249, 152, -724, 2, -400, 252, 270, -459, -47, -167, -158, -15, -722, -213, 440, 218, 313, -501, -357, -282, -255, 710, -151, 371, 336, -658, -153, -141, 567, 547, -365}
+, {578, 170, -760, -500, 302, 321, -408, -537, -249, 196, 203, 298, 35, 327, -220, 243, 631, -233, -608, -417, -87, 387, 636, -472, 376, 511, -29, 770, 323, -164, 666, -690, 440, 487, -441, 202, -614, -470, -41, 798, -298, 603, 704, -364, -427, -320, -566, 87, 267, 34, -114, -44, 219, -311, 273, 758, -762, 351, -763, 223, 516, 336, -796, -355, 132, -615, -553, -518, 446, -599, -753, -709, 151, -112, 1, 717, 121, -236, 260, -780, 125, 132, -104, 572, -563, 725, -169, -680, -99, 246, -797, -72, -342, 447, 553, -190, 602, 198, -23, -466, -770, -711, 431, 389, -196, 626, 461, -160, -373, 53, -730, -823, -816, 554, -267, -297, 58, 228, 456, -155, 536, 373, -662, 163, -632, -313, -177, 690}
+, {121, -275, 411, 592, -655, -511, 136, -442, 5, -352, -594, 271, 576, -234, -433, -545, -5, 282, 162, -365, -814, 441, -40, 267, 190, -427, 248, 170, -309, 529, 122, 454, -626, -237, -641, -149, 434, -156, 743, -221, -434, -319, 540, -161, 585, -276, -591, -123, -754, -444, 42, -190, -428, -795, 62, -419, -409, -334, 170, -257, -639, 682, -37, 330, 340, -537, 170, 70, 299, 210, 113, 802, -372, 216, -654, -354, 836, 31, -550, 732, 592, -546, -285, 585, -140, -700, -292, 698, 697, -304, 383, 339, -194, -654, -426, -19, -588, 813, 342, -553, 173, -52, -549, 226, 472, -170, 12, 397, 38, -452, 79, -446, 350, -730, 286, 394, 375, -107, 98, 673, 36, 680, 478, -779, 363, 272, 446, -218}
+, {695, 343, -361, 701, -443, 601, -527, 640, 466, 205, 468, -855, -573, -429, -465, -277, -542, 53, 325, -385, -398, -56, 448, -629, 580, 182, 80, 438, 796, 88, 249, 656, -461, -111, 628, 374, 554, -603, -690, -433, 752, 473, 558, 250, 161, -724, -632, 211, -905, 478, 533, -900, 439, -728, 209, 452, -724, -69, 288, -124, 138, -722, 401, -269, -768, -31, -333, -862, 53, 514, -340, 740, -286, 710, -639, -377, 171, -193, 747, 332, 102, 272, -96, 112, 171, 595, 201, -336, -676, 430, -6, -347, -566, -674, 174, 556, -641, -5, -717, -393, 157, -664, -176, 806, 648, 248, -442, 542, 590, 197, -794, 747, -280, -630, -380, 384, 524, 36, -124, -541, -609, -383, -82, 578, -330, 92, 955, 772}
+, {-47, -389, 981, 309, 516, 62, 23, 461, 313, -854, 468, 598, 249, 271, -444, 153, 634, -377, 98, -301, -377, -509, -249, 317, -218, 560, 416, -355, 103, 398, 178, -23, -452, -1, 367, -401, -585, 469, -908, -802, -776, 693, 203, -724, 200, 664, -107, 105, 292, 373, 427, 892, 782, -256, -709, -118, -250, 189, -1, -677, 419, -13, -243, -77, -96, 705, -321, 684, -480, 150, 486, 190, 89, -714, -2, -627, 274, -114, -233, 36, -124, -153, 629, 234, -572, 215, -491, 651, -272, 233, 782, 229, -702, -264, 407, -91, 71, 484, 911, -277, -26, 785, -673, 116, 424, -609, 296, -443, -694, -474, 497, -649, 141, -507, 234, 754, -5, 492, 77, 146, -374, 282, -604, -272, 439, -208, -438, 586}
+, {444, -157, -353, 197, -166, -176, -216, -49, -108, -196, 661, -603, -561, -778, 414, 580, -268, -519, 821, -686, 516, -77, -271, 407, 330, 610, -164, 9, -540, -437, 669, -699, 65, -229, 75, 50, -531, -463, -94, -200, -561, -584, -235, -74, 250, 604, -556, 325, 385, 436, 298, -398, -732, 321, 682, -291, 41, 363, -146, -192, 280, 77, -177, -429, -246, 781, -515, 768, -118, -228, 264, -109, -752, -518, -941, 506, 251, 618, 418, -142, 716, -599, -219, -82, -415, 603, -117, 610, -252, -562, 19, -320, 788, 659, 742, 459, -520, -57, 140, 604, -270, -25, -30, -783, 746, -204, -192, -99, -498, -750, -164, 186, 406, -696, -577, 277, -175, -382, 644, -730, -51, 377, 443, -765, -562, 121, -543, 253}
+, {-721, -300, -231, 763, 607, 348, 590, 103, -485, 99, -24, -14, -248, 742, 224, -261, -230, 47, 125, -593, -560, 435, 640, -576, 346, -493, 116, 678, 193, 425, -30, 437, 514, 653, -214, 287, -712, -599, 483, -146, -52, 21, -639, 256, -619, -451, -535, -109, 271, 470, 470, 569, 472, 802, -564, -372, -554, 657, 723, -29, -234, -51, 628, -400, -480, -553, 247, 253, -755, 194, -531, 335, -646, -651, 167, 83, -480, -394, 441, -767, -742, 658, -110, -40, 500, 300, -503, -454, -607, 485, 330, 236, 104, -456, -267, 665, -328, -139, -723, 876, 438, 905, -765, -294, -408, -389, -260, -725, -593, 576, -2, -59, 23, -359, 11, -451, -686, 726, -779, -695, -315, 688, 415, 186, 675, -506, -311, -134}
+, {-240, 163, -576, -152, 257, 668, 189, -419, 501, 238, -228, 239, 190, 782, 597, -362, -158, 5, 613, -685, 733, 296, 259, -374, -230, -846, 721, -51, 248, -178, -464, 11, 205, -542, -445, -776, -117, -512, 147, 428, 71, -609, 577, -765, 498, 658, 524, 806, -562, 276, -402, -156, 532, -284, 666, 694, 324, -31, -383, 52, 639, 366, 256, -336, 413, 685, -718, 134, -693, 326, -476, -562, 468, 147, -444, 274, -619, -705, -31, 616, -578, 254, 588, 264, 549, 496, -1, -422, 464, 347, 444, 343, -716, 172, -584, -72, 366, 300, -373, 258, 70, 128, -83, 363, -846, 299, 718, 353, 0, -565, 698, -226, -580, 560, -260, -591, -819, -417, -147, 199, -449, 158, 82, -461, 243, -179, 114, 534}
+, {-736, 321, 102, 25, 243, -222, 70, 11, 543, -193, -197, -470, -384, -440, -752, 298, -394, 312, 482, -741, -582, 849, -30, 616, -375, 163, 3, -406, -606, 598, -443, -599, 212, 233, 392, 121, -650, 539, -377, -336, -330, 635, -112, 401, 725, -191, 307, 477, 578, 135, 630, -137, -277, 578, -195, -247, -345, -349, -38, -419, -252, -708, 127, -562, 778, 36, 83, -140, -565, -671, 129, -952, -188, 832, 500, 190, -872, 757, 359, -504, 360, -553, 805, -658, -424, 795, 379, -722, 474, 430, 101, -307, -4, 308, 467, -331, 488, 535, -587, 5, -47, 359, 301, -294, 528, 335, -488, -448, -619, -137, -474, 415, 103, -279, -269, 447, -450, -23, 514, -607, -44, 494, 153, -410, -222, 442, -29, -312}
+, {691, 286, 218, 654, -9, 160, -343, -97, -640, -582, 149, 593, 476, -195, -715, -750, 19, 631, 389, 605, 9, 832, 331, 302, -102, 161, 717, 348, -262, 775, -247, -505, -669, 644, 37, 88, 314, 674, -659, -622, 267, -516, -576, -816, -540, 214, -210, 136, 17, -363, 579, 82, 804, 520, 722, 502, -360, 199, -51, 687, 42, -411, -22, -78, 496, 211, 572, -648, 812, 56, 352, -102, -207, 45, 424, 152, 445, 59, 16, 675, 211, -473, 251, -432, -327, 461, -119, -59, 260, 303, -422, -263, -659, -620, 591, -313, -635, -270, 18, 440, 471, -365, -425, -589, -321, -40, 144, 9, -599, 755, 617, 193, 584, -84, -574, 252, 247, -520, -468, -733, 89, 673, 629, 558, 276, 22, -147, -613}
+, {-267, -604, -306, -595, 336, -615, -571, -121, 300, -411, -51, 213, -607, -191, 236, -372, -809, 444, 730, 724, -184, -161, -25, -740, -165, 635, -583, -429, -273, -306, 566, -547, -397, -497, -474, 552, 299, 598, 656, 553, -460, 292, -128, 310, -771, 70, -105, 164, 330, -695, -498, 699, 511, -102, -596, 652, 107, 90, 760, -769, 614, -72, 606, -173, 477, 618, -5, -412, -323, 40, -478, 583, -370, -153, -171, 446, -469, 510, 446, 169, 560, 76, -57, -741, 259, 646, 294, -434, -360, 133, -727, -64, -662, 678, 23, -204, 154, -48, -360, 237, 377, -356, -535, 143, 19, 451, 97, -127, 298, -403, -97, 16, 433, -744, -498, -501, -473, -35, -891, -152, -778, 253, 189, -566, -24, -148, 646, 517}
+, {-335, 63, 660, 478, -25, -386, -178, 269, -752, -615, -467, -552, -376, 656, -7, 383, 42, -90, 658, -608, -478, -468, 577, -91, 256, 239, -8, 71, -26, 551, -483, 568, 574, -225, 148, -74, -810, -717, 287, 216, 535, 475, 456, -693, -539, 599, 508, -326, 315, 235, 410, 235, 181, 21, -182, 161, -634, 600, 258, 223, 234, 324, -373, -294, -267, 16, 183, 337, -780, -684, 365, -773, -51, -98, -439, -536, 853, -783, -381, -492, 709, 56, -47, 568, 736, 667, -109, -20, 315, 397, -96, -282, 129, 42, 606, -689, 606, -290, -757, 163, -238, 666, -210, 327, -580, 413, -575, 148, 623, -284, 277, -688, 157, -83, 352, 544, 534, 55, -100, -27, 262, 0, -361, -499, 873, 19, 214, 77}
+, {-500, -533, -354, -241, 9, 549, 386, 160, 406, 35, 348, 625, 296, -589, -378, -432, -700, 477, 305, -636, -456, -66, -289, -565, 420, -626, 422, -566, 578, 556, -719, -410, -553, -137, 41, -233, 678, 166, -423, -136, -572, 219, 193, -259, 526, -651, 382, -241, -804, -380, -38, -276, -175, -718, 226, 124, 721, 321, 720, 193, -736, 56, -630, 84, -49, -422, -790, -247, 94, 436, 383, -403, -111, 433, 288, 21, 595, -171, -785, -537, -317, -466, 230, 134, -394, -530, 535, -623, 759, -449, -359, 563, -434, 601, -414, 252, 564, 684, -444, -730, 182, 395, 584, 270, -169, -270, -404, -513, 262, 661, -455, 434, 782, 141, -235, 515, 551, 340, -20, 489, -93, -654, 465, -341, -357, 43, 265, 528}}
+;
+
+#ifdef CNN_SIMD
+#define DENSE_58_PANELS
+
+const int16_t dense_58_panels[5][64][16] = {{{397, 255, -571, 653, -482, 109, -545, -70, -220, -65, -192, -471, 304, -517, 445, -57}
+, {-401, 498, 480, -217, 895, 575, 123, -324, -462, -471, -644, 486, -558, 611, 657, -316}
+, {-191, 33, 698, -275, 532, 201, 289, -390, 488, -959, -105, -530, -236, -260, 740, -169}
+, {389, -72, 148, -557, -642, 596, -641, 238, 154, -135, -179, -81, -157, -209, 109, 602}
+, {-601, -109, -69, 387, -380, 561, 605, -603, -569, -268, 822, 287, 27, 146, -214, 538}
+, {731, -82, -404, 123, 464, -98, -413, 385, 601, 563, 172, 671, -680, -635, 180, 709}
+, {-404, 327, 467, 646, -659, -90, -474, 198, -405, -640, -657, 678, -460, -583, -471, 469}
+, {-60, -687, -395, 178, -201, 763, 658, 723, -621, -653, -502, -582, 494, -426, -571, 601}
+, {-363, -493, 5, 641, -456, -202, 555, -259, -521, 451, -295, -50, 204, -648, 285, -265}
+, {352, 120, -359, -136, 479, 370, -477, -26, -424, 724, 225, 573, 822, -817, -707, -566}
+, {307, -80, -25, 90, 656, -43, 659, -10, -582, -430, 469, 430, 709, 16, 720, -356}
+, {1017, -479, 713, 648, 671, -511, 267, -619, -124, -800, -866, 535, -203, -622, -210, -188}
+, {-821, -463, -493, -14, -550, -819, -725, 681, 339, -698, 445, 842, 334, 259, 477, -206}
+, {552, 695, -487, 442, -612, 614, -98, 344, 240, -55, 529, 140, -71, -255, -196, 88}
+, {-572, -764, -355, 245, 64, 721, 48, 176, -217, -534, -393, 503, -246, -97, 591, 558}
+, {54, 138, 728, -329, 278, -807, -208, 742, -347, 848, -636, 435, 749, 343, 186, -71}
+, {-437, 526, -373, 262, -128, -399, -162, -170, -648, 46, 264, 719, 50, -723, 767, 476}
+, {249, -521, 77, 738, -17, -171, -757, 537, -695, 369, 276, -28, 732, 103, 299, -572}
+, {-206, 363, -46, 339, 197, 658, 317, -588, 574, -161, 712, -638, 327, 343, -338, 143}
+, {-674, 513, 343, -128, 488, -448, 430, 422, 218, 822, 125, 96, 250, 280, 195, -303}
+, {287, -766, -699, -25, 611, 476, 56, -772, 330, -201, -227, -597, 57, 117, -510, 512}
+, {169, 689, 44, 612, -28, 559, -817, 681, -387, 623, -515, 599, -542, 536, -136, -773}
+, {-117, -677, 129, -487, -661, 523, -715, -602, 417, 339, -227, 297, -523, -666, -243, 73}
+, {931, 640, -187, -201, 164, -174, 894, 447, 852, -256, -611, -531, -501, -737, 707, -66}
+, {-375, 701, -218, -569, -289, -413, 547, -23, 342, 16, -28, -282, 81, 407, 619, -388}
+, {702, -472, -292, 269, -589, -272, -801, -40, -666, 762, -483, -207, -646, -335, 446, 697}
+, {-176, -274, 600, 179, 326, -265, 563, -398, 413, 730, -717, -512, 360, 612, -160, -374}
+, {-598, 462, -695, -49, -165, -450, -365, 574, 479, -704, -759, 71, 24, -407, -476, 109}
+, {-73, -380, 547, -232, 160, 358, 142, 418, 139, 595, 812, -684, 582, -264, 161, 638}
+, {-561, -3, 140, -244, -755, 871, 743, 523, -332, 457, 566, -462, -540, -406, 409, 186}
+, {926, -265, 532, -213, -599, 136, -366, 595, 62, 330, 158, -815, 346, 497, -429, 257}
+, {450, 130, -539, 540, -266, -108, 125, -238, -396, 757, 94, 165, -18, 435, -197, 437}
+, {118, -19, 156, -165, -349, -90, -305, 175, 592, 645, 312, -450, -487, 614, 476, -421}
+, {-404, 668, 580, 241, 505, -458, 427, 166, -575, 342, -774, 405, -227, 688, -361, 563}
+, {607, -714, -186, -564, 166, 18, -708, 98, -342, -76, -460, 255, -852, 353, 240, 120}
+, {-757, 74, 587, 68, 383, -422, 483, -821, 487, -509, -506, 631, 711, -601, -136, -421}
+, {-234, 63, 469, 176, -355, -302, -359, 261, 37, 113, 121, 811, 532, -575, 70, 483}
+, {-344, 307, 394, 269, -620, -230, -719, -175, 80, 373, -285, 547, -870, -214, -12, 6}
+, {520, -261, 545, 133, 324, -521, -200, -323, -407, 353, 332, -331, -371, -79, 639, 99}
+, {-637, -42, 175, 130, 317, 627, 389, -281, -339, -486, -495, -447, 742, 444, -531, -266}
+, {534, -470, 96, -327, 278, 102, -663, -112, 344, -724, -302, -449, 366, 226, -594, -802}
+, {-567, 882, -622, 458, 172, 118, 26, -528, -552, 607, 533, 338, 795, -473, -634, -621}
+, {-231, 271, -695, 175, -642, -93, -64, -152, 442, 428, 719, 594, -347, 418, 95, 13}
+, {-203, -101, 744, 429, 218, -438, 634, -261, 234, -504, -129, -90, 434, -334, 101, -345}
+, {770, -59, 644, -332, -108, -682, -572, 52, 64, -148, -431, 511, -619, 559, -727, -627}
+, {359, -468, 373, -219, 174, -366, 639, 117, -786, -292, 321, 481, 19, -525, -249, -81}
+, {-618, -769, 854, -339, -598, 308, 241, 62, 79, 237, 848, -166, 437, -392, -682, -744}
+, {327, 139, 623, -426, 103, 460, -33, -33, 299, -573, 786, 180, 100, 534, 126, -434}
+, {-356, -203, 123, -486, -503, -513, 469, -763, 80, -282, 256, 143, -640, -331, 219, -451}
+, {35, -522, 450, -273, -328, 508, -500, 329, -230, 44, -471, 382, 31, 656, -479, -748}
+, {306, 168, -161, 599, -40, -121, 204, 746, -689, 240, -596, 507, 652, 43, -103, 185}
+, {146, 192, -24, 748, -376, 180, 587, -626, -78, -802, -127, -343, 708, -759, -204, -27}
+, {-391, 659, 279, -50, -600, -621, 254, 397, -127, 155, 156, -420, 572, 142, -715, -200}
+, {-425, 114, 652, -47, 386, 453, -135, -686, 501, -80, 293, 467, 188, 556, -732, -220}
+, {-239, 186, -600, -536, -152, 693, 713, 283, -563, 588, 530, -151, -635, -607, -635, 588}
+, {116, 502, -106, 881, -436, -872, -250, -295, -275, 330, 290, 304, 742, 450, -518, -559}
+, {-452, 447, -515, -616, -18, 130, 636, 496, 559, 231, 698, 17, 399, -370, -144, -85}
+, {-671, -430, 383, 250, 387, 324, -149, 308, 90, -330, 101, 389, -352, -270, 687, 196}
+, {-292, 414, 295, -774, -161, -342, 213, 449, -670, 521, -225, -602, -258, -514, -487, 554}
+, {289, 221, 153, -181, 513, 93, 170, 193, -390, 479, -32, 34, -312, 477, -345, -472}
+, {290, 680, -234, -668, -564, 747, 304, -259, 389, 599, 291, -601, 110, -293, -665, -160}
+, {20, -753, 405, 343, -252, 511, -153, 675, -357, -80, 560, -275, 216, 718, 245, 554}
+, {356, -599, -370, 138, -454, 371, 874, -759, 125, -625, 738, -429, -558, 98, -242, 431}
+, {-403, 582, 622, 726, 755, -314, -598, -267, -382, -177, -74, -45, -166, 158, 14, -21}
+}
+, {{-15, 583, -104, -133, 401, 501, -629, -238, -433, 630, 417, 506, 41, 84, 246, -283}
+, {-864, 89, -530, -120, -664, 219, 595, 217, 499, -195, -406, -51, 697, -565, -575, -550}
+, {712, -174, -548, 729, 83, 806, -559, -103, 406, -329, -186, 461, -224, 226, 638, -88}
+, {292, -576, 132, 175, 515, -609, 488, 603, 295, -428, 521, -21, 803, 381, -154, 232}
+, {-860, 722, 240, 478, 318, -105, 40, -325, -556, 210, -97, 735, 493, 16, 701, -614}
+, {350, 666, 474, 262, 172, 169, 290, -648, -36, 170, -258, -141, 435, -294, 136, 805}
+, {-139, 306, 615, -171, -256, -80, 546, -409, 545, 281, -219, 300, 530, 754, 545, 100}
+, {222, 699, 657, -345, -408, -765, 120, 86, 682, 577, -499, 175, 708, 121, 849, 524}
+, {425, -600, -290, 540, -804, 218, -165, 384, 602, -33, -382, 399, -379, 442, -461, 305}
+, {-41, 520, 645, 342, -285, 1, 35, 471, 357, 396, -308, -167, 740, 72, 179, 399}
+, {169, -448, -750, -104, 88, 748, 768, -257, 6, 635, 147, -488, -477, 407, 177, 536}
+, {-208, -232, 409, 185, -713, -408, -233, -470, 245, 558, 6, -212, 236, 381, -597, -568}
+, {277, 688, -503, 618, 14, -567, 100, 197, 120, 323, 180, 856, -806, -511, 558, 247}
+, {646, -469, 649, -124, -659, -829, 550, -168, 252, 228, -600, -809, -493, 517, 456, 198}
+, {-443, -481, 137, -724, 392, -245, 86, 559, -768, 354, 48, -7, -576, 241, -666, -582}
+, {-453, 800, -142, -144, 369, -473, 268, 731, 507, -863, 507, 864, 565, -521, 74, -198}
+, {-533, -89, 319, -685, -246, -294, -591, -70, -311, 79, 551, -334, 466, -425, 463, -665}
+, {430, -724, -647, -497, -334, -286, -361, -342, -447, -768, -60, -419, -111, 653, -138, 595}
+, {737, -670, 71, 542, -430, 697, -560, 572, -48, 436, -5, 148, 168, -615, 124, -661}
+, {-432, 666, 662, 73, 312, -228, -21, -493, -334, -414, -480, 691, 90, 364, -739, -656}
+, {498, -163, 308, -643, -969, 725, -67, 606, 417, -270, 493, 216, -124, -584, 301, 140}
+, {-184, 678, 143, -327, -618, 696, 698, -737, 460, 746, -709, 234, 537, 271, -179, -141}
+, {298, 638, -375, -351, 59, 703, 91, 515, 549, -613, -327, -43, -736, 97, 719, -811}
+, {524, -782, 53, -359, 527, 627, -797, 237, 658, 885, -722, 383, 678, 375, -50, 16}
+, {-251, -25, 283, -548, -629, 24, -231, 412, -570, 126, -524, -125, 463, 469, -241, -397}
+, {-381, 259, 756, 40, 312, -657, -761, -725, -654, 217, -763, -475, 130, 287, -531, 530}
+, {341, -458, -353, -634, -429, -497, -686, 45, 674, 582, -498, -777, -454, 115, 38, 346}
+, {-612, 381, -46, 742, 618, -255, 704, -765, 724, -457, -86, -610, 598, 98, -536, 529}
+, {-115, 473, 156, -157, -617, -345, -265, -462, -100, 404, -842, -759, -588, -17, -103, -116}
+, {50, -46, -746, 488, -620, 137, -431, 851, -634, -637, -413, -312, -231, 0, 749, 277}
+, {-738, -264, -149, 570, -783, 518, 795, 176, 170, 724, -611, -597, -345, 673, -396, 452}
+, {20, 273, 468, 567, 460, 439, 728, -667, 370, 146, 688, 578, 250, 367, 329, -231}
+, {-190, -241, 337, 538, 553, -709, -308, -458, 286, -263, 722, -216, -658, 360, 123, 853}
+, {495, -298, -202, -137, -750, -140, 102, -361, 414, -733, 128, 537, 254, -467, -171, 671}
+, {786, -333, 26, -74, 316, -55, -705, 448, 349, 290, -174, -460, -303, -571, 693, -122}
+, {861, 419, -477, 131, -531, -278, 90, 408, 421, 482, 727, 138, -140, -61, 128, -646}
+, {137, 508, 407, 16, 538, 682, -870, -430, -322, -376, -346, 927, -279, -101, 245, 236}
+, {-662, 243, -548, 552, -426, 305, -570, 711, -421, 145, 252, 459, -431, 240, 643, 213}
+, {-587, -186, 644, 706, 267, 131, -225, -492, -73, -388, -930, 187, -267, -5, 411, 391}
+, {491, -718, -54, 499, -123, -461, 243, -349, 356, -8, 259, 172, 75, -319, -740, 715}
+, {-496, -339, -343, -309, 140, -796, 296, -364, -107, 235, -87, -721, -556, -252, -332, -441}
+, {-169, -496, -598, 22, 602, -285, 787, 555, 639, 118, 491, -660, 802, 25, 110, -489}
+, {-652, -494, 327, -67, 309, -332, 718, -603, -366, 228, 683, 671, 37, 508, 26, -666}
+, {-299, 219, 176, -94, 776, -95, -462, -401, -106, -773, 626, -689, -476, -219, 351, 758}
+, {-314, -549, -600, 690, 264, 731, -92, -202, 474, -163, -68, -679, -359, -275, -52, 468}
+, {-311, -179, -83, -108, -694, -609, 719, 455, 425, 348, -572, 664, 197, -521, -575, -747}
+, {-426, 259, -409, 63, 188, 801, -767, 28, 260, 517, -351, 637, 784, -601, 307, -291}
+, {-306, -758, -683, 229, -264, -591, 68, 165, 425, -810, 368, -705, -123, -345, -569, 812}
+, {259, 671, -746, 580, 38, -8, -375, -798, -369, -302, -107, 281, -14, 225, 243, -546}
+, {-194, 539, -618, 665, -602, -7, -312, -561, -591, 151, 726, 547, 851, 315, -451, -632}
+, {355, -137, -715, 25, -237, -648, -165, -78, 578, -21, -141, -563, -321, -784, 702, -542}
+, {-268, 473, 443, -698, 250, -366, -626, 562, 551, -663, -63, -32, -170, -212, 279, -200}
+, {595, 662, -327, -329, 241, 225, -424, 298, -724, 208, -536, -208, -74, -340, -309, -433}
+, {-188, 613, 563, -115, -520, 552, -158, -737, -691, 517, -729, 642, -230, -391, 528, -858}
+, {665, 231, -576, 149, 565, 116, -399, 385, -184, -322, -675, 85, -127, -27, 617, 429}
+, {41, -228, 768, -456, -157, 124, 104, 31, -428, -854, 184, 727, -213, 239, 18, 88}
+, {484, 78, -428, -247, 386, 288, 44, 459, -506, -581, -408, 781, 659, 58, -28, -103}
+, {562, -546, 171, 422, 707, 675, 49, -686, 640, 268, 670, 466, -352, 484, -689, -215}
+, {673, 932, 406, -826, 9, -14, 166, 460, -769, 236, -619, 205, 69, 648, -49, 653}
+, {143, -468, 118, -279, 151, -632, -390, 313, 155, 324, -168, -715, -205, 643, 567, 415}
+, {-100, -828, 281, 449, 242, -709, 6, -187, -172, 595, 412, -348, 283, -178, -743, -299}
+, {-546, 56, 701, 470, -693, -607, 243, -400, 26, 193, -751, -130, 84, 193, -451, 702}
+, {-643, -138, 548, 361, 546, 382, 6, 383, 472, 545, -730, 16, -777, -16, 81, 219}
+, {-72, -253, 52, -163, 284, -281, -579, -309, 349, 221, -800, 181, 35, -556, -410, -285}
+}
+, {{572, 347, -635, -4, -291, -874, 204, -679, 504, 152, -192, -245, -495, -170, 163, -506}
+, {473, -548, 467, -336, 686, 581, -98, -547, -92, 651, 279, 241, -369, -733, -657, -681}
+, {-378, 486, -644, -241, -54, -242, -115, -286, 135, -141, -445, 735, 532, 765, 708, -846}
+, {659, 491, -207, -201, -347, 830, -648, 1100, -115, 154, -331, 211, -800, -441, 702, 687}
+, {330, 217, -444, -754, 288, 286, 157, -231, -351, -37, 357, -251, -104, -17, -282, 631}
+, {-694, 563, 738, -386, 659, 687, 142, 400, -511, 622, -182, -205, -808, 251, 55, 214}
+, {-283, 299, 109, -337, -459, 454, 301, -486, -304, 267, 30, 408, 490, 67, -340, -209}
+, {604, -210, 250, -158, -196, 109, -741, -536, -509, -326, 34, -686, 277, 416, 302, 734}
+, {-312, -509, -427, -539, 119, 147, 685, 290, -313, 538, -478, -693, -832, 576, 848, 273}
+, {-212, 219, 466, -441, -27, 108, 687, 337, -59, 793, 53, -64, -413, -221, -876, -535}
+, {-310, 292, 734, -735, 598, -142, -220, 628, 241, 894, -424, -510, -130, 539, -234, -595}
+, {420, -768, 388, -713, -88, 534, -210, 183, 580, 11, -232, 196, 123, 4, 722, -115}
+, {-48, -168, -367, -183, 634, 720, -758, 244, -149, -426, 49, 328, -167, -577, 726, 370}
+, {36, 48, -334, -655, 214, -183, -769, -198, -130, -21, 141, -555, -408, 442, -260, -30}
+, {-54, -220, -246, -652, -132, 887, -258, 697, -174, -152, -217, -35, 20, -271, -808, -519}
+, {413, 427, 711, 267, 232, -93, 789, -589, -184, -182, 82, -471, 212, 287, 641, -426}
+, {435, -323, -781, -51, -357, -60, 393, -576, 581, 776, 209, 280, -499, 535, 555, 508}
+, {401, 766, -616, 392, -283, -405, -799, -477, 754, 168, 779, 319, 177, 28, 644, 439}
+, {723, 370, -809, -482, 680, -546, 579, 643, 387, -197, 33, 72, 860, 660, -469, -528}
+, {-451, 41, -182, 348, -464, -439, -298, -506, -121, -61, 423, 32, 209, 22, 394, -705}
+, {460, -761, 261, -137, -88, 209, -877, -676, 193, 559, 496, 331, 391, -473, -215, -382}
+, {760, -416, -475, 321, -236, 219, 195, 37, 764, -448, -444, -403, -316, 737, -725, 522}
+, {-800, 644, -656, -180, 611, -170, 784, 604, -632, 514, 316, 78, -276, -207, 692, 484}
+, {74, -669, 552, 675, 185, -789, 402, 4, 430, 305, 172, 243, -4, -891, 692, 157}
+, {-701, -790, -366, 190, -344, 408, 571, 318, 64, 365, 493, 732, 29, 119, 368, 136}
+, {530, -432, -481, 557, -221, 759, 309, -724, 474, -311, -45, 766, 283, -413, -771, -456}
+, {140, -636, -504, -239, 364, 165, 265, -419, -387, -407, -811, -113, -425, 440, 120, 436}
+, {-126, -396, 77, -152, 699, -28, -60, -252, -223, -630, -523, -369, -225, -307, -199, -129}
+, {-554, 224, 749, 270, 611, 367, 534, 360, -268, -97, 691, 685, -274, -576, 155, 64}
+, {-533, 193, -638, -507, -632, 117, -691, 798, 351, 776, -709, 504, 638, -669, 742, -673}
+, {-181, -244, 669, 734, -410, 772, 784, 841, -234, 654, -618, -390, -179, 58, -723, -433}
+, {389, -774, 16, 202, -15, -59, -409, -332, 37, -397, -304, 419, -689, -581, 349, 210}
+, {-57, 436, -377, -460, 374, 679, 306, 655, -463, -144, -123, 454, -469, 300, -323, 390}
+, {742, -390, 534, 725, 221, -82, -341, -68, 743, -126, -414, -607, 502, 377, -391, -481}
+, {513, 720, 78, 223, 420, 592, -554, 349, -412, -704, 31, 149, -202, 91, 109, 114}
+, {-721, 351, 544, 140, 348, 283, -240, 133, -332, 480, -112, -663, 474, 764, -559, -649}
+, {290, -766, -524, -763, -195, 122, -684, -113, 639, 737, -70, -570, 274, 527, -169, -592}
+, {806, 26, -35, 262, 509, 339, -561, 310, 706, 709, -659, 295, -255, -50, -210, 595}
+, {-26, -7, 182, 14, 599, -489, -138, 617, 515, 53, -378, -558, -440, -552, 794, 178}
+, {224, -262, 721, 725, -470, 483, 413, -519, 412, 351, 619, 42, 87, 95, 126, -555}
+, {702, 221, -21, -602, -717, -393, -675, -689, 276, -223, 451, -84, 385, -53, 100, -807}
+, {627, -262, -390, 141, -240, -569, 696, -587, 754, -196, -353, -290, 266, -889, -229, 310}
+, {36, -555, 615, 589, -71, 35, -342, -64, -632, 664, -707, -704, -280, 292, 406, -572}
+, {-171, 397, -626, -159, 137, 608, 539, -442, 92, 161, 427, 753, -724, 471, 348, 116}
+, {-83, 664, 34, 405, 841, 380, 603, 526, -244, -316, 17, -97, -24, -718, 140, 204}
+, {-708, -32, -659, 223, 350, 212, 329, 720, -736, 520, 375, 206, 416, 452, -372, 694}
+, {-301, -550, 294, 415, 336, 406, -542, 672, -387, -285, -148, -13, -18, -372, -438, 643}
+, {-213, 755, 549, -644, -345, -400, 669, 527, 759, 201, 265, -60, -165, -56, 172, -277}
+, {-246, 487, 648, -672, 599, 527, -16, 669, -75, -321, 377, -275, 324, -14, 459, -480}
+, {-601, 394, -354, 14, 765, -689, -615, 110, -460, 124, 593, -208, 6, -210, 271, -799}
+, {628, -850, -193, -140, 428, 534, 799, -133, -660, -249, 708, 613, 222, 90, -50, 829}
+, {536, -303, -737, 411, 683, -620, -88, 163, 243, 146, -658, -135, 596, -193, -5, -469}
+, {-466, 622, 428, 396, 515, 198, 100, -767, -121, -331, -736, 380, -206, 616, 532, -762}
+, {548, 363, -140, -300, -84, 461, -467, 101, -725, 182, 43, 334, -76, -442, 667, -716}
+, {-141, 597, -545, 813, -701, -388, -528, -763, 747, -14, -111, -582, 839, -834, 49, 629}
+, {-503, -431, 824, -485, -727, -201, 38, -360, -469, -311, -27, 123, 445, -213, -304, 545}
+, {530, -578, -219, -439, -452, 517, 317, 115, -813, -571, 74, 298, 321, -32, -630, 465}
+, {553, 661, 734, -524, 304, 520, -565, 585, 339, 120, 498, 130, 39, 533, -298, -448}
+, {711, -417, -113, 130, 402, -244, -683, -328, -396, 756, -40, 194, -226, -196, 283, -328}
+, {634, -541, 721, 248, -795, 699, 85, 139, 912, 332, 319, 383, -211, 44, 346, 406}
+, {123, 345, -682, 516, -3, 788, -245, 728, 719, -320, -473, 607, 201, -724, 543, -524}
+, {572, -399, 316, -391, 561, -749, 220, 724, 439, -118, -547, -747, -691, 566, 515, -181}
+, {-136, 143, -498, -271, 296, 108, 740, -194, 412, -18, 87, 44, 934, -662, -660, 746}
+, {667, 616, -89, -259, 447, 351, -341, -218, 108, -688, 596, -377, -36, -793, -794, -439}
+}
+, {{366, -229, 23, -415, 312, -15, 160, 4, 578, 170, 121, -275, 695, 343, -47, -389}
+, {139, -223, -350, -767, 624, -411, 385, 53, -760, -500, 411, 592, -361, 701, 981, 309}
+, {626, 191, -117, -606, 625, -124, 711, 436, 302, 321, -655, -511, -443, 601, 516, 62}
+, {-601, 598, 291, 617, -389, 525, 372, 78, -408, -537, 136, -442, -527, 640, 23, 461}
+, {-607, 702, 239, -52, -612, 180, -232, 580, -249, 196, 5, -352, 466, 205, 313, -854}
+, {-200, 34, 111, 431, 96, 216, 703, 302, 203, 298, -594, 271, 468, -855, 468, 598}
+, {113, -782, 659, 452, -456, -6, -762, 567, 35, 327, 576, -234, -573, -429, 249, 271}
+, {-128, 84, 282, -312, -440, -408, 155, 557, -220, 243, -433, -545, -465, -277, -444, 153}
+, {571, -407, -98, -428, 193, 259, 457, -498, 631, -233, -5, 282, -542, 53, 634, -377}
+, {-504, -403, -559, -334, 661, -357, 271, 659, -608, -417, 162, -365, 325, -385, 98, -301}
+, {-128, 595, 523, 561, 216, -131, -105, -339, -87, 387, -814, 441, -398, -56, -377, -509}
+, {319, 748, 616, -598, 378, 117, 602, 389, 636, -472, -40, 267, 448, -629, -249, 317}
+, {-161, 365, -138, -300, -513, -580, -707, 599, 376, 511, 190, -427, 580, 182, -218, 560}
+, {-697, 307, -699, 825, 224, 28, -135, -454, -29, 770, 248, 170, 80, 438, 416, -355}
+, {639, -582, 202, -607, 309, 752, 254, 322, 323, -164, -309, 529, 796, 88, 103, 398}
+, {317, 582, -110, -891, -200, -350, -643, 25, 666, -690, 122, 454, 249, 656, 178, -23}
+, {-56, 593, 581, -214, 33, -94, -643, 297, 440, 487, -626, -237, -461, -111, -452, -1}
+, {38, -660, 277, 170, -47, 162, -689, -259, -441, 202, -641, -149, 628, 374, 367, -401}
+, {693, -660, -147, -209, -187, -327, -409, 431, -614, -470, 434, -156, 554, -603, -585, 469}
+, {382, 801, 214, -765, -379, -210, -66, -805, -41, 798, 743, -221, -690, -433, -908, -802}
+, {705, -517, -359, -294, -72, 601, 182, -120, -298, 603, -434, -319, 752, 473, -776, 693}
+, {-280, -514, -764, 304, -582, -696, -224, -275, 704, -364, 540, -161, 558, 250, 203, -724}
+, {-318, 447, 362, -360, -362, -834, -11, 173, -427, -320, 585, -276, 161, -724, 200, 664}
+, {-637, -4, -160, 554, 234, -10, 460, -542, -566, 87, -591, -123, -632, 211, -107, 105}
+, {-657, -485, 622, -657, 128, 359, -164, 218, 267, 34, -754, -444, -905, 478, 292, 373}
+, {100, -436, -635, -696, 266, -529, -566, 51, -114, -44, 42, -190, 533, -900, 427, 892}
+, {590, -574, -758, -124, -308, 540, 19, -675, 219, -311, -428, -795, 439, -728, 782, -256}
+, {382, 396, 342, 647, 737, 285, 231, -784, 273, 758, 62, -419, 209, 452, -709, -118}
+, {-553, -569, 654, 67, 483, -555, 33, -448, -762, 351, -409, -334, -724, -69, -250, 189}
+, {-564, -523, 76, -664, -357, -650, -426, -152, -763, 223, 170, -257, 288, -124, -1, -677}
+, {220, -52, 167, -28, -30, -261, 691, -148, 516, 336, -639, 682, 138, -722, 419, -13}
+, {-269, -184, -455, -517, 252, -556, 171, -43, -796, -355, -37, 330, 401, -269, -243, -77}
+, {-640, 378, -289, 26, 297, -563, 617, -508, 132, -615, 340, -537, -768, -31, -96, 705}
+, {658, 729, 701, -786, 152, 566, -16, 727, -553, -518, 170, 70, -333, -862, -321, 684}
+, {172, -409, -145, 280, 260, -344, -603, -634, 446, -599, 299, 210, 53, 514, -480, 150}
+, {585, 163, -562, 491, -264, 537, 569, 554, -753, -709, 113, 802, -340, 740, 486, 190}
+, {-624, -37, -644, 308, 401, -55, 651, -425, 151, -112, -372, 216, -286, 710, 89, -714}
+, {-465, -51, 114, 479, -658, 18, -52, 702, 1, 717, -654, -354, -639, -377, -2, -627}
+, {236, 82, 128, 148, 766, -807, 516, -179, 121, -236, 836, 31, 171, -193, 274, -114}
+, {440, 260, -461, 398, -605, 40, 491, 700, 260, -780, -550, 732, 747, 332, -233, 36}
+, {20, 157, -79, -657, -784, -70, 222, 179, 125, 132, 592, -546, 102, 272, -124, -153}
+, {192, -699, -158, 653, -629, -107, -402, -712, -104, 572, -285, 585, -96, 112, 629, 234}
+, {-753, -538, 544, 496, 252, -724, -517, -752, -563, 725, -140, -700, 171, 595, -572, 215}
+, {541, -668, 307, -667, -110, -545, 625, 631, -169, -680, -292, 698, 201, -336, -491, 651}
+, {-148, 294, -315, 503, -283, 895, 332, -295, -99, 246, 697, -304, -676, 430, -272, 233}
+, {-210, 304, -164, 92, 661, 507, 6, -714, -797, -72, 383, 339, -6, -347, 782, 229}
+, {174, 560, 23, 439, -340, 477, -67, 327, -342, 447, -194, -654, -566, -674, -702, -264}
+, {726, -834, -356, 392, -127, 219, 44, -503, 553, -190, -426, -19, 174, 556, 407, -91}
+, {472, 41, -458, -58, -241, -672, -406, 249, 602, 198, -588, 813, -641, -5, 71, 484}
+, {217, -317, 213, -554, -149, 74, 152, -724, -23, -466, 342, -553, -717, -393, 911, -277}
+, {-459, 210, -579, 388, 769, 658, 2, -400, -770, -711, 173, -52, 157, -664, -26, 785}
+, {260, -294, -203, 593, 843, 722, 252, 270, 431, 389, -549, 226, -176, 806, -673, 116}
+, {491, -132, -689, -577, -633, -39, -459, -47, -196, 626, 472, -170, 648, 248, 424, -609}
+, {-386, -76, -539, -193, 138, -178, -167, -158, 461, -160, 12, 397, -442, 542, 296, -443}
+, {-365, 283, 788, -504, 309, 153, -15, -722, -373, 53, 38, -452, 590, 197, -694, -474}
+, {85, 162, -768, 485, -699, -325, -213, 440, -730, -823, 79, -446, -794, 747, 497, -649}
+, {-85, 584, 592, -425, -126, -66, 218, 313, -816, 554, 350, -730, -280, -630, 141, -507}
+, {145, -242, -97, 110, -692, -352, -501, -357, -267, -297, 286, 394, -380, 384, 234, 754}
+, {-222, 784, 668, -217, -12, 749, -282, -255, 58, 228, 375, -107, 524, 36, -5, 492}
+, {740, 686, 301, -285, -443, 286, 710, -151, 456, -155, 98, 673, -124, -541, 77, 146}
+, {-384, -190, -201, -63, 238, -99, 371, 336, 536, 373, 36, 680, -609, -383, -374, 282}
+, {-788, 657, 535, 481, 729, -602, -658, -153, -662, 163, 478, -779, -82, 578, -604, -272}
+, {-780, 581, 95, -623, 544, -132, -141, 567, -632, -313, 363, 272, -330, 92, 439, -208}
+, {-491, -535, 362, 380, -6, 790, 547, -365, -177, 690, 446, -218, 955, 772, -438, 586}
+}
+, {{444, -157, -721, -300, -240, 163, -736, 321, 691, 286, -267, -604, -335, 63, -500, -533}
+, {-353, 197, -231, 763, -576, -152, 102, 25, 218, 654, -306, -595, 660, 478, -354, -241}
+, {-166, -176, 607, 348, 257, 668, 243, -222, -9, 160, 336, -615, -25, -386, 9, 549}
+, {-216, -49, 590, 103, 189, -419, 70, 11, -343, -97, -571, -121, -178, 269, 386, 160}
+, {-108, -196, -485, 99, 501, 238, 543, -193, -640, -582, 300, -411, -752, -615, 406, 35}
+, {661, -603, -24, -14, -228, 239, -197, -470, 149, 593, -51, 213, -467, -552, 348, 625}
+, {-561, -778, -248, 742, 190, 782, -384, -440, 476, -195, -607, -191, -376, 656, 296, -589}
+, {414, 580, 224, -261, 597, -362, -752, 298, -715, -750, 236, -372, -7, 383, -378, -432}
+, {-268, -519, -230, 47, -158, 5, -394, 312, 19, 631, -809, 444, 42, -90, -700, 477}
+, {821, -686, 125, -593, 613, -685, 482, -741, 389, 605, 730, 724, 658, -608, 305, -636}
+, {516, -77, -560, 435, 733, 296, -582, 849, 9, 832, -184, -161, -478, -468, -456, -66}
+, {-271, 407, 640, -576, 259, -374, -30, 616, 331, 302, -25, -740, 577, -91, -289, -565}
+, {330, 610, 346, -493, -230, -846, -375, 163, -102, 161, -165, 635, 256, 239, 420, -626}
+, {-164, 9, 116, 678, 721, -51, 3, -406, 717, 348, -583, -429, -8, 71, 422, -566}
+, {-540, -437, 193, 425, 248, -178, -606, 598, -262, 775, -273, -306, -26, 551, 578, 556}
+, {669, -699, -30, 437, -464, 11, -443, -599, -247, -505, 566, -547, -483, 568, -719, -410}
+, {65, -229, 514, 653, 205, -542, 212, 233, -669, 644, -397, -497, 574, -225, -553, -137}
+, {75, 50, -214, 287, -445, -776, 392, 121, 37, 88, -474, 552, 148, -74, 41, -233}
+, {-531, -463, -712, -599, -117, -512, -650, 539, 314, 674, 299, 598, -810, -717, 678, 166}
+, {-94, -200, 483, -146, 147, 428, -377, -336, -659, -622, 656, 553, 287, 216, -423, -136}
+, {-561, -584, -52, 21, 71, -609, -330, 635, 267, -516, -460, 292, 535, 475, -572, 219}
+, {-235, -74, -639, 256, 577, -765, -112, 401, -576, -816, -128, 310, 456, -693, 193, -259}
+, {250, 604, -619, -451, 498, 658, 725, -191, -540, 214, -771, 70, -539, 599, 526, -651}
+, {-556, 325, -535, -109, 524, 806, 307, 477, -210, 136, -105, 164, 508, -326, 382, -241}
+, {385, 436, 271, 470, -562, 276, 578, 135, 17, -363, 330, -695, 315, 235, -804, -380}
+, {298, -398, 470, 569, -402, -156, 630, -137, 579, 82, -498, 699, 410, 235, -38, -276}
+, {-732, 321, 472, 802, 532, -284, -277, 578, 804, 520, 511, -102, 181, 21, -175, -718}
+, {682, -291, -564, -372, 666, 694, -195, -247, 722, 502, -596, 652, -182, 161, 226, 124}
+, {41, 363, -554, 657, 324, -31, -345, -349, -360, 199, 107, 90, -634, 600, 721, 321}
+, {-146, -192, 723, -29, -383, 52, -38, -419, -51, 687, 760, -769, 258, 223, 720, 193}
+, {280, 77, -234, -51, 639, 366, -252, -708, 42, -411, 614, -72, 234, 324, -736, 56}
+, {-177, -429, 628, -400, 256, -336, 127, -562, -22, -78, 606, -173, -373, -294, -630, 84}
+, {-246, 781, -480, -553, 413, 685, 778, 36, 496, 211, 477, 618, -267, 16, -49, -422}
+, {-515, 768, 247, 253, -718, 134, 83, -140, 572, -648, -5, -412, 183, 337, -790, -247}
+, {-118, -228, -755, 194, -693, 326, -565, -671, 812, 56, -323, 40, -780, -684, 94, 436}
+, {264, -109, -531, 335, -476, -562, 129, -952, 352, -102, -478, 583, 365, -773, 383, -403}
+, {-752, -518, -646, -651, 468, 147, -188, 832, -207, 45, -370, -153, -51, -98, -111, 433}
+, {-941, 506, 167, 83, -444, 274, 500, 190, 424, 152, -171, 446, -439, -536, 288, 21}
+, {251, 618, -480, -394, -619, -705, -872, 757, 445, 59, -469, 510, 853, -783, 595, -171}
+, {418, -142, 441, -767, -31, 616, 359, -504, 16, 675, 446, 169, -381, -492, -785, -537}
+, {716, -599, -742, 658, -578, 254, 360, -553, 211, -473, 560, 76, 709, 56, -317, -466}
+, {-219, -82, -110, -40, 588, 264, 805, -658, 251, -432, -57, -741, -47, 568, 230, 134}
+, {-415, 603, 500, 300, 549, 496, -424, 795, -327, 461, 259, 646, 736, 667, -394, -530}
+, {-117, 610, -503, -454, -1, -422, 379, -722, -119, -59, 294, -434, -109, -20, 535, -623}
+, {-252, -562, -607, 485, 464, 347, 474, 430, 260, 303, -360, 133, 315, 397, 759, -449}
+, {19, -320, 330, 236, 444, 343, 101, -307, -422, -263, -727, -64, -96, -282, -359, 563}
+, {788, 659, 104, -456, -716, 172, -4, 308, -659, -620, -662, 678, 129, 42, -434, 601}
+, {742, 459, -267, 665, -584, -72, 467, -331, 591, -313, 23, -204, 606, -689, -414, 252}
+, {-520, -57, -328, -139, 366, 300, 488, 535, -635, -270, 154, -48, 606, -290, 564, 684}
+, {140, 604, -723, 876, -373, 258, -587, 5, 18, 440, -360, 237, -757, 163, -444, -730}
+, {-270, -25, 438, 905, 70, 128, -47, 359, 471, -365, 377, -356, -238, 666, 182, 395}
+, {-30, -783, -765, -294, -83, 363, 301, -294, -425, -589, -535, 143, -210, 327, 584, 270}
+, {746, -204, -408, -389, -846, 299, 528, 335, -321, -40, 19, 451, -580, 413, -169, -270}
+, {-192, -99, -260, -725, 718, 353, -488, -448, 144, 9, 97, -127, -575, 148, -404, -513}
+, {-498, -750, -593, 576, 0, -565, -619, -137, -599, 755, 298, -403, 623, -284, 262, 661}
+, {-164, 186, -2, -59, 698, -226, -474, 415, 617, 193, -97, 16, 277, -688, -455, 434}
+, {406, -696, 23, -359, -580, 560, 103, -279, 584, -84, 433, -744, 157, -83, 782, 141}
+, {-577, 277, 11, -451, -260, -591, -269, 447, -574, 252, -498, -501, 352, 544, -235, 515}
+, {-175, -382, -686, 726, -819, -417, -450, -23, 247, -520, -473, -35, 534, 55, 551, 340}
+, {644, -730, -779, -695, -147, 199, 514, -607, -468, -733, -891, -152, -100, -27, -20, 489}
+, {-51, 377, -315, 688, -449, 158, -44, 494, 89, 673, -778, 253, 262, 0, -93, -654}
+, {443, -765, 415, 186, 82, -461, 153, -410, 629, 558, 189, -566, -361, -499, 465, -341}
+, {-562, 121, 675, -506, 243, -179, -222, 442, 276, 22, -24, -148, 873, 19, -357, 43}
+, {-543, 253, -311, -134, 114, 534, -29, -312, -147, -613, 646, 517, 214, 77, 265, 528}
+}
+}
+;
+#endif
+
+#define DENSE_59_FORMATS
+#define DENSE_59_REQUANT_SHIFT 13 // input Q10, weights Q12, output and bias Q9
+
+const int16_t dense_59_bias[7] = {10, 8, -1, -2, -19, -2, 4}
+;
+
+const int16_t dense_59_kernel[7][40] = {{-1624, 1426, -295, 386, 370, 1493, 1764, -9, 1499, -649, 289, 342, -1436, 1060, -181, -149, -1528, -1017, -339, 301, -270, 590, 916, 1097, 875, -694, -1019, 898, -36, -130, -175, -1247, 1066, -503, -1498, -128, -1598, -866, -494, -1338}
+, {343, 1357, 997, -1301, -673, -300, 1314, -255, -1435, -318, 434, 1240, -600, 251, 1249, 4, -131, 1644, 280, 1250, 933, 751, -1138, 29, -1659, -871, 63, 361, -16, 792, 539, 787, 1502, 114, -414, -183, -860, -66, -1036, -1270}
+, {-113, -1229, -1209, -20, -1397, 136, 914, -26, -853, 1690, -233, -394, 521, -1231, -686, 1155, -1246, -773, 978, 1228, -892, 594, 1128, -1115, -1450, 170, 1323, -1272, -985, 318, 1076, -297, 421, 992, 251, -947, -1032, 1333, -55, 1461}
+, {496, -195, -1421, 987, 1367, 865, -428, 289, 1563, -909, -1210, -211, 1044, 44, -116, 1039, -1001, 1352, -1288, -769, -631, -902, 1230, -44, -663, -1335, -294, -910, -51, -1543, -861, 491, -1025, 1240, 367, -416, -1379, 1577, 352, -1450}
+, {116, -436, -1283, -853, -389, -849, -1144, 212, 608, 770, 1139, 699, 726, 1274, 274, -1234, 56, -943, -1105, 690, 1338, -820, -1257, -744, -428, -132, -524, -1225, 1207, 138, 1106, -667, -1041, -177, -641, 1141, 905, -528, -542, -76}
+, {-101, -582, -1021, -63, -850, -525, -86, -69, 1609, -626, -1458, -1040, -1172, -885, 524, 771, 1352, -865, -613, -1415, 1032, -55, 773, 83, -9, 762, 450, 998, 61, -271, 1359, -1388, -995, -1213, -765, -1634, 98, -995, -1348, 456}
+, {77, -1282, -184, 1195, 1021, -487, -1320, 1558, 1032, -723, -1119, -54, 1197, -1449, -330, 1169, -1121, -320, 303, 992, 723, 21, 295, 654, 1291, 645, 323, -678, 1206, -1072, -638, -113, -528, 842, 1022, 541, 1287, -1440, 1164, 164}}
+;
+
+#ifdef CNN_SIMD
+#define DENSE_59_PANELS
+
+const int16_t dense_59_panels[1][20][16] = {{{-1624, 1426, 343, 1357, -113, -1229, 496, -195, 116, -436, -101, -582, 77, -1282, 0, 0}
+, {-295, 386, 997, -1301, -1209, -20, -1421, 987, -1283, -853, -1021, -63, -184, 1195, 0, 0}
+, {370, 1493, -673, -300, -1397, 136, 1367, 865, -389, -849, -850, -525, 1021, -487, 0, 0}
+, {1764, -9, 1314, -255, 914, -26, -428, 289, -1144, 212, -86, -69, -1320, 1558, 0, 0}
+, {1499, -649, -1435, -318, -853, 1690, 1563, -909, 608, 770, 1609, -626, 1032, -723, 0, 0}
+, {289, 342, 434, 1240, -233, -394, -1210, -211, 1139, 699, -1458, -1040, -1119, -54, 0, 0}
+, {-1436, 1060, -600, 251, 521, -1231, 1044, 44, 726, 1274, -1172, -885, 1197, -1449, 0, 0}
+, {-181, -149, 1249, 4, -686, 1155, -116, 1039, 274, -1234, 524, 771, -330, 1169, 0, 0}
+, {-1528, -1017, -131, 1644, -1246, -773, -1001, 1352, 56, -943, 1352, -865, -1121, -320, 0, 0}
+, {-339, 301, 280, 1250, 978, 1228, -1288, -769, -1105, 690, -613, -1415, 303, 992, 0, 0}
+, {-270, 590, 933, 751, -892, 594, -631, -902, 1338, -820, 1032, -55, 723, 21, 0, 0}
+, {916, 1097, -1138, 29, 1128, -1115, 1230, -44, -1257, -744, 773, 83, 295, 654, 0, 0}
+, {875, -694, -1659, -871, -1450, 170, -663, -1335, -428, -132, -9, 762, 1291, 645, 0, 0}
+, {-1019, 898, 63, 361, 1323, -1272, -294, -910, -524, -1225, 450, 998, 323, -678, 0, 0}
+, {-36, -130, -16, 792, -985, 318, -51, -1543, 1207, 138, 61, -271, 1206, -1072, 0, 0}
+, {-175, -1247, 539, 787, 1076, -297, -861, 491, 1106, -667, 1359, -1388, -638, -113, 0, 0}
+, {1066, -503, 1502, 114, 421, 992, -1025, 1240, -1041, -177, -995, -1213, -528, 842, 0, 0}
+, {-1498, -128, -414, -183, 251, -947, 367, -416, -641, 1141, -765, -1634, 1022, 541, 0, 0}
+, {-1598, -866, -860, -66, -1032, 1333, -1379, 1577, 905, -528, 98, -995, 1287, -1440, 0, 0}
+, {-494, -1338, -1036, -1270, -55, 1461, 352, -1450, -542, -76, -1348, 456, 1164, 164, 0, 0}
+}
+}
+;
+#endif
@@ -0,0 +1,400 @@
+/**
+  ******************************************************************************
+  * @file    weights/int8.c
+  * @version 1.0.0
+  * @date    17 october 2026
+  * @brief   Int8 weights of conv1d_116, conv1d_117, conv1d_118, conv1d_119, dense_58, dense_59 with one scale per filter and the
+  *          quantization of their inputs, generated by tools/int8_weights.py from the int16
+  *          weights and 385 calibration clips (percentile 99.9), used with -DCNN_INT8
+  *          in place of their int16 kernel
+  */
+
+#define CONV1D_116_INT8
+
+const int16_t conv1d_116_bias[16] = {9, 10, -4, 18, 21, -2, -24, 14, 21, 6, -7, 0, 8, 6, -2, 0}
+;
+
+static const int8_t conv1d_116_int8_kernel[16][32] = {
+  {127, 84, 8, 115, -17, 84, -48, -48, 58, 45, -13, 110, -37, -32, -12, -99, -100, 25, 10, 55, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+  {-29, -22, -83, -93, 47, -30, -46, 30, 110, 7, -37, -10, -63, -30, 59, 127, -36, 86, 68, -105, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+  {100, 127, 21, -40, 54, 29, -4, 24, 40, -71, -33, 54, 66, -104, -91, -74, -33, 37, -11, -116, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+  {-26, 51, 62, -9, 124, -2, -72, 103, 43, 112, -89, -91, 14, 38, -21, -127, -62, -31, -53, -62, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+  {-100, -64, -41, 31, -68, 59, 58, 59, -92, -13, 100, 64, 92, 97, 6, -10, 127, 46, 97, -21, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+  {-112, -112, -127, 63, -75, -5, -72, -114, 30, 52, -43, -45, -20, -40, -102, -37, 110, -79, 100, 57, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+  {53, 67, -102, 35, -34, 0, 127, -32, -4, 12, -2, 32, 12, -32, 9, 2, -53, 125, 5, -79, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+  {14, -54, 34, 62, -6, -127, -76, -125, -53, -56, 118, 98, 60, 113, 99, 34, -36, -81, -119, -57, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+  {-82, 101, -45, 122, 104, -23, -59, 68, -15, -73, -93, -6, -25, -91, 11, -29, -127, -54, -70, -90, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+  {-52, 106, 85, 70, -96, -104, -9, -2, 5, 33, 66, 110, 63, 127, 101, 24, -118, -16, -75, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+  {-44, 31, -23, 2, 106, 125, 125, 8, 42, -6, -10, -19, -75, 90, 127, 79, 119, -37, 54, 15, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+  {-85, -36, -53, 69, -82, -38, 108, -55, -67, 14, 72, 72, -71, -82, -50, 17, -50, 96, -60, 127, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+  {90, 29, -4, 27, 58, 127, -4, -54, 60, 85, -85, -6, 44, -94, -114, 2, 100, -33, 110, 75, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+  {-67, 74, 44, 45, 21, 127, 121, 74, 12, 51, -18, 116, 103, -59, 15, -26, -6, 45, -88, 26, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+  {80, -15, 50, 63, 120, 40, -84, 112, -79, 127, 107, 105, 13, -7, -28, 65, 63, -52, -5, 25, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+  {-89, 65, -22, -57, 120, 58, -24, 122, 117, 36, 82, 88, 7, 70, -65, 127, 79, 96, -9, -53, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}
+};
+
+static const int32_t conv1d_116_int8_offset[16] = { 21420, -3400, -1700, -6664, 29036, -38828, 9588, -10744, -32368, 22100, 48212, -10472, 28084, 41480, 47600, 50864 };
+
+static const int32_t conv1d_116_int8_multiplier[16] = { 1566724815, 1546110015, 1834717218, 1525495215, 1772872817, 1566724815, 1484265615, 1690413617, 1690413617, 1504880415, 1360576813, 1669798816, 1360576813, 1731643217, 1566724815, 1525495215 };
+
+const int8_weights_t conv1d_116_int8 = {
+  32, &conv1d_116_int8_kernel[0][0], conv1d_116_int8_offset, conv1d_116_int8_multiplier, 23,
+  26878, 23, 68, 141
+};
+
+#define CONV1D_117_INT8
+
+const int16_t conv1d_117_bias[32] = {8, 37, 0, 7, 13, -8, -5, -3, 20, 3, 0, 17, 23, -4, 10, -1, 4, -9, 18, 0, -17, 7, 36, 9, 19, 1, 15, 0, -21, 10, -12, -8}
+;
+
+static const int8_t conv1d_117_int8_kernel[32][64] = {
+  {8, 40, -20, 31, -10, 127, -27, -50, 54, -3, 44, 62, 103, -14, -52, -103, 58, -113, 12, -28, -118, 91, -69, 105, 16, 38, 73, 33, -46, 15, 74, -52, -76, 58, -36, -61, 69, -13, -85, 76, 59, -22, 112, 42, -64, 77, -50, -44, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+  {-24, 78, -51, 94, 96, 86, -28, 83, -38, 23, 80, 20, 59, -81, -24, -86, 65, -13, -54, -83, -71, -49, -58, -72, 113, -98, -68, 68, -82, -42, 8, -62, 6, -16, -65, 0, -47, 127, -64, -12, -92, 33, -104, 31, 90, -14, 24, 65, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+  {77, 76, -24, 54, 72, 18, 0, -57, 66, 77, 67, 0, 94, -127, -109, 12, 19, -68, -30, 85, -27, 4, -109, 47, 78, -83, -110, 39, -80, 115, 81, 55, 89, 13, -119, 0, 46, 92, 1, -88, -78, -11, -36, 32, 45, -114, 77, -98, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+  {17, 13, 127, 59, -90, 35, -59, -76, 100, -62, -81, -83, -73, -106, 46, 0, -73, -119, -7, -52, -96, 123, 70, 42, 33, -111, -44, 59, 42, -27, 82, 108, -114, 41, -7, 29, -100, 31, 51, -13, -103, 28, -51, -85, 40, 80, -22, -69, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+  {22, -108, -17, -33, -65, -96, -74, 127, 16, 32, -33, 49, -54, -65, 80, -76, -33, 74, -72, 72, 69, -54, 27, -5, -43, 53, 81, 17, 101, 21, -43, -40, -73, -2, -105, 65, 14, 118, -64, 112, -43, 5, 88, -58, 108, -70, 15, -53, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+  {-70, -74, 87, -39, -90, 122, -20, -9, -36, -20, 12, 75, -25, 126, 120, 58, 49, 44, -66, 114, -6, 59, 58, -113, 99, 80, -30, -88, 70, 40, -99, 113, -118, -91, -107, -52, 127, -23, -69, -96, -93, 51, 85, -47, 26, -33, 51, -44, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+  {-106, -101, 92, -28, -66, 93, 8, 42, 19, 127, -9, 73, -24, -53, -91, -42, -83, -11, 34, 24, -93, 4, 76, -96, 44, 36, -89, 91, -103, 11, -40, -85, 32, -5, -31, 74, 13, -9, 126, 62, 93, 60, 22, 52, -31, 125, 8, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+  {82, 68, -19, 119, -14, -114, 35, 2, 109, 8, -78, -122, 21, 66, 103, 22, -30, 127, -86, 92, -7, 48, -29, 5, -82, -100, -54, -4, 8, 105, 31, 92, 111, -85, 97, -84, -78, -15, 80, 10, 22, -1, 96, 14, -96, 5, -3, -26, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+  {-74, 54, -23, -80, 92, -7, 62, -15, 14, -85, -105, -87, 91, -77, -127, -39, 11, -74, 81, 81, -40, 30, -23, 94, 74, -31, 72, -102, 70, -92, -23, -20, -118, 61, -64, 60, -100, -78, -81, -60, -83, 0, 26, -65, 33, -47, 68, -17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+  {21, -22, 31, 64, -127, 2, -35, 16, 11, 89, -100, -59, -7, -62, -41, 57, 0, -39, 51, 93, 87, -93, 0, 72, -15, 81, -63, 59, 0, 72, 108, -11, -62, 35, -34, -97, -56, -35, -6, 2, 65, 114, -3, -47, -59, 102, 34, -55, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+  {71, 20, -37, -80, 49, 1, -26, 114, 14, 34, 41, 127, -73, -43, -18, 126, -20, 66, 62, 103, 11, -53, -59, 0, 16, -69, -103, 32, 111, -23, -81, 38, -41, -6, -38, 34, 22, 58, -103, 87, -14, 87, -108, -41, 83, 125, -75, 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+  {-25, 72, 6, -10, 68, 84, 90, 96, -48, 97, -41, -98, -110, 67, -79, -109, -84, -23, -91, 1, 127, -14, 14, -20, 123, -87, -18, 31, -41, -117, 91, 18, 54, 116, -17, 59, -103, -11, -97, -83, 97, 36, 48, -19, 25, -74, 108, 97, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+  {65, 90, -28, -86, 41, 127, -21, -37, 60, -83, -75, 65, -44, 69, -65, 52, -90, -18, 88, 4, -23, -127, 88, -4, 68, 118, 80, 58, -44, 20, -104, -72, -63, 123, -109, -123, 118, 65, -101, 120, -52, -59, -68, -90, -30, 88, 44, 106, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+  {-105, 120, -31, 61, 68, 102, -60, 95, -114, -85, 120, 103, -42, 107, 33, 25, -40, -110, 62, 66, -66, -112, -38, -33, -68, 21, 28, 95, -80, -56, 60, -30, -109, 25, -46, 9, 85, -13, 61, -60, 19, 127, -28, -33, -94, 73, 78, 125, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+  {115, 95, -72, 127, 41, -34, 16, -65, 31, -61, -60, -42, 66, 117, 50, 40, 14, -51, -55, -17, -14, -111, 30, -122, -29, 105, -4, -85, -71, -87, 29, 72, 93, -108, 117, -97, -5, 67, -11, 78, 73, -19, 100, -30, 1, -105, 75, -107, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+  {95, -36, 37, 5, 99, -104, 46, -77, 100, -55, 105, 22, -41, -109, -97, -50, 60, 43, -50, 98, -46, 37, -51, 1, -22, -114, 60, -6, -28, 27, 88, 114, -47, 102, -51, 44, -119, 74, -116, -93, 8, -127, -11, -67, 28, 85, 126, 93, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+  {14, 59, -77, 35, -53, -29, -66, -116, 108, -127, -29, -84, -39, 39, 0, 17, -52, -16, 97, 60, 58, -14, 45, 106, 17, 115, -99, -113, -20, 39, 43, -45, 78, -42, 69, -102, 106, -32, 67, 26, 11, -89, 9, 38, -74, 96, -10, 53, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+  {-81, -98, 119, 112, -94, 70, 96, 62, 78, 55, 10, -80, 108, 22, -95, -39, 43, 70, -94, 11, -72, 81, -109, 34, 26, 24, -101, 126, 81, -56, -82, -34, 63, -62, 5, -95, -80, -72, -97, 71, 7, -62, 37, 57, 127, 79, -56, -38, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+  {81, 60, 53, -38, -39, -28, 8, -91, -80, 94, -46, -82, 81, 98, 1, 75, 45, -20, 71, 88, -26, -67, -67, 103, -40, 6, -88, -91, 98, -47, 7, -100, 54, 31, 36, 122, -53, -92, -1, -38, 86, -82, -11, -9, -12, 127, -107, 27, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+  {-53, -100, -92, -54, -58, -85, -14, -63, -62, 7, -13, 79, -96, -58, -8, 60, -9, 81, 99, -58, 13, 105, 2, -63, 35, -103, -8, -26, -76, -14, 75, 3, 101, -73, -92, 104, -10, 99, -56, 10, -127, 26, 74, 77, -80, -16, -10, 39, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+  {-40, 102, 49, -45, 12, -21, 77, -89, 17, 110, 27, -51, -93, 68, 108, -6, 72, 101, 47, -58, 84, 112, 75, 43, 100, -37, -112, 69, -125, -88, 47, 24, 1, -113, -43, -46, -51, 83, -89, -127, -106, -97, 121, -17, 85, 116, 74, -81, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+  {84, -39, 24, -34, -109, -35, -86, -67, -64, -60, -1, -56, 17, 80, 3, 56, -105, 80, -87, -77, -25, 109, 0, -32, -34, -52, -83, 127, -7, -63, 56, 94, 115, 66, 75, 101, -95, -61, -31, 63, 115, 46, 69, -2, 74, 112, 59, 35, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+  {83, -29, -42, 91, -97, -18, -81, -91, 77, -77, -46, 81, 37, 39, -98, -69, 39, 51, 53, -8, -42, -39, -82, 79, 47, 40, 83, 127, -97, 52, 32, 1, -62, 30, 90, -59, 115, 48, 17, 10, 69, 79, -77, -94, 47, -85, -45, -60, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+  {-3, 92, -51, 16, 50, 20, 103, 108, 49, 31, 52, -39, -39, 111, 60, -14, -58, -84, -110, -35, -84, 109, -51, 48, -59, -3, -127, -54, 81, 83, -6, -32, 79, -81, -82, 98, -76, 109, -33, 120, 101, -87, -28, -50, -100, 8, -104, -58, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+  {-65, -29, 40, -87, 13, 74, -125, 96, 22, -83, 1, -20, -120, -83, -20, -79, 74, 19, -93, -102, 38, 44, -43, 4, 46, -75, -72, -47, -25, 79, 105, -80, -103, 36, 24, 58, 41, 114, -113, 105, -97, 117, 24, -92, 127, -105, -64, 41, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+  {-61, -66, -2, 101, 34, 28, -18, 56, 12, 68, 9, 50, -84, 2, 58, -81, -98, -87, -109, 111, 24, -104, -119, 109, -36, 6, 6, -68, -91, -99, 40, 83, 39, -67, 58, -83, 18, -18, 112, 127, 77, 71, 53, -3, -105, -50, -59, 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+  {-82, -63, -20, -71, 78, -23, 96, 0, 80, -83, -24, 89, -69, 49, -2, -100, 106, -76, -40, -86, 79, 93, -64, -19, 35, 43, 124, 36, -21, 12, 66, -40, -84, -43, 127, 61, 33, -55, -76, 30, 9, 37, -69, 29, -16, -50, -46, -37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+  {-96, -26, -27, -2, -65, -82, -21, 126, -84, 126, 122, -98, -92, 127, -60, -90, 50, -127, 53, -42, -9, 92, -26, 107, -114, 74, 84, -85, 12, 122, 71, 40, -40, 13, 81, -13, -35, 95, -2, -18, 23, -83, -106, 64, 37, -116, -7, -99, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+  {75, 45, 69, -89, -122, 77, -6, 27, -76, 27, 57, -126, 12, 81, 79, 104, -74, -115, 79, -57, 48, 39, -77, -115, 58, -5, 87, -98, -59, -28, 105, 121, -64, 84, -16, -58, 10, 18, -2, 79, 97, 23, 15, 20, -127, 53, 12, -5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+  {-14, 103, -46, 17, 91, 61, 84, 2, -33, 70, -73, -77, 28, 42, 88, 76, -94, -97, 44, -58, -86, 41, -21, -36, 94, 51, -27, 21, 39, -48, -16, 12, 81, 39, -87, 33, 27, -45, 58, -90, 60, 46, 9, 71, -73, 60, 127, 125, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+  {-44, 25, 47, 96, 53, 127, 11, 31, 87, -70, 80, -65, -37, -116, 58, -92, 107, 16, 46, 106, -107, 60, -63, -29, 2, 66, -103, 106, -101, 7, -37, -101, -25, 29, 110, 101, 22, 87, -54, -54, 29, 87, 45, 119, 55, 30, -44, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+  {33, -87, 119, 7, -56, 42, -1, -52, 108, 112, 13, -31, -45, -64, 100, 127, 37, -2, -29, -71, -77, -16, -99, 109, 24, -15, -11, -60, -109, 51, -35, 54, -18, -57, -42, 102, -28, 87, -88, -13, -62, 115, -74, -33, -99, -96, -104, -111, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}
+};
+
+static const int32_t conv1d_117_int8_offset[32] = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+
+static const int32_t conv1d_117_int8_multiplier[32] = { 1434371316, 1577808448, 1499570013, 1369172620, 1447411056, 1395252099, 1408291838, 1629967405, 1616927666, 1447411056, 1382212360, 1382212360, 1343093142, 1499570013, 1330053403, 1303973924, 1486530273, 1447411056, 1408291838, 1525649491, 1395252099, 1603887927, 1434371316, 1460450795, 1382212360, 1460450795, 1629967405, 1356132881, 1434371316, 1590848187, 1473490534, 1369172620 };
+
+const int8_weights_t conv1d_117_int8 = {
+  64, &conv1d_117_int8_kernel[0][0], conv1d_117_int8_offset, conv1d_117_int8_multiplier, 24,
+  21246, 21, 0, 130
+};
+
+#define CONV1D_118_INT8
+
+const int16_t conv1d_118_bias[64] = {8, 11, 15, -4, 12, 10, 0, -6, 10, -13, 10, 6, -1, 21, 19, 10, 8, 11, -1, 16, -1, -6, -20, -4, 16, 21, 22, -3, 14, 0, 18, 15, 6, 11, -10, 14, -3, -1, 0, 24, 4, 0, -18, 8, 11, -10, 0, 36, 23, 6, 0, 14, 0, 1, 4, 26, 4, 14, 15, -18, -7, -12, -15, 9}
+;
+
+static const int8_t conv1d_118_int8_kernel[64][96] = {
+  {28, 95, -92, 30, -75, 72, -121, -97, 55, 18, 100, -105, 59, -89, -22, 89, 89, -71, -84, 87, -34, 53, 38, -37, -109, -71, 49, 77, 32, 41, 84, 92, -81, 100, -1, 61, 127, 52, 87, 69, -99, -61, 1, 46, -55, 84, 65, 93, -47, 111, -31, -13, -6, 69, -65, -96, 103, 16, -93, -93, -28, -56, 13, -92, -61, 114, -10, -6, 59, -80, -77, -6, 71, -1, -52, 41, 72, 77, 68, 27, -109, 86, -4, 61, -96, -74, -37, 106, 87, -95, -13, 58, -61, -77, 69, 105},
+  {59, 119, 13, -66, 13, -120, 76, 30, 33, -35, 107, 115, 86, 89, 59, 5, -114, -31, -76, 12, 18, -64, -7, 101, 107, 122, 97, -66, -49, 96, 66, 102, 31, 69, -31, -101, -20, -71, -53, -35, 21, -74, 18, 15, -30, 51, 46, 111, 89, 112, -30, -23, -36, -13, 7, -91, 7, 124, -76, -120, -38, 20, 114, -124, 71, 97, 97, -53, 23, -101, -97, 31, 106, 102, 26, 74, -41, -106, -51, 114, -107, -127, 33, 31, -58, 56, 96, -71, 76, -54, 87, -3, -117, 99, 20, -59},
+  {57, -6, -29, 87, 20, 4, -31, 45, 29, 13, -45, -74, 80, -67, -50, 33, -43, 73, -70, 35, -56, 28, 14, 38, 60, -64, 100, 100, 89, -33, 1, -33, 73, -11, 107, 54, -32, 74, -8, 42, -3, -70, -54, -1, -33, 61, 17, -87, 8, 17, -68, -66, -1, -54, -53, -6, 10, -63, 46, 85, -6, -100, -32, -28, 92, 57, -36, -127, -73, -39, 74, -60, 98, -13, 53, 10, 61, 6, 25, -50, -73, -78, 42, 0, -36, 28, 56, -87, 73, 46, 22, -67, -71, 91, -4, -73},
+  {-2, 43, 102, -62, -21, 16, 46, -122, 13, 25, 75, 113, 73, 51, 11, -116, 24, -64, -106, 64, 106, -127, 43, -57, -52, -90, 37, -75, 59, 38, -30, -3, 105, 37, -51, 79, -37, 65, 92, -117, -95, -49, 98, -27, -87, 35, 68, -110, 52, -32, -119, -48, 73, -71, 64, -78, 64, -89, 44, 11, -102, -54, 108, -92, -10, 49, -108, -98, 62, 19, 71, 3, 3, -21, 46, -6, 10, -73, -48, 75, 83, 0, 97, -62, -14, -40, -75, -67, 59, 113, -108, 0, 89, 98, -40, -87},
+  {3, -94, 25, -117, 90, 100, -37, 68, 59, 48, 84, 21, 21, 62, 0, -64, -13, -67, -71, 100, 102, -94, -110, 86, 51, -110, 92, -48, -27, 127, 30, -57, 70, -30, 90, -89, 68, -49, 33, 13, -81, 8, 79, 0, 73, -14, 71, -122, 0, -71, 35, -117, -8, 83, -94, -111, 13, -87, -19, -3, -59, 119, -105, -62, -19, 37, -70, -76, 52, -54, 10, 14, 51, 8, -6, 43, 43, -79, -68, 65, -94, -125, 29, -25, -25, 57, -100, -92, -121, -62, -5, 5, 22, 64, 102, -13},
+  {-98, 11, -58, -40, -104, -72, 40, -108, -101, 93, -82, 53, 119, -6, 13, -21, -82, -35, -34, -64, -2, -34, -26, 63, 127, -50, 24, -74, 119, -111, 18, 2, 98, -64, -31, 21, -56, 31, 11, -39, 113, 18, -98, 47, 0, 23, -92, 85, 45, -100, -24, 122, 106, 96, -74, 55, 39, 48, 103, 100, -82, -6, 6, -63, -40, -100, -48, 39, 76, 92, -55, -114, 50, 125, 90, 0, -55, 77, 84, 23, -29, -48, 6, 122, 27, -23, 100, -59, -31, 35, 43, 76, 92, -3, 111, 23},
+  {-58, 65, 120, 50, -76, -62, 82, -39, 31, 48, 110, 105, -112, -67, -125, -15, 106, 38, -26, 41, -88, -117, -62, 86, -118, -81, 110, -110, 86, 122, 3, 76, -117, 50, 117, 84, 84, 77, -43, -96, -89, -26, -15, 113, 33, -7, 48, -58, -39, -81, 19, -33, -81, 57, 33, -5, -74, 26, 110, 26, -39, -67, 36, -2, -110, 51, 127, -39, -50, -122, -122, 57, -125, -7, -46, 98, 70, 105, -67, 108, 98, 24, -67, 45, -50, -112, -106, 29, 118, -100, 101, -34, 0, -2, -81, -48},
+  {34, -39, 76, -11, -31, 36, 3, 116, 70, 31, 96, 107, -74, 60, -5, 53, 36, 79, -43, 101, -73, 79, -70, 108, -99, 28, -45, 43, 33, 115, -37, -20, -74, 76, -46, 43, 8, -19, 42, 23, 31, -17, 59, -79, 15, 37, -46, 51, 60, -77, -122, -65, -87, -51, 104, -101, -102, -115, 12, -122, 40, -28, 31, 0, -84, 73, 82, 77, -94, -93, -98, 84, -2, -56, -33, -107, -51, -34, -33, 36, 3, -82, 127, -45, -6, 62, -96, -84, -96, -60, 65, 71, 2, 54, 107, -56},
+  {-6, 94, 103, -64, -57, -75, -112, -64, 42, 0, 24, 64, -85, 6, 55, 99, -54, 64, 18, -54, -12, -96, 7, -36, -49, -108, -13, 97, -79, 85, -34, 60, 12, 121, -103, 85, 22, -79, -63, 57, -39, -97, 78, 22, 90, -43, 57, -61, 13, 1, 46, -34, -25, -13, -12, 70, -105, -106, 3, 82, -109, 61, 19, -33, -94, -105, 61, 127, -61, -103, -106, 46, 108, -48, -28, 18, -84, -12, 90, -31, 30, -51, 109, 81, 79, 40, -43, 4, 1, 57, 60, -52, 51, 31, -16, 18},
+  {101, -122, -41, -80, 38, -92, 88, 85, -71, -63, -5, -18, -74, 106, -71, -62, -65, 26, 23, -127, -45, -12, 27, 113, -17, 89, -11, 53, -60, -39, 56, 23, -9, -104, 67, -41, -42, -71, 76, 51, -14, 122, -18, -92, -12, -12, -94, -67, -6, -41, -11, 121, -106, 45, 20, 21, -57, 79, -82, -20, 39, 77, 41, -91, -24, -18, -76, -11, 76, 101, 67, -2, 39, -86, -35, -14, 113, -74, -89, -48, -63, 24, -106, -3, -15, -42, 30, 68, 42, -30, -38, -33, 65, -5, -59, -88},
+  {-6, -14, 100, 9, 39, 39, -43, 19, -76, 38, -49, -100, 45, 22, -117, 55, -38, 45, 81, 56, 52, 71, -22, 61, -48, 56, 126, -91, 59, 35, 6, -79, -30, 114, -85, -29, 120, -69, -1, -111, -127, -68, 48, -52, -35, 22, -85, 81, -100, 53, 74, 78, 45, -102, 9, 27, -46, -39, 23, 120, 56, -32, 38, 81, -7, 104, -46, -42, -7, -94, -76, -71, 45, 25, -4, -76, 43, -51, 58, -108, -92, 16, -62, 91, 88, -97, 35, 98, -22, 118, -22, -69, 6, -95, 108, -42},
+  {-45, -108, 92, 6, 8, -114, 69, -23, -72, 40, 121, -111, 109, -98, -93, 100, 77, 121, -76, -96, 34, -50, -37, 32, 68, 10, -26, 63, -74, 119, -58, -43, 5, 0, -39, -63, -47, 64, -71, 26, 21, 0, -3, -45, 29, -82, 2, -8, 68, 47, -98, -80, -79, -19, -98, 39, -106, 48, 55, 26, 34, -27, -80, -84, -61, 13, 56, -14, 127, -14, 37, -58, 56, -53, 84, 66, -90, 82, 45, -108, 58, 114, -42, 74, -77, 10, 71, 32, -19, 51, 114, 45, 13, 23, 63, -11},
+  {-93, -110, 113, -91, 62, -103, 22, 2, -53, -86, 43, -48, -118, -105, -74, -108, 74, 101, -113, -120, -108, 76, -26, 19, 120, 94, -70, -82, 3, -86, -65, -124, 60, -3, 12, 0, -89, 7, 113, 89, 22, -91, -33, 12, -96, -62, 53, -17, 67, -60, -3, -110, -55, -46, 45, -65, -76, 0, -48, -10, -29, -74, -89, 113, -7, 58, -14, -27, 9, -94, 24, -29, 86, 17, -34, -64, 91, -93, -113, 41, 55, -72, -127, 67, 0, 91, -100, -103, 100, -19, -113, 46, -81, 2, -36, 43},
+  {15, 59, -86, -84, 97, -97, 87, -74, 54, 56, -21, -40, -56, 106, 38, -66, 73, -10, 96, -97, 13, -16, 40, 53, 33, -97, 78, -111, 23, 91, -43, 59, 73, 48, -94, 35, -21, -102, 69, -46, 74, -43, 54, 84, 59, -73, 63, -51, 61, -21, 63, -69, -48, -78, 38, 2, -111, 8, -41, -91, 36, -101, -79, -76, 51, -46, 101, -54, 5, -61, 23, 114, -36, -21, 31, -66, -69, -91, -40, 53, 127, 66, 68, -119, -89, 25, 23, 0, -58, -5, -74, -61, 30, 64, -96, -101},
+  {-88, -56, -42, 95, 104, -34, 101, 51, 100, -35, 0, -87, -42, -8, 21, -3, 100, -121, 76, 51, -92, -108, 127, 103, -14, 109, 35, -40, -13, -43, 31, 16, -85, 79, -101, 72, 59, -80, -50, -121, 39, -106, 119, 61, -55, -77, 10, 84, 47, -37, 72, 21, -95, -8, -51, -8, -98, 90, 92, 11, -116, -42, -59, 0, -119, -122, -55, -122, 18, 72, 108, 92, -59, -5, 106, 103, -124, 90, 119, 3, 26, -32, 127, 101, 77, 87, -58, -47, 68, -61, 29, -50, 0, 0, -5, -104},
+  {6, -28, 115, -82, 45, -19, 81, 33, 108, 110, -76, 99, -43, 101, -5, -11, -84, -108, 76, -11, 60, -102, 6, -42, 25, 77, -96, -96, -9, -50, -6, -127, -59, -14, -29, -12, 8, -113, -14, -34, -9, -45, 54, 40, 36, 20, 81, -23, -87, 74, 45, 46, -65, 50, 81, 53, 43, -48, -37, 56, 74, 102, 12, 2, 12, 77, 39, 112, -93, 17, -9, -56, 74, -68, -112, 42, -74, 2, 22, -74, 40, 11, 3, 84, 26, 102, 48, 85, 102, 9, 77, -26, 33, 11, -113, -37},
+  {27, 68, -59, 6, -54, -32, 5, 60, -73, -33, -77, -83, -70, 56, 42, 73, -63, 73, -11, -23, 68, 35, -79, -62, 74, 59, -76, 109, 36, 24, 23, 51, 56, 50, 23, -53, -60, -73, 97, -121, 100, 88, 71, -8, 101, 89, -23, 79, -57, -35, 24, 68, -8, -121, -91, -26, -65, 26, 107, 20, -80, 65, -98, -79, -83, -80, -6, 35, -127, 92, 112, 18, -45, -100, 41, 79, -2, 3, -57, -73, -53, -83, 110, 60, -65, 80, 48, 38, -100, -18, 41, -80, 0, 83, -42, 11},
+  {-39, -36, -21, 90, 1, 23, 67, 121, -47, 106, -60, -7, -33, 88, 121, -30, -100, 11, -7, 19, -7, -27, 14, -16, 67, 21, -9, -14, 63, -17, -31, 4, -1, 98, 106, -63, -40, -63, -34, 104, 63, -41, -71, -19, 127, -27, -53, 6, 36, 108, 26, -123, 24, -61, 106, -4, 31, 68, -33, 54, 1, -53, -23, 0, -36, -17, -91, 11, 54, 26, -51, -86, 39, -91, 66, -76, -6, -51, -94, 90, 39, -64, -3, -37, -80, -88, 39, 23, 46, -70, -1, 21, -86, 103, -19, -94},
+  {-52, -26, 59, 29, 0, 2, 52, 73, -104, 109, 98, -94, 36, 15, 77, 21, -29, -10, 42, -55, -62, -2, 98, 88, -57, -109, -99, -33, 107, -20, -18, 20, 60, -96, -21, -127, -16, 54, 72, -62, 60, 21, 88, -114, 34, -68, 85, 20, -5, -37, 15, 59, -7, 114, 96, -16, -77, 101, -68, 109, -81, -3, -16, 28, 67, -78, -107, -46, 85, -55, -62, -47, -2, -3, 120, 57, -34, 3, 90, 78, -16, 119, -91, -75, -101, 73, 15, -13, -77, -20, 8, 91, 90, 67, -98, -59},
+  {-23, -34, -73, 37, 83, -28, -26, 15, -32, 20, -104, 41, 66, -61, 21, 37, 5, 122, 90, 77, -101, 40, -43, 104, 80, -44, 83, 40, 35, 64, -84, -32, 58, 32, 5, -40, 107, 44, 119, 31, 86, -50, 64, 38, -43, 101, -43, 44, 54, -87, 64, 18, -31, -50, 35, 23, 75, -73, -75, -70, 24, -32, -3, -60, -21, -28, -49, 112, -34, 20, -37, -78, -80, -67, 127, -47, 17, 83, -37, -70, -95, -26, -84, 2, -73, 26, -9, -57, 109, 50, -37, 64, 78, 73, -20, 32},
+  {-30, 74, 34, 108, -67, -41, 31, 127, -56, 74, -88, -89, -94, -99, 94, -56, 71, 45, 49, 0, -52, -27, 63, -17, -45, 50, 71, -31, -82, -100, 61, -28, 28, -61, -55, 38, -88, 56, 2, 94, -63, -58, 2, 53, 69, 53, 69, 67, -55, 103, 53, 72, -78, 80, 0, 34, -11, -89, 83, 16, 96, 5, 53, 77, 13, -52, 6, 45, -36, -118, 64, 13, -13, 102, -41, 19, -44, -83, 16, -56, -75, 91, 47, -8, 66, -63, -3, 28, -63, 74, 91, -49, 107, -83, 71, 91},
+  {-76, -88, -84, -58, 68, -31, 14, 38, -20, 31, -30, -51, 91, -70, -51, 96, 4, 22, -85, 69, 24, -16, -69, -35, -35, 69, 68, 3, 49, -92, 100, -81, -49, 61, -11, -54, -74, 66, -86, -85, -28, -42, -18, 24, 22, 26, 1, 57, 27, -89, -66, 50, 86, -53, -31, 35, 57, -36, 92, 74, -41, -74, 89, 41, -50, 74, 82, 27, 53, 53, -84, -38, -127, 11, 38, 77, -19, -49, -74, -62, 5, -50, -101, -8, 55, -68, -34, -101, -18, 15, 93, -54, 73, 16, -99, 34},
+  {103, -24, 10, -48, -35, -103, 43, 44, 19, -64, 43, -49, 86, 64, -111, 14, 86, -86, -57, 89, 35, -10, 46, 48, 105, 10, -105, -8, 89, 84, 70, 54, 108, 65, 92, 16, -68, 97, -108, 90, -30, -125, 110, -127, 19, 90, -89, -68, 0, -51, 98, 46, -52, 84, 51, -59, -117, -113, -98, -103, 106, -32, 73, 40, -105, 60, -56, -86, 41, -38, 78, 102, 83, -125, 60, 68, -98, -67, 35, -56, -117, 0, -68, -84, 40, 94, 95, -41, -2, -51, -103, 64, 110, 81, -54, -37},
+  {-71, 42, -70, -40, 115, -15, 94, 3, -19, 15, 84, 2, 48, 68, -34, -107, -26, 71, 2, -22, -85, 0, -73, -19, 9, -56, 85, 96, -99, -99, 43, -12, 107, -77, -71, 8, 127, 54, -77, -65, 43, 121, 12, -43, 6, 29, -9, -116, -77, 87, -9, -112, 56, -23, 40, 0, 99, 53, -96, 54, -33, 54, -50, -6, 70, -91, -40, -22, 59, -25, -76, -85, 82, -36, -54, 0, -77, -53, -5, -3, -54, 33, 77, 26, 64, -84, 14, 26, -88, 40, -2, 119, -33, -22, 105, 71},
+  {101, -17, -36, -51, -51, 57, 10, -61, 61, -49, 60, -57, 86, 49, -107, -57, -97, 26, -9, 40, 66, -11, -97, 17, -11, -3, 84, 34, 33, 16, 16, 64, -33, 111, -34, 14, 50, 37, -64, -19, 0, -87, -39, -76, -63, -6, -27, 4, -103, 90, -26, 7, -90, -23, 37, 81, -3, 59, 43, 74, 3, 16, -71, -100, -24, 61, -88, -67, 97, -47, -17, -10, 0, 39, 40, 86, -70, 116, -78, 53, -14, 34, 66, -59, 78, -16, -127, -30, 33, 4, -80, 56, 1, 17, 107, 60},
+  {-1, 5, 101, 7, 64, -23, -75, -44, -87, 59, -57, -5, 68, -1, -36, 75, 40, -72, -76, 52, -76, 15, 117, 26, -45, 4, -4, 40, -38, -107, 91, -70, -1, 102, 38, -10, -14, -5, 0, -119, 90, 3, -46, -81, 119, 72, -89, -22, -19, -64, -41, 10, -48, -31, -16, 25, 82, -33, 71, 14, 89, 67, -67, -25, 0, 82, 85, -81, -10, -23, -61, 91, -83, -59, 63, 100, -25, -29, -87, 1, 67, -49, 30, 127, -5, 86, -63, 34, 98, -90, 82, 1, -33, 19, 49, -97},
+  {87, -10, -76, -65, 31, 10, 76, 85, 76, 21, 11, 23, -56, -47, -32, -93, -32, 110, 38, 113, 52, -20, 17, 117, 71, 66, 114, -49, -76, -65, 85, -1, 85, 52, -65, 99, 6, -61, 96, 93, 34, -82, -85, 76, 76, -6, -37, -95, 4, -4, -23, 47, 23, 65, 80, -48, 6, -69, -56, 4, -110, 4, 82, -99, -86, 37, 21, -56, -71, -8, 82, -37, 62, 51, 13, 48, -1, 8, -58, -45, -38, -73, 44, 24, -38, 18, 127, -83, -69, 48, 95, 20, -17, -93, -85, -20},
+  {-35, 101, -3, -32, -38, 54, 42, -61, -115, 45, -54, -47, 19, 15, 57, -22, -35, 64, -88, 28, -72, 1, 53, -15, -89, 69, 6, -1, 74, 47, 91, 47, -96, 107, 58, -34, -4, -36, 32, -64, -35, 6, 26, 58, -50, 28, -64, 58, -10, 82, -95, -18, -64, 63, -55, 61, -77, 92, 26, 32, -54, -16, -6, 31, -45, -16, -111, 73, 47, -3, 104, 69, -127, -86, 85, 77, 38, 6, -104, 93, -1, 31, -39, 25, 109, 86, 67, 32, 1, 83, 114, -44, 10, -104, 102, 41},
+  {80, -11, 85, 5, -92, -68, -18, -68, -68, 0, -71, 80, 79, -124, 48, -9, 68, 95, 9, -88, -73, -47, 121, 47, -17, -17, 121, 106, 0, 47, 9, -38, -71, -63, 26, 17, 0, -35, 63, -127, 3, -70, -86, -32, -44, -5, -21, -63, 35, -24, -60, 62, -50, 47, 12, 85, 15, -36, 23, -60, 18, 5, -8, -56, -50, 27, 35, -91, -74, -59, -62, 14, 54, -47, -100, 70, 8, -98, 18, -23, -77, 8, 26, 8, -71, 62, 65, 73, -70, 44, 113, -95, 50, 94, 83, 88},
+  {-6, 105, -43, 103, 79, 87, -68, 2, 114, -6, -81, -67, 95, -103, -81, -57, -92, 116, -116, 13, -75, -127, 11, 25, 57, 114, -114, -37, -25, 75, 62, -86, 3, 10, -5, -40, 46, -94, 75, -79, 121, 71, -87, 100, 79, -41, 86, -78, 57, -98, -38, 71, 90, -43, 70, 62, 17, 89, 113, -60, -56, 98, 41, 60, -52, -76, 41, 11, 27, 44, 30, 114, 54, -14, 57, 90, 27, -108, 51, -97, -56, -40, 29, -102, 46, -68, -100, 79, 29, -71, 57, -119, -38, -92, 16, 84},
+  {-35, -6, -84, -60, -3, 16, -92, -40, 0, 33, 94, 110, -2, -92, -79, -60, -75, 19, 116, -106, -57, 8, 86, 5, 0, 68, 48, -127, -56, 121, 94, 19, 49, -14, 33, 127, -54, 14, -19, -35, -14, 10, 3, 56, 65, -40, 24, -98, 59, -68, 60, -21, -52, 10, -59, -100, -38, -90, -127, 95, 79, -57, 79, -68, 13, -8, -14, -25, -95, 29, 65, -33, -67, 49, 92, 38, -75, -8, 43, -8, 124, -90, 110, -11, -122, -68, -37, 60, -94, 46, -51, 16, 73, -35, -83, -122},
+  {-10, 50, 77, 127, 20, 22, -45, -80, 95, -64, -96, 55, -91, -34, -66, -48, -60, 121, 54, -38, -47, 55, 107, -41, -80, -35, -58, 126, 44, 16, -32, -4, -72, -20, -6, -70, 82, 66, -89, -53, 77, -63, 35, 82, 47, 109, 38, 0, 77, -32, 12, -88, 95, 50, 70, -82, 20, 9, -61, 83, -6, -88, -12, -32, -54, -79, 31, -18, -47, 35, 47, 29, 29, 0, -54, -96, 53, -54, -80, 72, 7, 18, 89, -64, -67, 6, -31, -3, -15, -73, 96, 12, 32, 96, -102, -74},
+  {-10, 30, -66, -16, -70, -64, 84, 52, 55, 6, -102, 91, -51, -70, 105, 112, -39, -22, -111, -12, 72, 52, 25, 81, -102, 111, 90, -52, -42, 46, -36, 87, -72, 58, -34, 6, -4, -54, -75, -48, 39, 28, 48, -31, 66, -69, 70, 96, 99, 0, 82, 85, -46, 36, -63, -61, -90, -39, 0, 43, -12, 70, -93, -55, 58, 15, -1, 81, 46, 118, 67, -27, -124, 124, 58, -55, -108, -87, 37, 87, 64, -42, -69, -82, 15, 112, 127, -57, 78, 16, 12, 127, 117, 4, -106, -99},
+  {-24, -47, 8, 106, -109, 5, -48, -106, -82, 2, -101, 82, 50, -26, -98, -16, -96, 6, 96, -95, -51, 125, -19, 127, 39, 90, 104, 96, -101, 18, -77, -58, 88, -6, 34, 0, -101, -92, -56, -26, -51, -84, 84, 113, 96, -113, -34, -93, -16, 8, 100, -51, 3, 24, 31, 64, 69, -56, 56, 6, -116, -32, 93, -56, 10, 72, 71, -8, 63, 100, 8, 69, 69, -18, -68, 66, 6, -53, 87, 0, -5, -68, -119, -51, 66, 10, 95, -74, -74, 71, 66, -103, 11, 29, 100, -3},
+  {55, -45, -4, 88, 94, 55, -72, -17, 72, 64, 53, -97, -78, 88, -43, -33, -45, 101, 89, 71, -45, -40, -36, -95, 78, 7, -1, 6, -84, 0, 10, -9, 58, -100, -32, 87, 76, -89, 76, 59, -53, -25, 26, -87, 108, 3, -56, -48, -43, 127, 27, 19, -1, 61, -56, 91, 14, 85, -4, -62, 38, -95, -23, 22, -22, -100, -79, -4, 85, 62, -72, 49, 53, 36, 16, -33, -82, 81, -38, -81, -12, -36, 16, 61, 56, -13, -71, -17, 79, 110, -92, 14, -9, -27, -12, 91},
+  {-23, -12, 45, -67, 9, -13, 15, 57, 105, -89, -48, 114, -31, -69, 18, -34, -36, -55, 74, 76, -89, 72, -51, 64, -112, 79, -19, 92, -31, 73, -70, 85, -99, 88, -47, -86, 16, -101, -57, 23, 13, 76, -9, -34, 45, -96, 31, 107, 76, -88, -26, 34, -53, 29, 102, -35, -86, 93, -107, -82, 55, -29, -10, -25, 32, 72, 85, 99, 98, 22, -22, 101, 127, 38, -16, -104, 36, 38, -25, 79, -34, 28, -23, 26, -31, -19, 0, 13, 109, -69, -101, -51, -35, -42, 0, 48},
+  {-70, 40, 22, -42, -70, 40, -3, 73, 6, -26, -93, -26, 46, 79, 56, -127, 2, -14, -67, 39, -101, 22, -65, -29, -25, 53, -105, 99, -11, -14, 34, -122, -14, 64, 122, -26, 112, 90, 82, 43, -9, 116, 90, 46, 33, 23, -94, -39, 112, -85, 70, -77, -71, 53, 76, -57, -25, -60, -70, 23, 37, -81, -71, 67, -88, -73, 96, 94, 101, -94, -101, 93, -22, -51, 46, 54, 101, -6, 31, 74, 108, -101, 98, -23, 57, -91, -48, 91, -17, -85, -56, -94, -79, 48, -68, 51},
+  {86, 40, -21, -28, 72, -12, -49, 60, 9, 60, -31, -2, 15, -80, 96, 107, 57, -96, -84, -21, 84, -32, 77, -107, 77, 104, 37, 28, 12, -37, 80, 104, 44, 84, -58, 40, -95, -47, 61, -98, -55, 57, -23, 49, -81, -3, 121, 92, -106, 55, 106, 0, -99, 0, -54, 70, 18, -96, -52, 77, 112, 15, -78, -52, 37, -93, -38, 75, 78, 69, -101, 75, -78, 86, 50, 92, 83, 38, 26, -44, -32, -127, 98, 75, -83, 61, -15, -31, 101, -84, 17, 95, -95, -106, 2, 66},
+  {11, 37, -65, -11, 17, 52, -89, -93, -79, -32, 68, -92, 16, 65, -31, 7, -93, 23, -93, 28, -16, 37, -83, 16, 34, -3, -61, 72, 48, 25, 75, 68, -28, 44, -21, -93, 127, 62, 45, -83, -110, 11, -71, 41, 68, 96, -116, -40, -95, 96, -58, 89, -45, -103, 44, 75, -3, 109, 42, 38, -47, -68, -3, 87, 96, -7, -89, 51, -32, -93, -31, 42, 66, 28, 93, -17, -13, 0, 75, -28, 48, 7, -37, -87, -59, -27, -59, 31, -8, 47, -14, 14, 85, -27, -13, -30},
+  {-72, -116, -47, 84, -34, 64, -61, 18, -101, 24, 113, -51, -13, -111, 29, -56, -85, 34, 114, 29, -34, 114, -125, -32, -95, -6, 95, -87, -106, -29, -50, 51, 59, 74, 6, 61, 124, 19, -55, 59, 56, 79, -45, -80, -108, -103, 80, -96, 127, -74, 106, 69, 5, 16, 63, -37, 56, 0, 27, -82, 100, -85, -5, 77, 14, 31, 108, 5, 72, 23, -55, -103, -74, 71, -96, 92, 56, 58, 24, 23, 101, -104, 48, 48, 87, -31, 117, 79, 48, 98, -14, -79, 80, -10, -63, -104},
+  {-3, -77, -82, 77, -19, -67, 11, -58, -74, -17, 0, -66, -96, 38, -88, -8, -82, 108, 100, -55, -107, 16, -39, 67, 0, -55, -96, 49, 53, 110, 77, -69, -60, -63, -94, -2, 100, 50, 69, 31, 42, 14, -110, 27, -36, 55, 77, -25, 60, -20, -55, -17, 58, 22, -66, 100, 20, -11, 72, -17, -22, 103, 60, -2, 88, -116, 103, -72, -6, -49, -97, 108, -111, -34, -127, 74, -74, 19, -16, -50, 55, 27, 9, 44, 102, -42, -93, -85, 9, -72, -58, -31, 89, -108, -97, 82},
+  {-11, 48, 19, -98, 30, 113, -98, -29, 29, -73, -75, -29, 110, -44, 73, -81, 44, 5, -65, -21, 127, 84, -44, -22, 41, -105, -81, -46, 84, -11, -97, 64, 17, -33, 54, -86, -52, 38, 117, 41, 71, 48, -87, 64, 95, -108, -78, -30, 78, -71, 54, -64, -65, 79, 98, -70, -121, -14, 90, -56, -56, 40, -21, -30, 87, 14, 11, 111, 2, 67, -19, 83, -13, -48, 6, 92, 29, -19, -98, -46, 84, -102, -27, 40, 90, -27, -64, 0, -14, -49, 3, -43, 84, 49, -103, -60},
+  {-53, -79, 21, 48, -6, -42, 21, 53, 72, -16, -23, -58, -100, 88, 127, 69, 116, -56, 35, -56, -104, 69, -88, 37, -56, -18, -37, 61, -90, 19, -14, 116, -29, -104, 106, 2, -10, -72, 14, 92, 74, 111, -19, 50, 64, 59, -21, 88, -43, -8, -79, 45, 96, 95, -2, -39, -116, -61, 5, 34, 122, 11, 108, -39, -66, -114, 95, -32, 18, 72, -43, 82, 14, 42, -114, -69, 13, -93, -31, 69, 47, 59, 113, 32, 76, 47, 50, 72, -127, -58, 13, -84, 32, 47, 26, 114},
+  {93, 101, -113, -31, 42, 58, -61, 2, -14, -80, -109, 23, 48, 32, 74, 71, -72, 119, 71, -66, 53, -31, 90, 80, 82, 79, -48, 109, 90, -117, 53, -51, 69, 47, 21, -48, 0, 71, 100, -69, 37, -27, 108, 79, -90, 0, 19, 109, 51, -113, -82, -127, 47, -96, -111, -6, -98, -88, 42, 48, -106, 79, -59, 79, 77, -37, 26, -37, 11, -122, -58, -59, -104, 63, -69, 101, 0, 55, 26, -108, 45, 51, 48, -53, 26, 39, -61, -98, -14, -40, -19, -76, -104, 13, 11, 8},
+  {30, -70, -106, -13, 78, -27, 27, 112, -45, 99, 15, 78, 0, -49, 111, -27, -6, 94, -3, 37, 25, 115, -91, -42, -67, 45, -87, 7, -109, -67, -90, 75, -64, -73, 108, -27, -21, -10, -39, 75, -64, 1, 90, -94, -22, -37, 72, -40, -54, -73, 99, -117, -69, -60, 70, -46, -15, 39, 88, -13, 91, 39, 16, 69, -48, 84, 105, -97, -7, 96, 88, -66, -91, 111, 48, -37, 127, -85, 88, -48, 64, -79, -100, -33, -79, -30, 111, 84, -13, -61, 25, 18, -102, 12, 16, -6},
+  {-66, -121, -74, -27, -95, 16, -117, 62, 95, 64, -6, 49, -18, -99, 30, 24, 111, 59, 74, -100, -35, -87, 77, 34, 55, -105, 55, 9, -10, -75, -105, 96, 74, -10, 15, -62, -81, 10, 71, -31, 49, -68, -9, 96, 124, 81, -58, -25, 12, -4, -77, 50, 43, 75, -10, -53, 127, -89, -62, 4, 7, 58, -59, 111, 27, 38, -18, 3, 13, -90, 58, 81, -31, 13, 34, -50, -34, -55, 81, 105, 30, 53, -49, 81, 97, -9, 19, -92, 68, -44, 47, 22, 109, 61, 19, 62},
+  {52, -32, 60, 0, 80, 89, 0, -119, -99, -85, 42, -94, -80, 63, 69, -27, 5, 20, -20, -30, -100, -69, -80, -122, -102, -45, 62, -15, 110, 104, -12, 55, 89, -100, 75, -18, 37, 50, -69, -65, 23, 109, -90, -109, 22, 79, 63, -107, 109, 38, -5, -53, -13, 60, -102, 28, -50, 92, 17, -63, -58, 7, -30, 38, -62, 0, 107, -5, -117, 80, 3, -109, 92, -105, 104, -30, 38, 37, -127, 37, 104, -7, -40, -72, 74, -7, 67, -70, 13, 2, 90, -7, 25, 82, -112, -85},
+  {65, -30, -5, -20, -72, -15, 53, 79, 84, 39, 20, -44, 45, -36, -70, -10, 33, -86, -74, 31, 28, -29, -34, -70, 62, -21, 48, -57, -33, 18, -87, 88, 74, 63, 65, 33, -26, 29, 82, -57, 83, 6, 84, 13, 19, -25, 5, 47, -82, -23, 55, 36, -74, -52, 67, 48, 4, -10, 23, 101, 39, 4, 6, -74, 49, 15, -4, 127, 78, 36, 58, -25, -50, -69, -83, -21, -44, -87, -45, -63, 73, 8, -50, 86, -26, 14, 58, 53, -58, 1, 0, -26, -98, 9, -15, 82},
+  {-43, 100, -45, -56, 5, -53, -50, -13, -66, 58, -93, -98, 29, 66, -53, -100, 42, 13, 84, -2, 13, 116, -21, -64, -119, 43, -69, -127, -27, 63, -6, 43, -3, -109, 55, 74, 8, -23, -56, -61, 37, -48, 32, -14, -42, 32, -19, -96, 63, -64, -68, 69, 45, -90, 66, 37, -29, -90, -5, 90, -5, -18, -69, -11, 56, 106, 72, -39, 96, 59, -101, 95, -11, -21, 2, 24, 32, -92, 10, 95, -98, 98, 77, 55, -29, 85, 45, 92, 34, -6, -100, 8, 6, -55, -23, 64},
+  {80, 62, -28, -110, -102, 127, 42, 95, 57, -43, 28, 58, -18, 10, 10, 82, 33, -109, -57, -99, 62, 72, 15, -45, -87, 107, 62, -43, -102, -82, -70, 109, -22, 110, 3, -92, 30, 115, -87, 87, 0, -35, -32, 72, -100, 20, -69, -77, -87, 12, -102, 99, -77, 42, 69, 57, -43, -40, 20, 72, 110, -117, -109, -7, -114, -55, 47, -50, -104, -27, 37, 62, 50, -74, -104, 72, 79, 53, -45, 48, 43, 17, 90, -32, 114, -67, -95, 69, 42, 27, -13, -100, 65, 32, -53, 69},
+  {10, 24, -50, -47, 85, 113, -109, 104, 63, 79, 58, -32, 106, 16, -21, 109, -19, -98, -71, 69, 96, 5, 101, -8, -74, -24, 76, -85, 96, -64, -18, 72, -69, 0, -45, 114, -104, 82, -80, -95, 0, 27, 85, -13, -122, -13, 29, 2, -14, 101, 2, 87, -77, -106, 51, -18, 40, -125, -109, -127, 98, -13, 0, 16, 80, -55, -111, 72, -14, 3, -51, -47, 55, 37, 76, 88, 111, -109, 10, -77, 42, -87, 109, 47, 34, -72, -47, 21, 39, -39, -82, -19, 31, 34, 101, -14},
+  {83, -52, -56, -55, 61, -57, -22, 49, 97, 91, -94, -4, 72, -40, -64, -52, 90, 41, -71, 82, -81, 22, 127, -38, 107, -90, 115, 112, 63, -40, 10, 30, 19, 55, -72, -36, -78, 42, -1, -29, -53, -40, 98, -48, 7, -31, -37, 25, -26, 56, -79, 63, -60, 37, -117, -49, 25, -27, -76, -85, 51, 23, -7, -97, 52, -98, -104, -60, 52, 70, 74, 93, -117, -97, -96, 63, -104, -97, 66, -85, 70, 55, 36, 52, 15, -23, 78, -4, -70, 70, 89, 0, 42, 38, -61, 102},
+  {79, 25, -59, 89, -122, -68, -21, 0, 51, 20, -122, -59, -73, 43, 46, 48, 8, -81, 38, 82, 49, -89, -102, 115, 40, -51, 64, -99, -51, 20, -7, -16, -119, -58, -15, -45, -74, 73, -99, -84, -109, 112, -54, 71, 99, 97, -48, -127, -21, 94, 12, -74, 2, 49, 112, 18, -16, -114, 20, 3, -31, 54, 31, -104, 8, 46, 82, 81, 81, -107, -7, 112, -69, -49, -51, -64, -26, -97, -45, 25, 102, 56, 21, 81, 106, -7, 7, 109, 15, 76, -33, 15, 97, 117, 87, -26},
+  {106, 86, 91, -103, 46, 107, 20, 54, -68, -44, 73, -81, 40, 68, -100, -49, -83, 19, 84, -73, -88, -118, 68, -100, -43, -74, -78, 36, -44, -49, -20, 56, 113, -49, -27, -106, 96, 9, -24, -67, 100, -100, 40, 76, -71, 127, 60, -56, 30, 51, 40, 43, 43, -83, -49, -40, -64, 21, -13, -97, -19, -9, 81, -11, 73, -1, -64, -71, 20, -40, -37, 33, -36, -84, 26, -20, 77, 114, 1, 70, -110, -64, -36, 51, 70, -46, -77, 93, 110, -74, -87, 1, 40, -63, 110, -37},
+  {10, 53, -33, 11, -51, -15, -79, 113, -20, -3, 16, 107, 5, 38, 44, 76, 64, -42, 109, -127, -102, -23, -83, 107, 101, -38, -36, -38, -72, 74, -63, 105, 5, -68, 83, -49, -30, 76, -86, -63, -60, 63, 81, -68, -53, -33, -67, 90, 66, 36, 98, -37, -49, -26, 71, -90, 5, 15, -100, 48, 7, 61, -64, -42, -23, 124, 52, 57, 59, -41, 74, 23, 97, 59, 97, 38, 40, -8, -23, -7, 37, 56, 3, 10, -96, -107, -26, -72, 112, 100, -68, -100, -56, 44, -67, 36},
+  {-78, -44, -89, 127, 78, -102, -78, 50, -22, -84, 58, 47, 49, -7, -49, -72, -18, 72, -78, 69, -21, -93, 115, -86, 58, 55, -71, -71, -46, -28, 109, -87, 106, -99, -90, -93, 90, -47, -43, -22, 62, 89, -47, -106, 21, -21, 61, 109, 64, -71, -115, -109, 103, -66, -4, -83, -31, 6, 77, -75, -27, 99, 24, 62, 72, 72, 87, -4, 86, -12, -61, 19, 72, 1, 75, -120, 50, 112, 1, 112, 92, 30, -19, 3, -50, 1, -78, -66, -96, -95, 9, -10, 12, 52, -41, -12},
+  {-77, -84, -17, 34, -35, 84, 12, 72, -106, -54, 99, 57, -38, 46, 87, 49, -69, 121, -116, -31, -104, 24, 55, 0, 18, 3, 64, 41, 12, -92, 98, -58, 77, 57, -44, -57, -66, 32, -107, -47, -50, 115, -21, 46, -69, 54, -121, 31, 31, 52, 77, -32, -61, 57, 2, 18, -37, -41, -29, 92, 107, 23, -3, -93, 38, -44, 26, 0, 41, 115, 63, -93, -80, 96, 95, 2, 70, 103, 21, -69, -58, -31, 61, 15, 52, 49, -81, 95, 54, 87, 15, 127, 84, 60, -96, 67},
+  {-25, -44, 0, 127, 44, 19, -64, 26, 76, -3, -105, -35, 22, 66, 15, 85, 38, 98, 57, 45, 126, 91, 18, -42, -50, -69, -69, 112, 6, -89, -107, -18, -41, 83, 41, -15, -63, 54, 31, -88, 88, 73, 48, -73, -31, 64, -16, -69, 109, 50, -104, 45, -61, -86, 41, 91, 72, -96, -25, 91, -16, 53, -82, -126, -101, 91, -42, -57, 48, 41, 4, -34, -108, -26, 86, 79, -76, 1, -99, 31, -77, -32, 80, 42, 54, 55, -32, 104, -95, -4, -39, -69, -60, 61, -39, 80},
+  {-1, -78, -96, -107, -37, 6, -86, 111, -32, -51, 92, 11, 71, -3, 61, -54, -82, 8, 72, 87, 13, 49, -127, 41, 79, -54, 4, 24, -76, 14, -68, 72, -99, -37, -52, -110, -3, 90, -32, 103, -71, -8, 96, 32, -95, 10, -32, 68, -54, -106, 92, 90, 75, 80, -35, -104, -87, 89, -38, 27, 49, -3, -96, -68, 17, -85, 52, -13, 31, 30, 0, 83, -47, -4, -76, 99, -106, -6, -25, -35, -7, 18, 93, 48, -48, -23, 3, 35, 3, -92, 55, 102, -42, -7, -100, 51},
+  {-69, -101, 42, -119, -87, -14, -96, -5, -10, -68, -80, 24, -93, -66, 69, -39, 39, 77, 21, -74, 121, -58, 21, 82, -3, -68, 39, 92, 74, -8, 111, 19, -42, 117, 27, 104, 66, 103, 43, 24, -45, -53, 10, -104, -29, 101, -37, 103, 82, 82, -39, -8, 21, -51, -68, 68, -85, 98, 53, -58, 45, 42, -39, -45, 76, -85, -68, 18, 109, -111, -18, 92, 127, -58, 109, 45, -16, -92, 108, -106, 23, 40, -42, 55, 2, -42, -113, 45, -24, 39, 43, -109, 95, -42, 82, -27},
+  {-27, 97, 82, 67, 50, -80, -24, 88, 33, -53, 73, 30, -103, -65, 94, 60, -18, 109, -20, -127, 82, 60, -38, 83, -119, 88, -32, 68, -18, 11, 33, 97, -57, -21, -88, -104, 9, 63, 103, -91, 30, -5, 27, -3, 8, 110, 15, -32, 91, 113, 8, 63, -65, 24, 42, -26, -20, -85, 15, -62, 36, 44, -100, -115, 11, -80, 32, 106, 35, -44, 115, 0, 76, -42, 95, 17, 41, 47, -91, 36, -89, 50, 47, -47, 17, -2, -3, 101, 59, -68, -80, -38, -2, -85, -47, 29},
+  {28, 102, 58, -42, -105, 96, 93, 103, 88, 30, -53, 113, 36, 55, -114, -17, 31, -11, 14, -121, -17, 103, 82, -75, 0, -20, 24, 27, 13, 100, 56, -107, 116, 105, 91, 72, 99, 111, 33, 5, 99, 61, 63, -88, -64, 47, 88, -108, 16, 66, 44, -41, -53, -97, -5, -19, -85, -20, -25, 78, -3, 85, -27, 2, 66, -88, 89, -118, 77, -47, 105, -75, -3, -72, 111, 80, 107, 24, 86, 9, -99, -42, -16, -93, -9, 56, -77, -22, 53, -34, 47, 8, -47, 96, 89, 127},
+  {-83, 44, -90, -92, -110, -11, -110, 49, 65, -71, 21, -2, -6, 52, -32, -40, -78, 75, 21, 60, -6, -86, -92, 60, 0, -37, 125, -37, 52, -84, 5, -51, 94, -49, -10, 27, -6, 111, -102, -68, -117, 75, 37, -108, -68, 5, 13, -102, 22, 52, -116, 22, 111, -37, 78, 60, 68, -33, 11, 17, 10, -29, 35, 33, -92, -127, -22, 100, -10, 79, 25, 87, 78, 124, 98, 54, -17, -48, 29, 100, 0, 27, 70, 32, -37, 108, 6, -48, 21, -68, -62, 95, 11, -51, 89, -40},
+  {81, 104, 64, -50, 46, -49, -83, -8, 29, 93, -81, -117, 64, 46, 29, 11, 125, 41, 24, -72, -124, -119, -78, 64, 24, -96, -24, 101, 78, -125, -11, 3, 16, -46, 52, 112, -103, 18, -47, -20, 44, -60, 116, -15, -28, -62, 24, -111, 73, -70, 127, -104, 77, -21, 7, -10, 107, -65, -103, 49, 41, 94, 111, -122, -94, 31, -42, 64, -15, -24, -8, 93, 78, -93, -55, 16, 0, -111, 120, -104, -50, 54, 80, 41, 21, -41, 104, 0, -18, -85, -36, -67, 8, 55, 85, -26}
+};
+
+static const int32_t conv1d_118_int8_offset[64] = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+
+static const int32_t conv1d_118_int8_multiplier[64] = { 1803947590, 1615162377, 1908828264, 1678090781, 1678090781, 1657114646, 1552233973, 1720043051, 1782971455, 1761995320, 1845899859, 1657114646, 1552233973, 1615162377, 1657114646, 1720043051, 1761995320, 1866875994, 1636138512, 1741019186, 1699066916, 1971756668, 1678090781, 1720043051, 1866875994, 1950780533, 1887852129, 1824923725, 1761995320, 1678090781, 1678090781, 1824923725, 1782971455, 1657114646, 1845899859, 1824923725, 1720043051, 1741019186, 1887852129, 1657114646, 1699066916, 1678090781, 1657114646, 1657114646, 1782971455, 1803947590, 1594186242, 2118589611, 1657114646, 1594186242, 1657114646, 1950780533, 1615162377, 1866875994, 1950780533, 1803947590, 1741019186, 1824923725, 1887852129, 1657114646, 1761995320, 1699066916, 1678090781, 1636138512 };
+
+const int8_weights_t conv1d_118_int8 = {
+  96, &conv1d_118_int8_kernel[0][0], conv1d_118_int8_offset, conv1d_118_int8_multiplier, 25,
+  26415, 21, 0, 132
+};
+
+#define CONV1D_119_INT8
+
+const int16_t conv1d_119_bias[128] = {-2, -10, 14, 0, 9, -11, -5, 20, 3, 4, 10, 6, -16, 0, 6, 12, -4, -15, 0, -5, 19, -16, 0, 8, 4, 14, -8, 2, -10, 1, 15, 12, 0, 0, 1, 6, 1, -9, 22, 2, 6, -6, -13, 7, 3, 12, 6, -12, 17, 7, -14, 4, 0, 12, -5, -8, 22, -1, 1, -5, 5, 9, -10, 4, -1, 16, 0, 19, -7, 3, 21, -6, -2, -15, 0, 6, 6, -8, 9, 9, 2, -3, -16, -9, -6, -7, 5, 22, -2, -5, 10, -4, 22, 5, 13, 4, 8, -15, 17, -3, 0, 17, 3, -6, 14, -8, 12, -4, 2, -5, 4, -3, 6, 2, -4, -3, 7, -2, 11, 15, -3, 0, -4, 4, -3, 2, -4, -8}
+;
+
+static const int8_t conv1d_119_int8_kernel[128][192] = {
+  {-67, -83, -44, -85, 119, 50, -10, -79, -71, 0, -110, -54, -56, -77, -110, 31, 85, -100, -69, -50, -44, 67, 81, 31, 123, 69, -60, 0, -15, 73, 19, -12, -85, -121, -67, 0, 19, 52, 94, -46, -19, 40, 44, 8, 37, -67, 62, 50, -21, -125, 81, -125, 102, 85, -10, -4, -44, -90, -12, 90, 0, 112, 56, -4, -4, 108, 123, -23, 85, 90, -90, -62, 52, -62, -71, 60, -54, 69, 98, -87, 102, 60, 56, 12, -50, -65, -42, 85, 10, 10, -37, -35, -60, 17, 21, 65, -79, -104, 127, -6, 29, -77, 119, 100, -71, -85, -6, -98, -69, -58, 79, -81, 31, -106, 60, -27, -77, 21, 44, -65, -6, 67, 29, -23, 33, -42, -73, -29, 10, -77, 75, -35, 54, -96, -106, 44, -12, 92, -62, 92, 60, -10, -56, 60, 62, 37, -17, 104, -48, -50, 83, -44, -62, -115, -4, -40, -94, 83, -96, -102, 90, 87, 25, 104, -96, -6, 31, 96, 123, -77, -37, 6, 104, -67, 67, -81, 77, -87, -96, -65, 117, -4, 62, -65, -92, -12, 48, 106, 19, 10, 56, -79},
+  {26, 38, -46, 91, -10, 46, 58, -75, 46, -60, 10, 10, -93, -34, -95, 60, -89, -87, 73, 87, 16, 24, -18, -50, 58, -4, -91, 56, 73, -93, 44, 6, -56, -73, 22, -91, -20, 105, -20, 95, -81, -95, -60, 62, -32, -81, -65, 40, -73, 64, 65, -46, -64, -48, -20, 56, -95, 73, 34, -77, 38, -58, 26, 0, 105, -32, -71, -75, -93, -40, -67, -4, -52, -14, -95, 95, 52, 81, 16, -60, -93, -65, 62, -48, 54, -34, -4, -54, -18, 42, -95, 40, 56, -71, -48, 50, -83, 22, 10, 125, 83, -38, -10, 12, -62, -95, 107, 42, -79, 81, -14, -89, -4, -127, 109, -119, 79, -44, 71, -58, 73, -95, 73, 60, 65, 26, 42, 46, 44, 32, -121, 42, -81, 60, 26, 26, -64, 20, 40, -65, -22, 4, -48, 38, 32, -81, 73, 93, 93, 44, 105, 77, -16, 40, -36, -54, -62, 73, 93, -60, 24, 50, 24, -83, 36, 40, -58, 101, 30, 2, -40, 34, -44, 32, -99, -91, -20, -89, 99, -16, 24, -93, 73, -50, -40, 73, -6, 30, -54, 20, -10, -69},
+  {-14, -80, 45, -80, -74, -20, 51, 80, 96, 80, 64, -35, -8, 27, -84, -57, -27, -37, 53, 0, -68, 80, 6, 80, 18, -111, -31, -18, 66, -72, 18, 61, -8, 2, 109, -82, -92, 18, 119, -127, 82, -10, -6, 21, -55, 59, 18, -39, 96, 57, -107, 115, 64, -18, 86, 0, 25, 25, -53, -41, 0, 33, 18, -21, 53, 27, 14, -121, -57, 78, 104, 55, -53, 104, 66, 92, -33, 20, 94, -21, 49, 29, 88, -57, -86, 49, 74, 86, 43, -4, 25, -20, -45, 4, 39, -39, 55, 23, -86, -45, -86, -63, -70, 35, -16, 31, -72, 2, -49, 0, 94, 68, -41, 47, -98, 4, 84, -88, -92, 20, -45, 123, 14, 41, 113, 51, -57, 18, 39, 12, -94, 33, -98, 25, -78, 27, -63, 2, 100, 31, -102, -12, 21, -45, 94, -117, -27, 10, 96, -16, -47, -14, 117, -20, 12, 39, -21, 57, 12, -37, 49, -76, -39, -121, -6, 23, 12, -98, -55, -41, 16, -80, -16, 76, -29, 86, 102, 43, -82, -14, -55, 43, 72, -45, -68, 117, 49, -59, 98, 63, -72, -8},
+  {0, -68, 32, -2, 78, 53, 53, 55, -49, 0, -34, 11, 80, 0, -78, 45, -87, 51, -6, -97, 47, -6, 44, 27, 45, -116, 34, -70, 70, 80, -100, 53, 99, 45, 59, -2, 6, 80, -85, 0, -106, 74, 23, 40, 91, 78, -45, -64, 2, -13, 85, 51, -63, 87, -59, 28, 63, 6, -76, 9, -11, -47, 97, -89, -11, 47, -89, 17, -78, 76, -11, -57, 87, 15, 99, 25, -40, 57, -91, 27, 34, -47, 97, 87, -11, 38, 53, 127, 104, -19, 119, 63, 32, -72, -8, 36, 0, 30, 108, -78, -30, 53, -61, -28, -93, -2, 44, 40, 40, -63, 45, -61, 59, 63, -68, -21, -82, -59, -4, -49, -4, -17, -68, 45, -9, -80, 68, -23, 0, 87, 6, 76, -4, -15, 19, 36, -34, -42, 93, 87, 72, 87, 15, -80, -44, 19, 0, 89, -66, -72, 47, 78, 99, -59, 61, 17, 11, 59, -38, -4, -6, 53, 100, -66, -100, -85, -13, -34, 42, 36, 17, -53, 108, -66, 42, 6, 91, 61, 59, 80, 74, 11, 28, 0, 97, -4, 95, 70, 8, -32, -19, -28},
+  {57, -49, 68, -86, 4, -6, 27, -20, 74, -29, -125, -18, -57, -84, 51, 117, 10, 59, -20, -84, -45, -61, -88, 0, -4, 111, -16, 57, 59, 84, 80, -29, -68, -18, 49, 68, -80, 98, -61, -66, -82, -68, 37, 39, -41, -61, -55, -8, -45, 68, -76, 18, -72, -14, 90, 29, -64, -43, 61, -45, 92, -18, -23, 61, -23, -6, 100, -115, -78, 10, 59, 66, -72, 25, 31, 0, 27, 53, 74, -61, 59, -33, -35, 80, -84, 35, -47, -86, 29, 39, 25, 80, -20, -37, 51, -33, 88, 16, 2, -10, -84, 37, 41, 82, -10, -115, -37, 25, 16, -31, 76, 25, 53, -37, 59, 88, 92, -35, 80, -84, -72, 104, -76, -78, -14, 84, -76, 47, 72, 66, -37, -61, 39, -82, 27, -57, -45, 64, -16, 53, -100, -100, -33, -29, 98, 2, -86, 84, 68, 61, 102, -74, 14, -57, -27, -86, 109, 14, 10, -27, 68, -96, 35, -64, 94, -92, -51, 49, -43, -57, -8, 59, 53, 123, -35, 8, -51, 68, 90, 59, 23, 27, -6, -33, 94, 127, -74, 88, 111, -14, -111, -49},
+  {2, 74, -85, 103, -64, 70, 57, 59, 85, -44, 20, -74, -74, -39, 17, -35, -75, -98, -18, -17, 0, 107, -72, 81, 74, -7, 68, 18, 72, 61, -13, -22, 123, -39, 44, 66, 29, -24, -33, 4, -52, 66, 44, -116, 33, 77, -24, -99, -26, -120, 9, 28, -46, -2, -83, 28, -87, -74, -29, 90, 20, -87, 70, 64, 74, -98, 7, 35, -70, 77, 35, -64, -85, 2, 29, 55, -24, 50, -4, -81, -46, -22, -59, 105, -68, -53, 31, -75, 101, 68, -90, -29, -26, -13, 28, -20, 79, 70, 59, -59, 88, 22, -24, -127, -114, 17, -39, -9, 24, -48, -11, 72, -105, 50, -57, 26, -33, 83, 90, -31, 74, -70, 31, 17, -75, 66, -74, 11, -13, 31, 39, 66, -61, 66, 66, 79, -15, -50, 6, 0, 70, 81, -83, -11, 79, 52, 70, -39, -66, 17, 63, 0, 77, -52, 44, 61, 13, -40, 31, -6, -37, -26, 61, 24, 68, 74, 35, -17, -13, 0, 74, 24, 50, -70, 57, -70, 40, -81, -52, -105, 103, 63, -28, 18, -70, -64, 24, -4, -53, 85, 107, -107},
+  {-58, -87, -71, 31, -85, 90, 0, 85, -75, -83, -37, -87, 40, -27, -35, -94, 10, -71, 40, -19, 71, -79, 67, -77, 12, -104, 23, -100, -29, 58, -44, 48, -46, 73, 42, -37, -62, 0, 96, 110, 40, -65, 27, -92, -67, -104, -2, 6, -104, -79, 31, -62, -8, 62, -83, -31, -37, -117, -65, 75, -83, -92, -52, -8, -2, 58, 69, -44, 4, -90, 44, 40, -23, 79, 15, -21, 98, -40, 6, 44, -83, 85, -79, -106, 75, 0, -40, -67, -90, 8, 52, 23, -37, 75, 65, -27, -90, 27, 52, 75, -50, 0, -98, 0, 87, -75, 87, 19, -37, -46, 77, -119, -2, 29, -90, -52, 37, 21, -50, 0, -33, 90, -10, 71, -106, 6, -15, -35, 100, -56, -127, -37, -100, 69, 98, -69, -37, -65, -65, 6, 58, 10, 92, -87, 94, 42, 58, 29, -90, -21, -104, 75, -96, -79, 69, 71, -15, 37, 4, 42, -12, 98, 92, 52, -2, 19, 17, 17, 98, 50, -25, 52, 58, -90, -23, 56, 46, -81, 8, -2, -37, -33, 60, -96, -46, 0, 71, 98, -65, -52, 8, 15},
+  {85, 0, -33, 44, -55, 33, -31, 7, 17, -39, 88, 29, -7, -112, -4, -26, -57, -20, 0, -55, -2, 0, -81, -4, 20, 9, 26, 11, -61, -4, -92, -79, -50, -66, 96, 33, 99, -40, -33, 7, 55, -4, -94, 33, -44, -90, 92, 90, -33, 2, -81, 101, 17, 94, -39, 18, -63, -53, -42, 90, 37, -70, 53, 22, 9, 66, -17, -31, 81, 17, 83, -15, -94, 18, 92, -66, -88, 29, -90, 7, -4, 88, 2, 83, 66, 40, 40, 50, 94, -52, 0, 81, -74, -37, -90, 17, 87, 72, 28, -11, 52, -35, -2, -61, -37, 6, -75, 33, -44, -66, -70, 64, 114, 61, -46, 88, 79, 46, 50, 26, -42, -6, 42, 81, 61, 26, -4, -79, -13, 55, -66, -53, -70, -4, -50, -15, 64, 105, 35, -9, 77, 61, -57, 40, 90, -18, 105, 4, 70, 0, 50, 29, 72, -59, 90, 29, -63, 64, -50, -37, -90, 29, 37, -99, -53, 42, 118, -79, -83, -101, -64, 37, 33, -6, -28, 37, 127, 17, -105, -31, -39, -40, 77, 15, 28, 81, -40, 4, 33, -40, -2, -50},
+  {11, -70, -59, 29, 78, -44, 3, 86, -39, -39, 62, -46, 0, 41, 33, 77, -8, -3, -68, -67, -60, -24, 46, 57, 29, 36, 55, 62, 59, 13, 31, 8, 50, 104, -34, -70, -78, 77, -18, 80, 0, 67, 47, 31, -47, -68, 78, 60, -54, 67, -59, -62, 36, 83, 23, 60, 21, 3, 54, -31, -33, -24, 73, -13, -52, 34, -33, 83, 5, 54, -28, -21, -13, -15, -41, 77, 36, 46, 13, -73, 37, -62, 67, -52, 54, -36, 72, -18, 24, 28, 127, 64, -36, -68, -28, -80, -10, 83, 60, -18, -31, -47, -33, -57, 33, -49, 62, -20, 18, -49, 50, -52, -5, 59, -52, -80, -15, 33, -42, 52, -34, -67, 37, -34, -77, 20, 86, -33, 29, -5, 75, 70, 31, 81, 15, 13, 13, 0, 60, -3, 37, -68, -28, 10, -42, 68, 11, -75, -47, 70, 78, 57, 3, -31, 52, 81, -75, 68, -33, 106, 86, 23, -13, 5, -20, -34, 81, 60, 34, 44, -47, -47, -67, -3, 67, 75, -50, -55, -55, -8, -80, 26, 13, 3, -15, 26, 13, -24, -73, -11, 7, -47},
+  {21, 92, 37, -12, -76, -18, 33, -98, 78, 8, -51, -51, -35, 76, -31, 49, 84, -25, -20, 53, 49, -20, -66, -21, -59, 41, 104, 33, 55, -68, 49, -29, -41, 0, 53, 70, 88, 100, 98, -29, -23, 64, -104, -27, -76, 21, 0, 31, 78, 31, 37, -51, 84, 88, -51, 82, -39, -98, 72, -16, -45, -14, -53, 82, -35, 43, -14, 84, 27, 66, -72, 33, -64, -76, -84, -47, -10, 127, 41, 57, 2, -45, -68, 0, 27, -74, 55, -68, 84, 51, 10, 33, 64, 31, 119, -18, 47, -111, 43, 39, 92, -63, 113, 10, -63, -55, 47, 29, -78, -72, -4, 84, 121, -53, 104, 33, -2, 2, -16, -29, -49, -68, 78, -72, 61, 102, 68, -53, -27, 66, 111, -55, -78, -109, -111, 82, 80, -37, -18, -14, -57, -8, 23, -64, -70, -8, 88, 16, -72, -14, -37, -23, -84, -20, -100, -100, -64, 39, 0, -61, -8, 64, 74, 55, 8, -18, 0, 64, -43, -107, -10, -88, -64, 21, 61, 14, 31, -55, 72, -68, 92, -6, 39, -35, -33, 59, -37, -2, -61, 0, -96, -23},
+  {-47, -44, 25, -49, -34, 37, -8, -69, -2, 2, 63, -51, 90, -14, 36, -12, -5, 24, -5, 61, -54, 58, -80, 39, 63, -44, -86, -10, 3, -58, 14, 25, 49, 3, -54, 29, 2, -64, -10, 46, -24, 76, -59, -46, -52, 85, 59, 3, 3, 24, 25, 32, -46, 37, -14, -56, 64, 119, -124, -37, 71, -78, -85, 51, 103, 41, -30, -22, -56, -73, -41, -30, -25, -49, -15, -63, -12, 5, -63, 71, 93, -85, 100, -30, -12, 58, -88, 108, -17, 76, -25, -20, 42, -46, 29, 75, 14, 32, 54, -127, -73, 12, 63, -80, 12, 68, 36, 78, -7, 0, -20, 2, 27, -46, -81, 36, -52, -61, -2, -29, 56, 80, 22, -68, 14, 32, 20, -54, -52, 41, 64, 3, 8, 0, -63, 95, -103, -27, 61, 73, -30, 5, 69, 49, -30, 41, 59, 2, -61, -52, -37, 44, 46, 78, 51, 69, -39, 3, -63, 42, 73, -51, 102, -80, -37, 73, -2, -32, -58, 113, 37, -54, -30, -8, 52, 64, 63, 64, 24, 58, -56, -29, -93, 46, 32, 44, 42, -36, 54, 0, 61, 47},
+  {20, -40, -33, -9, -72, 4, 42, -61, 20, 79, -29, 31, 17, 6, -68, 70, 98, 9, 81, 64, -63, -31, -75, -88, -31, 26, -61, -53, 74, -9, -24, -64, 72, 0, 42, -52, -92, 15, -63, 88, -83, 20, 9, -85, -6, 85, 39, 28, -29, 24, 39, -37, 64, 63, 74, -42, -74, 35, 11, 40, 66, 48, 70, 79, 103, -46, 85, 20, -35, 79, 57, 90, 50, -37, -26, -55, -79, -24, -7, 46, 94, 44, -68, -40, -40, 20, 6, -29, 13, -79, -61, -11, -18, -61, -66, 37, 81, -11, 127, 22, 28, 70, -44, 31, -83, 24, -44, 101, 83, -50, 17, 39, 18, 52, 37, 42, -70, -46, 0, 48, -70, -68, -31, -46, 24, -75, -15, 0, -53, -61, 79, -96, -92, 20, -17, -31, 42, 88, 74, -79, 85, -98, 4, -20, 24, 68, 28, 50, -40, -74, 39, -15, -17, 7, 11, 77, -64, -46, 7, -6, 72, 44, 61, 72, -22, -28, -68, -74, -77, -59, 13, -2, 22, -96, -72, -48, -87, -77, 0, -81, -44, 63, -15, -39, -35, 15, 50, -85, 98, 61, 88, -6},
+  {31, 69, -125, -108, -54, -2, 27, -96, -58, 44, -69, 33, -104, 73, 4, 29, -12, 60, 35, -98, 12, 0, 44, 98, 100, -96, -4, 0, -69, -58, 2, 0, 85, -119, 58, -27, 15, 100, -52, 52, -81, 79, 23, 29, 69, 8, -104, -6, -79, 8, 81, 92, -27, 96, -31, -65, 46, -87, 56, 40, 69, 29, 79, -104, -23, 48, 65, 21, 37, 8, -8, 77, -123, -92, -33, 110, -71, -46, -123, -33, 19, 106, 29, -90, -73, 52, -102, 2, -73, 23, 21, -73, -21, 90, 33, -33, -62, -6, 98, 4, 87, 100, 54, 46, -25, 81, 10, -108, 31, 83, 83, -67, -65, -62, -94, 0, -8, 4, -25, 85, 85, -23, -125, 29, 73, -23, -29, 54, 8, -35, 69, 17, 0, 60, 33, 25, 2, -37, 85, -10, -31, 60, -46, 98, -58, -121, 27, 96, 62, 29, 27, 27, 58, 27, -85, -31, 31, -102, 46, -10, -35, 87, 100, 83, 60, -10, 46, -83, 40, -127, -37, 75, -106, 37, 79, -94, 54, 81, 33, 87, 69, -10, 8, 35, -87, 2, -4, -25, 94, -35, -62, 0},
+  {105, 64, -16, -32, -77, 28, 79, 103, 69, 52, 4, 50, -91, 24, -14, -81, 85, -62, 54, 91, 52, 109, -38, 6, -50, 0, -123, -46, 34, -65, 48, 77, -91, 64, -48, 89, -26, 85, 73, -44, 26, 65, -93, 18, -52, 89, -12, 50, -20, 36, -34, -4, 56, -73, -6, -79, 91, 113, -34, -95, 8, 89, 40, 16, -77, -85, -2, 0, -109, -20, -46, -50, 93, -28, -30, 46, 28, 60, 30, 42, 65, -26, -87, -34, 34, 6, -16, -127, -62, -81, -64, 44, 46, 69, 95, -67, -34, -103, -36, 58, -18, 109, -58, 0, 14, 44, -48, 0, -83, 64, 34, -10, -103, -62, 79, 44, 101, -40, -2, -50, 97, 95, -44, 14, -67, -28, 52, 79, 81, 60, -91, -6, -6, 6, 97, 22, 67, -65, -28, 10, 67, 65, 18, 48, -79, 28, 56, 89, -30, 6, 60, 8, 56, 111, 32, -81, 4, -22, 2, -44, -12, 81, -113, 34, 83, -83, 58, 73, -91, 32, -16, 12, -87, -8, 2, 81, 14, -30, -48, 2, -28, -103, -99, -52, 64, -85, -8, 22, -2, -16, -69, 14},
+  {32, 40, 57, 62, 48, 99, 8, 15, -13, -82, 7, 7, -58, 32, 60, 72, 55, -12, 3, 8, -63, -10, 10, 62, 87, -20, -2, -74, 47, 50, 2, -47, 60, -65, 3, -18, -38, -53, -10, -40, -27, 3, 27, 22, -80, 63, 10, -5, -27, -48, 77, 48, 0, -70, 50, -48, 72, 0, 25, 40, -32, 80, -27, -2, 23, -25, 8, 28, 37, 0, -74, -55, -5, -23, 20, 32, 13, 12, 70, 58, 3, 2, 57, -85, 40, 82, -82, -25, -7, 15, 15, -80, 69, -67, 8, -20, 20, -15, -8, 5, -27, -28, 42, -57, 35, 40, -62, 40, -69, 0, 53, 100, 77, 17, -38, 72, -2, -82, -94, 50, 2, 82, 124, 50, -20, -84, 0, 0, -94, -20, 127, 79, -74, 65, 89, -67, -80, 25, 94, -12, 82, 42, 45, 10, 52, -58, -43, 35, -28, 25, 3, -75, 55, 89, -50, -75, -67, -53, 50, 48, -53, -65, 3, 70, 47, 82, -74, 37, -57, -2, 48, 60, 84, 65, 102, 92, 53, 60, -63, -25, 30, -13, 80, 90, -33, 94, 33, -43, -84, 22, 15, -10},
+  {65, -92, 106, -44, -33, 71, -71, 48, -19, -106, -85, -108, -58, -83, 23, 4, 83, 25, -35, 27, -85, 37, 15, 6, 23, 60, 87, -71, -19, -12, 17, 125, 25, -35, 23, 58, 15, -42, -73, -21, -33, 6, 96, -48, -48, 37, 58, 2, -10, -6, -67, -58, -40, 50, -6, 6, 83, 65, 35, 106, 85, -17, -10, -71, 15, 65, -33, -2, -60, 83, 25, -8, 69, -44, -115, -10, 96, -23, 73, -29, 54, 17, 27, 12, 10, 108, 100, 2, -10, 100, -62, -54, -71, 37, -31, -69, -67, 2, 42, 65, -67, 56, -108, 94, -35, -15, 23, -90, 27, -6, -81, 85, 73, 42, -94, -27, 98, -90, 85, -67, -90, 62, 62, -65, -17, 79, 29, 83, 27, -102, 100, 19, 102, -54, 19, -42, 73, -6, -75, -19, 75, -6, 0, 21, 2, 17, -12, 25, -19, 52, 40, -56, 65, -79, -56, -112, 77, -98, 83, 25, 44, -48, -54, 117, 4, -96, -65, 127, -12, -56, -83, -62, 106, -94, -35, 44, -2, -115, 44, -40, 27, 0, -48, 8, 29, 117, -79, 2, 69, 90, -6, -35},
+  {75, -58, 38, -106, -100, 35, 40, -104, 0, 4, 0, -35, 38, -6, -75, -81, 50, 12, -127, 85, 42, 85, -48, 75, 19, 44, 67, -54, -52, -29, 35, -21, -21, -35, 37, 94, 56, -73, 44, 58, -46, -13, -77, -6, -104, 83, 13, -90, -83, -89, -13, -52, -19, -60, -85, -92, -40, -81, 10, -79, -35, 33, -119, -8, -65, -15, -79, -38, -46, 40, 25, 67, 44, 73, -46, 0, 54, 117, -65, -75, 54, -85, -12, -85, 77, -67, -96, -33, -48, 27, 62, -56, 62, -64, 52, -8, -2, 60, 81, -94, -46, -85, 4, 94, 21, 73, -31, 37, -65, 29, 23, 0, -31, 6, -52, 90, 69, 71, -106, -4, 12, 19, 19, 29, -98, 10, 21, -87, -29, -21, -12, -12, 94, 17, -38, 102, 100, 44, -46, -90, 37, 48, 98, 40, -29, 79, 31, -21, -4, 27, -62, 83, -2, 85, -62, 73, 0, 0, -15, 54, 42, -90, -52, -19, 69, -23, 71, 100, -96, -83, -58, -90, 87, -12, -25, -38, 64, 31, 40, -75, -25, -37, 12, -44, 29, -35, 65, 77, 27, -6, 37, -40},
+  {82, -88, -29, 106, -57, -63, 70, -63, 29, 59, -66, 82, -57, 25, 2, 10, 35, 100, 80, 72, -92, -45, 96, 12, 80, -23, 27, 88, 18, -16, 106, -76, -29, 88, 90, 63, -74, 100, -78, 96, -37, 47, 106, 18, 92, -47, -88, -80, -66, -43, -47, 74, -66, 78, -16, 23, -6, -16, 55, 78, 16, 51, -80, -39, -55, 63, -127, 92, 86, -96, -94, -45, -55, 0, 70, -12, 100, 39, -35, 4, -47, 59, 86, 37, -23, -96, 92, 76, -82, -63, -59, 8, 78, -39, -107, -4, -2, -21, 20, -4, -21, 47, -23, -55, -96, 23, -31, -82, -68, -23, 92, 33, -39, -66, 2, -66, 0, 35, 78, -35, -29, 70, -104, 96, -27, 64, -68, -10, -74, 57, -106, 102, 74, 29, 92, 106, 21, -47, -21, -12, -29, -12, -53, -45, -31, -104, -25, -59, -80, 8, -47, -21, 29, -33, 90, 27, -94, -14, 10, -25, -94, 100, 2, 41, 16, -90, 0, 25, -33, 31, 90, 4, -43, -70, 41, 0, 55, 10, -37, 57, -86, -18, -37, -43, -98, -111, 82, 16, 39, -25, -41, -59},
+  {2, -30, 0, 83, 52, -65, 6, -30, 6, 83, -20, -50, -44, -101, -91, 77, -67, -58, 26, -24, 26, -93, -73, -44, 83, -20, -2, -58, -30, -14, -18, -50, 77, 103, -58, -73, 30, 16, -52, -103, -50, 93, 48, 101, -42, -60, 93, -4, 8, 26, 8, 101, -24, -79, 10, 42, -65, -40, -32, 81, 75, -30, 30, -75, 34, -36, -18, 77, -62, -85, 38, -36, 42, 10, 52, -4, -81, -18, 26, -54, 75, -69, 91, -24, 91, -8, 99, -44, 111, 14, 103, 34, 50, 36, -127, -62, 105, -20, -75, -95, -101, -77, 14, 62, -8, 16, 0, 62, -4, -38, 8, 91, -99, -26, -101, 62, -67, 2, 28, 34, -38, 101, -60, 95, 10, -73, 107, -64, -71, -16, 64, 38, 93, 56, 26, 71, 16, 109, 58, 24, 18, 4, -77, -83, -38, -71, 52, -54, 42, -89, 6, 65, 71, 69, 79, 69, 12, 28, 2, 81, 87, 8, -71, 73, 77, 0, 83, -36, -8, 24, 6, -91, 101, -54, -54, 77, 73, 52, -95, -22, -44, -71, -20, 20, -2, -4, 93, -65, -10, 62, 24, -62},
+  {-52, -54, -75, 23, -2, -21, 46, -96, -65, -38, -110, 17, -83, 102, 58, -65, -12, 27, -52, -40, -64, -21, -15, 64, -48, 31, -119, -23, -52, -29, 25, 37, -25, 81, -127, -75, -79, 62, -17, -13, 19, 42, -13, 19, -8, 77, -50, 87, -35, 27, 100, 94, 19, 23, 54, 65, -27, -81, -48, -27, -108, 46, 60, 23, 77, -77, 17, -56, 0, 52, 71, 48, 17, 71, -104, -69, -23, -77, -98, -46, 58, -48, 12, -83, -54, 64, 0, 44, 17, 92, 69, -62, 98, 64, 58, -21, 33, -69, 38, -19, -35, 94, 8, -23, 31, 13, 87, -17, 44, -100, 73, -69, 42, 42, 10, 19, 25, -54, 90, 85, -87, 52, -37, -50, -94, 23, 40, -85, -71, -25, 75, -6, 8, -104, -65, -44, -90, -29, 8, 42, -75, 19, -75, 6, 77, 67, -100, -42, 12, 38, 10, -38, 46, 6, 40, 89, -12, -73, -17, -21, 6, -77, 42, 25, 54, -52, 0, -65, -31, -58, 56, -56, -37, -44, 96, 0, 92, 73, -46, 81, 0, -54, 4, -106, 21, 12, 56, 21, 40, 4, -37, 62},
+  {16, 76, -41, 58, 28, 51, -81, -33, 15, 21, 21, 15, -56, -53, -46, -2, 86, 36, -64, -13, 26, 84, -30, -71, 28, 69, 46, 43, 54, -54, 59, 127, -82, -58, 58, -41, 31, -13, -49, 3, -69, -21, 2, 76, -56, -13, -78, -46, -53, -69, 12, 106, -45, -81, 8, 21, 8, 106, -45, -49, -16, -78, -23, 51, -21, 30, -16, -3, 0, 66, -13, 13, 66, 61, -81, 41, 51, 66, -69, 63, 2, 48, 54, 79, 16, -41, 73, -63, -61, 36, 33, -41, 96, 21, 43, 43, 56, -12, -61, -89, 38, -18, -31, 61, 13, -41, -20, -12, -3, -21, 23, 10, 43, 91, 49, 76, -30, -61, -8, 51, -78, -36, -40, 79, 26, 43, -12, 45, -16, -49, 12, -63, 59, -53, -56, 89, -40, 16, 51, -33, -20, 46, -16, 0, 69, -40, -54, 56, -84, 18, -45, -23, -69, 20, 64, -25, 81, -91, -45, 74, -36, 5, -15, 63, 31, -81, 61, 38, -69, 54, -41, -63, 58, -56, -74, 79, 107, 86, 5, 15, 59, 3, 66, 71, 79, 112, 109, 56, -2, 36, -71, 33},
+  {118, 78, 50, -84, -52, -50, -15, -105, 11, 37, 24, 11, -97, 77, 7, 71, 49, 19, 56, -52, -26, 97, 4, 32, 0, 6, -15, -75, -9, -77, 71, -65, -75, -73, 28, 11, -50, -73, 67, 84, 73, -71, 41, 63, -62, -73, -45, 58, -30, 52, 15, 49, -73, -37, 99, 54, 34, 0, -32, 28, 0, -43, 84, 41, 101, -9, -52, 80, -30, -106, -49, -62, 9, 92, 65, 92, -22, 45, -21, 13, 47, 0, -17, -47, 34, 92, -7, 92, 19, -62, -9, -11, -9, 13, 30, 28, 49, -43, -60, 63, 24, -39, 39, -45, 78, -15, 32, 63, 17, 22, 26, -43, -43, 24, -24, 78, 17, 97, 45, -77, 60, 69, -39, 2, 73, -58, -52, -84, 108, 34, 30, -71, 2, -73, -41, 92, -43, 6, 43, -97, 7, 95, -22, 34, 26, 58, -75, 88, 19, -127, 22, 35, -49, -47, -11, -9, -34, -49, -11, 49, -2, -2, 24, 65, 28, -50, 63, 21, -45, 0, -9, -69, -43, -17, -65, -63, 7, -47, -71, -71, -73, 39, -39, 0, -75, 35, -41, 80, -56, 62, -39, -49},
+  {14, -46, -7, 56, -2, -49, -58, 0, -7, -14, 2, 64, 61, -47, -2, 90, 8, -22, -64, 51, -83, -20, 42, -86, -41, 5, 39, -69, 76, 0, -59, 64, 15, 12, -36, 22, 76, -2, 27, 24, -5, 78, -81, 10, -75, -10, 27, 56, -20, -3, -86, -34, 39, 54, -80, 27, 17, -52, -127, -81, 64, -5, 34, -34, 73, 0, 86, -24, -66, 7, -81, 76, 68, -22, -52, -2, 29, 20, 29, 17, 29, 47, 3, -54, 0, 85, -68, 20, 85, -37, -41, 56, 46, -44, 29, -29, 27, -5, 47, -24, 17, 73, -47, 52, -64, -19, 24, -51, 76, -68, 54, -41, 83, -7, -58, -37, 73, -52, 19, 88, 34, -39, -88, -54, 22, 12, -34, 3, 44, -61, -2, 20, -39, 0, 76, 78, -39, 36, 30, -42, 73, -29, -39, -80, -86, 58, 75, 46, 83, -15, -34, 83, 83, 14, 39, 20, -66, -73, 3, -56, 32, 8, 100, 93, -24, -54, 49, -59, 34, -76, -37, 0, 32, -85, 29, -39, -52, -69, 17, -83, -8, -63, 36, -34, 5, -24, 5, -10, -81, -27, 14, -49},
+  {8, -64, 38, -21, -12, -73, -50, -79, 65, -21, 2, 19, 75, 102, 87, -56, -100, 46, 10, 15, 69, 52, 65, 62, -85, -13, 77, -96, 8, 2, 90, -21, 6, 60, 27, -17, 21, -52, 2, -2, -58, -73, 33, 13, 58, -58, -54, 0, -17, 6, -35, -37, -94, 102, -67, 13, 50, -106, -62, 58, 19, -58, -25, 50, -52, -37, -62, 60, 92, -106, -10, 4, 56, 127, -52, 13, 10, 79, 48, -75, 4, 29, -21, -71, -15, -90, 31, 42, 23, -33, -79, 8, -102, 73, -56, -21, -12, 6, 69, -10, 60, 4, -40, -50, 17, 38, 92, -38, -15, 2, 0, 0, -40, 87, 15, -31, -33, -21, -65, 4, -40, -21, 89, 33, 4, -50, 65, -58, -89, 102, 81, -19, 56, -21, 62, -98, -60, -102, 15, 79, -69, 112, 71, -21, -73, 54, 106, 38, 0, 46, 102, -6, -65, 35, 81, 52, -100, 15, 98, -77, 79, 12, 52, 6, 85, -58, 37, 75, -65, 17, -31, -40, -52, 25, -90, -100, -10, 54, 27, 81, -52, 102, 23, 19, 25, -4, -23, -15, -8, -83, -13, 10},
+  {8, -3, 0, 85, 29, -45, -50, 3, 43, 28, 31, -51, -40, -28, 99, -34, -6, 84, 5, 64, 20, -17, -2, 74, -33, 33, 54, 76, -81, 93, 81, -56, -62, -37, -53, 3, 46, 28, -31, 54, 82, -36, -77, 37, -25, 23, -46, 70, -33, -56, 65, 3, 68, 101, -54, -28, -57, -29, 105, -50, 34, -2, 48, 85, 12, 74, -40, 56, -53, -56, -3, -2, -73, -8, -29, -3, 79, -36, 93, -23, -51, 43, -71, 26, 56, -12, 56, -62, 64, 28, 60, 0, -74, -8, -19, -2, -68, -43, 48, 50, -71, -36, -23, 62, -5, 37, -29, -2, 93, -22, -48, 59, -6, -26, 48, -3, -57, 87, -6, 90, 28, 29, 2, 6, -17, -82, -71, -73, -36, -23, 31, 93, -2, 54, -29, -20, -15, 54, -65, 42, 48, -33, -59, 14, -57, 127, 65, -33, -17, 17, 17, -64, -8, 26, -45, -60, -48, -73, -17, -31, 45, 31, -2, 94, -29, 65, 45, 17, 74, -70, -19, 19, 84, 43, -57, 8, 34, -65, 25, 11, 51, -37, 29, 104, 73, -2, -40, -19, 11, 31, -82, 59},
+  {23, 43, 43, -26, -12, 16, 17, -45, -89, -52, -28, 19, 26, -38, 80, 101, 50, 61, -73, 84, 2, -90, 19, -45, -56, 43, 117, 90, -54, 21, 115, -59, 89, -45, -47, 17, 71, -9, 24, -2, -17, -59, -50, 75, 73, 12, 10, -59, 26, -2, -57, 7, 71, -90, 110, 9, -28, 17, -16, -9, -37, -80, -10, -59, -71, 94, -28, -37, 87, 10, -66, 50, 3, 40, 14, -35, -78, 127, 17, 17, 64, 54, 26, -17, 12, -96, -52, -3, -19, 38, 84, 38, -73, 10, 56, -19, 50, 64, -35, 59, -75, 70, -24, 57, 19, -30, -63, -16, 111, -99, 47, 21, 66, 40, 66, -19, 31, -84, -52, 0, -56, -84, 57, -70, -56, 37, 57, 14, 21, -52, -17, -64, 82, 30, 40, 38, -14, -52, -35, 45, -89, 16, 9, 35, -50, 19, 0, -68, -49, -106, -31, 61, -42, 45, 125, -23, 73, 52, -7, 64, 0, 33, -52, -52, 59, -12, 33, 71, 38, 43, 40, -43, 7, -96, 82, 10, 26, -12, 24, 2, 37, 75, 90, -35, -80, -2, 96, 0, -16, -43, 16, 49},
+  {-25, -28, -8, 97, 97, 74, -23, -42, -34, 8, 47, 19, -4, -70, -114, 19, -49, 83, -53, 99, -87, -6, 95, -99, 13, 93, -70, -95, -51, -89, -70, -127, -42, 74, 28, 19, -25, -25, -57, 21, -30, 0, -40, -34, 49, 51, -2, -123, 0, -17, 85, -102, 99, 70, -17, 93, -4, -36, -70, -57, -19, 2, -11, 0, -70, -28, -78, -89, -68, 97, 72, 91, -66, 34, -8, -38, -13, -106, -4, 21, 97, -66, -49, -68, 104, 42, 19, -114, -4, 66, 15, 34, 85, 83, 89, 11, 30, 83, 42, 21, 28, 95, -74, -15, 95, 23, 2, 119, -95, 116, -85, 30, 25, 36, -17, 19, -19, 15, -19, -2, 91, 21, 17, -32, 23, 30, -30, 34, -53, -70, 70, 42, -19, 47, 30, -102, 4, -38, -87, -78, -23, -2, 32, -99, -83, 127, -2, -85, 34, -112, 34, 17, -70, -89, -11, 21, 49, 85, 11, 55, 97, -123, 68, 76, -19, 36, -61, 68, 72, -85, -59, -21, -11, -74, 112, -102, -95, -55, -6, 28, -80, 83, 68, -6, 87, -91, -70, -87, -6, 28, -72, 36},
+  {79, 83, 55, 109, 55, 18, -70, 59, 125, -33, -22, 22, 15, 99, 70, -42, 120, -50, -59, 85, 2, -42, 55, -42, 99, 88, 11, 44, 66, -70, -85, -118, -22, -18, 81, -90, 33, 90, 28, -109, 15, 37, 68, -42, -90, -77, -92, 35, 24, 44, -2, 46, 90, 101, -81, 37, -79, -11, -88, -83, 118, -35, 77, -9, -72, 61, 44, -112, -118, 90, 116, -94, 85, -2, 55, -44, 81, -20, 48, 13, 77, 107, 35, -22, 7, 72, -105, 96, -18, -53, 22, 59, -88, 31, -26, -59, 2, 9, -22, -85, 4, 107, -15, 96, 118, -107, 22, -2, 35, 105, -7, 55, -37, -33, -96, 70, -42, 118, -90, -11, 39, 55, -9, -92, -112, 44, 42, -83, 112, 57, 70, -70, 4, -101, 64, -9, -50, 74, -96, 85, 83, -99, 26, 68, -9, 4, -18, 109, 72, 46, 105, 11, 13, -18, -18, -35, -57, 11, 18, 2, -61, -77, -90, -64, -79, 33, -31, -15, 20, -55, 92, 66, -99, -50, -79, -96, -2, 83, -112, -13, -116, 0, -15, -35, -114, -66, -127, 107, 46, 20, 72, -68},
+  {71, 110, 118, 75, -22, -101, -28, 54, 90, 47, 90, 30, -30, -82, 110, -73, 41, 50, 52, -62, 28, -13, 11, 50, 127, 73, -125, 67, -9, 41, -43, 37, 80, -52, 95, 0, -30, -95, 73, -43, -32, -112, 11, -30, -84, -47, 77, -108, 22, 65, 32, -110, -86, 56, 103, 101, 0, -60, 97, 26, -84, -2, -26, 22, 19, 39, 99, -37, 0, 65, 4, 90, -86, -24, -86, -11, 88, -47, 15, 67, -93, 34, -90, 52, -43, -11, -99, -88, 65, 97, -37, -108, 30, 2, 34, -86, 52, 103, 97, 65, -82, -4, 99, 90, -54, -11, 41, -84, 82, 37, 77, -19, -34, 13, -90, -73, 41, -77, -30, -34, 0, -24, 118, -30, 43, -32, 67, -26, 54, -101, 127, 52, -13, 105, 84, -88, 71, 77, -45, 28, -54, 84, 34, 90, -50, 95, -9, 39, 41, -82, -4, 6, -28, 75, -69, 32, -47, 90, -97, -95, -80, -123, -28, -88, 105, 13, 32, -93, -82, -88, -13, 93, 65, 41, 95, -67, -15, 45, 103, -93, -45, 56, 105, -50, 54, -50, -60, 37, -114, 58, 9, 88},
+  {-41, -13, -34, -52, -58, -18, -39, -12, -42, 84, 76, 18, 69, -20, 55, 52, 8, 58, 33, 38, -63, 5, -10, 42, -16, -4, -17, -18, -41, 62, 22, 68, -63, -22, 90, 0, 13, -24, -22, -50, 12, -31, -3, 42, -54, 55, -1, 59, -5, -4, 33, 45, -35, 67, -12, -17, -33, 26, -55, -7, -33, -12, 0, 10, -26, 13, 43, 58, -4, -37, -10, -46, 7, 43, 109, 54, -65, 20, -37, -65, 50, -5, 56, -4, 1, -50, 64, 14, 13, 10, 33, 26, -84, 56, -63, 41, 7, 39, 122, -76, -4, -29, 24, 29, -25, 34, -71, 4, 46, -63, -43, 37, 81, -63, -5, 29, 42, -42, 68, 67, 79, 22, -67, 22, 14, -17, 56, 7, -4, 0, 5, -13, -55, -52, 55, 5, -45, 0, 12, 35, 51, -48, 47, 26, -24, -5, 45, -29, -56, -39, 13, 127, 51, 37, 37, -50, 4, 8, 48, 4, -1, -48, 25, -39, -46, -21, 0, -50, 33, 8, -39, 8, -34, 5, 50, -50, -16, 21, -35, -39, -22, -17, -20, -45, 50, 34, -43, -38, -26, 14, 71, 17},
+  {14, -82, -97, 16, 21, 4, 55, -52, -68, 30, 5, 18, 25, -88, 54, -14, 50, -97, 30, -47, -61, -50, 73, 73, -5, -70, 97, 16, 100, -36, 98, -59, -79, -54, -39, 45, -29, -4, -59, -32, 0, 16, 100, 0, 36, -73, 75, 0, -5, 39, -20, -21, -2, -102, 86, -50, 54, 5, 0, -72, -4, 7, -25, 64, -32, -14, 41, 16, -68, 25, 2, -38, -79, 21, -64, 84, -52, 82, 34, 73, -50, 0, 75, 2, -13, 61, 52, -75, 41, 45, 84, 9, 55, -39, 45, -72, 77, 2, -89, -57, -7, -39, -29, -47, 80, 70, 80, -48, 32, -107, 98, -41, -72, 127, 75, -34, 4, -27, -43, 95, -48, 75, -18, -89, 34, 48, 93, -79, -63, 25, -29, -2, 102, -13, 32, 27, 0, 32, 34, 68, 32, -55, 39, 43, -73, -80, -30, 11, 91, -4, -34, 57, 48, -113, 14, -57, -88, 59, -50, -38, -75, -21, 39, -54, -30, 5, 57, 47, 47, 23, -88, -91, 18, -79, 29, 45, 59, 45, 11, -9, -64, -79, -55, 66, 102, 21, -57, -2, -16, -54, 68, -57},
+  {-23, 70, 41, 5, -5, 88, -55, -13, 23, -2, 61, 0, -61, -23, -5, 34, -72, 47, -64, -77, -16, -57, -41, -29, -5, 86, 95, 86, 63, 45, 120, -100, 23, 41, 14, 97, -77, 77, -80, 89, -39, 27, -54, -50, 79, 41, -2, 0, -39, -88, 5, -23, 43, 16, -39, -59, -75, 43, 25, -16, -47, 18, -70, 59, -64, -39, -54, -64, 89, 0, -34, 104, 109, -79, 13, -57, 89, 100, -30, 61, -11, 100, 43, -79, -7, 52, -14, -9, -50, 57, 20, 0, -48, -27, 77, 113, -54, 97, 64, 111, 48, -55, 61, -48, -72, 0, -72, 4, 107, -50, 43, 59, -59, -41, 9, -86, -43, -9, 73, -52, 13, -98, 84, 54, 13, 20, -79, -13, -30, 9, -30, -43, 0, 32, 88, 52, 36, -64, 66, 5, -39, -41, 20, 91, -32, -82, -57, 23, -16, -89, -82, 52, -127, -45, 34, -36, 47, -2, 36, 75, 9, 43, 48, 113, 80, -16, -109, 29, 4, -29, -54, 43, -61, -30, -84, 18, 63, -34, 5, -61, -80, -2, 72, -61, 34, 30, -16, 70, 73, -20, 45, -25},
+  {83, 34, -13, -57, -102, -123, -80, 4, 89, 97, -4, -6, -80, -11, 15, 28, -91, -51, -72, 78, -11, 8, 110, 119, -57, 32, 99, 97, -51, 42, 6, -36, 38, -104, 127, 64, 108, 87, -74, 4, 51, -15, 11, 53, 106, -11, -38, -57, 15, -8, -17, -47, -97, 44, -61, 112, 66, -78, -119, 47, -78, -97, 104, 116, 93, 49, 17, 8, -30, 30, 55, -25, 42, 30, -6, -49, 93, -34, 19, 74, -68, 47, -59, 72, -36, -19, 47, 13, -28, 11, -64, 102, -93, 61, -80, -78, -30, 55, 97, 17, -11, 34, 110, -21, 21, -40, -104, -32, 42, -11, 2, -30, 15, -2, -93, -108, 55, 80, -21, -91, -93, 11, -23, 106, -72, 2, -11, -49, 34, 0, 11, 57, -106, -121, -61, 44, -15, 42, -13, -44, -85, 44, 25, -49, -78, -11, 21, 34, -112, -36, 66, 123, 61, -70, -85, 6, 38, 34, 19, -44, 57, -74, -40, 0, 110, 42, -15, 51, -83, 25, -2, 91, -64, 59, 76, -21, 80, -110, 2, 36, 76, -40, 36, 25, 44, -51, 64, 30, -13, -23, 68, 28},
+  {43, 0, -2, -35, 7, 15, 78, 4, -80, -13, -24, 6, -41, 69, -75, -75, 7, 28, -75, 101, 4, 90, 37, -65, -77, -26, 0, -54, -50, 43, 82, -39, -30, -71, 60, 24, -65, -24, -26, -41, -88, -88, -35, -15, 45, 32, -39, -13, -54, -6, 0, 67, 60, 88, 65, 78, 93, -22, -127, -67, 7, -17, 17, 17, -21, 67, -6, -80, -73, 65, 37, -7, 67, 4, 62, -7, 6, 99, -60, 69, -54, -75, -11, 62, 28, -17, 21, -93, 43, 92, -105, -17, 2, -24, 9, -88, -13, -73, 69, 34, 7, 88, -4, 34, 52, -7, 34, -93, -17, 90, 75, 7, 2, -90, 56, -63, 34, -43, 80, 13, 86, -49, 26, 93, 60, 65, 63, 69, -58, -21, 7, -32, 32, -75, -17, 60, 15, -41, -4, 34, -17, -71, 58, 82, 43, -49, -21, 80, -21, 50, 93, 73, 13, -49, -62, -69, 67, -52, 99, -97, 0, 41, 65, -50, 58, 28, 6, 6, 93, -73, 21, 101, 69, 80, -32, 50, -30, -43, -6, -86, 4, -45, 65, 47, 82, -65, 35, 13, 73, 32, 13, 97},
+  {-26, -73, 105, -6, 99, 56, 85, 64, 93, 46, -107, -71, 20, 34, -65, 16, -8, -85, 48, -73, 91, -10, -12, -10, 40, 85, -48, -16, -22, -101, -18, 97, -30, 62, 69, -81, -107, -93, -71, 91, 65, -107, 16, 56, 6, 105, -40, -28, 62, -50, -62, -85, -75, 18, -12, -99, -4, -12, -93, -28, 6, -30, 52, -87, -89, 22, -2, -16, 22, 52, 89, -2, 127, -123, -62, 46, 87, -71, -87, 60, 54, -87, -34, -16, -77, 36, 69, -2, 77, 18, -52, 99, 10, -28, 60, -2, -115, -77, 121, -34, 65, 22, 26, 56, -71, -65, -101, 10, 69, -60, -48, -18, 20, -97, -6, -87, -40, -50, 22, -65, -6, 64, -24, 73, -42, -73, -91, 91, 67, -6, 107, 60, 52, -67, 87, 2, -14, -50, 56, 56, 14, 48, 46, -46, 38, -42, -75, 44, 107, -58, 48, -26, 30, 52, 2, 6, -87, -52, 83, 30, 46, 16, -10, 65, 107, -87, 12, 91, 18, -107, -18, -24, 50, 28, -56, -79, 26, 44, 65, 22, 62, -20, -67, 54, -85, 52, -18, 97, 81, -2, -99, 0},
+  {-70, 8, 19, 64, -108, 40, 104, 15, -102, -112, -93, -23, 49, 19, 64, 4, 34, -51, -38, -19, -23, -13, -78, 36, 44, 32, -11, 85, 87, -40, 11, 42, 6, 8, 78, 34, 57, -2, -15, -59, 13, 23, 72, -95, -89, 0, 42, 49, -42, -85, 99, 72, 19, 19, -80, 55, 25, 51, -19, 28, 95, 102, 78, -72, -17, 6, -66, 8, 83, -64, 51, 85, -23, -125, 102, 23, -23, -25, 74, -4, 55, 30, -30, 0, 0, 123, 13, 23, 0, 85, -19, 57, 64, -87, 23, 59, -34, -57, 76, -34, 97, -74, -74, -83, -83, 78, -17, -70, -51, -42, 57, 91, -23, -70, 55, -104, 68, 112, -66, 93, 99, 28, -8, -8, 0, 40, -40, -78, -106, 47, 36, -49, -8, 44, -97, -25, -6, 6, 97, -87, 76, 78, 74, -4, -66, -102, 49, 15, -2, -89, -23, -89, 76, 44, 0, 72, -93, 51, 49, -42, -72, -49, -64, 55, 51, 87, 6, 64, -89, 17, 97, -104, 4, 28, -44, 30, 127, 17, 28, -104, -4, -34, -119, -42, 108, -61, -30, -102, -38, -85, -72, 89},
+  {56, 30, 99, 82, -41, -35, -13, -78, -94, -51, -54, -86, -71, -68, 16, 26, 30, -41, 68, 0, 18, 8, 18, 53, 15, 104, 56, 76, 61, -35, 78, -56, 13, 23, 26, 64, 63, 58, 61, 68, -87, 26, -56, 71, -40, 35, -13, -30, 18, -114, 35, -91, 28, 51, 82, 92, -16, -49, 73, 15, 28, 51, -53, -13, -46, -36, 16, 71, -16, 64, -20, -36, 102, -86, -53, -45, -68, 3, 81, 10, -13, -33, -82, 41, -56, 81, 21, -26, 61, 7, 69, -74, 59, 61, 36, -89, -40, -76, 23, 18, 33, -36, 82, -28, -59, -71, -38, -12, 25, -25, 76, -28, 41, 33, 15, -16, 81, 109, -59, -23, 30, 13, -13, 12, 8, -26, -58, -73, 3, -61, 63, 49, -33, 61, 2, -76, -31, 89, 78, -56, 51, 7, -36, -35, -45, 61, 54, -35, 59, 31, 33, -66, -84, -31, 58, -46, -30, -41, 56, 13, 81, -5, 79, 127, -56, 16, 58, 36, 94, -71, -15, -81, -3, 38, 13, -76, 63, 21, 10, 8, 28, -78, 16, 25, -61, 28, 54, 31, 40, -40, 68, -36},
+  {65, 40, 23, 85, -98, -104, 79, 2, -37, 42, 56, -10, -54, -4, -56, 29, -96, -65, -44, -96, 96, -81, 37, 44, 58, -31, 27, 15, -15, -60, -85, -104, -87, -2, 27, -102, -73, -81, -94, -81, -52, 125, 104, -89, 102, -29, -65, 46, -85, 102, -75, -56, 25, -85, -65, -69, -2, -104, -4, 19, 12, 50, 77, -37, -65, 12, -127, -23, 92, 52, -31, -58, -73, -89, 19, 38, -62, -58, -85, -8, 27, -8, 27, 33, -37, -6, -17, 10, -65, -110, 83, 6, 38, 81, -4, 79, 90, 98, 40, -52, 23, -58, 60, -21, 44, 117, 100, -2, 4, 42, 75, -56, 50, -13, 56, 40, -17, 31, 75, -38, 71, -21, 4, -79, -37, 62, -19, 73, -100, -73, -4, 96, 60, -37, 98, -90, -81, 56, -42, -67, 73, -4, 23, -21, -50, -104, 44, -69, 89, -48, -13, -15, 71, 0, -38, 27, -100, 54, -38, 29, 62, 73, 67, -8, -81, 65, 25, -56, -33, 40, -6, 8, -56, -106, 96, -19, 115, 96, 87, -114, 65, -60, 75, -31, 29, 67, -19, 73, 96, -54, 90, 73},
+  {-61, 24, -39, 37, 87, -79, -40, -98, -6, -57, 0, 120, -13, 61, -59, -26, 81, 81, -52, 83, 68, -127, -83, -68, -77, -22, 110, -77, 75, -42, -31, 52, 17, 79, -33, 39, 28, 33, -33, 2, -15, 0, 11, -52, 50, -52, -39, 123, -61, 79, 57, 40, -107, -15, -75, -24, 59, -26, 101, -50, 22, -77, 15, 42, 4, -6, 40, 50, -75, -29, -37, 0, 26, 92, 112, -64, -85, 0, -40, -9, -87, 72, -50, 2, -94, 42, -75, -52, 48, -37, 64, -4, -29, -59, 61, 59, 116, 90, -29, 39, 42, 57, -17, -55, 15, -26, -6, 4, 79, -70, 42, 85, -55, -35, -31, 50, 4, 77, -9, -11, -44, -6, 92, 72, 31, 57, 72, 42, -29, 79, 4, 50, 52, 7, 28, -83, -20, 94, -20, 22, -20, 26, -24, 92, -77, 11, 66, 17, -94, -24, 11, 33, -11, -68, 85, -39, 70, 35, 64, 72, -72, -17, 2, 92, -17, 2, -81, 107, -6, -24, 44, 6, 52, -85, 20, 55, 35, 31, 15, -40, 48, -70, -61, 44, -17, -50, 83, 18, -22, 46, -57, 42},
+  {23, 35, 40, 38, -3, 14, -6, 73, 29, 20, 12, 35, 57, 78, 84, -60, -18, 35, 63, -29, 35, 40, -24, -29, -127, 55, -2, -63, -3, 46, -28, 83, 38, 60, 29, 35, 26, 77, -31, 38, -5, -3, 73, 52, 80, -38, 2, -57, -55, 41, 17, -46, -55, 38, 38, -67, 0, 43, 64, 0, 0, 69, 47, -44, 9, 72, -61, 15, -61, 0, 93, 37, 66, 52, -20, -35, -32, 96, 2, 86, -8, -31, -63, -55, 57, -29, -61, 18, 0, 34, -5, -55, 17, -28, -14, -81, -67, 0, -17, 38, 80, 58, -11, 47, 5, -90, 55, -67, -12, 3, -44, -41, 0, -17, 8, -29, 41, -50, 12, 3, -35, -50, 40, -21, -17, -5, 14, 70, -11, -63, 46, 14, 67, -40, 14, -17, -50, 78, -14, 24, 21, 15, 41, -55, 49, 28, 0, 15, -18, -64, -75, -37, -60, -3, -41, -29, -58, -54, 101, 70, 6, -54, -2, 17, -41, 18, -86, -17, -52, 35, 0, 69, 24, 20, 52, 18, 29, -43, 0, -73, -66, -70, 78, -11, -57, -41, -57, -55, 86, 14, 75, 21},
+  {8, 56, -61, 15, -47, 41, 86, 85, -32, -100, 66, 76, 49, -36, 90, 2, 0, 15, -34, 56, 97, -19, -12, -20, 5, -5, -30, -19, 29, -108, 52, 80, -73, -68, 34, 29, -47, -17, 46, -14, 49, -59, -39, 98, 85, 90, 91, 56, -36, -42, 46, -17, 3, -30, 29, -37, -30, 61, 75, 47, -68, -42, 54, 76, 8, -27, 85, 3, 75, 3, -73, -83, -37, -68, -25, -69, -81, 98, 41, -37, 75, -68, 2, 14, 88, 64, 8, -68, -27, 69, -22, -76, -76, 63, 97, 20, -63, -24, -22, 7, 54, 42, 63, -22, 86, -36, -81, 85, 8, 88, -8, -25, -30, 49, -5, 76, 22, 64, -73, -49, 76, -12, -58, -54, -3, -49, -56, -39, -27, -75, 127, 59, 44, -51, -20, 14, 20, -66, -71, -34, -22, 32, 29, 32, 71, 44, -91, 39, 22, -61, -24, -76, 46, -66, 36, 42, -7, -32, 22, -117, -71, -80, 14, 91, 19, -64, 0, 14, -36, -66, -34, -69, -69, 17, -10, 75, -73, -49, -59, 30, -76, 93, -3, -42, 59, -68, -90, -3, 63, 86, 10, 69},
+  {45, -8, 4, -42, 19, -95, 42, 19, 85, 61, 93, 85, -28, -70, 0, 15, 78, -127, 9, 11, -95, 72, 4, 76, 9, 40, 70, 61, 68, -53, 49, 91, 44, 55, -23, -87, 30, 25, -42, 66, -51, -64, -6, 63, -15, -42, 100, 70, -78, -28, 34, 4, -51, 51, 45, 6, 72, -38, 42, 68, -44, -85, 17, -36, -82, 15, -42, -61, 44, 45, -32, 15, -76, -78, -21, 38, 64, 51, -38, -28, 0, 38, 104, 76, 9, 68, -19, -40, 55, 25, 25, 85, -74, -89, -97, -38, 99, -80, -61, -63, 66, 15, -4, 2, 64, 106, -36, -8, 66, -49, 76, 11, -8, 38, -38, 9, -21, -53, 25, -112, 76, -38, -49, 93, 51, 82, -63, 25, -42, 44, -17, 17, 40, -114, 0, 30, -30, 9, 9, -30, -25, -83, 4, -23, -85, 74, 44, 47, -93, 0, 55, 61, 76, 61, -36, -59, -44, 82, 27, -68, 80, 6, 108, 34, 64, -63, 53, -23, -85, -47, 9, 44, 4, -68, -55, -45, 99, -4, 66, 27, -93, -51, -82, -100, -53, 21, 15, 76, 32, 100, 30, -66},
+  {44, -37, -34, -41, -5, -78, -15, -57, -5, 7, -55, 72, -81, 34, -99, -47, 5, -96, 11, 55, -73, -70, 52, 42, 29, -59, -72, -36, -20, 13, 36, -7, 13, -34, 103, -15, -52, 60, 72, -55, -7, 52, -7, 46, 60, 67, -8, -42, 29, -28, -21, -36, 73, -47, -57, -101, 28, -24, -50, 15, 83, -18, 81, -23, -55, -59, -85, -7, -62, 10, 52, 68, 29, -15, -75, -57, -68, -15, -78, 26, -10, -127, 81, 54, -49, -2, -55, 73, 3, 57, 36, -64, -64, -37, -72, -13, -31, 11, -57, -73, -34, 96, 11, 3, 5, 50, 15, -16, -15, 42, -23, -88, 0, -29, 67, 36, -2, 85, 67, -49, 75, -62, -111, 57, 91, -75, 70, 78, -29, -75, 23, 78, 78, 3, -52, -10, 50, -34, -86, 81, 44, -10, -81, 23, 54, -54, 64, -16, -23, -42, 64, 41, -47, -86, -10, 73, -16, -67, 55, -90, -73, -39, -46, -60, -47, -62, -8, -73, -8, -26, 68, -64, 59, 73, -75, -83, 2, 67, -55, -42, 18, 2, -13, -72, 18, -80, 18, 90, 31, 80, 64, -62},
+  {62, 97, -88, -19, 50, 30, 0, 11, 43, 19, -54, 101, -62, -34, 84, -71, 7, -86, -97, 30, -52, 19, -15, 45, 32, 4, -43, 37, 106, 92, 67, -69, 69, 34, -22, 34, 32, 39, -4, -26, -86, -73, -9, -77, 32, -56, -21, 78, 73, 2, 47, 84, -28, 13, 24, -35, -9, -75, 0, -78, 54, 9, -99, -86, -50, 9, -62, -67, -11, 30, -90, 0, -62, -82, 60, -95, 82, 52, 75, 67, 52, -6, -17, 34, 93, -28, 56, -28, -50, -32, -15, -86, 50, -92, 60, -35, 114, -6, -24, 71, 60, 41, -65, -65, 101, -7, -7, -80, -78, 21, 95, 50, -19, -30, 73, -45, -50, 13, 35, 28, 73, -88, 108, 43, 28, 22, -80, 93, -58, 101, -86, 2, -49, -80, 69, -56, -77, -63, 90, -69, 50, 92, 65, 47, 73, -9, -75, 84, 4, 62, -63, -32, -127, 60, 121, -21, -4, 24, -21, 4, 71, 17, -21, 43, 103, -88, -90, -58, -88, 63, -24, -22, 56, 69, 11, 62, 28, 21, -11, 24, 54, -95, 71, -6, -19, 13, 37, 75, -86, 32, 80, 22},
+  {25, 38, -76, -64, -91, -89, 72, 70, 13, 21, 30, 76, -74, 9, 70, 85, 70, -57, -2, 25, -27, 64, 87, 68, 72, 11, -13, -15, -40, -53, 40, 93, 74, -19, 25, 15, 21, 85, 59, 80, -19, 57, -40, -95, 89, -44, 36, -100, -23, 110, 27, 0, 63, -4, -44, 0, -23, 44, -78, -49, 53, 4, -78, -91, -19, 8, 34, -38, 61, -93, -40, -34, 11, 42, 89, -47, 95, -76, 27, -63, 11, 127, 93, -66, -55, -70, 11, 76, -70, 25, -40, 21, 78, -63, -9, -8, 44, -15, -23, -70, 83, 68, 19, -59, -30, 57, -80, 27, 61, -59, -27, 19, 9, -38, 27, -19, -40, 70, 19, 106, -25, 42, 76, 45, 0, -66, 44, -25, 55, 25, -17, 47, 74, -8, 17, 82, 0, 32, -55, 89, -11, 15, -42, -85, -91, 95, -83, 66, -76, -106, -15, -45, -28, 59, -47, -19, 74, 85, -125, -76, 23, -45, 32, 93, 32, -21, -45, 27, -49, 59, 40, 21, 82, 55, -38, -87, 30, 85, 63, 36, -28, 61, -9, -2, -13, -19, 106, 68, 59, -80, -19, 6},
+  {-64, -71, -56, 48, 65, 60, 29, 52, 4, -62, -10, 81, -50, 121, 64, 17, -89, 46, 94, 19, 13, -10, -38, 98, 98, -81, -71, 6, -50, 106, 25, 44, -69, 89, -40, 85, 67, -92, -2, 21, 2, -96, 50, 89, 117, 92, -81, 31, 89, 0, -23, -17, 31, -35, 127, 10, 90, 23, -89, -64, 4, 27, 19, -73, 0, 0, -38, -79, 48, -23, 83, -17, -48, 102, -83, 67, -75, 96, 87, 6, -73, 71, 10, -46, 12, 44, 25, -67, 31, 40, 40, 35, -71, 25, 13, -71, 37, -67, -64, 64, 64, -42, -60, 4, -104, -83, -62, -2, 8, 67, -92, 60, 0, 0, -12, 4, 15, -92, 17, -67, 98, -44, -115, -62, -89, 44, -4, 87, -54, 87, -90, -92, -79, -110, 44, 33, -15, 44, -106, -23, 19, -58, -46, -52, -62, 71, -40, 6, -19, 48, -46, 42, 40, 46, -71, -83, 4, 38, -83, -98, 31, -27, -31, -48, -25, 85, -42, -48, -21, -81, 19, 29, -75, -23, -102, -10, 90, -79, 27, 2, -90, -35, 0, -15, 8, -17, -114, 23, -42, 29, -44, 81},
+  {-46, -4, -101, -35, -2, 67, 74, -51, -5, -69, -30, 46, -76, -56, 46, -56, -23, -115, -74, 85, -28, -72, 53, 76, -49, 74, 42, 16, -41, -51, 69, -30, -76, -30, 39, -11, 7, -12, 0, -83, -18, 28, 2, -64, -37, -32, -67, -65, 51, 44, -4, 108, 67, 5, 19, -51, 53, 7, -9, -79, -49, -49, -58, -18, 44, -35, 90, -46, 62, 71, 78, -26, -41, -35, 37, 72, -30, -74, 64, -32, -5, -4, -26, 106, 9, 30, 41, -37, -74, -44, -86, -67, -2, 0, 92, -39, -78, 53, -67, 76, -41, 72, 65, 116, 92, 42, 21, 83, -65, 5, 48, 37, -62, 92, -49, 16, -41, -67, 11, 65, -16, 127, -125, -11, 111, 25, 42, -62, 74, 37, 35, 67, -72, 42, 44, -51, -60, -74, -92, -101, 71, -7, 14, 34, 83, 9, -55, 25, 42, -69, 79, -51, 72, 62, -92, 5, -18, -30, -16, 86, -90, -48, -32, 39, -25, 11, -37, -85, 44, 67, 53, 76, -12, 51, 23, -44, 7, -5, -44, 118, 101, -37, 48, -99, 30, 101, -42, 93, -16, -28, 60, -48},
+  {37, -65, -15, -27, -15, -21, 56, -62, 25, -92, 29, -64, 94, 19, 114, -2, 119, -98, 0, -42, 46, -56, 10, 33, -2, 71, -73, -17, 62, -23, -23, -2, 17, -48, 17, -23, -27, 6, -90, -29, 58, 37, -77, -29, -12, 127, -62, -89, -89, -17, 81, 106, 96, -40, -4, 33, -96, -33, 4, -73, 85, -60, -85, 50, -50, 12, -65, 58, 50, -21, -38, 77, 75, 38, 15, -48, 87, -71, -112, -60, 42, 29, 6, 64, 100, -83, 77, 75, -13, -90, -10, 52, 71, -89, 21, -106, -2, -69, 89, -2, 46, -19, 112, -19, -58, -10, -37, -119, 44, -75, 64, -54, 27, 123, -33, -96, -19, 54, -69, 23, 50, -33, -67, -75, 89, 0, 17, 25, -21, 67, -104, -98, -13, -58, 58, 10, -38, -38, 79, 42, -58, -71, 94, -94, 125, 42, 110, -21, -8, -110, -73, 4, -15, 52, -15, 21, 100, -65, -35, -35, 62, -65, -19, -112, 115, 83, -21, -89, 13, -4, -29, -10, 64, -37, 38, 85, 21, -23, 19, -58, 85, -81, -15, 25, 35, -29, -119, -67, 60, 67, 90, 48},
+  {1, 15, -64, -27, 10, -16, 24, 18, 65, -41, 0, 15, -1, -21, 46, 66, 32, 22, -68, -18, 46, -6, 4, -56, -34, -21, 62, 18, 96, 83, -62, 31, 27, -10, 56, 0, 9, -58, -28, 21, -27, 7, -65, 0, -56, 83, -62, -41, 44, -19, -71, 127, -62, 25, -19, 75, 0, 66, 40, -34, 28, 65, 35, -3, 46, 66, 58, -19, 65, 12, -68, -12, -64, 86, -40, 18, -69, -22, -9, -35, 28, 90, 59, -28, 49, -27, -35, -22, -4, 44, -30, -59, -43, -9, 69, -16, -1, -1, 21, -38, -46, 0, 64, 58, 27, 10, -35, 37, 72, -12, 31, -58, -35, 22, 24, -13, -19, -32, 13, -28, -49, 77, -3, -15, -16, -34, -27, -58, 31, 69, 24, -44, -64, -21, 27, -53, 68, 40, 7, 52, 64, -9, 31, -19, -44, -34, 68, 12, 68, -103, 53, 32, -9, 81, -32, 58, 74, 38, 1, 0, 32, 6, -62, -9, 24, 0, -75, -46, -22, -25, 71, -13, 32, -30, -74, 31, 22, 65, -6, 118, -38, 0, 28, 56, -12, -7, 32, -62, -68, -35, 13, 75},
+  {0, -97, -42, 51, 67, -85, -71, -9, -2, 69, 78, 42, -76, 56, -39, 28, 37, -49, -64, 46, -56, -12, 65, 23, 86, 62, 127, 25, -55, 44, -76, -69, -71, 67, 4, 19, -7, -28, -78, -19, 71, 74, 83, -5, -35, -49, 35, -92, -16, -56, 11, -26, 18, 2, -74, 83, -74, 41, -28, 21, 23, -4, -79, -14, 101, -26, -4, 72, -62, 0, 5, 69, 9, 39, 46, 26, -85, 53, -74, 58, 79, 12, 42, 60, 53, -44, -11, 37, -48, 14, -49, 79, 65, -49, 69, 23, -83, -41, 28, 37, 7, -11, 72, -39, -11, 19, -92, 65, -9, 11, 19, 111, -37, 95, 9, -14, -5, 55, -25, 88, 0, 53, 14, -12, -53, -76, 9, -2, -39, 65, -65, 30, 28, -74, -5, -42, -42, -25, 99, 67, -79, -11, -86, -4, -2, 7, -83, -12, 32, -35, -51, 7, -60, 71, 72, -60, -7, -35, 76, 39, -101, 19, 64, -21, 49, 35, -14, -76, 85, -11, -49, -18, 23, -44, 83, 78, 11, 37, 67, 5, 41, -53, 28, 37, -42, -83, -102, -26, 18, 19, 34, 34},
+  {-45, -64, -127, 104, 2, -80, -68, 47, 38, 93, 2, -89, 57, 64, 87, 0, -55, 49, -47, -55, -72, 45, 99, 78, 87, -63, 36, 8, 0, -61, 72, -78, -76, 21, -32, -80, 99, -19, 13, -63, 91, -25, 83, 55, -13, -28, 8, -91, -59, 57, -55, 6, -25, 0, 21, -89, -95, -36, -51, 87, 89, 59, 100, -4, 116, -25, 66, -80, -55, -74, -28, -51, -85, 0, -55, -40, -9, -100, -64, -102, 6, 9, -4, 59, 23, 63, 51, 99, 32, -104, 66, 97, 49, -38, -19, 15, 38, 47, 9, 0, 76, -45, -70, 53, 34, 0, 15, 91, -23, 93, 91, -93, -91, 74, -21, 8, 36, -66, 61, -36, 72, -45, -19, -93, 66, -61, 78, -89, 19, -64, 63, 63, 87, -110, -70, 64, 76, -34, -72, -64, -4, -28, -25, 45, 55, 85, -93, -15, 59, -28, -45, 61, 104, -70, -38, 66, -112, 27, 0, -30, -6, -51, 106, -32, 30, 55, 80, -55, 36, -34, -47, -93, -38, 6, 32, -102, -102, 45, -57, -34, 89, 2, -23, 57, 40, 47, -15, -25, 61, 28, 76, 40},
+  {-38, 7, -38, -5, -89, 82, 5, 64, 33, -69, 38, -27, 26, -29, 24, 24, 79, -65, 81, 81, -38, 5, -33, -48, -100, -17, -17, -77, 86, 15, -17, -53, -38, -93, -64, -89, -7, 55, 33, 88, -57, -3, 67, 26, 60, 94, -34, -70, -60, -53, -41, 113, 57, 2, -62, -64, 33, 89, -51, 36, 81, 36, 27, -17, 17, 81, 82, 34, -7, 31, 3, -60, -58, -19, 64, -39, 67, -26, 24, 5, 33, 51, -48, -31, 77, 77, -38, 43, -12, -26, -94, 46, 24, 3, -53, 86, 55, 72, -127, 70, -53, 15, -57, 10, -21, -81, 53, 41, 41, -64, 38, 31, -19, 98, -58, -69, -50, 27, -34, 33, -79, -50, 67, -12, -21, -72, 48, 36, -43, -29, 55, -112, 62, -57, 53, -51, 74, -57, 7, 70, -84, 45, -21, 10, -10, 46, 5, -36, 64, 19, -19, -26, 39, -77, -72, 15, 103, 82, 38, -41, 53, 76, 51, 58, -38, 69, 0, 55, -72, 31, -39, 26, -15, 22, 93, -34, 2, -36, -72, 96, 58, -7, 14, -74, -14, 69, 33, -64, -2, -31, -82, -36},
+  {-63, 6, -34, -85, 72, 75, -33, 0, 0, 58, -58, -12, -67, -61, 45, -16, 16, 63, 1, 63, 0, -102, 1, 66, -72, 82, 39, -43, 19, -30, 37, 16, -75, -36, 0, -24, -55, 60, -61, 0, 9, 36, -54, -12, 66, -12, -63, -33, 31, 102, -31, 33, -12, 27, 24, -4, 39, 51, -127, 40, 60, 9, -40, 43, -15, -37, -49, -37, 43, 25, 40, -72, -6, 28, -61, -60, -73, 61, 52, 75, 24, -66, 28, 36, 75, 31, -22, 48, 58, -1, -40, 21, -51, 82, -55, -64, -60, -54, -37, 76, -72, 73, -78, 36, -45, -31, 30, -25, -76, 42, -24, 31, -24, 76, -75, 91, 39, -1, 87, -1, 52, 60, -88, 78, -60, -67, 39, -36, 90, -64, 61, -82, 0, -36, -48, -15, 75, 61, 0, -70, 55, 9, 21, -31, 9, 37, -12, -69, 31, -82, -55, 57, 4, -9, -66, 48, -51, -15, 91, -55, -54, -40, -37, 6, -9, -69, -7, -27, 34, -12, 64, -25, -13, 31, 73, -82, -30, -27, 49, 78, 49, -48, -45, -30, 36, -12, 6, -63, 10, 13, 72, 54},
+  {73, -12, -46, -2, 51, 3, -2, -74, -54, -26, -34, -39, -51, 20, 31, 34, -15, 93, 50, 56, 5, 43, -31, -59, -8, 11, 74, -48, -54, 9, -77, -31, -65, 91, -65, -43, 64, -56, 48, 93, 45, -26, 22, 57, -20, 22, 39, 25, 0, 65, 6, 23, -51, 5, 33, 56, -50, 0, -39, 8, -25, 48, -76, 64, -50, -37, 76, -17, -79, -19, -77, 19, -46, -40, -9, 0, 51, -53, -3, -54, 104, -3, 37, -3, 0, -71, -31, -77, 42, -20, 51, 65, 76, 20, -12, 48, 73, -67, -82, -54, -5, 20, -40, 51, -17, 57, 6, 45, 76, 51, 57, -17, -110, 34, 67, 2, -23, -98, 29, 23, -42, 102, -15, 39, 54, 81, -77, -57, 60, -39, -84, 60, -65, -26, 74, -67, 62, -42, 62, 39, -37, -39, 64, 79, 74, -76, -50, -71, 0, 56, 48, 17, -19, -39, 91, 85, 40, 0, -79, 70, 68, 91, 50, 15, -59, -68, -45, -82, -31, 20, 17, -43, -60, 5, 70, -22, 56, -28, -28, 127, 0, 19, 50, 54, -33, 82, -9, 34, -71, -29, -33, -34},
+  {-45, 17, 0, 9, 29, 27, -94, 45, -12, 98, 70, 89, -77, -77, -67, 57, -57, 67, 29, -84, -48, 46, 76, 127, 31, 5, -34, 82, 31, -9, 43, -9, -17, 15, -5, -7, -7, -39, 64, -9, 72, -74, 39, -79, -69, -15, 19, 50, 57, 22, 67, 31, -67, 79, 79, -69, -65, 69, -10, -7, 89, 38, 36, 48, -57, 0, -43, -9, -36, -50, 58, 55, -60, -39, -60, 57, 2, -51, 26, -53, -76, -36, 84, 77, -19, -70, 17, -41, 21, 50, -45, -33, 53, 65, 34, -81, -67, -12, 94, -21, 69, 5, 38, 41, -34, 50, -48, 81, 57, 79, 0, 53, -51, -5, -5, 10, 76, 39, 50, 86, -43, 17, -15, 0, -74, 79, -53, -29, 94, 19, 15, -77, 0, 38, -36, -58, 19, 9, 9, -46, 17, -29, -7, 5, -38, -76, -58, -65, -5, 84, -7, -24, 106, -65, -41, 74, -36, 88, -9, -96, -43, -76, 76, -89, 74, 9, -43, -33, 65, 27, -31, -34, -65, -88, -81, -86, 48, 19, -36, -7, 69, 106, 53, -82, 2, -76, -64, 39, 21, 88, -22, -74},
+  {18, -10, 30, 2, -97, -2, 93, 58, -83, 4, 48, 64, -79, -93, 73, 8, 87, -2, -71, -36, 77, -4, -38, 50, 67, -30, -107, 56, -32, 24, -22, -12, 16, -60, 97, -16, -79, 111, -83, -30, -75, 4, 52, 54, 56, -12, -34, 34, 0, -83, 34, -30, 10, 85, 65, 2, -56, 71, 71, 14, 71, -93, -73, 54, -58, -54, -36, 71, 22, -58, 46, 32, 44, 14, -50, -64, 83, -32, 54, -79, -60, 10, -83, 24, 64, 12, -8, -52, 64, 60, -119, -56, -83, 93, 44, -123, -127, 50, 75, -52, -16, -34, 0, 107, 0, -89, 48, 40, 62, -75, -16, 16, 4, 0, 64, -67, -62, -44, 69, -48, 71, 0, 10, 58, -40, 83, -85, 36, -28, -97, -77, 101, -34, 10, 71, 48, 101, 79, -111, -81, 20, 73, 50, 103, 67, -69, 83, -44, 46, 93, -22, -12, -46, 85, 14, -87, -52, 62, 62, -81, 32, 2, 26, 58, -93, 16, 12, -73, 2, 28, 79, 75, -99, 26, -119, -105, -91, -105, 24, 30, -18, 54, -42, -58, 67, 34, 48, 97, 83, 18, 14, 111},
+  {-35, 28, -32, -69, 62, 13, -17, 53, -15, -2, 50, 50, -27, 5, 69, -92, 85, -12, 20, 74, 79, -77, -38, -57, -42, 35, -17, 95, -15, 63, -102, 85, 13, 7, -2, 48, -8, -47, 85, 82, -45, 110, -23, -53, 52, 32, 58, -3, -18, 50, 8, -25, -84, 38, 57, -22, 3, 42, 58, -77, -82, -30, -37, 63, 63, -69, -25, 28, 10, 12, -62, -74, 18, -20, -25, -33, -62, 32, 70, -23, -7, 57, -80, 85, -57, -28, -50, -10, 53, 58, 107, 60, 28, 75, 15, 127, 15, 70, 85, -33, 12, -3, 45, -8, 30, 58, 13, 72, 2, 77, 8, 15, 30, 104, -84, 72, -37, -58, 5, -27, -85, 25, 25, 7, -72, -45, 35, 17, -30, -62, -3, -50, 94, 10, 5, 50, 30, -12, 72, -72, -15, 22, 47, -17, 45, 35, -53, 63, -85, -77, -35, -5, 97, 12, 12, -2, 5, 3, 12, -3, 102, 42, 67, 57, 15, -28, 53, -58, 8, 12, 60, 75, -69, 53, 57, 89, -40, -12, 37, 23, 74, 18, -7, 0, 43, 18, 45, -10, -40, -55, 53, 0},
+  {-36, 76, -87, 22, -60, 45, 102, 102, -27, -40, 62, 76, 18, 82, -102, -67, -76, 2, 96, 11, -40, -16, -45, 74, 89, -82, 4, 0, 91, 9, -31, 109, -62, 127, -100, -91, 29, 58, -56, -25, -7, 20, 20, 67, -2, 7, -51, 102, -16, -67, -27, -56, -65, 45, -53, -36, 91, 20, -87, 62, -18, -18, -87, -89, -78, -45, -13, -114, 80, -49, 29, -89, 9, -49, 7, -38, 74, 20, -67, 53, -33, 40, -85, -31, -111, -76, -109, 0, 74, -111, 33, -105, 0, 20, -27, 9, 16, -42, -40, 27, 105, -80, -7, -38, -56, 9, 2, 111, 45, -49, -62, -71, -107, -114, -22, -33, 33, -111, -47, -47, -80, -87, 16, -25, 71, -4, 91, -65, -85, -2, 80, 53, -27, -109, -67, 7, -13, 0, 42, 47, -58, -85, 0, -71, 47, 4, -38, 4, -89, -22, -127, -82, 80, 89, 33, -18, 76, -53, -71, 22, 74, -87, -60, -4, 40, -105, -102, -116, 13, -33, -67, 25, 69, -45, -127, 33, -13, 96, 27, -118, -31, 69, -29, 98, 4, -125, 7, 69, -58, -11, 56, 98},
+  {54, 23, -23, 50, 10, -71, -100, 46, -60, 50, -31, 33, 69, 108, 81, -27, -54, 112, 19, -60, 60, -62, -48, -52, -44, -87, -8, -96, -104, 33, 56, 94, 69, 0, -96, 52, -73, 69, 4, 121, 102, -100, 79, 2, 54, 2, 21, 92, -96, -112, 87, -17, 104, 40, 21, -67, 56, 73, 90, 19, 8, -83, 21, 98, -50, 50, 31, 37, -46, -12, 62, -81, -29, -83, -69, 42, -54, -83, -42, 65, -71, 108, -81, 0, -48, -2, 90, -4, -31, 110, -40, -29, -100, 60, 54, 23, 87, 19, -121, 117, 96, 17, -27, 75, -17, 46, 54, 44, 85, 50, -25, 37, -92, -85, 25, -6, 31, 27, 8, -52, -46, 8, 56, -108, 52, -60, -83, 33, 90, 108, 90, 94, 37, 79, 10, 46, -35, -35, -37, 10, -29, 75, -29, 56, 6, -29, 69, -31, 104, -112, 44, -127, 42, -85, 48, 4, 40, -87, 37, 50, 96, -25, -65, 42, -60, 83, -8, -58, 106, -100, -12, 92, -73, 23, -56, -73, -23, -4, -62, 100, -4, 52, 0, -65, -27, 98, 83, 110, -67, -100, -33, 2},
+  {54, -20, 116, -23, 27, 100, 50, 5, -109, -73, -9, -54, -88, -109, 41, 68, 91, 57, -29, -82, -23, 91, 79, 16, -9, -32, 66, 93, -27, -73, 48, 9, 100, -82, 116, -14, 20, -61, -20, -75, -111, 79, 111, 36, 36, 59, 43, 16, -100, 79, -104, -16, -32, -111, 109, 57, 29, 95, -113, -52, -79, -91, 18, -70, -79, -23, -61, -50, -61, 11, 73, -77, -75, -107, 95, -109, 86, -104, -68, -43, 43, -88, -73, -100, -91, -36, -52, -111, 100, -82, -9, -11, 79, -82, -100, 43, -77, -109, 127, -68, -7, 39, -5, 0, -29, -88, -11, -120, 102, -109, 75, 75, 16, -75, 88, -91, -111, -73, 88, 14, -32, 5, 39, 88, -52, -14, -5, 0, 107, 54, 23, -18, 77, 73, 98, 7, -82, 111, 88, -32, 111, -127, -9, 54, 82, 59, -66, -52, 34, -36, -52, -54, -91, 14, -7, 84, 0, 91, -9, -68, -18, 41, -75, -86, 82, 54, -52, 73, -79, 18, -36, 9, 23, 66, 66, 95, -43, -120, 54, 14, -39, -5, -75, -93, 61, -25, -23, 32, 32, 32, -14, -122},
+  {-104, -77, -58, -112, -79, 69, 115, 48, -33, -56, 77, -40, -100, 83, -96, 19, 77, -52, 29, 0, 10, -12, -40, -81, -42, 79, -81, -4, -65, -40, 19, 108, 17, 71, -58, -121, -48, 48, 33, -50, 4, 60, -25, 108, 92, 73, 81, -44, 19, -40, -87, 4, -50, -110, 67, -110, 56, 52, -25, -31, -50, 0, -60, -35, 19, -98, 54, -69, -67, 98, 75, 15, -42, -98, -87, -117, 54, -60, -15, -37, 117, -25, 110, -56, 67, -52, -35, -92, -33, 6, -15, 44, 15, 44, -62, -19, 50, 40, 8, 23, 65, 40, 67, 67, 21, -29, 71, -33, -52, -33, 44, -77, 83, 58, -40, 17, -10, -98, -44, 44, -15, 2, -87, 6, -2, -54, -48, 4, 25, 54, 6, -48, -104, -56, -65, 4, 112, -4, -19, 62, 17, 58, 52, 19, 127, 21, 58, 85, 60, -100, -102, -17, -62, 79, 52, 104, -42, -37, -90, -42, -6, -10, -71, -104, 110, -54, -96, -75, -56, 48, -71, 108, 56, 121, 90, 115, -12, 73, 83, 73, 0, -110, 15, 69, 37, 102, -10, 123, -50, 15, 56, 19},
+  {51, 86, -22, 51, 49, 8, 16, 84, 35, 108, -6, 71, 22, -89, 46, 25, 71, 56, 81, -59, 5, -60, -79, 43, -13, -19, 67, 40, 106, -48, -32, 95, 59, -10, 75, -48, -60, -48, -14, -37, 6, 87, -73, 65, -46, 24, 22, 38, 16, -13, 25, 127, -14, -24, -75, 22, 54, 90, 32, -65, 64, -57, -27, 30, 5, 3, 21, -59, -48, -19, -35, 56, 14, 6, 60, 79, -51, -68, 44, -56, 60, 32, -29, 92, -70, 57, -2, 84, 108, 79, 16, 51, 70, -30, 16, -17, -30, 59, 48, 30, -67, -49, 37, 48, -35, 19, 17, -3, 0, -59, 71, 71, 59, 5, 41, -10, 51, -5, -60, 38, -48, 67, -51, 52, 70, -35, 41, 32, 97, -21, -5, -76, 17, -64, -65, 22, -21, 24, 103, 33, -25, 24, -21, -46, 71, 37, 16, -60, -10, -62, -27, 17, 97, -17, 11, 64, -24, 22, -119, -49, 51, 38, -2, 52, 57, 68, 3, 17, -49, 121, -60, 76, -76, -24, -19, -14, -76, 59, -68, 94, -40, 43, -70, -52, 33, 8, 57, -10, -29, 17, -21, -41},
+  {-92, 54, -123, 43, 15, -49, -9, 22, 4, -56, -49, 0, 0, -67, 6, -71, -73, 62, -17, 62, -24, 78, -13, 21, -67, -65, 77, -22, 65, 82, -54, 52, -49, -19, -47, 43, 99, -50, -24, -80, 65, -17, 50, 15, -37, -73, 17, 86, 32, -35, 75, -56, -63, -7, -9, 19, 97, 19, 35, 60, -80, 95, 97, 32, -77, 58, -108, -9, 93, 92, -80, 15, -49, -69, 30, -37, -47, -78, -19, 34, -67, 30, 93, -22, -82, 17, 37, 69, -97, -84, -2, 67, -30, 71, 9, 2, 92, 54, 7, 7, -4, -7, -37, 62, 17, -34, 95, -80, 88, 32, -21, 60, 39, 50, -71, 22, 39, 28, 32, -78, -26, 22, 90, 43, -13, 50, -41, -30, -103, -47, 0, -97, 26, 93, 7, 39, -86, -71, 0, 101, -50, -105, 41, 7, -82, -47, 15, 2, 65, -105, 7, -86, -52, 4, -17, 7, 88, -2, -17, 84, -69, -11, -101, -17, 6, -69, -58, -86, -77, -80, -11, 35, -86, 58, 34, 60, -77, -62, 52, -63, 95, 26, -105, -80, 0, -60, -127, 99, -54, -30, 82, -52},
+  {-66, 82, 29, 100, 14, 0, 0, 0, 61, -43, -9, -14, -63, 88, 54, -48, -64, -95, 0, 50, 64, 79, 14, 77, 18, -18, 120, -54, -29, -13, -41, 64, 38, 86, 70, 50, 59, 39, -21, 109, 0, 64, 84, -14, -18, 86, -48, 64, -48, -64, -32, -61, -43, -109, 38, -55, -9, -82, 39, 63, 0, -18, -7, 66, -4, 70, 32, -77, 100, -54, -32, -68, -52, -63, 5, 36, 80, 47, 43, 5, -7, 80, 82, -100, -30, -73, 66, -43, -127, -48, 118, -97, 52, -63, 61, 7, -75, 43, -27, 104, -18, -63, 16, -64, 36, 95, 77, -21, 7, 21, -98, -34, 0, 77, 9, 64, -91, 27, 45, -13, -79, -82, 97, -64, -7, -5, 52, 84, -91, -84, -104, 50, 55, -29, -95, 59, -48, 0, 68, -14, 4, -39, -50, 73, -43, -20, -23, 9, -39, -30, -72, 61, -2, 20, 100, -82, 57, 63, 55, -18, 59, 47, -2, 39, 29, 41, 18, -11, 50, -93, 2, 25, 66, 16, -80, 48, 89, 0, 82, 75, -63, -34, -77, -39, 23, -36, -57, -23, -41, -59, 45, 13},
+  {21, -106, 40, -70, 55, -15, 42, 28, 83, -51, 19, -55, -66, 47, 42, -6, -6, 70, 38, -53, 74, 34, 44, 30, 59, 42, -89, 17, -61, 4, 97, -40, -11, -44, 55, 2, -13, 4, 70, -8, 13, 106, 38, 78, -68, -59, 28, 49, -8, -66, 106, -78, 64, 4, -97, -21, -68, -53, -97, 0, -97, 76, -91, -80, 110, 13, 55, -8, -19, -42, -53, 59, -85, 70, -85, 102, 99, -70, -72, 108, -28, -127, 89, -83, -97, 30, -47, -70, 25, 11, 17, 59, 30, 40, 21, -11, -78, 80, 4, -40, 87, 99, 11, -91, 2, -53, -106, 32, 4, -2, 0, -32, 72, -68, -25, 66, -97, -28, 6, 91, -85, 80, -99, 106, -104, -44, 23, -42, -30, -57, 61, 53, 28, -57, 11, 51, -61, -106, 6, 66, 11, -104, -66, -59, -25, 51, -66, -102, 21, -106, -110, 15, -59, 4, -68, 83, -55, 19, -72, 85, -80, 21, -64, -38, 80, 49, 30, -119, -32, -108, 95, -11, -93, -83, -66, -93, 91, 66, -78, -8, -106, 25, -89, 28, -78, 59, -85, 40, 47, 36, -97, -57},
+  {59, 90, 55, 70, -31, 24, 11, 37, -55, 22, 13, -55, -72, 70, 22, -57, 17, 88, -33, -57, -17, -4, 94, 83, 22, -37, 44, 87, -48, -13, 42, 33, -4, 44, -40, -28, -74, 57, 75, 59, 77, -9, -98, -17, 13, 9, -61, 92, -17, -6, -85, 46, -50, 40, -39, -9, -66, -31, -9, 20, -74, -20, 11, -28, -7, 83, -18, 85, 31, 40, 37, -87, 42, -72, 116, -26, -48, -2, 28, 48, -55, -39, 53, 11, 24, 24, -50, -31, -42, 31, 109, -85, -52, 59, 74, 75, 20, 28, -85, -13, 53, 63, 0, -7, -53, 29, 57, -59, 15, -28, 70, 0, -4, 9, -66, 52, -101, 39, -59, -18, 81, 70, 72, -20, -46, 9, 0, -85, 101, -57, -24, 18, -68, 88, -13, -75, -7, 24, 18, -63, 0, -61, 2, 70, 24, 9, -33, 61, 18, 18, 70, 77, 31, 9, 6, 39, 87, -24, 9, 66, -48, 46, -17, 55, -20, -29, -44, -107, 74, -33, -9, 44, -81, -44, 83, 33, 103, 7, 15, 63, -24, -46, -48, -24, 61, 127, 48, 83, -4, -88, -28, 74},
+  {59, -61, 18, -64, -41, 68, 37, 61, 76, -37, -23, -78, -27, 43, -25, 111, 111, -57, -86, -14, 25, 92, -41, 20, 74, 92, -123, -80, -47, 80, 43, 0, -41, -78, 14, -104, -10, 0, -35, 47, -51, -29, 88, 31, -70, 0, 39, -109, 68, -64, 12, 76, 90, 20, 43, -119, -61, -51, 31, -104, 18, -14, -68, 78, -80, 47, -10, -6, 72, -86, 4, 43, 92, -119, 66, 8, -35, 27, 29, 98, -6, 76, -27, 10, -59, 37, -98, -53, -6, -20, -78, -59, -23, 20, 127, 27, -61, -2, 107, 51, -16, 18, 113, 66, -25, -80, 41, 74, 20, 31, 80, -72, -55, -35, -100, -12, -20, -41, 41, 4, -35, 0, 64, -102, 76, -14, -109, 78, 57, -76, 84, -98, -47, 16, -64, 68, -16, -37, 0, 41, 84, -29, -96, 45, -94, 10, 74, 78, 92, 109, 102, 4, 31, -90, -109, 55, -35, -43, 2, 59, 70, -8, 35, -23, 14, -47, 25, 18, -47, 10, 49, -43, 80, 102, 10, -35, -70, -82, 41, 8, 43, -92, 8, 57, -10, -72, -61, -6, 6, 45, 6, 45},
+  {-11, 74, 10, -80, 74, 72, -32, -80, 16, 80, -24, 21, -58, 77, 31, 27, -53, -8, -14, -53, -32, -5, 14, 11, -3, 47, 113, -26, -53, -69, -5, 68, 76, 87, -80, -72, -53, -69, 3, -16, -10, 5, -61, 26, -19, 29, 2, -35, 0, -10, 5, -14, -66, -53, -14, -64, 19, -42, 56, -43, 58, -3, -18, 77, -63, 76, -72, -39, -42, -42, 32, 23, 6, -32, 39, -19, -47, -26, 92, 10, 45, -23, 14, 8, -63, -69, -82, 40, -42, 24, 71, 69, -34, 47, 92, -42, -74, 77, 0, 56, 50, 29, -21, -66, 79, 47, -29, 74, 39, 21, 23, 109, -84, 53, 48, 85, -19, -59, 69, -32, -24, 51, 92, -21, -51, -79, -63, 26, 61, 40, 47, 16, -19, 76, -5, 69, 72, 6, 27, 2, 48, -29, 13, -47, -51, 64, -16, -45, -40, -51, -64, -40, 35, 27, -43, 76, 50, 35, 8, 69, 29, -27, -43, -10, -66, -19, -39, 58, 51, 74, 74, 72, -23, -14, 29, 87, -35, 63, -26, 104, 87, 13, -31, 82, 8, -40, 127, 63, 42, 35, -68, 82},
+  {0, -80, -37, 53, -5, 0, 20, 77, 69, -55, 2, -18, 84, -20, 10, 72, -18, -60, -10, 99, 27, 5, -2, 63, -17, 90, 58, -30, -60, 20, -82, -115, -82, -23, -35, 55, 45, 95, 35, -90, -70, 27, -28, 80, -80, 43, 84, -5, -74, -35, 90, 60, -8, 65, 27, -89, -30, -38, -109, -57, -47, 48, 60, 0, 67, 58, 48, 89, 38, -55, -74, 69, -5, 18, -43, 40, -2, 40, 45, -15, 15, 58, 3, 18, 10, 53, -43, 2, 87, -15, -127, -18, 57, 8, -17, -117, -27, -74, -18, 7, -3, 5, 10, -25, 52, 5, -48, 53, -47, -82, -13, -7, 57, -23, 15, -69, -38, 0, -8, 58, 45, 28, 7, 67, 33, 30, 65, 69, 95, -47, 27, 5, -45, 60, 47, 65, -20, 47, -17, -30, 32, -12, -38, -65, 3, -38, -69, -35, 52, 89, -60, 58, -57, -58, -104, 62, -58, -84, 25, -72, 50, 22, 57, -42, -82, 37, -75, -7, 69, -10, 13, -20, 7, -10, -72, -104, 45, -79, 18, 60, 74, 62, 52, -40, 43, 10, 20, 82, 58, -90, 5, 10},
+  {15, 65, -65, 65, -35, 25, -57, -10, 0, 53, 43, 33, 17, -127, -77, 55, -32, 13, -80, 67, -79, 32, 72, 80, -52, 95, 35, -53, 35, -52, -43, 85, 65, -42, -15, 2, 80, -75, -42, -45, -72, 63, -55, -13, 63, -58, 63, -53, -47, 45, -27, -32, -20, -50, -40, 63, -43, 20, 5, 87, -8, 2, -77, 35, 27, -2, -85, 53, 82, -15, 63, 22, -7, 15, 102, 85, -58, -3, 40, -20, 43, -58, 80, -48, -63, -69, 63, 12, 105, -28, -15, -13, 79, 69, -50, -15, -27, -62, 38, -37, -62, -75, -33, -48, 87, -13, -8, 79, -92, -35, -28, -2, 55, -3, -75, 85, 52, 50, 43, 23, 58, -13, 22, -37, -25, -5, -40, -62, -15, 47, -52, 58, -87, 0, 57, 87, -84, -65, 100, -33, -58, 69, -60, 84, 3, 23, 28, -10, 43, -35, -63, -63, 69, -84, -8, -28, 50, -47, -38, 70, 10, 28, 80, 20, -77, 62, 63, -12, -55, -17, 69, 22, -27, -80, -18, 27, 13, 119, -79, -52, -18, 43, -50, -42, 32, -27, 58, 17, -20, 22, 33, 60},
+  {-37, 79, 0, -33, 83, 75, 44, -106, 56, -52, -98, -67, 8, 37, 102, -62, -52, -58, 94, 85, -33, -35, -44, -23, 67, 56, -8, -73, 112, -60, 102, 69, -15, 119, -50, -37, -4, 23, -23, 127, 48, -75, 27, 27, 77, -100, -96, 33, 117, 60, 90, -48, -104, 56, 98, 46, -73, 0, 127, -102, 48, 56, -79, -102, -31, 6, 106, -90, 2, -110, 44, -77, 87, -79, 69, -75, 6, 52, 69, -77, 21, 115, -40, -79, 6, -42, -6, -2, 37, 60, -19, 15, 29, 15, 42, 15, 54, 17, 60, -4, -58, 69, -98, 106, -52, -81, -44, 81, 98, -17, 21, 112, -40, -108, 48, 56, -110, 40, 69, 2, -19, -29, 50, 81, -104, -52, 73, -19, -10, 117, -79, -52, 50, 56, -21, -10, 4, -50, -35, 35, 50, -35, -33, 94, -40, -60, 90, 81, 94, 46, -100, -40, 62, 75, 94, -65, 48, 110, 31, -40, 4, 60, 25, 8, 65, 65, -31, 6, -100, -46, -31, 17, -54, 65, -71, -56, 40, -15, 10, 29, 75, 46, 102, -6, -52, 96, 37, -58, -21, -23, -102, -6},
+  {-113, -83, 77, 127, 107, 93, -87, 42, -46, 16, -60, -79, -10, 109, 0, -73, -14, -109, 81, -93, 18, -81, 99, -6, 113, -127, -58, 105, -91, -12, -69, -4, 8, 111, -65, -50, 73, 75, 48, -38, 101, -44, 103, -20, 73, 83, -34, 42, 38, -2, -73, -111, 105, 6, -91, 91, 32, 46, 26, 97, -64, -20, -38, -46, -79, -40, -65, -22, 0, -83, 101, -75, 113, -95, 8, 34, -40, 111, -24, -73, -34, -10, 64, 40, 65, -38, -64, -93, 75, 30, 93, 93, 4, -107, 56, -50, 109, 117, -99, 58, 40, -4, 71, 73, 93, 14, 34, -8, -26, -77, -28, 26, 67, 16, 67, -44, 12, 73, 60, 81, -67, -89, 117, 87, -71, -58, 14, -81, 0, -67, 58, 93, -52, 89, -71, 69, -32, -67, 24, -14, 77, -42, -75, -69, 30, -103, -97, 105, -83, 40, 40, 4, 58, -34, 89, -54, 2, -87, 38, 24, -6, 105, -77, -54, 71, 0, -12, 22, -69, 64, -81, -69, 99, -101, 107, -69, -18, -91, 60, 14, 81, 87, 42, 93, 105, -20, 91, -24, -46, -28, 62, -48},
+  {43, -36, 86, 73, -36, 104, -21, 52, -4, -89, 20, -86, -18, 75, 48, 11, -5, -25, -4, 14, 20, 91, 0, 32, 21, 45, -68, -9, -11, -43, -43, -32, 16, 0, 13, 48, -64, 27, 0, -63, -38, -48, 80, 39, 13, 30, -47, -4, 66, 5, -72, -127, -68, 104, -2, 2, 63, -89, 14, -34, 48, -14, 59, 77, -38, 89, 13, 54, -72, -7, -79, -39, 16, -14, -61, -98, -47, 29, -79, -48, 102, 14, 66, -48, 13, -4, -29, 0, 64, 63, 21, -84, 7, -91, -73, 86, 0, -77, 30, -30, 39, -72, -29, 0, 39, -61, 32, -91, -95, -66, -70, 47, 48, -7, 93, 52, 0, 77, -48, 34, -41, 48, -48, 80, 59, 0, 84, -23, -52, -72, -9, 82, -43, 13, -59, 34, 0, -18, -80, -54, 82, -9, -14, -36, -18, 45, -32, -77, 34, 89, 70, -18, 79, -52, 25, -11, 21, -9, -30, -73, 32, 47, -18, -41, -36, 9, -54, -54, 21, 43, -7, -2, 79, -45, 0, -25, 43, 34, -23, 54, 0, 79, -61, -30, -70, 27, 41, 13, 47, -54, -27, -7},
+  {-19, -28, -13, 34, 38, -83, 27, 83, 19, -8, 53, -25, 78, 4, 47, -91, -6, 4, 63, -6, 19, -95, -38, -53, -11, -63, -72, -68, -99, -55, 95, -30, 9, 91, 95, 40, 23, 80, -34, -42, 87, -68, -27, -72, 8, -110, -85, -6, -4, -40, -91, 72, 93, -78, 100, 51, -93, -53, -8, -36, 44, -9, 38, -83, -11, -45, -17, 8, -59, -104, -15, -83, 61, 11, -53, 55, 53, 114, 6, 15, 6, 123, 63, -72, -2, -95, 85, -80, 0, 44, 0, 63, 40, 80, 99, -45, 28, 44, 108, -89, 64, 11, 61, 38, -30, -40, 11, -49, 28, 15, -32, -36, 68, 28, 21, 8, -108, 27, -36, 13, 19, -49, 15, 30, -57, -6, 49, -40, -23, -15, -59, -61, 38, -8, -6, 87, -66, 72, -8, 55, -19, 104, 74, -40, -61, 55, -25, -36, 17, -38, 34, -42, -95, -64, -49, 8, -118, -28, -15, 9, 99, 87, 8, 63, 82, -51, -70, 2, -13, -127, -47, -30, 53, 89, 38, 13, 23, -49, -38, -4, 27, -45, 25, 6, 55, 8, 78, 66, 11, -99, 17, -36},
+  {-77, -67, 21, -100, 90, 50, 102, 56, -69, 100, 21, 46, -21, 33, -83, -10, -71, -12, -79, -90, 40, 96, 69, 21, -52, -106, -81, -65, -85, -79, 25, 79, 4, -96, 10, -15, 42, 87, -48, 102, 25, -46, 71, 108, 79, 62, -67, 42, 50, 10, 92, -50, -44, -75, 12, -35, 77, -4, -40, 35, 65, 56, 81, 94, 115, -98, 40, 46, 33, 50, 54, 83, 104, -46, -112, -90, -108, 19, 56, 112, -42, -15, -67, -73, 106, 44, -98, -69, 8, -37, 4, -17, 19, -92, 67, -96, -87, -117, -54, -77, -69, 121, -17, -8, -58, -92, 81, 48, -56, 112, -106, -8, 42, 15, 37, 48, -37, -23, 73, -92, -2, 42, -25, -35, 35, -71, 17, 108, 94, -33, -69, 60, 106, 112, 60, 67, 112, -56, -77, -33, -98, 102, -79, -60, 23, 71, -6, 21, 35, -46, 81, -94, 77, 4, -123, -100, -127, -75, -15, 27, -106, -85, -35, 31, -50, -79, -71, 69, -100, -46, 90, -40, -77, -52, 83, -58, -12, -4, -96, -58, 31, -44, -12, -79, 73, -46, -2, 62, 27, 48, -44, -83},
+  {48, 56, 65, 58, 30, -87, -34, 87, -32, 28, -10, -60, 26, 81, -81, -93, 24, 54, 16, 42, 42, 87, 2, -22, -2, -91, 65, -28, 79, 69, -30, -60, 8, -14, 75, 10, 99, 91, -18, -16, 18, 65, 0, 48, 83, -28, -18, 73, -24, -40, -50, -54, 65, -83, 91, 56, 105, -38, -89, 34, 93, 56, -69, -16, 52, -34, -87, -113, -67, -119, -18, -79, 14, 121, 28, -10, -48, -14, -73, 42, 50, 73, -56, -101, -75, 14, 56, 113, -79, -36, -46, 4, -91, -18, -6, 105, -81, -93, 127, 28, -30, 58, -54, -42, 24, -67, 79, -12, 26, -22, 4, -22, 2, -115, 0, 44, 6, -18, 56, -54, 69, 60, 10, -81, 69, 44, -12, 24, 18, 95, -6, 89, -77, -6, -2, 48, 36, -75, 20, -28, -79, 58, -24, 79, 65, 54, 65, 75, -65, 34, -40, -44, -8, 6, 4, 28, 52, -85, -22, 4, -97, 30, 46, -83, -32, -28, -52, 54, 14, -40, 44, -16, 97, -56, -103, -24, 113, -16, 85, -26, -38, 42, -93, -42, 22, -73, -46, 2, 73, -85, -83, 95},
+  {-66, 47, 88, -47, 20, 31, 12, 18, -59, 39, -33, -76, 35, 51, 57, 72, -59, 68, 12, 27, 55, -35, -51, -2, 123, 72, 90, 21, 66, 63, -90, 23, 53, 45, -49, -23, -63, -55, 0, 70, -43, 72, -107, 94, -78, 4, 2, 104, 47, 80, 21, 68, -63, -51, 8, -45, -86, 72, 55, 57, -84, 51, -35, -107, -41, -100, 94, 78, -20, 2, -33, 20, 57, 59, 0, -21, -18, -107, 16, -21, 35, 23, 96, -45, 21, -47, 10, 4, 111, 27, 43, 70, 74, 45, -51, -23, -92, -29, 104, 0, -39, -39, 119, 31, 43, -23, -74, 25, -39, 41, -31, 68, 125, -90, 0, -68, -63, 39, 20, 49, -59, 100, 74, 2, 68, -35, 72, 4, 20, -84, 100, 2, -78, 92, 59, -57, -45, 104, -27, 92, -82, -100, -98, -43, -41, 47, -4, -4, -55, 12, -41, 127, 4, -27, 41, -57, 49, -10, 16, 45, 82, 63, 121, -23, -68, -61, -31, -125, -53, -121, 35, -20, 35, -20, -111, 74, -49, 76, -51, 88, 0, 115, 64, 63, -18, 68, -43, 27, 61, 70, 84, -6},
+  {2, -67, 25, -25, 38, 0, -93, 38, -62, -102, 0, -82, -53, 13, 2, -76, -93, -78, -27, -24, -45, -51, 31, -107, -38, -96, -56, 85, -67, 38, 42, 80, 2, -25, -73, -11, -13, -40, 44, -58, 24, 4, 49, -93, -13, 16, 27, -127, -40, 74, 93, -65, 2, -34, -83, -36, -91, -107, -58, -33, 22, 2, 7, 80, -25, -44, -58, -9, -33, -24, 71, -73, 42, 22, -76, -53, -20, -16, -49, 42, -44, 27, 96, 18, -54, 15, 38, 7, 27, 60, 11, 83, -103, 40, -9, -18, 54, 34, -38, 40, 69, -33, 76, -33, -24, 33, 5, 71, 54, 56, 15, -73, 20, -15, 98, 54, 47, 20, 42, 27, -31, -49, 22, 2, -24, -47, 27, -71, -60, 49, -9, -40, 36, -49, -29, 44, 67, 22, 71, -76, 82, -51, 87, -67, -82, 9, 18, -13, 11, 47, -31, -65, 82, -91, 45, 100, 60, 13, 18, 51, 103, 105, 69, 76, 34, 73, 20, 91, -69, 60, -69, 44, 89, 42, 22, 53, -65, 13, 22, -27, -45, -51, 16, 20, 80, 2, -7, 94, -60, 98, -53, -13},
+  {-5, 77, 5, 34, -4, -47, 38, -7, -82, -13, -63, -39, -63, 52, -80, -88, -14, -106, 61, 45, -63, -86, -68, 66, -77, -104, 11, -45, -36, 48, 11, -77, -9, 47, -30, 0, -48, -11, 80, 61, 66, -72, 2, 82, -16, -66, -57, -18, 93, -18, 45, 11, -41, 29, -18, -93, 48, -127, 64, -20, 66, -63, -13, 72, -57, 47, -45, 68, 86, 36, -66, -48, 47, -66, 47, -50, 18, 63, 77, 14, -95, -107, 52, -97, 25, 32, -50, -57, -107, -64, 20, -4, -91, -48, 47, -50, -27, 66, -57, -55, -14, 73, 77, -47, -45, -61, -32, 66, -20, 57, 52, -55, 16, -9, 39, 48, -20, 39, 68, -20, 20, -30, 93, -38, -77, 98, 14, 73, 25, -70, -13, -63, 80, 16, -75, 4, 86, -88, 61, 57, 66, -47, -25, -45, 61, -75, 95, 23, -27, 16, -25, 52, -54, 20, 77, 27, 72, 59, 61, 61, -50, -43, -9, -113, -57, 14, 84, 52, 18, 61, -9, 45, 88, -14, -52, 2, 63, -20, -7, -95, 84, -100, 72, -2, 68, 61, -50, -63, 86, -25, 61, 79},
+  {102, 38, 110, -74, -106, 38, -78, 80, 40, 0, -70, 61, -64, -6, -89, -74, 28, -11, -28, 108, 0, 42, -112, 0, -57, 80, 4, 85, 83, -30, -116, -95, 17, -74, -83, -119, -19, -51, 108, 28, -66, 61, -51, -93, -6, -89, 0, -57, -70, 0, -66, -53, 11, 21, -116, 28, 13, 11, 74, 17, 47, 23, 25, 42, 34, -97, -49, 47, -36, -25, -57, -55, 44, -47, -49, 80, 42, -70, 85, -11, 8, -104, -38, 55, 0, -51, -53, 116, 4, 127, -76, -55, 83, -68, 2, -95, 0, -61, 38, -110, -17, 61, 32, 8, 25, 116, -44, -55, 23, 91, 64, 106, -44, 4, -11, -91, 83, 110, -114, -55, 99, 25, 55, 34, -89, 99, -40, -53, 15, -80, 99, -6, 110, -72, -116, 13, 2, 112, -42, 19, -106, -4, -38, 83, -32, -114, 13, -106, 104, -23, 89, -61, 55, 89, 34, -95, 80, -47, -28, -32, -23, -51, 40, 53, 38, 80, 83, -6, -102, 34, -85, -112, 57, 83, -38, 19, 108, 70, -93, -30, -8, -53, -8, -74, 104, -28, 85, -4, -32, 51, -47, -32},
+  {45, 7, -22, -87, 0, -67, -18, -36, -58, -31, 114, 2, 71, 18, 87, 62, 56, -114, -18, -33, 89, 58, 80, -53, -53, 65, 25, -114, -89, 56, -78, 76, 85, -53, 9, -69, 29, -45, -94, -4, -62, -29, 38, -98, 4, 89, 78, -71, 96, -114, -51, 40, -40, -71, 18, -120, 87, -65, -13, -89, 20, 100, 62, 38, 74, 49, 120, 49, -100, 74, -11, -29, 22, -76, 11, 111, 42, 96, 31, 100, 27, 20, 62, 25, 96, -25, 33, -98, 65, -85, 45, -31, 7, 78, -69, -71, 47, 111, -85, -22, 80, 20, 22, 87, 65, -36, 91, -87, 0, 0, 42, -22, 16, -65, -80, 16, 82, -105, 91, 65, -78, 38, 13, 7, 96, 25, -45, 16, -56, 13, -71, -80, 9, -40, 60, -22, -47, 60, -4, 82, -87, 74, 58, 33, -82, -45, 51, 2, -91, 65, 42, 31, 7, -9, 65, -4, 105, -2, -40, 100, -7, -96, 62, -114, 36, -4, 56, -25, -58, -105, 9, -4, 47, -89, 25, -80, 45, -96, 87, -127, -42, -27, -53, -11, 94, 40, 82, -45, -89, 105, -96, -123},
+  {50, -27, 58, 65, -12, 87, 55, 8, 47, 63, 89, 3, 15, 0, -28, -32, 5, 60, -74, 10, 13, -50, 70, 48, 18, -53, -28, -47, -28, -53, -8, -70, 92, 65, -79, 67, 37, -50, -89, 50, 57, 18, 48, -50, -65, 27, -30, 50, 84, 50, -63, -17, -77, -53, 8, -18, -35, 23, -55, 75, 38, -57, 48, 0, -100, 22, 32, -58, -32, 57, 87, -5, -74, 0, 32, -75, -80, 70, -90, -75, -18, 27, -62, 53, 72, -47, 22, -82, -20, 99, -13, 30, 74, -50, -37, 12, 20, -48, -52, -28, -80, 84, 15, 37, 74, 13, -55, 52, 47, -80, -20, -53, -99, 0, 85, -3, -82, 82, 55, 79, -13, -33, 2, -43, 72, 77, 22, -8, 30, 17, -23, 100, 92, 3, -79, -22, 89, -79, -53, -7, 62, -42, 13, -18, 92, -17, -2, -28, -45, -12, 72, 22, 10, 8, -28, -82, 69, -28, 0, -127, -69, 43, -22, -57, -33, -85, -13, -45, -72, -2, 45, -70, -23, -10, -37, 104, 33, 10, -17, 62, -48, 57, -60, -40, -69, -58, -28, 52, 5, 48, -18, 7},
+  {27, 80, -114, -44, 64, -13, -7, 40, -100, -89, 87, -47, 47, -76, 47, -44, 4, -87, 0, -36, -24, 20, -42, -2, -44, 0, -120, 56, -45, -42, 56, 49, 73, 47, 89, -93, -18, -60, -54, 0, 5, -18, -67, -89, 4, -38, -62, 49, -2, -4, -42, -13, 38, 4, 49, -40, 73, 47, -69, -73, 65, 11, 111, -44, -15, 13, -111, -78, -69, -112, 9, -62, -56, 100, 7, 53, -87, -25, -53, 29, -5, -11, 62, 38, -56, 18, 31, 56, -64, -85, -65, -15, 47, -20, -13, 49, -20, -53, -9, -45, 103, 53, -36, 44, -47, -89, 58, -62, -53, 51, -53, -34, 5, 60, 78, -78, -20, -27, -65, 54, 83, 22, -65, 16, -62, 96, 83, -74, -100, 0, 15, 13, -31, -111, 53, 91, 33, 96, -27, -64, 44, 83, -15, -24, 83, -127, 73, 89, 38, 4, -36, 15, -71, -76, -7, 85, -9, 83, 47, -9, 18, -27, 78, -9, -54, -9, -7, 20, 27, 49, 36, 53, 83, -25, 62, 2, -71, 56, -67, 76, -56, 44, -49, -58, -5, -31, -107, 67, -20, -76, -53, -2},
+  {-62, -16, 20, 24, -94, -64, 62, -36, 16, -47, -50, -31, -70, 2, 46, 75, 50, -34, -28, 44, -11, -28, 33, 54, -52, -80, 3, -49, 65, -20, -90, -15, -36, 28, -39, -99, -37, 39, 77, -15, -64, 34, 29, 33, -20, -2, -50, 24, 64, -62, 2, 59, -31, -67, 49, -112, 2, 83, -15, 81, 8, -31, 85, -50, -52, 54, -90, 0, -41, -72, -26, -55, 34, -68, 20, 23, 33, -39, -60, -10, 98, -127, 65, 68, 85, -10, 26, -26, -28, -5, -13, -70, -60, -29, -83, 24, 39, 47, 18, -96, -28, 80, 29, -39, 10, 2, -24, -23, -23, -37, -49, 41, -46, 86, -68, -46, 33, -41, -26, -49, -49, -23, -54, 52, 37, 57, 77, 0, 65, 36, 0, -67, -47, -72, -21, -10, 52, 86, 5, 8, -80, -62, 64, 7, 85, -57, 11, -52, 21, 8, -31, -5, 20, 15, 0, -37, -52, 11, -77, -29, 52, 36, 37, 15, 33, -60, 68, -78, -44, 59, 5, 33, 77, 62, -75, 26, 59, -59, 10, 90, -50, 13, -44, -52, 86, 85, 0, -7, 49, 54, -41, 13},
+  {-52, 65, 0, -31, 106, 85, 83, -77, -100, 31, 42, -12, 104, 35, -37, 60, -69, -94, 29, 44, -29, -2, 85, -121, -110, -69, 15, -2, -42, 0, 35, -23, 73, -17, -127, -75, 19, 42, 17, -17, 110, -37, -90, 92, -96, -6, -23, -81, 44, 110, -79, -37, -92, -65, -46, -40, 94, 79, 2, -92, 62, 73, -83, 104, 62, 79, -77, -104, -4, 56, -35, 4, -106, 46, 25, -54, -92, -65, 25, -31, 77, -60, -12, 67, 102, 12, 29, -46, -12, -83, -42, 83, -52, 15, 117, -4, -42, -33, -87, -71, 52, 50, -75, 104, -87, 15, 12, -90, 60, 106, -48, -52, -10, -10, -94, 119, 0, -37, -83, 0, -46, 96, 42, 42, 15, 90, 94, 98, 75, -92, 37, -75, 10, 2, 106, -35, 54, -58, 94, -27, -4, 104, -54, 17, 52, 58, 17, -4, -17, -17, -40, 54, 58, 46, 46, -46, -62, -65, -37, 117, 17, -71, -50, 94, -33, -81, 44, -17, -15, 79, 17, 62, -71, 73, 8, 125, -90, -44, 17, -2, -62, 10, 2, -94, -54, -2, 87, 31, -50, 65, -6, 0},
+  {36, 0, -32, 68, -68, 42, 11, 102, 97, 61, 55, 97, 28, 47, 89, 87, -59, -102, -80, 72, 53, -106, -72, 25, -82, 74, 28, 85, -11, -2, -8, 89, 82, 34, 23, -15, 87, 91, -23, -76, 93, 36, 42, 89, -80, 64, -49, -34, 0, -30, 42, -4, 25, -63, 99, -11, 99, -51, -127, -2, 82, 23, 57, 91, 4, 21, -21, 66, -40, -21, 110, -36, -40, 70, 32, -78, 2, 97, 30, -30, -45, 57, 72, -27, -9, -116, -38, -102, -82, -2, 59, 82, -15, 80, -53, -53, 23, 42, -36, -95, 51, 0, -63, -42, -85, 99, -83, -76, -47, -66, 78, -95, -123, 17, 66, -57, -13, 36, -80, -70, -36, 74, -4, -8, 61, 45, 9, -9, 8, -21, -68, -119, -53, 49, 64, 76, -68, 23, -11, -64, 61, 9, 104, 0, -70, -49, -61, 93, 0, -121, 19, -80, -119, 85, 89, -45, -63, 4, -61, -38, 53, 47, 2, -106, 74, 95, -78, -49, -85, 55, -78, -2, 19, -51, -95, -19, -68, 87, 91, 95, -51, -27, 89, -102, -61, 34, 55, 38, -66, 36, 47, -78},
+  {-59, -10, 37, -34, -62, -68, 0, -57, -88, 64, -42, -62, 29, -8, 13, -18, -75, -46, -54, 42, 72, -21, -44, 31, -50, 52, 26, -39, -52, 10, -28, 0, -68, 29, 75, -5, -21, 78, -7, -31, -55, -111, -26, 16, 34, -98, 10, 55, 104, -49, -68, 26, 70, 29, 39, 23, 64, -65, 127, 80, 83, 7, -55, 62, 47, 41, 16, 47, 60, -26, 0, 73, 16, -16, 88, 62, 26, 49, -5, 46, -77, 55, 75, -46, 18, -13, -70, -10, 29, -26, -33, -39, -55, 99, -3, 26, 73, 86, 119, -33, 78, -37, 31, 50, 23, -88, 11, 62, -5, -83, 0, -70, 5, -86, -39, 62, -41, -46, 70, 68, -10, 64, 13, -57, 65, -23, 31, 57, -28, -52, 70, -23, 83, 39, -5, -13, -11, 98, 106, 41, -23, 39, 28, -37, -64, -46, 21, -11, -23, -33, 26, 90, -41, -77, -26, 24, 39, -2, 5, -37, -52, 31, 33, 23, -21, -68, -11, -60, 36, -13, -44, 21, 55, -33, -75, -59, -26, 57, -47, 62, 49, -55, -55, 83, 18, -44, 80, 0, -70, 0, 73, 13},
+  {15, 31, 33, 6, 8, 73, 21, 117, -46, 73, 90, -112, 60, 23, -71, 48, -40, -81, 69, 35, -112, -52, 96, -92, 94, 21, -27, 21, -23, -90, -46, -42, -90, 65, 10, 81, 52, 6, 102, 44, 21, 46, -33, -21, -83, -85, -35, 0, 121, -12, -31, -48, 8, -46, 65, 2, 108, 90, 71, -31, -92, -83, 33, 75, 75, -94, -69, -19, 104, 31, -8, 60, -19, -106, 117, -8, 83, 110, -73, 98, -94, 90, -10, -85, -52, 62, -67, 60, 37, 25, -104, -21, -44, 33, -15, -67, 23, 6, 65, 127, -25, 6, -56, -46, -12, 46, 48, 77, 23, 87, 98, -17, -25, 15, -69, -90, 77, -50, -25, 58, -104, 65, 23, -62, 0, 12, -54, -96, -40, -58, 112, 117, -4, -27, 40, 31, 73, -2, -48, 77, 37, -31, -4, -44, 27, 81, 35, 98, 87, 83, -21, 71, 42, -8, 44, 110, -15, -25, -96, 94, 73, -58, -4, -67, -127, 73, 19, 67, -62, -50, -73, -92, -21, -77, 48, 69, 50, 54, 25, -85, 58, 25, -81, -52, 60, -112, -62, -46, -90, 79, -23, -81},
+  {48, -28, -77, -18, 2, 67, -32, -10, 16, 75, -40, 32, 2, -44, -77, 71, -75, 103, -20, -69, 46, -109, 28, 26, -83, 50, -36, 24, -93, 56, 6, -109, -26, 67, -30, -77, -12, -38, -2, 14, -10, 65, 34, -83, -87, -6, -71, -75, 87, -52, -65, -2, -71, -77, -32, -38, 54, 87, -91, 28, 50, -6, 109, 56, 81, 0, -127, 44, -32, -71, 28, 69, 16, -69, 62, 103, 91, -79, -95, -40, -8, -56, 22, -40, -8, -93, 18, -46, 83, -4, -93, 87, -62, 115, -85, -48, -69, -111, 109, -65, -24, 73, 38, -56, -56, 99, 0, -30, 81, -22, -42, 60, 67, 48, -6, 32, -22, -34, -79, -85, -38, 111, 58, -40, -81, -12, -52, -10, -71, 75, 16, -117, 79, -103, 20, 30, -22, 18, -28, 103, 10, 8, 89, 32, 103, -62, 8, -28, -58, 48, -46, 113, 89, -38, 10, 99, -16, 18, 52, -81, -69, -8, -48, -69, 8, 34, 36, -28, 79, 4, -38, -89, 89, -34, 77, -69, 103, -75, -14, -91, 20, -73, -67, 58, 79, 97, 10, -69, 105, 99, -24, -105},
+  {-81, -85, 58, 81, -71, 60, 28, -56, -99, 40, -14, 117, 65, 32, 22, -109, 97, 20, 50, -26, 8, 85, -16, -36, 52, 38, 71, -62, 62, 26, -28, -4, -26, -8, -6, -44, -73, 71, 123, -44, -4, 32, -26, 28, 105, 101, -40, 38, -52, 8, -83, 127, 60, -75, 30, -32, 38, 97, -77, 73, 75, -40, 12, 58, 32, -34, 46, -24, 54, 44, 40, 46, -38, 12, 18, 30, -16, -48, -6, 69, -62, -18, -12, 40, -83, 75, 0, 115, -52, -34, 40, 65, -34, -34, -77, 0, -95, 30, 89, -12, 34, -93, 50, -101, 81, -20, 75, -32, -69, -42, -83, -62, -58, 91, -73, -48, -89, 67, -73, 69, 40, -16, -54, 95, 58, 8, -77, -71, -79, 52, 26, 99, 75, -103, -42, 58, -77, -16, 32, -2, -62, -95, 40, 22, 79, 26, -34, -6, 14, 48, 56, -28, 67, 12, 91, -54, 0, -91, -97, 24, 91, 60, 30, 0, 60, -38, 115, 12, 67, -73, -69, 40, 95, 0, -79, 18, -62, 42, 18, 105, 95, -42, -87, 24, -56, 24, 89, -93, 62, -46, 2, -22},
+  {73, -3, 62, 68, 8, 50, -71, 31, 53, 43, 39, 64, 12, -46, 15, -37, 79, -53, -19, -2, 45, -9, 76, 3, 12, 79, 57, 77, 77, 12, -74, -12, -43, 31, 34, 22, -9, -67, -62, -73, 50, -39, 25, -62, -14, 39, 15, 105, -48, 8, -56, 2, -28, 17, -71, -26, 74, -43, -36, 25, -76, 65, 0, 45, -29, -29, 2, -33, -62, -8, 81, -68, 64, -39, 53, 28, 0, 64, -57, -12, -68, 11, 34, -25, 51, 40, 46, -26, 43, -3, 107, 40, -6, -17, -57, 59, 43, 79, 68, -56, -11, -36, -57, -11, 74, -39, 50, -2, -65, -19, 57, 127, -31, 0, 8, 0, 51, 0, 12, 73, 60, 48, 43, -50, 0, 0, 3, -87, -67, 73, -3, 12, 39, -60, 51, 6, -67, -46, 54, -67, 39, -67, -56, -40, -20, 22, -42, 9, 28, -87, 17, -53, 68, 74, -57, -57, -15, -74, -62, 110, 48, 37, 12, -57, 76, -19, 51, 25, 3, -19, -76, -14, 60, -20, -50, 6, -53, 50, -54, 101, -54, 17, -42, 91, 46, 108, -36, 62, -23, -42, 40, -20},
+  {123, -13, 45, 111, -100, -89, 27, 58, 2, -51, 11, 60, -85, -118, -58, -96, -87, 13, 71, 20, 25, -89, -89, 22, -89, -74, -118, 11, 29, 82, -22, -9, -102, -13, -7, -69, -11, 47, 27, -78, -42, -74, 89, 69, 109, -60, -29, -47, -65, 18, 80, 78, -60, -11, -80, 74, 76, 47, -67, -116, 20, 82, -47, 31, -4, 111, -36, 74, -11, 53, -58, -53, -127, 40, -87, -65, -51, 74, 9, -36, -31, 98, -105, -78, 74, -116, -4, 22, 0, 53, -74, -94, 18, 4, 36, 31, -18, -47, -91, 0, 29, -114, -36, 98, 94, 87, 96, -69, -11, 109, -56, 78, 0, -45, -114, -78, 18, -91, -96, -42, 80, 71, 69, 71, 118, -87, 42, -53, 11, -16, 16, -51, 4, -85, 18, -36, -11, 27, 11, 0, 107, -107, -82, -96, 76, -67, -27, -7, 29, -111, -49, -51, 16, 47, 85, -7, 27, 38, -2, 9, 42, 60, -27, 49, 60, 102, 102, 91, -120, -47, -4, -49, 98, -82, 27, 0, -42, -82, 58, 87, -60, -31, -96, -47, 49, 123, 42, 69, -109, 74, 58, 7},
+  {-110, 29, 77, 67, 10, 82, 39, 2, -12, -45, 77, 9, -27, 17, 70, -5, -43, 89, -46, 38, -27, -14, -38, 38, 55, 105, 125, -29, 26, 26, 55, 127, -64, -24, 45, 5, 15, 77, 41, -31, 48, 77, -64, 21, 0, -34, -58, -38, 51, -29, -91, -70, -53, 45, -48, -3, 48, -34, 81, -55, -21, -67, 14, -46, -19, 45, 33, 36, 79, 91, 19, 3, -3, -96, -58, -26, 12, 65, -58, 26, 57, -29, 9, 31, -69, 9, -77, 17, -62, -15, 27, -24, 62, -41, -9, 48, 15, 36, 57, -60, 81, -22, -103, 94, -31, 12, -55, 76, 88, -57, 45, 27, 67, 43, 14, 29, 79, -12, -41, 14, 86, -53, 122, 26, 15, 48, -17, -17, -3, 57, 55, 74, 43, -17, 21, 5, -62, -76, -34, -31, -64, 81, 46, 26, 34, -33, 31, -19, 69, -96, -43, 5, -41, 14, -29, -76, 94, -76, -33, 48, -3, -31, -98, 58, -9, -27, -50, 115, 96, -53, -69, 77, -26, -96, 43, -7, 79, -65, 81, -29, -81, -53, 10, -58, 36, 65, 43, 19, -17, 64, 64, -36},
+  {88, -59, -111, 18, 43, -37, 68, 66, -96, 76, 80, -27, 35, 74, 66, 68, 43, 25, 16, 20, -84, -70, -59, 107, 88, 76, 80, -53, -16, 45, 107, 4, -45, -16, 25, 86, -53, -41, 55, 0, 66, -25, -76, 51, 111, -49, -12, -37, -20, 100, -16, -39, -2, -98, 107, -2, 102, 82, 127, -66, -55, -59, 80, 16, 94, 102, -107, 31, -10, 16, 47, 27, -18, 115, 109, -23, -102, -23, -18, -53, 18, -16, 74, 6, -88, -8, -18, 43, -100, -41, 33, 111, 31, 102, 107, -39, -55, -72, 4, 109, 37, 86, 20, -29, 66, 29, -18, 84, 80, -82, 84, 96, 33, 115, 49, 49, 55, 4, -53, -78, 94, -29, -33, 74, -35, -86, 39, -78, -55, 96, -59, -78, 8, -70, 76, 80, 31, 104, 55, 115, -98, 86, 51, -80, -84, -47, 102, 8, -27, -127, -96, 10, -96, 72, -51, 80, 47, 98, 37, 76, -72, 4, 80, -68, -49, 78, 111, 74, 80, 94, -76, -86, 43, -113, -41, 12, 10, 104, 6, 16, 10, 66, -33, -78, -41, -43, -31, 70, 98, 76, 18, 43},
+  {92, -70, 55, -127, 61, 84, -25, 111, 68, -35, -104, -45, -12, -51, 59, -78, 18, -84, -4, 84, 72, -68, -64, 49, 109, -84, 78, 39, -18, 16, 41, -18, -16, 64, 109, 39, 8, 74, 51, 57, -98, 109, 51, -2, 35, -25, -41, -14, 39, -51, -80, 2, -59, 51, 98, -4, 92, 76, 39, -94, 113, -27, 45, 49, 100, -12, -72, -66, 16, -104, -64, -31, -10, -12, 55, -8, 6, -53, -35, 31, -68, 45, -68, 104, -6, 31, -61, 57, -70, -104, -33, 35, -45, 12, 104, -12, 76, -76, 0, -74, 53, 27, 64, -88, 0, 102, -78, 10, -10, -31, -102, 23, -39, 76, -27, -61, 102, -4, 70, 29, 25, 6, 2, -55, 49, -86, 53, 57, 14, 37, 12, -68, 80, -23, 43, 86, 10, 47, -90, -6, 68, -14, 82, 84, -98, -55, 57, 70, 20, 20, -86, 88, -72, 12, -104, -96, 2, 53, 10, 0, 57, 100, -59, -104, 0, -18, -86, 57, -37, -59, 64, 98, 86, -39, 33, 16, 104, 104, -31, 78, 16, 49, 94, 100, 88, 102, 57, 20, -72, 74, -102, 55},
+  {-94, 104, 14, 61, 111, 98, 84, 14, 37, -76, -14, 37, -4, -4, 4, 39, 45, -117, 8, 106, -107, -2, 35, 25, -21, -10, -41, 96, 70, 43, -23, 39, 61, -43, 20, -16, -64, -107, 102, 31, 74, -29, 33, -45, -92, -55, 49, 2, -47, -68, 82, 39, 66, 25, -57, 51, -80, -14, -47, 61, 29, 35, 64, -76, -55, -43, 37, 63, -59, 6, 18, 98, 21, -64, 76, 0, -98, 14, -55, -82, -63, -84, 10, -72, -27, 6, -20, 86, -72, 33, 94, 98, 20, -100, 6, -10, 107, -4, 72, -18, -39, -61, 18, 49, -2, -61, 55, -96, -76, -14, -78, -39, 115, 90, 37, -41, -70, -27, -90, -53, -64, -14, 31, -23, 33, 59, -4, -109, 27, -37, 33, 127, -47, 8, 63, -53, -80, 31, -37, 109, -23, -111, -12, -76, 29, 16, 43, -51, 51, 86, 51, -66, 21, 23, 92, 102, 35, -59, -119, 66, 29, 23, -33, 12, -47, -66, -18, -57, -18, 80, 84, 31, 80, -43, 82, 74, -35, 16, 88, 70, 12, 16, -20, -12, 80, -82, -41, -88, -18, -74, 8, -64},
+  {6, -82, 0, -116, 23, 78, -47, -83, 82, 34, -8, 91, -83, -2, 91, 47, 25, -28, 21, 15, -83, -104, 97, -13, 27, 85, -85, 83, -76, -8, 68, -40, -44, 45, -64, -4, -61, 100, 21, 127, 97, -6, -32, 64, -42, 45, -61, -59, -85, 38, 80, -53, -51, -97, -17, 104, -61, -4, -93, -21, 80, 13, -76, 68, 19, -19, 42, 8, 19, -63, 63, -49, 17, -28, -72, 74, -76, -63, 44, 23, 95, 17, -17, 102, -23, 42, 6, 27, -4, -15, 15, 36, 17, -68, -13, 28, -38, 36, -78, 61, -47, 21, -19, 47, 93, 42, -74, 68, -13, -49, -42, -19, -85, -30, -76, 82, -85, 44, 76, -28, -59, -23, -116, 55, 76, -63, -44, 97, -19, 80, 15, 23, -6, -51, 82, -59, 45, -82, -6, -68, 55, 87, 44, -21, -78, 114, -51, -45, -30, 57, 64, 15, -91, 32, -27, -63, 27, 45, 93, 72, 30, 9, -64, 104, 9, 82, -91, 30, 47, -91, 64, 30, 87, -32, 49, 27, -51, 34, 17, 9, 85, -82, 15, 78, -6, 57, -93, -28, -57, 87, 53, 64},
+  {-83, 40, -127, 31, -15, -98, -48, 65, 19, 87, -92, -81, -8, -12, 27, -58, 90, 13, -69, -87, 75, -67, -27, 100, -60, 25, 75, -31, -48, -23, 35, -83, 12, -64, 106, 92, 31, -100, -17, -29, 58, 37, 44, -90, 87, 8, 81, -58, -37, -64, 0, -25, 12, 90, -15, 90, -75, 15, 27, 10, -10, 52, 104, -42, 25, -81, 104, 23, -25, -54, 0, -81, -44, 69, 92, -90, 56, -48, -17, 60, -100, 58, 77, 77, -42, 67, 65, -46, -73, -60, 0, 56, -52, 2, -106, -127, 17, -23, 10, -27, -75, 35, 46, 0, -48, -81, 62, -13, 50, 81, -106, -114, 85, -46, 65, -106, 23, 50, 35, -81, 10, 21, 112, 21, 69, -42, -10, -106, -29, -21, -10, 106, 65, 4, -98, -65, -25, 48, 48, 92, 85, 54, 56, -25, -50, 35, 13, 83, -15, 19, 19, -13, 35, 21, -73, -69, -89, 25, -40, 25, -62, 27, -77, 25, 31, 4, -58, 71, -19, -87, -17, 23, -4, 42, 50, -85, 81, 62, -44, -52, 96, 79, 54, 77, 67, -8, 73, -77, 6, -17, 104, -27},
+  {4, 4, 37, -53, 53, 77, 57, 7, 31, -33, 50, -66, 52, -2, -87, -15, -6, -101, -28, 81, 50, 68, -94, 64, -90, -75, 77, -18, -37, 4, 13, 46, -20, -33, 44, -42, -75, 96, 46, -87, -53, -40, -26, 31, -13, -20, -18, -57, 61, -29, -44, 68, 20, 81, 50, -105, 6, -31, -6, 48, -87, -77, 46, 0, -52, 0, -2, -48, -18, -2, -24, -52, 88, -70, -4, -96, -42, 13, 66, 29, 61, 0, 53, 79, -68, -35, -68, 59, -53, 22, 88, 72, 61, -18, -105, 2, 68, 37, -29, -72, -92, -15, -15, 63, -37, -24, -83, 98, -46, 50, -11, 105, 74, -70, 48, 37, -46, -33, -48, 4, -46, -31, -31, -85, -83, 13, 20, 103, 4, 39, 9, 22, -37, 28, -26, -94, 33, -101, 83, 70, -83, -77, -57, 96, 68, -79, -24, 22, 33, -6, 55, -26, 28, 107, -15, -46, 107, 9, 31, 127, 74, -52, 20, -9, -18, -24, 85, -11, -53, 77, 46, 33, 75, 52, 74, 101, 33, 17, 2, 15, 94, -35, -18, 29, 48, -28, 29, -79, 52, 33, 48, -52},
+  {64, -80, -2, 16, 4, -43, -94, 84, 29, 57, -59, 35, -20, 35, 74, -29, -18, -66, 20, -31, -16, 47, 78, -41, 31, 64, 14, 6, 113, -12, -39, 35, -57, -61, -84, -53, 0, 6, 78, 43, 45, 0, 98, -47, 102, -18, -119, 35, -94, -55, 66, 47, -10, 25, 31, 4, 43, 82, 72, -64, 37, -74, -53, -88, -6, -74, 41, 57, 33, 49, -59, -94, 10, -20, -14, 16, -51, 18, 82, -96, 76, -12, -27, -96, -90, 31, 33, 4, -8, 82, 127, 57, 37, -18, -64, 10, 31, -41, 66, -12, -88, 2, -45, -37, 20, -72, 41, -12, 92, -61, -98, -25, -66, 59, 6, 2, -10, -70, 74, -14, -33, -37, 80, 45, 33, 20, -47, 47, -76, 37, 57, -57, 102, -90, 98, 57, 119, 61, -90, -35, 68, -55, 43, -64, -109, -6, 16, -47, -10, 61, -47, -47, -51, -84, 20, 92, 12, -98, 109, 94, 64, 23, -72, 76, -2, -88, 72, 0, -107, -80, -25, -51, -57, -23, 18, -57, -23, -23, 51, 45, -100, -125, -8, 49, -55, -84, 33, 35, -6, 72, -18, 0},
+  {14, 34, 39, 98, -48, 34, 57, -43, 9, 29, 11, -25, 75, -127, -38, 0, -52, -32, -32, -14, -52, 59, 75, 0, 61, 66, 29, -20, 63, -16, 2, 30, 5, 0, -50, 64, -55, -13, 77, -32, -91, 47, 80, 61, -9, -4, 41, 118, -116, -36, 7, 89, 77, -30, -97, 43, 73, 111, 82, -4, 5, 34, -63, -30, 73, -16, 54, 91, 95, -45, 47, 88, 48, 59, 68, 39, 52, -39, 93, -77, 9, -41, 64, 4, 11, 4, -77, 59, -7, 47, 54, 38, 52, 95, 4, -43, -77, 45, 41, -80, -93, -73, -30, 59, -68, -27, -72, 25, -41, 18, 95, 48, -32, -45, -95, 111, 45, 68, -9, -5, -73, 55, -2, 4, -39, 0, -4, 23, -21, 45, 45, -84, -97, 104, -77, -48, -82, -14, 36, 5, 21, -89, 89, 39, 52, 116, -43, 54, 93, -18, -38, 75, -34, -38, 107, 61, 97, 84, -80, 20, 66, 41, -18, 38, 72, -5, -9, 50, -29, -66, 36, 79, -27, -20, -77, -57, -57, -47, -61, 61, -38, -9, -82, 98, -79, 20, -7, -80, -32, 75, 2, 23},
+  {57, 84, -12, 28, -60, -40, -15, -48, 10, 53, 92, -45, 3, -28, 77, 84, 63, -35, -22, 50, 74, 42, -38, 60, 82, 112, 90, 99, 65, 77, -70, -69, 2, -63, -28, -45, 45, -65, 87, -57, -67, 0, -3, -67, 42, -53, 42, -33, -84, 33, 57, 12, 27, 18, -35, -30, 30, -27, 84, 3, -18, -77, -55, -20, 27, -47, 30, -58, 18, -25, -70, -7, -89, -47, 22, -58, -53, 32, 60, 15, -12, 63, -30, 77, -77, -57, -79, 65, -35, 25, 97, -38, 33, 55, 52, 90, -42, 0, -63, 70, -58, 7, 2, 67, -25, 53, -40, 65, -8, 48, -5, -40, -63, 12, -50, 82, -48, 37, 48, 5, 22, 127, -60, 37, 52, 75, 53, 75, 102, -17, 37, 62, -77, 28, 37, 17, -23, 18, 80, 13, -74, -2, 38, -45, -28, 35, 60, 69, -43, -84, -5, -69, -25, 109, 105, 97, 89, 102, -53, 0, -77, 104, -10, 2, -60, -72, -40, -63, 72, 57, -67, -70, -8, -67, -87, 89, -3, 89, -2, 62, -17, 55, 63, 35, -47, 122, 13, 85, 80, -47, -57, 43},
+  {-58, 44, 34, -38, 69, -25, -56, -66, -41, 52, -71, -9, 56, -66, -74, 80, 33, 71, 17, 75, -39, -27, -42, -55, 80, 27, 8, -22, 9, -8, 44, -88, 64, -85, -66, -16, 22, -27, 64, 5, -22, 49, -13, 47, 66, -56, -2, 66, 39, -22, 74, -80, 64, 127, -30, 94, -49, 38, 30, -69, 47, -17, 69, -53, -56, 83, 93, -16, -63, -67, -5, 3, -47, -60, -39, -52, -56, -22, 31, 49, -25, 3, -34, 33, 61, -56, 44, -42, 94, 2, -74, 11, -47, -58, 52, -71, 8, 14, 63, -19, -34, -60, 86, 89, 33, 0, 49, -19, 31, 64, 14, -2, 80, -16, 2, -63, 55, 83, -75, 39, -17, 39, 121, 47, -27, -75, -61, 71, 77, -45, 80, 0, 3, -71, -53, 64, 50, -30, 56, -33, 30, -28, 5, 52, -11, -20, -9, -28, 3, -45, -50, -25, -27, 28, 42, -16, 0, -67, 36, 19, 8, 41, -36, 9, 3, 42, -36, 63, 34, -24, 27, -64, 66, 9, -49, -28, 82, -39, -9, -66, 44, 11, -34, 69, -33, -39, -38, 34, -33, 9, 60, -75},
+  {-94, 59, 10, 12, -53, 29, -8, 31, 123, -119, -27, -104, -66, 90, 90, -4, -23, 47, 59, 100, 4, -27, 47, -55, -39, -37, -102, 0, 80, -76, -31, 25, -23, 14, 31, 18, 49, 76, -68, -86, -23, 25, 94, 104, -72, -96, 37, -45, -41, -23, 74, -76, -51, 70, 51, -94, 0, 55, -102, 88, 70, 78, 57, -82, 10, 92, -98, 86, -102, -16, -98, 86, 37, -41, 88, -76, -4, -37, -10, -80, -96, -31, 33, 20, -49, 72, -100, 39, 0, -45, -4, 84, -90, -102, -18, -74, 14, -90, 123, 82, 35, -16, -8, 10, -45, 72, 107, 49, 70, 18, -20, 59, -29, -117, -29, 20, 100, 92, 23, 78, 59, 49, 66, -10, -51, -74, 84, 29, -47, 76, 70, -59, 96, 104, 100, 96, 66, -4, 23, 0, 70, -94, -127, -51, 27, -94, -102, -25, 6, 68, -39, -61, -39, 45, -78, -100, -104, -2, -96, -109, 53, 27, -12, -82, 57, 64, -88, -39, -16, -37, -33, -80, -33, 31, 59, 18, -49, 10, -49, -100, 84, 18, -86, -104, -31, -43, -64, -82, 90, -82, 31, 10},
+  {-88, 0, -13, 79, -25, 82, -27, 34, -79, -30, -21, 14, -47, 98, 47, -36, 18, 72, 70, 4, 63, 100, 54, -55, -2, -36, 38, 72, 52, -52, 63, 18, 72, 55, -36, -30, 50, 79, 2, 36, -48, 72, 86, 0, 107, 45, -93, 4, 7, -16, 39, -32, 25, 64, 91, -4, 43, -48, -29, -54, -7, 89, -48, -86, -116, -52, 100, -66, -52, 41, -30, 32, -86, -61, -36, 41, 86, -47, 57, 72, 18, 11, -27, 25, -29, 80, -84, 73, 43, -72, 104, 34, -75, -54, 25, 72, -21, 43, -52, 104, -64, -75, -14, 11, 75, 84, -14, -11, -29, -57, -61, 29, -7, 61, 13, -20, 82, -61, -45, 52, -75, 5, 127, 50, 36, -18, 43, -4, -98, 50, 45, 64, 84, -70, -57, -88, 45, 89, 66, 66, 57, 70, -36, 79, -59, 27, 45, -25, 64, -21, -36, 4, 13, 14, 113, -41, -36, -47, 64, -9, -2, -59, 2, -45, -79, 84, -91, -79, -80, 50, 63, -23, 9, -82, 29, 23, 106, 32, 21, -91, 27, -52, 29, 29, -21, -68, 57, -91, 4, -45, -79, -14},
+  {-98, 90, 2, -25, -47, 45, -49, -90, -35, -33, -104, 14, -45, -45, 4, 33, -68, -104, 55, -29, -76, 74, -51, -127, 74, -4, 59, -61, 6, 14, -68, 2, 102, 64, -90, -72, 14, -72, -6, 88, 74, -12, -94, 76, 39, 92, -14, -20, -31, -94, 96, -74, 0, 94, -45, -55, 45, 27, -74, 59, -94, 27, 98, 76, 25, 59, 88, 14, 37, 37, 31, 80, -25, -47, 43, -59, -96, -59, -76, 6, 88, -82, 31, 68, 0, 10, 29, -57, 45, -102, -16, 100, -20, -88, 0, 20, -107, -14, -119, 113, -23, -14, -25, 117, 23, 68, 76, 12, -70, -88, -55, -109, 18, 6, -72, -84, 27, -4, 51, 27, -92, -25, -66, -29, -49, 57, 109, -8, 14, 27, 41, 2, -45, 76, -41, 74, 51, -61, -98, -29, -61, 104, 14, 78, 98, 43, -51, -20, 102, 20, -25, -111, -76, -80, -4, 66, -14, 80, 31, 16, 84, -88, 66, -74, -88, 39, -104, 53, -41, 4, 49, -10, 0, 123, 61, 53, -10, -111, 12, 27, 82, 41, 100, -111, -53, 29, 6, -86, 33, 72, -59, 80},
+  {-39, 14, -36, 15, 7, 32, -19, -15, 54, -100, 14, 81, 15, 51, 86, -27, 58, 63, -75, 32, -10, -7, -27, -27, 3, 17, 32, 30, -14, -86, 30, -22, 61, -76, -63, -75, -95, 24, 49, -63, 91, -39, 63, 32, 36, -12, -49, -15, 15, -54, 85, 85, 49, 85, -75, -25, 34, 51, 5, -17, 19, 7, 25, 68, -2, -81, -8, 29, 93, 102, 52, -39, 24, 24, 36, 46, -15, -30, -3, -68, 32, 19, -73, -3, -46, -30, 15, 61, 17, 85, 97, 69, 20, 49, -39, 127, 0, -47, 46, -36, -59, -80, 8, 8, 24, 81, 76, 97, -86, 17, 27, 107, 22, 39, -14, 20, 14, -30, -5, 39, 73, 39, 54, -37, -85, -83, -90, -76, -64, 47, -27, -58, 44, 24, 0, 3, 56, -34, 15, 22, -86, 27, -76, 49, -12, -37, -24, -78, 69, 19, -58, -64, 15, 41, -8, 39, -42, -47, -52, 37, -3, -10, 25, 10, 2, -14, 2, 68, -5, 49, -44, -75, 47, -24, -25, 56, 7, 10, -24, 81, 36, 14, -81, 46, -83, 71, 47, 73, 76, 80, 7, -51},
+  {-31, -42, 64, -20, -48, 18, -46, 7, -44, 85, -63, -63, -26, 39, -66, 55, 46, -46, 64, 42, 53, -18, 33, -4, -72, -81, -48, -4, -83, 52, -4, -74, 70, -63, 123, 57, 13, -77, 22, -57, 59, 88, 11, 42, 103, -15, 39, 0, 0, -63, -20, -127, -37, -35, 63, -13, 35, 6, -17, -15, -48, -2, 99, 50, -9, 81, -48, -42, -81, -110, 35, 9, 88, -15, 64, 88, 7, 39, -87, -90, -92, -22, 87, -46, -18, -63, -24, -57, -70, -98, 33, -6, 31, 33, 81, -70, 96, 11, 13, -7, 39, -4, -75, -68, 72, -4, 52, 79, 13, -31, 57, -66, 11, 61, 37, -112, 33, -77, 74, -77, 2, -98, -33, 0, -15, -7, 90, -29, 24, -53, 33, 94, -13, 11, -68, -46, -33, -33, -68, 85, 11, -35, 48, 79, -110, -77, 29, 83, -11, -70, 68, -57, 90, 28, 110, 44, 4, -6, 64, 6, -79, -4, 20, -11, -9, 18, -81, -20, 20, 61, -61, 50, 46, -57, 85, -66, 94, -18, 66, -22, 99, -48, 50, 64, -79, -87, 18, -79, -4, 15, 70, -9},
+  {-15, 6, 127, -3, 1, 40, 77, 21, 37, -12, 72, 58, 19, -34, -50, -43, 71, -10, -18, 89, 83, -9, -43, 34, -47, 86, -53, -12, -27, -71, -7, 25, -1, -18, -32, 55, -52, 87, -55, 65, -41, 16, -18, 74, 19, 68, 46, -55, 16, -52, -68, -30, -38, -19, -38, 4, -18, -74, -34, -52, -44, -13, -1, 25, 53, 25, -31, -24, -19, 22, -47, 75, -27, -32, -80, 69, -65, 6, 3, 93, 52, -61, -72, -56, -30, -46, -25, 61, -32, 69, 18, 52, -37, 4, -3, -93, -40, -30, 19, 80, 78, 49, 71, -61, 80, -43, -55, 75, -87, 0, 10, 49, 64, 50, 64, -87, 34, 81, 43, 47, 37, -7, -50, 58, 10, -16, -64, 77, 4, -64, -16, -47, -44, -49, -35, -58, 97, -3, -13, -25, 49, 100, 44, 31, 12, 49, -25, 53, 68, -16, 30, -66, -32, -10, 15, 66, -15, -86, 75, 56, -43, -25, -6, 16, 34, 81, 24, 10, 78, 21, -1, 38, 69, -58, -50, -84, 35, -49, -77, -7, 52, -75, 46, -12, 68, 19, 92, -56, -40, -69, -32, -75},
+  {26, -39, 33, 26, -2, 92, -50, -4, -35, -55, -39, 72, -55, -9, 70, -9, -66, -6, -64, 31, -68, 26, 72, -61, 81, 50, -20, 29, 72, -22, 74, -33, -74, -92, 114, -17, 22, -9, -26, -74, -72, -61, 77, 0, -11, 110, -83, -63, 63, 48, 35, -44, 48, -20, -63, -68, 0, 87, -105, 15, -22, 79, -88, 96, 61, 40, -39, -61, -39, -74, -39, -4, -17, 105, 7, -39, -18, 7, -15, 99, -18, 68, -70, 96, -4, 85, 26, -44, -63, 26, -127, -20, -99, -13, -9, -94, -50, 18, 22, 22, 0, -57, 103, -26, -40, 57, -29, -72, -22, -7, -6, -74, -9, -29, -77, 55, 75, 88, 110, -55, 83, -42, -94, -46, -74, 52, -81, -72, 39, -48, -20, -39, -70, -79, 31, 83, -2, -59, -7, -63, -53, 17, 26, -53, -44, -6, -68, 74, 99, -61, 88, 6, 53, -13, -81, -64, -50, -35, 15, -64, -42, -109, 39, -79, 11, 29, -6, -57, -61, -103, 72, 46, 15, 72, -4, 18, 33, 29, -31, 105, 66, 0, -68, -110, -57, 70, -72, 46, 39, 63, 15, 64},
+  {-125, -110, 0, 37, 94, 25, 33, -60, -52, 35, 0, -62, 102, -25, 119, 15, -10, 35, -71, 0, 60, 60, -2, -104, 65, -77, -44, -8, 69, -19, 37, 8, -75, -29, -110, -60, 52, 65, 56, 119, -96, 71, 65, -27, 4, 0, -92, 75, -94, 15, -71, 25, 17, 2, 35, 110, 44, 102, 60, -62, -6, -79, 96, 52, -110, -19, 44, -40, 67, -23, -85, -50, 67, 60, -56, 58, 15, 27, 83, -25, 19, -21, -92, -37, 85, -96, 87, -4, 42, -85, 104, -31, -83, 12, -69, -54, -46, 127, 44, -58, -15, -21, -19, 21, 48, 100, -67, -31, -71, 17, 65, 37, -96, 48, 98, -92, 23, -123, -65, 65, -67, -48, -27, 98, 83, -42, 54, -23, 25, 37, 10, -96, 40, -2, -81, -40, -81, 71, 37, 75, -48, 83, 65, 106, 71, -31, 69, 65, 94, -104, 0, -52, -65, -52, -6, 31, 127, -58, -17, -21, -90, -73, 37, 85, 110, 6, -92, 75, -73, 23, 17, -65, -21, -98, 17, -42, -10, 110, 21, 67, -37, -121, -100, 77, 100, 100, -12, 77, 23, 8, -31, 12},
+  {-52, -77, -44, 61, -79, 24, -4, 68, 6, -18, -31, -33, -66, -33, 6, 48, -15, 109, -66, -77, 94, 31, 83, 88, -94, -9, -70, 53, 28, 70, 44, 61, 105, 61, 96, -52, -48, -29, 11, -40, -29, -53, 101, 28, -22, -37, 4, 68, -4, -88, 85, 52, 75, 29, 53, -33, 15, 29, 37, -13, -46, -28, 79, -40, 9, -92, -59, 96, -6, 59, -40, -85, -79, -75, -57, 0, -39, -20, 20, 57, 28, -59, -57, -53, 72, -66, -83, 11, -18, -22, 53, -77, 83, 75, -17, 40, -88, 31, -33, -72, 0, 17, 83, -81, -57, -11, 28, 26, -70, 72, -2, 35, -127, 57, 50, -79, 9, 103, 35, -35, 96, -46, -35, -75, 44, -75, -26, 63, -59, -40, -11, 17, 0, 40, -33, -29, 64, -44, 85, -107, 85, -53, 46, -29, -64, 13, 66, -64, -46, 88, 9, 22, -48, -39, -88, 18, 2, -59, 50, 15, -70, 0, -4, 40, 15, -68, 92, -90, 18, -18, 70, -37, 61, -77, 7, -26, -24, -103, 53, 64, -68, -63, 66, -103, 13, 75, 74, -7, 48, -77, -2, -2},
+  {21, 45, 14, 70, 73, 63, -54, 27, -54, -13, 50, -54, -41, -20, -29, -41, -5, 14, -32, -55, -95, -7, 52, -100, -25, 109, 109, -72, -5, 79, -64, 7, -2, 91, -45, 107, -39, -45, 80, 68, -20, 0, -11, 82, -16, -36, 72, -5, 11, -32, 0, 75, 18, 73, 13, 21, 18, -27, -9, -32, 9, 84, -93, -11, -16, 18, 20, 93, 82, -72, 13, 4, -66, 34, 84, 32, -63, 52, 16, 45, 66, -5, 61, 61, -55, -32, 59, -2, -20, 13, 107, 21, -39, 45, -66, 45, -14, 32, 48, 20, -68, 41, -50, -14, 82, -32, 41, -18, -86, -59, 63, -70, 43, -34, -66, 9, 86, 43, -41, -14, -68, 32, 95, -14, -30, -29, -57, 43, -98, 88, 20, 29, -68, 13, 13, -29, -79, 75, 77, 84, 32, -55, -72, 32, -84, 39, -84, 25, 43, -38, -13, -45, 55, -11, 100, -39, -11, -13, 45, 61, 75, 100, -79, -23, 75, 30, -97, 39, 16, 36, -20, -82, 68, 34, -2, 75, 2, 30, -13, -29, -61, 5, -47, 45, 59, -29, 127, -23, -16, 52, -72, -9},
+  {109, -58, 115, -28, 14, -26, -60, -62, -58, 24, -16, -105, 24, 109, -6, 54, 73, 87, -42, -69, 83, -38, -69, 69, -69, 79, -117, -89, -85, 6, 36, -60, 48, 40, -16, 52, 77, -109, 22, 40, 46, -105, 36, 75, 16, 36, -2, -52, 83, 42, -24, 58, 10, 54, 42, -85, 101, -28, 52, -95, 2, -28, 38, 101, 34, -22, 42, 87, 2, 28, 10, -56, -69, -46, -12, -87, 34, -10, 34, 56, 12, 36, 67, -69, 42, -2, 97, 50, -12, -107, -4, 71, -2, -32, -32, 32, -87, 34, 4, 77, 60, -71, 30, 121, 8, 24, -67, -22, -2, -101, -83, 14, -2, 71, 93, 28, -30, 42, 95, -91, -48, 77, -62, 34, 73, -65, -8, -93, -20, -36, -14, -65, -75, 58, 56, 28, -67, -75, 91, 95, 10, -54, 75, 99, -14, 2, 71, 93, -60, -91, 24, 67, -28, -16, 77, -75, -89, -34, -91, 48, -85, 10, 50, 127, -87, 18, -60, -46, -111, 60, 26, 42, 71, -62, -52, 30, 12, -69, 48, 109, -85, 50, 20, 10, -18, 71, 58, -81, -89, 54, -62, 71},
+  {-5, 2, -50, 5, -32, -70, -5, 4, -68, -38, -23, -63, -20, 98, 25, 41, -79, -25, -38, -7, 11, 77, 32, -75, -123, -104, 5, -57, 93, -45, 82, 95, 73, 72, 5, 63, -63, 98, 77, 38, -64, 102, -34, -18, -13, -72, -29, -82, -61, 11, 63, 27, 5, 32, 61, -7, -2, 7, 27, 36, 20, -18, 84, -2, -75, -25, 9, -84, 25, -14, 80, 20, 20, 52, -45, -55, -61, 114, -45, 39, -70, -64, 95, 5, -88, 50, 45, -75, 34, 9, 54, 50, 32, 4, 50, -61, 59, -34, 29, -41, 72, 61, 82, 7, 36, 73, 25, -63, 72, 57, -102, 36, 68, -107, 64, 32, -57, -61, 13, 21, -79, 23, -13, 29, -50, 14, -66, -23, -80, 39, 32, 64, 2, 55, -48, 38, -32, -7, -89, -20, -13, -47, 0, 55, -21, -36, 34, 9, 48, 43, -32, 95, -127, 64, 68, -89, 39, -97, -39, -48, -32, 43, 80, 5, 41, -16, 70, 80, -18, 63, -34, 61, 104, 59, 0, -93, 54, 30, 20, 86, 64, 14, 88, 41, 47, -100, -25, 82, 63, 82, 21, -38},
+  {-21, -50, -69, 75, 82, -60, -21, 17, -43, 121, 47, 75, -67, -37, -56, -78, -45, -45, -39, 86, 13, 7, 60, 127, 24, -69, -39, 82, 26, -69, -34, 4, 6, -77, -37, -24, 15, 69, 103, -60, -37, -35, -13, 24, -54, 62, -41, 24, 95, -35, 95, 39, 30, -60, -75, -2, -88, 4, 73, -86, 90, 22, -28, -80, 21, -19, 11, -4, -49, 35, -84, 78, -34, -71, 11, 54, -71, -21, 47, -90, 82, 45, -82, -86, -49, 58, 97, -37, -34, -26, 24, 41, -88, -73, -28, 28, 82, -63, -28, 73, -78, -45, 34, -41, -88, 56, 95, -60, -65, -11, 41, -82, 13, 73, 88, 13, 52, 0, -80, 0, -11, -32, 2, 45, 9, -86, -15, 30, 93, 86, 54, 106, 9, 63, -39, -26, 73, 6, 103, 103, 84, -32, -54, -88, -52, 65, 21, 37, 78, -82, -17, 15, -30, 35, 6, -47, 21, -34, -4, -118, 90, -19, 103, 0, -90, 88, -58, 7, -60, -24, -67, 13, 67, 75, 22, -17, -63, -78, 73, 24, -54, -78, 34, -11, 54, 65, 0, 90, 82, 30, 4, -86},
+  {2, 43, 56, -69, -6, -13, 95, -45, 58, 0, 15, 2, 45, 75, 37, 82, -11, -13, -65, 30, -32, 4, 62, -99, 75, -37, -82, 82, -116, -90, -67, -121, -103, -103, 9, -80, 73, -82, 50, -47, -41, -2, -62, -34, -93, 97, 56, -9, -86, -34, 116, -108, 99, 32, 24, -54, 86, -54, -114, 95, 47, 52, -50, 82, 30, -86, 47, 99, 13, -60, -22, -71, 125, -80, 34, 45, -67, 17, -50, -6, -84, -11, 0, 108, 2, 26, 88, 56, 22, -47, -88, -22, -39, -123, -50, 30, 41, 108, -56, 84, -45, -90, 22, -43, -90, -11, 58, -52, -19, 97, -73, 37, 22, 2, 93, -54, -26, -75, 108, 34, -99, -30, 110, -86, -24, -6, 80, 24, -65, -52, 47, 2, 11, -37, -54, 47, -41, -2, 19, 60, 4, 116, 99, -90, -28, -58, -45, -73, -69, 112, 90, -37, 73, 9, 34, -45, 34, -52, -30, -19, 41, -37, 82, 80, -26, 101, 54, -32, 77, -75, -26, 30, 112, -82, 39, -88, -41, -39, 62, 52, -54, 67, -80, 114, -47, -127, 0, 47, 86, -80, 103, 19},
+  {0, -68, 32, -72, 32, 7, 36, -29, -18, 64, 25, 36, -29, -54, 5, 75, 88, -20, -41, 89, -95, 20, 80, -86, 29, -38, -72, -14, -32, -25, 97, 61, -48, -23, 43, 68, -27, 14, -4, 61, -68, -9, -20, -27, 18, -72, 20, 25, -48, -106, 52, -47, 14, 0, 7, 70, -25, -39, 16, -50, -27, -13, -18, -66, -48, -39, 70, -13, -66, 68, -64, -59, 95, -23, -102, -79, -36, 55, 93, -39, -61, 18, -52, 50, 11, 54, 50, -14, 50, 98, 45, -11, -9, 73, -5, 36, 54, -97, -34, -55, 13, -25, 57, 98, -5, 45, 45, 18, -39, 55, 21, 41, -50, -9, -13, -63, 79, 5, 68, -57, 30, 127, -41, 59, 13, -63, 57, -39, 127, 45, -89, -18, 89, 91, -29, 43, -57, 38, -123, 5, -5, 86, 39, 54, 4, -50, -52, 4, -11, -9, 5, -75, -55, -4, -73, 7, -66, 43, 13, -70, -25, 54, 102, -29, 30, -43, -32, -39, 7, -16, 88, -59, -4, 38, 48, 70, 30, 4, 23, 111, 2, -47, -77, 61, -68, 79, 21, -43, -18, -57, 39, -48},
+  {-87, -87, -42, -72, 4, 97, -61, -78, -110, -59, -80, -30, -42, -123, 59, 8, -112, 6, -34, -25, -78, 51, -119, -87, 28, 4, 93, -47, -66, -80, 8, -108, -47, 28, 83, -42, -34, -70, -87, 15, 74, 74, -13, 28, -85, 6, -66, 106, -53, 72, -34, -95, -55, -85, -95, 25, 13, -15, 51, 38, 72, -91, 104, -89, -104, 21, -78, 34, -74, -61, -49, -36, -25, 30, 66, -6, 76, 34, -44, 55, -72, 83, -34, -127, 51, -38, -64, -114, 11, -21, 53, 83, 30, -15, 23, 55, 23, 4, 83, 114, -80, -59, 2, 15, 68, 38, 61, -74, -53, 11, 76, -61, -44, 89, -80, 49, -47, -8, -53, 13, 93, -66, 93, -106, -72, 91, 19, 0, 28, -47, -15, -36, -4, 78, 0, -49, -8, 40, 6, -57, -11, -28, -89, 11, -99, 123, -78, 87, 53, 21, 0, -93, -102, 89, -76, -13, 110, -68, 102, 78, 44, 23, 38, -87, 42, -28, -106, -64, 110, -95, 114, 66, 78, -53, -59, 95, 28, 78, 23, -55, -76, -114, 61, 42, 0, -38, 80, 93, 78, 4, 91, -116},
+  {-82, -20, -44, 74, -20, 69, 76, -24, -83, 38, 118, 22, -9, -22, 87, 25, -51, 24, 80, 94, 45, -67, 27, 7, 0, 98, -29, 58, 2, -85, -49, -7, 4, -16, -93, -85, -7, 33, 9, 49, -11, -74, -36, -69, -56, -18, 98, 87, -80, 18, 2, 73, 2, 80, -93, -62, 83, 114, -4, 58, -27, 36, 62, -64, -33, 22, 33, -65, 20, -60, 22, 45, 78, -94, 80, 36, 94, 62, 73, -93, 20, 24, -47, -31, 33, -18, -82, -94, -34, 98, 42, 73, 67, 80, -18, 71, -49, 34, -31, -40, -54, -93, 71, 42, -9, -67, -5, 0, 33, -98, -60, -5, -71, 64, -67, 16, 16, 7, 69, 76, -65, -56, 4, 20, 67, -53, -42, -13, 51, -98, -47, 82, 47, 91, -51, 67, -16, -98, 13, 53, 18, -116, 7, 56, -13, 94, -96, 0, 9, -4, 67, 65, 91, 112, -2, -45, 53, 4, -65, -38, -83, -34, -111, -24, 33, 73, -64, 89, 9, -9, 76, -62, 65, -64, 58, 22, 73, 56, 18, 111, 91, 40, -69, 71, 38, 127, -33, -56, -42, 38, -7, -40},
+  {58, -73, -60, 37, 25, 17, 0, 48, 25, -50, -15, -25, 54, -25, 37, 75, 8, 89, 0, 27, -64, 4, 33, 100, -6, 31, -35, 44, -54, -48, 77, -29, -4, 48, 100, -4, 92, 37, 83, 13, 33, -21, -23, -96, -58, 64, 31, 48, 100, 35, 81, -114, 21, -35, 48, -100, 8, -17, 0, 62, -6, 65, -46, -87, 46, 67, -15, -21, -71, -64, -38, -79, -29, 8, 6, 87, 4, 10, -42, 17, 2, -62, 62, 102, 77, 44, -64, -25, 29, -85, 52, -19, -77, 64, 92, -90, 89, 85, -35, -75, 52, 0, 90, -52, -65, -114, -83, -4, 92, 92, -44, -115, 92, -121, -48, -127, 2, 52, -8, -92, 40, -94, -89, -77, 33, 54, 71, 71, 40, 23, 106, -15, 62, -8, -46, -79, 75, -85, -40, 13, 46, -62, -79, 35, 35, 23, -19, -67, 89, -46, 98, -92, 48, 15, -69, -81, -71, -29, 6, -117, -35, 8, 2, -35, -52, 92, -69, -69, 50, -115, -81, 27, 54, -90, -54, -27, 123, 25, 15, 46, -38, -48, 52, 62, 79, -50, 0, 10, 98, -52, 52, -73},
+  {93, 71, -49, -95, -71, 56, 85, 4, -46, -30, 14, -37, -65, -28, -44, 42, -5, -41, 37, 26, -14, 34, 5, 93, 16, -51, 53, 30, 0, -34, 25, -49, -28, 0, 127, 23, -64, -39, 30, -92, 65, 23, -69, 67, -92, 69, 85, 44, -79, 95, 78, -55, 44, -86, -55, 32, 81, 88, 53, -72, 7, -23, -41, 48, 28, -56, -25, 39, 34, 67, -65, 101, -4, 86, 44, 102, 9, 0, -42, -26, -7, 62, 23, 56, 28, -19, -9, 71, 69, 0, -97, -39, -49, 93, -74, 69, -32, -30, -48, 11, -28, 69, 85, -58, -34, 35, 60, 56, -19, -76, 11, 7, -79, -25, 9, -28, -7, -95, -30, 51, 97, 55, 49, -41, 62, 41, -49, 41, -7, 74, -69, -81, -26, -49, -58, 83, -64, 83, 101, 74, 74, -88, 7, -26, -67, -108, -26, 76, 78, 0, 76, -23, 51, 81, 44, 46, -16, -42, 41, 0, 21, 0, -53, -26, -41, 49, 106, -60, -23, 42, -69, -12, -97, -35, 86, -49, -49, 92, -34, 32, -85, 2, -62, -74, -69, -19, -32, 72, 44, 4, 7, -12},
+  {-30, 61, 84, 95, 77, 63, -47, 16, -77, 72, -4, 72, 84, -127, -70, -20, -25, -82, -66, -14, -75, 36, -70, -73, 27, 59, -18, 7, -79, 25, -43, 23, -80, 29, 32, -16, 25, 25, -4, -14, 79, -47, 16, -7, -95, 57, 100, -16, 79, 66, -52, 77, 2, 98, 13, 27, 16, -39, 29, 39, -21, -36, 93, -13, -14, 72, -73, 70, 86, -80, 34, -55, -50, 52, 70, 34, 84, -64, -47, -43, -36, 79, -48, -63, -72, 18, 63, 75, -43, 48, 84, 82, -18, -54, -39, 16, 27, -80, 111, 50, -77, -7, -21, -104, -5, 98, 84, -84, 18, -50, 59, 72, -84, 120, 0, -41, 63, -2, 30, -80, -36, -68, -4, 34, 2, 36, 47, -91, 43, 70, -75, -9, 70, 38, 61, -84, 30, 88, 106, -66, 13, 21, -30, 47, -54, 95, -48, -91, -68, -55, 72, 50, -39, -50, 72, -77, -64, 5, 39, 57, -27, -68, 114, -41, 4, -45, 4, 0, -72, -48, -50, 20, 80, -18, -25, -47, 45, 29, -84, -93, -14, 27, -79, -20, 75, 30, 66, 52, -55, 66, 95, -5},
+  {109, 28, 99, 99, -42, -81, -38, -26, 77, -22, -65, 40, 71, 26, -56, -30, 48, 127, 79, 69, 0, -79, 87, -42, 87, 22, 16, -24, 83, -81, 10, -99, 36, 58, 22, 46, 4, 67, 97, 40, -89, 54, -50, -46, 42, 34, 0, -54, 2, -32, 18, 30, -16, 60, -52, -4, -54, -81, -81, 16, 60, 32, 52, -46, 121, -81, 115, 62, 30, 34, -99, 46, 101, 28, 30, -52, -101, 109, -20, 44, -75, 103, -99, -50, 73, 73, 83, -6, 4, -85, -22, -101, -38, 81, 123, -54, -28, 75, 8, -60, -77, 16, -62, -67, -38, -83, -48, 16, 89, -69, -79, 62, -6, 58, 6, -75, -105, 127, 65, 95, 91, 60, 71, 14, 8, -65, -69, 95, 105, -16, -38, -103, 85, 30, 20, 48, 32, -24, -107, 91, -8, 40, 26, 60, 2, -10, -32, -65, 81, -40, -99, 8, 52, 103, -18, -97, 56, -16, -36, 65, -24, 54, 67, 121, 54, 30, -48, 115, -16, 36, -30, -24, 16, 0, -44, -107, -46, -67, -65, -85, 34, -46, 105, 10, -69, 26, -40, 65, 71, -22, 56, -62},
+  {-15, 70, -98, 39, -17, 6, 40, -24, -37, 75, 29, -15, 79, 22, -70, -57, 40, 127, -75, 81, 0, -96, -92, 44, 31, -57, -68, -26, 55, 4, 26, 79, 22, -53, -70, -52, 92, -75, 44, 31, -50, 92, 81, -44, -48, 28, -61, 26, 44, 33, -7, 35, -94, 50, 83, -72, 63, 63, -64, -64, -44, -29, -87, -53, 64, -20, -11, 74, 4, -96, -9, 28, 2, -4, -26, 40, 44, -63, 64, 24, -17, -11, -44, 64, 42, 22, -55, -74, 31, 35, 99, 64, -40, -46, -33, 0, 55, 18, -50, -66, 26, 2, 75, -55, 52, -40, 40, -26, -99, 17, 13, 40, 52, 72, -17, 109, -59, -6, 15, 24, 77, 35, 42, -11, 17, 7, 70, 59, -85, -92, -2, 37, -13, -18, 83, -42, -17, -31, 0, 88, -15, 20, 31, 90, -81, 9, -50, -88, -90, 11, -15, -28, 40, 83, 17, -15, -88, 87, 2, 83, -72, 87, -52, 29, 87, -13, 44, 18, 29, -39, 6, -48, 57, 24, 53, -63, -55, -52, 61, 48, 52, -15, 75, 17, 85, -61, 35, -29, -53, -92, 28, -103},
+  {84, 57, 117, 2, 70, -90, 59, -90, -72, 4, 31, 23, 6, -27, -104, 4, -31, -92, 107, 102, -59, 33, 49, 121, -57, -4, 61, 84, 61, -74, -94, -51, -94, -55, 104, 55, 82, 21, 27, 74, -29, -76, 0, -92, -6, -66, 35, -37, 41, 68, 80, 41, 41, -49, -59, 72, 92, -63, -47, 66, 80, 16, -8, -21, 72, -35, -39, 12, 21, -78, 96, 41, 2, 51, 107, 88, -25, 43, -78, 53, -63, -23, -10, 49, 12, 90, -25, 72, -27, -119, 0, -18, -23, 86, -51, -23, 14, -29, 55, -20, 92, -18, -31, 33, -66, -35, -21, 68, 102, -20, -6, -23, 82, -45, -8, 41, -64, 18, -12, -29, 37, 41, 37, -104, -33, 63, -2, -80, -21, -39, -66, 63, 2, -92, 59, -33, 47, 51, -51, -88, 74, 90, 2, 74, -57, -59, 33, -49, -104, -20, 49, 39, -51, 16, 104, 68, -8, 12, -16, 37, -29, -96, -23, 45, -78, 12, -37, -21, 84, 82, 51, -39, 0, -27, 33, -20, 127, 53, -88, -70, -14, 76, 43, -66, 55, -72, -14, -74, 80, 57, -90, 39},
+  {-3, 24, -40, 57, 16, 0, 24, -24, 94, -78, 9, -23, 9, 80, 3, -57, -24, -52, 26, -30, 94, -43, -80, -68, 111, -5, 23, 92, -14, -80, -108, -23, 84, 2, 47, 0, -94, 84, -66, 50, 10, 77, 94, -77, 70, -17, 33, -28, 7, 31, -9, -31, -30, -71, -85, -5, 66, 9, 47, -59, 59, 33, 87, -75, 61, -14, 75, 45, 28, 90, 89, -7, -28, 43, 77, -3, 80, -49, -82, 64, 19, -40, 28, 73, 96, 125, -84, 10, -56, 30, 71, -16, -84, -10, -122, -73, 23, 80, 19, 10, -49, 96, 85, -56, -92, 7, -45, -85, 45, -19, 101, 56, 52, -92, 45, -49, -2, -33, -49, -2, 16, 0, 52, -75, -78, 37, -71, -59, 50, -54, -10, 56, 50, -10, 82, 17, -66, 70, 31, -43, 71, 5, -33, 7, -35, -113, -17, 38, -84, -66, -3, 0, 127, 73, -59, 2, -19, -77, -94, -101, -89, -61, 2, 5, 24, 19, 70, -3, -47, 40, -40, 19, -106, 31, 63, 42, -73, -26, -10, -43, -49, 120, 17, -24, -5, -47, 68, -5, -28, 47, 14, -9},
+  {-59, 32, -15, 23, -64, 95, 119, 28, -23, -110, 99, 70, 8, 21, 47, 13, 21, -21, 23, 72, -8, 6, 38, 72, -78, 74, -32, 104, -49, 8, -102, 4, -42, -70, -110, 68, -110, 74, -30, -110, -80, 17, 68, -112, -17, 97, 70, 97, 23, 59, -59, 44, -74, 76, -38, -40, -76, -13, -53, 89, 91, -28, 66, 38, -70, -38, -97, 30, -110, 19, 38, 34, -91, -57, 89, 0, 28, -38, 61, 32, -57, 38, -76, -44, 97, -34, 53, 68, -15, -80, 74, 116, 72, -64, 78, 23, -21, -87, 74, 85, 106, -25, -70, -40, -57, -36, 66, 42, -30, 4, -36, -108, -19, 17, 0, -72, 8, 30, -123, 76, 28, -19, 87, 8, 57, -11, 102, -2, 80, 59, -76, -23, 42, -53, -15, -55, 6, 8, -80, -19, 0, -127, -6, 53, -17, 121, 61, 38, 21, -76, -89, 34, 87, 42, -110, 104, -112, -51, 38, 64, 19, -51, -112, -123, -42, 13, -6, -114, -106, 32, 15, -112, -47, 28, 76, 40, -61, -11, 61, -74, 6, 80, -64, 61, -47, 17, -34, -44, -85, 93, -55, -23}
+};
+
+static const int32_t conv1d_119_int8_offset[128] = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+
+static const int32_t conv1d_119_int8_multiplier[128] = { 1089171197, 1142736994, 1160592259, 1196302790, 1107026463, 1232013321, 1089171197, 1232013321, 1392710711, 1160592259, 1339144915, 1232013321, 1089171197, 1142736994, 1357000180, 1089171197, 1178447525, 1160592259, 1142736994, 1178447525, 1374855446, 1214158056, 1339144915, 1178447525, 1464131773, 1303434383, 1071315932, 1035605401, 1053460666, 1731960756, 1267723852, 1267723852, 1071315932, 1214158056, 1142736994, 1071315932, 1374855446, 1178447525, 1232013321, 1481987039, 1339144915, 1196302790, 1392710711, 1214158056, 1196302790, 1178447525, 1285579118, 1178447525, 1535552835, 1285579118, 1196302790, 1321289649, 1517697570, 1464131773, 1321289649, 1142736994, 1357000180, 1017750135, 1089171197, 999894869, 1089171197, 1428421242, 1214158056, 1267723852, 1071315932, 1232013321, 1107026463, 1410565977, 1357000180, 1357000180, 1089171197, 1142736994, 1267723852, 1196302790, 1089171197, 1124881728, 1160592259, 1249868587, 1267723852, 1071315932, 1017750135, 1357000180, 1249868587, 1392710711, 1089171197, 1196302790, 1392710711, 1089171197, 1124881728, 1124881728, 1464131773, 1017750135, 1321289649, 1107026463, 1107026463, 1160592259, 1196302790, 1178447525, 1232013321, 1107026463, 1267723852, 1357000180, 1446276508, 1107026463, 1267723852, 1107026463, 1339144915, 1232013321, 1535552835, 1232013321, 1089171197, 1232013321, 1267723852, 1124881728, 1267723852, 1214158056, 1053460666, 1267723852, 1071315932, 1249868587, 1178447525, 1285579118, 1267723852, 1124881728, 1232013321, 1160592259, 1303434383, 1071315932 };
+
+const int8_weights_t conv1d_119_int8 = {
+  192, &conv1d_119_int8_kernel[0][0], conv1d_119_int8_offset, conv1d_119_int8_multiplier, 25,
+  31032, 21, 0, 131
+};
+
+#define DENSE_58_INT8
+
+const int16_t dense_58_bias[40] = {-8, 10, 14, 4, 4, 11, 13, 0, -2, -9, -4, 2, -9, -4, 0, 9, -8, 4, 9, 2, -5, 14, 7, 14, 4, -3, -1, 11, -6, 0, -10, 1, 14, 0, 0, -8, -8, -3, 1, -8}
+;
+
+static const int8_t dense_58_int8_kernel[40][128] = {
+  {49, 31, -50, 62, -23, 4, 48, -8, -75, -13, 91, -10, -50, 40, -7, -85, -45, -61, 44, 15, 38, -9, 127, -59, -102, -57, 68, 86, -71, -95, 6, 17, -54, 65, 31, -65, -25, 45, -84, 64, 35, -95, 21, 86, -14, -84, 116, 80, -46, 87, 87, -58, -21, -34, -74, 57, -9, -47, -70, 0, 115, -33, 56, 16, 14, -2, -50, 83, 75, -89, -94, 9, -29, 7, -43, 38, 64, -32, -79, -5, 66, -58, -70, 110, -28, 33, -25, -12, 96, -7, 44, -58, -77, -96, 40, 17, -44, -25, 4, -65, 38, 20, 18, 24, -48, 82, -53, 14, -29, 23, 14, 62, -56, 55, -83, -53, -36, 51, 36, 27, 36, 84, 2, -94, 44, -74, -50, 72},
+  {-82, 94, 69, -31, 100, -39, 21, -80, -9, 55, -58, 17, 67, 92, -57, 25, 0, 92, -51, -18, -3, 13, 103, 92, -70, -1, -69, 64, -51, 35, 105, -47, -53, 37, 10, 106, -6, 48, 48, -18, -100, -3, 6, 88, 18, -69, -27, -29, -31, -82, -42, 38, 85, 25, -99, -7, 79, -33, 20, -35, 76, -30, -77, 77, 22, -23, 83, 35, -27, -81, 84, 9, 67, 25, 57, 38, 79, 18, 24, 18, 13, -46, -89, 66, -99, 24, 107, 61, 92, -47, 53, -31, 122, -48, 89, -61, 17, -69, 65, -39, -23, 85, -2, 107, 39, -7, 94, -6, -87, -76, -15, 127, -74, -88, 54, 36, 42, -111, 22, -25, -33, -96, 58, 48, -53, 20, 89, 104},
+  {-69, 15, 127, 81, 76, 29, -92, 85, -54, 80, 66, -14, -94, -13, -29, 109, -65, -29, 68, 53, 94, -6, 95, -72, -78, -117, -87, 87, 8, 103, 39, -114, -17, -56, -2, -24, 27, 94, 69, -63, 87, 68, -3, 79, -94, 74, 23, -24, -41, -58, -84, -39, 46, -38, -23, -64, 22, 50, -108, 124, -85, 19, -38, -15, -49, -13, 72, -65, 23, 2, 54, -59, -50, -42, -88, -32, 46, -74, 45, 89, 39, 14, 24, 16, -92, -13, 31, -62, -15, -97, 24, -51, -85, 43, 14, 65, -71, -73, -47, 72, -5, -17, -53, 25, -85, -88, 55, 64, -21, 98, -62, -125, -2, 18, 55, 46, -23, -48, 73, 13, -80, 106, -35, 72, -64, 53, 108, -45},
+  {-78, -9, 17, -46, 41, -55, -92, 33, 86, -86, -58, 55, -68, 27, 94, 103, 79, -37, -68, -3, 94, -1, 38, -88, -103, 97, -14, 49, 6, 25, -29, 105, -23, -24, -108, 77, 45, -84, 61, 59, 7, -110, -117, 97, -102, -86, 127, 63, 78, -2, -114, -5, 80, -56, -51, 81, 19, 59, 105, 74, -51, 85, 17, -33, -43, 24, 61, 23, -101, 14, 69, -117, -50, 37, -102, -24, -27, -46, 55, -40, -94, -16, 3, -76, -8, -22, 90, -37, -81, 7, 90, 16, 34, 8, -5, -5, 66, -109, -71, 47, 29, 106, 84, -89, 35, 56, -18, -97, 102, 40, -35, -41, 90, 71, -21, 43, 30, 64, 24, 27, 42, -37, -22, 96, 125, -108, -85, -38},
+  {-29, -9, -61, -62, 65, -127, 20, -17, -76, -35, 80, 75, -53, -84, -82, -86, -69, 60, -57, 96, -77, -57, -16, -107, 45, -93, 31, -6, -29, -70, -46, 113, -86, 5, -92, 49, 76, -21, 29, 109, 44, -27, -51, 82, 55, 45, 113, -34, 45, 2, -89, 101, 54, 97, 63, -94, 18, 79, -44, 61, 7, 44, -52, 100, 78, 85, -76, 45, -45, -10, 64, -67, 4, 15, 10, 49, -53, 47, -45, -64, 45, -96, -73, 80, 59, 57, 31, -67, 9, -19, -105, -38, 10, 31, 39, -76, 11, -37, -30, 5, -92, 32, -10, -107, -16, 20, 66, -11, -75, 78, -36, 44, 74, 30, 12, -44, -89, 69, -51, 63, 51, 79, -47, -10, 16, -83, -50, -23},
+  {-27, -68, -94, 71, -15, -78, -26, -12, 120, 41, 25, 98, -96, 99, -73, -85, -42, -7, 33, 83, 68, 62, -127, 78, 65, 123, 78, 20, -58, 73, -93, 64, 38, 105, 40, -4, 105, -93, 18, 14, -33, -87, -75, 87, -33, 44, -89, -78, -4, -41, -71, -29, -105, -74, -111, 9, 119, -100, 82, -67, 22, -119, 13, 24, 46, -66, -113, 59, -67, 36, -74, 92, 18, 119, -41, 80, 48, -48, -72, -65, -44, -66, 78, 49, 105, 87, -19, -13, -62, 74, 47, 71, 123, -24, 115, 26, 36, 20, -68, 55, -87, 74, -18, -49, 22, -61, 42, 68, 78, -21, 42, 44, 102, 2, 14, 56, -33, -88, -5, 5, 42, -88, 82, -40, 108, -62, -11, -6},
+  {44, -75, -81, 89, -34, -38, -22, -31, 4, 21, -100, -93, -67, -85, 72, -62, 29, -95, 120, -120, 103, 2, -29, -91, 48, 38, -9, -36, -35, -14, 109, 49, 7, -106, 107, 14, 47, 49, 36, 41, 8, 16, -79, 78, -76, -98, -73, -108, 12, 59, -94, -48, 53, 89, 4, -59, 85, -39, -79, -59, 51, 73, -2, 64, -71, 89, -33, 100, -125, 52, 103, -88, 78, -83, -127, -31, -54, -11, 108, 65, 53, 33, 116, -69, -51, 61, 64, -48, -91, 81, 2, -76, 64, -56, 14, 78, -94, -48, 4, 95, 95, 6, 103, -111, 83, 20, 27, 81, -93, -88, 108, 66, 58, -54, -51, -39, -38, -75, -45, 69, 15, -42, 32, 105, -81, 14, -24, 22},
+  {70, -9, 104, -50, 117, -27, 17, 95, -33, 85, 28, 112, -74, 74, -90, 95, 44, -42, -112, -89, 114, -56, -33, -29, 75, -32, -30, 13, 93, 88, 29, -10, 121, 75, 47, -90, -53, 22, 30, -47, -80, 81, -22, -122, -38, 11, 112, -10, 98, -61, 70, 110, -25, -58, -75, 17, 25, 100, 65, 29, -67, 41, -30, 69, 75, -66, -57, 89, 38, 19, -20, -66, 10, 76, -1, 0, 100, 15, -84, -42, -94, -127, -100, -98, 14, 1, 15, -55, -114, -99, -39, -13, -108, -117, 19, -69, 34, -71, -75, -118, -15, 29, -32, -4, -113, -30, -116, -34, -100, 93, -81, -88, -23, -13, 108, 30, -76, 88, -55, -75, -105, -24, 38, 88, -38, 67, 1, -3},
+  {-1, 79, -117, 12, 96, -23, 39, -78, -117, 99, 47, 91, -19, 42, 30, 95, 58, -82, -5, 70, 23, -60, -28, -31, 37, 93, 88, -64, -60, -66, -61, 109, -72, -12, 58, -99, 101, -91, -59, 91, 68, -22, -24, 92, 41, 86, 71, -106, -34, -3, -51, 35, 46, -62, -83, 51, -15, 65, 7, -5, -101, -36, 2, 37, -25, -33, 67, -41, 107, -45, 117, 57, 19, 69, -90, 33, -80, -25, 67, -97, -67, -46, -23, -68, -89, -67, -41, 30, -43, -74, -42, -24, -58, 35, -42, -103, 35, 91, -26, 73, 48, -19, -36, 65, 81, 90, -25, 83, 91, 31, 5, -31, 66, 10, 77, -74, 92, 127, 19, -64, -13, -113, -74, 7, -88, -19, -9, -34},
+  {-16, -20, -81, -17, -84, 112, 20, 26, 37, 73, 73, 39, 94, -26, 101, -53, -44, 83, 99, 52, -115, -15, 63, 28, -76, 95, 100, -18, 21, -111, -21, -21, 48, -105, -99, -76, 10, 83, 101, 11, 47, -99, 21, -49, -57, -53, 7, -54, 43, -84, 116, 5, -54, -97, -6, 113, 23, -23, -115, 74, -22, 88, 72, 86, 52, 83, -31, -21, 4, -11, -73, 20, 62, 1, -84, 85, 99, 109, -7, 76, -52, -47, -91, 2, 49, -10, 26, -14, -91, 106, -12, -16, -63, 9, -105, 35, -115, 89, -95, 102, -110, 4, 68, -107, -49, -51, 86, -17, -88, 22, 118, -70, -65, -37, 26, 64, 62, -127, 17, -42, 43, 69, 107, 72, 84, 55, 7, -25},
+  {52, 65, -87, 28, 10, 105, 67, -80, 41, -14, 22, 22, -33, -10, -54, -100, -105, 28, -37, 0, 10, 98, -93, -52, 1, -73, -86, -108, 50, -31, 48, -62, -31, -38, -43, -37, -56, 91, 41, -29, -127, 94, -81, 91, 7, 91, 68, 82, -82, 3, 40, -86, -56, -65, 81, -33, -81, -45, -81, 18, -102, 67, 60, 57, 72, -92, -98, -18, 41, -6, -69, -36, 70, 89, -56, 40, 35, 17, -16, -60, 18, -104, 79, -37, 40, -43, 102, -12, 34, 96, -90, -80, 24, 105, -35, -77, 4, -1, -79, 0, -30, -85, 33, -47, 31, 29, -68, 72, 73, 15, -20, 16, 50, 37, 92, 88, 1, -1, 19, -82, 31, -92, -90, -79, 71, 49, 37, -37},
+  {-92, -34, 87, 32, -81, -14, 72, 88, 5, -47, 42, -95, 80, -60, 18, 12, -24, 56, 5, 68, 112, -38, -34, -68, 14, 28, 80, -25, 12, 81, 39, 107, -86, -9, -53, -49, -82, 83, -2, -72, -9, 88, 102, -108, 13, 75, -116, 34, -33, 60, -112, -106, -100, 6, 103, -112, -39, -67, -62, 125, 116, 26, 106, -98, -45, -67, 14, -53, -103, 66, 13, 60, -127, -62, -83, 103, -33, -72, 35, -51, 44, -53, 115, 81, 105, -88, -67, -59, -13, -29, 105, 66, -112, 4, 9, 24, -54, -116, -46, -82, -24, -11, -92, 82, -62, 44, -22, -108, -58, 56, 14, 4, 6, 67, 7, -100, 24, 67, -56, 46, 0, -27, 35, -58, 0, 55, -85, -45},
+  {-62, 90, 72, -28, 58, -47, 42, -61, -80, 30, -5, 24, 79, 40, 98, 83, 87, -5, 51, 57, 0, 91, 35, 80, 16, 46, 36, 32, -111, 51, 73, -124, -44, 10, -64, -110, -7, 62, -47, -59, 60, -38, 66, 107, 79, -88, 95, 127, -82, 17, -94, 31, 97, 83, 104, -66, -14, 58, -91, -91, 24, 104, 53, 21, 40, -37, 59, -105, 50, 42, 60, 69, -46, -54, -60, 21, -10, -55, 51, -1, -15, 33, 91, 16, -52, 32, -15, -111, 68, -23, 61, 50, 37, 74, 61, -117, -53, -43, -84, 21, 83, -2, 79, -95, -104, 29, -99, 74, -27, -46, -61, -122, -73, -83, 91, 38, -111, 33, 22, 46, -24, 85, 3, 28, 68, 79, 50, 31},
+  {57, 69, -55, -7, -25, 62, 71, -2, -13, 100, -35, -19, -30, 41, -68, 23, -51, 54, -42, -22, 20, -66, 0, -28, 24, 116, -81, -111, 7, 0, 69, 117, 74, -45, -8, -57, 0, 20, -66, 94, 67, 30, -96, 32, -44, -5, -99, 51, -71, -16, -104, -65, -68, -106, -11, -83, -115, -103, -56, -43, -83, -81, 93, 79, 99, -28, 16, 73, -23, -62, 99, 19, -47, 126, 34, 62, -127, 25, 35, 23, -11, -99, 67, -90, 93, 91, 85, -94, -9, -92, -78, 90, -47, 86, 49, -96, -14, 38, 99, 74, -19, -77, -8, -3, -73, -27, -100, 88, -92, 11, 24, 99, -55, 106, 91, 64, -84, 27, -23, -97, 56, -47, -102, -18, -100, 1, -109, 24},
+  {6, 12, 104, -84, -34, 34, 120, 56, 73, 2, 65, -43, 79, 113, 105, 18, -56, 66, 110, 10, -71, 60, 35, 56, -120, -75, -73, 77, -86, 36, 84, -78, 69, -64, -16, 97, 24, -91, 13, 54, -18, -86, 80, 40, -110, 14, 101, 55, 68, 69, 19, 42, -67, 17, 89, 14, -87, -2, -34, 0, -52, 101, 37, 54, -98, 53, 37, -69, -44, -85, -20, -8, -41, -14, -64, 35, -40, 0, 11, -47, -83, -37, 120, 4, 5, 75, -71, -32, -53, -41, 29, -78, 117, -90, -18, -52, -1, 34, 127, 47, -48, -116, -25, -31, -11, -50, -34, -58, -18, -4, -31, 35, 98, 8, -53, 72, 10, 97, -30, 96, 42, -26, 12, 29, -116, -1, 5, -83},
+  {36, -42, -84, -81, 94, -12, -23, 34, 103, -90, 20, 119, 81, 14, 126, 77, -68, 45, 26, 58, 26, 80, -88, -83, 82, 36, 68, 28, -99, -85, 11, -28, 68, -99, -20, 88, 18, -97, -109, -96, 44, 20, -26, -20, 106, -120, -7, 1, -36, -58, -78, 78, 5, 51, -80, 78, -14, -17, 110, 40, -58, 66, 49, -33, 18, 126, -25, 99, 102, -18, 18, -95, 36, 34, 95, 31, 61, 57, -109, 106, -49, -65, 15, -72, 4, -99, 51, 112, -7, 69, -84, -110, 45, -43, -84, 120, 36, -81, -66, -94, 103, -80, 40, -30, -45, -64, 77, -127, 91, 63, 2, 12, -4, -14, -102, -31, -7, 96, 83, 61, -109, -44, -66, 103, 12, 32, -61, -42},
+  {85, 52, 71, -81, -56, 72, 98, 73, 49, 32, -103, 84, -42, 44, 90, -31, -47, -75, -31, 32, -46, 43, 62, -115, -7, -24, 5, 6, -7, -32, 61, 64, 65, -48, 60, 114, 108, 55, -67, 6, 68, -114, 113, -61, -120, 96, 11, -99, -104, -117, 79, -64, 20, -95, -18, -59, -83, 32, -79, 29, -26, -36, 58, -115, -8, 65, 110, -58, 77, 107, -108, 52, 43, -114, 120, 4, -4, 0, 32, -38, 104, 32, 93, -38, 5, -83, -25, 59, -12, 99, -105, -4, -44, -81, -31, 113, -36, 72, -90, 59, 93, -127, 80, -44, -69, 92, 81, 54, -20, 89, -74, -64, 79, -86, 83, 98, 105, -62, 95, -80, 18, 52, 85, -59, -20, 20, 99, 92},
+  {-98, 0, 72, -52, -100, -37, -31, -31, -68, -117, 115, -60, 16, -52, 39, -24, -66, -83, 72, -68, 113, -113, 60, -111, -56, -27, -51, -101, -37, -101, 110, 41, -121, -7, -95, 60, -126, -75, -27, 54, 40, -21, -73, 50, -101, -27, 86, 105, -56, 29, -75, 86, -77, -36, 11, -22, 116, 41, -98, -78, 103, 113, 2, 31, -59, -71, 82, 112, 11, 34, 85, 21, -81, -118, -5, 40, 27, 1, 112, 112, -2, -93, -60, 21, 95, 91, -97, -24, 5, 62, -102, 34, 45, 64, 85, -100, 101, -103, -55, 1, -30, -21, -115, 64, 66, 61, -21, -46, -85, 126, 127, -75, -34, -67, 113, -81, -17, 20, 112, 37, -106, 80, 49, -60, -77, -41, -14, -40},
+  {-42, -126, 98, 83, -7, -35, -50, 119, 42, 40, 95, 98, -66, 65, -28, 15, 16, 21, -3, 15, 85, -20, -12, 76, 91, 104, 30, -25, -18, 127, 32, -13, -51, -8, -40, -58, 97, -79, -67, -62, -12, 30, -33, 31, 88, -24, 27, -113, -48, 58, -31, 109, 52, 23, 100, -3, 88, 52, -91, 16, -59, 111, -1, -8, 53, 97, 31, -12, 60, 84, 50, 40, -28, 17, 73, 48, 85, -70, -67, 69, -103, -57, -33, -82, -9, 5, 20, 88, 121, 54, 50, 30, 47, 58, -50, -58, 85, 75, 110, -99, 61, 76, 98, -89, 74, 28, -12, 66, -100, -55, -104, -29, -65, 74, 43, 75, 58, -35, -114, 100, 0, 113, 81, -107, 42, 15, 64, 50},
+  {23, -78, -11, -63, -13, -32, -74, 127, 18, -26, 16, 45, 34, -56, -85, -62, 79, 33, 79, 39, -25, 72, -24, 20, -87, 28, -89, -22, -30, 81, 91, -68, 45, -67, -92, -55, 67, 74, -34, -58, -101, -78, 22, 4, 90, 70, 46, 0, 66, 36, 35, -83, 31, -48, -6, -29, 61, 42, -80, 92, 91, 97, -47, -38, 35, 75, -39, -7, -64, 40, -27, 15, -79, -13, -65, 35, -16, 71, 47, -59, -78, -80, 80, -68, -39, -6, 62, -51, 70, 60, 38, 83, -62, 77, 77, 60, -1, 77, -70, 12, 92, -15, -9, 19, 11, -88, -54, 11, -61, -88, 4, -41, 36, 13, -65, 68, -79, -37, 9, 16, -28, 83, 25, 83, 85, -22, -39, -25},
+  {70, 21, -12, 91, 18, -19, -16, 21, -48, -4, -71, 87, -43, 37, -71, -45, -44, 75, -8, 111, 34, 125, 81, 1, -20, -60, -18, -2, -24, -21, -26, -25, 81, 108, 106, 24, 54, -27, -17, -8, 27, 78, 107, -62, -89, 72, 60, 43, 9, 51, 66, -43, -54, -56, -30, -88, -37, -13, 48, 108, -33, 91, 4, -55, -64, -20, 103, -17, -57, -99, -46, 66, 89, 103, 99, 99, 72, 7, 57, 48, 38, -30, 106, -27, -88, 92, 12, 22, -34, -44, -102, 72, -54, -39, 106, 28, -10, -45, -64, 17, -92, -35, 34, 20, -17, -46, -101, 25, 105, -1, -65, -43, -114, -80, 47, 16, -55, 106, 127, 46, 100, -45, 61, -16, 57, -2, 15, -96},
+  {-30, -38, 43, 38, -69, 114, -52, 33, 55, -39, -28, -31, 4, 63, 5, -107, -74, -108, 8, -9, -65, -79, -36, 30, 8, 50, 21, -87, -34, -5, 13, -73, 33, 43, 122, 49, 5, 10, 65, 5, 77, 52, -69, -63, 49, 11, 26, 38, 77, 114, -6, 119, -127, -18, -82, -58, 108, 107, -111, 79, -97, -60, -47, 65, -19, 70, -64, -94, 4, 23, -18, -103, -10, -89, -103, 45, -59, -87, 97, 6, 70, -13, -55, -45, -111, -111, 67, 118, 3, -15, 58, 31, -23, -1, 41, -9, 59, -43, 93, -33, 111, 96, -103, -20, -114, 59, 6, 52, -16, -91, -4, 19, 11, 47, 78, 20, -5, 30, 49, 59, -74, 94, -86, -117, 13, 6, 93, -59},
+  {-67, -23, -50, -100, 72, 104, -108, -60, -13, -2, -111, 34, 67, 9, 37, 57, -114, 78, -56, -30, -18, 73, 16, 0, -22, -79, -55, 60, 2, -36, 28, 38, -68, 72, 24, 3, 117, 90, 28, 2, 53, -65, -43, 101, -37, -27, 0, -122, 3, 15, 38, -56, -58, 60, -31, -42, -37, -78, 86, -91, -24, 8, -94, -79, -64, 41, 68, 51, -27, 12, 65, 104, 37, 71, -34, -7, -59, -74, 11, 12, 53, -7, 36, -122, -38, 39, -99, 64, -3, -97, 57, 61, -2, -50, -22, -8, 44, -1, 0, -28, 30, 12, 81, -26, -27, 83, -10, -60, 114, -114, 60, -28, 44, -3, 4, 72, -31, -26, -28, 5, 27, -99, -94, 77, 127, -90, -4, -108},
+  {23, -73, -96, -99, 103, -122, 101, 99, -41, 91, 7, 30, -49, -30, 43, 106, 122, 40, -127, -77, -34, -86, 105, -16, 105, 54, -37, -3, -118, -75, 93, -62, 80, 73, 93, 63, -68, -77, 57, -103, -30, -55, -105, 76, 100, 70, 100, 22, 54, 20, -112, -65, 16, 63, -28, -19, 22, 9, 107, -98, -105, -63, 50, 30, -47, 56, -56, -70, 15, 16, -80, -94, -24, -86, -30, 86, 115, 26, 17, -80, 14, -117, -33, 44, 58, -83, 50, 16, 20, 29, -54, 100, -63, 93, 24, -40, 66, -70, 38, -115, -7, 120, 0, -68, 77, -111, 97, -104, 7, 91, -43, 79, -91, 68, -43, -65, 41, -47, 50, 58, 78, -76, 75, -26, -96, 108, -115, -63},
+  {55, -34, 21, -33, 95, 28, -92, 90, -92, 106, -29, 5, 17, -118, -18, 12, 87, -61, -77, -61, -20, 90, 48, 114, -24, 55, -106, 46, 96, -88, 48, 88, -7, 90, 5, -100, 105, -100, 57, 122, 107, -78, -42, -78, -48, 67, -96, 0, -100, -73, 15, -66, 89, -87, 57, 60, -84, -87, -85, -79, 33, -7, -40, -27, -96, 57, 100, 111, 26, -62, 89, 24, -94, -5, -71, -7, 35, 12, 66, 39, 2, 23, 28, -106, -115, -82, 82, -101, -22, 44, -32, 45, 26, 84, 110, -127, 72, 6, 33, -48, -70, 32, 39, -44, 74, -20, -59, -11, -55, 43, 12, 24, -12, 88, 22, -37, -33, 120, 112, 104, -57, -28, -120, 100, -118, 88, -74, -81},
+  {2, -58, -49, -109, -16, -86, 41, 88, 33, -7, 15, 61, 94, 64, 40, -45, -14, -61, -79, -47, 74, 80, 87, -85, -19, -42, -100, 118, 29, -86, -15, -127, 82, -30, 39, 24, -21, -30, 30, -109, -50, -41, -109, 42, 51, -51, -22, 79, 88, -94, -90, -100, -108, -17, 48, 92, 93, 9, 10, -94, 23, -3, -64, -73, -41, 3, 100, -112, -21, 40, -80, 70, -92, 43, 16, 68, 18, 21, -65, 56, -10, -94, -22, 93, 77, 71, 43, -95, -45, 71, -23, 13, 2, 62, -50, 56, -65, -8, 30, -79, -82, 55, -29, 85, -98, -82, -77, -27, 112, -71, -109, 69, 85, -61, -14, 15, 95, -31, 42, -40, -29, -8, 76, 69, 13, -88, 51, 54},
+  {45, -1, 89, -58, 89, -17, -55, 74, -87, 25, 14, 30, -65, 0, -62, -58, 27, 37, 94, -50, 31, -18, 54, 16, -73, -82, 32, 3, 43, 108, -29, -49, 5, -13, -6, 23, -26, -46, -54, -30, -9, 86, -82, -98, -51, -119, 33, -1, 17, 50, 38, -76, -43, 77, 105, 40, 69, -79, -50, -93, -3, -37, 35, -79, 42, -80, 22, 80, 37, -48, -37, 77, 57, -7, -94, 2, 109, -114, -86, 5, -111, -9, -89, -15, 35, -103, -15, -78, -40, 127, 94, 72, -48, 68, -17, 31, -34, -95, -21, 10, 110, 94, 120, 103, -90, -5, 19, -25, 43, 22, -100, -46, -17, -9, -98, -49, -1, 106, -63, 40, 33, -14, 104, -86, 78, -18, 0, 112},
+  {24, 0, 61, 8, 112, 69, 58, 11, -37, 91, 110, 47, -121, 89, 24, 88, 72, -79, 42, 104, -17, -53, 95, 61, -112, 94, -20, -71, 39, 51, -102, 4, -102, 47, -109, -41, -65, 67, -10, -127, 28, -18, -34, -43, -1, 27, 72, -85, -25, 34, -89, 8, 3, -107, 36, -124, 5, -71, -67, -23, 109, -23, 27, -6, 98, -80, -1, 114, -95, -100, 90, 88, 103, -67, -8, 110, 81, -28, 77, 110, 34, 28, -63, -112, -81, -118, 99, 99, 52, -46, 0, -113, -10, 51, 6, -79, -63, 39, 23, -114, 0, -62, 39, 42, -72, -6, -25, -24, -1, -114, -33, 69, 34, 50, -79, -56, -44, -39, 112, -23, 58, 52, -104, -24, -22, 89, 86, -57},
+  {90, 26, -118, -77, 46, 50, -62, -83, -39, 30, 31, 46, 5, 50, -34, 37, 97, -36, -95, -65, -12, 60, 98, -73, 57, 78, -4, 120, 50, -25, 103, -107, 67, 75, -68, 31, -95, -72, -6, 123, -46, 93, 110, -56, -66, -50, -87, 12, 41, 5, -17, -6, 34, -47, 42, 117, -118, 54, -118, 34, 80, 52, -123, -55, 20, -95, -86, -80, 68, -92, -117, -110, 22, -17, 0, 111, 19, -36, 40, -121, 19, 20, -16, 88, -87, 112, -26, -105, -15, 37, -123, -10, -52, 68, 86, -29, 93, 30, -2, -72, -120, -110, 66, 60, -30, 97, 71, -25, -57, 7, -113, -127, -127, 86, -41, -46, 9, 35, 70, -24, 83, 57, -102, 25, -97, -49, -27, 107},
+  {18, -42, 62, 89, -99, -77, 21, -67, 0, -54, -90, 40, 88, -35, -66, -83, 0, 43, 24, -55, -123, 67, -6, 40, 28, -65, 37, 26, -46, 81, 18, 68, -95, -35, -98, -22, 66, -23, 112, -33, -66, -48, 82, -24, 89, -42, -89, -18, -115, -67, 6, -28, -65, -121, 9, -64, -62, -50, 26, -39, -96, 104, -5, 50, 51, -82, 26, 10, 45, 32, 17, 122, -56, 33, -99, -54, 127, 4, -83, 111, 90, -83, -43, 89, -21, -106, -44, 106, 106, -45, 57, 51, -29, -99, -65, -2, -89, 123, 51, -84, 26, -7, -83, 34, 72, -26, 1, 60, 5, -68, 11, -67, 53, -111, 43, 60, 56, -16, 15, 103, 5, 103, 72, -118, 55, 42, 67, -33},
+  {92, 45, -48, 93, -59, 80, -69, 84, 62, 27, 62, -113, -76, -57, -62, -36, -72, 6, 43, -51, -52, -6, 59, -83, 77, 23, 10, 58, 106, 12, 33, 88, -61, -14, 83, 49, 74, -80, -92, -58, 100, 63, 74, 33, 21, -96, -84, 28, -121, 63, 70, -120, 58, -97, 28, 60, -96, -9, 38, -16, 18, -96, 53, -35, -101, -3, -44, -114, 6, 68, -45, 98, -37, 94, -84, -50, 22, -26, 99, 44, 13, 36, -12, 14, 22, 79, 27, -44, -90, 57, 0, -46, -75, -90, 22, 74, -85, 0, -95, -52, 20, -88, -23, 107, 86, 33, -59, 72, 78, 26, -106, 99, -37, -83, -50, 50, 69, 4, -16, -72, -81, -50, -11, 77, -44, 12, 127, 102},
+  {-5, -50, 127, 40, 67, 7, 2, 59, 41, -110, 60, 77, 32, 34, -57, 20, 82, -49, 12, -39, -49, -66, -32, 41, -28, 72, 53, -46, 12, 51, 23, -2, -58, 0, 47, -52, -76, 60, -118, -104, -101, 90, 26, -94, 26, 86, -14, 14, 37, 48, 55, 116, 101, -32, -92, -15, -32, 24, 0, -87, 54, -1, -31, -9, -11, 92, -42, 88, -61, 19, 62, 24, 11, -93, 0, -81, 35, -15, -30, 4, -16, -20, 81, 30, -74, 27, -64, 84, -34, 30, 101, 29, -91, -34, 52, -11, 8, 62, 118, -35, -3, 102, -87, 15, 54, -79, 39, -57, -90, -61, 65, -84, 18, -66, 30, 98, 0, 64, 9, 19, -48, 36, -78, -34, 56, -26, -56, 76},
+  {60, -21, -48, 26, -22, -24, -28, -7, -14, -26, 89, -81, -76, -105, 55, 78, -36, -69, 111, -92, 69, -10, -36, 54, 45, 82, -22, 1, -73, -59, 90, -94, 9, -30, 10, 7, -72, -62, -12, -27, -76, -78, -31, -10, 34, 81, -75, 43, 52, 59, 40, -53, -99, 43, 92, -39, 5, 49, -20, -25, 37, 10, -24, -58, -33, 105, -69, 104, -15, -30, 36, -14, -101, -69, -127, 68, 34, 84, 56, -18, 97, -80, -29, -11, -55, 81, -15, 82, -34, -76, 2, -43, 106, 89, 100, 62, -71, -8, 18, 81, -36, -3, -3, -105, 101, -27, -26, -13, -67, -101, -22, 25, 54, -94, -78, 37, -23, -51, 87, -99, -7, 51, 60, -103, -76, 16, -73, 34},
+  {-101, -42, -31, 107, 84, 48, 82, 13, -67, 13, -3, -1, -35, 103, 31, -36, -31, 6, 17, -83, -78, 61, 89, -80, 48, -69, 16, 94, 27, 60, -3, 61, 72, 91, -29, 39, -99, -83, 67, -20, -7, 2, -89, 36, -87, -63, -74, -15, 37, 65, 65, 80, 65, 112, -79, -52, -78, 92, 101, -3, -33, -7, 88, -56, -66, -78, 34, 35, -106, 27, -74, 46, -90, -91, 22, 11, -66, -55, 62, -107, -103, 92, -15, -6, 70, 42, -70, -63, -84, 67, 46, 33, 13, -63, -37, 93, -45, -19, -101, 123, 61, 127, -107, -40, -57, -54, -36, -101, -83, 81, 0, -8, 2, -49, 1, -63, -96, 101, -109, -97, -44, 97, 57, 26, 94, -71, -43, -18},
+  {-35, 24, -86, -22, 39, 100, 28, -63, 75, 35, -34, 35, 28, 117, 90, -54, -23, 0, 92, -103, 110, 45, 39, -56, -34, -127, 109, -7, 36, -27, -69, 1, 30, -81, -67, -117, -17, -77, 22, 64, 10, -92, 87, -115, 75, 99, 79, 121, -85, 41, -60, -23, 80, -42, 100, 104, 48, -4, -57, 7, 96, 54, 37, -51, 62, 103, -108, 19, -104, 48, -71, -85, 70, 22, -67, 41, -93, -106, -4, 92, -87, 37, 88, 39, 82, 74, 0, -63, 69, 52, 67, 51, -108, 25, -88, -11, 54, 45, -56, 39, 10, 18, -12, 54, -127, 45, 108, 53, 0, -85, 105, -34, -87, 85, -39, -88, -123, -63, -22, 29, -68, 23, 12, -69, 36, -27, 17, 80},
+  {-97, 43, 13, 3, 32, -29, 9, 1, 72, -26, -26, -62, -51, -58, -100, 39, -52, 41, 64, -98, -77, 113, -3, 81, -49, 21, 0, -53, -80, 79, -59, -79, 28, 31, 52, 16, -86, 72, -50, -45, -44, 84, -15, 53, 96, -25, 41, 63, 77, 17, 83, -18, -36, 77, -26, -32, -46, -46, -4, -55, -33, -94, 16, -75, 104, 4, 11, -18, -75, -89, 17, -127, -25, 111, 66, 25, -116, 100, 47, -66, 47, -74, 107, -88, -57, 106, 50, -96, 63, 57, 13, -41, 0, 41, 62, -44, 64, 70, -78, 0, -5, 47, 39, -38, 70, 44, -64, -59, -82, -18, -63, 54, 13, -36, -35, 59, -60, -2, 68, -80, -5, 65, 20, -54, -29, 59, -3, -42},
+  {106, 43, 33, 100, -1, 23, -52, -15, -99, -89, 22, 91, 73, -30, -110, -115, 2, 96, 59, 92, 1, 127, 51, 46, -15, 25, 110, 53, -39, 118, -37, -78, -102, 99, 5, 12, 48, 104, -101, -95, 41, -79, -89, -125, -83, 32, -32, 21, 2, -55, 89, 12, 123, 80, 111, 76, -54, 30, -7, 105, 6, -63, -2, -11, 75, 32, 88, -99, 125, 9, 54, -15, -31, 6, 65, 22, 68, 9, 2, 104, 32, -73, 38, -65, -49, 70, -17, -9, 39, 46, -64, -39, -101, -95, 90, -48, -97, -41, 2, 68, 72, -55, -65, -90, -49, -6, 21, 1, -91, 116, 95, 30, 89, -12, -88, 38, 37, -80, -72, -112, 14, 104, 96, 85, 42, 2, -22, -94},
+  {-38, -86, -43, -85, 48, -87, -81, -17, 42, -58, -7, 30, -86, -26, 33, -53, -116, 63, 104, 103, -25, -23, -3, -105, -23, 90, -82, -61, -39, -43, 80, -78, -56, -71, -68, 78, 42, 85, 94, 79, -65, 41, -17, 43, -110, 9, -15, 23, 47, -98, -71, 100, 72, -14, -85, 93, 15, 13, 109, -110, 87, -9, 86, -24, 68, 88, 0, -58, -46, 5, -68, 82, -53, -22, -24, 63, -66, 72, 63, 24, 79, 10, -8, -105, 37, 92, 41, -62, -50, 18, -103, -9, -94, 96, 2, -29, 22, -6, -51, 33, 54, -50, -76, 19, 2, 64, 14, -17, 42, -57, -14, 1, 62, -105, -71, -71, -68, -5, -127, -21, -111, 35, 26, -80, -3, -21, 92, 73},
+  {-48, 8, 96, 69, -3, -56, -26, 38, -110, -89, -68, -80, -55, 96, 0, 55, 6, -13, 96, -87, -69, -68, 84, -13, 37, 34, -1, 9, -3, 79, -70, 82, 83, -33, 21, -10, -118, -104, 41, 30, 77, 69, 65, -100, -78, 86, 73, -47, 45, 34, 59, 34, 26, 2, -26, 23, -92, 87, 37, 31, 34, 47, -54, -42, -38, 1, 26, 49, -113, -99, 52, -112, -7, -14, -63, -78, 124, -113, -55, -71, 103, 8, -6, 82, 107, 97, -15, -2, 45, 57, -13, -41, 19, 6, 87, -100, 87, -42, -110, 23, -34, 97, -30, 47, -84, 59, -83, 21, 90, -41, 40, -100, 22, -12, 50, 78, 77, 7, -14, -3, 37, 0, -52, -72, 127, 2, 30, 10},
+  {-79, -84, -56, -38, 1, 86, 61, 24, 63, 5, 55, 99, 46, -93, -60, -69, -110, 75, 48, -100, -71, -10, -46, -89, 66, -99, 66, -89, 91, 88, -113, -65, -88, -22, 6, -37, 107, 25, -66, -22, -90, 34, 30, -41, 83, -103, 60, -38, -127, -60, -5, -43, -27, -113, 36, 19, 114, 51, 113, 30, -117, 9, -99, 13, -8, -66, -124, -38, 14, 69, 60, -63, -17, 69, 44, 3, 94, -27, -124, -85, -50, -74, 36, 20, -62, -84, 84, -98, 119, -71, -56, 89, -69, 95, -65, 39, 89, 108, -70, -116, 28, 62, 91, 42, -27, -42, -63, -81, 41, 104, -71, 69, 123, 22, -37, 81, 86, 53, -3, 77, -14, -103, 74, -53, -56, 6, 42, 83}
+};
+
+static const int32_t dense_58_int8_offset[40] = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+
+static const int32_t dense_58_int8_multiplier[40] = { 1161085440, 1005664554, 1014806959, 1014806959, 1087946200, 987379744, 987379744, 914240504, 1060518985, 941667719, 1106231010, 987379744, 1005664554, 1060518985, 969094934, 978237339, 969094934, 932525314, 1005664554, 1252509490, 1033091769, 923382909, 1060518985, 996522149, 950810124, 1014806959, 1014806959, 914240504, 932525314, 950810124, 1087946200, 1115373415, 1069661390, 1033091769, 959952529, 1087946200, 941667719, 1014806959, 996522149, 914240504 };
+
+const int8_weights_t dense_58_int8 = {
+  128, &dense_58_int8_kernel[0][0], dense_58_int8_offset, dense_58_int8_multiplier, 25,
+  30303, 20, 0, 136
+};
+
+#define DENSE_59_INT8
+
+const int16_t dense_59_bias[7] = {9, 7, -1, -2, -19, -2, 3}
+;
+
+static const int8_t dense_59_int8_kernel[8][64] = {
+  {-117, 103, -21, 28, 27, 107, 127, -1, 108, -47, 21, 24, -103, 76, -13, -10, -110, -73, -24, 21, -19, 42, 66, 79, 63, -50, -73, 65, -2, -9, -12, -89, 77, -36, -108, -9, -115, -62, -35, -96, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+  {26, 104, 76, -99, -52, -23, 101, -19, -110, -24, 33, 94, -46, 19, 96, 0, -10, 126, 21, 96, 71, 57, -87, 2, -127, -66, 4, 28, -1, 60, 41, 60, 115, 9, -31, -13, -66, -5, -79, -97, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+  {-8, -92, -91, -1, -105, 10, 69, -2, -64, 127, -17, -29, 39, -92, -51, 87, -93, -58, 73, 92, -67, 45, 85, -84, -109, 13, 99, -96, -74, 23, 81, -22, 31, 74, 19, -71, -78, 100, -4, 110, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+  {39, -15, -114, 79, 110, 70, -34, 23, 126, -73, -97, -17, 84, 3, -9, 83, -81, 109, -104, -62, -50, -72, 99, -3, -53, -107, -23, -73, -4, -124, -69, 39, -83, 99, 29, -34, -111, 127, 28, -117, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+  {11, -41, -122, -81, -37, -81, -108, 20, 57, 73, 108, 66, 68, 121, 26, -117, 5, -89, -105, 65, 127, -78, -119, -71, -40, -12, -49, -116, 114, 13, 105, -63, -99, -17, -61, 108, 86, -50, -51, -7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+  {-7, -45, -79, -4, -66, -40, -6, -5, 125, -49, -113, -81, -91, -68, 40, 60, 105, -67, -47, -110, 80, -4, 60, 6, -1, 59, 35, 77, 4, -21, 105, -108, -77, -94, -59, -127, 7, -77, -105, 35, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+  {6, -105, -15, 98, 83, -39, -108, 127, 84, -59, -91, -4, 98, -118, -27, 96, -92, -26, 24, 81, 59, 1, 24, 53, 105, 52, 26, -55, 98, -88, -52, -9, -43, 69, 83, 44, 105, -118, 95, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}
+};
+
+static const int32_t dense_59_int8_offset[8] = { -13400, 19028, -8777, -25594, -29547, -50451, 31825, 0 };
+
+static const int32_t dense_59_int8_multiplier[8] = { 2130498671, 2004605568, 2043341907, 1907764719, 1617242173, 1975553313, 1878712464, 0 };
+
+const int8_weights_t dense_59_int8 = {
+  64, &dense_59_int8_kernel[0][0], dense_59_int8_offset, dense_59_int8_multiplier, 24,
+  28608, 21, 67, 137
+};
@@ -0,0 +1,10 @@
+/**
+  ******************************************************************************
+  * @file    weights/separable.c
+  * @version 1.0.0
+  * @date    17 october 2026
+  * @brief   Depthwise and pointwise weights of the separable blocks replacing conv1d_118, conv1d_119,
+  *          used with -DCNN_SEPARABLE. None yet: lab_gsc.h5 has no SeparableConv1D layer, this
+  *          file is written by tools/separable_weights.py from a model .h5 trained with them and
+  *          defines SEPARABLE_WEIGHTS then, without which -DCNN_SEPARABLE stops at build time.
+  */
@@ -0,0 +1,13 @@
+/**
+  ******************************************************************************
+  * @file    weights/softmax.c
+  * @version 1.0.0
+  * @date    17 october 2026
+  * @brief   Temperature of the softmax of the logits of dense_59 (see softmax.h), generated by
+  *          tools/softmax_calibration.py: fitted on 56 of the test clips, written when the
+  *          fit is stable (T = 1 otherwise)
+  */
+
+// multiplier / 2^shift = 2^(SOFTMAX_Z_BITS - FIXED_POINT) / T, T = 1.0000
+#define DENSE_59_SOFTMAX_MULTIPLIER SOFTMAX_DEFAULT_MULTIPLIER
+#define DENSE_59_SOFTMAX_SHIFT      SOFTMAX_DEFAULT_SHIFT
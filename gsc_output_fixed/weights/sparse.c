@@ -0,0 +1,8101 @@
+/**
+  ******************************************************************************
+  * @file    weights/sparse.c
+  * @version 1.0.0
+  * @date    17 october 2026
+  * @brief   Bias and nonzero blocks of conv1d_119, dense_58 with 25.0% of their blocks
+  *          pruned, generated by tools/sparse_weights.py from the int16 weights, used with
+  *          -DCNN_SPARSE in place of weights/<layer>.c
+  */
+
+#define CONV1D_119_SPARSE // 1536 of 2048 blocks of 4 filters x 3 taps
+
+const int16_t conv1d_119_bias[128] = {-2, -10, 14, 0, 9, -11, -5, 20, 3, 4, 10, 6, -16, 0, 6, 12, -4, -15, 0, -5, 19, -16, 0, 8, 4, 14, -8, 2, -10, 1, 15, 12, 0, 0, 1, 6, 1, -9, 22, 2, 6, -6, -13, 7, 3, 12, 6, -12, 17, 7, -14, 4, 0, 12, -5, -8, 22, -1, 1, -5, 5, 9, -10, 4, -1, 16, 0, 19, -7, 3, 21, -6, -2, -15, 0, 6, 6, -8, 9, 9, 2, -3, -16, -9, -6, -7, 5, 22, -2, -5, 10, -4, 22, 5, 13, 4, 8, -15, 17, -3, 0, 17, 3, -6, 14, -8, 12, -4, 2, -5, 4, -3, 6, 2, -4, -3, 7, -2, 11, 15, -3, 0, -4, 4, -3, 2, -4, -8}
+;
+
+static const unsigned short conv1d_119_sparse_start[33] = { 0, 52, 104, 157, 200, 249, 295, 341, 386, 426, 475, 526, 576, 623, 678, 723, 774, 816, 869, 910, 956, 1000, 1049, 1090, 1139, 1185, 1241, 1289, 1341, 1391, 1440, 1490, 1536 };
+
+static const unsigned short conv1d_119_sparse_index[1536] = {1, 2, 3, 4, 5, 6, 7, 8, 10, 11, 12, 14, 15, 16, 17, 18, 19, 20, 22, 23, 24, 25, 26, 28, 29, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 56, 57, 58, 59, 61, 62, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 12, 13, 15, 16, 17, 18, 19, 20, 22, 23, 24, 25, 27, 28, 30, 32, 33, 34, 35, 36, 38, 39, 40, 41, 42, 45, 46, 47, 48, 49, 50, 51, 52, 54, 56, 57, 58, 59, 60, 61, 62, 63, 0, 1, 2, 3, 4, 5, 7, 8, 10, 11, 13, 15, 16, 18, 19, 20, 21, 22, 23, 25, 26, 27, 28, 29, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 55, 56, 57, 58, 60, 62, 0, 1, 2, 4, 6, 7, 8, 9, 10, 12, 16, 19, 24, 25, 26, 27, 28, 29, 31, 32, 33, 34, 35, 37, 38, 39, 42, 43, 44, 45, 46, 47, 48, 49, 50, 53, 54, 55, 56, 57, 58, 60, 61, 0, 2, 3, 4, 5, 6, 7, 9, 10, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 26, 27, 28, 30, 33, 34, 35, 36, 37, 39, 42, 43, 44, 45, 46, 47, 48, 50, 51, 53, 55, 57, 58, 59, 60, 62, 63, 0, 1, 3, 5, 6, 7, 9, 11, 12, 13, 15, 16, 18, 19, 21, 22, 23, 24, 26, 27, 28, 29, 30, 31, 34, 35, 37, 38, 39, 40, 41, 44, 46, 47, 48, 49, 51, 52, 53, 54, 56, 57, 58, 59, 61, 63, 0, 1, 3, 4, 5, 6, 8, 12, 13, 14, 16, 17, 19, 21, 22, 23, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 39, 40, 41, 42, 44, 45, 46, 47, 50, 52, 53, 54, 56, 58, 59, 62, 63, 2, 5, 6, 7, 8, 9, 10, 12, 13, 14, 15, 16, 17, 18, 21, 22, 23, 24, 25, 26, 27, 28, 30, 31, 32, 33, 34, 35, 36, 38, 39, 42, 44, 45, 46, 47, 49, 51, 52, 53, 54, 55, 56, 58, 62, 0, 4, 5, 6, 8, 9, 10, 12, 13, 14, 16, 17, 19, 22, 23, 25, 27, 28, 29, 31, 33, 34, 36, 37, 39, 40, 41, 43, 44, 49, 51, 52, 53, 54, 55, 56, 58, 59, 62, 63, 1, 2, 3, 4, 5, 7, 8, 9, 11, 12, 14, 16, 17, 18, 20, 21, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 35, 36, 37, 38, 39, 41, 42, 43, 44, 45, 46, 47, 48, 49, 51, 52, 53, 54, 57, 58, 61, 62, 63, 0, 1, 2, 4, 5, 6, 8, 9, 10, 11, 12, 13, 14, 16, 17, 18, 19, 20, 21, 23, 25, 26, 27, 28, 29, 30, 31, 32, 34, 35, 36, 37, 40, 41, 43, 44, 45, 46, 47, 50, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 2, 3, 4, 5, 6, 7, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 21, 22, 23, 24, 25, 26, 28, 29, 30, 31, 32, 33, 35, 36, 37, 38, 39, 41, 43, 44, 45, 46, 47, 49, 51, 52, 53, 56, 58, 59, 60, 62, 63, 0, 1, 2, 3, 4, 5, 7, 8, 9, 10, 11, 12, 14, 17, 18, 20, 22, 23, 24, 25, 26, 27, 28, 29, 30, 32, 33, 34, 38, 39, 40, 42, 45, 46, 47, 48, 49, 50, 51, 52, 55, 56, 57, 59, 60, 61, 62, 0, 2, 3, 4, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 21, 23, 24, 26, 27, 28, 29, 30, 31, 32, 33, 34, 36, 37, 38, 39, 42, 43, 44, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 0, 3, 4, 6, 7, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 24, 25, 27, 29, 31, 32, 33, 34, 35, 37, 39, 40, 41, 43, 44, 46, 47, 48, 49, 50, 52, 53, 57, 58, 59, 60, 63, 0, 1, 2, 3, 4, 5, 6, 8, 9, 10, 11, 13, 16, 17, 18, 19, 20, 21, 23, 24, 25, 26, 27, 28, 30, 31, 32, 34, 35, 36, 37, 39, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 57, 58, 59, 62, 0, 1, 3, 5, 7, 8, 9, 12, 13, 15, 17, 19, 20, 21, 22, 26, 27, 28, 30, 31, 32, 33, 34, 36, 39, 41, 42, 43, 47, 48, 50, 51, 52, 54, 55, 56, 57, 58, 59, 60, 62, 63, 1, 2, 3, 4, 5, 6, 7, 9, 10, 11, 13, 14, 15, 17, 18, 19, 20, 21, 22, 24, 25, 26, 27, 28, 29, 30, 31, 33, 34, 36, 37, 38, 39, 40, 42, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 58, 59, 60, 62, 63, 0, 1, 3, 4, 5, 7, 9, 11, 12, 13, 14, 15, 19, 21, 22, 23, 25, 26, 28, 29, 31, 32, 33, 34, 35, 36, 37, 41, 42, 43, 44, 45, 46, 50, 51, 53, 54, 56, 60, 62, 63, 1, 2, 4, 6, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 22, 23, 24, 25, 27, 28, 31, 33, 34, 35, 37, 38, 39, 40, 41, 42, 43, 45, 47, 48, 50, 51, 53, 54, 56, 57, 58, 60, 61, 63, 0, 2, 3, 4, 5, 8, 9, 12, 13, 14, 16, 17, 20, 22, 25, 27, 28, 30, 31, 32, 33, 34, 35, 36, 37, 38, 40, 43, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 59, 60, 61, 62, 1, 2, 3, 4, 7, 8, 9, 10, 11, 13, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 27, 31, 32, 34, 35, 36, 37, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 54, 55, 56, 57, 58, 60, 62, 63, 0, 3, 5, 8, 11, 13, 14, 15, 16, 21, 24, 26, 27, 29, 30, 32, 33, 34, 37, 38, 39, 40, 41, 42, 43, 44, 46, 47, 48, 50, 51, 52, 54, 55, 56, 57, 58, 59, 60, 61, 63, 0, 1, 2, 3, 4, 5, 6, 7, 9, 10, 13, 14, 15, 16, 17, 19, 20, 22, 23, 24, 25, 26, 27, 29, 30, 32, 34, 35, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 48, 49, 50, 52, 54, 56, 57, 58, 59, 61, 63, 1, 3, 5, 6, 7, 8, 9, 10, 11, 12, 14, 15, 16, 19, 21, 22, 24, 25, 26, 27, 28, 30, 31, 34, 35, 37, 38, 39, 40, 41, 42, 43, 44, 46, 47, 48, 51, 52, 53, 55, 58, 59, 60, 61, 62, 63, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 12, 13, 14, 15, 17, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 33, 34, 35, 36, 37, 38, 39, 40, 42, 43, 46, 47, 48, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 0, 1, 3, 4, 5, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 20, 23, 25, 26, 27, 29, 30, 32, 33, 34, 35, 36, 37, 39, 40, 41, 42, 44, 45, 46, 47, 49, 51, 53, 54, 55, 56, 57, 58, 59, 62, 63, 0, 1, 3, 5, 6, 7, 8, 9, 11, 12, 14, 15, 18, 19, 20, 21, 22, 23, 24, 25, 26, 28, 29, 31, 32, 33, 34, 35, 37, 38, 39, 40, 41, 42, 43, 45, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 61, 62, 63, 0, 3, 5, 8, 9, 10, 11, 13, 15, 16, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 43, 44, 45, 47, 49, 50, 51, 52, 54, 56, 58, 59, 60, 61, 62, 63, 0, 1, 2, 3, 5, 6, 7, 8, 9, 10, 13, 14, 15, 16, 18, 19, 22, 23, 24, 25, 26, 28, 29, 31, 32, 33, 34, 35, 37, 38, 39, 42, 44, 45, 46, 47, 48, 49, 50, 51, 54, 55, 56, 57, 59, 60, 61, 62, 63, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 17, 18, 19, 20, 22, 23, 25, 26, 27, 28, 29, 30, 31, 33, 34, 36, 38, 39, 40, 41, 42, 44, 45, 46, 47, 48, 49, 51, 53, 54, 55, 56, 57, 59, 62, 63, 0, 2, 5, 6, 9, 10, 13, 14, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 36, 38, 39, 40, 41, 43, 44, 46, 47, 48, 49, 51, 53, 54, 56, 58, 59, 60, 62, 63};
+
+static const number_t conv1d_119_sparse_values[1536][4][3] = {{{-40, 52, -37}
+, {19, -16, 16}
+, {-41, 14, 6}
+, {-36, 25, 46}}
+, {{-21, 59, 36}
+, {-23, -36, -61}
+, {23, 7, -48}
+, {17, -47, 3}}
+, {{-41, -11, -17}
+, {46, -38, 21}
+, {-41, -62, 17}
+, {-1, 9, 40}}
+, {{57, 41, 26}
+, {-5, -47, -41}
+, {-38, -29, -50}
+, {41, -41, -2}}
+, {{24, 43, -46}
+, {23, -20, 30}
+, {-10, 40, 13}
+, {28, 40, -8}}
+, {{-5, -43, -51}
+, {29, -34, 13}
+, {26, 53, -40}
+, {28, -6, 10}}
+, {{-38, -30, 21}
+, {-38, -2, 13}
+, {41, 28, 14}
+, {29, -30, 19}}
+, {{-34, 25, -6}
+, {23, -26, -32}
+, {49, -27, -32}
+, {-26, 46, -18}}
+, {{-53, -34, -30}
+, {5, -48, 20}
+, {33, 34, 51}
+, {-18, 52, 49}}
+, {{-26, 29, 44}
+, {5, 48, -33}
+, {-18, 47, 16}
+, {6, 13, 46}}
+, {{-27, -26, 29}
+, {-47, 26, -11}
+, {-4, -17, -52}
+, {42, -21, 38}}
+, {{-53, 47, -27}
+, {-48, 8, -24}
+, {-43, 48, 11}
+, {-41, -48, 8}}
+, {{15, -42, 29}
+, {30, -30, 19}
+, {-29, -11, -23}
+, {24, 14, -42}}
+, {{41, 49, 30}
+, {-45, -47, 16}
+, {-14, 25, 48}
+, {-46, 18, -23}}
+, {{-48, 29, 18}
+, {-44, -33, -41}
+, {-19, 15, -60}
+, {27, -25, 10}}
+, {{-33, 27, -8}
+, {37, 31, 37}
+, {27, 45, -14}
+, {-3, 51, 0}}
+, {{-24, 6, 50}
+, {44, -24, 47}
+, {0, -29, 5}
+, {-51, 46, 47}}
+, {{-21, -24, -23}
+, {8, 27, 47}
+, {-35, -44, 49}
+, {25, -6, -35}}
+, {{39, -20, 40}
+, {-9, -2, 53}
+, {3, 38, -24}
+, {23, 28, 25}}
+, {{15, 41, -21}
+, {-25, -27, 39}
+, {41, 44, -7}
+, {14, 67, 41}}
+, {{59, 5, -30}
+, {29, -9, -8}
+, {9, 22, 60}
+, {24, 55, 52}}
+, {{33, 5, -55}
+, {-2, 21, 20}
+, {-57, -2, -10}
+, {-61, -10, -31}}
+, {{-29, -18, -2}
+, {-46, -48, -18}
+, {-16, 13, 6}
+, {18, 63, 32}}
+, {{-7, -29, -45}
+, {37, 28, -31}
+, {34, -23, -11}
+, {37, 17, 6}}
+, {{35, 8, 40}
+, {-47, -36, 37}
+, {-37, 2, 29}
+, {42, -38, 31}}
+, {{-41, -38, 43}
+, {-28, -42, 12}
+, {-4, 28, 25}
+, {52, 0, -3}}
+, {{-58, -50, 42}
+, {-37, 11, 25}
+, {1, 12, -39}
+, {24, 16, 28}}
+, {{-32, 61, 12}
+, {11, 5, 12}
+, {56, -44, -20}
+, {31, 57, 53}}
+, {{0, -3, 50}
+, {-46, 63, -42}
+, {-42, -23, -62}
+, {-1, -41, -35}}
+, {{9, 14, -46}
+, {-10, 42, 18}
+, {-47, -44, -3}
+, {3, -16, -53}}
+, {{25, -37, -3}
+, {53, -19, 20}
+, {9, -32, 12}
+, {42, 28, -45}}
+, {{45, 57, 15}
+, {-10, -5, -29}
+, {61, -36, 6}
+, {-45, -32, -7}}
+, {{-22, 48, 46}
+, {48, 6, 51}
+, {-65, 18, -50}
+, {0, -15, -18}}
+, {{-9, -34, 59}
+, {-41, -31, 15}
+, {42, -8, -28}
+, {-56, -49, 22}}
+, {{19, -41, -37}
+, {-48, -48, 1}
+, {-5, 16, -21}
+, {39, -1, 19}}
+, {{18, -33, 50}
+, {-16, -40, -22}
+, {-28, -25, -8}
+, {48, 21, 57}}
+, {{-32, -28, -32}
+, {-41, 41, 16}
+, {30, 0, 39}
+, {41, -33, -35}}
+, {{30, 38, 32}
+, {-33, -7, -50}
+, {9, 48, -15}
+, {-24, 24, 22}}
+, {{24, -39, -39}
+, {20, -45, -46}
+, {-20, 35, 44}
+, {-34, -32, 3}}
+, {{-10, 15, 37}
+, {-37, -2, -10}
+, {49, -21, 52}
+, {1, 31, 48}}
+, {{-60, -51, -42}
+, {32, -64, -45}
+, {29, 24, 22}
+, {-7, 33, 32}}
+, {{39, 29, -46}
+, {33, 55, 50}
+, {-55, -50, -42}
+, {45, -36, 31}}
+, {{-60, -13, -31}
+, {-23, -60, -8}
+, {59, 2, -7}
+, {27, -11, 42}}
+, {{49, -37, 56}
+, {-32, 40, 12}
+, {33, 43, -28}
+, {-33, -43, 39}}
+, {{41, 10, -2}
+, {-24, -22, -47}
+, {-9, -45, 22}
+, {46, -31, 6}}
+, {{-5, 21, 30}
+, {-10, 36, 37}
+, {44, -47, 37}
+, {-31, -2, 15}}
+, {{-21, -3, -44}
+, {-48, 37, -20}
+, {13, -23, -35}
+, {33, -2, 51}}
+, {{-43, 32, -6}
+, {37, -48, 37}
+, {13, 63, 60}
+, {3, -9, -2}}
+, {{-6, 14, 23}
+, {17, 37, -3}
+, {-27, 7, 25}
+, {-40, -36, 50}}
+, {{43, -11, 51}
+, {-39, 30, 15}
+, {-21, 21, -30}
+, {5, 24, 37}}
+, {{54, -20, 5}
+, {-29, 13, 10}
+, {17, 26, 32}
+, {-25, -42, -17}}
+, {{27, -35, 27}
+, {13, 21, -5}
+, {9, -29, -37}
+, {51, 36, -10}}
+, {{-24, -3, 32}
+, {40, -53, 17}
+, {-42, 28, -27}
+, {0, 36, 30}}
+, {{33, 49, -18}
+, {-46, 4, 21}
+, {-34, 33, -61}
+, {-18, -9, -36}}
+, {{-42, -56, -30}
+, {56, 19, 36}
+, {15, -21, -18}
+, {24, -17, -29}}
+, {{2, -38, 19}
+, {-35, -38, -33}
+, {-41, 2, -48}
+, {-30, 44, -38}}
+, {{-3, 5, -40}
+, {38, 42, 36}
+, {43, -43, 33}
+, {18, 9, -2}}
+, {{13, 29, 13}
+, {31, 19, 36}
+, {0, 21, 47}
+, {-17, 45, -27}}
+, {{-10, 32, -28}
+, {32, -35, 43}
+, {41, 19, -33}
+, {4, -8, -8}}
+, {{36, -35, -22}
+, {46, -46, -8}
+, {-36, -11, -18}
+, {9, -51, 35}}
+, {{-14, 12, 31}
+, {-24, 1, -27}
+, {-40, 38, -31}
+, {-21, 10, 57}}
+, {{-61, 15, -8}
+, {11, 16, 3}
+, {-18, 7, -31}
+, {48, 50, 19}}
+, {{-28, 13, -49}
+, {-40, -13, 38}
+, {19, 47, 28}
+, {-4, -48, 42}}
+, {{-41, 26, -49}
+, {-21, 27, 44}
+, {-13, -19, 5}
+, {-61, 16, 33}}
+, {{57, -30, -14}
+, {-19, -44, -6}
+, {-45, 21, -42}
+, {-14, 4, 22}}
+, {{5, 29, 48}
+, {-41, -25, 43}
+, {5, -40, 45}
+, {-31, -2, 49}}
+, {{29, -16, 1}
+, {-53, -12, 28}
+, {-34, 41, 20}
+, {-11, 48, -10}}
+, {{-10, -17, -42}
+, {-10, -32, 38}
+, {19, -38, 28}
+, {0, 1, 57}}
+, {{-41, 39, 41}
+, {-9, 57, -21}
+, {-9, -51, 14}
+, {-30, 45, 2}}
+, {{-22, -41, 33}
+, {0, -37, -36}
+, {34, 36, -43}
+, {-1, 36, 38}}
+, {{-43, -23, 50}
+, {-39, 17, 34}
+, {32, -19, -50}
+, {-44, 22, 27}}
+, {{0, -42, -36}
+, {44, -41, 0}
+, {-37, -32, 36}
+, {-2, 27, 16}}
+, {{-2, 14, 7}
+, {40, 55, 42}
+, {6, -43, -46}
+, {11, 51, 39}}
+, {{54, 19, -28}
+, {-4, 37, -28}
+, {-50, 4, -38}
+, {5, -28, -32}}
+, {{28, 39, -42}
+, {10, -16, 33}
+, {-48, 11, 34}
+, {6, 44, 16}}
+, {{29, -10, 53}
+, {39, -14, 7}
+, {-14, -18, -7}
+, {-33, -40, -34}}
+, {{39, 25, 5}
+, {-7, 15, 17}
+, {-21, 31, 2}
+, {-50, -49, -27}}
+, {{-33, 43, 33}
+, {67, 43, -20}
+, {-22, -43, -6}
+, {-27, 47, -49}}
+, {{-9, 8, -47}
+, {-21, 38, -14}
+, {35, 13, 47}
+, {-36, 39, 16}}
+, {{24, 1, 17}
+, {24, 32, 33}
+, {20, 25, 44}
+, {52, 15, 20}}
+, {{33, -5, -31}
+, {36, -32, 13}
+, {-18, 36, 25}
+, {18, -6, -54}}
+, {{-39, -41, 46}
+, {16, 48, 37}
+, {-30, -24, -1}
+, {54, 28, -29}}
+, {{-30, 20, -25}
+, {-18, -13, 19}
+, {46, -47, 8}
+, {-18, -1, 64}}
+, {{-32, 40, 24}
+, {2, -69, -9}
+, {53, 0, 8}
+, {4, -33, -43}}
+, {{-40, -5, -21}
+, {-28, -62, -7}
+, {19, 42, 47}
+, {30, -20, -45}}
+, {{-33, -56, -28}
+, {36, 9, 0}
+, {-31, -36, 24}
+, {-2, 3, -55}}
+, {{18, -18, -4}
+, {24, -21, 40}
+, {13, 42, -12}
+, {-51, -41, -35}}
+, {{-30, -15, 60}
+, {42, -26, -38}
+, {-50, -22, -43}
+, {-49, -36, -3}}
+, {{-27, 37, -17}
+, {-13, -6, 31}
+, {-1, 37, -11}
+, {50, -38, -15}}
+, {{-4, 12, 4}
+, {-54, 39, -38}
+, {3, -57, 27}
+, {49, 35, 20}}
+, {{-22, 26, -25}
+, {-14, -57, 22}
+, {-50, -1, 22}
+, {-18, 62, 69}}
+, {{33, -18, 33}
+, {-65, 27, -44}
+, {-38, 14, -39}
+, {1, 33, 9}}
+, {{-37, 29, 44}
+, {5, -31, -28}
+, {15, -43, 4}
+, {-44, -25, -57}}
+, {{9, 43, 29}
+, {15, 14, -57}
+, {-30, -25, -1}
+, {55, 48, -17}}
+, {{-35, 45, 11}
+, {-25, -18, 56}
+, {-4, 18, -18}
+, {9, 43, -21}}
+, {{44, 39, -3}
+, {-45, 49, -15}
+, {-40, -24, 29}
+, {-21, 27, 42}}
+, {{-31, -35, 46}
+, {-47, 40, -38}
+, {-18, -16, -22}
+, {-34, -23, 15}}
+, {{-21, 51, 62}
+, {-40, -38, -35}
+, {-56, 43, 0}
+, {-29, -3, 44}}
+, {{30, -37, -36}
+, {-16, 17, 13}
+, {-31, -5, 34}
+, {-23, 23, -22}}
+, {{-22, -38, 43}
+, {49, 9, -2}
+, {36, 34, 47}
+, {49, 44, 2}}
+, {{45, -7, 54}
+, {11, -41, -29}
+, {-40, -51, -31}
+, {20, 33, 18}}
+, {{-9, 41, -7}
+, {-47, 36, 46}
+, {-44, 3, -25}
+, {-38, 14, -22}}
+, {{-11, -37, -54}
+, {38, -40, 58}
+, {-25, -7, 4}
+, {29, -2, -1}}
+, {{30, 23, -24}
+, {35, 6, -58}
+, {-4, -17, 7}
+, {12, -43, -27}}
+, {{7, -32, 18}
+, {11, -18, -14}
+, {-28, 61, -31}
+, {11, 56, -29}}
+, {{-43, 21, -3}
+, {47, 22, 34}
+, {-26, 24, 24}
+, {-22, -25, -33}}
+, {{-36, -20, 46}
+, {19, -7, 57}
+, {15, -18, 38}
+, {-18, 46, 43}}
+, {{18, 51, 43}
+, {-6, 43, -28}
+, {-29, -13, 2}
+, {-5, 11, -52}}
+, {{48, 3, 19}
+, {-39, 14, -40}
+, {-20, -33, 5}
+, {-39, -19, -50}}
+, {{-27, 33, 50}
+, {-9, 34, -56}
+, {22, -43, 0}
+, {2, 43, 11}}
+, {{53, -13, 8}
+, {-50, 17, 42}
+, {-41, -18, 56}
+, {-33, 49, -17}}
+, {{-24, -8, 8}
+, {40, -33, 41}
+, {-1, -15, -61}
+, {11, 27, 23}}
+, {{38, -25, 37}
+, {-26, -43, -9}
+, {37, -9, 36}
+, {-16, -14, 40}}
+, {{-28, 47, -2}
+, {-26, -24, -7}
+, {-30, -37, 43}
+, {17, -30, -43}}
+, {{25, 28, -42}
+, {39, 65, -4}
+, {-8, 3, 3}
+, {3, -13, -53}}
+, {{47, -45, 6}
+, {25, 29, -33}
+, {-7, 42, 29}
+, {38, 25, -11}}
+, {{-5, 23, -26}
+, {43, 1, -36}
+, {-3, 55, -18}
+, {53, 51, 13}}
+, {{-42, 41, 7}
+, {-10, -35, 45}
+, {-3, 59, 35}
+, {44, -37, 15}}
+, {{-41, -32, -46}
+, {27, 0, 8}
+, {36, -18, 1}
+, {35, -22, 27}}
+, {{-37, 33, -29}
+, {25, 14, -37}
+, {-32, -7, -36}
+, {-34, -22, -22}}
+, {{-15, -22, 43}
+, {-10, -38, -7}
+, {34, 34, -31}
+, {-17, 11, -40}}
+, {{28, 44, 48}
+, {-34, 28, -19}
+, {-47, -52, -22}
+, {-41, 3, 21}}
+, {{35, -11, 35}
+, {-11, -35, -12}
+, {23, 64, 26}
+, {-48, -16, -8}}
+, {{22, 17, -19}
+, {21, 26, -10}
+, {-26, 45, 46}
+, {14, -43, 4}}
+, {{34, 78, 32}
+, {53, 5, -51}
+, {-51, -15, 30}
+, {-33, -33, 6}}
+, {{38, 39, 50}
+, {17, 17, -51}
+, {-6, -12, 41}
+, {-29, -6, 42}}
+, {{36, -22, -46}
+, {28, 33, -33}
+, {2, 25, -23}
+, {40, -10, -35}}
+, {{8, -42, 42}
+, {-35, 16, 20}
+, {-34, -27, 2}
+, {-5, -33, -25}}
+, {{5, -49, 65}
+, {-15, -9, -31}
+, {15, 44, 25}
+, {-35, 20, -3}}
+, {{31, -6, 53}
+, {-21, 24, -4}
+, {29, 8, 43}
+, {39, 44, 39}}
+, {{64, 51, 14}
+, {0, -57, 33}
+, {2, 19, -30}
+, {0, -6, 24}}
+, {{-21, 37, -8}
+, {27, 22, 38}
+, {-32, 32, 60}
+, {23, 69, 33}}
+, {{-43, -11, 3}
+, {36, 20, 28}
+, {17, -75, -47}
+, {-28, 12, 39}}
+, {{-48, -19, -12}
+, {45, 47, 4}
+, {1, -43, -22}
+, {-50, 15, -12}}
+, {{47, -29, -21}
+, {51, -32, -9}
+, {-38, 7, 43}
+, {8, 38, -15}}
+, {{-11, -20, 50}
+, {50, 58, 0}
+, {-6, 37, -1}
+, {-34, -24, -37}}
+, {{49, -35, 37}
+, {-15, 5, 33}
+, {27, -47, -19}
+, {48, 17, -40}}
+, {{0, 20, 21}
+, {-12, -32, -22}
+, {-14, 7, -34}
+, {-45, -45, -42}}
+, {{41, -30, 27}
+, {33, -28, -55}
+, {45, 40, 67}
+, {11, 13, -32}}
+, {{29, 38, -29}
+, {-53, 24, -5}
+, {-35, 21, 22}
+, {5, -24, 7}}
+, {{19, -12, -29}
+, {-14, 15, -45}
+, {-27, 46, -32}
+, {-46, 55, -1}}
+, {{-29, 11, -41}
+, {-39, -40, -33}
+, {-31, -4, -18}
+, {-3, 45, 12}}
+, {{-42, -30, -2}
+, {11, -37, 11}
+, {50, 0, -5}
+, {46, -27, -52}}
+, {{48, 31, 41}
+, {0, -2, 31}
+, {35, -12, 31}
+, {21, 9, -39}}
+, {{37, -32, 46}
+, {16, 43, 7}
+, {2, 1, 38}
+, {15, 21, -26}}
+, {{-33, -3, -31}
+, {40, 62, 16}
+, {2, 16, 37}
+, {-16, 10, -47}}
+, {{41, 36, -34}
+, {16, -27, -28}
+, {14, -27, 38}
+, {13, 28, -42}}
+, {{-36, -32, -34}
+, {19, 53, 37}
+, {15, -48, 14}
+, {21, 20, 0}}
+, {{-38, -49, -5}
+, {-26, 17, -35}
+, {19, 21, 34}
+, {-20, 23, -44}}
+, {{22, -9, -49}
+, {43, -1, 47}
+, {-27, -31, -33}
+, {35, -38, -24}}
+, {{51, 20, 16}
+, {45, 1, -3}
+, {22, -36, -17}
+, {34, -25, 34}}
+, {{37, 32, 2}
+, {42, -15, -18}
+, {-33, -17, 27}
+, {-23, 26, -21}}
+, {{13, -21, -9}
+, {-20, -25, -17}
+, {38, 33, 19}
+, {-40, -38, -19}}
+, {{2, -41, 16}
+, {-50, -35, 30}
+, {70, 47, 26}
+, {19, -37, 8}}
+, {{33, 23, 8}
+, {37, 40, -19}
+, {-73, 13, 25}
+, {6, -17, 27}}
+, {{-20, -47, -45}
+, {-23, 31, -31}
+, {42, 8, 32}
+, {36, 13, 53}}
+, {{45, 53, 4}
+, {-27, 35, -49}
+, {-50, 12, 36}
+, {38, -8, 48}}
+, {{15, -11, 4}
+, {53, -39, 41}
+, {19, 14, -56}
+, {31, 7, 13}}
+, {{33, 23, -17}
+, {32, -43, 30}
+, {24, -15, -12}
+, {-44, 31, -49}}
+, {{-60, 31, 33}
+, {-8, -1, -46}
+, {34, 5, 76}
+, {51, -16, 48}}
+, {{-26, 18, 0}
+, {-39, -55, -3}
+, {29, 22, -44}
+, {-16, -29, 49}}
+, {{13, -4, 16}
+, {40, -23, 49}
+, {5, -44, 53}
+, {-34, 12, 9}}
+, {{-46, 37, 12}
+, {52, -25, 11}
+, {9, -33, -40}
+, {23, -4, -20}}
+, {{-28, -59, 1}
+, {35, 47, 34}
+, {-8, -3, -48}
+, {-9, 33, 35}}
+, {{21, -44, -18}
+, {26, -14, -33}
+, {-49, -14, 15}
+, {-51, -21, -3}}
+, {{-33, -16, 41}
+, {2, -15, -14}
+, {4, 12, 56}
+, {-41, -55, -36}}
+, {{-50, -34, -15}
+, {-46, 14, 34}
+, {-35, 8, 49}
+, {-28, 46, 36}}
+, {{-6, 9, -28}
+, {43, 33, -40}
+, {33, 2, 31}
+, {40, 26, 1}}
+, {{-47, -43, 46}
+, {46, -17, 45}
+, {5, -51, 21}
+, {13, 6, 12}}
+, {{48, -35, 28}
+, {-25, -31, 28}
+, {52, -4, 33}
+, {11, -5, 31}}
+, {{-46, 11, 13}
+, {0, -41, 56}
+, {-12, 9, 53}
+, {29, 48, -38}}
+, {{-2, 10, -41}
+, {-62, -32, 16}
+, {-1, 9, -30}
+, {42, -30, -27}}
+, {{0, -35, -15}
+, {-23, 22, -41}
+, {-44, -48, -45}
+, {-34, -26, -54}}
+, {{-33, -10, 15}
+, {17, 23, 2}
+, {28, 41, -40}
+, {-9, -34, 37}}
+, {{-28, 43, -49}
+, {-33, 35, -11}
+, {30, -40, -32}
+, {-6, 18, -47}}
+, {{0, -16, -5}
+, {39, -34, -22}
+, {-28, -12, 29}
+, {60, -33, 12}}
+, {{41, -30, -17}
+, {-46, -17, -6}
+, {36, 12, -32}
+, {12, -32, 21}}
+, {{-57, -3, 42}
+, {32, -52, 41}
+, {-39, -9, -39}
+, {-17, 1, -23}}
+, {{28, 47, 48}
+, {-24, -18, -57}
+, {2, -5, 2}
+, {11, 20, -26}}
+, {{-13, 2, 40}
+, {45, 29, 17}
+, {-11, 3, 42}
+, {28, 31, 56}}
+, {{48, 48, -5}
+, {43, 55, -42}
+, {-32, -17, 49}
+, {-20, 27, -46}}
+, {{-25, 26, 22}
+, {37, -29, 29}
+, {-6, 25, -44}
+, {-35, -52, -31}}
+, {{25, 22, -40}
+, {-22, 0, 37}
+, {-24, -34, 22}
+, {-10, 45, 61}}
+, {{11, 5, -18}
+, {-47, -24, -8}
+, {16, -37, 29}
+, {46, 11, -40}}
+, {{14, -52, 36}
+, {9, 0, 6}
+, {13, 24, 36}
+, {-23, -43, -30}}
+, {{33, 15, -51}
+, {-26, -42, -44}
+, {-48, -41, 50}
+, {-23, 13, 51}}
+, {{4, 40, 18}
+, {45, 32, -4}
+, {38, 0, 39}
+, {18, -3, -45}}
+, {{-50, 40, 38}
+, {-6, 17, 1}
+, {6, 32, 61}
+, {28, -39, -17}}
+, {{-3, -32, -45}
+, {25, -5, 41}
+, {-3, 60, 55}
+, {1, 41, 21}}
+, {{-38, -31, 26}
+, {-10, -52, 7}
+, {-16, 46, 32}
+, {-5, 35, -1}}
+, {{4, -30, 39}
+, {18, -31, -15}
+, {-29, 10, 36}
+, {-3, 20, -55}}
+, {{39, -45, 16}
+, {-17, 40, -24}
+, {46, -23, -38}
+, {-32, -45, 21}}
+, {{46, 2, -5}
+, {-37, -20, -52}
+, {-42, -49, -8}
+, {24, -43, 0}}
+, {{-15, -12, 4}
+, {-3, -1, -50}
+, {30, -56, 48}
+, {-3, 41, -23}}
+, {{-31, 41, 17}
+, {-40, -25, -26}
+, {-29, 30, 54}
+, {3, -32, 4}}
+, {{22, 41, -42}
+, {46, 49, 32}
+, {43, 1, -20}
+, {40, -43, 14}}
+, {{-42, -11, 1}
+, {57, 48, -43}
+, {0, 49, 56}
+, {31, 30, 56}}
+, {{27, -60, -2}
+, {-17, -22, -4}
+, {15, 74, 20}
+, {17, 30, -38}}
+, {{33, 35, 45}
+, {4, -34, -1}
+, {-19, -12, -50}
+, {41, -8, 33}}
+, {{14, -11, -17}
+, {45, -14, -8}
+, {48, -50, 13}
+, {-8, 38, 43}}
+, {{39, -34, -15}
+, {42, -28, -38}
+, {1, 17, -36}
+, {-27, 40, -37}}
+, {{20, -41, -6}
+, {-15, -65, -54}
+, {0, -9, 32}
+, {-39, 9, 39}}
+, {{-55, -20, -6}
+, {54, 47, 52}
+, {42, 39, 19}
+, {12, -29, -3}}
+, {{-52, -24, 49}
+, {-29, 44, 38}
+, {26, -31, 47}
+, {-1, 0, 4}}
+, {{18, 21, 9}
+, {-32, -49, 15}
+, {-33, -43, 28}
+, {-11, 27, -54}}
+, {{21, 13, -20}
+, {36, -48, 47}
+, {3, 19, 13}
+, {24, 37, -34}}
+, {{-54, 35, 53}
+, {-32, -23, 54}
+, {-15, -18, 36}
+, {-50, 25, -23}}
+, {{2, 38, 23}
+, {30, 0, -24}
+, {42, 5, 55}
+, {-20, 37, -15}}
+, {{0, -24, -24}
+, {-34, 36, -11}
+, {-10, 26, 29}
+, {-57, -54, 4}}
+, {{20, 28, 19}
+, {-29, 51, -15}
+, {-22, -41, 9}
+, {-43, -12, -39}}
+, {{-3, 61, 25}
+, {13, 20, -6}
+, {-51, -9, 2}
+, {53, -40, 10}}
+, {{-39, -34, 51}
+, {1, -18, -27}
+, {-46, 13, -39}
+, {30, -51, -39}}
+, {{-42, -39, 21}
+, {5, 2, -23}
+, {39, -27, -42}
+, {-34, -24, 3}}
+, {{26, 28, -15}
+, {18, -24, -16}
+, {-34, 38, -19}
+, {-6, 30, 40}}
+, {{6, -44, 41}
+, {51, 30, -53}
+, {-29, -35, -36}
+, {14, -25, 35}}
+, {{-66, -6, 16}
+, {41, 44, -13}
+, {13, 46, 26}
+, {-27, 6, -52}}
+, {{44, -44, -11}
+, {37, 19, -30}
+, {-12, -12, -27}
+, {-21, -43, -22}}
+, {{22, 40, -2}
+, {-47, -12, -41}
+, {13, 46, 21}
+, {-33, -28, 6}}
+, {{44, -35, 14}
+, {-23, -49, 4}
+, {-47, -4, -45}
+, {-11, 33, 20}}
+, {{-25, -50, -32}
+, {49, 47, -24}
+, {-37, 50, 3}
+, {-8, 0, 5}}
+, {{39, -17, 43}
+, {6, 39, -11}
+, {-22, -22, 33}
+, {33, 23, -20}}
+, {{10, -25, -1}
+, {41, -42, 15}
+, {42, 56, 36}
+, {-25, 9, 24}}
+, {{35, 32, -32}
+, {14, -30, 46}
+, {-1, 52, 40}
+, {-62, 36, 21}}
+, {{-28, -29, 38}
+, {45, 4, 14}
+, {-29, 17, 35}
+, {-12, -32, 46}}
+, {{-27, 32, 0}
+, {9, 40, -48}
+, {-15, 25, 6}
+, {-27, 51, -6}}
+, {{18, 27, -8}
+, {54, -55, 5}
+, {-9, -64, 1}
+, {13, 30, -9}}
+, {{-18, 31, -47}
+, {45, -11, 51}
+, {52, -10, 4}
+, {42, -36, -40}}
+, {{19, 42, -27}
+, {46, 10, 1}
+, {-29, -38, -36}
+, {-66, 20, 22}}
+, {{49, -49, -10}
+, {32, -2, 21}
+, {-37, -48, 37}
+, {-39, -10, 13}}
+, {{29, -24, 36}
+, {-38, -11, 8}
+, {15, -51, 39}
+, {-41, -18, 28}}
+, {{-38, -44, -12}
+, {51, 24, -46}
+, {8, -39, 0}
+, {32, 49, -27}}
+, {{30, 49, 52}
+, {49, -28, 13}
+, {-52, 31, -18}
+, {-7, -12, -34}}
+, {{-40, -16, -30}
+, {54, -16, 46}
+, {24, 0, 3}
+, {-7, 45, 29}}
+, {{-3, 19, -47}
+, {9, -42, 2}
+, {51, 31, -46}
+, {10, -9, -29}}
+, {{-54, -34, 45}
+, {47, -35, -22}
+, {-21, -2, 51}
+, {-4, 23, -19}}
+, {{43, 15, -6}
+, {-24, -12, -36}
+, {-30, -19, -27}
+, {40, -52, -23}}
+, {{7, 12, -13}
+, {-45, 47, 21}
+, {47, 4, -27}
+, {-26, 38, 50}}
+, {{-47, 0, -20}
+, {-41, 17, 0}
+, {-2, 46, 39}
+, {45, -36, 0}}
+, {{-43, -16, 33}
+, {-34, -20, 28}
+, {4, -50, 37}
+, {-18, 22, 48}}
+, {{-7, -27, 21}
+, {-24, 1, -19}
+, {4, -51, -48}
+, {52, 5, -24}}
+, {{-27, 47, -39}
+, {38, -34, 29}
+, {51, 31, -11}
+, {49, 10, 42}}
+, {{-31, 37, -19}
+, {40, 18, -9}
+, {-40, 1, -36}
+, {12, -28, -28}}
+, {{-48, -2, -23}
+, {12, -18, -22}
+, {21, 17, 10}
+, {34, 44, -55}}
+, {{-42, 10, -18}
+, {-8, 36, -57}
+, {-20, 51, -2}
+, {-42, 27, 6}}
+, {{5, 10, 34}
+, {28, -53, 42}
+, {-16, -30, 47}
+, {-25, -19, 29}}
+, {{-41, 15, 40}
+, {40, 49, 8}
+, {41, 48, -33}
+, {-14, -26, 11}}
+, {{-18, -51, 14}
+, {8, -14, 20}
+, {38, 5, -5}
+, {-56, -49, 21}}
+, {{-62, 11, 19}
+, {-41, -35, -21}
+, {15, 54, 12}
+, {31, 21, -19}}
+, {{-4, -45, -21}
+, {-20, -5, -30}
+, {-38, -32, -31}
+, {12, -44, 32}}
+, {{10, -13, -10}
+, {63, 54, 58}
+, {8, 43, 26}
+, {4, -27, -46}}
+, {{46, 18, -30}
+, {42, -5, 18}
+, {-27, 0, -36}
+, {-33, -19, 53}}
+, {{35, -2, -38}
+, {-45, 43, -38}
+, {33, -14, 12}
+, {-11, 31, -10}}
+, {{31, 40, -32}
+, {-27, -57, -39}
+, {-29, 4, 0}
+, {-38, -55, -11}}
+, {{-49, -8, -34}
+, {-8, -26, -22}
+, {-34, -48, 45}
+, {-26, -5, 32}}
+, {{-20, 8, 54}
+, {-56, -33, 49}
+, {0, 45, 46}
+, {-41, 2, -51}}
+, {{13, 37, 10}
+, {20, 49, 3}
+, {-8, -13, 21}
+, {-11, 66, -53}}
+, {{9, 25, -20}
+, {6, 49, -52}
+, {38, -1, -25}
+, {10, 7, 41}}
+, {{-34, 31, -12}
+, {-52, -12, 4}
+, {36, 17, 43}
+, {39, 5, -36}}
+, {{-32, 40, 28}
+, {41, 24, 51}
+, {-28, 12, -17}
+, {53, 41, 58}}
+, {{-1, 38, 0}
+, {38, 7, 18}
+, {53, 10, -47}
+, {-29, -39, -11}}
+, {{52, 1, 42}
+, {26, 25, 14}
+, {5, 17, -51}
+, {-52, 2, -38}}
+, {{-39, 33, -33}
+, {30, -9, -40}
+, {-38, 2, 44}
+, {5, -11, 55}}
+, {{-8, 48, 34}
+, {-28, -25, 47}
+, {30, -32, 27}
+, {8, -37, 20}}
+, {{51, -25, 11}
+, {52, 49, -68}
+, {-12, 50, -9}
+, {27, -47, 24}}
+, {{-18, 44, -27}
+, {2, -4, 12}
+, {25, -40, -20}
+, {34, 16, 53}}
+, {{-43, -38, -14}
+, {17, 49, 19}
+, {-51, 12, 49}
+, {32, 22, -3}}
+, {{17, -37, -42}
+, {0, 10, -26}
+, {-24, 50, 49}
+, {-44, 12, -34}}
+, {{28, 20, 39}
+, {-8, -5, -6}
+, {23, -24, 23}
+, {40, -41, 42}}
+, {{26, -25, -15}
+, {-40, -6, -5}
+, {-41, 33, 12}
+, {-50, 4, 27}}
+, {{33, 58, 49}
+, {-5, -5, -18}
+, {45, 27, -39}
+, {4, -53, -52}}
+, {{-33, 13, -55}
+, {-41, 7, -26}
+, {0, -26, -43}
+, {1, 38, 8}}
+, {{36, 26, -27}
+, {38, 16, -6}
+, {-35, 17, 2}
+, {47, -29, 51}}
+, {{77, 26, 45}
+, {-35, 15, 26}
+, {38, -17, -33}
+, {-11, -11, -40}}
+, {{35, -37, -9}
+, {15, -32, 13}
+, {-21, 28, 59}
+, {14, 36, 27}}
+, {{-25, -54, 38}
+, {6, 34, 35}
+, {13, -14, 55}
+, {-9, -5, 3}}
+, {{-8, -11, -49}
+, {-39, -21, -27}
+, {-1, 43, -32}
+, {-27, 2, -30}}
+, {{-30, -19, 37}
+, {36, 21, 34}
+, {16, -28, 29}
+, {1, -21, 19}}
+, {{2, 37, 23}
+, {45, -24, 11}
+, {14, 31, -35}
+, {-1, -26, 39}}
+, {{-42, 8, -42}
+, {39, 42, -24}
+, {-3, -38, 20}
+, {-30, 9, -34}}
+, {{-13, -25, 33}
+, {-38, -8, 0}
+, {46, -11, -45}
+, {-38, 20, 9}}
+, {{-34, -2, 35}
+, {-33, 9, -23}
+, {-44, 45, 19}
+, {30, -8, -27}}
+, {{-47, 14, -45}
+, {-24, 14, -35}
+, {16, 32, 17}
+, {-28, 0, -47}}
+, {{-28, 6, 48}
+, {31, -23, -34}
+, {33, -24, -23}
+, {0, 0, -52}}
+, {{-32, 26, 65}
+, {-16, -23, 4}
+, {-12, 49, -31}
+, {-9, -21, -5}}
+, {{-42, 55, 52}
+, {28, 13, -25}
+, {-2, -4, -41}
+, {3, 45, 28}}
+, {{64, 46, 9}
+, {26, 42, -38}
+, {-20, -22, -49}
+, {-19, -16, 42}}
+, {{-27, -18, 36}
+, {-39, 9, -39}
+, {23, 43, -5}
+, {-49, -17, -27}}
+, {{-49, -37, 2}
+, {-20, 52, 21}
+, {32, -31, -37}
+, {53, -11, 53}}
+, {{5, -5, 40}
+, {53, 24, -21}
+, {-47, 11, 21}
+, {-35, -34, 12}}
+, {{5, -47, 48}
+, {18, 32, -40}
+, {10, 20, 3}
+, {26, -21, 13}}
+, {{64, -22, 68}
+, {0, 37, 19}
+, {-31, -23, -14}
+, {-55, -11, -2}}
+, {{-27, -24, 66}
+, {-17, -21, -22}
+, {-75, -52, 3}
+, {-32, 46, -12}}
+, {{-30, 48, 34}
+, {15, 1, 43}
+, {-48, -32, -6}
+, {30, 17, -8}}
+, {{-47, 26, 22}
+, {-23, -31, 33}
+, {-3, 7, -16}
+, {-30, -26, -43}}
+, {{31, 27, 20}
+, {22, -45, -26}
+, {-20, 2, -29}
+, {26, -30, 5}}
+, {{5, 8, -23}
+, {13, -41, 12}
+, {-12, -33, -25}
+, {36, -33, 51}}
+, {{-2, 48, -15}
+, {25, 54, -30}
+, {-13, -13, -33}
+, {38, 28, 26}}
+, {{55, 36, 60}
+, {-15, -21, -37}
+, {46, -42, 20}
+, {50, -51, -32}}
+, {{19, -34, -1}
+, {-7, 50, 47}
+, {46, -32, -9}
+, {25, -54, 2}}
+, {{-29, -36, 35}
+, {9, 6, 17}
+, {35, 46, 22}
+, {8, 41, -46}}
+, {{-32, -2, -19}
+, {10, -38, 23}
+, {-11, 34, 14}
+, {-32, 53, 29}}
+, {{28, -47, -10}
+, {-51, 2, -8}
+, {-16, -31, 2}
+, {57, 39, -23}}
+, {{-26, 51, 31}
+, {15, -45, -51}
+, {-2, -6, -11}
+, {7, 37, 38}}
+, {{-18, -23, -21}
+, {-22, 73, 9}
+, {-33, -50, -1}
+, {45, -9, -45}}
+, {{64, 60, -38}
+, {46, 10, 5}
+, {-54, -2, 15}
+, {32, 22, 12}}
+, {{-4, -33, -37}
+, {29, 37, -29}
+, {-23, 46, -39}
+, {55, 35, -4}}
+, {{54, 28, 82}
+, {35, 31, 11}
+, {39, -31, 60}
+, {-23, 49, 2}}
+, {{41, 17, -21}
+, {48, -10, -39}
+, {47, -32, -40}
+, {39, -10, 50}}
+, {{-11, -8, 11}
+, {-52, -55, -61}
+, {-3, 20, -53}
+, {-19, 33, 21}}
+, {{-1, 36, 11}
+, {11, -30, -18}
+, {45, 9, 16}
+, {25, -48, 48}}
+, {{48, -40, -41}
+, {-26, -2, 35}
+, {-47, -54, 8}
+, {-19, 44, 5}}
+, {{21, 18, 17}
+, {25, 22, 26}
+, {44, 31, -42}
+, {40, -24, -8}}
+, {{35, 39, -29}
+, {67, 48, 72}
+, {-33, 7, -5}
+, {5, 10, -8}}
+, {{49, 0, -39}
+, {52, 22, -13}
+, {-45, 16, 10}
+, {20, 27, -16}}
+, {{-52, -48, -31}
+, {-31, -42, 42}
+, {-24, 40, 23}
+, {30, -40, -26}}
+, {{60, -5, -47}
+, {12, 6, 30}
+, {-42, 39, 40}
+, {-32, 14, 5}}
+, {{52, -12, -11}
+, {66, 32, -4}
+, {-33, 42, 5}
+, {-39, -12, 8}}
+, {{-36, -1, -20}
+, {-34, -11, 37}
+, {-60, 5, 26}
+, {-54, -27, 1}}
+, {{-40, -44, 29}
+, {51, 29, 0}
+, {-20, 14, 46}
+, {-10, 1, -28}}
+, {{-24, -28, 20}
+, {-26, 37, 19}
+, {35, 39, -58}
+, {-8, 4, -35}}
+, {{-34, 31, -1}
+, {-27, -20, -30}
+, {13, 20, 32}
+, {37, -10, -41}}
+, {{2, 32, 61}
+, {10, 34, -30}
+, {9, 10, 36}
+, {-41, -39, -29}}
+, {{30, -46, -19}
+, {41, -43, 34}
+, {-12, 13, -9}
+, {15, 2, -36}}
+, {{18, -23, 42}
+, {-5, 40, -7}
+, {-12, 45, 17}
+, {41, 49, 15}}
+, {{35, 40, 11}
+, {-1, 33, 41}
+, {10, -7, 32}
+, {-50, 44, -7}}
+, {{53, -3, 48}
+, {-10, 11, 22}
+, {-14, 45, 34}
+, {7, 54, 9}}
+, {{-23, 24, -45}
+, {-34, -17, 25}
+, {0, 11, -40}
+, {17, -49, -25}}
+, {{-50, -19, -12}
+, {-29, -36, 23}
+, {-19, 1, -28}
+, {31, 10, 42}}
+, {{-16, 60, 54}
+, {42, 64, 4}
+, {23, -45, -5}
+, {-41, 16, -45}}
+, {{15, -14, 28}
+, {7, -57, -55}
+, {24, 55, -35}
+, {-35, 48, -23}}
+, {{-30, -31, -37}
+, {6, 27, 47}
+, {-1, -40, 53}
+, {-42, -3, -36}}
+, {{45, 38, 5}
+, {-34, 12, 6}
+, {-58, 14, -48}
+, {16, 25, -44}}
+, {{42, 31, 16}
+, {-33, 38, 14}
+, {40, -8, -3}
+, {-1, -44, -51}}
+, {{44, -37, 33}
+, {41, 18, 21}
+, {47, -9, -38}
+, {41, -19, -53}}
+, {{65, 56, -24}
+, {-52, -48, 43}
+, {33, 7, 39}
+, {46, 54, 0}}
+, {{-35, -4, 19}
+, {63, -30, 52}
+, {-8, -9, 32}
+, {-37, -41, -7}}
+, {{-37, 18, 47}
+, {-16, -32, -46}
+, {-2, 43, 41}
+, {-36, 18, -52}}
+, {{68, 1, -26}
+, {-9, 33, 55}
+, {-33, 8, -33}
+, {-40, -4, -58}}
+, {{-32, 4, -12}
+, {-5, -40, 0}
+, {-27, -15, -41}
+, {-38, -42, 49}}
+, {{31, -46, -53}
+, {-6, 33, 9}
+, {-5, -14, -34}
+, {35, 19, 33}}
+, {{55, -47, 38}
+, {-34, 8, 28}
+, {0, 16, 17}
+, {-4, -38, -31}}
+, {{55, 46, 59}
+, {-26, 33, 4}
+, {-54, 23, -16}
+, {23, -30, -17}}
+, {{-47, 30, 49}
+, {-14, -28, -40}
+, {2, 14, -7}
+, {49, 0, 18}}
+, {{-13, 2, 39}
+, {-30, -8, 42}
+, {31, 1, 18}
+, {-31, -19, 49}}
+, {{25, 42, -41}
+, {-9, -35, 4}
+, {-29, -21, 15}
+, {-7, 58, 29}}
+, {{42, -40, 33}
+, {-32, 5, -34}
+, {-38, -44, 0}
+, {13, 61, 20}}
+, {{22, -11, 36}
+, {64, 33, 0}
+, {17, 12, 18}
+, {-1, -44, -36}}
+, {{42, -40, -21}
+, {58, 83, 9}
+, {3, -36, 19}
+, {34, 7, 37}}
+, {{-14, 41, -25}
+, {53, -50, 39}
+, {14, -29, 18}
+, {-34, 50, -22}}
+, {{-38, -22, 39}
+, {-15, 15, -37}
+, {-49, 46, -31}
+, {-13, 56, -23}}
+, {{51, 7, 16}
+, {42, -28, 36}
+, {30, 19, 22}
+, {-3, -17, 11}}
+, {{-34, 31, 42}
+, {40, -50, 20}
+, {-8, 41, 24}
+, {19, 34, 51}}
+, {{19, -43, -23}
+, {6, 38, -18}
+, {28, -28, -41}
+, {-40, -6, -18}}
+, {{23, 16, 44}
+, {44, -4, -4}
+, {-54, 0, -45}
+, {26, 56, -46}}
+, {{24, -42, -4}
+, {25, 43, 34}
+, {17, 42, -17}
+, {-36, 24, -32}}
+, {{-6, -5, -38}
+, {4, -38, -30}
+, {-28, 34, -2}
+, {-32, 29, -50}}
+, {{5, -46, -2}
+, {-8, 49, 10}
+, {41, 29, -19}
+, {-23, -8, -46}}
+, {{23, -41, 3}
+, {32, 11, 97}
+, {41, -42, 32}
+, {-16, -5, 29}}
+, {{59, 30, -13}
+, {-12, 10, 39}
+, {-3, 23, 27}
+, {-3, -28, -71}}
+, {{34, 45, 35}
+, {-3, 8, 28}
+, {-39, 25, -63}
+, {48, 32, -25}}
+, {{-58, -17, -32}
+, {-13, 25, 28}
+, {54, 47, 8}
+, {53, 11, 19}}
+, {{31, -50, 15}
+, {-14, 20, -38}
+, {9, 5, -32}
+, {48, 0, -20}}
+, {{-4, 14, -22}
+, {-31, -64, 3}
+, {56, 31, -49}
+, {35, -27, 26}}
+, {{-20, 16, -45}
+, {17, -48, 37}
+, {55, 25, -28}
+, {67, 43, 20}}
+, {{17, -40, -44}
+, {52, 31, 3}
+, {-33, -40, -21}
+, {-56, 63, 42}}
+, {{37, 24, -37}
+, {-48, 5, -1}
+, {-44, 43, -42}
+, {13, -30, 5}}
+, {{-24, 48, -57}
+, {-17, 30, -37}
+, {-30, 1, -12}
+, {23, 54, 24}}
+, {{44, 45, -13}
+, {69, 93, 19}
+, {-22, -50, 22}
+, {8, 36, 27}}
+, {{0, 30, -41}
+, {0, -58, -30}
+, {25, -32, -30}
+, {54, 62, 63}}
+, {{-14, -38, 49}
+, {10, -3, -35}
+, {-16, -4, -17}
+, {-43, 27, 45}}
+, {{34, 46, 15}
+, {-17, 18, 0}
+, {-33, -16, 32}
+, {-45, 34, -61}}
+, {{-20, 42, -43}
+, {-38, 22, -38}
+, {-18, -26, 26}
+, {50, -27, 16}}
+, {{5, 19, -6}
+, {-2, -54, -30}
+, {56, 45, -49}
+, {-30, -40, -30}}
+, {{-39, 38, 30}
+, {-41, 35, -26}
+, {20, 18, 10}
+, {44, 60, -34}}
+, {{-22, 17, 19}
+, {42, -48, 4}
+, {-41, -60, -44}
+, {23, -28, -17}}
+, {{36, 36, 44}
+, {-1, -33, 38}
+, {42, 55, 16}
+, {-1, 24, -47}}
+, {{-50, -9, -31}
+, {45, 28, -38}
+, {0, -23, 25}
+, {0, 33, 10}}
+, {{30, 6, 21}
+, {-3, -48, 16}
+, {22, 71, 25}
+, {-49, -23, -19}}
+, {{-51, -34, -43}
+, {34, 22, -30}
+, {-12, -19, -5}
+, {-13, -48, -34}}
+, {{-40, 19, -21}
+, {-27, 32, -17}
+, {-1, 2, -36}
+, {24, -24, -45}}
+, {{26, -36, 26}
+, {51, -32, -13}
+, {-57, -15, -44}
+, {9, -5, -1}}
+, {{48, -14, 49}
+, {-9, 52, -15}
+, {48, -24, -31}
+, {-22, 41, 40}}
+, {{47, -16, -23}
+, {-13, 51, -34}
+, {-28, 53, 37}
+, {-33, -29, -34}}
+, {{0, 0, 25}
+, {-25, 60, 38}
+, {30, -27, 57}
+, {-42, 7, 19}}
+, {{45, 55, -28}
+, {-42, -51, -33}
+, {0, -10, -32}
+, {14, 47, -9}}
+, {{-12, 31, 4}
+, {0, 43, 54}
+, {-14, 52, 38}
+, {-39, -44, 25}}
+, {{39, 44, 16}
+, {23, -11, -31}
+, {-13, -45, 34}
+, {-33, -8, -50}}
+, {{-48, -14, -50}
+, {4, -39, 17}
+, {50, 11, 26}
+, {-51, 39, -4}}
+, {{-58, 14, -57}
+, {8, 35, -40}
+, {28, 26, -34}
+, {19, -30, 21}}
+, {{-38, 26, -29}
+, {42, 20, -9}
+, {43, 45, 44}
+, {49, 24, -46}}
+, {{42, 20, -7}
+, {-43, 36, 8}
+, {47, 64, -7}
+, {-48, -11, -3}}
+, {{46, 14, 20}
+, {-7, 2, -22}
+, {23, -62, -25}
+, {-53, -59, 3}}
+, {{-2, -3, -6}
+, {-13, 33, -2}
+, {-54, -31, 28}
+, {-44, 48, 46}}
+, {{-38, 44, -40}
+, {-22, 3, -9}
+, {10, 44, 7}
+, {23, -11, 36}}
+, {{-5, -16, 21}
+, {37, 53, -38}
+, {17, -36, 24}
+, {9, -12, 37}}
+, {{7, 9, 12}
+, {-40, -32, 31}
+, {-33, -44, 23}
+, {30, 35, 35}}
+, {{-43, -32, -37}
+, {4, -29, 23}
+, {-4, 27, 19}
+, {16, 26, -31}}
+, {{-24, 22, -5}
+, {15, -40, -26}
+, {-43, -44, -21}
+, {-24, 14, -48}}
+, {{37, 34, 16}
+, {54, 33, 43}
+, {-37, -8, 22}
+, {-9, 0, 7}}
+, {{52, 22, 31}
+, {20, 11, 50}
+, {-6, 35, 24}
+, {-37, 6, -11}}
+, {{56, 6, 58}
+, {-35, -50, 39}
+, {-5, -1, -13}
+, {17, 11, -42}}
+, {{15, 5, -33}
+, {-14, 49, -26}
+, {43, 9, 26}
+, {15, 40, 21}}
+, {{46, 48, 3}
+, {-29, -9, -37}
+, {-8, 50, 3}
+, {40, 27, 34}}
+, {{-24, -44, 18}
+, {-27, 1, 36}
+, {-11, 5, -44}
+, {41, 30, -44}}
+, {{20, 29, 16}
+, {23, -13, -28}
+, {-51, -14, -26}
+, {-19, -41, 24}}
+, {{-17, -37, -21}
+, {-21, -47, -52}
+, {49, -1, 15}
+, {20, 28, -20}}
+, {{-49, 26, -35}
+, {-38, -39, 22}
+, {31, -39, 8}
+, {4, -27, -23}}
+, {{60, 46, -19}
+, {32, 37, 35}
+, {35, 61, -5}
+, {37, 36, -30}}
+, {{51, -5, 52}
+, {-35, 4, 31}
+, {-54, 33, 54}
+, {27, 46, 24}}
+, {{41, 16, 20}
+, {-13, 47, 15}
+, {-47, 11, -44}
+, {-1, -35, 41}}
+, {{2, -10, 24}
+, {-22, 18, 3}
+, {46, 28, 46}
+, {-28, -39, 30}}
+, {{24, 10, -39}
+, {-47, 28, 50}
+, {33, -36, 9}
+, {6, -39, -42}}
+, {{-7, -19, 12}
+, {-47, -4, -39}
+, {-54, -33, -54}
+, {11, 37, 8}}
+, {{25, -15, 43}
+, {-8, -50, 54}
+, {28, 5, -12}
+, {-45, -33, -49}}
+, {{50, 20, -30}
+, {24, -9, 37}
+, {3, 35, 25}
+, {-42, -24, 2}}
+, {{-4, -1, -52}
+, {-3, -48, -23}
+, {-25, -49, 22}
+, {-40, -33, 8}}
+, {{-22, -51, 17}
+, {36, -34, -46}
+, {-43, -44, 11}
+, {34, -49, -49}}
+, {{-46, 26, 36}
+, {32, 18, 2}
+, {-38, -20, 31}
+, {9, 32, -2}}
+, {{21, 38, -19}
+, {47, -23, -24}
+, {9, -25, -10}
+, {9, 53, -16}}
+, {{-29, -10, 17}
+, {35, 43, 35}
+, {-6, 11, -34}
+, {-38, -31, -56}}
+, {{53, -43, 12}
+, {42, 7, 25}
+, {-50, -33, 27}
+, {26, 44, -20}}
+, {{31, -44, 21}
+, {50, 46, 44}
+, {-2, -3, -43}
+, {12, 47, 51}}
+, {{-56, -11, 30}
+, {-68, 14, 19}
+, {-47, -12, -9}
+, {-9, -4, -14}}
+, {{22, 50, 14}
+, {-36, 50, 7}
+, {-14, 37, 49}
+, {13, -4, -48}}
+, {{49, -5, 32}
+, {9, 34, 7}
+, {26, -46, -50}
+, {37, -19, -34}}
+, {{55, -23, 13}
+, {9, 37, 52}
+, {-44, 46, 0}
+, {-34, -37, 42}}
+, {{18, -22, -37}
+, {21, 6, -38}
+, {13, -3, 43}
+, {23, 47, -41}}
+, {{60, 10, 38}
+, {12, -66, -2}
+, {-21, 22, 2}
+, {26, -40, 30}}
+, {{50, 43, 30}
+, {44, -12, 50}
+, {20, 27, 27}
+, {25, 10, 9}}
+, {{-25, -10, -20}
+, {-51, 48, 31}
+, {47, -41, 28}
+, {-2, -40, 44}}
+, {{-21, 39, 37}
+, {-54, 27, -19}
+, {-43, -16, 4}
+, {9, 0, -26}}
+, {{-47, -22, -46}
+, {1, -30, -47}
+, {-53, 0, -45}
+, {48, 24, -11}}
+, {{-57, 62, -19}
+, {-19, -38, -42}
+, {-3, 14, -11}
+, {19, 43, -33}}
+, {{-31, -52, 54}
+, {22, -46, 29}
+, {-31, 50, 51}
+, {13, 34, 51}}
+, {{-52, -27, -34}
+, {-5, 20, -35}
+, {65, -35, 12}
+, {23, -23, 16}}
+, {{-43, -41, 31}
+, {-28, -32, 38}
+, {-7, -46, -11}
+, {37, -21, 14}}
+, {{10, 49, -22}
+, {-29, -44, 12}
+, {-32, -22, -13}
+, {55, 1, 27}}
+, {{18, -8, -27}
+, {-50, 14, -26}
+, {44, -47, -42}
+, {-12, -5, 32}}
+, {{-25, -20, 37}
+, {-34, -4, -54}
+, {44, 39, 6}
+, {23, -20, 18}}
+, {{41, -50, 33}
+, {-23, 14, 23}
+, {-28, -27, 36}
+, {41, -41, 0}}
+, {{11, -34, 36}
+, {50, -19, 46}
+, {37, -51, -51}
+, {23, 37, -12}}
+, {{5, 49, 19}
+, {-42, -3, -25}
+, {-69, 23, -13}
+, {26, -19, -42}}
+, {{9, 37, -51}
+, {30, -34, 37}
+, {-42, 26, -6}
+, {-83, 0, -39}}
+, {{63, 4, -19}
+, {-16, -57, 0}
+, {-12, -20, -37}
+, {36, 22, -2}}
+, {{34, 42, 35}
+, {14, 43, -20}
+, {60, 35, 46}
+, {-1, -3, -27}}
+, {{46, -45, -28}
+, {8, 3, 14}
+, {-42, -2, -21}
+, {-41, -36, -19}}
+, {{37, 36, -18}
+, {-8, 20, -52}
+, {41, -16, 38}
+, {-2, 11, -38}}
+, {{-21, 37, -25}
+, {-31, 42, 28}
+, {-23, -32, 19}
+, {30, -18, -35}}
+, {{47, 22, 34}
+, {-44, -2, -20}
+, {-17, 33, 35}
+, {-18, -9, 66}}
+, {{-34, -54, 8}
+, {-54, 41, 15}
+, {28, 32, 39}
+, {54, -53, 46}}
+, {{8, -24, 49}
+, {-45, 47, 32}
+, {9, 63, -39}
+, {25, -44, 4}}
+, {{14, -46, -3}
+, {-1, 51, 38}
+, {43, 49, -9}
+, {39, 0, -35}}
+, {{39, 11, 77}
+, {-53, -27, -4}
+, {21, 21, 50}
+, {23, 25, 11}}
+, {{38, 20, -34}
+, {-38, 12, -42}
+, {15, 23, -9}
+, {17, 52, -27}}
+, {{35, -22, 10}
+, {-42, -30, 34}
+, {18, 31, 1}
+, {50, 38, 12}}
+, {{37, 50, 35}
+, {-49, 31, 13}
+, {-18, -9, -44}
+, {-20, -7, -56}}
+, {{41, -17, 22}
+, {-42, -11, -29}
+, {1, -30, 58}
+, {25, 31, -11}}
+, {{16, -43, -43}
+, {65, 61, 21}
+, {0, -14, -13}
+, {-2, -59, 23}}
+, {{-34, -23, -9}
+, {54, 52, -3}
+, {6, -3, 24}
+, {48, 36, 0}}
+, {{43, -7, -49}
+, {-46, -1, 4}
+, {-28, 2, 3}
+, {34, -44, 45}}
+, {{-24, 15, -2}
+, {53, 2, -29}
+, {27, 43, 28}
+, {52, -8, 16}}
+, {{21, -15, 23}
+, {-15, 22, -55}
+, {-28, -38, -46}
+, {-25, 2, 13}}
+, {{-8, 46, 8}
+, {-34, 39, 50}
+, {-21, 23, 11}
+, {1, -29, 34}}
+, {{-18, -17, -46}
+, {24, -29, -10}
+, {67, 46, 30}
+, {-37, -27, 12}}
+, {{11, 25, 38}
+, {-44, 26, 60}
+, {-33, -30, 19}
+, {-36, 0, 19}}
+, {{-69, 20, 13}
+, {53, -7, 50}
+, {43, -19, 17}
+, {27, -11, -28}}
+, {{-55, -10, 5}
+, {-29, 21, -59}
+, {22, 27, -22}
+, {-30, -19, -48}}
+, {{17, 49, 17}
+, {13, -9, 34}
+, {-58, 2, 26}
+, {-36, 27, -43}}
+, {{31, 66, -47}
+, {-44, 16, -31}
+, {-8, 42, -38}
+, {25, -33, -46}}
+, {{50, -36, 10}
+, {-34, 39, 39}
+, {-41, -5, -33}
+, {25, 8, 51}}
+, {{-30, 8, 17}
+, {-54, -11, 35}
+, {-14, -3, -27}
+, {28, -33, -27}}
+, {{44, -8, 33}
+, {-2, 2, -10}
+, {55, 50, 45}
+, {42, 26, -37}}
+, {{31, -16, -24}
+, {26, 32, -28}
+, {-42, 31, 25}
+, {45, -3, 9}}
+, {{-32, -35, 41}
+, {40, -10, 47}
+, {8, 39, -31}
+, {31, 9, 49}}
+, {{-8, -44, -22}
+, {-19, 38, 38}
+, {23, 23, 23}
+, {-29, 46, 14}}
+, {{5, 5, -16}
+, {24, -43, -22}
+, {27, -34, -18}
+, {33, -27, -31}}
+, {{33, -16, -44}
+, {-4, 8, 23}
+, {-23, -36, -46}
+, {52, 5, 54}}
+, {{-36, 50, 75}
+, {2, -22, -9}
+, {-21, -52, 14}
+, {-47, -33, -46}}
+, {{-28, 44, 26}
+, {10, 23, 21}
+, {-3, -38, 48}
+, {27, -6, -26}}
+, {{24, 2, -30}
+, {-50, 24, -60}
+, {-48, 6, 2}
+, {16, 16, -43}}
+, {{51, -43, -12}
+, {22, -17, 0}
+, {-9, 32, -32}
+, {0, -48, 37}}
+, {{-19, -22, 12}
+, {45, -40, -16}
+, {-3, 18, 31}
+, {23, -33, -41}}
+, {{-59, -40, -39}
+, {32, -41, 5}
+, {4, -9, -21}
+, {10, -44, -34}}
+, {{39, -15, -42}
+, {49, -11, 5}
+, {-34, -46, -53}
+, {-29, 32, 48}}
+, {{45, -41, -20}
+, {45, 20, -16}
+, {44, -35, 50}
+, {54, -51, -37}}
+, {{29, -48, -13}
+, {-15, 34, -13}
+, {-50, -42, 27}
+, {-33, 44, 27}}
+, {{-21, 58, 19}
+, {-37, 27, -44}
+, {21, -9, -6}
+, {-18, 28, 49}}
+, {{53, 24, 17}
+, {0, -20, 2}
+, {-61, -48, -50}
+, {45, 40, 35}}
+, {{0, 44, 42}
+, {41, 0, -45}
+, {3, -6, 33}
+, {4, 28, 39}}
+, {{9, -40, 26}
+, {-67, 20, 39}
+, {-59, -78, -33}
+, {-46, -3, -5}}
+, {{-20, 1, -54}
+, {5, 55, 23}
+, {7, 50, 39}
+, {-52, -9, -40}}
+, {{33, 8, 23}
+, {6, 40, 25}
+, {34, 33, -10}
+, {16, 18, 45}}
+, {{57, 52, 13}
+, {-50, 5, -49}
+, {-45, -30, -14}
+, {-28, 50, 2}}
+, {{-11, 38, -36}
+, {38, 36, 0}
+, {-43, -1, -26}
+, {10, -15, 33}}
+, {{-12, -40, -45}
+, {40, -21, 32}
+, {26, 45, 25}
+, {24, -15, -17}}
+, {{-3, 41, -39}
+, {21, 13, 32}
+, {-36, 35, -53}
+, {2, -17, 32}}
+, {{-18, -13, 21}
+, {37, 13, -19}
+, {-44, 22, -6}
+, {-23, -8, 65}}
+, {{-11, -45, 25}
+, {32, 45, -31}
+, {-22, -39, 45}
+, {20, -46, -11}}
+, {{17, -45, -4}
+, {36, -39, -23}
+, {-12, -39, -10}
+, {57, 27, -2}}
+, {{-64, 37, -19}
+, {-28, -47, 43}
+, {8, -23, -41}
+, {49, -49, 13}}
+, {{31, 57, 13}
+, {26, -51, 14}
+, {22, -44, 34}
+, {36, 32, -11}}
+, {{47, 12, -69}
+, {48, -20, -36}
+, {-4, -8, -55}
+, {-37, -19, 2}}
+, {{-43, -37, -42}
+, {23, 52, 42}
+, {8, -19, -45}
+, {37, 61, 38}}
+, {{20, -13, 8}
+, {-12, -32, 57}
+, {63, -35, -28}
+, {-12, -13, -11}}
+, {{17, 4, 54}
+, {-46, -33, 18}
+, {-9, -45, -37}
+, {18, 38, 23}}
+, {{-28, 32, 11}
+, {16, 35, 34}
+, {-32, -21, -29}
+, {17, 32, 55}}
+, {{-10, 25, -38}
+, {13, 8, -33}
+, {37, 59, -38}
+, {21, 22, -47}}
+, {{29, 51, -21}
+, {-27, 34, -45}
+, {-4, 3, -5}
+, {-46, 54, -47}}
+, {{-35, -21, -39}
+, {-34, 56, -25}
+, {32, 31, -16}
+, {-39, -4, 34}}
+, {{58, 50, -41}
+, {33, -4, 23}
+, {28, -10, -39}
+, {-41, -43, -12}}
+, {{50, 5, -41}
+, {-8, 35, 2}
+, {37, -9, 36}
+, {17, -42, 30}}
+, {{53, 52, 10}
+, {-22, -26, -36}
+, {41, 26, 45}
+, {-30, 11, 37}}
+, {{54, -5, -6}
+, {53, 40, -29}
+, {-5, -14, -46}
+, {-11, 51, 6}}
+, {{33, -15, 44}
+, {37, 6, -24}
+, {-26, -54, -51}
+, {42, 27, 33}}
+, {{27, -3, -35}
+, {18, -20, 35}
+, {-13, 41, -34}
+, {25, 39, -6}}
+, {{-18, 38, 55}
+, {27, -28, -27}
+, {-29, 52, 1}
+, {7, 7, -51}}
+, {{17, -43, -2}
+, {24, 13, -43}
+, {-35, 41, -8}
+, {13, 19, 38}}
+, {{-22, -29, -25}
+, {3, -59, -53}
+, {-62, -30, -44}
+, {-19, 15, -3}}
+, {{-18, 45, 35}
+, {38, 40, -28}
+, {17, 46, 11}
+, {-5, 39, -10}}
+, {{36, -7, -40}
+, {-20, -20, 11}
+, {-15, -38, -49}
+, {-40, -47, 7}}
+, {{44, -34, -53}
+, {22, -26, 8}
+, {-31, -68, 11}
+, {0, 58, 20}}
+, {{28, -32, -2}
+, {36, 49, 40}
+, {9, 35, 55}
+, {-42, 23, 40}}
+, {{-40, -2, 37}
+, {-23, 27, 17}
+, {51, 56, 19}
+, {29, 15, -46}}
+, {{-25, -29, 51}
+, {-45, 43, 53}
+, {-11, -46, 49}
+, {5, 12, 17}}
+, {{32, -33, 6}
+, {9, -33, 16}
+, {50, 43, 39}
+, {-53, -43, 43}}
+, {{45, -23, 41}
+, {-19, 13, -35}
+, {-14, 48, -38}
+, {-46, 50, 12}}
+, {{-40, 18, -9}
+, {-29, -20, -47}
+, {-57, 51, 20}
+, {-8, -34, -54}}
+, {{-34, -20, 25}
+, {25, -41, -48}
+, {-20, -26, 38}
+, {-14, 30, -51}}
+, {{-48, 32, 39}
+, {34, 25, -41}
+, {-1, 35, -41}
+, {-8, 26, -7}}
+, {{-47, -49, -4}
+, {31, -12, -57}
+, {38, 40, 24}
+, {-11, -11, -30}}
+, {{38, -21, 9}
+, {15, 43, 23}
+, {42, 44, 25}
+, {29, -20, 30}}
+, {{37, -18, 43}
+, {27, -9, 17}
+, {-29, -15, -29}
+, {-32, 40, 5}}
+, {{11, 22, 17}
+, {-32, 53, 23}
+, {-39, -20, -42}
+, {-48, 20, -20}}
+, {{16, 47, -29}
+, {-5, -43, -55}
+, {-17, 21, -52}
+, {15, 8, 41}}
+, {{40, -25, 47}
+, {42, 35, -12}
+, {26, 41, -57}
+, {-33, -25, 22}}
+, {{-39, 50, -6}
+, {-26, -39, 10}
+, {-43, -17, 40}
+, {49, 45, -30}}
+, {{5, -40, 8}
+, {63, 50, -30}
+, {-32, -42, -4}
+, {10, -37, -37}}
+, {{37, 14, -22}
+, {33, 45, -24}
+, {26, 36, 8}
+, {59, -58, 49}}
+, {{45, -33, -45}
+, {9, 3, -27}
+, {-32, -18, 19}
+, {-1, -31, -49}}
+, {{37, 6, -48}
+, {-46, -38, -32}
+, {-13, -3, 47}
+, {62, 22, 65}}
+, {{-30, 67, 50}
+, {24, 37, 37}
+, {-65, -2, 5}
+, {-51, 15, 22}}
+, {{-1, 49, -44}
+, {49, 5, -21}
+, {-42, -15, -31}
+, {0, 3, 57}}
+, {{13, -35, 35}
+, {10, -24, 3}
+, {48, 60, 14}
+, {-22, 33, -11}}
+, {{34, -37, -56}
+, {-5, 23, 25}
+, {-41, 17, -39}
+, {-29, -43, -57}}
+, {{46, 6, -8}
+, {-20, 13, -24}
+, {30, 23, 45}
+, {5, 40, -38}}
+, {{36, 40, -24}
+, {51, -35, 22}
+, {43, -21, -29}
+, {17, 39, 2}}
+, {{38, -37, -15}
+, {51, 16, 21}
+, {-28, -42, 41}
+, {-1, -7, -8}}
+, {{6, 13, 31}
+, {-42, 21, 24}
+, {42, -25, 35}
+, {37, -47, 27}}
+, {{-7, -21, -25}
+, {-37, 21, -37}
+, {24, -49, -52}
+, {-38, -5, -8}}
+, {{-21, 41, 39}
+, {-26, -37, 2}
+, {-23, -1, -10}
+, {32, 37, 52}}
+, {{-28, -33, 45}
+, {55, 13, 20}
+, {-29, 0, -17}
+, {-12, -46, -34}}
+, {{21, -5, -66}
+, {13, 7, -43}
+, {39, 52, -9}
+, {-12, 11, -18}}
+, {{49, -4, -40}
+, {23, -37, -51}
+, {-17, -22, 49}
+, {-1, -55, -18}}
+, {{39, 23, 12}
+, {-36, 19, 16}
+, {-43, -44, -51}
+, {9, -1, 32}}
+, {{-10, -8, -24}
+, {46, -35, -14}
+, {-17, 30, -27}
+, {-25, -36, -34}}
+, {{8, -37, 49}
+, {44, 33, -25}
+, {-6, 43, 22}
+, {-12, -1, -58}}
+, {{11, 44, 17}
+, {35, 33, -13}
+, {4, -23, -14}
+, {-14, 24, 60}}
+, {{45, 36, -11}
+, {-48, -22, 44}
+, {-7, 41, 6}
+, {3, -10, 43}}
+, {{31, 10, -24}
+, {-1, -31, -22}
+, {0, 37, -21}
+, {-47, 58, -11}}
+, {{42, -31, 14}
+, {11, 2, -25}
+, {-47, 66, -48}
+, {-15, -10, -46}}
+, {{30, 30, 31}
+, {-50, -43, -42}
+, {16, 24, 38}
+, {19, -5, -2}}
+, {{-50, 14, 11}
+, {46, -1, 15}
+, {-36, 47, 43}
+, {-15, -62, -5}}
+, {{47, 32, 43}
+, {61, 4, -39}
+, {-21, -37, -7}
+, {-6, 23, 33}}
+, {{-23, -31, 29}
+, {48, 35, -12}
+, {-18, 3, 29}
+, {66, -39, -19}}
+, {{19, -14, -20}
+, {-42, -48, -53}
+, {-38, 27, 13}
+, {-32, 33, 20}}
+, {{-53, 10, -46}
+, {16, 31, -5}
+, {-37, 21, -25}
+, {-46, -28, 44}}
+, {{58, -20, 45}
+, {0, 0, -41}
+, {25, 52, -3}
+, {-9, 64, -12}}
+, {{0, -10, 19}
+, {-9, 2, 1}
+, {61, 9, 67}
+, {55, -50, -30}}
+, {{33, -21, -15}
+, {16, 8, -47}
+, {38, -23, 57}
+, {50, -10, 44}}
+, {{-2, 37, 32}
+, {-18, -48, -18}
+, {3, -38, -21}
+, {-21, 28, -42}}
+, {{-12, -13, -7}
+, {47, 51, 4}
+, {30, -9, 17}
+, {-50, 26, 18}}
+, {{-41, 40, 56}
+, {-46, -60, -59}
+, {-5, -71, -24}
+, {2, -35, -62}}
+, {{-26, 24, 36}
+, {-33, -32, 12}
+, {-45, -6, 53}
+, {-38, -39, -35}}
+, {{28, 0, 31}
+, {2, -46, -22}
+, {-28, 63, -9}
+, {44, 46, 31}}
+, {{-41, 23, -10}
+, {10, -2, -23}
+, {-33, 24, 34}
+, {-44, 9, 47}}
+, {{-48, -13, 3}
+, {-38, 45, 42}
+, {-10, -35, -27}
+, {26, 13, 25}}
+, {{1, 31, 21}
+, {0, 57, -22}
+, {-24, 61, 10}
+, {-22, 10, -25}}
+, {{10, 45, 47}
+, {-55, -15, 37}
+, {-34, -13, -34}
+, {4, 47, -17}}
+, {{-43, 39, 16}
+, {-24, -2, -37}
+, {-67, 35, 33}
+, {-22, 48, 32}}
+, {{-18, -13, -30}
+, {29, 41, 17}
+, {55, -42, 33}
+, {-3, 20, -65}}
+, {{7, 44, -43}
+, {38, -35, 16}
+, {1, -29, 46}
+, {-52, -4, 36}}
+, {{-11, 8, -14}
+, {-48, 0, -42}
+, {-42, -39, -58}
+, {48, 18, -33}}
+, {{12, -8, -36}
+, {-5, 39, -24}
+, {25, -27, 34}
+, {37, -35, -30}}
+, {{44, -43, 46}
+, {-1, 5, -24}
+, {20, -45, 40}
+, {19, -34, 43}}
+, {{-28, 58, 27}
+, {39, 22, -14}
+, {49, 0, -18}
+, {-40, -11, -33}}
+, {{0, -27, 5}
+, {44, 26, 56}
+, {1, -29, -38}
+, {22, 37, 4}}
+, {{10, 12, 35}
+, {24, 15, 38}
+, {-47, -21, -34}
+, {-16, -23, 41}}
+, {{-1, -47, 43}
+, {-43, -48, -45}
+, {30, -5, -2}
+, {15, 39, -49}}
+, {{31, -6, 21}
+, {-22, -42, -49}
+, {46, -34, -13}
+, {14, 14, -12}}
+, {{15, 61, -23}
+, {-28, 7, 4}
+, {26, 5, 45}
+, {-38, 30, 27}}
+, {{-46, 40, 46}
+, {-36, 24, -47}
+, {-25, -2, -49}
+, {47, -28, 3}}
+, {{31, 33, 46}
+, {-32, 30, 18}
+, {-38, 12, 31}
+, {-22, 45, 37}}
+, {{3, -24, 36}
+, {37, -6, -29}
+, {52, 27, -24}
+, {-19, -22, -11}}
+, {{-38, -15, 22}
+, {13, 21, 4}
+, {41, 52, 32}
+, {-28, 25, -15}}
+, {{-23, -3, -6}
+, {49, -27, -34}
+, {46, 17, 55}
+, {-58, -7, 23}}
+, {{-14, 30, 55}
+, {35, 8, 40}
+, {-33, -55, -37}
+, {-10, -15, -45}}
+, {{42, -20, -22}
+, {72, -28, 41}
+, {19, 35, -20}
+, {-10, -55, -42}}
+, {{12, -40, 39}
+, {14, 45, -34}
+, {4, 51, 35}
+, {-45, 27, 9}}
+, {{65, -29, 50}
+, {-31, 37, -4}
+, {0, 26, -59}
+, {50, 14, 60}}
+, {{56, -6, 26}
+, {25, -28, -20}
+, {-32, -20, 14}
+, {9, 2, 48}}
+, {{-42, 47, 1}
+, {-43, 39, 43}
+, {38, -10, 0}
+, {-10, -31, 22}}
+, {{18, -1, 22}
+, {-40, -47, -57}
+, {-40, 20, -3}
+, {-22, 32, 31}}
+, {{-7, -1, 4}
+, {38, -23, 11}
+, {11, 25, -27}
+, {-54, 42, 44}}
+, {{38, 14, -42}
+, {2, 16, 36}
+, {-17, 5, 56}
+, {-37, -74, 30}}
+, {{-19, 43, -51}
+, {-44, 41, -8}
+, {7, -37, 42}
+, {19, -33, 0}}
+, {{14, 39, -31}
+, {-11, -22, -43}
+, {-33, 28, -29}
+, {51, 6, 32}}
+, {{-18, 18, -15}
+, {40, -6, 48}
+, {48, 18, 19}
+, {-33, -12, -42}}
+, {{-44, -24, 48}
+, {47, -52, -28}
+, {44, 8, -25}
+, {39, 31, -23}}
+, {{56, -8, -20}
+, {-28, 6, -25}
+, {-15, 49, 3}
+, {55, -37, 13}}
+, {{-42, 21, -50}
+, {20, 11, 47}
+, {4, 48, 17}
+, {-20, 22, 54}}
+, {{-28, -39, 21}
+, {-52, 63, 44}
+, {-48, -49, -54}
+, {-41, 18, -20}}
+, {{30, -24, 15}
+, {-9, -21, 6}
+, {-31, -48, -54}
+, {-35, -11, 1}}
+, {{-13, 15, 44}
+, {-32, 54, 21}
+, {30, 39, 24}
+, {-31, 57, -21}}
+, {{-48, 16, -4}
+, {6, 5, 38}
+, {-29, -11, -30}
+, {-24, -34, -42}}
+, {{86, -9, 80}
+, {-15, -8, 3}
+, {3, 4, -18}
+, {66, -40, 56}}
+, {{-42, -13, -26}
+, {10, -3, 23}
+, {-13, 19, 47}
+, {33, -29, 34}}
+, {{51, -19, 38}
+, {47, 50, 21}
+, {-47, -19, 30}
+, {-37, 19, -43}}
+, {{0, -33, -8}
+, {-42, 0, -24}
+, {-50, 38, 21}
+, {19, -46, -8}}
+, {{45, 52, -5}
+, {23, 30, -47}
+, {-19, -24, 25}
+, {52, -29, 40}}
+, {{-23, -10, -42}
+, {12, -7, -15}
+, {46, -49, -13}
+, {21, -7, -37}}
+, {{19, -11, -46}
+, {13, -30, 10}
+, {47, 35, 32}
+, {47, -12, -1}}
+, {{44, -23, -24}
+, {-2, -43, 11}
+, {31, -32, 15}
+, {21, -42, -18}}
+, {{24, -18, 9}
+, {-45, 5, 19}
+, {53, 41, 40}
+, {16, 28, -48}}
+, {{-42, -10, 60}
+, {47, -32, 39}
+, {-26, -33, 55}
+, {9, -29, -14}}
+, {{-23, -33, 41}
+, {-30, 49, -54}
+, {0, -25, 9}
+, {15, -18, -39}}
+, {{-57, -25, -55}
+, {-1, -11, 39}
+, {5, -5, -45}
+, {1, 36, 51}}
+, {{48, 29, 0}
+, {33, -51, -42}
+, {17, -21, 0}
+, {-49, 11, -17}}
+, {{-22, 27, -32}
+, {-1, -50, 48}
+, {-55, 34, -21}
+, {47, 23, 36}}
+, {{0, -48, -10}
+, {-48, 12, -43}
+, {26, 32, -34}
+, {29, 16, 24}}
+, {{0, -4, 50}
+, {-35, -30, 40}
+, {-7, -35, 11}
+, {-42, 22, 51}}
+, {{39, 19, 41}
+, {-17, -26, -27}
+, {57, -23, 5}
+, {2, 7, 40}}
+, {{-39, -41, 0}
+, {-22, -6, 40}
+, {41, -35, 5}
+, {24, -25, -56}}
+, {{-8, -40, -47}
+, {-25, 0, 25}
+, {52, 33, -27}
+, {32, -32, -41}}
+, {{-45, -49, 37}
+, {-33, 33, -24}
+, {-45, 1, 10}
+, {-40, 42, 10}}
+, {{-41, 41, 6}
+, {13, -34, -25}
+, {-45, -30, -17}
+, {-47, -16, 37}}
+, {{30, 35, 14}
+, {20, -2, 41}
+, {-39, 15, -4}
+, {37, 27, 25}}
+, {{-11, 50, -21}
+, {22, -35, 51}
+, {33, -31, 3}
+, {4, -40, 52}}
+, {{11, 16, 6}
+, {-10, 67, 48}
+, {-33, -44, -22}
+, {44, -30, 34}}
+, {{42, -44, 25}
+, {60, -2, -49}
+, {39, -21, -44}
+, {-1, 5, -35}}
+, {{1, 19, -8}
+, {32, 24, -32}
+, {17, 49, -34}
+, {-36, -42, 42}}
+, {{42, 24, -46}
+, {36, -2, -46}
+, {-49, 45, -38}
+, {-18, 12, -22}}
+, {{-68, 21, -55}
+, {28, -46, 36}
+, {27, -41, 49}
+, {-2, 6, 47}}
+, {{44, 32, 38}
+, {-38, -50, 11}
+, {74, -24, -14}
+, {25, -26, -6}}
+, {{-48, 39, 3}
+, {-5, 27, -12}
+, {18, 12, 62}
+, {34, 32, -23}}
+, {{26, -27, -44}
+, {48, 33, 59}
+, {-20, -26, -24}
+, {-54, -60, 7}}
+, {{-29, 14, 32}
+, {-31, 42, 55}
+, {48, -19, 43}
+, {28, -28, -44}}
+, {{13, -34, -34}
+, {-35, 49, 26}
+, {18, 31, -21}
+, {-16, -42, -26}}
+, {{-20, 55, -10}
+, {6, 13, 0}
+, {-5, 38, 51}
+, {12, 47, 31}}
+, {{25, -37, 61}
+, {-50, -8, -51}
+, {25, 20, -5}
+, {-11, 22, 31}}
+, {{11, -43, -37}
+, {-20, 31, 45}
+, {-5, -47, -56}
+, {-6, -62, -41}}
+, {{-50, -40, -36}
+, {-42, 47, 44}
+, {-10, -39, -25}
+, {8, -64, 16}}
+, {{-24, -36, -27}
+, {59, -43, 59}
+, {9, -7, -44}
+, {-30, 25, 1}}
+, {{0, -25, -25}
+, {-42, -53, 32}
+, {-3, 55, 44}
+, {49, 38, 13}}
+, {{-37, -48, -6}
+, {41, -3, -38}
+, {-4, 40, 43}
+, {-40, -8, -47}}
+, {{40, 49, -46}
+, {-36, 13, -44}
+, {-23, 3, 5}
+, {56, -17, 8}}
+, {{-41, -52, -5}
+, {31, -26, -29}
+, {37, 22, -25}
+, {-42, 0, 6}}
+, {{0, 24, -18}
+, {60, 33, -53}
+, {-5, 24, -19}
+, {-15, 54, -37}}
+, {{-36, 20, 43}
+, {14, 4, 11}
+, {23, -28, -18}
+, {26, 24, 40}}
+, {{-8, -17, -17}
+, {37, 29, -28}
+, {-46, 47, -20}
+, {27, 20, 38}}
+, {{44, -51, -9}
+, {-13, 49, -39}
+, {-40, 33, -38}
+, {28, 31, -50}}
+, {{-42, -16, 49}
+, {25, 37, 45}
+, {11, 0, -47}
+, {-17, -8, -60}}
+, {{-22, 21, -55}
+, {16, -11, -14}
+, {29, 31, -50}
+, {17, 8, -53}}
+, {{21, -16, -20}
+, {0, -71, 36}
+, {33, -30, 28}
+, {0, 2, -46}}
+, {{68, 51, -18}
+, {42, 22, -18}
+, {13, -3, 11}
+, {-42, 0, -53}}
+, {{-21, -50, 33}
+, {4, 43, -18}
+, {39, -3, -21}
+, {17, 32, 12}}
+, {{22, 61, 52}
+, {15, 1, 82}
+, {18, 6, -4}
+, {-15, -34, 15}}
+, {{-8, 26, 33}
+, {-33, -15, 0}
+, {-39, 44, 40}
+, {5, -31, -9}}
+, {{18, -1, -32}
+, {3, -63, 12}
+, {46, 23, 62}
+, {43, -22, 27}}
+, {{16, 58, -30}
+, {21, 19, 32}
+, {46, 29, 31}
+, {33, 35, -21}}
+, {{-3, -1, -20}
+, {36, 15, 35}
+, {-40, 50, -48}
+, {1, -24, -29}}
+, {{26, 35, 24}
+, {-32, -27, -21}
+, {-38, -25, 1}
+, {-28, 36, 34}}
+, {{34, 40, -8}
+, {0, 66, 53}
+, {40, 10, -44}
+, {36, 0, 17}}
+, {{-85, -59, 4}
+, {-25, -10, -6}
+, {-6, -9, -37}
+, {36, 5, 24}}
+, {{27, 52, -42}
+, {5, 25, 22}
+, {-4, 0, 23}
+, {7, 29, 49}}
+, {{40, -40, 7}
+, {-16, 35, -46}
+, {52, -43, 12}
+, {36, -20, 42}}
+, {{6, -45, 9}
+, {31, 52, -19}
+, {22, 46, 51}
+, {-47, 42, 9}}
+, {{-27, 26, 48}
+, {-49, -50, -21}
+, {21, -31, -13}
+, {-37, -43, 7}}
+, {{29, -24, 36}
+, {41, -37, -22}
+, {28, -17, -43}
+, {27, 18, 56}}
+, {{-21, 38, -18}
+, {-16, -35, -38}
+, {26, -24, 43}
+, {24, -35, 47}}
+, {{-41, 17, -30}
+, {10, -51, 24}
+, {24, 18, 45}
+, {-10, -22, -8}}
+, {{37, 6, 56}
+, {-27, 36, -12}
+, {5, -22, 18}
+, {12, -27, 34}}
+, {{-10, -37, 3}
+, {46, 13, -30}
+, {-48, 30, 5}
+, {22, 32, 43}}
+, {{32, -44, 30}
+, {46, -40, 3}
+, {22, -39, 22}
+, {2, -34, 3}}
+, {{30, -15, 43}
+, {28, 3, 19}
+, {-15, -33, -18}
+, {-4, 42, 39}}
+, {{30, -20, -43}
+, {34, -17, 21}
+, {16, 20, 5}
+, {-24, -48, -14}}
+, {{-16, -37, -9}
+, {8, 33, -26}
+, {33, -26, -14}
+, {-39, 38, 49}}
+, {{3, 19, 13}
+, {37, 9, -38}
+, {52, -40, 36}
+, {-48, -46, -56}}
+, {{41, 42, 28}
+, {-46, -30, 0}
+, {39, -20, -14}
+, {18, -30, -4}}
+, {{-55, -14, -10}
+, {-30, 24, -32}
+, {-13, 31, 27}
+, {30, -19, 24}}
+, {{51, -4, 27}
+, {-34, -15, 21}
+, {-26, -34, 3}
+, {40, 19, 36}}
+, {{-7, 34, 21}
+, {1, 18, 2}
+, {54, 52, -14}
+, {25, -39, 26}}
+, {{12, -48, -32}
+, {43, -38, -17}
+, {9, -39, 33}
+, {-13, -32, -29}}
+, {{44, 51, 38}
+, {5, -14, 2}
+, {-29, 0, -15}
+, {-36, -44, -23}}
+, {{47, -34, -51}
+, {-18, -50, -40}
+, {29, -23, 50}
+, {-10, -40, 15}}
+, {{-46, -17, -46}
+, {-7, -34, -10}
+, {-30, -1, -54}
+, {40, -16, -16}}
+, {{-23, -30, -21}
+, {-20, -49, -57}
+, {-23, 43, 21}
+, {35, -23, -23}}
+, {{-25, 32, 58}
+, {40, 33, 36}
+, {-21, -15, 20}
+, {-4, 44, -40}}
+, {{21, 35, 7}
+, {-37, -50, 40}
+, {-42, 53, -41}
+, {-14, -36, 6}}
+, {{57, 36, -1}
+, {0, -47, -8}
+, {-46, -14, 2}
+, {41, -5, 37}}
+, {{38, 45, 2}
+, {4, 9, -24}
+, {16, 29, -42}
+, {-32, -36, 40}}
+, {{51, 76, -2}
+, {49, 4, 10}
+, {45, 11, 24}
+, {4, 19, -30}}
+, {{8, 9, 61}
+, {-28, 7, 33}
+, {33, 42, 46}
+, {44, -34, -8}}
+, {{4, 42, 25}
+, {57, -19, -39}
+, {0, 9, -12}
+, {-36, -48, 18}}
+, {{-1, 51, 40}
+, {-45, -18, -27}
+, {-46, -58, -31}
+, {51, 56, -33}}
+, {{29, -20, 34}
+, {-41, 12, -2}
+, {25, 56, 20}
+, {-6, -30, -38}}
+, {{-28, -2, -17}
+, {26, -36, -47}
+, {33, 8, 40}
+, {-27, 17, 24}}
+, {{49, -5, -35}
+, {-11, -17, -52}
+, {58, 36, -28}
+, {-33, 0, 32}}
+, {{-27, 18, 5}
+, {-3, -25, 6}
+, {49, -8, 51}
+, {-49, -13, -35}}
+, {{66, 35, 7}
+, {9, 4, -15}
+, {-48, 22, -48}
+, {35, -39, 8}}
+, {{-32, 43, 45}
+, {30, 50, 11}
+, {1, 21, 44}
+, {16, -53, 4}}
+, {{31, 1, -41}
+, {-1, 20, 31}
+, {26, 41, -35}
+, {16, 45, 10}}
+, {{35, 5, 34}
+, {-23, -28, -57}
+, {10, -12, -27}
+, {19, 33, 29}}
+, {{-2, 9, 53}
+, {46, -32, 15}
+, {44, 18, -35}
+, {7, 33, 42}}
+, {{-11, 18, -24}
+, {-7, -48, -6}
+, {-46, -44, -11}
+, {-44, 7, -19}}
+, {{30, 62, -7}
+, {-30, -51, 43}
+, {-54, -41, -2}
+, {35, -33, -53}}
+, {{5, -50, 22}
+, {-12, -10, 12}
+, {42, 12, -30}
+, {-46, 39, 24}}
+, {{-50, -22, 44}
+, {-29, 15, -14}
+, {50, 15, -2}
+, {-14, -49, -17}}
+, {{23, -35, 11}
+, {20, -50, 31}
+, {19, 13, 25}
+, {-49, -32, -2}}
+, {{25, 15, 11}
+, {9, -39, -56}
+, {35, 4, 47}
+, {42, 2, -11}}
+, {{35, 15, 27}
+, {-39, 7, 3}
+, {43, 27, 40}
+, {-50, 17, -10}}
+, {{-46, 4, -6}
+, {28, -11, 31}
+, {9, -52, 53}
+, {-23, 39, 14}}
+, {{-49, -43, -24}
+, {-8, 32, -26}
+, {4, 25, -32}
+, {-35, -23, 14}}
+, {{38, 10, 0}
+, {-40, -29, 44}
+, {47, 16, 1}
+, {-31, 0, -54}}
+, {{-50, 9, 12}
+, {32, 3, 61}
+, {-49, -41, -55}
+, {-37, -2, -51}}
+, {{-37, -47, 26}
+, {54, 2, -13}
+, {29, 31, -25}
+, {46, 39, -47}}
+, {{-28, 26, 3}
+, {-14, 13, -3}
+, {-66, -58, 0}
+, {16, 18, -58}}
+, {{-54, -33, -23}
+, {32, -37, -48}
+, {23, -5, -52}
+, {56, -43, 28}}
+, {{-38, -32, -50}
+, {31, -30, 11}
+, {8, 50, 14}
+, {8, 56, 31}}
+, {{33, 47, -27}
+, {5, -12, -40}
+, {-26, 49, 50}
+, {0, -30, -16}}
+, {{55, 36, -31}
+, {10, -22, -41}
+, {-5, -43, 4}
+, {0, -18, -53}}
+, {{-16, -20, 54}
+, {22, 9, -13}
+, {2, -26, -46}
+, {34, -29, -27}}
+, {{-27, -47, -2}
+, {68, 4, 15}
+, {-30, -37, -38}
+, {-24, -35, 0}}
+, {{37, -42, -9}
+, {-4, 38, 65}
+, {-26, 16, 0}
+, {-5, 3, 38}}
+, {{-19, -56, 30}
+, {45, 50, 21}
+, {0, -20, 54}
+, {-8, 20, -8}}
+, {{40, -29, 28}
+, {-56, -43, 15}
+, {-36, -42, -56}
+, {49, 26, -22}}
+, {{37, 56, 61}
+, {45, 38, 45}
+, {-39, -36, -44}
+, {-36, -4, -24}}
+, {{-25, -12, 10}
+, {35, 20, 23}
+, {33, 16, -25}
+, {-53, 45, -11}}
+, {{14, 53, 28}
+, {51, -18, 10}
+, {-9, 50, 8}
+, {0, 46, -13}}
+, {{0, -27, 41}
+, {-37, 58, -38}
+, {33, -12, 1}
+, {28, -56, 5}}
+, {{5, 32, 29}
+, {3, -44, -6}
+, {-13, -44, 35}
+, {36, -17, -22}}
+, {{-6, -25, -48}
+, {-38, 36, -39}
+, {42, 9, -56}
+, {44, -41, -17}}
+, {{-39, -44, -8}
+, {27, 53, 11}
+, {11, 37, -46}
+, {43, -24, 34}}
+, {{-20, -16, -30}
+, {-8, 68, 61}
+, {-36, -52, -28}
+, {10, -71, -1}}
+, {{38, 3, 38}
+, {-12, 50, -11}
+, {-35, -45, 2}
+, {-10, -27, 11}}
+, {{-39, -7, 25}
+, {42, 10, 7}
+, {41, -1, -9}
+, {67, 66, 56}}
+, {{-2, 21, 50}
+, {25, 32, 40}
+, {-12, 36, 4}
+, {-30, -54, -46}}
+, {{-31, 7, -20}
+, {67, 44, -15}
+, {35, -16, 47}
+, {-16, 29, 32}}
+, {{9, -30, -43}
+, {-20, 10, -75}
+, {-29, 5, -9}
+, {-23, 34, 31}}
+, {{52, -9, -20}
+, {60, -11, -31}
+, {28, 1, 45}
+, {36, 4, -10}}
+, {{8, 24, -3}
+, {37, -19, 32}
+, {-26, 49, -37}
+, {21, -42, 33}}
+, {{-28, 4, -34}
+, {47, 30, -1}
+, {-25, 4, -54}
+, {39, -15, -1}}
+, {{-58, 11, -50}
+, {-30, 19, 33}
+, {23, 4, -9}
+, {28, 58, 22}}
+, {{-23, 31, 53}
+, {-38, -42, 36}
+, {53, -2, 3}
+, {33, -10, 16}}
+, {{23, 19, -26}
+, {-30, -31, 43}
+, {-27, -4, -37}
+, {22, -35, 23}}
+, {{-24, 32, -36}
+, {-23, 30, 11}
+, {-43, 33, -46}
+, {61, -36, -6}}
+, {{29, -14, 23}
+, {55, 12, 76}
+, {-9, -18, -43}
+, {36, 53, -52}}
+, {{-12, 34, -34}
+, {-46, 11, -38}
+, {27, 51, -6}
+, {47, 43, 1}}
+, {{52, -16, 52}
+, {41, -2, 48}
+, {8, -43, 19}
+, {-8, -12, 14}}
+, {{44, -25, 27}
+, {-29, 0, -48}
+, {-20, 47, -46}
+, {-10, 4, 37}}
+, {{35, -16, 58}
+, {15, -37, -15}
+, {-39, 17, 31}
+, {48, 12, 9}}
+, {{39, 21, 43}
+, {14, 45, -12}
+, {9, -11, 18}
+, {-27, -55, -45}}
+, {{-21, -37, 55}
+, {24, 45, -9}
+, {46, 32, 32}
+, {36, -19, 27}}
+, {{9, 40, -6}
+, {10, 37, -48}
+, {17, 21, -41}
+, {-27, 0, 50}}
+, {{-19, 28, 35}
+, {-8, 3, 37}
+, {-19, 27, -33}
+, {-36, 43, 0}}
+, {{-42, -19, 40}
+, {16, 26, -43}
+, {40, -38, 28}
+, {-18, 5, 46}}
+, {{2, 8, 35}
+, {80, -6, 59}
+, {-30, 12, -34}
+, {-34, 36, 42}}
+, {{-24, -5, 0}
+, {-9, 32, -25}
+, {-34, 21, 51}
+, {-24, -51, -35}}
+, {{-53, -47, -53}
+, {-15, -3, 27}
+, {-4, 15, 14}
+, {-61, 15, -19}}
+, {{32, -21, 7}
+, {-47, -38, -44}
+, {-5, 17, -56}
+, {21, 25, -43}}
+, {{-53, 21, 33}
+, {14, 24, -33}
+, {10, -42, -43}
+, {-31, -7, -22}}
+, {{25, 1, 49}
+, {57, 42, 5}
+, {10, 12, -32}
+, {-46, -46, -20}}
+, {{-12, -42, -5}
+, {20, -32, 36}
+, {19, 48, -68}
+, {22, 54, -32}}
+, {{-15, 3, 59}
+, {-41, 33, -6}
+, {32, 23, 53}
+, {35, -36, -13}}
+, {{-29, -23, 27}
+, {-17, 26, -13}
+, {52, -22, 44}
+, {-4, 29, 25}}
+, {{10, 52, -14}
+, {32, -4, 55}
+, {29, -39, 28}
+, {-7, -39, 38}}
+, {{-50, 6, -27}
+, {49, 45, -31}
+, {-30, 23, -37}
+, {46, 47, 25}}
+, {{-33, -4, 25}
+, {38, 46, 10}
+, {-31, -3, -48}
+, {-50, -24, 10}}
+, {{-7, -20, -27}
+, {13, 22, 48}
+, {33, -42, 8}
+, {45, -26, 47}}
+, {{13, 28, 24}
+, {20, -47, -41}
+, {30, 21, 33}
+, {-50, 14, 43}}
+, {{39, -40, -29}
+, {-30, 23, -4}
+, {37, 45, -8}
+, {10, 4, 45}}
+, {{-24, 33, -50}
+, {12, -39, 13}
+, {-18, -58, -18}
+, {50, -20, 4}}
+, {{-31, 47, 5}
+, {-39, -26, 0}
+, {-13, -17, 41}
+, {-36, -29, 30}}
+, {{22, -33, -49}
+, {38, -1, -33}
+, {21, 13, -14}
+, {48, -16, -18}}
+, {{-3, 51, -28}
+, {-31, 26, 38}
+, {54, 48, 22}
+, {17, 6, -29}}
+, {{33, -60, 24}
+, {48, -21, 5}
+, {-28, 37, 5}
+, {-5, -14, 40}}
+, {{-25, -39, -48}
+, {-31, 6, 33}
+, {-7, 5, 38}
+, {-33, 5, -28}}
+, {{35, -46, 10}
+, {-9, 13, 10}
+, {12, -29, 45}
+, {-20, -39, -25}}
+, {{16, 14, -50}
+, {-2, 13, 10}
+, {45, 18, 53}
+, {-3, -43, -32}}
+, {{21, -22, -52}
+, {51, -27, 38}
+, {-20, -48, 50}
+, {9, -51, -40}}
+, {{-42, 8, -32}
+, {24, 59, 3}
+, {-60, -38, -53}
+, {70, 44, -27}}
+, {{8, 28, 39}
+, {47, -46, 21}
+, {-39, -29, 27}
+, {-16, 43, 47}}
+, {{-29, 14, -26}
+, {-26, -28, 47}
+, {-23, -11, -17}
+, {-33, -21, 31}}
+, {{46, 10, -34}
+, {23, 40, 5}
+, {21, 62, 1}
+, {-3, 57, 5}}
+, {{-19, -5, 40}
+, {18, 41, 36}
+, {0, 13, 29}
+, {42, -26, 43}}
+, {{-5, -37, -38}
+, {-2, 11, -26}
+, {-20, -30, 34}
+, {47, -46, 18}}
+, {{-21, 38, 10}
+, {24, 15, 25}
+, {-38, -1, -4}
+, {54, 48, -17}}
+, {{26, 2, -30}
+, {-22, -46, -9}
+, {7, 52, 17}
+, {-50, 0, -27}}
+, {{-6, 41, 38}
+, {-40, 29, -11}
+, {-5, -8, 7}
+, {-33, 31, -41}}
+, {{-4, -43, -56}
+, {32, -4, -58}
+, {23, 32, 9}
+, {-10, -41, 36}}
+, {{50, -25, -51}
+, {-5, 16, -18}
+, {-14, -39, 5}
+, {3, 29, 46}}
+, {{18, -50, 45}
+, {-53, 31, -5}
+, {43, 20, 24}
+, {-38, -18, 46}}
+, {{37, 15, -5}
+, {-9, -32, 24}
+, {15, 36, -21}
+, {16, 46, 45}}
+, {{23, -15, -44}
+, {50, 0, 18}
+, {-53, -35, -17}
+, {-22, 68, 54}}
+, {{-4, 34, 43}
+, {-9, -2, 56}
+, {33, -27, -34}
+, {0, -52, -22}}
+, {{50, -12, -37}
+, {-46, -36, 8}
+, {6, -49, 20}
+, {3, 30, -16}}
+, {{-37, 31, -4}
+, {25, 28, 34}
+, {37, -6, 4}
+, {-9, 53, 65}}
+, {{30, -46, -50}
+, {-27, -55, -13}
+, {44, -10, 21}
+, {-41, -12, 54}}
+, {{-46, 3, -42}
+, {-21, -32, -26}
+, {21, 20, 4}
+, {-9, 43, -19}}
+, {{-10, 43, 13}
+, {-5, -10, -13}
+, {-58, 2, 28}
+, {-40, -20, 51}}
+, {{-32, -40, -37}
+, {-36, 44, 33}
+, {-30, -17, -5}
+, {12, -15, 5}}
+, {{-25, 38, 28}
+, {-17, 38, 69}
+, {-25, 0, -35}
+, {-26, 32, -25}}
+, {{-46, -47, -40}
+, {-5, 39, 26}
+, {15, 31, -30}
+, {35, 57, 79}}
+, {{0, 50, 19}
+, {11, -11, 45}
+, {-51, -50, -3}
+, {-27, -13, 39}}
+, {{-46, -49, 22}
+, {-40, -25, -2}
+, {9, 37, 3}
+, {36, -32, 26}}
+, {{-43, 11, -46}
+, {6, 0, -15}
+, {-33, -53, 3}
+, {-11, -39, -42}}
+, {{-38, -20, -27}
+, {-15, -46, 40}
+, {38, 38, 22}
+, {48, 16, 51}}
+, {{-48, 35, -28}
+, {39, -1, 28}
+, {38, 3, 56}
+, {-42, -20, -34}}
+, {{-22, 29, 16}
+, {-39, -51, -31}
+, {0, 51, -38}
+, {39, -33, 29}}
+, {{32, 53, 3}
+, {39, 32, 35}
+, {-16, -43, -25}
+, {64, -11, 47}}
+, {{-3, 23, -27}
+, {-21, 49, -52}
+, {40, 1, 24}
+, {54, 0, -26}}
+, {{0, -33, 36}
+, {15, -9, 0}
+, {36, -53, 27}
+, {47, -42, 45}}
+, {{12, -44, 28}
+, {-34, 38, 34}
+, {21, 21, -10}
+, {-44, 51, -36}}
+, {{46, 41, 39}
+, {-6, 13, 52}
+, {-51, -37, -5}
+, {21, -38, 35}}
+, {{-33, 11, 28}
+, {32, 9, -39}
+, {-25, -38, -24}
+, {8, -48, -34}}
+, {{1, -26, -10}
+, {26, 61, 60}
+, {-47, 33, -17}
+, {-30, 4, 12}}
+, {{-11, 24, -18}
+, {20, 51, -20}
+, {-32, -36, 17}
+, {-40, 17, -7}}
+, {{-12, 24, -7}
+, {-76, -2, 41}
+, {18, 25, -17}
+, {55, 56, -21}}
+, {{6, 27, -23}
+, {-46, 24, -36}
+, {49, 33, -16}
+, {0, -12, -38}}
+, {{43, -9, -39}
+, {33, -12, 50}
+, {-30, -37, 45}
+, {-37, -37, -35}}
+, {{-36, 35, -23}
+, {8, -35, 14}
+, {-28, 55, -29}
+, {-55, -5, -52}}
+, {{-6, 2, -41}
+, {-48, 48, 17}
+, {45, -19, 43}
+, {41, 32, -49}}
+, {{59, 11, -21}
+, {40, -29, -6}
+, {41, -38, 39}
+, {-47, 20, 53}}
+, {{16, 6, 31}
+, {-47, -38, 26}
+, {-16, 3, 45}
+, {9, 33, -42}}
+, {{3, 32, 53}
+, {19, -41, -21}
+, {-17, -20, 22}
+, {-41, -19, 20}}
+, {{-1, -26, -36}
+, {43, 38, -38}
+, {-21, -3, -48}
+, {50, -32, 20}}
+, {{-10, 52, -34}
+, {-31, 63, 41}
+, {32, 18, 30}
+, {57, 38, 29}}
+, {{54, -9, -35}
+, {57, -17, -50}
+, {27, 29, 36}
+, {-64, 15, -17}}
+, {{35, -76, -62}
+, {21, -9, -5}
+, {-4, -9, 45}
+, {-29, 47, 45}}
+, {{-18, -11, 37}
+, {-32, -8, -17}
+, {-35, 7, -31}
+, {53, 47, -27}}
+, {{-36, 34, -35}
+, {21, 47, 30}
+, {54, 14, 23}
+, {-46, 2, 1}}
+, {{12, 5, -50}
+, {-31, 41, -28}
+, {-29, 7, 53}
+, {-6, -54, -44}}
+, {{-49, -10, 15}
+, {-26, -30, -23}
+, {49, 20, 15}
+, {-35, 28, 19}}
+, {{-69, -70, -43}
+, {51, -9, 42}
+, {33, 7, -19}
+, {-2, -25, 12}}
+, {{-14, -44, 13}
+, {-25, -37, 17}
+, {57, 8, 29}
+, {56, 59, 53}}
+, {{-21, -11, 34}
+, {-9, 23, 48}
+, {-24, 29, 12}
+, {-33, -50, -39}}
+, {{27, -2, -49}
+, {48, -37, -46}
+, {-2, -28, 31}
+, {37, 20, 36}}
+, {{57, 3, 22}
+, {-45, -45, 37}
+, {11, 33, 31}
+, {38, -2, 0}}
+, {{21, 6, -45}
+, {-25, -20, 38}
+, {-11, -47, -15}
+, {24, 36, -6}}
+, {{-54, -15, -4}
+, {-27, -29, -7}
+, {61, 51, 3}
+, {-19, 37, 11}}
+, {{-42, 31, 41}
+, {-43, 52, -33}
+, {23, -25, -48}
+, {51, 47, -35}}
+, {{-17, -29, 8}
+, {-33, -5, 41}
+, {13, -21, -15}
+, {52, 17, -41}}
+, {{-48, -28, 4}
+, {38, -55, -16}
+, {37, 47, -26}
+, {37, -13, 50}}
+, {{26, -49, -6}
+, {-35, -21, -48}
+, {-48, -8, 31}
+, {42, -39, -51}}
+, {{50, -8, -43}
+, {38, -17, -11}
+, {-46, 10, -34}
+, {-17, -14, 54}}
+, {{-3, -4, -62}
+, {-32, -1, 16}
+, {16, 54, -27}
+, {21, 13, -35}}
+, {{-44, 34, 27}
+, {-28, 33, 8}
+, {56, -19, 19}
+, {19, 34, -9}}
+, {{-21, -14, -47}
+, {27, -2, 71}
+, {29, -52, -7}
+, {-1, 8, -46}}
+, {{54, 9, 11}
+, {-16, -45, -47}
+, {43, 23, 5}
+, {-37, 34, 30}}
+, {{36, -41, 36}
+, {-19, 51, -31}
+, {-23, 27, 14}
+, {-56, -22, 7}}
+, {{-5, -23, 44}
+, {-12, 31, -11}
+, {-50, -53, 36}
+, {53, 6, 41}}
+, {{39, 0, 37}
+, {-30, 30, 26}
+, {27, 19, 22}
+, {3, 37, 44}}
+, {{16, -5, 31}
+, {-24, 26, -30}
+, {47, 33, 49}
+, {-46, 30, 21}}
+, {{-53, 35, -24}
+, {38, 14, -25}
+, {22, 1, -3}
+, {46, 41, 47}}
+, {{-18, 27, 26}
+, {-26, 35, 19}
+, {-35, -9, -25}
+, {16, -34, 53}}
+, {{-65, 4, 12}
+, {3, 13, 35}
+, {61, 24, 18}
+, {13, 59, 46}}
+, {{-34, 40, 49}
+, {52, -22, 10}
+, {-49, 39, -28}
+, {49, 44, -12}}
+, {{-28, 20, 35}
+, {-5, -15, -12}
+, {23, -50, -10}
+, {-32, -36, -23}}
+, {{36, 39, 3}
+, {-46, -24, 20}
+, {-38, 35, -49}
+, {-19, 7, 31}}
+, {{0, 41, 6}
+, {21, -37, 36}
+, {-49, -9, -3}
+, {-23, -41, -24}}
+, {{24, -21, -29}
+, {-10, -6, -12}
+, {-37, 55, 45}
+, {24, 26, 9}}
+, {{-20, 50, -40}
+, {-15, -24, -8}
+, {-32, -47, -16}
+, {28, -17, 47}}
+, {{41, 30, 46}
+, {18, 4, -32}
+, {-48, 22, 29}
+, {29, -56, 44}}
+, {{-20, -40, -24}
+, {20, -31, 20}
+, {43, 16, 51}
+, {15, -33, -38}}
+, {{58, -4, 7}
+, {-44, -55, -4}
+, {24, 24, 54}
+, {-43, -59, -3}}
+, {{29, -22, 19}
+, {44, -44, 46}
+, {27, 40, 32}
+, {43, -39, 24}}
+, {{-50, -8, -10}
+, {-4, 6, 38}
+, {48, -22, -27}
+, {14, 60, -37}}
+, {{-48, -55, -30}
+, {-13, 29, 29}
+, {22, -43, -16}
+, {-30, -5, -14}}
+, {{-10, -26, 46}
+, {41, 28, -10}
+, {-10, -52, -47}
+, {13, -24, -39}}
+, {{42, 16, -5}
+, {2, 60, 55}
+, {16, 9, 49}
+, {40, -7, 29}}
+, {{27, -44, -8}
+, {25, 3, 39}
+, {-40, 27, -38}
+, {-40, -36, -12}}
+, {{6, -27, -20}
+, {-48, 8, -21}
+, {-5, 54, -29}
+, {-46, 21, 39}}
+, {{8, -27, -43}
+, {-3, -38, -19}
+, {-43, -35, 10}
+, {21, -50, 37}}
+, {{51, -2, 50}
+, {-50, -50, -20}
+, {46, 21, -22}
+, {43, 7, 17}}
+, {{0, -16, 39}
+, {-20, 45, 18}
+, {33, -47, 39}
+, {1, 28, -20}}
+, {{18, 0, -10}
+, {-28, -42, -22}
+, {10, -33, -45}
+, {-11, 56, -22}}
+, {{25, 35, -29}
+, {-33, 23, -34}
+, {-51, -18, 2}
+, {-45, -18, 3}}
+, {{-38, 12, 14}
+, {-38, 0, -26}
+, {-39, 2, -59}
+, {32, -23, 2}}
+, {{-6, 4, 12}
+, {-52, 21, -62}
+, {-41, 9, -61}
+, {39, -45, 26}}
+, {{-24, -51, -5}
+, {-29, 42, -15}
+, {-38, -44, -36}
+, {34, -9, -42}}
+, {{-18, 48, -41}
+, {-16, -24, 5}
+, {38, -46, 13}
+, {-30, 52, 2}}
+, {{9, 0, 18}
+, {5, 15, 52}
+, {2, -42, -51}
+, {4, -40, -48}}
+, {{0, -43, 26}
+, {48, 23, 46}
+, {-46, -56, -41}
+, {-7, -46, 15}}
+, {{7, 17, -10}
+, {50, 57, 4}
+, {5, -26, -17}
+, {37, 63, 23}}
+, {{27, -17, -23}
+, {21, -47, 33}
+, {-7, -37, 15}
+, {5, 14, -41}}
+, {{-36, 22, -20}
+, {12, 34, 43}
+, {20, -33, -24}
+, {49, -15, -16}}
+, {{15, -40, 5}
+, {42, 6, -27}
+, {42, 58, -38}
+, {45, 29, -14}}
+, {{-27, -34, 24}
+, {-36, -21, -67}
+, {-22, -44, -22}
+, {32, -33, -20}}
+, {{45, 18, -4}
+, {-14, 6, -25}
+, {34, 39, 43}
+, {0, 39, 22}}
+, {{22, -51, -1}
+, {-38, -26, -16}
+, {52, 23, -19}
+, {24, -6, -8}}
+, {{7, -53, 44}
+, {4, 15, 28}
+, {38, -27, -37}
+, {41, 13, 48}}
+, {{17, -37, -25}
+, {-58, 8, 47}
+, {30, 54, -25}
+, {-14, -11, -28}}
+, {{-26, -39, 0}
+, {-45, -17, 20}
+, {-32, -51, 40}
+, {-9, 2, -51}}
+, {{-40, 52, -13}
+, {-48, 11, -20}
+, {44, 18, -46}
+, {-25, 0, 42}}
+, {{-71, 29, 30}
+, {38, 4, -2}
+, {-24, 23, -28}
+, {-27, 22, -13}}
+, {{58, 43, 44}
+, {-41, 14, -24}
+, {-36, -11, -21}
+, {-41, -9, 21}}
+, {{-1, -27, -34}
+, {53, -19, 13}
+, {6, 35, -6}
+, {45, 28, -46}}
+, {{35, -23, -39}
+, {-49, 10, 29}
+, {37, -1, 35}
+, {52, 34, 11}}
+, {{27, 33, 26}
+, {23, -30, 6}
+, {31, 17, 13}
+, {46, 34, 36}}
+, {{33, 47, -15}
+, {20, 26, 9}
+, {39, 8, -21}
+, {-34, -6, -41}}
+, {{43, -13, -4}
+, {-44, -21, -19}
+, {45, 52, -40}
+, {-8, 12, 47}}
+, {{24, -51, -43}
+, {-37, -24, 27}
+, {43, 26, -39}
+, {18, -46, -38}}
+, {{45, 48, 51}
+, {14, -32, -5}
+, {3, -25, -7}
+, {52, -23, 47}}
+, {{10, -10, -40}
+, {21, -18, 20}
+, {-2, 48, 45}
+, {-50, -17, 52}}
+, {{6, -17, 30}
+, {-51, 39, -16}
+, {21, -37, -42}
+, {-37, -27, -55}}
+, {{-30, 29, -23}
+, {-34, 23, 37}
+, {-46, 26, 48}
+, {19, 21, 1}}
+, {{20, 30, 53}
+, {-56, 12, 12}
+, {-7, -37, -49}
+, {0, -22, 53}}
+, {{-17, 0, -14}
+, {0, -42, 39}
+, {-35, 26, 34}
+, {-33, -23, -20}}
+, {{-39, -11, 47}
+, {-45, -29, -42}
+, {-22, -28, 32}
+, {29, 38, 9}}
+, {{18, -9, -42}
+, {-29, -11, 45}
+, {-35, 10, 37}
+, {-30, 20, -50}}
+, {{26, -55, -51}
+, {7, -9, -28}
+, {29, 35, -26}
+, {-3, -33, -2}}
+, {{29, 8, -50}
+, {1, -27, 48}
+, {-45, 43, -14}
+, {-42, 40, -18}}
+, {{37, -11, -22}
+, {-42, 23, -37}
+, {-49, 8, -25}
+, {-35, -5, 39}}
+, {{-30, 18, -21}
+, {-51, -24, -45}
+, {-8, -53, 34}
+, {13, 4, -15}}
+, {{35, 12, 24}
+, {-43, 15, 5}
+, {-59, -60, -42}
+, {-5, -49, -54}}
+, {{6, 49, -2}
+, {-15, 53, 10}
+, {34, 29, 53}
+, {-13, -18, 6}}
+, {{14, -23, -2}
+, {-13, 10, -7}
+, {25, -54, 13}
+, {51, 26, -50}}
+, {{-26, 5, -21}
+, {17, 21, -17}
+, {-38, -28, -14}
+, {-53, -25, 42}}
+, {{-1, 2, 65}
+, {-59, 4, -36}
+, {37, -32, 29}
+, {0, 55, -29}}
+, {{63, 57, 2}
+, {-21, 15, 45}
+, {-43, -60, -30}
+, {-27, 2, 26}}
+, {{37, 14, -14}
+, {-53, 33, -50}
+, {-58, -36, 11}
+, {38, 60, 42}}
+, {{11, 36, -29}
+, {47, 46, 55}
+, {-25, -2, 15}
+, {40, -26, -45}}
+, {{34, 38, 25}
+, {-37, -57, 33}
+, {-20, -51, 40}
+, {39, 39, 38}}
+, {{12, -12, 23}
+, {44, -10, 28}
+, {-43, -28, 34}
+, {-45, -45, -15}}
+, {{23, -15, 32}
+, {-14, 19, 58}
+, {26, 37, -24}
+, {-35, -29, -24}}
+, {{-25, 53, 62}
+, {-40, -21, 38}
+, {-17, -32, -5}
+, {-39, 18, 19}}
+, {{-12, 0, -12}
+, {-6, 22, 42}
+, {0, -31, -63}
+, {-56, -52, 25}}
+, {{-28, -20, -31}
+, {-22, -18, 40}
+, {-6, 41, 8}
+, {-24, 29, 38}}
+, {{0, 61, -16}
+, {24, 42, 11}
+, {45, 43, 47}
+, {51, 15, 39}}
+, {{36, 16, -64}
+, {-32, -18, 50}
+, {34, -26, 29}
+, {13, 4, -3}}
+, {{-22, 22, -27}
+, {13, -13, -38}
+, {37, -25, 10}
+, {-31, 12, -48}}
+, {{37, -12, -62}
+, {2, 18, 33}
+, {-40, -34, 34}
+, {29, 55, 16}}
+, {{-55, -38, 18}
+, {27, 3, -38}
+, {1, -18, -5}
+, {-24, -21, -40}}
+, {{48, 13, -10}
+, {-51, 39, 24}
+, {46, 37, 25}
+, {-44, -26, -53}}
+, {{2, 21, -10}
+, {9, 31, 23}
+, {-37, 32, -8}
+, {-42, 43, 39}}
+, {{53, 35, 38}
+, {-70, -40, 29}
+, {-10, -31, 1}
+, {-27, 50, 9}}
+, {{24, 64, -25}
+, {-22, 11, -36}
+, {52, 9, 35}
+, {-33, -21, 51}}
+, {{11, 0, -26}
+, {51, 54, 12}
+, {25, 22, -4}
+, {-31, -5, -44}}
+, {{35, -35, 45}
+, {-36, 30, -15}
+, {6, 27, -53}
+, {-25, -43, -14}}
+, {{-26, 20, 59}
+, {-19, 11, -28}
+, {16, 22, -56}
+, {10, 52, -25}}
+, {{4, 10, 33}
+, {-46, 23, 9}
+, {-10, 38, 40}
+, {-55, -54, -4}}
+, {{-44, -30, -9}
+, {-50, -17, 44}
+, {27, 11, 38}
+, {6, 47, 49}}
+, {{37, 51, 35}
+, {-59, -27, 1}
+, {-71, -17, 34}
+, {5, 12, -13}}
+, {{28, 38, -22}
+, {-32, 12, -4}
+, {36, 52, -28}
+, {35, 26, 40}}
+, {{-43, 35, 31}
+, {12, -13, -33}
+, {37, -43, 48}
+, {22, -42, -15}}
+, {{26, -18, 36}
+, {1, -26, 54}
+, {-35, 55, -14}
+, {11, 47, 24}}
+, {{-55, 2, -3}
+, {44, -39, -7}
+, {40, 41, 44}
+, {20, -25, -15}}
+, {{20, 33, -25}
+, {30, -60, 18}
+, {15, -8, -55}
+, {-38, -32, 40}}
+, {{-10, 54, -32}
+, {35, 19, -14}
+, {-63, -61, 8}
+, {12, -55, 0}}
+, {{-39, 22, -36}
+, {39, -35, 60}
+, {-24, -43, 7}
+, {15, 0, -41}}
+, {{0, -45, 4}
+, {-7, -19, 55}
+, {35, -38, -17}
+, {-58, -25, -29}}
+, {{-30, 33, -18}
+, {52, 34, 2}
+, {-7, -62, -61}
+, {-39, -44, -44}}
+, {{-26, 10, -21}
+, {28, -44, 53}
+, {-55, -31, 18}
+, {10, 21, 32}}
+, {{-14, -34, 27}
+, {38, 0, -47}
+, {-49, 55, 53}
+, {-29, -42, 53}}
+, {{32, 19, -39}
+, {9, -48, 37}
+, {26, -48, 24}
+, {-43, 20, -49}}
+, {{8, 43, 33}
+, {0, 42, -25}
+, {-42, -14, 46}
+, {1, -24, -38}}
+, {{39, 14, 26}
+, {-17, -54, 8}
+, {26, -29, -8}
+, {28, -37, 39}}
+, {{25, 12, -37}
+, {3, -11, 55}
+, {2, -3, 46}
+, {31, 60, 52}}
+, {{-51, 9, -20}
+, {36, 16, -10}
+, {-48, -6, -70}
+, {-21, -78, -35}}
+, {{40, 43, -41}
+, {8, 43, -27}
+, {-13, -31, 21}
+, {-7, 52, 13}}
+, {{36, 15, 19}
+, {42, 13, 43}
+, {-23, 17, -20}
+, {20, 16, -19}}
+, {{29, -38, -4}
+, {-32, 59, 5}
+, {0, -47, -42}
+, {-49, -3, 9}}
+, {{-51, -14, -2}
+, {-28, 18, -49}
+, {31, -8, 47}
+, {-30, -43, -23}}
+, {{-40, 3, 47}
+, {-17, 44, 41}
+, {-25, 26, -5}
+, {40, -37, -32}}
+, {{-35, -31, -18}
+, {-5, -22, 0}
+, {31, -7, 26}
+, {-55, -51, -47}}
+, {{34, -32, 45}
+, {-42, 7, -76}
+, {27, 27, -5}
+, {-9, 15, -18}}
+, {{38, 21, -3}
+, {55, 12, -41}
+, {40, -11, 10}
+, {-22, 24, 32}}
+, {{-24, 50, -43}
+, {39, -29, 26}
+, {26, -29, -15}
+, {17, 29, 22}}
+, {{4, -38, 28}
+, {-47, -31, -13}
+, {49, -5, 43}
+, {-24, 11, 23}}
+, {{-31, -10, -51}
+, {40, -17, -34}
+, {-51, -25, -5}
+, {-61, -59, 9}}
+, {{13, 36, 16}
+, {22, -48, -20}
+, {-10, 57, -30}
+, {-23, -17, 20}}
+, {{-20, 9, -2}
+, {-30, 50, -51}
+, {-33, 29, -5}
+, {24, 49, -37}}
+, {{-42, 10, 25}
+, {-53, 9, -8}
+, {-30, -20, -4}
+, {47, 18, 42}}
+, {{-28, 29, -26}
+, {34, 44, -43}
+, {3, -26, 15}
+, {-39, 6, -27}}
+, {{-44, -39, -2}
+, {-30, 31, -42}
+, {-49, -34, 29}
+, {20, -14, 20}}
+, {{35, 19, 11}
+, {-18, -12, -22}
+, {-34, -29, 34}
+, {-31, -30, -46}}
+, {{-32, -10, -36}
+, {30, -32, 62}
+, {27, -19, 1}
+, {15, 25, 16}}
+, {{43, 7, 20}
+, {50, -59, 20}
+, {-1, 3, -39}
+, {39, -28, 36}}
+, {{-51, -29, -43}
+, {30, 0, 6}
+, {-2, 33, 31}
+, {-38, 53, -36}}
+, {{-23, -36, 39}
+, {-38, 51, -10}
+, {-23, 43, -37}
+, {1, -42, 6}}
+, {{18, 7, -57}
+, {-10, -2, 37}
+, {-7, -43, 42}
+, {36, -28, 55}}
+, {{-18, 37, -19}
+, {-46, -49, -29}
+, {21, -11, -31}
+, {-19, 20, -31}}
+, {{-32, -47, -12}
+, {-32, 49, 34}
+, {2, -15, 24}
+, {-41, -25, 8}}
+, {{8, 41, -24}
+, {5, 33, -36}
+, {27, -36, -27}
+, {30, -16, -27}}
+, {{-54, 29, -5}
+, {-11, 47, -24}
+, {-22, 30, -32}
+, {-69, -30, -32}}
+, {{39, -35, 42}
+, {-21, -8, -41}
+, {40, 46, -3}
+, {1, -30, 53}}
+, {{-29, 17, 18}
+, {14, -20, -35}
+, {26, 12, -17}
+, {51, -14, 52}}
+, {{-40, 3, -20}
+, {45, -26, 31}
+, {-40, 9, 37}
+, {50, 32, -4}}
+, {{9, 43, -40}
+, {23, 43, 3}
+, {36, -34, -11}
+, {5, 23, 30}}
+, {{45, 11, 47}
+, {-34, 46, 29}
+, {6, 53, -42}
+, {-19, 35, 33}}
+, {{28, -20, -43}
+, {29, 13, -11}
+, {61, 46, -29}
+, {52, 47, -25}}
+, {{31, 38, -44}
+, {0, 11, -11}
+, {-6, 25, -32}
+, {15, -45, -28}}
+, {{0, -37, 18}
+, {-17, -11, -36}
+, {23, 10, 43}
+, {16, -33, 54}}
+, {{-15, -50, -36}
+, {36, 35, -63}
+, {-21, 29, -14}
+, {3, -9, 56}}
+, {{51, -2, 5}
+, {-36, -21, -28}
+, {-38, 37, 51}
+, {4, 50, -2}}
+, {{-37, 2, -17}
+, {54, -19, 40}
+, {-35, 45, -8}
+, {56, 29, 15}}
+, {{-48, -51, 26}
+, {51, -21, -36}
+, {-54, 10, -7}
+, {-22, -9, 35}}
+, {{15, 22, -28}
+, {32, 37, 12}
+, {39, -10, 60}
+, {35, -51, -1}}
+, {{20, 12, 45}
+, {29, 17, -6}
+, {-26, 54, 65}
+, {43, 56, -23}}
+, {{-6, -26, -13}
+, {51, -41, -34}
+, {-38, 38, 25}
+, {-54, -4, 37}}
+, {{17, -31, 50}
+, {25, 51, 5}
+, {-5, 30, 24}
+, {11, 53, -15}}
+, {{-33, 37, 25}
+, {-31, -24, -37}
+, {-46, -47, -39}
+, {-19, -45, 13}}
+, {{-45, -29, 28}
+, {-54, 30, -26}
+, {-28, 34, -28}
+, {-39, 43, 39}}
+, {{14, -6, 8}
+, {-42, 38, -32}
+, {-33, 46, 13}
+, {33, -5, 17}}
+, {{21, 32, -2}
+, {38, -14, 49}
+, {26, -28, -7}
+, {17, -41, 47}}
+, {{-14, 49, -8}
+, {28, -5, 0}
+, {44, 11, -14}
+, {-54, -25, 42}}
+, {{-1, 6, -8}
+, {-56, -61, -64}
+, {-13, -8, -20}
+, {-25, 30, 40}}
+, {{41, 14, -19}
+, {-38, -20, 10}
+, {-27, -43, 16}
+, {46, -32, -10}}
+, {{-58, -22, 26}
+, {13, -54, -42}
+, {19, -6, 55}
+, {-44, 29, 34}}
+, {{-53, -6, 28}
+, {-43, -43, -63}
+, {-31, 18, -25}
+, {45, 18, 20}}
+, {{-33, -40, 22}
+, {39, -1, 45}
+, {32, -16, -47}
+, {10, 12, -4}}
+, {{-1, 40, -22}
+, {45, 43, -24}
+, {-24, -24, 15}
+, {10, -10, 53}}
+, {{-11, -2, 56}
+, {47, -28, -20}
+, {0, 16, -23}
+, {-20, -32, 45}}
+, {{35, -20, 8}
+, {43, 12, 28}
+, {-42, 45, -32}
+, {-43, 11, 35}}
+, {{-61, -42, -24}
+, {12, -19, 1}
+, {46, 73, 20}
+, {5, 31, -2}}
+, {{-36, -34, 45}
+, {-8, -50, -56}
+, {-3, -20, 14}
+, {39, 61, -32}}
+, {{9, 25, -16}
+, {46, 27, 39}
+, {-13, 48, -13}
+, {25, -12, -61}}
+, {{20, 24, -39}
+, {48, 0, 50}
+, {48, -23, -42}
+, {3, 3, 35}}
+, {{-8, 50, -8}
+, {-40, -22, -26}
+, {-19, 31, -37}
+, {21, -22, 32}}
+, {{53, -42, -7}
+, {49, -45, -45}
+, {-34, 14, 22}
+, {10, -6, -30}}
+, {{-18, 7, 38}
+, {19, 52, 29}
+, {-68, -54, -8}
+, {22, 22, -24}}
+, {{-43, 6, 8}
+, {22, -44, -41}
+, {-16, 7, -27}
+, {-16, 23, -35}}
+, {{44, -43, 30}
+, {47, -40, -1}
+, {10, 38, 13}
+, {-10, 37, -44}}
+, {{-46, 29, -34}
+, {-42, -25, 10}
+, {21, -3, 34}
+, {-40, 11, -10}}
+, {{-3, 51, 35}
+, {34, -35, -27}
+, {-60, -51, -20}
+, {-41, 42, -37}}
+, {{-11, -23, 4}
+, {-26, 41, -50}
+, {6, 0, -46}
+, {-17, 47, 23}}
+, {{-39, -25, 60}
+, {-18, -50, -10}
+, {34, -43, -36}
+, {0, -8, 33}}
+, {{21, -5, -43}
+, {0, -65, -36}
+, {64, 3, -16}
+, {58, -12, 24}}
+, {{53, -5, -21}
+, {-16, 9, 46}
+, {-30, -53, 35}
+, {-6, 7, 26}}
+, {{-38, -45, 8}
+, {22, 35, 48}
+, {-42, -24, -29}
+, {-15, -33, 12}}
+, {{-18, 57, -1}
+, {-2, -30, 50}
+, {16, 38, 38}
+, {-23, -43, -41}}
+, {{-44, 0, -30}
+, {13, -7, -27}
+, {43, -25, 30}
+, {4, 37, 28}}
+, {{-22, -40, 1}
+, {52, -42, 47}
+, {24, 43, -34}
+, {31, -12, -39}}
+, {{-19, 0, -45}
+, {-6, -37, -54}
+, {14, 42, 51}
+, {1, 28, -25}}
+, {{45, -22, -26}
+, {52, -19, -32}
+, {39, -6, 11}
+, {52, -50, 29}}
+, {{38, 46, -1}
+, {-27, 39, 18}
+, {-40, 39, -27}
+, {43, 31, -54}}
+, {{1, 20, 42}
+, {-67, -2, 29}
+, {78, 8, 49}
+, {34, 11, -30}}
+, {{30, 7, -24}
+, {43, 32, -35}
+, {51, 40, -43}
+, {-44, 0, -43}}
+, {{-40, 45, -3}
+, {30, 5, 25}
+, {-34, 19, 45}
+, {16, -26, -11}}
+, {{50, 47, 0}
+, {48, -5, -41}
+, {38, 35, 8}
+, {36, -46, -39}}
+, {{24, 40, -35}
+, {-40, 16, -39}
+, {47, -19, -43}
+, {55, -2, 5}}
+, {{-9, 22, -58}
+, {40, -12, 49}
+, {44, -21, 8}
+, {50, 33, -23}}
+, {{33, -35, -51}
+, {30, 22, -51}
+, {32, -5, -39}
+, {-40, 24, -38}}
+, {{8, 8, -11}
+, {-49, -19, -38}
+, {34, 41, -43}
+, {1, -57, -5}}
+, {{16, 51, 51}
+, {58, 15, -1}
+, {41, 18, -43}
+, {27, -29, 0}}
+, {{-22, -39, 4}
+, {16, -24, -47}
+, {-30, 41, -43}
+, {-53, 33, -48}}
+, {{-38, -47, 44}
+, {11, -3, 20}
+, {10, -37, -36}
+, {-26, 4, -37}}
+, {{35, -20, 16}
+, {-54, 34, 11}
+, {-24, -8, -26}
+, {-43, -16, -43}}
+, {{-37, -4, 51}
+, {48, -31, 39}
+, {51, -44, -13}
+, {-39, -14, 34}}
+, {{-54, -46, 24}
+, {42, 37, 24}
+, {-6, 26, -56}
+, {-40, -52, -50}}
+, {{-41, 41, 44}
+, {26, -26, 33}
+, {8, 28, 44}
+, {-40, 0, 7}}
+, {{-18, -46, 5}
+, {35, 20, 45}
+, {37, 69, -37}
+, {-53, -33, 38}}
+, {{12, 43, 49}
+, {-31, 32, -27}
+, {50, 26, -37}
+, {5, -42, -3}}
+, {{28, 57, 9}
+, {13, -17, -45}
+, {8, -11, -48}
+, {37, 2, 17}}
+, {{3, -42, 26}
+, {-14, -38, -48}
+, {-48, -37, -40}
+, {-10, 16, -1}}
+, {{-13, -34, -34}
+, {-13, -47, 45}
+, {-28, 28, 31}
+, {-46, -8, 19}}
+, {{33, -55, -4}
+, {-4, 15, 30}
+, {20, 51, 24}
+, {-6, -21, 27}}
+, {{-15, 54, -24}
+, {-3, 44, 15}
+, {22, 44, 8}
+, {-3, -41, -12}}
+, {{-19, 36, 17}
+, {35, -46, -19}
+, {-43, -23, -12}
+, {21, -51, 46}}
+, {{-1, 19, 18}
+, {61, 25, 57}
+, {-40, -37, 33}
+, {12, -16, 46}}
+, {{7, -28, -14}
+, {-22, -50, 6}
+, {-47, -7, 16}
+, {-35, 44, 41}}
+, {{-5, -28, 39}
+, {-2, 40, 33}
+, {32, 48, 2}
+, {-19, 42, -54}}
+, {{32, 49, 2}
+, {16, -10, -36}
+, {-25, -25, -12}
+, {-33, 39, -21}}
+, {{17, 0, -19}
+, {-13, 37, -34}
+, {16, 32, -49}
+, {40, 43, -2}}
+, {{-41, -15, -44}
+, {14, -16, 20}
+, {-40, -1, -9}
+, {31, -31, -22}}
+, {{-43, 40, 44}
+, {52, -34, 47}
+, {-9, -42, 39}
+, {49, -5, 44}}
+, {{-35, -21, 38}
+, {-20, -41, -39}
+, {10, 37, -32}
+, {-13, -25, 12}}
+, {{-37, 30, -34}
+, {19, -31, 9}
+, {68, 82, 4}
+, {-21, 35, 0}}
+, {{43, 33, 51}
+, {-26, -29, -31}
+, {-31, -20, -34}
+, {-29, 0, -19}}
+, {{-32, -3, -7}
+, {-41, -36, 9}
+, {-36, 5, -35}
+, {36, -51, 26}}
+, {{-1, 16, -45}
+, {63, -24, 52}
+, {1, 0, 65}
+, {35, -35, 39}}
+, {{-35, -11, 10}
+, {30, -44, 47}
+, {-18, 33, -35}
+, {-27, 8, -27}}
+, {{-16, -39, -33}
+, {15, -36, -43}
+, {-46, 8, -27}
+, {-36, -43, -43}}
+, {{-19, -42, 29}
+, {-16, 34, 12}
+, {-17, 47, 59}
+, {33, -19, -21}}
+, {{27, -19, 39}
+, {19, 20, -28}
+, {48, 39, 30}
+, {34, 36, 22}}
+, {{43, 55, 48}
+, {48, -8, 12}
+, {-28, 31, 70}
+, {21, 32, 55}}
+, {{-45, 29, 5}
+, {-38, -27, 44}
+, {-23, 28, -23}
+, {-30, 31, 19}}
+, {{14, -20, -34}
+, {36, 47, -46}
+, {16, -32, 40}
+, {-52, 32, 31}}
+, {{25, -40, 52}
+, {37, 29, 31}
+, {-49, 0, -15}
+, {9, 53, -49}}
+, {{-3, -6, 49}
+, {-20, 4, -23}
+, {42, 0, -27}
+, {37, -39, 33}}
+, {{28, -5, -52}
+, {29, -35, -11}
+, {29, -56, -13}
+, {14, -24, 3}}
+, {{-64, -11, -2}
+, {43, 46, -27}
+, {45, 49, 7}
+, {-48, -28, 14}}
+, {{17, 26, 33}
+, {-29, 50, 47}
+, {-34, -6, 18}
+, {53, -22, -19}}
+, {{45, 19, 32}
+, {-54, -52, -29}
+, {27, -35, 6}
+, {7, 19, 17}}
+, {{39, 21, 43}
+, {9, 15, -38}
+, {-62, -32, -33}
+, {31, 32, 65}}
+, {{6, 46, 25}
+, {21, -5, 4}
+, {30, 8, 39}
+, {57, -30, -24}}
+, {{48, 53, -10}
+, {-18, 8, -34}
+, {41, -51, -11}
+, {50, 3, 4}}
+, {{23, 11, 12}
+, {33, 23, 37}
+, {-12, -31, 21}
+, {43, 9, 32}}
+, {{1, 2, 3}
+, {32, 13, 39}
+, {54, -15, 42}
+, {7, 50, -27}}
+, {{-26, -56, -44}
+, {37, 56, 51}
+, {-17, -6, 23}
+, {-39, -33, 16}}
+, {{45, -34, -20}
+, {39, 53, 27}
+, {-51, 27, -44}
+, {-7, 39, -19}}
+, {{10, 38, 47}
+, {36, -11, 42}
+, {-25, -26, -7}
+, {-2, 7, -57}}
+, {{41, -34, 27}
+, {32, -9, 25}
+, {29, -17, 40}
+, {2, -28, -6}}
+, {{-3, 15, 15}
+, {33, -26, -39}
+, {-38, 15, 41}
+, {20, -42, -39}}
+, {{-25, 33, 20}
+, {21, 9, -41}
+, {9, -33, -48}
+, {23, -32, 15}}
+, {{52, -17, -19}
+, {12, -8, -23}
+, {-41, 22, -27}
+, {-60, -43, 8}}
+, {{22, 18, -11}
+, {10, 3, 4}
+, {41, 51, 34}
+, {54, -37, -26}}
+, {{-16, -40, 40}
+, {-41, -43, -13}
+, {35, -3, 10}
+, {-55, -14, 26}}
+, {{-22, -45, -25}
+, {-29, -9, -47}
+, {-31, -30, -42}
+, {18, -10, 26}}
+, {{22, 10, 3}
+, {52, 21, 5}
+, {24, 28, 43}
+, {13, 44, -34}}
+, {{32, -36, -24}
+, {43, -49, -47}
+, {53, -34, -35}
+, {-11, -37, 11}}
+, {{61, -9, 8}
+, {37, -20, 35}
+, {-41, -51, 6}
+, {-5, 17, 12}}
+, {{73, 16, -17}
+, {39, 16, -25}
+, {38, -16, -51}
+, {-21, 48, 47}}
+, {{-17, -14, -44}
+, {-26, 54, 39}
+, {19, 17, -47}
+, {49, 50, 52}}
+, {{15, -24, -44}
+, {22, 50, 48}
+, {8, 6, 26}
+, {22, -51, -30}}
+, {{32, -5, -19}
+, {52, 52, 18}
+, {20, 51, 5}
+, {-12, 3, -61}}
+, {{-37, 9, -2}
+, {-22, -27, -35}
+, {-8, 37, 28}
+, {31, 55, 15}}
+, {{26, 33, -57}
+, {12, 2, 39}
+, {53, 0, -29}
+, {10, 37, -17}}
+, {{3, -35, 34}
+, {42, 53, -33}
+, {19, -36, -51}
+, {-8, -9, 6}}
+, {{45, -13, -16}
+, {-20, 42, 38}
+, {36, 13, -9}
+, {-55, -31, -34}}
+, {{24, -60, -29}
+, {27, 10, 54}
+, {25, 31, -42}
+, {52, 9, -9}}
+, {{-18, 55, 67}
+, {0, -14, 36}
+, {28, -43, 28}
+, {16, 25, -29}}
+, {{28, -18, 56}
+, {32, 32, 39}
+, {-48, 0, -18}
+, {38, -1, -9}}
+, {{45, 7, -31}
+, {-12, 14, 46}
+, {53, 50, -29}
+, {-15, -31, 41}}
+, {{-37, -32, -40}
+, {-37, -9, -37}
+, {25, -38, 31}
+, {17, 28, 43}}
+, {{12, 44, 45}
+, {25, 41, -42}
+, {-1, 5, 48}
+, {-23, -49, 16}}
+, {{0, 51, -15}
+, {54, 39, 21}
+, {17, -5, 42}
+, {-47, -39, 41}}
+, {{-20, -33, -56}
+, {-24, -40, -55}
+, {-12, -15, -19}
+, {-28, -7, -22}}
+, {{-34, 26, 25}
+, {-6, 41, -20}
+, {-20, -50, 16}
+, {25, -40, 42}}
+, {{30, 39, 46}
+, {-10, 16, 5}
+, {19, -19, 51}
+, {-24, 59, -18}}
+, {{-17, 25, -38}
+, {49, 56, 51}
+, {-25, 37, 51}
+, {-35, 46, 8}}
+, {{-53, 8, 47}
+, {-8, 24, 3}
+, {-39, -13, -15}
+, {42, 19, 45}}
+, {{-31, 46, -47}
+, {-1, 27, 5}
+, {-29, 50, 8}
+, {34, -36, 6}}
+, {{-28, -24, 6}
+, {52, -26, -16}
+, {48, 34, 46}
+, {-29, -46, -10}}
+, {{28, 50, 21}
+, {50, 46, -20}
+, {45, 12, 43}
+, {-41, -33, 41}}
+, {{-20, -31, 38}
+, {40, -14, -21}
+, {37, 3, 50}
+, {-7, -7, -42}}
+, {{47, 71, 25}
+, {62, -16, -15}
+, {19, 1, 28}
+, {-24, 16, -21}}
+, {{-32, 15, 11}
+, {-32, 36, 34}
+, {-46, -27, 10}
+, {31, -12, -45}}
+, {{-39, 28, 37}
+, {-29, -42, 37}
+, {-13, -42, 36}
+, {18, 30, -38}}
+, {{-27, -10, -21}
+, {8, -38, 21}
+, {24, 28, 27}
+, {-39, -56, -33}}
+, {{-43, -10, 42}
+, {21, -42, -11}
+, {2, 0, 21}
+, {-39, -36, 18}}
+, {{-61, 4, 12}
+, {16, 12, 55}
+, {-29, -26, 12}
+, {8, 28, -28}}
+, {{41, -33, -27}
+, {-51, -28, 2}
+, {42, -1, 15}
+, {-21, 24, -44}}
+, {{-25, 33, 43}
+, {-25, 0, -51}
+, {31, -13, -14}
+, {-46, -29, 48}}
+, {{-44, -26, -31}
+, {34, -42, -34}
+, {4, -28, -51}
+, {41, -46, 28}}
+, {{43, 9, 24}
+, {10, -23, -13}
+, {17, 48, 18}
+, {14, 5, 58}}
+, {{18, -15, -43}
+, {45, 36, 25}
+, {-18, -38, -55}
+, {28, -10, 30}}
+, {{-4, -38, -3}
+, {-48, 48, 25}
+, {27, -2, 45}
+, {-29, -7, -44}}
+, {{48, 39, -36}
+, {-42, -47, 48}
+, {-36, -52, 38}
+, {17, 8, -17}}
+, {{-44, -40, 29}
+, {-4, 29, 44}
+, {28, -23, -45}
+, {-10, -25, 33}}
+, {{48, 23, 23}
+, {14, -9, 29}
+, {-47, 36, -31}
+, {36, 40, 21}}
+, {{25, 12, -11}
+, {-30, 31, -13}
+, {-8, 16, 52}
+, {-14, -47, -31}}
+, {{13, 50, -41}
+, {47, -52, -26}
+, {-3, 33, 37}
+, {-9, 37, -53}}
+, {{8, 54, -24}
+, {-45, 40, 43}
+, {44, 43, 12}
+, {-15, -47, -23}}
+, {{-55, 22, 30}
+, {-35, 35, 10}
+, {37, -19, -3}
+, {23, 15, 30}}
+, {{51, 3, 34}
+, {-14, 34, 10}
+, {-51, -37, 30}
+, {38, 16, -23}}
+, {{14, -2, -48}
+, {-31, -38, 18}
+, {-49, -29, 15}
+, {15, -4, -25}}
+, {{45, -8, 17}
+, {13, -31, 11}
+, {-41, 12, 58}
+, {31, 40, -41}}
+, {{-45, 8, -14}
+, {39, 0, -38}
+, {42, 48, -8}
+, {7, 62, 10}}
+, {{44, 19, -33}
+, {-16, 29, -36}
+, {-10, 39, -25}
+, {3, 28, 45}}
+, {{-40, 9, 14}
+, {-25, -27, -46}
+, {-20, 33, 58}
+, {55, 18, 6}}
+, {{36, -7, 49}
+, {18, -55, -21}
+, {7, -57, 17}
+, {-19, -31, 53}}
+, {{-21, 15, 38}
+, {-43, -66, 13}
+, {25, 1, 69}
+, {17, 5, 46}}
+, {{-34, -41, -34}
+, {55, 5, -40}
+, {24, -16, 11}
+, {-41, 32, -35}}
+, {{-2, 32, 55}
+, {48, -14, 13}
+, {-23, -39, -5}
+, {-26, -6, 37}}
+, {{53, 11, 43}
+, {-52, 18, 2}
+, {52, -8, -13}
+, {3, 1, -43}}
+, {{11, -10, -48}
+, {-9, 24, -30}
+, {25, -8, 46}
+, {38, -22, 35}}
+, {{67, 25, 16}
+, {-15, 0, 37}
+, {-47, 34, -6}
+, {21, -18, 0}}
+, {{51, 49, 25}
+, {30, -25, -10}
+, {-29, -20, -29}
+, {22, 10, -52}}
+, {{-3, 22, -48}
+, {19, -42, -45}
+, {-22, -13, 42}
+, {0, -35, -39}}
+, {{-17, -39, 34}
+, {23, 32, -9}
+, {-14, -45, 25}
+, {48, 20, -12}}
+, {{34, 36, 16}
+, {-47, -7, 12}
+, {17, 53, 18}
+, {-23, -6, -25}}
+, {{-22, -7, 46}
+, {45, 26, -2}
+, {-7, -25, 41}
+, {50, 45, -28}}
+, {{-32, -22, 26}
+, {42, -55, 26}
+, {-10, -6, 40}
+, {-58, -48, 9}}
+, {{-31, -10, 14}
+, {-30, -59, -44}
+, {-31, 57, 55}
+, {17, -12, -28}}
+, {{-45, -45, -27}
+, {-19, 44, 42}
+, {33, 40, 18}
+, {-46, -32, -11}}
+, {{-28, 43, 5}
+, {-13, -55, -27}
+, {37, 20, 8}
+, {23, 1, 22}}
+, {{-27, -45, 45}
+, {6, 12, 50}
+, {11, -25, 51}
+, {-5, -5, -49}}
+, {{-51, 23, -43}
+, {47, 26, 41}
+, {44, -18, -19}
+, {12, -34, -61}}
+, {{55, -15, 41}
+, {47, -42, 40}
+, {-57, 2, 16}
+, {2, -7, 24}}
+, {{-49, -61, -49}
+, {14, 58, 38}
+, {-3, -17, 16}
+, {35, 39, 16}}
+, {{-11, 29, -15}
+, {5, 11, -40}
+, {26, -46, -43}
+, {-31, 22, 17}}
+, {{42, 40, -30}
+, {-5, 36, 3}
+, {-47, -45, 28}
+, {18, 16, -3}}
+, {{7, -33, 46}
+, {27, -22, -9}
+, {-42, 7, 18}
+, {-36, 10, 35}}
+, {{-40, -23, 28}
+, {54, -5, 54}
+, {25, 11, 26}
+, {-26, -23, -9}}
+, {{36, 51, 34}
+, {-22, -55, -14}
+, {0, 56, -28}
+, {-43, 23, 0}}
+, {{8, 41, -12}
+, {34, 16, 61}
+, {-37, -36, 49}
+, {-46, 5, -23}}
+, {{19, -9, 25}
+, {50, -28, -10}
+, {28, 53, -29}
+, {29, 45, 37}}
+, {{22, 30, 25}
+, {-7, 18, 22}
+, {22, 59, 51}
+, {5, -48, 34}}
+, {{55, 51, -47}
+, {17, -35, 37}
+, {-24, -10, 0}
+, {6, 42, -29}}
+, {{-27, 53, -54}
+, {-36, 11, -46}
+, {44, -40, 2}
+, {-26, -50, 47}}
+, {{19, -25, 58}
+, {-24, -15, 17}
+, {-16, -43, -45}
+, {14, -8, 51}}
+, {{32, 26, -43}
+, {-9, -42, 22}
+, {-36, -3, -34}
+, {-4, -48, 49}}
+, {{-24, 49, -27}
+, {-29, -4, 10}
+, {-42, 2, 41}
+, {15, 42, 47}}
+, {{5, 27, -46}
+, {6, -53, -14}
+, {-26, -30, 32}
+, {60, 18, 32}}
+, {{16, 33, -8}
+, {32, -28, 11}
+, {33, -38, -19}
+, {-58, -20, -2}}
+, {{6, 38, 20}
+, {55, 13, 48}
+, {-45, -25, 36}
+, {-13, 43, 11}}
+, {{42, 29, 12}
+, {2, -32, -44}
+, {36, -36, 19}
+, {-32, -2, 34}}
+, {{-71, -22, -50}
+, {-17, 19, -1}
+, {-42, -14, -18}
+, {44, -18, -46}}
+, {{-21, 52, 50}
+, {46, 36, 23}
+, {-47, 20, 3}
+, {44, -5, -62}}
+, {{0, -43, 22}
+, {50, 9, -27}
+, {51, 31, 33}
+, {-2, -39, -25}}
+, {{-18, -23, 65}
+, {-21, 38, 21}
+, {45, 2, -13}
+, {23, -15, -46}}
+, {{-8, 2, 30}
+, {30, 46, 41}
+, {48, 21, -18}
+, {49, 10, -12}}
+, {{-29, 6, 52}
+, {44, -46, -26}
+, {-25, 39, 2}
+, {2, -24, 3}}
+, {{33, 2, -10}
+, {25, -34, -50}
+, {-17, -36, -29}
+, {-13, 35, 33}}
+, {{42, -43, -21}
+, {-23, -47, -3}
+, {-27, 28, -32}
+, {23, -49, -19}}
+, {{0, 33, 42}
+, {36, 39, -41}
+, {-35, -27, -16}
+, {-27, 19, -30}}
+, {{34, -4, -19}
+, {49, -21, -15}
+, {51, 60, -17}
+, {-19, 0, -19}}
+, {{37, 26, -21}
+, {67, 15, 65}
+, {17, 1, 18}
+, {-18, -22, 22}}
+, {{16, 30, 60}
+, {54, 58, 63}
+, {5, -47, 27}
+, {-50, -2, -38}}
+, {{-11, 21, 34}
+, {59, -23, 58}
+, {-14, 7, -10}
+, {0, 41, -49}}
+, {{35, 29, 54}
+, {39, 20, 53}
+, {6, -30, 0}
+, {39, -44, -51}}
+, {{-9, 53, 47}
+, {46, 33, 61}
+, {-5, -37, -43}
+, {-37, -50, -1}}
+, {{1, 2, -45}
+, {-42, 31, -32}
+, {28, 33, 23}
+, {-15, -9, -47}}
+, {{17, -24, 11}
+, {-41, 54, 0}
+, {-56, -45, 12}
+, {12, -36, -53}}
+, {{0, 25, 23}
+, {-38, 0, 62}
+, {-54, 9, 26}
+, {7, -44, 13}}
+, {{-28, 23, -10}
+, {-17, -38, -6}
+, {-42, 40, -23}
+, {15, 60, -6}}
+, {{36, -45, 21}
+, {-27, 42, 1}
+, {-10, -12, 6}
+, {9, 40, -40}}
+, {{-31, -52, 40}
+, {27, -35, -36}
+, {14, -22, 2}
+, {24, 17, 28}}
+, {{-7, -41, -3}
+, {-39, 4, -43}
+, {-17, -38, 27}
+, {37, -8, 31}}
+, {{43, -17, -5}
+, {52, 1, -24}
+, {41, 55, -23}
+, {-33, -4, -43}}
+, {{-18, 33, 28}
+, {-34, 40, -38}
+, {3, 57, 40}
+, {-42, 5, -19}}
+, {{-51, -38, -16}
+, {-40, -15, 43}
+, {-14, 21, 22}
+, {-11, -22, -8}}
+, {{45, -40, 20}
+, {-2, -24, -40}
+, {-8, 31, 17}
+, {46, 52, -16}}
+, {{34, 14, 44}
+, {-40, 39, -42}
+, {30, -12, -41}
+, {51, 24, -39}}
+, {{23, 53, -43}
+, {25, -3, -52}
+, {-1, 9, -31}
+, {18, -10, 29}}
+, {{66, 27, -32}
+, {-20, -24, 53}
+, {42, -1, -18}
+, {-22, 29, 9}}
+, {{-65, -18, -32}
+, {-50, -38, -2}
+, {25, 51, 52}
+, {-20, -14, -24}}
+, {{4, -53, -34}
+, {34, -30, -1}
+, {47, 1, -6}
+, {36, -14, -24}}
+, {{50, 62, 34}
+, {7, 49, 37}
+, {-51, -40, -42}
+, {-37, 10, -49}}
+, {{43, 25, -21}
+, {16, -29, -10}
+, {41, 35, 28}
+, {-25, 49, 41}}
+, {{-17, 38, -5}
+, {11, 22, 33}
+, {81, 53, 7}
+, {34, 45, 9}}
+, {{-54, -5, -46}
+, {-21, 29, 38}
+, {-19, -48, -22}
+, {25, 11, -42}}
+, {{24, -3, 55}
+, {-18, 3, 21}
+, {60, 25, 44}
+, {-46, 38, -51}}
+, {{41, -41, -44}
+, {18, 13, -28}
+, {-31, -11, -21}
+, {0, 29, -15}}
+, {{62, 31, 11}
+, {-16, 76, 73}
+, {24, 25, -25}
+, {27, 24, -21}}
+, {{46, -1, -4}
+, {50, -36, 8}
+, {19, 77, -24}
+, {-50, 32, -31}}
+, {{-2, 2, -45}
+, {2, 22, 51}
+, {-44, 30, 22}
+, {43, -5, -40}}
+, {{3, -22, -18}
+, {-11, 31, 48}
+, {30, -17, -21}
+, {34, -25, 44}}
+, {{19, 0, 42}
+, {-46, 45, -28}
+, {-11, -48, 6}
+, {38, -36, -40}}
+, {{-35, -2, 1}
+, {-33, 32, -34}
+, {44, -39, 38}
+, {28, 41, 15}}
+, {{-17, 13, 13}
+, {-12, 45, 26}
+, {-34, 45, -48}
+, {-40, 14, 5}}
+, {{-49, -65, -55}
+, {-48, 12, 7}
+, {-23, -1, -38}
+, {-17, -5, 13}}
+, {{0, -29, 28}
+, {44, 29, 13}
+, {8, -48, 28}
+, {-23, 44, -29}}
+, {{44, -37, 36}
+, {-12, 7, 1}
+, {9, 17, -34}
+, {-11, -23, 51}}
+, {{-14, -29, 47}
+, {-23, 18, -22}
+, {4, 55, 26}
+, {-26, -44, -7}}
+, {{46, 23, -39}
+, {22, 18, 37}
+, {19, 60, 14}
+, {10, -60, 6}}
+, {{-44, -48, 25}
+, {-17, -12, 25}
+, {32, 14, 33}
+, {-24, 48, -18}}
+, {{-17, -34, 50}
+, {-16, -23, -30}
+, {-59, 14, -20}
+, {46, -8, -18}}
+, {{-12, -20, 37}
+, {-51, 21, -48}
+, {8, 21, 9}
+, {-34, 35, -37}}
+, {{8, 23, 37}
+, {7, -29, -14}
+, {48, 27, 13}
+, {-34, 48, 46}}
+, {{-26, 48, 32}
+, {-22, -47, -30}
+, {9, -9, -51}
+, {-14, 4, 6}}
+, {{55, -26, 39}
+, {-22, -29, 51}
+, {30, -18, 16}
+, {21, 21, -19}}
+, {{26, 32, -20}
+, {2, -37, 7}
+, {51, -2, -45}
+, {-36, -47, 26}}
+, {{-20, 40, 44}
+, {16, 3, 38}
+, {-16, -40, 29}
+, {30, -49, 43}}
+, {{10, 10, -33}
+, {-33, 43, 48}
+, {34, 19, -7}
+, {25, -50, -60}}
+, {{40, 6, 15}
+, {-51, -40, 21}
+, {37, 11, -22}
+, {-25, -12, -42}}
+, {{39, -15, 25}
+, {27, 15, -25}
+, {-44, -43, -14}
+, {35, 47, 16}}
+, {{35, -16, 36}
+, {-37, 0, 50}
+, {-6, -27, 41}
+, {29, -10, -6}}
+, {{-31, 41, 2}
+, {-62, -28, -54}
+, {-16, 36, -38}
+, {-2, -31, -31}}
+, {{-20, -40, 8}
+, {-2, -50, -39}
+, {10, 50, 24}
+, {-44, -53, 15}}
+, {{21, 58, 63}
+, {29, -8, -2}
+, {19, 57, -5}
+, {-26, 18, 60}}
+, {{40, 19, -23}
+, {-30, 49, 32}
+, {18, 41, 23}
+, {-2, -3, 24}}
+, {{-29, -30, -26}
+, {7, -43, 39}
+, {-51, 29, -28}
+, {28, 18, -3}}
+, {{35, 14, 36}
+, {-33, 0, 15}
+, {18, -23, -31}
+, {-2, 44, 35}}
+, {{40, -12, -1}
+, {50, -52, 41}
+, {36, 0, -2}
+, {38, 52, -43}}
+, {{31, 24, -33}
+, {31, -7, -43}
+, {-45, -28, -6}
+, {-34, 6, -2}}
+, {{-20, -29, 1}
+, {-44, -58, 32}
+, {-37, 27, 15}
+, {67, 7, 11}}
+, {{-17, 58, -25}
+, {-35, 55, -36}
+, {-44, -21, 6}
+, {31, -4, -6}}
+, {{28, -36, -44}
+, {7, -11, -43}
+, {-56, -35, 1}
+, {7, 21, -5}}
+, {{44, -42, 47}
+, {-35, -7, 19}
+, {14, -47, -8}
+, {-42, -2, 10}}
+, {{20, 6, -44}
+, {43, 57, 26}
+, {-37, 5, 40}
+, {-31, -37, -11}}
+, {{-27, 42, -45}
+, {36, 11, -20}
+, {54, 14, -3}
+, {32, 39, 11}}
+, {{40, 47, 28}
+, {-6, 33, 2}
+, {-23, 48, 29}
+, {48, -2, 33}}
+, {{48, -8, 35}
+, {-46, 37, 24}
+, {37, 45, -26}
+, {6, 28, -33}}
+, {{60, -16, 5}
+, {19, -34, 0}
+, {21, -51, 28}
+, {56, 7, 25}}
+, {{25, -32, -46}
+, {45, -43, 60}
+, {-7, 10, -14}
+, {-8, -17, -31}}
+, {{-52, -34, 16}
+, {-7, -27, 30}
+, {-29, 16, -15}
+, {21, 31, 46}}
+, {{2, 16, 13}
+, {-10, -53, 26}
+, {-9, 63, 33}
+, {0, -36, -36}}
+, {{-9, 34, 18}
+, {-46, 3, -54}
+, {-32, 23, 6}
+, {-34, 33, -10}}
+, {{-18, -11, -51}
+, {-36, -41, 13}
+, {50, 12, 48}
+, {-69, -61, -12}}
+, {{36, -34, -29}
+, {46, -2, 20}
+, {50, -18, 8}
+, {-19, -42, -26}}
+, {{51, -25, 16}
+, {-22, 25, 49}
+, {-44, -3, -48}
+, {34, 40, 27}}
+, {{-2, 29, 16}
+, {-27, 13, -54}
+, {-15, 23, 27}
+, {-7, -42, 35}}
+, {{24, -42, -12}
+, {22, -45, -26}
+, {20, 43, -49}
+, {19, 1, -43}}
+, {{-27, 3, -38}
+, {13, -12, 14}
+, {30, 23, 42}
+, {3, -53, -47}}
+, {{-16, 71, 32}
+, {-36, -32, 3}
+, {3, 32, 28}
+, {-9, -18, 10}}
+, {{-30, 28, -51}
+, {29, -14, -42}
+, {-10, -22, 43}
+, {-8, 0, -43}}
+, {{-27, 24, -44}
+, {48, 53, -29}
+, {15, -53, 4}
+, {54, 49, 38}}
+, {{-48, -2, -8}
+, {37, -4, 39}
+, {40, -45, -30}
+, {27, -16, -5}}
+, {{-10, 36, 3}
+, {14, 33, 21}
+, {-60, -53, 12}
+, {-28, 5, -32}}
+, {{4, 17, -43}
+, {-21, 22, -26}
+, {-53, -9, 18}
+, {-42, -50, -22}}
+, {{-2, -16, -32}
+, {14, -33, -21}
+, {18, -19, -46}
+, {33, 52, 9}}
+, {{27, 15, -33}
+, {50, -40, -43}
+, {12, -11, -1}
+, {13, 32, 22}}
+, {{52, -32, -24}
+, {-27, -21, 17}
+, {16, -41, -39}
+, {-2, -22, -18}}
+, {{14, 51, -39}
+, {-2, -2, 45}
+, {-29, -24, -19}
+, {37, -46, -16}}
+, {{25, -18, 66}
+, {-19, -9, -1}
+, {-25, 32, -39}
+, {3, -43, 35}}
+, {{-8, -22, -2}
+, {-30, 57, -32}
+, {17, 29, 34}
+, {-10, -41, -24}}
+, {{39, 47, -17}
+, {39, -21, -34}
+, {-30, 28, 36}
+, {-18, 0, -58}}
+, {{13, -44, 33}
+, {-30, -10, -29}
+, {49, 7, -23}
+, {-36, -21, 46}}
+, {{-34, 2, 30}
+, {38, -8, 14}
+, {57, 40, 31}
+, {3, 11, 25}}
+, {{-29, 63, 21}
+, {-5, 54, -29}
+, {7, -12, 51}
+, {26, 31, -16}}
+, {{-12, -49, -17}
+, {-35, -38, -37}
+, {-34, -44, 33}
+, {-36, -31, 36}}
+, {{60, -38, 36}
+, {17, 52, 40}
+, {0, -18, 31}
+, {-42, -29, -35}}
+, {{56, -20, 46}
+, {-37, -2, 54}
+, {29, 41, 45}
+, {51, 39, -25}}
+, {{-6, -31, -11}
+, {14, 46, -33}
+, {29, -46, -50}
+, {17, -36, 48}}
+, {{-29, -17, 20}
+, {39, 14, 48}
+, {-1, 42, 0}
+, {45, -45, 5}}
+, {{23, 41, -45}
+, {-33, -24, 3}
+, {-50, -2, -25}
+, {48, 6, 12}}
+, {{-32, -22, -22}
+, {44, -34, 29}
+, {31, 20, -31}
+, {-51, -10, -26}}
+, {{58, 47, -7}
+, {27, 14, -7}
+, {-37, -41, -25}
+, {-5, -12, -21}}
+, {{-36, 12, 10}
+, {-11, -69, -44}
+, {-21, 50, -3}
+, {-38, 29, -48}}
+, {{-18, -25, -10}
+, {39, -54, -27}
+, {33, -40, 61}
+, {15, 45, 1}}
+, {{-48, 3, -58}
+, {-12, -7, -19}
+, {-9, 6, -28}
+, {38, 41, -32}}
+, {{17, -63, 38}
+, {-18, -51, -35}
+, {4, -26, -10}
+, {33, 22, 8}}
+, {{-1, -27, -29}
+, {-40, -27, -23}
+, {-36, -22, -43}
+, {57, -48, -38}}
+, {{-12, -20, -17}
+, {-50, 10, -59}
+, {-14, 61, -35}
+, {33, 17, 0}}
+, {{-22, 13, -4}
+, {62, 12, 21}
+, {-53, 21, 18}
+, {52, -18, -2}}
+, {{37, 54, 11}
+, {-9, 12, -43}
+, {-29, -28, 41}
+, {-28, -39, 22}}
+, {{59, 33, 55}
+, {-5, -31, 16}
+, {31, -10, 3}
+, {-16, 9, -37}}
+, {{-37, 48, 16}
+, {-14, 56, -3}
+, {27, -9, -44}
+, {6, 45, 50}}
+, {{44, -41, 7}
+, {-40, -14, -31}
+, {57, 10, 36}
+, {-22, -44, -49}}
+, {{-28, 54, 53}
+, {-39, -22, -33}
+, {-46, 23, -35}
+, {-16, -31, 10}}
+, {{11, -29, 14}
+, {-33, 31, -56}
+, {34, 48, 11}
+, {-29, -6, -10}}
+, {{-12, -37, -1}
+, {42, -16, 39}
+, {31, -32, 8}
+, {55, 15, 38}}
+, {{50, 51, 26}
+, {0, -39, 25}
+, {-13, -15, -31}
+, {15, 14, -20}}
+, {{46, 0, -39}
+, {60, -4, 39}
+, {0, 8, -47}
+, {-20, 39, -42}}
+, {{-37, 33, -57}
+, {-34, -40, 10}
+, {36, 18, -20}
+, {37, 19, -14}}
+, {{11, 43, 24}
+, {34, -5, 18}
+, {-45, -46, -5}
+, {-2, -69, -13}}
+, {{-35, 34, -33}
+, {26, -16, 16}
+, {7, 23, 53}
+, {-48, 31, -56}}
+, {{-46, 43, -52}
+, {19, -42, -17}
+, {-34, 47, 10}
+, {46, 27, 29}}
+, {{-20, -59, -5}
+, {-24, 30, 57}
+, {12, -44, 32}
+, {28, -43, 35}}
+, {{-26, 23, 35}
+, {26, 41, 36}
+, {8, 11, -18}
+, {41, 5, -37}}
+, {{-13, 55, -51}
+, {-11, 48, 0}
+, {1, -59, -58}
+, {16, 56, -34}}
+, {{-26, 29, 31}
+, {-34, 60, -37}
+, {17, -31, -48}
+, {29, 19, 36}}
+, {{3, 32, -8}
+, {-37, -30, -60}
+, {53, 31, 37}
+, {-18, -19, -56}}
+, {{-12, 25, 46}
+, {0, 45, -31}
+, {21, -32, 48}
+, {8, 52, 7}}
+, {{-50, -5, 13}
+, {47, -23, 38}
+, {49, -23, 48}
+, {16, -25, 41}}
+, {{-23, -34, 62}
+, {-57, -51, -39}
+, {29, -13, -6}
+, {20, -19, 40}}
+, {{-35, 39, -38}
+, {8, -25, 25}
+, {-30, 47, 37}
+, {-7, -41, -4}}
+, {{-9, -11, -47}
+, {43, 28, 34}
+, {-38, -20, 4}
+, {-15, -41, -42}}
+, {{-1, -43, -22}
+, {-48, -44, 8}
+, {46, 26, -15}
+, {43, -14, -1}}
+, {{17, 52, -51}
+, {52, -39, 35}
+, {25, -11, 6}
+, {-22, 34, -1}}
+, {{12, -9, -55}
+, {54, 17, -10}
+, {-3, -42, -45}
+, {-11, 11, 50}}
+, {{39, 52, 16}
+, {-14, 43, -32}
+, {3, -47, 36}
+, {40, -2, 57}}
+, {{35, -40, 7}
+, {-13, 14, 29}
+, {-39, -8, 31}
+, {-32, 19, 34}}
+, {{-30, -37, -44}
+, {-29, -34, -33}
+, {-38, 11, -18}
+, {-23, -18, 39}}
+, {{-7, 19, 42}
+, {12, -23, -37}
+, {-21, 29, -4}
+, {65, -38, 3}}
+, {{28, 47, 43}
+, {-8, -6, 45}
+, {-13, -25, -50}
+, {25, 6, 55}}
+, {{-30, 18, 47}
+, {-52, -43, 47}
+, {-35, -31, -11}
+, {40, 29, 55}}
+, {{-11, 29, -31}
+, {54, -5, -27}
+, {55, 64, -26}
+, {-20, -11, -17}}
+, {{-23, 25, 18}
+, {27, 28, 49}
+, {23, 22, 31}
+, {-42, -48, -47}}
+, {{-3, 37, -47}
+, {36, 6, -7}
+, {-44, -39, -12}
+, {-24, 44, -28}}
+, {{-18, 34, -47}
+, {-21, 33, 35}
+, {-21, 53, 19}
+, {-21, -44, 11}}
+, {{-31, 34, 14}
+, {-34, -34, 46}
+, {-4, 3, 5}
+, {46, -46, 20}}
+, {{-53, -31, 24}
+, {41, 21, -30}
+, {6, -49, 27}
+, {7, -26, 42}}
+, {{-4, -18, -21}
+, {-19, -1, -45}
+, {43, 28, 24}
+, {4, 31, -44}}
+, {{29, 33, -7}
+, {-34, 48, 12}
+, {18, 25, -18}
+, {32, 52, -9}}
+, {{-56, -1, -25}
+, {34, 25, 33}
+, {-42, -42, 53}
+, {68, -20, 8}}
+, {{-14, -11, 31}
+, {-34, -6, -14}
+, {-69, 19, -71}
+, {13, -18, -16}}
+, {{61, 7, -6}
+, {39, -53, -8}
+, {-58, 5, 36}
+, {-37, -14, 19}}
+, {{61, 60, 56}
+, {-58, -2, 38}
+, {3, 30, 38}
+, {-21, 13, 3}}
+, {{-40, 12, -22}
+, {-44, 35, -37}
+, {-32, 28, -50}
+, {44, 22, -25}}
+, {{-3, -22, -6}
+, {-42, -1, -44}
+, {52, 18, 22}
+, {14, -47, 11}}
+, {{44, 25, -7}
+, {3, -16, -17}
+, {-25, 2, -54}
+, {-37, -39, -18}}
+, {{-36, -37, 25}
+, {18, -16, -45}
+, {46, 28, -22}
+, {-18, -15, -2}}
+, {{4, 25, 34}
+, {-30, 16, 24}
+, {53, -34, -27}
+, {2, 15, -63}}
+, {{-1, -8, 42}
+, {24, -43, -42}
+, {41, 33, -18}
+, {3, 44, 48}}
+, {{51, 18, 56}
+, {20, 17, 5}
+, {40, -19, 24}
+, {-41, -34, -10}}
+, {{-25, 27, -44}
+, {-8, 2, 25}
+, {3, 16, 45}
+, {-20, -15, 55}}
+, {{60, 11, -13}
+, {26, 38, 63}
+, {35, -23, 3}
+, {-13, 39, 0}}
+, {{-22, -38, 42}
+, {38, 30, -43}
+, {-35, 40, 23}
+, {8, -42, -48}}
+, {{-25, 23, 17}
+, {-54, -35, 9}
+, {55, 34, -9}
+, {37, -24, 47}}
+, {{45, -28, -54}
+, {11, 15, -30}
+, {43, 46, 39}
+, {55, 18, -31}}
+, {{38, -8, 22}
+, {20, 60, -23}
+, {21, 4, 45}
+, {-32, -22, 4}}
+, {{-11, 46, 9}
+, {23, 4, -55}
+, {-36, 20, -10}
+, {-20, -47, -32}}
+, {{0, -18, 20}
+, {-52, 12, 30}
+, {57, 41, 35}
+, {-19, 30, -13}}
+, {{46, -10, -46}
+, {37, -11, 21}
+, {-10, -35, 34}
+, {13, -32, 7}}
+, {{-9, -48, 38}
+, {8, -1, 35}
+, {-7, 40, 58}
+, {-29, -35, 36}}
+, {{-20, -33, 19}
+, {18, -50, -31}
+, {-40, 32, 33}
+, {33, -6, 40}}
+, {{-3, -39, 42}
+, {-26, 7, 15}
+, {-46, 20, -52}
+, {13, -44, -9}}
+, {{-18, -19, 17}
+, {21, 35, -34}
+, {6, -60, 17}
+, {-19, 39, -42}}
+, {{0, -37, -7}
+, {-12, 46, 24}
+, {35, 36, 11}
+, {51, 47, 39}}
+, {{42, 5, -16}
+, {29, 14, 54}
+, {15, 18, 48}
+, {21, 7, 13}}
+, {{10, 48, -34}
+, {5, -15, -42}
+, {3, -32, 36}
+, {16, 28, -29}}
+, {{7, -23, -26}
+, {21, 47, 10}
+, {34, 7, 49}
+, {-40, -43, 18}}
+, {{10, -38, 33}
+, {50, -24, -9}
+, {-1, -44, 26}
+, {-47, -6, 29}}
+, {{-5, 53, 71}
+, {26, -31, 29}
+, {15, -7, -14}
+, {39, 1, 0}}
+, {{-18, -8, -13}
+, {-47, 17, -40}
+, {20, 16, 46}
+, {-46, 24, 48}}
+, {{5, -17, -9}
+, {1, 36, -44}
+, {11, -28, 35}
+, {48, 5, 44}}
+, {{47, -16, 29}
+, {-14, -32, 27}
+, {-10, 8, 46}
+, {12, -46, 16}}
+, {{-52, -32, -40}
+, {19, -4, -31}
+, {47, -37, 12}
+, {-15, -8, 2}}
+, {{-6, 24, -5}
+, {50, -46, 35}
+, {-1, -13, -21}
+, {-43, 16, -46}}
+, {{1, 14, -30}
+, {0, -27, 71}
+, {-41, -49, 13}
+, {-45, -18, 28}}
+, {{20, -40, -24}
+, {-38, -22, 25}
+, {-41, 10, -22}
+, {-11, 12, -54}}
+, {{26, 22, 22}
+, {18, 39, -50}
+, {-20, -37, -7}
+, {-24, 18, -26}}
+, {{-32, 46, 1}
+, {-40, -7, -10}
+, {-34, 16, -17}
+, {41, -36, 45}}
+, {{-6, -28, -17}
+, {4, 38, 51}
+, {46, -29, 37}
+, {38, -33, 50}}
+, {{44, -10, -25}
+, {20, -36, -16}
+, {-29, -23, 0}
+, {42, 12, -28}}
+, {{-21, -33, 22}
+, {-16, -33, 24}
+, {-37, -17, -23}
+, {-13, 25, 37}}
+, {{27, 58, -19}
+, {-10, 53, -32}
+, {-52, -12, -4}
+, {-46, 43, -9}}
+, {{0, -37, -1}
+, {36, -13, 21}
+, {-28, 14, 19}
+, {21, -52, -54}}
+, {{7, 16, 9}
+, {14, -57, -69}
+, {-38, 31, 3}
+, {65, 44, 7}}
+, {{35, 8, 54}
+, {-30, 31, 48}
+, {-58, 16, -13}
+, {-12, 34, -64}}
+, {{17, -23, 46}
+, {3, 52, 22}
+, {28, -21, -42}
+, {48, 40, 4}}
+, {{38, -3, -42}
+, {42, -22, 30}
+, {4, 26, 5}
+, {14, -51, 31}}
+, {{-5, -39, -13}
+, {49, -34, 2}
+, {-53, -34, -47}
+, {-28, 11, -7}}
+, {{-30, 0, -21}
+, {-23, -29, -29}
+, {-16, -16, -37}
+, {44, -26, -53}}
+, {{14, 50, -34}
+, {50, 28, 2}
+, {-12, -60, 41}
+, {52, -17, 0}}
+, {{29, 41, 42}
+, {45, 28, 3}
+, {-56, -30, 0}
+, {15, -45, 37}}
+, {{-46, 26, -17}
+, {-48, -8, -42}
+, {-41, -54, -44}
+, {4, -52, 36}}
+, {{35, 10, 34}
+, {16, 28, -31}
+, {13, 5, -48}
+, {0, -19, 50}}
+, {{-17, -22, 4}
+, {-21, 55, -2}
+, {2, -10, 42}
+, {54, 54, 62}}
+, {{-38, -41, 16}
+, {-40, 25, -41}
+, {44, 25, -36}
+, {-16, 23, -1}}
+, {{-54, -18, 16}
+, {-18, -5, -37}
+, {-31, 14, 52}
+, {1, 37, 29}}
+, {{-42, -57, -24}
+, {-14, 41, 24}
+, {-38, -7, -32}
+, {-47, 44, 2}}
+, {{-56, 14, -9}
+, {34, 20, -39}
+, {-51, 26, 37}
+, {-4, 39, -21}}
+, {{-48, 19, 19}
+, {-27, 30, -14}
+, {-22, 11, 21}
+, {2, -27, -46}}
+, {{-48, 50, -17}
+, {-13, -54, 30}
+, {13, 2, 11}
+, {-9, 19, -19}}
+, {{4, -26, 38}
+, {24, -19, 57}
+, {39, 39, 18}
+, {-51, -17, -61}}
+, {{-37, 39, 37}
+, {38, -31, -16}
+, {-20, 54, -41}
+, {-47, -22, -13}}
+, {{-38, -42, 47}
+, {8, -14, -24}
+, {-33, -28, -13}
+, {18, -51, 40}}
+, {{23, 10, 25}
+, {-2, 32, -18}
+, {-41, 1, -50}
+, {5, 39, -35}}
+, {{-22, -20, -15}
+, {34, 55, -22}
+, {7, 7, -30}
+, {27, 23, 49}}
+, {{-29, 27, -12}
+, {-11, 25, 49}
+, {-6, 29, 54}
+, {-20, -3, 42}}
+, {{-43, -9, 52}
+, {10, -22, -2}
+, {-40, -25, 37}
+, {-31, 18, 36}}
+, {{45, 45, -38}
+, {-40, 31, 21}
+, {3, 5, -25}
+, {-10, -54, -35}}
+, {{26, -34, 18}
+, {11, 12, 27}
+, {-31, 36, -28}
+, {54, -33, 32}}
+, {{-4, 17, -41}
+, {14, 23, 39}
+, {50, -29, 45}
+, {48, -3, 12}}
+, {{-40, 10, -19}
+, {-27, -28, 17}
+, {-25, -21, 13}
+, {-44, -39, 40}}
+, {{-16, 1, -18}
+, {-59, -5, 2}
+, {34, 42, 37}
+, {10, 35, 31}}
+, {{54, 43, 29}
+, {29, -7, 13}
+, {-16, -38, 11}
+, {1, -37, 10}}
+, {{-50, -25, 24}
+, {-26, -35, 62}
+, {-45, 23, -26}
+, {40, 9, 61}}
+, {{11, 50, -37}
+, {4, 38, -43}
+, {-45, -25, 29}
+, {-51, 38, -38}}
+, {{-25, 16, 53}
+, {39, -32, 34}
+, {12, 6, 20}
+, {-34, 42, 39}}
+, {{40, -46, -22}
+, {-14, 17, -38}
+, {6, 44, 0}
+, {46, -36, 21}}
+, {{-25, -14, -59}
+, {-22, 71, 44}
+, {-7, -31, -18}
+, {63, -31, 70}}
+, {{44, -40, 22}
+, {-28, 33, -24}
+, {18, -50, 44}
+, {32, 11, -31}}
+, {{22, -11, 40}
+, {-15, 7, -10}
+, {34, -34, 37}
+, {-15, 37, -23}}
+, {{24, -3, -37}
+, {-7, -35, -32}
+, {-43, 43, 2}
+, {20, -29, 21}}
+, {{-23, 37, 48}
+, {-10, 32, 22}
+, {49, 9, 43}
+, {34, -23, -4}}
+, {{38, 11, 9}
+, {-37, -22, -27}
+, {-42, 0, -55}
+, {-35, -7, -22}}
+, {{30, 24, 21}
+, {53, 16, -4}
+, {-17, -8, 24}
+, {54, 60, 52}}
+, {{-38, 35, 12}
+, {40, -32, 42}
+, {34, 40, 39}
+, {14, -40, -8}}
+, {{-31, -8, 55}
+, {-28, -14, -39}
+, {47, -41, -42}
+, {49, 57, -19}}
+, {{19, -11, -8}
+, {-54, 22, -46}
+, {53, 39, -5}
+, {49, 31, -51}}
+, {{13, -37, 32}
+, {-40, 19, -15}
+, {43, 48, 39}
+, {-21, 15, 42}}
+, {{9, -33, -4}
+, {32, 38, -28}
+, {35, -45, 21}
+, {-40, 17, 15}}
+, {{0, -20, -24}
+, {48, -37, -33}
+, {-26, 19, 34}
+, {-19, -49, 10}}
+, {{25, -41, -41}
+, {2, 57, 47}
+, {9, -31, -47}
+, {-13, 23, 24}}
+, {{13, -15, 39}
+, {-26, -2, -36}
+, {-43, -28, 17}
+, {38, 50, 16}}
+, {{-26, 4, -44}
+, {-17, 49, 47}
+, {40, 29, 49}
+, {-11, 14, -12}}
+, {{-8, 3, -21}
+, {8, 25, 57}
+, {-2, 39, 59}
+, {-32, 15, -53}}
+, {{-13, 45, 7}
+, {-21, 58, 42}
+, {40, 19, -37}
+, {20, -26, 45}}
+, {{28, 2, 24}
+, {-37, 5, 42}
+, {47, 47, 7}
+, {35, -50, -4}}
+, {{-13, 5, -32}
+, {-16, 0, -50}
+, {-71, -36, 12}
+, {13, 54, 20}}
+, {{46, -32, 12}
+, {-23, 35, -61}
+, {-46, 44, 53}
+, {63, 51, -5}}
+, {{0, 32, -10}
+, {21, 13, -15}
+, {-37, -27, -27}
+, {39, -49, -16}}
+, {{14, 53, -35}
+, {15, 32, 43}
+, {-8, -35, -51}
+, {34, -25, -32}}
+, {{-33, 40, 46}
+, {-8, 16, 44}
+, {-42, -40, -38}
+, {0, 36, 40}}
+, {{17, -33, 51}
+, {3, -5, 43}
+, {-39, 35, 40}
+, {43, 41, -49}}
+, {{52, -13, -48}
+, {53, 40, -13}
+, {-41, 42, 28}
+, {-21, -3, 4}}
+, {{16, -44, 8}
+, {-29, 0, 46}
+, {33, 27, -28}
+, {11, -42, 51}}
+, {{-18, 27, -36}
+, {30, -55, 25}
+, {-10, 47, 40}
+, {8, -11, -9}}
+, {{23, -10, -42}
+, {17, -22, 26}
+, {4, 46, -43}
+, {-12, -50, -48}}
+, {{-28, -40, -37}
+, {0, -28, -9}
+, {-44, -10, -36}
+, {41, -19, 28}}
+, {{-25, 33, -15}
+, {-19, 53, -24}
+, {14, -30, 3}
+, {-40, 40, -8}}
+, {{40, 48, 3}
+, {14, -42, 23}
+, {-24, -22, 22}
+, {5, 61, -18}}
+, {{-15, -47, -61}
+, {-28, 39, 0}
+, {13, 9, 32}
+, {-49, -27, 32}}
+, {{25, 44, 4}
+, {0, -17, 0}
+, {16, -45, -38}
+, {29, 37, 27}}
+, {{52, -18, 1}
+, {72, -27, -30}
+, {18, 62, 64}
+, {11, 4, 33}}
+, {{48, 27, -27}
+, {-36, -16, -23}
+, {14, -43, 2}
+, {2, -38, 27}}
+, {{43, 47, -36}
+, {17, 48, 60}
+, {-2, -12, 2}
+, {48, -31, -24}}
+, {{7, -27, -36}
+, {-52, -33, -34}
+, {-8, -58, 0}
+, {20, -33, 57}}
+, {{17, -34, 26}
+, {37, -19, -13}
+, {44, -3, -40}
+, {-44, -19, -8}}
+, {{-11, -59, -60}
+, {13, 20, 24}
+, {-26, 55, -27}
+, {27, -41, 18}}
+, {{-12, -43, -42}
+, {-39, 34, -39}
+, {9, 47, -28}
+, {-25, -24, -15}}
+, {{-30, 48, 28}
+, {-52, -11, -55}
+, {-53, 10, 45}
+, {21, 44, 8}}
+, {{33, 48, -47}
+, {39, -43, -20}
+, {32, -28, -10}
+, {17, -34, 0}}
+, {{16, -23, -28}
+, {48, 6, 49}
+, {56, 33, -14}
+, {0, -39, -22}}
+, {{25, -60, -14}
+, {25, 4, -28}
+, {-9, 40, -26}
+, {-27, 31, -53}}
+, {{52, 48, 64}
+, {-45, -45, -28}
+, {44, -47, 25}
+, {1, -3, -23}}
+, {{18, -63, 13}
+, {54, -14, 52}
+, {37, 67, 16}
+, {-16, 29, -33}}
+, {{-59, -66, 24}
+, {-31, -16, 18}
+, {43, -23, -52}
+, {15, -37, -42}}
+, {{-18, 27, -25}
+, {-49, -54, 1}
+, {55, -1, 15}
+, {30, 63, -23}}
+, {{25, -4, 27}
+, {-31, -17, -35}
+, {7, 17, -44}
+, {-26, 32, 52}}
+, {{-52, -48, 32}
+, {18, 29, -42}
+, {15, -45, -11}
+, {-2, 47, 5}}
+, {{4, 21, 41}
+, {46, 55, -39}
+, {9, -20, 42}
+, {-27, 45, -34}}
+, {{-9, -49, -26}
+, {50, 31, -11}
+, {-22, -38, 17}
+, {-40, 30, 13}}
+, {{32, -40, 5}
+, {-41, -23, 41}
+, {22, 19, 29}
+, {8, 7, 32}}
+, {{-24, 37, 27}
+, {-23, -28, 4}
+, {52, 26, 53}
+, {26, -34, 28}}
+, {{-45, 37, -38}
+, {27, 23, -7}
+, {-7, -51, -3}
+, {-23, 47, -31}}
+, {{-8, 35, -46}
+, {43, 37, -11}
+, {-2, 35, 29}
+, {-28, -33, 38}}
+, {{-53, -6, -1}
+, {60, -20, -34}
+, {-23, 43, -6}
+, {-7, -46, -36}}
+, {{3, -52, -10}
+, {-46, -40, -47}
+, {0, 52, -6}
+, {45, 9, -25}}
+, {{22, -5, 45}
+, {30, 49, 30}
+, {14, 51, 47}
+, {56, 18, -7}}
+, {{41, -2, -17}
+, {2, 26, 26}
+, {-45, 25, 40}
+, {-52, -27, 4}}
+, {{16, -14, 0}
+, {16, 55, -26}
+, {5, 44, 18}
+, {47, 42, -38}}
+, {{12, -34, 11}
+, {-14, 22, 46}
+, {46, -28, 3}
+, {10, -18, -60}}
+, {{-38, 35, 17}
+, {-53, -40, 1}
+, {2, -47, -19}
+, {22, 29, -3}}
+, {{69, -6, 5}
+, {-47, -12, -30}
+, {-30, -23, -65}
+, {-10, 18, 57}}
+, {{-41, -24, -27}
+, {55, -5, 17}
+, {15, 16, -10}
+, {11, -36, 29}}
+, {{44, 35, -48}
+, {52, 25, -25}
+, {-17, 42, 22}
+, {34, -21, 18}}
+, {{0, 23, -49}
+, {-30, 6, -53}
+, {54, 55, -48}
+, {-4, 46, 10}}
+, {{-52, 12, 6}
+, {17, 46, -10}
+, {-25, 72, -38}
+, {3, -16, -36}}
+, {{-50, -30, -8}
+, {25, -13, 25}
+, {-46, -48, -2}
+, {18, 25, -42}}
+, {{24, -40, -15}
+, {62, 37, 20}
+, {-39, 6, 0}
+, {34, 32, 16}}
+, {{17, 17, 22}
+, {-29, -14, -26}
+, {64, -32, 73}
+, {-37, -7, 41}}
+, {{-31, 19, 45}
+, {-2, -61, 8}
+, {-3, 17, 42}
+, {35, -38, 20}}
+, {{-37, 54, 9}
+, {31, 0, 53}
+, {13, 41, -34}
+, {-15, 35, -52}}
+, {{-14, 35, -8}
+, {43, -9, 35}
+, {53, -9, 1}
+, {49, 55, 49}}
+, {{30, -22, -48}
+, {31, -12, -4}
+, {-8, -48, -11}
+, {-23, 34, -53}}
+, {{2, -25, 47}
+, {-38, 44, 6}
+, {-46, -6, -44}
+, {4, -30, -24}}
+, {{14, -18, 1}
+, {-48, -26, -8}
+, {-62, -70, -54}
+, {-48, 37, 18}}
+, {{43, 0, 45}
+, {-26, -12, 19}
+, {-13, -42, -58}
+, {2, 11, 30}}
+, {{12, 30, -39}
+, {-48, 7, -15}
+, {48, 13, -51}
+, {-20, -10, 9}}
+, {{-29, 10, 47}
+, {-28, -15, -49}
+, {1, 46, -35}
+, {-33, -41, -24}}
+, {{-38, -27, -28}
+, {53, 28, -12}
+, {27, 11, 1}
+, {-52, 35, -53}}
+, {{50, 14, 47}
+, {42, 47, -40}
+, {-54, -28, 14}
+, {-52, 50, -20}}
+, {{24, 41, 24}
+, {14, -16, -19}
+, {-38, 49, 40}
+, {-14, -33, -3}}
+, {{17, -30, 10}
+, {38, 17, -11}
+, {29, -32, -2}
+, {-52, -19, -54}}
+, {{-27, 28, 16}
+, {-15, -34, 43}
+, {6, -53, -27}
+, {-38, -27, -50}}
+, {{50, -22, -21}
+, {-39, -18, 42}
+, {44, 4, 23}
+, {8, -17, 15}}
+, {{-24, -14, -26}
+, {-47, 35, -20}
+, {-44, -49, 11}
+, {-53, 20, -53}}
+, {{-26, -54, 31}
+, {-3, 52, 0}
+, {40, 26, -61}
+, {-8, -14, -22}}
+, {{-33, 7, 29}
+, {18, -3, 17}
+, {19, 58, 36}
+, {33, -17, 36}}
+, {{14, 22, -34}
+, {-19, -12, -10}
+, {-16, 32, 24}
+, {46, -51, 19}}
+, {{24, 28, -30}
+, {21, 42, 65}
+, {4, 30, -42}
+, {11, -9, -29}}
+, {{18, 39, -28}
+, {35, -23, 27}
+, {18, -53, -15}
+, {28, 8, -5}}
+, {{19, 59, 26}
+, {21, 21, -36}
+, {-18, -28, -25}
+, {21, -34, -35}}
+, {{27, -3, -8}
+, {-25, 9, 39}
+, {-41, -19, 69}
+, {36, 14, 38}}
+, {{45, 8, 41}
+, {-30, -6, 22}
+, {-49, -28, 10}
+, {-18, -58, -30}}
+, {{34, 42, 46}
+, {47, 19, 28}
+, {38, 9, -3}
+, {-36, 13, -22}}
+, {{-35, 23, 19}
+, {-24, 19, -7}
+, {27, 30, 39}
+, {-25, 41, -16}}
+, {{-35, -6, -16}
+, {34, -53, -38}
+, {-34, -43, -3}
+, {42, 4, -21}}
+, {{-24, 9, -29}
+, {41, -17, 41}
+, {34, -45, -16}
+, {43, 27, -40}}
+, {{-47, 38, 15}
+, {-4, -1, -46}
+, {50, -41, 8}
+, {31, 48, -26}}
+, {{-29, 32, -56}
+, {-11, -41, 20}
+, {-43, -34, -5}
+, {18, -1, -11}}};
+
+const sparse_weights_t conv1d_119_sparse = {
+  4, 3, conv1d_119_sparse_start, conv1d_119_sparse_index, &conv1d_119_sparse_values[0][0][0]
+};
+
+#define DENSE_58_SPARSE // 240 of 320 blocks of 8 units x 2 inputs
+
+const int16_t dense_58_bias[40] = {-8, 10, 14, 4, 4, 11, 13, 0, -2, -9, -4, 2, -9, -4, 0, 9, -8, 4, 9, 2, -5, 14, 7, 14, 4, -3, -1, 11, -6, 0, -10, 1, 14, 0, 0, -8, -8, -3, 1, -8}
+;
+
+static const unsigned short dense_58_sparse_start[6] = { 0, 46, 97, 147, 195, 240 };
+
+static const unsigned short dense_58_sparse_index[240] = {1, 2, 4, 5, 6, 7, 8, 9, 11, 12, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 25, 26, 27, 28, 29, 30, 33, 34, 35, 39, 40, 41, 44, 46, 48, 49, 51, 52, 53, 54, 55, 56, 58, 60, 61, 62, 1, 2, 3, 4, 6, 7, 8, 10, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 25, 26, 27, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 40, 41, 42, 43, 44, 45, 46, 47, 49, 50, 51, 52, 53, 57, 58, 60, 61, 62, 0, 1, 2, 3, 5, 7, 8, 10, 12, 15, 16, 17, 18, 20, 21, 22, 23, 24, 25, 26, 28, 29, 30, 32, 33, 35, 36, 37, 39, 40, 41, 42, 43, 45, 46, 47, 48, 49, 50, 51, 52, 54, 55, 56, 57, 59, 60, 61, 62, 63, 1, 2, 3, 4, 5, 6, 8, 9, 10, 11, 12, 13, 14, 15, 18, 19, 20, 21, 22, 24, 25, 26, 27, 28, 29, 32, 33, 35, 36, 37, 39, 41, 42, 43, 44, 46, 48, 49, 50, 51, 52, 54, 55, 56, 59, 61, 62, 63, 0, 1, 4, 6, 7, 9, 10, 11, 12, 14, 15, 16, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 32, 33, 34, 35, 36, 38, 39, 40, 42, 44, 46, 47, 48, 49, 51, 52, 54, 56, 57, 58, 59, 61};
+
+static const number_t dense_58_sparse_values[240][8][2] = {{{-50, 62}
+, {60, -27}
+, {111, 71}
+, {15, -40}
+, {-57, -58}
+, {-80, 60}
+, {-69, 76}
+, {82, -39}}
+, {{-23, 4}
+, {87, -34}
+, {66, 25}
+, {36, -48}
+, {61, -119}
+, {-13, -66}
+, {-29, -32}
+, {92, -21}}
+, {{-75, -13}
+, {-8, 48}
+, {-47, 70}
+, {75, -75}
+, {-71, -33}
+, {102, 35}
+, {3, 18}
+, {-26, 67}}
+, {{91, -10}
+, {-50, 15}
+, {58, -12}
+, {-51, 48}
+, {75, 70}
+, {21, 83}
+, {-85, -79}
+, {22, 88}}
+, {{-50, 40}
+, {58, 80}
+, {-82, -11}
+, {-59, 24}
+, {-50, -79}
+, {-82, 84}
+, {-57, -72}
+, {-58, 58}}
+, {{-7, -85}
+, {-49, 22}
+, {-25, 95}
+, {82, 90}
+, {-77, -81}
+, {-62, -72}
+, {61, -53}
+, {-71, 75}}
+, {{-45, -61}
+, {0, 80}
+, {-57, -25}
+, {69, -32}
+, {-65, 56}
+, {-36, -6}
+, {25, -81}
+, {35, -33}}
+, {{44, 15}
+, {-44, -16}
+, {59, 46}
+, {-59, -3}
+, {-53, 90}
+, {28, 71}
+, {102, -102}
+, {-88, -70}}
+, {{127, -59}
+, {89, 80}
+, {83, -63}
+, {33, -77}
+, {-15, -100}
+, {-108, 66}
+, {-25, -77}
+, {-26, -23}}
+, {{-102, -57}
+, {-61, -1}
+, {-68, -102}
+, {-90, 85}
+, {42, -87}
+, {55, 105}
+, {41, 32}
+, {59, -25}}
+, {{-71, -95}
+, {-44, 30}
+, {7, 90}
+, {5, 22}
+, {-27, -66}
+, {-49, 62}
+, {-30, -12}
+, {73, 69}}
+, {{6, 17}
+, {91, -41}
+, {34, -100}
+, {-25, 92}
+, {-43, 106}
+, {-79, 54}
+, {93, 42}
+, {23, -8}}
+, {{-54, 65}
+, {-46, 32}
+, {-15, -49}
+, {-20, -21}
+, {-81, 5}
+, {32, 89}
+, {6, -90}
+, {95, 59}}
+, {{31, -65}
+, {9, 92}
+, {-2, -21}
+, {-94, 67}
+, {-86, 46}
+, {34, -3}
+, {91, 12}
+, {37, -71}}
+, {{-25, 45}
+, {-5, 42}
+, {24, 82}
+, {39, -73}
+, {71, -20}
+, {89, -79}
+, {40, 42}
+, {-42, 17}}
+, {{-84, 64}
+, {42, -16}
+, {60, -55}
+, {53, 52}
+, {27, 102}
+, {15, 12}
+, {31, 35}
+, {24, -37}}
+, {{35, -95}
+, {-87, -3}
+, {76, 59}
+, {6, -96}
+, {41, -25}
+, {-28, -74}
+, {7, 14}
+, {-63, 64}}
+, {{21, 86}
+, {5, 76}
+, {-3, 69}
+, {-102, 85}
+, {-48, 77}
+, {-64, 74}
+, {-67, 66}
+, {-17, -96}}
+, {{-14, -84}
+, {16, -60}
+, {-82, 65}
+, {-89, -75}
+, {52, 42}
+, {-28, 37}
+, {-65, -83}
+, {-30, 9}}
+, {{116, 80}
+, {-23, -25}
+, {20, -21}
+, {111, 55}
+, {106, -32}
+, {-76, -66}
+, {-62, -92}
+, {88, -8}}
+, {{87, -58}
+, {-36, 33}
+, {-73, -34}
+, {-100, -4}
+, {-83, 95}
+, {-60, -25}
+, {-80, -41}
+, {55, 87}}
+, {{-21, -34}
+, {74, 22}
+, {40, -33}
+, {70, -49}
+, {51, 91}
+, {-89, -63}
+, {45, 76}
+, {-20, -46}}
+, {{-74, 57}
+, {-86, -6}
+, {-20, -56}
+, {-45, 71}
+, {59, -88}
+, {-94, 8}
+, {3, -50}
+, {-59, 13}}
+, {{-9, -47}
+, {68, -29}
+, {19, 44}
+, {17, 52}
+, {17, 74}
+, {101, -85}
+, {72, -33}
+, {20, 79}}
+, {{-70, 0}
+, {17, -30}
+, {-94, 108}
+, {92, 65}
+, {-41, 57}
+, {70, -57}
+, {-67, -50}
+, {51, 23}}
+, {{115, -33}
+, {66, -26}
+, {-74, 17}
+, {-45, 74}
+, {7, 41}
+, {19, -101}
+, {43, 62}
+, {-53, 32}}
+, {{-50, 83}
+, {72, 30}
+, {63, -57}
+, {53, 20}
+, {-71, 42}
+, {-96, 50}
+, {-28, 85}
+, {-45, 70}}
+, {{75, -89}
+, {-23, -70}
+, {20, 2}
+, {-88, 12}
+, {-42, -9}
+, {-57, 31}
+, {-106, 44}
+, {30, 15}}
+, {{-94, 9}
+, {73, 8}
+, {47, -52}
+, {60, -102}
+, {60, -63}
+, {-63, 78}
+, {88, -75}
+, {-16, -52}}
+, {{-79, -5}
+, {21, 16}
+, {39, 78}
+, {48, -35}
+, {-42, -60}
+, {-61, -55}
+, {92, 55}
+, {-66, -33}}
+, {{66, -58}
+, {11, -40}
+, {34, 12}
+, {-82, -14}
+, {42, -90}
+, {-37, -56}
+, {45, 28}
+, {-74, -100}}
+, {{-70, 110}
+, {-77, 57}
+, {21, 14}
+, {3, -66}
+, {-68, 75}
+, {66, 42}
+, {99, -59}
+, {-79, -77}}
+, {{96, -7}
+, {80, -41}
+, {-13, -85}
+, {-71, 6}
+, {8, -18}
+, {-53, 63}
+, {-77, 69}
+, {-90, -78}}
+, {{-77, -96}
+, {106, -42}
+, {-74, 38}
+, {30, 7}
+, {9, 29}
+, {105, -20}
+, {54, -48}
+, {-85, -92}}
+, {{-44, -25}
+, {15, -60}
+, {-62, -64}
+, {58, -95}
+, {10, -35}
+, {31, 17}
+, {-80, -41}
+, {27, -56}}
+, {{4, -65}
+, {56, -34}
+, {-41, 63}
+, {-62, 41}
+, {-28, 5}
+, {-58, 47}
+, {3, 81}
+, {-59, -93}}
+, {{18, 24}
+, {-2, 93}
+, {-46, 22}
+, {73, -78}
+, {-9, -100}
+, {-15, -42}
+, {88, -94}
+, {-25, -3}}
+, {{-48, 82}
+, {34, -6}
+, {-74, -77}
+, {31, 49}
+, {-15, 19}
+, {19, -52}
+, {71, 17}
+, {-89, -24}}
+, {{-53, 14}
+, {81, -5}
+, {48, 56}
+, {-16, -85}
+, {62, -10}
+, {36, 58}
+, {23, 69}
+, {-91, -27}}
+, {{-29, 23}
+, {-75, -66}
+, {-18, 86}
+, {89, 35}
+, {-70, 73}
+, {66, -18}
+, {-79, -75}
+, {-79, 73}}
+, {{14, 62}
+, {-13, 110}
+, {-54, -109}
+, {-31, -36}
+, {-34, 41}
+, {36, 37}
+, {92, 56}
+, {-64, -69}}
+, {{-56, 55}
+, {-64, -76}
+, {-2, 16}
+, {79, 62}
+, {69, 28}
+, {87, 2}
+, {49, -46}
+, {-18, -10}}
+, {{-36, 51}
+, {36, -96}
+, {-20, -42}
+, {26, 56}
+, {-83, 65}
+, {-28, -75}
+, {-32, -64}
+, {-60, 69}}
+, {{36, 84}
+, {-29, -83}
+, {-70, 93}
+, {37, -32}
+, {48, 74}
+, {36, -75}
+, {13, -36}
+, {-83, -19}}
+, {{2, -94}
+, {50, 42}
+, {-31, 63}
+, {-19, 84}
+, {-44, -9}
+, {70, -34}
+, {27, 89}
+, {30, 69}}
+, {{44, -74}
+, {-46, 17}
+, {-56, 46}
+, {109, -94}
+, {15, -78}
+, {92, -53}
+, {-69, 12}
+, {-30, 53}}
+, {{-107, 11}
+, {-66, -14}
+, {-83, 27}
+, {74, 27}
+, {62, -24}
+, {-50, -6}
+, {87, -70}
+, {-71, -68}}
+, {{88, -21}
+, {-68, 91}
+, {10, 100}
+, {-69, -12}
+, {50, -41}
+, {-23, 57}
+, {-28, 28}
+, {79, -10}}
+, {{36, -71}
+, {16, 21}
+, {64, -76}
+, {61, 75}
+, {36, -53}
+, {65, -2}
+, {100, 47}
+, {-19, 29}}
+, {{-107, 90}
+, {30, 59}
+, {39, -13}
+, {4, -40}
+, {-69, 26}
+, {-12, 91}
+, {61, 2}
+, {87, -76}}
+, {{-17, 38}
+, {76, -21}
+, {-31, -10}
+, {68, -51}
+, {68, 35}
+, {-27, 37}
+, {66, 94}
+, {68, 12}}
+, {{27, 87}
+, {82, -43}
+, {-51, -95}
+, {15, 10}
+, {85, 72}
+, {-62, 21}
+, {88, 15}
+, {106, 65}}
+, {{53, -75}
+, {-36, 67}
+, {-100, 27}
+, {-20, 48}
+, {75, -4}
+, {-47, 49}
+, {-47, 55}
+, {-57, 38}}
+, {{21, -55}
+, {-93, -12}
+, {10, 93}
+, {95, -32}
+, {0, 79}
+, {18, -60}
+, {-59, 50}
+, {22, 67}}
+, {{34, 85}
+, {-62, 77}
+, {1, -70}
+, {12, 24}
+, {14, 40}
+, {22, 106}
+, {-100, -63}
+, {69, 30}}
+, {{80, -58}
+, {81, -15}
+, {-82, -103}
+, {68, -21}
+, {31, 28}
+, {-74, -101}
+, {-61, 64}
+, {57, 24}}
+, {{-55, -60}
+, {17, -90}
+, {48, -30}
+, {10, 69}
+, {-96, 44}
+, {6, 0}
+, {-72, 30}
+, {-83, -72}}
+, {{-56, 100}
+, {-17, -17}
+, {46, -59}
+, {33, 91}
+, {63, -107}
+, {63, 107}
+, {70, -65}
+, {9, -24}}
+, {{-66, -11}
+, {39, -85}
+, {-30, -36}
+, {-73, -8}
+, {-38, 9}
+, {68, -41}
+, {58, -53}
+, {57, -83}}
+, {{53, -90}
+, {-80, -62}
+, {-41, -35}
+, {-45, -42}
+, {-55, -95}
+, {-7, -52}
+, {-13, 81}
+, {-17, 74}}
+, {{92, -83}
+, {8, 67}
+, {-53, 87}
+, {-70, 71}
+, {-6, 54}
+, {0, 18}
+, {20, -76}
+, {15, -82}}
+, {{-54, 83}
+, {82, 9}
+, {39, -28}
+, {-2, -61}
+, {-41, -51}
+, {-60, 86}
+, {11, 45}
+, {-92, -81}}
+, {{62, -20}
+, {38, -80}
+, {-121, 90}
+, {-8, 75}
+, {52, -33}
+, {61, 27}
+, {-15, -72}
+, {37, 17}}
+, {{-22, 84}
+, {17, -40}
+, {-77, 87}
+, {87, -92}
+, {57, 93}
+, {-88, 29}
+, {67, 33}
+, {-22, -17}}
+, {{37, 79}
+, {-46, -43}
+, {7, 87}
+, {11, 64}
+, {68, -76}
+, {-40, -5}
+, {-92, 12}
+, {89, -101}}
+, {{65, -97}
+, {6, -44}
+, {65, 78}
+, {-99, 29}
+, {82, 110}
+, {-90, 47}
+, {84, 46}
+, {-6, 1}}
+, {{-47, 32}
+, {94, 4}
+, {38, -82}
+, {-95, -90}
+, {-81, 27}
+, {-95, -59}
+, {16, 35}
+, {-66, 66}}
+, {{42, -57}
+, {-44, -79}
+, {-53, -62}
+, {-85, 5}
+, {84, 72}
+, {-62, -97}
+, {-56, 14}
+, {4, 43}}
+, {{-76, 47}
+, {-5, 92}
+, {77, -31}
+, {88, -95}
+, {90, -57}
+, {-10, -76}
+, {74, 12}
+, {-67, 66}}
+, {{6, -5}
+, {-93, 60}
+, {-77, 17}
+, {-53, 106}
+, {-79, -79}
+, {-51, -39}
+, {-28, 0}
+, {93, 34}}
+, {{-92, -33}
+, {-18, 71}
+, {-97, 64}
+, {99, 22}
+, {21, 90}
+, {-76, -74}
+, {-43, 84}
+, {-49, 56}}
+, {{2, 34}
+, {58, 70}
+, {57, 54}
+, {90, -83}
+, {46, 18}
+, {85, 72}
+, {31, 45}
+, {41, -28}}
+, {{-23, -30}
+, {42, 67}
+, {69, -88}
+, {-38, -57}
+, {35, -32}
+, {90, -26}
+, {-82, 44}
+, {15, 106}}
+, {{61, -37}
+, {-25, -17}
+, {-93, -17}
+, {12, -45}
+, {51, -91}
+, {15, 67}
+, {31, -58}
+, {-21, 83}}
+, {{98, -41}
+, {3, -9}
+, {39, -6}
+, {-88, 56}
+, {43, 36}
+, {-21, -57}
+, {-37, -71}
+, {86, -15}}
+, {{107, 52}
+, {-59, 16}
+, {-66, -34}
+, {11, 51}
+, {52, 60}
+, {90, 17}
+, {-17, -7}
+, {15, -80}}
+, {{17, 63}
+, {50, 1}
+, {67, 85}
+, {-108, -53}
+, {-40, -47}
+, {-43, 115}
+, {-34, -12}
+, {30, 29}}
+, {{-82, 30}
+, {-68, 69}
+, {-53, 38}
+, {-71, 88}
+, {-52, 18}
+, {31, 57}
+, {-53, 29}
+, {80, 26}}
+, {{-73, -23}
+, {80, 88}
+, {33, 16}
+, {-28, -61}
+, {-9, -48}
+, {-116, 23}
+, {-33, 0}
+, {51, 48}}
+, {{-61, -42}
+, {-42, -38}
+, {17, -99}
+, {37, -45}
+, {-13, 29}
+, {-10, -90}
+, {-69, -31}
+, {-41, -55}}
+, {{-21, -62}
+, {-74, 2}
+, {75, -35}
+, {98, 69}
+, {79, 14}
+, {61, -82}
+, {100, 3}
+, {13, -61}}
+, {{-81, -61}
+, {40, -8}
+, {38, -41}
+, {89, -75}
+, {-45, 28}
+, {85, 83}
+, {4, 63}
+, {3, -83}}
+, {{-37, 27}
+, {21, -11}
+, {97, -11}
+, {-57, -50}
+, {-13, -96}
+, {78, -86}
+, {-59, -27}
+, {43, 94}}
+, {{-39, -68}
+, {-74, 86}
+, {32, 91}
+, {-11, -25}
+, {59, -20}
+, {-8, -84}
+, {-44, -34}
+, {-6, 58}}
+, {{-38, -22}
+, {-10, -13}
+, {-86, -76}
+, {89, 56}
+, {53, 43}
+, {-71, 82}
+, {24, -65}
+, {-71, -93}}
+, {{-53, 32}
+, {-51, 7}
+, {23, 100}
+, {-95, 3}
+, {32, 64}
+, {-43, 79}
+, {98, -75}
+, {38, -36}}
+, {{-38, -94}
+, {-85, 28}
+, {-33, -73}
+, {8, 20}
+, {53, -101}
+, {45, -88}
+, {-15, -43}
+, {-71, 101}}
+, {{-24, 67}
+, {-77, 83}
+, {-75, 0}
+, {-39, -70}
+, {-73, 18}
+, {90, 68}
+, {106, 39}
+, {-56, -79}}
+, {{44, -17}
+, {-89, 3}
+, {-29, -81}
+, {-20, -9}
+, {72, -2}
+, {-17, -70}
+, {-40, -97}
+, {87, -67}}
+, {{-33, 59}
+, {55, -87}
+, {31, -45}
+, {-78, 70}
+, {68, -82}
+, {-7, -3}
+, {-21, -26}
+, {34, -25}}
+, {{74, 82}
+, {-40, -41}
+, {30, 28}
+, {-53, 37}
+, {-90, 25}
+, {-67, -25}
+, {-9, -42}
+, {-38, -54}}
+, {{-23, 76}
+, {70, -14}
+, {-65, 69}
+, {-19, -92}
+, {-86, 64}
+, {-91, 80}
+, {-28, -48}
+, {65, -107}}
+, {{70, -68}
+, {21, 52}
+, {88, 84}
+, {6, -85}
+, {79, 33}
+, {83, 58}
+, {-44, 60}
+, {-86, -26}}
+, {{84, 116}
+, {50, -103}
+, {1, -1}
+, {20, 57}
+, {-96, 29}
+, {-77, 25}
+, {8, 81}
+, {-6, 81}}
+, {{-12, -103}
+, {35, 56}
+, {30, -88}
+, {0, -23}
+, {-21, 74}
+, {51, -43}
+, {35, -22}
+, {-92, -37}}
+, {{-68, 6}
+, {87, 58}
+, {-86, -75}
+, {30, -49}
+, {3, 24}
+, {-93, -16}
+, {10, 24}
+, {-56, 87}}
+, {{-80, -17}
+, {68, 45}
+, {68, 47}
+, {0, 47}
+, {59, 68}
+, {-91, 1}
+, {-97, -1}
+, {10, 27}}
+, {{71, 43}
+, {-79, 0}
+, {-36, -109}
+, {25, -84}
+, {62, 19}
+, {-24, -30}
+, {-61, -21}
+, {20, -63}}
+, {{59, -68}
+, {58, -42}
+, {85, 72}
+, {-12, -68}
+, {-11, 81}
+, {34, 30}
+, {-46, -91}
+, {-82, -85}}
+, {{-47, 60}
+, {-80, -30}
+, {-6, -30}
+, {-14, -35}
+, {16, -17}
+, {-55, 91}
+, {66, 95}
+, {88, -105}}
+, {{82, 61}
+, {-25, -25}
+, {-43, 103}
+, {-80, 137}
+, {-14, 19}
+, {-41, 26}
+, {-99, -55}
+, {87, 85}}
+, {{-86, 70}
+, {92, -48}
+, {82, 85}
+, {17, 49}
+, {-63, 77}
+, {-22, -25}
+, {-101, 31}
+, {6, 26}}
+, {{75, -26}
+, {31, -19}
+, {-24, 13}
+, {-92, -67}
+, {-63, -40}
+, {4, -85}
+, {34, 52}
+, {37, 91}}
+, {{-39, -63}
+, {-53, -67}
+, {14, 18}
+, {85, 36}
+, {-39, 67}
+, {-59, -86}
+, {-104, 71}
+, {105, 34}}
+, {{-38, 36}
+, {91, -91}
+, {74, -17}
+, {-27, 78}
+, {30, 111}
+, {-52, -63}
+, {-16, 67}
+, {-29, -74}}
+, {{-6, -20}
+, {-45, -22}
+, {79, 90}
+, {-94, 30}
+, {-18, -53}
+, {6, 40}
+, {-20, -72}
+, {90, 46}}
+, {{51, 53}
+, {88, 33}
+, {28, -11}
+, {98, -73}
+, {-23, -22}
+, {10, -58}
+, {26, 35}
+, {80, -53}}
+, {{54, -40}
+, {-97, -6}
+, {-44, -7}
+, {49, -72}
+, {72, 96}
+, {26, 34}
+, {-62, 66}
+, {69, 63}}
+, {{50, 95}
+, {-76, 48}
+, {-35, -50}
+, {-99, -59}
+, {94, 21}
+, {97, 39}
+, {22, 3}
+, {80, 54}}
+, {{90, 46}
+, {-101, -60}
+, {84, -68}
+, {72, 80}
+, {48, -24}
+, {4, 8}
+, {107, 82}
+, {-58, -66}}
+, {{57, -95}
+, {32, -17}
+, {-10, 26}
+, {-109, -84}
+, {24, 69}
+, {61, 41}
+, {48, -59}
+, {-26, -47}}
+, {{94, -51}
+, {-59, 40}
+, {-29, 27}
+, {24, 4}
+, {95, -55}
+, {-55, -50}
+, {-39, 92}
+, {-90, 65}}
+, {{-100, 80}
+, {-81, -22}
+, {76, -21}
+, {97, 75}
+, {-79, 64}
+, {39, 9}
+, {-34, -25}
+, {86, 60}}
+, {{9, -83}
+, {69, 84}
+, {23, -98}
+, {50, 0}
+, {53, 38}
+, {21, 30}
+, {0, -111}
+, {86, 19}}
+, {{-87, -98}
+, {-45, 23}
+, {-42, 50}
+, {71, 39}
+, {8, 45}
+, {61, 91}
+, {3, 14}
+, {46, 17}}
+, {{66, -53}
+, {-60, 69}
+, {-27, 94}
+, {38, -90}
+, {59, -38}
+, {-5, 95}
+, {35, -51}
+, {-96, -56}}
+, {{17, -79}
+, {-62, -29}
+, {45, 20}
+, {33, -52}
+, {-48, -50}
+, {-101, -14}
+, {-53, 55}
+, {14, 54}}
+, {{-69, 27}
+, {93, 33}
+, {76, 45}
+, {66, 45}
+, {-33, -12}
+, {86, 85}
+, {-34, -71}
+, {19, 8}}
+, {{-66, 24}
+, {-79, -63}
+, {-79, 14}
+, {-86, 99}
+, {43, 96}
+, {-88, 63}
+, {79, -83}
+, {92, -84}}
+, {{-22, -30}
+, {83, 91}
+, {-51, 96}
+, {98, 105}
+, {-29, 81}
+, {-77, -48}
+, {-22, 7}
+, {-90, -54}}
+, {{-7, 54}
+, {-47, -57}
+, {46, 84}
+, {38, 81}
+, {-57, -18}
+, {-15, 56}
+, {-58, 37}
+, {-40, 48}}
+, {{92, -48}
+, {66, 90}
+, {27, -10}
+, {-42, -8}
+, {92, -15}
+, {-51, -75}
+, {62, 47}
+, {-48, -60}}
+, {{-90, 43}
+, {68, 17}
+, {43, 35}
+, {-29, 16}
+, {-41, 59}
+, {-14, -82}
+, {59, 95}
+, {-69, -81}}
+, {{36, -95}
+, {-65, -95}
+, {-24, 15}
+, {-85, -14}
+, {79, 92}
+, {-8, -71}
+, {34, 65}
+, {-21, -74}}
+, {{100, 3}
+, {-4, 32}
+, {63, 42}
+, {-70, 38}
+, {88, 88}
+, {-82, 36}
+, {-31, -6}
+, {-26, 74}}
+, {{27, -32}
+, {90, 90}
+, {-58, 60}
+, {51, -64}
+, {51, 43}
+, {77, 5}
+, {10, 11}
+, {15, -69}}
+, {{87, 27}
+, {-2, -75}
+, {-89, -49}
+, {-84, -86}
+, {34, -27}
+, {56, -10}
+, {48, -6}
+, {12, -100}}
+, {{78, -32}
+, {-48, 17}
+, {-29, -71}
+, {86, -73}
+, {94, -24}
+, {-44, -36}
+, {33, -111}
+, {-28, 38}}
+, {{4, -69}
+, {76, 73}
+, {-8, 4}
+, {-42, -7}
+, {-78, 82}
+, {-88, -88}
+, {-35, 36}
+, {50, -71}}
+, {{-21, 49}
+, {-78, -19}
+, {17, 76}
+, {67, -55}
+, {11, 20}
+, {53, 94}
+, {-90, 58}
+, {43, 14}}
+, {{-88, -3}
+, {-82, 27}
+, {43, 26}
+, {41, 89}
+, {-91, 64}
+, {46, 25}
+, {52, 56}
+, {-46, 86}}
+, {{-37, -68}
+, {36, 51}
+, {41, 50}
+, {-67, 83}
+, {-48, -35}
+, {-18, -1}
+, {-2, -46}
+, {-54, 80}}
+, {{-26, 94}
+, {68, -80}
+, {-43, -50}
+, {83, 65}
+, {94, 25}
+, {33, -7}
+, {-20, -7}
+, {21, -34}}
+, {{-30, 60}
+, {81, -83}
+, {74, 65}
+, {-1, 83}
+, {-9, -40}
+, {47, -34}
+, {40, -1}
+, {57, -60}}
+, {{-75, 49}
+, {-44, 1}
+, {95, -86}
+, {-76, 13}
+, {-57, 15}
+, {74, -26}
+, {0, -26}
+, {33, -99}}
+, {{78, -106}
+, {-24, -17}
+, {53, 66}
+, {99, -16}
+, {-82, -31}
+, {88, 76}
+, {27, 11}
+, {-6, 103}}
+, {{67, -37}
+, {-92, 51}
+, {85, -77}
+, {-10, 20}
+, {30, 18}
+, {-82, -16}
+, {74, -24}
+, {0, -58}}
+, {{-58, 77}
+, {53, 49}
+, {64, 24}
+, {12, -95}
+, {-15, -41}
+, {-91, 47}
+, {-25, 76}
+, {66, -95}}
+, {{-17, 74}
+, {-68, 101}
+, {-87, -48}
+, {-66, -95}
+, {93, -1}
+, {-13, -72}
+, {104, -104}
+, {6, 78}}
+, {{-62, -53}
+, {102, -60}
+, {-90, -25}
+, {4, -44}
+, {-58, -38}
+, {-3, 15}
+, {55, -26}
+, {-37, 68}}
+, {{66, -72}
+, {-27, -54}
+, {-56, 64}
+, {39, 14}
+, {-101, -71}
+, {9, 37}
+, {40, -3}
+, {-78, 58}}
+, {{69, 82}
+, {91, -65}
+, {37, 65}
+, {-70, 73}
+, {42, 14}
+, {62, 16}
+, {4, 66}
+, {-37, -56}}
+, {{79, -67}
+, {90, 30}
+, {-99, 87}
+, {10, 17}
+, {113, 41}
+, {39, 47}
+, {-26, 5}
+, {43, 50}}
+, {{15, 43}
+, {-85, 64}
+, {0, 98}
+, {-30, 90}
+, {89, -40}
+, {-59, 75}
+, {25, -90}
+, {67, -65}}
+, {{71, -49}
+, {39, -48}
+, {70, -93}
+, {27, 90}
+, {54, -14}
+, {-68, -93}
+, {-86, 70}
+, {64, -22}}
+, {{-17, 17}
+, {-62, -33}
+, {36, 13}
+, {92, -24}
+, {51, -2}
+, {10, 5}
+, {116, -82}
+, {-82, 93}}
+, {{83, 77}
+, {-11, -32}
+, {55, 43}
+, {-42, -27}
+, {13, -85}
+, {74, -47}
+, {-4, -99}
+, {-99, -54}}
+, {{17, -27}
+, {-43, -95}
+, {78, -51}
+, {48, 6}
+, {-95, -62}
+, {51, 73}
+, {-45, 87}
+, {122, 38}}
+, {{78, 23}
+, {-14, -75}
+, {78, -15}
+, {88, 54}
+, {37, 40}
+, {-81, -63}
+, {-55, 75}
+, {64, 7}}
+, {{-75, 74}
+, {36, 77}
+, {-48, 65}
+, {46, 9}
+, {-50, -67}
+, {17, -55}
+, {-65, 79}
+, {2, 57}}
+, {{-75, 87}
+, {29, -6}
+, {-76, 22}
+, {-29, 72}
+, {-31, 24}
+, {0, -44}
+, {58, 25}
+, {39, -106}}
+, {{-24, 4}
+, {13, 53}
+, {12, 26}
+, {87, 37}
+, {25, 37}
+, {-74, 33}
+, {58, -106}
+, {58, 74}}
+, {{14, -97}
+, {82, 56}
+, {-57, 0}
+, {-95, 70}
+, {4, 40}
+, {72, -29}
+, {-71, -53}
+, {31, 33}}
+, {{71, -50}
+, {-12, -53}
+, {24, 32}
+, {57, -62}
+, {78, -29}
+, {0, 35}
+, {-67, 6}
+, {79, -47}}
+, {{-63, -50}
+, {-69, -41}
+, {82, -44}
+, {33, 82}
+, {-76, -52}
+, {20, -45}
+, {40, -48}
+, {12, -37}}
+, {{-16, 74}
+, {65, 70}
+, {27, -16}
+, {-13, -42}
+, {-10, 48}
+, {-101, 55}
+, {-49, -6}
+, {-47, -63}}
+, {{39, 93}
+, {76, -74}
+, {47, 14}
+, {75, 48}
+, {79, -59}
+, {-5, 33}
+, {55, -78}
+, {-31, 39}}
+, {{-20, 45}
+, {-17, -37}
+, {-64, -72}
+, {-88, 74}
+, {46, 63}
+, {23, -53}
+, {72, 22}
+, {-27, 69}}
+, {{-87, 38}
+, {-87, 103}
+, {28, 3}
+, {-16, -56}
+, {-3, 96}
+, {30, 21}
+, {9, 54}
+, {51, -44}}
+, {{79, -72}
+, {25, -75}
+, {38, 94}
+, {31, 40}
+, {40, -20}
+, {-38, 66}
+, {99, 11}
+, {12, 49}}
+, {{39, 72}
+, {-13, -111}
+, {-25, -43}
+, {-80, 3}
+, {83, -86}
+, {15, 56}
+, {31, 82}
+, {22, -2}}
+, {{86, -82}
+, {-18, -26}
+, {-23, -40}
+, {-51, 53}
+, {-76, -58}
+, {54, -19}
+, {69, -75}
+, {-73, 58}}
+, {{47, 100}
+, {26, -95}
+, {-47, -26}
+, {-8, -100}
+, {-5, 99}
+, {92, -27}
+, {-86, -54}
+, {-113, -100}}
+, {{88, -64}
+, {-44, -36}
+, {-8, 75}
+, {22, -14}
+, {-37, 75}
+, {-54, -39}
+, {94, 59}
+, {-97, 86}}
+, {{-34, -64}
+, {-95, 37}
+, {-72, -86}
+, {-27, -34}
+, {88, -45}
+, {67, -20}
+, {69, 31}
+, {25, -90}}
+, {{-39, 55}
+, {45, -45}
+, {-45, -104}
+, {-1, 21}
+, {-53, -40}
+, {73, -34}
+, {20, -90}
+, {25, 83}}
+, {{-82, -60}
+, {77, -82}
+, {15, 44}
+, {-20, 27}
+, {33, 4}
+, {-94, -55}
+, {-113, 59}
+, {36, 46}}
+, {{12, -54}
+, {-79, -87}
+, {33, -66}
+, {-70, 6}
+, {-14, -5}
+, {5, -23}
+, {66, -112}
+, {53, 111}}
+, {{73, -71}
+, {-94, -15}
+, {-38, 67}
+, {2, -84}
+, {27, -38}
+, {-53, -99}
+, {54, -91}
+, {97, -31}}
+, {{47, 49}
+, {42, 80}
+, {92, 35}
+, {28, -98}
+, {34, 94}
+, {7, -52}
+, {26, 56}
+, {-88, -14}}
+, {{-69, -71}
+, {81, 8}
+, {60, -69}
+, {4, -56}
+, {-95, 43}
+, {-51, -41}
+, {-90, -8}
+, {-31, 23}}
+, {{-70, -65}
+, {9, -82}
+, {-44, -81}
+, {-53, -18}
+, {-95, 27}
+, {21, -32}
+, {36, -15}
+, {0, -84}}
+, {{-79, 47}
+, {-36, 3}
+, {37, -70}
+, {77, -63}
+, {16, -76}
+, {42, -67}
+, {-95, -3}
+, {-11, 88}}
+, {{82, 91}
+, {87, -98}
+, {19, 70}
+, {-1, 90}
+, {-69, -64}
+, {21, 8}
+, {-41, -107}
+, {-40, 85}}
+, {{73, 20}
+, {-70, 61}
+, {-32, 67}
+, {71, 69}
+, {-94, -88}
+, {14, 100}
+, {-42, 92}
+, {60, 23}}
+, {{-77, -4}
+, {-80, 38}
+, {50, -6}
+, {81, -53}
+, {18, -14}
+, {-46, 27}
+, {-35, 88}
+, {11, -89}}
+, {{-58, -6}
+, {14, 59}
+, {-82, 2}
+, {-6, 87}
+, {0, 89}
+, {-81, -44}
+, {-79, -47}
+, {0, -78}}
+, {{54, 32}
+, {-57, 49}
+, {-75, 4}
+, {61, 87}
+, {32, -97}
+, {-68, 91}
+, {93, 41}
+, {-29, 4}}
+, {{23, -87}
+, {-19, 81}
+, {-78, -13}
+, {-50, -88}
+, {-13, 71}
+, {-35, 73}
+, {-11, 13}
+, {78, 29}}
+, {{-94, -67}
+, {67, 62}
+, {31, -90}
+, {-64, -93}
+, {-70, 90}
+, {-17, -87}
+, {21, 74}
+, {-71, 26}}
+, {{67, -83}
+, {38, -83}
+, {-13, -68}
+, {78, 78}
+, {-21, -84}
+, {-36, 87}
+, {25, -41}
+, {-61, 81}}
+, {{-18, 36}
+, {-39, 62}
+, {-35, 111}
+, {41, -36}
+, {-12, 30}
+, {87, -37}
+, {-84, 53}
+, {-33, 29}}
+, {{21, 69}
+, {2, 54}
+, {-42, 59}
+, {-8, 40}
+, {-42, 55}
+, {-24, -81}
+, {-70, -84}
+, {-87, -33}}
+, {{59, 5}
+, {-57, -7}
+, {-30, -83}
+, {-50, 31}
+, {75, 24}
+, {-73, 101}
+, {-80, 0}
+, {8, 60}}
+, {{27, -39}
+, {26, -69}
+, {-18, 9}
+, {18, -90}
+, {-2, -58}
+, {42, -69}
+, {-89, -49}
+, {113, -34}}
+, {{-57, 26}
+, {-72, 48}
+, {96, 82}
+, {0, -49}
+, {-96, -88}
+, {21, -6}
+, {19, -82}
+, {-3, 98}}
+, {{32, -36}
+, {-25, 74}
+, {105, 90}
+, {31, 33}
+, {53, 48}
+, {-68, 28}
+, {-22, 100}
+, {-84, 14}}
+, {{61, -16}
+, {-86, -72}
+, {-79, -4}
+, {-57, -5}
+, {-24, 78}
+, {59, -21}
+, {81, 31}
+, {52, -76}}
+, {{-45, 35}
+, {98, -62}
+, {38, 19}
+, {-1, -90}
+, {-46, 6}
+, {4, -56}
+, {73, 24}
+, {-86, -59}}
+, {{10, 20}
+, {-95, 60}
+, {-87, -40}
+, {-26, 54}
+, {-91, -102}
+, {9, -55}
+, {-99, 93}
+, {62, -81}}
+, {{-10, 72}
+, {74, -53}
+, {-15, -8}
+, {27, 39}
+, {-102, 69}
+, {43, -91}
+, {-35, -78}
+, {17, -63}}
+, {{92, 85}
+, {37, -35}
+, {-55, 35}
+, {88, -18}
+, {56, -19}
+, {12, 84}
+, {-15, -67}
+, {9, 18}}
+, {{-98, 82}
+, {66, 60}
+, {91, -75}
+, {-82, -19}
+, {-82, 20}
+, {59, -97}
+, {-10, 72}
+, {-75, -33}}
+, {{-97, 72}
+, {11, -77}
+, {68, -16}
+, {-17, 70}
+, {-78, -39}
+, {45, 34}
+, {-41, 11}
+, {54, -25}}
+, {{-61, -66}
+, {45, 47}
+, {0, 98}
+, {68, -45}
+, {-22, 86}
+, {55, -27}
+, {119, 96}
+, {-54, 73}}
+, {{55, -19}
+, {-90, -37}
+, {-29, 20}
+, {-91, 40}
+, {86, 35}
+, {-33, -75}
+, {-41, 7}
+, {-62, -66}}
+, {{-44, 24}
+, {-28, 95}
+, {-71, -18}
+, {12, 3}
+, {27, 81}
+, {-38, -74}
+, {82, 59}
+, {-44, -30}}
+, {{-13, -24}
+, {-60, 12}
+, {62, 29}
+, {67, -24}
+, {-80, -72}
+, {37, -51}
+, {-94, -76}
+, {50, 4}}
+, {{-70, -97}
+, {-31, 92}
+, {23, 97}
+, {-48, -54}
+, {59, -24}
+, {-75, -23}
+, {-47, 82}
+, {36, -73}}
+, {{51, 72}
+, {28, -32}
+, {74, -45}
+, {-94, 37}
+, {-89, -93}
+, {29, -46}
+, {0, 47}
+, {-47, -54}}
+, {{102, -85}
+, {15, -74}
+, {76, -85}
+, {60, -92}
+, {48, 75}
+, {91, 90}
+, {82, -75}
+, {38, -79}}
+, {{64, -9}
+, {-69, 54}
+, {91, 37}
+, {-72, 106}
+, {1, 103}
+, {-22, -20}
+, {-59, -58}
+, {-56, -8}}
+, {{-33, 50}
+, {79, -71}
+, {32, -46}
+, {-3, 76}
+, {41, 37}
+, {-3, -92}
+, {72, -11}
+, {-36, -70}}
+, {{41, 76}
+, {43, -61}
+, {-28, -105}
+, {-46, 20}
+, {-12, 20}
+, {-20, 79}
+, {32, 29}
+, {52, -78}}
+, {{-67, -54}
+, {24, 53}
+, {30, -22}
+, {-75, 74}
+, {-32, 96}
+, {-34, -38}
+, {-3, 68}
+, {72, 69}}
+, {{83, -87}
+, {-3, 54}
+, {-57, 1}
+, {-55, -74}
+, {-30, -63}
+, {70, -68}
+, {-60, 70}
+, {-89, -51}}
+, {{8, -28}
+, {64, 81}
+, {25, -67}
+, {26, 29}
+, {-83, 80}
+, {-49, -62}
+, {71, -28}
+, {-69, -17}}
+, {{-66, -57}
+, {-88, -74}
+, {-14, -64}
+, {-81, 67}
+, {39, 84}
+, {37, 74}
+, {-101, -89}
+, {84, 20}}
+, {{-11, -25}
+, {60, -18}
+, {18, 53}
+, {-47, -42}
+, {-82, -77}
+, {82, 69}
+, {35, 26}
+, {-52, -17}}
+, {{-70, -72}
+, {-6, 2}
+, {8, -76}
+, {-41, 79}
+, {33, -64}
+, {-57, 36}
+, {66, 59}
+, {-71, 27}}
+, {{-29, -9}
+, {-79, 32}
+, {72, -95}
+, {-14, 50}
+, {-72, -101}
+, {-15, 38}
+, {56, -86}
+, {24, -32}}
+, {{31, 75}
+, {-77, -56}
+, {62, 82}
+, {90, -23}
+, {-67, 26}
+, {-96, 8}
+, {-67, 74}
+, {65, -81}}
+, {{-69, 40}
+, {-66, -13}
+, {65, 100}
+, {38, 59}
+, {-26, 17}
+, {-13, 20}
+, {63, -40}
+, {47, -30}}
+, {{48, 54}
+, {33, 58}
+, {-70, 34}
+, {72, 16}
+, {2, -45}
+, {41, -86}
+, {39, 29}
+, {-100, -47}}
+, {{37, -49}
+, {58, 71}
+, {-50, -19}
+, {78, -17}
+, {72, 10}
+, {-62, 87}
+, {51, 29}
+, {-4, -34}}
+, {{-91, 40}
+, {58, 100}
+, {66, -35}
+, {-34, 72}
+, {100, 65}
+, {63, -12}
+, {22, 2}
+, {-21, -89}}
+, {{85, -36}
+, {-70, -46}
+, {83, 86}
+, {-24, -30}
+, {90, 62}
+, {-74, 81}
+, {-22, 20}
+, {28, 15}}
+, {{5, 45}
+, {-69, 82}
+, {40, -3}
+, {-43, -43}
+, {-44, 24}
+, {13, 11}
+, {-79, 75}
+, {90, 40}}
+, {{-30, 97}
+, {-59, -69}
+, {51, 85}
+, {97, 4}
+, {61, 26}
+, {59, 77}
+, {-33, 1}
+, {-6, -52}}
+, {{-64, 96}
+, {30, 31}
+, {-89, 16}
+, {10, -17}
+, {71, -80}
+, {0, -51}
+, {22, 42}
+, {-98, -30}}
+, {{-14, -28}
+, {-94, 24}
+, {-86, 40}
+, {-70, -83}
+, {101, 7}
+, {-40, 4}
+, {-97, -85}
+, {11, 54}}
+, {{33, -13}
+, {-66, 41}
+, {-59, -70}
+, {16, -119}
+, {44, -12}
+, {-59, 72}
+, {45, -96}
+, {47, -50}}
+, {{-93, -64}
+, {-80, -81}
+, {58, 18}
+, {-23, 104}
+, {-25, 5}
+, {-46, -19}
+, {-6, -12}
+, {-13, 54}}
+, {{31, 77}
+, {-59, -49}
+, {-77, -88}
+, {-109, 94}
+, {55, 7}
+, {-58, 63}
+, {106, -97}
+, {74, -21}}
+, {{52, -17}
+, {55, -95}
+, {-3, 76}
+, {44, -62}
+, {2, 84}
+, {55, 21}
+, {-47, -61}
+, {-98, -67}}
+, {{89, -74}
+, {-92, 82}
+, {-72, 31}
+, {44, -69}
+, {26, -59}
+, {69, 9}
+, {88, 7}
+, {-39, -58}}
+, {{-51, 75}
+, {62, 37}
+, {68, 61}
+, {-53, 99}
+, {-40, 57}
+, {32, 80}
+, {92, 83}
+, {-49, -66}}
+, {{-31, -70}
+, {-75, 60}
+, {57, 43}
+, {59, 53}
+, {32, 37}
+, {-44, 16}
+, {39, 49}
+, {94, -56}}
+, {{98, 82}
+, {12, -56}
+, {-89, 21}
+, {0, 38}
+, {-82, -77}
+, {-82, 84}
+, {16, 5}
+, {-54, 75}}
+, {{92, 57}
+, {-33, 83}
+, {-73, -9}
+, {58, -41}
+, {73, -39}
+, {2, -25}
+, {75, -86}
+, {-51, 31}}
+, {{-65, -7}
+, {-40, -17}
+, {45, 37}
+, {60, 66}
+, {-79, -33}
+, {19, -5}
+, {75, -36}
+, {70, 85}}
+, {{17, 75}
+, {-90, 109}
+, {-46, 32}
+, {-73, 0}
+, {2, 55}
+, {-45, 29}
+, {-94, 20}
+, {-55, -91}}
+, {{-3, -97}
+, {-95, -36}
+, {-10, 45}
+, {37, -36}
+, {-53, -73}
+, {-66, 17}
+, {-26, 40}
+, {72, 33}}
+, {{93, -25}
+, {-51, -48}
+, {-105, 37}
+, {66, 41}
+, {-40, -5}
+, {2, 56}
+, {-72, 51}
+, {-21, -33}}
+, {{-62, -93}
+, {-74, 72}
+, {0, -70}
+, {-77, -17}
+, {-74, 94}
+, {37, -50}
+, {77, -35}
+, {32, 82}}
+, {{50, -87}
+, {2, -44}
+, {-72, 70}
+, {12, -34}
+, {72, -10}
+, {54, -92}
+, {19, -10}
+, {97, 17}}
+, {{-72, 34}
+, {1, -56}
+, {-32, -73}
+, {-33, 55}
+, {-71, 31}
+, {-62, -62}
+, {43, 67}
+, {-29, 64}}
+, {{-21, -47}
+, {-85, 90}
+, {-102, -52}
+, {-56, -2}
+, {30, -65}
+, {-59, -4}
+, {66, 6}
+, {68, 42}}
+, {{80, -91}
+, {-97, -86}
+, {-18, 24}
+, {64, -75}
+, {-58, -91}
+, {-111, -18}
+, {-12, -3}
+, {-2, 61}}
+, {{55, -95}
+, {51, 23}
+, {10, -57}
+, {19, -51}
+, {78, 69}
+, {23, -70}
+, {-45, -62}
+, {58, -42}}};
+
+const sparse_weights_t dense_58_sparse = {
+  8, 2, dense_58_sparse_start, dense_58_sparse_index, &dense_58_sparse_values[0][0][0]
+};
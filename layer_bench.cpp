@@ -0,0 +1,101 @@
+// Per layer latency of one clip, and with -DCNN_THREADS its speedup with the number of threads of
+// the intra-op mode. The kernels are those selected by the build flags (-DCNN_NO_SIMD for the
+// direct loops, -DCONV1D_WINOGRAD, -DCONV1D_IM2COL) and CNN_ISA.
+//   g++ -O2 -DCNN_THREADS -pthread -Igsc_output_fixed layer_bench.cpp -o layer_bench
+//   ./layer_bench [max_threads [repetitions]]
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <vector>
+
+#include "model.c" // unity build: the layer functions are static
+
+struct Layer {
+	const char *name;
+	std::function<void()> run;
+};
+
+// Median over the repetitions, in microseconds
+static double time_us(const std::function<void()> &run, int repetitions) {
+	std::vector<double> times;
+	run(); // warm up the caches and the workers
+	for (int r = 0; r < repetitions; r++) {
+		auto start = std::chrono::steady_clock::now();
+		run();
+		times.push_back(std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count());
+	}
+	std::nth_element(times.begin(), times.begin() + times.size() / 2, times.end());
+	return times[times.size() / 2];
+}
+
+int main(int argc, const char *argv[]) {
+#ifdef CNN_THREADS
+	unsigned int max_threads = argc > 1 ? atoi(argv[1]) : sysconf(_SC_NPROCESSORS_ONLN);
+#else
+	unsigned int max_threads = 1;
+#endif
+	int repetitions = argc > 2 ? atoi(argv[2]) : 200;
+	static number_t input[MODEL_INPUT_CHANNELS][MODEL_INPUT_SAMPLES];
+	static cnn_ctx_t ctx;
+	// Unfused layers, which the cnn_run() chain never stores; contents do not matter for timing
+	static max_pooling1d_145_output_type pooled_145;
+	static conv1d_116_output_type conv_116;
+	static conv1d_117_output_type conv_117;
+	static conv1d_118_output_type conv_118;
+	static conv1d_119_output_type conv_119;
+	static cnn_ctx_t batch[CNN_BATCH_SIZE];
+	number_t output[MODEL_OUTPUT_SAMPLES];
+	number_t batch_output[CNN_BATCH_SIZE][MODEL_OUTPUT_SAMPLES];
+
+	srand(1);
+	for (int i = 0; i < MODEL_INPUT_SAMPLES; i++) {
+		input[0][i] = rand() % 8001 - 4000;
+	}
+	cnn_run(&ctx, input, output); // fills every activation buffer read below
+	for (int b = 0; b < CNN_BATCH_SIZE; b++) {
+		batch[b] = ctx;
+	}
+
+	const std::vector<Layer> layers = {
+		{"conv1d_116", [&] { max_pooling1d_145_conv1d_116_max_pooling1d_146(input, CONV1D_116_KERNEL, conv1d_116_bias, ctx.activations1.max_pooling1d_146_output); }},
+		{"conv1d_117", [&] { conv1d_117_max_pooling1d_147(ctx.activations1.max_pooling1d_146_output, CONV1D_117_KERNEL, conv1d_117_bias, ctx.activations2.max_pooling1d_147_output); }},
+		{"conv1d_118", [&] { conv1d_118_max_pooling1d_148(ctx.activations2.max_pooling1d_147_output, CONV1D_118_KERNEL, conv1d_118_bias, ctx.activations1.max_pooling1d_148_output); }},
+		{"conv1d_119", [&] { conv1d_119_max_pooling1d_149(ctx.activations1.max_pooling1d_148_output, CONV1D_119_KERNEL, conv1d_119_bias, ctx.activations2.max_pooling1d_149_output); }},
+		{"head", [&] { average_pooling1d_29_dense_58_dense_59(ctx.activations2.max_pooling1d_149_output, DENSE_58_KERNEL, dense_58_bias, DENSE_59_KERNEL, dense_59_bias, output); }},
+		// The dense layers of CNN_BATCH_SIZE clips as one GEMM each, as cnn_batch() runs them
+		{"head batch", [&] { average_pooling1d_29_dense_58_dense_59_batch(CNN_BATCH_SIZE, &batch[0].activations2.max_pooling1d_149_output[0][0], sizeof(cnn_ctx_t) / sizeof(number_t), DENSE_58_KERNEL, dense_58_bias, DENSE_59_KERNEL, dense_59_bias, batch_output); }},
+		{"cnn_run", [&] { cnn_run(&ctx, input, output); }},
+		{"max_pooling1d_145", [&] { max_pooling1d_145(input, pooled_145); }},
+		{"max_pooling1d_146", [&] { max_pooling1d_146(conv_116, ctx.activations1.max_pooling1d_146_output); }},
+		{"max_pooling1d_147", [&] { max_pooling1d_147(conv_117, ctx.activations2.max_pooling1d_147_output); }},
+		{"max_pooling1d_148", [&] { max_pooling1d_148(conv_118, ctx.activations1.max_pooling1d_148_output); }},
+		{"max_pooling1d_149", [&] { max_pooling1d_149(conv_119, ctx.activations2.max_pooling1d_149_output); }},
+	};
+	std::vector<std::vector<double>> us(layers.size());
+
+	for (unsigned int threads = 1; threads <= std::max(max_threads, 1u); threads++) {
+#ifdef CNN_THREADS
+		cnn_set_num_threads(threads);
+#endif
+		for (size_t l = 0; l < layers.size(); l++) {
+			us[l].push_back(time_us(layers[l].run, repetitions));
+		}
+	}
+
+	// One row per layer: median latency with 1 thread, then the speedup for 1 .. max_threads
+	printf("%-18s %10s", "layer", "1T us");
+	for (size_t t = 0; t < us[0].size(); t++) {
+		printf(" %6zuT", t + 1);
+	}
+	printf("\n");
+	for (size_t l = 0; l < layers.size(); l++) {
+		printf("%-18s %10.1f", layers[l].name, us[l][0]);
+		for (double t : us[l]) {
+			printf(" %6.2fx", us[l][0] / t);
+		}
+		printf("\n");
+	}
+	return 0;
+}
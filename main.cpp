@@ -3,6 +3,7 @@
 #include <cstring>
 #include <fstream>
 #include <iostream>
+#include <memory>
 #include <sstream>
 #include <vector>
 
@@ -42,19 +43,26 @@ void convert_input_vector(const std::array<float, Channels*Samples> &input, numb
 //Compute testing accuracy
 template<size_t InputDims, size_t OutputDims>
 float evaluate(const std::vector<std::array<float, InputDims>> &inputs, const std::vector<std::array<float, OutputDims>> &labels) {
+	const size_t chunk = 256; // clips converted and classified per cnn_batch() call
 	int rightlabels = 0;
-	std::array<number_t, OutputDims> outputs = {};
+	size_t count = std::min(inputs.size(), labels.size());
+	std::unique_ptr<number_t[][MODEL_INPUT_CHANNELS][MODEL_INPUT_SAMPLES]> converted_inputs(new number_t[chunk][MODEL_INPUT_CHANNELS][MODEL_INPUT_SAMPLES]);
+	std::unique_ptr<number_t[][OutputDims]> outputs(new number_t[chunk][OutputDims]);
 
-	for (size_t i = 0;  i < inputs.size() && i < labels.size(); i++) {
-		number_t converted_input[MODEL_INPUT_CHANNELS][MODEL_INPUT_SAMPLES];
+	for (size_t first = 0; first < count; first += chunk) {
+		size_t n = std::min(count - first, chunk);
 
-		convert_input_vector<MODEL_INPUT_CHANNELS, MODEL_INPUT_SAMPLES>(inputs.at(i), converted_input);
-		cnn(converted_input, outputs.data());
+		for (size_t i = 0; i < n; i++) {
+			convert_input_vector<MODEL_INPUT_CHANNELS, MODEL_INPUT_SAMPLES>(inputs.at(first + i), converted_inputs[i]);
+		}
+		cnn_batch(n, converted_inputs.get(), outputs.get());
 
-		auto cls = std::max_element(outputs.begin(), outputs.end()) - outputs.begin();
+		for (size_t i = 0; i < n; i++) {
+			auto cls = std::max_element(outputs[i], outputs[i] + OutputDims) - outputs[i];
 
-		if (labels.at(i).at(cls) > 0) {
-			rightlabels++;
+			if (labels.at(first + i).at(cls) > 0) {
+				rightlabels++;
+			}
 		}
 	}
 	return rightlabels/(float)inputs.size();
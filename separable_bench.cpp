@@ -0,0 +1,96 @@
+// Cost of the depthwise-separable blocks of -DCNN_SEPARABLE against the conv1d_118 and conv1d_119
+// blocks they replace, each fused with its max pooling: MACs and weight bytes (kernel and bias) per
+// clip, median latency of one clip. The kernels are those of the running CPU (CNN_ISA to pick
+// another, -DCNN_NO_SIMD for the scalar loops), the weights those of weights/separable.c imported
+// from a trained .h5 by tools/separable_weights.py.
+//   g++ -O2 -DCNN_SEPARABLE [-DCNN_SEPARABLE_MULTIPLIER=M] -Igsc_output_fixed separable_bench.cpp -o separable_bench
+//   ./separable_bench [repetitions]
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <vector>
+
+#include "model.c" // unity build: the layer functions are static
+
+#ifndef CNN_SEPARABLE
+#error "build with -DCNN_SEPARABLE"
+#endif
+
+struct Block {
+	const char *name;
+	long conv_macs, separable_macs;
+	long conv_bytes, separable_bytes;
+	std::function<void()> conv, separable;
+};
+
+// Median over the repetitions, in microseconds
+static double time_us(const std::function<void()> &run, int repetitions) {
+	std::vector<double> times;
+	run(); // warm up the caches
+	for (int r = 0; r < repetitions; r++) {
+		auto start = std::chrono::steady_clock::now();
+		run();
+		times.push_back(std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count());
+	}
+	std::nth_element(times.begin(), times.begin() + times.size() / 2, times.end());
+	return times[times.size() / 2];
+}
+
+// Multiply-accumulates of conv p, a depthwise one reading a single channel per filter
+static long macs(const conv1d_params_t &p, bool depthwise) {
+	return (long)p.filters * (depthwise ? 1 : p.input_channels) * p.kernel_size * p.outsamples;
+}
+
+int main(int argc, const char *argv[]) {
+	int repetitions = argc > 1 ? atoi(argv[1]) : 200;
+	static number_t input[MODEL_INPUT_CHANNELS][MODEL_INPUT_SAMPLES];
+	static cnn_ctx_t ctx;
+	// Outputs of the blocks, apart from the context whose activations are their inputs
+	static depthwise_conv1d_118_output_type depthwise_118;
+	static depthwise_conv1d_119_output_type depthwise_119;
+	static max_pooling1d_148_output_type pooled_148;
+	static max_pooling1d_149_output_type pooled_149;
+	number_t output[MODEL_OUTPUT_SAMPLES];
+
+	srand(1);
+	for (int i = 0; i < MODEL_INPUT_SAMPLES; i++) {
+		input[0][i] = rand() % 8001 - 4000;
+	}
+	cnn_run(&ctx, input, output); // fills the inputs of the blocks
+
+	const std::vector<Block> blocks = {
+		{"conv1d_118",
+		 macs(conv1d_118_params, false),
+		 macs(depthwise_conv1d_118_params, true) + macs(pointwise_conv1d_118_params, false),
+		 (long)(sizeof(conv1d_118_kernel) + sizeof(conv1d_118_bias)),
+		 (long)(sizeof(depthwise_conv1d_118_kernel) + sizeof(depthwise_conv1d_118_bias) + sizeof(pointwise_conv1d_118_kernel) + sizeof(pointwise_conv1d_118_bias)),
+		 [&] { conv1d_118_max_pooling1d_148(ctx.activations2.max_pooling1d_147_output, conv1d_118_kernel, conv1d_118_bias, pooled_148); },
+		 [&] {
+			 depthwise_conv1d_118(ctx.activations2.max_pooling1d_147_output, depthwise_conv1d_118_kernel, depthwise_conv1d_118_bias, depthwise_118);
+			 pointwise_conv1d_118_max_pooling1d_148(depthwise_118, pointwise_conv1d_118_kernel, pointwise_conv1d_118_bias, pooled_148);
+		 }},
+		{"conv1d_119",
+		 macs(conv1d_119_params, false),
+		 macs(depthwise_conv1d_119_params, true) + macs(pointwise_conv1d_119_params, false),
+		 (long)(sizeof(conv1d_119_kernel) + sizeof(conv1d_119_bias)),
+		 (long)(sizeof(depthwise_conv1d_119_kernel) + sizeof(depthwise_conv1d_119_bias) + sizeof(pointwise_conv1d_119_kernel) + sizeof(pointwise_conv1d_119_bias)),
+		 [&] { conv1d_119_max_pooling1d_149(ctx.activations2.max_pooling1d_148_output, conv1d_119_kernel, conv1d_119_bias, pooled_149); },
+		 [&] {
+			 depthwise_conv1d_119(ctx.activations2.max_pooling1d_148_output, depthwise_conv1d_119_kernel, depthwise_conv1d_119_bias, depthwise_119);
+			 pointwise_conv1d_119_max_pooling1d_149(depthwise_119, pointwise_conv1d_119_kernel, pointwise_conv1d_119_bias, pooled_149);
+		 }},
+	};
+
+	// One row per block: the conv, then the separable block of depth multiplier CNN_SEPARABLE_MULTIPLIER
+	printf("depth multiplier %d\n", CNN_SEPARABLE_MULTIPLIER);
+	printf("%-12s %10s %10s %10s %10s %10s %10s %8s\n", "block", "conv MACs", "sep MACs", "conv B", "sep B", "conv us", "sep us", "speedup");
+	for (const Block &b : blocks) {
+		double conv_us = time_us(b.conv, repetitions);
+		double separable_us = time_us(b.separable, repetitions);
+		printf("%-12s %10ld %10ld %10ld %10ld %10.1f %10.1f %7.2fx\n", b.name, b.conv_macs, b.separable_macs,
+		       b.conv_bytes, b.separable_bytes, conv_us, separable_us, conv_us / separable_us);
+	}
+	return 0;
+}
@@ -0,0 +1,132 @@
+// Latency of the vector conv kernels for a sweep of cache tiles (conv1d_tile_t: filters, blocks of
+// conv positions and input channels per tile), one table per conv layer of cnn(), with the working
+// set of the inner loops: the kernel slice, the interleaved windows and the partial sums. Every
+// tile is checked against the output of the default one (conv1d_simd_tile()). The tiles of a
+// layer are timed in turn for several rounds and keep their best median, so that a slow period
+// of the machine does not fall on a single tile.
+//   g++ -O2 -Igsc_output_fixed tile_bench.cpp -o tile_bench
+//   CNN_ISA=sse41|portable ./tile_bench [repetitions [rounds]]
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <vector>
+
+#include "model.c" // unity build: the layer functions and their tiles are static
+
+#ifndef CNN_SIMD
+#error "tile_bench needs the vector kernels, build it without -DCNN_NO_SIMD"
+#endif
+
+struct Layer {
+	const char *name;
+	const conv1d_params_t *params;
+	bool pool2;          // max pooling fused on the output
+	conv1d_tile_t *tile; // read by the layer function
+	std::function<void()> run;
+	const number_t *output;
+	size_t output_bytes;
+};
+
+// Median over the repetitions, in microseconds
+static double time_us(const std::function<void()> &run, int repetitions) {
+	std::vector<double> times;
+	run(); // warm up the caches
+	for (int r = 0; r < repetitions; r++) {
+		auto start = std::chrono::steady_clock::now();
+		run();
+		times.push_back(std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count());
+	}
+	std::nth_element(times.begin(), times.begin() + times.size() / 2, times.end());
+	return times[times.size() / 2];
+}
+
+int main(int argc, const char *argv[]) {
+	int repetitions = argc > 1 ? atoi(argv[1]) : 50;
+	int rounds = argc > 2 ? atoi(argv[2]) : 5;
+	static number_t input[MODEL_INPUT_CHANNELS][MODEL_INPUT_SAMPLES];
+	static cnn_ctx_t ctx;
+	number_t output[MODEL_OUTPUT_SAMPLES];
+	const int lanes = cnn_isa == CNN_ISA_AVX2 ? 8 : 4;
+	const int vector_bytes = 4 * lanes;
+
+	srand(1);
+	for (int i = 0; i < MODEL_INPUT_SAMPLES; i++) {
+		input[0][i] = rand() % 8001 - 4000;
+	}
+	cnn_run(&ctx, input, output); // fills every activation buffer read below
+
+	const std::vector<Layer> layers = {
+		{"conv1d_116", &conv1d_116_params, true, &conv1d_116_tile,
+		 [&] { max_pooling1d_145_conv1d_116_max_pooling1d_146(input, CONV1D_116_KERNEL, conv1d_116_bias, ctx.activations1.max_pooling1d_146_output); },
+		 &ctx.activations1.max_pooling1d_146_output[0][0], sizeof(ctx.activations1.max_pooling1d_146_output)},
+		{"conv1d_117", &conv1d_117_params, true, &conv1d_117_tile,
+		 [&] { conv1d_117_max_pooling1d_147(ctx.activations1.max_pooling1d_146_output, CONV1D_117_KERNEL, conv1d_117_bias, ctx.activations2.max_pooling1d_147_output); },
+		 &ctx.activations2.max_pooling1d_147_output[0][0], sizeof(ctx.activations2.max_pooling1d_147_output)},
+		{"conv1d_118", &conv1d_118_params, true, &conv1d_118_tile,
+		 [&] { conv1d_118_max_pooling1d_148(ctx.activations2.max_pooling1d_147_output, CONV1D_118_KERNEL, conv1d_118_bias, ctx.activations1.max_pooling1d_148_output); },
+		 &ctx.activations1.max_pooling1d_148_output[0][0], sizeof(ctx.activations1.max_pooling1d_148_output)},
+		{"conv1d_119", &conv1d_119_params, true, &conv1d_119_tile,
+		 [&] { conv1d_119_max_pooling1d_149(ctx.activations1.max_pooling1d_148_output, CONV1D_119_KERNEL, conv1d_119_bias, ctx.activations2.max_pooling1d_149_output); },
+		 &ctx.activations2.max_pooling1d_149_output[0][0], sizeof(ctx.activations2.max_pooling1d_149_output)},
+	};
+	const unsigned short filter_sizes[] = {4, 8, 16, 32, 64, 128};
+	const unsigned short block_sizes[] = {1, 2, 4, 8, 16};
+	const unsigned short channel_sizes[] = {4, 8, 16, 32, 64};
+
+	printf("ISA %s, %d rounds of %d repetitions, default tiles sized for %d bytes of L1\n",
+	       cnn_isa_name(cnn_isa), rounds, repetitions, CONV1D_TILE_L1);
+	for (const Layer &layer : layers) {
+		const conv1d_params_t *p = layer.params;
+		const int npairs = (p->kernel_size + 1) / 2;
+		const int conv_samples = layer.pool2 ? p->outsamples / 2 * 2 : p->outsamples;
+		const int blocks = (conv_samples + 2 * lanes - 1) / (2 * lanes);
+		std::vector<number_t> reference(layer.output_bytes / sizeof(number_t));
+		std::vector<conv1d_tile_t> tiles;
+
+		*layer.tile = conv1d_tile_t{0, 0, 0};
+		layer.run();
+		memcpy(reference.data(), layer.output, layer.output_bytes);
+		const conv1d_tile_t fallback = conv1d_simd_tile(p, nullptr, blocks, lanes);
+
+		// Every size of the sweep, clamped like the kernel does, each distinct tile once
+		tiles.push_back(fallback);
+		for (unsigned short f : filter_sizes)
+			for (unsigned short b : block_sizes)
+				for (unsigned short c : channel_sizes) {
+					const conv1d_tile_t request = {f, b, c};
+					const conv1d_tile_t t = conv1d_simd_tile(p, &request, blocks, lanes);
+					if (std::none_of(tiles.begin(), tiles.end(), [&](const conv1d_tile_t &u) {
+						    return u.filters == t.filters && u.blocks == t.blocks && u.channels == t.channels;
+					    }))
+						tiles.push_back(t);
+				}
+
+		printf("\n%s: %d channels x %d taps -> %d filters, %d blocks of %d conv positions\n",
+		       layer.name, p->input_channels, p->kernel_size, p->filters, blocks, 2 * lanes);
+		printf("%7s %6s %8s %10s %10s %10s %8s %8s\n", "filters", "blocks", "channels", "kernel KB", "windows KB",
+		       "partial KB", "us", "vs def");
+		std::vector<double> best(tiles.size(), 1e30);
+		std::vector<bool> exact(tiles.size(), true);
+		for (int round = 0; round < rounds; round++) {
+			for (size_t i = 0; i < tiles.size(); i++) {
+				*layer.tile = tiles[i];
+				best[i] = std::min(best[i], time_us(layer.run, repetitions));
+				exact[i] = exact[i] && memcmp(reference.data(), layer.output, layer.output_bytes) == 0;
+			}
+		}
+		for (size_t i = 0; i < tiles.size(); i++) {
+			const conv1d_tile_t &t = tiles[i];
+			const double us = best[i], default_us = best[0];
+			printf("%7d %6d %8d %10.1f %10.1f %10.1f %8.1f %7.2fx%s%s\n", t.filters, t.blocks, t.channels,
+			       t.filters * t.channels * p->kernel_size * sizeof(number_t) / 1024.0,
+			       t.blocks * t.channels * npairs * 2.0 * vector_bytes / 1024.0,
+			       t.channels < p->input_channels ? t.filters * t.blocks * 2.0 * vector_bytes / 1024.0 : 0.0,
+			       us, default_us / us, i == 0 ? "  default" : "", exact[i] ? "" : "  MISMATCH");
+		}
+		*layer.tile = conv1d_tile_t{0, 0, 0};
+	}
+	return 0;
+}
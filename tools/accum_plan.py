@@ -0,0 +1,165 @@
+#!/usr/bin/env python3
+"""Static range analysis of the accumulators of the conv1d and dense layers.
+
+Reads the generated layers and weights of gsc_output_fixed, propagates the worst-case Q7.9 bounds of
+the model input through them and writes gsc_output_fixed/weights/accum_plan.c, one accum_plan_t per
+layer (layer_params.h), to be rerun whenever the generated weights change:
+
+    python3 tools/accum_plan.py
+
+For each layer the bound of every partial sum is the sum of |w| * max|x| over its terms, so it holds
+whatever the order of the accumulation. The plan records:
+  narrow_taps    the largest n such that the products of any n consecutive taps of a window, and
+                 their partial sums, fit in int16 (0: a single product may not, each product has to
+                 be widened at once, which is what madd does)
+  acc_bits       bits of the full accumulator, sign included. Every kernel accumulates in
+                 long_number_t, the script fails when a layer would need more than 32.
+  winograd_bits  bits of the transform-domain sums of the Winograd kernel of the layer
+                 (weights/conv1d_<n>_winograd.c), 0 without one. conv1d_winograd.h accumulates them
+                 in int32 when they fit, in int64 otherwise.
+A summary table is printed to stdout.
+"""
+
+import os
+import re
+import sys
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'gsc_output_fixed')
+NUMBER_MIN, NUMBER_MAX = -32768, 32767
+FIXED_POINT = 9
+LONG_BITS = 32
+
+# The layers of cnn() in order. The max and average poolings and the flatten between them keep
+# the bounds of their input, they are not listed.
+LAYERS = ['conv1d_116', 'conv1d_117', 'conv1d_118', 'conv1d_119', 'dense_58', 'dense_59']
+
+
+def read_source(path):
+    with open(path, encoding='latin-1') as f:
+        return f.read()
+
+
+def read_array(src, name, count):
+    body = src[src.index(name):]
+    body = body[body.index('=') + 1:body.index(';')]
+    values = [int(v) for v in re.findall(r'-?\d+', body)]
+    if len(values) != count:
+        sys.exit(f'{name}: expected {count} values, read {len(values)}')
+    return values
+
+
+def bits(lo, hi):
+    """Bits of the smallest signed integer holding [lo, hi]."""
+    n = 1
+    while lo < -(1 << (n - 1)) or hi > (1 << (n - 1)) - 1:
+        n += 1
+    return n
+
+
+def magnitude(lo, hi):
+    return max(-lo, hi)
+
+
+def read_layer(name):
+    layer = read_source(os.path.join(ROOT, name + '.c'))
+    weights = read_source(os.path.join(ROOT, 'weights', name + '.c'))
+    defines = {k: int(v) for k, v in re.findall(r'#define (\w+)\s+(\d+)', layer + weights)}
+    relu = re.search(r'#define ACTIVATION_RELU\b', layer) is not None
+    if name.startswith('conv1d'):
+        rows, depth = defines['CONV_FILTERS'], defines['INPUT_CHANNELS'] * defines['CONV_KERNEL_SIZE']
+        taps = defines['CONV_KERNEL_SIZE']
+    else:
+        rows, depth = defines['FC_UNITS'], defines['INPUT_SAMPLES']
+        taps = depth
+    kernel = read_array(weights, name + '_kernel', rows * depth)
+    bias = read_array(weights, name + '_bias', rows)
+    return {
+        'kernel': [kernel[r * depth:(r + 1) * depth] for r in range(rows)],
+        'bias': bias, 'relu': relu, 'taps': taps, 'stride': defines.get('CONV_STRIDE', 1),
+        'channels': depth // taps,
+    }
+
+
+def narrow_taps(layer, x):
+    """Largest n such that any n consecutive taps of one window sum in int16."""
+    best = 0
+    for n in range(1, layer['taps'] + 1):
+        for row in layer['kernel']:
+            for c in range(layer['channels']):
+                w = row[c * layer['taps']:(c + 1) * layer['taps']]
+                for first in range(layer['taps'] - n + 1):
+                    if sum(abs(v) for v in w[first:first + n]) * x > NUMBER_MAX:
+                        return best
+        best = n
+    return best
+
+
+def winograd_bits(name, layer, lo, hi, acc):
+    """Bits of the Winograd sums, conv1d_winograd.h; 0 when the layer has no transformed kernel."""
+    path = os.path.join(ROOT, 'weights', name + '_winograd.c')
+    if not os.path.exists(path):
+        return 0
+    filters, channels = len(layer['kernel']), layer['channels']
+    values = read_array(read_source(path), name + '_winograd_kernel', filters * channels * 4)
+    x, d = magnitude(lo, hi), hi - lo
+    if layer['stride'] == 1:
+        # V = {d0 - d2, d1 + d2, d2 - d1, d1 - d3}, 2 y0 = m0 + m1 + m2, 2 y1 = m1 - m2 - m3, the
+        # direct odd tail is doubled as well
+        v = [d, 2 * x, d, d]
+        outputs = [(0, 1, 2), (1, 2, 3)]
+        worst = 2 * acc
+    else:
+        # V = {x2, x0 - x2, x4 - x2, x1, x3}, y0 = m0 + m1 + m3, y1 = m0 + m2 + m4, m4 uses u3
+        v = [x, d, d, x, x]
+        outputs = [(0, 1, 3), (0, 2, 4)]
+        worst = acc
+    for f in range(filters):
+        u = values[f * channels * 4:(f + 1) * channels * 4]
+        m = [sum(abs(u[c * 4 + min(j, 3)]) for c in range(channels)) * v[j] for j in range(len(v))]
+        worst = max([worst] + [sum(m[j] for j in out) for out in outputs])
+    return bits(-worst, worst)
+
+
+def main():
+    lo, hi = NUMBER_MIN, NUMBER_MAX  # model input, max_pooling1d_145 keeps it
+    plans = []
+    print(f'{"layer":<12} {"input":>16} {"max |acc|":>11} {"acc bits":>8} {"int16 taps":>10} {"winograd bits":>13}')
+    for name in LAYERS:
+        layer = read_layer(name)
+        x = magnitude(lo, hi)
+        acc = max(sum(abs(w) for w in row) for row in layer['kernel']) * x
+        acc_bits = bits(-acc, acc)
+        if acc_bits > LONG_BITS:
+            sys.exit(f'{name}: accumulators need {acc_bits} bits, more than long_number_t')
+        narrow = narrow_taps(layer, x)
+        wino = winograd_bits(name, layer, lo, hi, acc)
+        plans.append((name, narrow, acc_bits, wino))
+        print(f'{name:<12} {f"[{lo}, {hi}]":>16} {acc:>11} {acc_bits:>8} {narrow:>10} {wino:>13}')
+
+        # Output bounds: requantization, bias, then ReLU or the clamp of every layer
+        out_lo = min(((-acc) >> FIXED_POINT) + b for b in layer['bias'])
+        out_hi = max((acc >> FIXED_POINT) + b for b in layer['bias'])
+        lo, hi = max(out_lo, NUMBER_MIN), min(out_hi, NUMBER_MAX)
+        if layer['relu']:
+            lo, hi = max(lo, 0), max(hi, 0)
+
+    body = '\n'.join(f'const accum_plan_t {name}_accum_plan = {{ {narrow}, {acc_bits}, {wino} }};'
+                       for name, narrow, acc_bits, wino in plans)
+    out = f'''/**
+  ******************************************************************************
+  * @file    weights/accum_plan.c
+  * @version 1.0.0
+  * @date    17 october 2026
+  * @brief   Worst-case accumulator widths of the conv1d and dense layers, generated by
+  *          tools/accum_plan.py from the weights and the Q7.9 bounds of the model input
+  */
+
+// {{ narrow_taps, acc_bits, winograd_bits }}
+{body}
+'''.replace('\n', '\r\n')
+    with open(os.path.join(ROOT, 'weights', 'accum_plan.c'), 'w', encoding='latin-1', newline='') as f:
+        f.write(out)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,80 @@
+#!/usr/bin/env python3
+"""Packs the kernels of the dense layers in the panels of the vector GEMM (gsc_output_fixed/dense_gemm.h).
+
+Reads gsc_output_fixed/weights/dense_<n>.c and writes gsc_output_fixed/weights/dense_<n>_panels.c,
+to be rerun whenever the generated weights change:
+
+    python3 tools/dense_panels.py 58 59
+
+Panel p holds the units [8p, 8p + 8): for each pair q of inputs, the 8 pairs (kernel[u][2q],
+kernel[u][2q + 1]) of its units, zero past the last unit and the last input. tools/fixed_point_formats.py
+packs the kernels of weights/formats.c the same way.
+"""
+
+import os
+import re
+import sys
+
+WEIGHTS = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'gsc_output_fixed', 'weights')
+PANEL_UNITS = 8  # DENSE_PANEL_UNITS
+
+
+def read_layer(name):
+    with open(os.path.join(WEIGHTS, name + '.c'), encoding='latin-1') as f:
+        src = f.read()
+    defines = {k: int(v) for k, v in re.findall(r'#define (\w+)\s+(\d+)', src)}
+    units, inputs = defines['FC_UNITS'], defines['INPUT_SAMPLES']
+    body = src[src.index(name + '_kernel'):]
+    body = body[body.index('=') + 1:body.index(';')]
+    values = [int(v) for v in re.findall(r'-?\d+', body)]
+    if len(values) != units * inputs:
+        sys.exit(f'{name}: expected {units}x{inputs} weights, read {len(values)}')
+    return [values[u * inputs:(u + 1) * inputs] for u in range(units)]
+
+
+def pack(kernel):
+    """[panels][pairs][2 * PANEL_UNITS] of the kernel rows."""
+    inputs = len(kernel[0])
+    pairs = (inputs + 1) // 2
+    rows = [row + [0] * (2 * pairs - inputs) for row in kernel]
+    rows += [[0] * (2 * pairs)] * (-len(rows) % PANEL_UNITS)
+    return [[[v for row in rows[p:p + PANEL_UNITS] for v in row[2 * q:2 * q + 2]] for q in range(pairs)]
+            for p in range(0, len(rows), PANEL_UNITS)]
+
+
+def c_panels(name, kernel):
+    """Definition of the int16 array <name>_panels, with CRLF left to the caller."""
+    panels = pack(kernel)
+    body = '\n}\n, '.join('{' + '\n, '.join('{' + ', '.join(map(str, q)) + '}' for q in p) for p in panels)
+    return f'''const int16_t {name}_panels[{len(panels)}][{len(panels[0])}][{2 * PANEL_UNITS}] = {{{body}
+}}
+}}
+;
+'''
+
+
+def main():
+    layers = sys.argv[1:]
+    if not layers:
+        sys.exit(__doc__)
+    for layer in layers:
+        name = 'dense_' + layer
+        kernel = read_layer(name)
+        out = f'''/**
+  ******************************************************************************
+  * @file    weights/{name}_panels.c
+  * @version 1.0.0
+  * @date    17 october 2026
+  * @brief   Kernel of {name} packed in panels of {PANEL_UNITS} units for dense_gemm.h, generated by
+  *          tools/dense_panels.py
+  */
+
+#define {name.upper()}_PANELS
+
+{c_panels(name, kernel)}'''.replace('\n', '\r\n')
+        with open(os.path.join(WEIGHTS, name + '_panels.c'), 'w', encoding='latin-1', newline='') as f:
+            f.write(out)
+
+
+if __name__ == '__main__':
+    main()
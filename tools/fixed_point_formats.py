@@ -0,0 +1,218 @@
+#!/usr/bin/env python3
+"""Chooses the fixed-point format of the weights, biases and outputs of every conv1d and dense layer.
+
+The generated code runs every layer in Q7.9 (FIXED_POINT 9): weights, biases and activations all
+have 9 fractional bits, and every requantization shifts right by 9. With -DCNN_LAYER_FORMATS each
+layer takes its own formats instead, from gsc_output_fixed/weights/formats.c written by this script:
+
+    python3 tools/fixed_point_formats.py [--headroom H] [--eval]
+
+The float weights are read from lab_gsc.h5, where each kernel and bias is located as the float32
+run whose truncation to Q9 gives the int16 values of gsc_output_fixed/weights/<layer>.c (no h5py
+needed; the Q9 values divided by 512 are used when a run is not found). The outputs are calibrated
+on the training clips of dataset/ like in tools/int8_weights.py: the output of a layer is the input
+of the next one up to max poolings, whose histograms calibrate.cpp prints. The dense kernels are
+also written packed for the vector GEMM, as tools/dense_panels.py does for the Q9 ones.
+  input    the format of the output of the previous layer, Q9 for the model input
+  output   the most fractional bits keeping H times the largest |output| met during the
+           calibration (default H = 2) and the biases within int16; Q9 for the last layer, whose
+           output is the model output
+  weights  the most fractional bits (at most 15) keeping every weight within int16 and the
+           accumulators within int32 for any int16 input, the worst case of tools/accum_plan.py
+The requantization of the layer shifts right by input + weights - output bits
+(<LAYER>_REQUANT_SHIFT), the weights and biases are rounded to nearest.
+
+--eval builds main.cpp with g++, with and without -DCNN_LAYER_FORMATS, and prints both accuracies
+on the test clips of dataset/testing_list.txt.
+"""
+
+import math
+import os
+import re
+import struct
+import sys
+import tempfile
+
+from dense_panels import c_panels
+from int8_weights import calibrate, clips, evaluate
+
+REPO = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..')
+ROOT = os.path.join(REPO, 'gsc_output_fixed')
+H5 = os.path.join(REPO, 'lab_gsc.h5')
+NUMBER_MAX, LONG_MAX = 32767, (1 << 31) - 1
+FIXED_POINT, MAX_BITS = 9, 15
+LAYERS = ['conv1d_116', 'conv1d_117', 'conv1d_118', 'conv1d_119', 'dense_58', 'dense_59']
+
+
+def read_layer(name):
+    """(shape, kernel, bias) of the int16 weights, kernel [filters][channels][taps] or [units][inputs]."""
+    with open(os.path.join(ROOT, 'weights', name + '.c'), encoding='latin-1') as f:
+        src = f.read()
+    defines = {k: int(v) for k, v in re.findall(r'#define (\w+)\s+(\d+)', src)}
+    if name.startswith('conv1d'):
+        shape = (defines['CONV_FILTERS'], defines['INPUT_CHANNELS'], defines['CONV_KERNEL_SIZE'])
+    else:
+        shape = (defines['FC_UNITS'], defines['INPUT_SAMPLES'])
+    arrays = []
+    for array, count in (('kernel', math.prod(shape)), ('bias', shape[0])):
+        body = src[src.index(f'{name}_{array}'):]
+        body = body[body.index('=') + 1:body.index(';')]
+        values = [int(v) for v in re.findall(r'-?\d+', body)]
+        if len(values) != count:
+            sys.exit(f'{name}_{array}: expected {count} values, read {len(values)}')
+        arrays.append(values)
+    return shape, arrays[0], arrays[1]
+
+
+def keras_order(shape):
+    """Index in the C array of every value of the Keras array ([taps][channels][filters], [inputs][units])."""
+    if len(shape) == 3:
+        filters, channels, taps = shape
+        return [(f * channels + z) * taps + x for x in range(taps) for z in range(channels) for f in range(filters)]
+    units, inputs = shape
+    return [u * inputs + i for i in range(inputs) for u in range(units)]
+
+
+def find_floats(data, q, order):
+    """Floats of the C array q, from the float32 run of data truncating to it, None if not found."""
+    keras = [q[i] for i in order]
+    scale = 1 << FIXED_POINT
+    found = None
+    for align in range(4):
+        floats = struct.unpack_from(f'<{(len(data) - align) // 4}f', data, align)
+        for start in range(len(floats) - len(keras) + 1):
+            if not abs(floats[start] * scale - keras[0]) < 1:  # NaN skipped as well
+                continue
+            run = floats[start:start + len(keras)]
+            if all(abs(f * scale) < NUMBER_MAX + 1 and int(f * scale) == v for f, v in zip(run, keras)):
+                if found is not None:
+                    return None  # ambiguous
+                found = run
+    if found is None:
+        return None
+    values = [0.0] * len(q)
+    for i, f in zip(order, found):
+        values[i] = f
+    return values
+
+
+def weight_bits(shape, kernel):
+    """Most fractional bits of the kernel with the weights in int16 and the accumulators in int32."""
+    depth = len(kernel) // shape[0]
+    rows = [kernel[r * depth:(r + 1) * depth] for r in range(shape[0])]
+    for bits in range(MAX_BITS, -1, -1):
+        q = [[round(w * (1 << bits)) for w in row] for row in rows]
+        if max(abs(w) for row in q for w in row) <= NUMBER_MAX \
+                and max(sum(abs(w) for w in row) for row in q) * (NUMBER_MAX + 1) <= LONG_MAX:
+            return bits
+    sys.exit('weights too large for Q15.0')
+
+
+def output_bits(magnitude, bias, headroom):
+    """Most fractional bits keeping headroom * magnitude and the biases within int16."""
+    for bits in range(MAX_BITS, -1, -1):
+        if magnitude * headroom * (1 << bits) <= NUMBER_MAX and max(abs(round(b * (1 << bits))) for b in bias) <= NUMBER_MAX:
+            return bits
+    sys.exit('outputs too large for Q15.0')
+
+
+def c_array(values, shape):
+    if len(shape) == 1:
+        return '{' + ', '.join(str(v) for v in values) + '}'
+    step = len(values) // shape[0]
+    return '{' + '\n, '.join(c_array(values[i:i + step], shape[1:]) for i in range(0, len(values), step)) + '}'
+
+
+def main():
+    args = sys.argv[1:]
+    headroom, run_eval = 2.0, '--eval' in args
+    args = [a for a in args if a != '--eval']
+    if '--headroom' in args:
+        i = args.index('--headroom')
+        headroom = float(args[i + 1])
+        del args[i:i + 2]
+    if args or headroom < 1:
+        sys.exit(__doc__)
+
+    with open(H5, 'rb') as f:
+        data = f.read()
+    training, test, classes = clips()
+    with tempfile.TemporaryDirectory() as tmp:
+        histograms = calibrate(tmp, [path for path, _ in training])
+
+        sections = []
+        input_bits = FIXED_POINT
+        print(f'{len(training)} calibration clips, headroom {headroom}')
+        print(f'{"layer":<12} {"floats":>7} {"max |output|":>12} {"input":>5} {"weights":>7} {"output":>6} {"shift":>5} '
+              f'{"Q9 error":>9} {"error":>9}')
+        for l, name in enumerate(LAYERS):
+            shape, q_kernel, q_bias = read_layer(name)
+            kernel = find_floats(data, q_kernel, keras_order(shape))
+            bias = find_floats(data, q_bias, list(range(len(q_bias))))
+            source = 'h5' if kernel is not None and bias is not None else 'Q9'
+            if kernel is None:
+                kernel = [v / (1 << FIXED_POINT) for v in q_kernel]
+            if bias is None:
+                bias = [v / (1 << FIXED_POINT) for v in q_bias]
+
+            if l + 1 < len(LAYERS):
+                lo, hi = min(histograms[LAYERS[l + 1]]), max(histograms[LAYERS[l + 1]])
+                magnitude = max(-lo, hi) / (1 << FIXED_POINT)
+                out_bits = min(output_bits(magnitude, bias, headroom), input_bits + MAX_BITS)
+            else:
+                magnitude, out_bits = float('nan'), FIXED_POINT
+            w_bits = weight_bits(shape, kernel)
+            if input_bits + w_bits < out_bits:
+                w_bits = out_bits - input_bits
+            shift = input_bits + w_bits - out_bits
+
+            weights = [round(w * (1 << w_bits)) for w in kernel]
+            biases = [round(b * (1 << out_bits)) for b in bias]
+            # Relative L2 error of the weights, Q9 against the chosen format
+            norm = sum(w * w for w in kernel) or 1
+            q9_error = math.sqrt(sum((w - v / (1 << FIXED_POINT)) ** 2 for w, v in zip(kernel, q_kernel)) / norm)
+            error = math.sqrt(sum((w - v / (1 << w_bits)) ** 2 for w, v in zip(kernel, weights)) / norm)
+            print(f'{name:<12} {source:>7} {magnitude:>12.3f} {f"Q{input_bits}":>5} {f"Q{w_bits}":>7} {f"Q{out_bits}":>6} '
+                  f'{shift:>5} {q9_error:>9.5f} {error:>9.5f}')
+
+            sections.append(f'''#define {name.upper()}_FORMATS
+#define {name.upper()}_REQUANT_SHIFT {shift} // input Q{input_bits}, weights Q{w_bits}, output and bias Q{out_bits}
+
+const int16_t {name}_bias[{shape[0]}] = {c_array(biases, shape[:1])}
+;
+
+const int16_t {name}_kernel{''.join(f'[{n}]' for n in shape)} = {c_array(weights, shape)}
+;
+''')
+            if name.startswith('dense'):
+                # In place of weights/<layer>_panels.c, which model.c skips for this layer
+                rows = [weights[u * shape[1]:(u + 1) * shape[1]] for u in range(shape[0])]
+                sections.append(f'''#ifdef CNN_SIMD
+#define {name.upper()}_PANELS
+
+{c_panels(name, rows)}#endif
+''')
+            input_bits = out_bits
+
+        out = f'''/**
+  ******************************************************************************
+  * @file    weights/formats.c
+  * @version 1.0.0
+  * @date    17 october 2026
+  * @brief   Weights and biases of the conv1d and dense layers in per-layer fixed-point formats,
+  *          generated by tools/fixed_point_formats.py from lab_gsc.h5 and {len(training)} calibration
+  *          clips (headroom {headroom}), used with -DCNN_LAYER_FORMATS
+  */
+
+{chr(10).join(sections)}'''.replace('\n', '\r\n')
+        with open(os.path.join(ROOT, 'weights', 'formats.c'), 'w', encoding='latin-1', newline='') as f:
+            f.write(out)
+
+        if run_eval:
+            reference, formats = evaluate(tmp, test, classes, '-DCNN_LAYER_FORMATS')
+            print(f'{len(test)} test clips: accuracy Q9 {reference:.4f}, per-layer formats {formats:.4f}, '
+                  f'delta {formats - reference:+.4f}')
+
+
+if __name__ == '__main__':
+    main()
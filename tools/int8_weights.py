@@ -0,0 +1,252 @@
+#!/usr/bin/env python3
+"""Converts the int16 weights of conv1d and dense layers to int8 (gsc_output_fixed/int8.h).
+
+Reads gsc_output_fixed/weights/<layer>.c, calibrates the int8 quantization of the input of each
+layer on the training clips of dataset/ (the .wav files not in dataset/testing_list.txt) and
+writes gsc_output_fixed/weights/int8.c with the int8 rows, their scales and the int16 bias of
+every listed layer, used by the -DCNN_INT8 builds in place of weights/<layer>.c (the int16 kernel
+is not linked), to be rerun whenever the generated weights change:
+
+    python3 tools/int8_weights.py [layer ...] [--percentile P] [--eval]
+
+Weights: one symmetric scale per filter, max |w| -> 127. Inputs: one scale and zero point per
+layer mapping the [lo, hi] range met during the calibration to [0, input_max], lo and hi being
+the (100 - P) and P percentiles of the inputs (default P = 99.9, 100 keeps min and max).
+input_max is 255 unless a pair of weights of the layer could make the int16 pair sums of maddubs
+saturate. The int32 dot products are rescaled to the int16 accumulators by a multiplier per
+filter and a shift per layer. The int16 inputs of every layer are histogrammed by calibrate.cpp,
+built with g++.
+
+--eval builds main.cpp with g++, with and without -DCNN_INT8, and prints both accuracies on the
+test clips of dataset/testing_list.txt.
+"""
+
+import math
+import os
+import re
+import subprocess
+import sys
+import tempfile
+import wave
+
+REPO = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..')
+ROOT = os.path.join(REPO, 'gsc_output_fixed')
+DATASET = os.path.join(REPO, 'dataset')
+FIXED_POINT = 9
+ROW_ALIGN, FILTER_BLOCK = 32, 8  # int8.h: maddubs reads 32 bytes, the dot products run 8 filters
+LAYERS = ['conv1d_116', 'conv1d_117', 'conv1d_118', 'conv1d_119', 'dense_58', 'dense_59']
+
+
+def read_layer(name):
+    """(kernel, bias) of the int16 weights, kernel rows [tap][channel]."""
+    with open(os.path.join(ROOT, 'weights', name + '.c'), encoding='latin-1') as f:
+        src = f.read()
+    defines = {k: int(v) for k, v in re.findall(r'#define (\w+)\s+(\d+)', src)}
+    if name.startswith('conv1d'):
+        rows, channels, taps = defines['CONV_FILTERS'], defines['INPUT_CHANNELS'], defines['CONV_KERNEL_SIZE']
+    else:
+        rows, channels, taps = defines['FC_UNITS'], defines['INPUT_SAMPLES'], 1
+    depth = channels * taps
+    body = src[src.index(name + '_kernel'):]
+    body = body[body.index('=') + 1:body.index(';')]
+    values = [int(v) for v in re.findall(r'-?\d+', body)]
+    if len(values) != rows * depth:
+        sys.exit(f'{name}: expected {rows}x{depth} weights, read {len(values)}')
+    bias = src[src.index(name + '_bias'):]
+    bias = [int(v) for v in re.findall(r'-?\d+', bias[bias.index('=') + 1:bias.index(';')])]
+    # [channel][tap] rows to the [tap][channel] rows of int8.h
+    return [[values[r * depth + z * taps + x] for x in range(taps) for z in range(channels)] for r in range(rows)], bias
+
+
+def clips():
+    """(training, test) lists of (path, class index), classes in the order of their directories."""
+    with open(os.path.join(DATASET, 'testing_list.txt')) as f:
+        testing = set(f.read().split())
+    classes = sorted(d for d in os.listdir(DATASET) if os.path.isdir(os.path.join(DATASET, d)))
+    training, test = [], []
+    for label, name in enumerate(classes):
+        for wav in sorted(os.listdir(os.path.join(DATASET, name))):
+            if wav.endswith('.wav'):
+                (test if f'{name}/{wav}' in testing else training).append((os.path.join(DATASET, name, wav), label))
+    return training, test, len(classes)
+
+
+def build(tmp, sources, flags=()):
+    exe = os.path.join(tmp, os.path.splitext(os.path.basename(sources[0]))[0])
+    subprocess.run(['g++', '-O2', '-I' + ROOT, *flags, *sources, '-o', exe], check=True)
+    return exe
+
+
+def calibrate(tmp, paths):
+    """Histogram {value: count} of the input of every layer."""
+    exe = build(tmp, [os.path.join(REPO, 'calibrate.cpp')])
+    out = subprocess.run([exe], input='\n'.join(paths), check=True, capture_output=True, text=True).stdout
+    histograms = {}
+    for line in out.splitlines():
+        name, value, count = line.split()
+        histograms.setdefault(name, {})[int(value)] = int(count)
+    return histograms
+
+
+def percentile_range(histogram, percentile):
+    """[lo, hi] holding percentile % of the values on each side, always including 0."""
+    total = sum(histogram.values())
+    cut = total * (100 - percentile) / 100
+    values = sorted(histogram)
+    lo, seen = values[0], 0
+    for v in values:
+        seen += histogram[v]
+        if seen > cut:
+            lo = v
+            break
+    hi, seen = values[-1], 0
+    for v in reversed(values):
+        seen += histogram[v]
+        if seen > cut:
+            hi = v
+            break
+    return min(lo, 0), max(hi, 0)
+
+
+def fixed_multiplier(real, bits, max_shift):
+    """(m, s) with m / 2^s ~ real, m < 2^bits and the largest such s <= max_shift."""
+    s = max_shift
+    while s > 1 and round(real * (1 << s)) >= 1 << bits:
+        s -= 1
+    return round(real * (1 << s)), s
+
+
+def quantize(kernel, lo, hi):
+    """int8 rows, per-filter scales and the input quantization of one layer."""
+    scales = [max(abs(w) for w in row) / 127 or 1.0 for row in kernel]
+    rows = [[max(-127, min(127, round(w / s))) for w in row] for row, s in zip(kernel, scales)]
+
+    # maddubs adds two uint8 x int8 products in int16
+    pair = max(abs(row[i]) + (abs(row[i + 1]) if i + 1 < len(row) else 0)
+               for row in rows for i in range(0, len(row), 2))
+    input_max = min(255, 32767 // max(pair, 1))
+
+    input_scale = max((hi - lo) / input_max, 1.0)  # never finer than the int16 inputs
+    input_multiplier, input_shift = fixed_multiplier(1 / input_scale, 15, 31)
+    input_scale = (1 << input_shift) / input_multiplier
+    zero_point = max(0, min(input_max, round(-lo / input_scale)))
+
+    # One shift for the layer (the vector kernels shift 4 filters at once), at most 32
+    _, shift = fixed_multiplier(max(scales) * input_scale, 31, 32)
+    multipliers = [round(s * input_scale * (1 << shift)) for s in scales]
+    for row, m in zip(rows, multipliers):
+        bound = sum(abs(w) for w in row) * max(zero_point, input_max - zero_point)
+        if (bound * m >> shift) + 1 >= 1 << 31:
+            sys.exit(f'rescaled accumulators may not fit in int32 (shift {shift})')
+    return rows, scales, multipliers, shift, (input_multiplier, input_shift, zero_point, input_max)
+
+
+def c_rows(rows):
+    return ',\n'.join('  {' + ', '.join(str(v) for v in row) + '}' for row in rows)
+
+
+def test_csv(tmp, test, classes):
+    """(x, y) csv files of the test clips in tmp, in the format main.cpp reads."""
+    x_csv, y_csv = os.path.join(tmp, 'x.csv'), os.path.join(tmp, 'y.csv')
+    with open(x_csv, 'w') as x, open(y_csv, 'w') as y:
+        for path, label in test:
+            with wave.open(path) as f:  # 16-bit mono, zero-padded or cut to one second
+                data = f.readframes(f.getnframes())
+            samples = [int.from_bytes(data[i:i + 2], 'little', signed=True) for i in range(0, len(data) - 1, 2)]
+            samples = (samples + [0] * 16000)[:16000]
+            x.write(','.join(str(s / (1 << FIXED_POINT)) for s in samples) + '\n')
+            y.write(','.join('1' if c == label else '0' for c in range(classes)) + '\n')
+    return x_csv, y_csv
+
+
+def accuracy(tmp, x_csv, y_csv, flags=()):
+    """Accuracy of main.cpp built with flags on the clips of x_csv and y_csv."""
+    exe = build(tmp, [os.path.join(REPO, 'main.cpp'), os.path.join(ROOT, 'model.c')], flags)
+    out = subprocess.run([exe, x_csv, y_csv], check=True, capture_output=True, text=True).stderr
+    return float(re.search(r'Testing accuracy: ([\d.eE+-]+)', out).group(1))
+
+
+def evaluate(tmp, test, classes, flag='-DCNN_INT8'):
+    """Accuracies of the builds without and with flag (the int16 and the int8 ones) on the test clips."""
+    x_csv, y_csv = test_csv(tmp, test, classes)
+    return [accuracy(tmp, x_csv, y_csv, flags) for flags in ([], [flag])]
+
+
+def main():
+    args = sys.argv[1:]
+    percentile, run_eval = 99.9, '--eval' in args
+    args = [a for a in args if a != '--eval']
+    if '--percentile' in args:
+        i = args.index('--percentile')
+        percentile = float(args[i + 1])
+        del args[i:i + 2]
+    layers = args or LAYERS
+    if any(name not in LAYERS for name in layers):
+        sys.exit(__doc__)
+
+    training, test, classes = clips()
+    with tempfile.TemporaryDirectory() as tmp:
+        histograms = calibrate(tmp, [path for path, _ in training])
+
+        sections, int16_bytes, int8_bytes = [], 0, 0
+        print(f'{len(training)} calibration clips, percentile {percentile}')
+        print(f'{"layer":<12} {"input range":>16} {"scale":>8} {"zero":>5} {"max":>4} {"rel. error":>10} {"int16 B":>8} {"int8 B":>8}')
+        for name in layers:
+            kernel, bias = read_layer(name)
+            lo, hi = percentile_range(histograms[name], percentile)
+            rows, scales, multipliers, shift, (input_multiplier, input_shift, zero_point, input_max) = quantize(kernel, lo, hi)
+
+            error = sum((w - q * s) ** 2 for row, qrow, s in zip(kernel, rows, scales) for w, q in zip(row, qrow))
+            norm = sum(w * w for row in kernel for w in row) or 1
+            row = -(-len(kernel[0]) // ROW_ALIGN) * ROW_ALIGN
+            filters = -(-len(kernel) // FILTER_BLOCK) * FILTER_BLOCK
+            padded = [r + [0] * (row - len(r)) for r in rows] + [[0] * row] * (filters - len(rows))
+            multipliers += [0] * (filters - len(rows))
+            int16_bytes += len(kernel) * len(kernel[0]) * 2
+            int8_bytes += filters * (row + 8)  # padded rows, offset and multiplier of each filter
+            print(f'{name:<12} {f"[{lo}, {hi}]":>16} {(1 << input_shift) / input_multiplier:>8.2f} {zero_point:>5} '
+                  f'{input_max:>4} {math.sqrt(error / norm):>10.4f} {len(kernel) * len(kernel[0]) * 2:>8} {filters * (row + 8):>8}')
+
+            sections.append(f'''#define {name.upper()}_INT8
+
+const int16_t {name}_bias[{len(bias)}] = {{{', '.join(str(b) for b in bias)}}}
+;
+
+static const int8_t {name}_int8_kernel[{filters}][{row}] = {{
+{c_rows(padded)}
+}};
+
+static const int32_t {name}_int8_offset[{filters}] = {{ {', '.join(str(zero_point * sum(r)) for r in padded)} }};
+
+static const int32_t {name}_int8_multiplier[{filters}] = {{ {', '.join(str(m) for m in multipliers)} }};
+
+const int8_weights_t {name}_int8 = {{
+  {row}, &{name}_int8_kernel[0][0], {name}_int8_offset, {name}_int8_multiplier, {shift},
+  {input_multiplier}, {input_shift}, {zero_point}, {input_max}
+}};
+''')
+
+        print(f'{"kernels":<12} {"":>16} {"":>8} {"":>5} {"":>4} {"":>10} {int16_bytes:>8} {int8_bytes:>8}')
+
+        out = f'''/**
+  ******************************************************************************
+  * @file    weights/int8.c
+  * @version 1.0.0
+  * @date    17 october 2026
+  * @brief   Int8 weights of {', '.join(layers)} with one scale per filter and the
+  *          quantization of their inputs, generated by tools/int8_weights.py from the int16
+  *          weights and {len(training)} calibration clips (percentile {percentile}), used with -DCNN_INT8
+  *          in place of their int16 kernel
+  */
+
+{chr(10).join(sections)}'''.replace('\n', '\r\n')
+        with open(os.path.join(ROOT, 'weights', 'int8.c'), 'w', encoding='latin-1', newline='') as f:
+            f.write(out)
+
+        if run_eval:
+            reference, int8 = evaluate(tmp, test, classes)
+            print(f'{len(test)} test clips: accuracy int16 {reference:.4f}, int8 {int8:.4f}, delta {int8 - reference:+.4f}')
+
+
+if __name__ == '__main__':
+    main()
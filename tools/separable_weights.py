@@ -0,0 +1,214 @@
+#!/usr/bin/env python3
+"""Imports the depthwise-separable blocks replacing conv1d_118 and conv1d_119 (-DCNN_SEPARABLE).
+
+Reads the Keras SeparableConv1D layers of a trained model .h5 and writes their weights to
+gsc_output_fixed/weights/separable.c, which -DCNN_SEPARABLE builds need:
+
+    python3 tools/separable_weights.py MODEL.h5 [--layers NAME NAME] [--eval]
+
+The model is that of lab_gsc.h5 with conv1d_118 and conv1d_119 replaced by SeparableConv1D layers
+of the same filters, kernel size, stride, 'valid' padding and ReLU, and any depth_multiplier M
+(build with -DCNN_SEPARABLE_MULTIPLIER=M when M != 1, which weights/separable.c checks). --layers
+names the two layers, the SeparableConv1D layers of the model in order by default. The other
+layers keep the int16 weights of gsc_output_fixed/weights/: train the separable blocks with the
+other layers of lab_gsc.h5 frozen, or regenerate the whole model from the new .h5.
+
+The depthwise taps are stored with the most fractional bits (at most 15) keeping them in int16,
+DEPTHWISE_CONV1D_<n>_REQUANT_SHIFT with the Q9 input and output; the pointwise kernel and the bias
+in Q9 like the generated weights, rounded to nearest. The kernels are located by the layout of the
+Keras .h5 files (h5py needed), not by their Q9 values like in tools/fixed_point_formats.py: they
+have no int16 counterpart in gsc_output_fixed/weights/.
+
+lab_gsc.h5 has no SeparableConv1D layer: the weights/separable.c of the repository holds none and
+-DCNN_SEPARABLE stops at build time. The rank-1 factorization of the trained conv1d_118 and
+conv1d_119 kernels the blocks were first tried with kept 30 of the 112 test clips, the blocks have
+to be trained.
+
+--eval builds main.cpp and separable_bench.cpp with g++ and prints the accuracy on the test clips
+of dataset/testing_list.txt of the int16 model and of the separable one, with the MACs and the
+latency of the two blocks (microseconds, one thread, kernels of the running CPU).
+"""
+
+import json
+import os
+import re
+import subprocess
+import sys
+import tempfile
+
+from fixed_point_formats import c_array, read_layer
+from int8_weights import accuracy, build, clips, test_csv
+
+REPO = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..')
+ROOT = os.path.join(REPO, 'gsc_output_fixed')
+LAYERS = ['conv1d_118', 'conv1d_119']
+FIXED_POINT, MAX_BITS = 9, 15
+NUMBER_MIN, NUMBER_MAX = -32768, 32767
+
+
+def read_separable(path, names):
+    """[(name, config, depthwise [taps][channels][M], pointwise [channels * M][filters], bias)] of the
+    SeparableConv1D layers names of the Keras .h5 at path, all of them in order when names is None."""
+    try:
+        import h5py
+    except ImportError:
+        sys.exit('h5py is needed to read the layers of a Keras .h5')
+    with h5py.File(path, 'r') as f:
+        config = json.loads(f.attrs['model_config'])
+        configs = {layer['config']['name']: layer for layer in config['config']['layers']}
+        weights = f['model_weights'] if 'model_weights' in f else f
+        order = [n.decode() if isinstance(n, bytes) else n for n in weights.attrs['layer_names']]
+        if names is None:
+            names = [n for n in order if configs.get(n, {}).get('class_name') == 'SeparableConv1D']
+        layers = []
+        for name in names:
+            if configs.get(name, {}).get('class_name') != 'SeparableConv1D':
+                sys.exit(f'{path}: no SeparableConv1D layer {name}')
+            arrays = {}
+
+            def collect(key, item):  # <name>/depthwise_kernel:0 and the like
+                if isinstance(item, h5py.Dataset):
+                    arrays[key.split('/')[-1].split(':')[0]] = item[()]
+            weights[name].visititems(collect)
+            if not {'depthwise_kernel', 'pointwise_kernel', 'bias'} <= set(arrays):
+                sys.exit(f'{path}: {name} lacks its depthwise_kernel, pointwise_kernel or bias')
+            layers.append((name, configs[name]['config'], arrays['depthwise_kernel'].tolist(),
+                           arrays['pointwise_kernel'][0].tolist(), arrays['bias'].tolist()))
+    return layers
+
+
+def quantize(values, bits):
+    return [max(NUMBER_MIN, min(NUMBER_MAX, round(v * (1 << bits)))) for v in values]
+
+
+def depthwise_bits(taps):
+    """Most fractional bits of the depthwise taps within int16."""
+    top = max((abs(t) for t in taps), default=0)
+    for bits in range(MAX_BITS, -1, -1):
+        if top * (1 << bits) <= NUMBER_MAX:
+            return bits
+    sys.exit('depthwise taps too large for Q15.0')
+
+
+def write(path, layers):
+    """Writes weights/separable.c from the layers of read_separable(), which replace LAYERS in order."""
+    if len(layers) != len(LAYERS):
+        sys.exit(f'{path}: {len(layers)} SeparableConv1D layers, the separable chain replaces {", ".join(LAYERS)}')
+    sections, multipliers = [], set()
+    print(f'{"layer":<12} {"keras layer":<24} {"multiplier":>10} {"taps Q":>6} {"int16 B":>8} {"separable B":>11}')
+    for conv, (name, config, depthwise, pointwise, bias) in zip(LAYERS, layers):
+        (filters, channels, taps), kernel, _ = read_layer(conv)
+        multiplier = len(depthwise[0][0])
+        stride = read_stride(conv)
+        if (len(depthwise), len(depthwise[0]), len(pointwise), len(pointwise[0])) != (taps, channels, channels * multiplier, filters) \
+                or config.get('strides', [stride])[0] != stride or config.get('padding') != 'valid' \
+                or config.get('activation') != 'relu' or not config.get('use_bias', True):
+            sys.exit(f'{path}: {name} is not a SeparableConv1D of {conv} ({filters} filters of {taps} taps over '
+                     f'{channels} channels, stride {stride}, valid padding, ReLU, bias)')
+        multipliers.add(multiplier)
+
+        # Keras orders the depthwise outputs by input channel, then by filter of the channel
+        rows = [[depthwise[x][c][m] for x in range(taps)] for c in range(channels) for m in range(multiplier)]
+        bits = depthwise_bits(sum(rows, []))
+        n = conv[len('conv1d_'):]
+        size = 2 * (len(rows) * (taps + 1) + filters * (channels * multiplier + 1))
+        print(f'{conv:<12} {name:<24} {multiplier:>10} {bits:>6} {2 * (len(kernel) + filters):>8} {size:>11}')
+        sections.append(f'''// {conv}: {name}, depth_multiplier {multiplier}
+#define INPUT_CHANNELS    {channels}
+#define CONV_FILTERS      {filters}
+#define CONV_KERNEL_SIZE  {taps}
+#define DEPTH_FILTERS     {channels * multiplier}
+
+#define DEPTHWISE_CONV1D_{n}_REQUANT_SHIFT {bits} // Q{FIXED_POINT} input and output, Q{bits} taps
+
+const int16_t depthwise_conv1d_{n}_bias[DEPTH_FILTERS] = {c_array([0] * len(rows), [len(rows)])}
+;
+
+const int16_t depthwise_conv1d_{n}_kernel[DEPTH_FILTERS][CONV_KERNEL_SIZE] = {c_array(quantize(sum(rows, []), bits), [len(rows), taps])}
+;
+
+const int16_t pointwise_conv1d_{n}_bias[CONV_FILTERS] = {c_array(quantize(bias, FIXED_POINT), [filters])}
+;
+
+const int16_t pointwise_conv1d_{n}_kernel[CONV_FILTERS][DEPTH_FILTERS] = {c_array(quantize([pointwise[i][f] for f in range(filters) for i in range(channels * multiplier)], FIXED_POINT), [filters, channels * multiplier])}
+;
+
+#undef INPUT_CHANNELS
+#undef CONV_FILTERS
+#undef CONV_KERNEL_SIZE
+#undef DEPTH_FILTERS
+''')
+    if len(multipliers) != 1:
+        sys.exit(f'{path}: the separable layers have depth multipliers {sorted(multipliers)}, '
+                 'CNN_SEPARABLE_MULTIPLIER sets one for both')
+    multiplier = multipliers.pop()
+
+    out = f'''/**
+  ******************************************************************************
+  * @file    weights/separable.c
+  * @version 1.0.0
+  * @date    17 october 2026
+  * @brief   Depthwise and pointwise weights of the separable blocks replacing {', '.join(LAYERS)},
+  *          imported by tools/separable_weights.py from {os.path.basename(path)}, used with -DCNN_SEPARABLE
+  */
+
+#if CNN_SEPARABLE_MULTIPLIER != {multiplier}
+#error "imported with depth_multiplier {multiplier}, build with -DCNN_SEPARABLE_MULTIPLIER={multiplier}"
+#endif
+
+#define SEPARABLE_WEIGHTS // {', '.join(name for name, *_ in layers)}
+
+{chr(10).join(sections)}'''.replace('\n', '\r\n')
+    with open(os.path.join(ROOT, 'weights', 'separable.c'), 'w', encoding='latin-1', newline='') as f:
+        f.write(out)
+    return multiplier
+
+
+def read_stride(name):
+    """CONV_STRIDE of the generated gsc_output_fixed/<name>.c."""
+    with open(os.path.join(ROOT, name + '.c'), encoding='latin-1') as f:
+        return int(re.search(r'#define CONV_STRIDE\s+(\d+)', f.read()).group(1))
+
+
+def bench(tmp, multiplier):
+    """{block: (conv MACs, separable MACs, conv us, separable us)} of separable_bench.cpp, best of 3 runs."""
+    exe = build(tmp, [os.path.join(REPO, 'separable_bench.cpp')], ['-DCNN_SEPARABLE', f'-DCNN_SEPARABLE_MULTIPLIER={multiplier}'])
+    best = {}
+    for _ in range(3):
+        out = subprocess.run([exe, '500'], check=True, capture_output=True, text=True).stdout
+        for m in re.finditer(r'^(conv1d_\d+)\s+(\d+)\s+(\d+)\s+\d+\s+\d+\s+([\d.]+)\s+([\d.]+)', out, re.M):
+            row = [int(m.group(2)), int(m.group(3)), float(m.group(4)), float(m.group(5))]
+            if m.group(1) in best:
+                row[2:] = [min(a, b) for a, b in zip(best[m.group(1)][2:], row[2:])]
+            best[m.group(1)] = row
+    return best
+
+
+def main():
+    args = sys.argv[1:]
+    run_eval = '--eval' in args
+    args = [a for a in args if a != '--eval']
+    names = None
+    if '--layers' in args:
+        i = args.index('--layers')
+        names = args[i + 1:i + 3]
+        del args[i:i + 3]
+    if len(args) != 1 or (names is not None and len(names) != len(LAYERS)):
+        sys.exit(__doc__)
+
+    multiplier = write(args[0], read_separable(args[0], names))
+
+    if run_eval:
+        _, test, classes = clips()
+        with tempfile.TemporaryDirectory() as tmp:
+            x_csv, y_csv = test_csv(tmp, test, classes)
+            flags = ['-DCNN_SEPARABLE', f'-DCNN_SEPARABLE_MULTIPLIER={multiplier}']
+            print(f'\n{len(test)} test clips, int16 accuracy {accuracy(tmp, x_csv, y_csv):.4f}, '
+                  f'separable {accuracy(tmp, x_csv, y_csv, flags):.4f}; latency in us')
+            us = bench(tmp, multiplier)
+            for name in LAYERS:
+                print(f'{name:<12} MACs {us[name][0]:>7} -> {us[name][1]:>6} {us[name][2]:>5.1f} -> {us[name][3]:>5.1f}')
+
+
+if __name__ == '__main__':
+    main()
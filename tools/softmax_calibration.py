@@ -0,0 +1,167 @@
+#!/usr/bin/env python3
+"""Calibrates the temperature of the softmax turning the logits of the model into confidences.
+
+cnn() returns the Q9 logits of dense_59, the softmax of the Keras model being left out.
+cnn_softmax() (gsc_output_fixed/softmax.h) gives the softmax of logits / T, T read from
+gsc_output_fixed/weights/softmax.c written by this script, to be rerun whenever the weights change:
+
+    python3 tools/softmax_calibration.py [--temperature T]
+
+T minimizes the negative log-likelihood of the labels of the calibration clips, every other clip of
+each class of dataset/testing_list.txt, and is scored on the rest of them, the evaluation clips,
+which it is not fitted on. The training clips are classified with near certainty, so a T fitted on
+them only sharpens the confidences further (T = 0.39). The search is a golden-section search on
+log T in [0.25, 64]. T scales the probabilities but not their order, so the argmax and the
+accuracy do not change. It is stored as multiplier / 2^shift = 2^(9 - FIXED_POINT) / T with a
+16-bit multiplier. The logits and the fixed-point confidences of every clip are printed by
+calibrate.cpp --logits, built with g++.
+
+The fit is repeated with the two halves swapped. T is written only when the two fits are within
+STABLE of each other and both lower the NLL of the half they are not fitted on, T = 1 otherwise
+(the default multiplier and shift of softmax.h): with the 56 clips of each half the fits are 1.00
+and 0.25, the second one raising the NLL of the calibration clips from 0.36 to 0.80, and T = 1 is
+written. --temperature sets T instead.
+
+Prints the NLL and the expected calibration error (10 bins of confidence) at T = 1 and at the
+fitted T in float on the half each T is not fitted on, then those of the fixed-point
+cnn_softmax() on the evaluation clips and its largest difference with the float softmax.
+"""
+
+import math
+import os
+import subprocess
+import sys
+import tempfile
+
+from int8_weights import build, clips, FIXED_POINT
+
+REPO = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..')
+ROOT = os.path.join(REPO, 'gsc_output_fixed')
+
+T_MIN, T_MAX = 0.25, 64.0  # the multiplier 2^14 / T stays within [1, 2^16)
+MULTIPLIER_BITS = 14       # SOFTMAX_DEFAULT_MULTIPLIER, T = 1
+BINS = 10
+STABLE = 1.25             # largest ratio of the temperatures fitted on the two halves
+
+
+def run_logits(tmp, paths):
+    """(logits, fixed-point probabilities) of every clip, in units of 2^-FIXED_POINT."""
+    exe = build(tmp, [os.path.join(REPO, 'calibrate.cpp')])
+    out = subprocess.run([exe, '--logits'], input='\n'.join(paths), check=True, capture_output=True, text=True).stdout
+    rows = [[int(v) for v in line.split()] for line in out.splitlines()]
+    half = len(rows[0]) // 2
+    return [r[:half] for r in rows], [r[half:] for r in rows]
+
+
+def softmax(logits, t):
+    z = [v / (1 << FIXED_POINT) / t for v in logits]
+    top = max(z)
+    e = [math.exp(v - top) for v in z]
+    s = sum(e)
+    return [v / s for v in e]
+
+
+def nll(logits, labels, t):
+    return -sum(math.log(max(softmax(l, t)[y], 1e-300)) for l, y in zip(logits, labels)) / len(labels)
+
+
+def ece(probs, labels):
+    """Expected calibration error: |accuracy - confidence| of the argmax, weighted over the bins."""
+    bins = [[0, 0.0, 0.0] for _ in range(BINS)]  # clips, correct, confidence
+    for p, y in zip(probs, labels):
+        top = max(range(len(p)), key=lambda c: p[c])
+        b = bins[min(int(p[top] * BINS), BINS - 1)]
+        b[0] += 1
+        b[1] += top == y
+        b[2] += p[top]
+    return sum(abs(correct - confidence) for _, correct, confidence in bins) / len(labels)
+
+
+def fit_temperature(logits, labels):
+    """T minimizing the NLL, golden-section search on log T (the NLL is convex in 1 / T)."""
+    ratio = (math.sqrt(5) - 1) / 2
+    a, b = math.log(T_MIN), math.log(T_MAX)
+    c, d = b - ratio * (b - a), a + ratio * (b - a)
+    fc, fd = nll(logits, labels, math.exp(c)), nll(logits, labels, math.exp(d))
+    while b - a > 1e-4:
+        if fc < fd:
+            b, d, fd = d, c, fc
+            c = b - ratio * (b - a)
+            fc = nll(logits, labels, math.exp(c))
+        else:
+            a, c, fc = c, d, fd
+            d = a + ratio * (b - a)
+            fd = nll(logits, labels, math.exp(d))
+    return math.exp((a + b) / 2)
+
+
+def main():
+    args = sys.argv[1:]
+    temperature = None
+    if '--temperature' in args:
+        i = args.index('--temperature')
+        temperature = float(args[i + 1])
+        del args[i:i + 2]
+    if args or (temperature is not None and not T_MIN <= temperature <= T_MAX):
+        sys.exit(__doc__)
+
+    _, test, _ = clips()
+    halves, seen = ([], []), {}
+    for i, (_, label) in enumerate(test):  # every other clip of each class
+        halves[seen.get(label, 0) % 2].append(i)
+        seen[label] = seen.get(label, 0) + 1
+    calibration, evaluation = halves
+    paths = [path for path, _ in test]
+    with tempfile.TemporaryDirectory() as tmp:
+        all_logits, _ = run_logits(tmp, paths)
+        logits = {name: ([all_logits[i] for i in half], [test[i][1] for i in half])
+                  for name, half in (('calibration', calibration), ('evaluation', evaluation))}
+
+        print(f'{"T fitted on":<34} {"T":>6} {"NLL T=1":>8} {"NLL":>8} {"ECE T=1":>8} {"ECE":>8}   on the other half')
+        fits = []
+        for fit, score in (('calibration', 'evaluation'), ('evaluation', 'calibration')):
+            t = fit_temperature(*logits[fit])
+            l, y = logits[score]
+            fits.append((t, nll(l, y, t) < nll(l, y, 1.0)))
+            print(f'  {f"{len(logits[fit][1])} {fit} clips":<32} {t:>6.3f} {nll(l, y, 1.0):>8.4f} {nll(l, y, t):>8.4f} '
+                  f'{ece([softmax(v, 1.0) for v in l], y):>8.4f} {ece([softmax(v, t) for v in l], y):>8.4f}')
+        (t, better), (swapped, swapped_better) = fits
+        if temperature is None:
+            stable = better and swapped_better and max(t, swapped) / min(t, swapped) <= STABLE
+            temperature = t if stable else 1.0
+            print(f'{"stable" if stable else "no stable"} temperature, T = {temperature:.4f} written')
+        multiplier = min(max(round((1 << MULTIPLIER_BITS) / temperature), 1), (1 << 16) - 1)
+        temperature = (1 << MULTIPLIER_BITS) / multiplier  # the one cnn_softmax() applies
+        define = 'SOFTMAX_DEFAULT_MULTIPLIER' if multiplier == 1 << MULTIPLIER_BITS else str(multiplier)
+
+        out = f'''/**
+  ******************************************************************************
+  * @file    weights/softmax.c
+  * @version 1.0.0
+  * @date    17 october 2026
+  * @brief   Temperature of the softmax of the logits of dense_59 (see softmax.h), generated by
+  *          tools/softmax_calibration.py: fitted on {len(calibration)} of the test clips, written when the
+  *          fit is stable (T = 1 otherwise)
+  */
+
+// multiplier / 2^shift = 2^(SOFTMAX_Z_BITS - FIXED_POINT) / T, T = {temperature:.4f}
+#define DENSE_59_SOFTMAX_MULTIPLIER {define}
+#define DENSE_59_SOFTMAX_SHIFT      SOFTMAX_DEFAULT_SHIFT
+'''.replace('\n', '\r\n')
+        with open(os.path.join(ROOT, 'weights', 'softmax.c'), 'w', encoding='latin-1', newline='') as f:
+            f.write(out)
+
+        # Rebuilt with the new weights/softmax.c, on the evaluation clips
+        paths = [paths[i] for i in evaluation]
+        l, labels = logits['evaluation']
+        _, fixed = run_logits(tmp, paths)
+        one = 1 << FIXED_POINT
+        probs = [[v / one for v in p] for p in fixed]
+        fixed_nll = -sum(math.log(max(p[y], 0.5 / one)) for p, y in zip(probs, labels)) / len(labels)
+        error = max(abs(v - f) * one for x, p in zip(l, probs) for v, f in zip(p, softmax(x, temperature)))
+        print(f'  {"cnn_softmax(), Q" + str(FIXED_POINT):<32} {temperature:>6.3f} {nll(l, labels, 1.0):>8.4f} {fixed_nll:>8.4f} '
+              f'{ece([softmax(x, 1.0) for x in l], labels):>8.4f} {ece(probs, labels):>8.4f}   '
+              f'largest difference with float {error:.2f} / {one}')
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,146 @@
+#!/usr/bin/env python3
+"""Ternarizes or binarizes the weights of conv1d and dense layers (gsc_output_fixed/ternary.h).
+
+Reads gsc_output_fixed/weights/<layer>.c and writes gsc_output_fixed/weights/ternary.c with the
+bit-packed rows, the per-filter scales and the int16 bias of every listed layer, used by the
+-DCNN_TERNARY builds in place of weights/<layer>.c (the int16 kernel is not linked), to be rerun
+whenever the generated weights change:
+
+    python3 tools/ternary_weights.py [--binary] [layer ...] [--eval]
+
+The default layers are conv1d_119 and dense_58, 78% of the weights of the model. Without retraining
+they cost 5 of the 112 test clips of dataset/testing_list.txt (0.946 -> 0.902); conv1d_117 and
+conv1d_118 alone cost 16 to 23 points and need a ternary-aware fine-tuning first.
+Each filter w is replaced by alpha * t. Ternary filters take t = sign(w) on the k largest |w|, 0
+elsewhere, with the k and alpha = mean of those |w| minimizing |w - alpha t|^2; binary filters take
+t = sign(w) everywhere (0 counts as +1) and alpha = mean |w|. alpha keeps the fixed-point format of
+the weights, so the layers requantize as before.
+
+--eval builds main.cpp with g++, with and without -DCNN_TERNARY, and prints both accuracies on the
+test clips of dataset/testing_list.txt, like tools/int8_weights.py.
+"""
+
+import os
+import sys
+import tempfile
+
+from fixed_point_formats import c_array, read_layer
+from int8_weights import clips, evaluate
+
+REPO = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..')
+ROOT = os.path.join(REPO, 'gsc_output_fixed')
+NUMBER_MAX = 32767
+LAYERS = ['conv1d_119', 'dense_58']
+
+
+def ternarize(row):
+    """(alpha, t) of a ternary row, t in {-1, 0, 1}."""
+    order = sorted(range(len(row)), key=lambda r: -abs(row[r]))
+    best, total, k_best = -1.0, 0, 1
+    for k, r in enumerate(order, 1):
+        total += abs(row[r])
+        if total * total / k > best:
+            best, k_best = total * total / k, k
+    kept = order[:k_best]
+    alpha = round(sum(abs(row[r]) for r in kept) / k_best)
+    t = [0] * len(row)
+    for r in kept:
+        t[r] = 1 if row[r] > 0 else -1 if row[r] < 0 else 0
+    return alpha, t
+
+
+def binarize(row):
+    """(alpha, t) of a binary row, t in {-1, 1}."""
+    return round(sum(abs(v) for v in row) / len(row)), [1 if v >= 0 else -1 for v in row]
+
+
+def pack(t, sign):
+    words = [0] * ((len(t) + 31) // 32)
+    for r, v in enumerate(t):
+        if v == sign:
+            words[r // 32] |= 1 << (r % 32)
+    return words
+
+
+def c_words(rows):
+    return ',\n'.join('  {' + ', '.join(f'0x{w:08X}u' for w in row) + '}' for row in rows)
+
+
+def main():
+    args = sys.argv[1:]
+    binary, run_eval = '--binary' in args, '--eval' in args
+    args = [a for a in args if a not in ('--binary', '--eval')]
+    layers = args or LAYERS
+
+    sections = []
+    print(f'{"layer":<12} {"weights":>8} {"zeros":>6} {"rel. error":>10} {"int16 B":>8} {"packed B":>8}')
+    for name in layers:
+        shape, flat, bias = read_layer(name)
+        depth = len(flat) // shape[0]
+        kernel = [flat[r * depth:(r + 1) * depth] for r in range(shape[0])]
+        quantized = [binarize(row) if binary else ternarize(row) for row in kernel]
+        for alpha, _ in quantized:
+            if alpha > NUMBER_MAX:
+                sys.exit(f'{name}: scale {alpha} does not fit in number_t')
+
+        # Summary: share of zero weights and relative L2 error of alpha * t
+        count = sum(len(row) for row in kernel)
+        zeros = sum(v == 0 for _, t in quantized for v in t)
+        error = sum((w - alpha * v) ** 2 for row, (alpha, t) in zip(kernel, quantized) for w, v in zip(row, t))
+        norm = sum(w * w for row in kernel for w in row) or 1
+        words = (len(kernel[0]) + 31) // 32
+        packed = len(kernel) * (words * 4 * (1 if binary else 2) + 2)
+        print(f'{name:<12} {count:>8} {zeros / count:>6.1%} {(error / norm) ** 0.5:>10.3f} {count * 2:>8} {packed:>8}')
+
+        pos = c_words(pack(t, 1) for _, t in quantized)
+        neg = c_words(pack(t, -1) for _, t in quantized)
+        scale = ', '.join(str(alpha) for alpha, _ in quantized)
+        section = f'''#define {name.upper()}_TERNARY
+
+const int16_t {name}_bias[{len(kernel)}] = {c_array(bias, [len(bias)])}
+;
+
+static const uint32_t {name}_ternary_pos[{len(kernel)}][{words}] = {{
+{pos}
+}};
+'''
+        if not binary:
+            section += f'''
+static const uint32_t {name}_ternary_neg[{len(kernel)}][{words}] = {{
+{neg}
+}};
+'''
+        section += f'''
+static const number_t {name}_ternary_scale[{len(kernel)}] = {{ {scale} }};
+
+const ternary_weights_t {name}_ternary = {{
+  {words}, &{name}_ternary_pos[0][0], {'NULL' if binary else f'&{name}_ternary_neg[0][0]'}, {name}_ternary_scale
+}};
+'''
+        sections.append(section)
+
+    body = '\n'.join(sections)
+    out = f'''/**
+  ******************************************************************************
+  * @file    weights/ternary.c
+  * @version 1.0.0
+  * @date    17 october 2026
+  * @brief   {'Binary' if binary else 'Ternary'} weights of {', '.join(layers)} with one scale per filter,
+  *          generated by tools/ternary_weights.py from the int16 weights, used with -DCNN_TERNARY
+  *          in place of their int16 kernel
+  */
+
+{body}'''.replace('\n', '\r\n')
+    with open(os.path.join(ROOT, 'weights', 'ternary.c'), 'w', encoding='latin-1', newline='') as f:
+        f.write(out)
+
+    if run_eval:
+        _, test, classes = clips()
+        with tempfile.TemporaryDirectory() as tmp:
+            reference, ternary = evaluate(tmp, test, classes, '-DCNN_TERNARY')
+        print(f'{len(test)} test clips: accuracy int16 {reference:.4f}, {"binary" if binary else "ternary"} {ternary:.4f}, '
+              f'delta {ternary - reference:+.4f}')
+
+
+if __name__ == '__main__':
+    main()
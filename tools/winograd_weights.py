@@ -0,0 +1,95 @@
+#!/usr/bin/env python3
+"""Precomputes the transformed kernels of the Winograd conv1d path (gsc_output_fixed/conv1d_winograd.h).
+
+Reads gsc_output_fixed/weights/conv1d_<n>.c and writes gsc_output_fixed/weights/conv1d_<n>_winograd.c,
+to be rerun whenever the generated weights change:
+
+    python3 tools/winograd_weights.py 117 118 119
+
+Each file defines CONV1D_<n>_WINOGRAD, which the -DCNN_AUTOTUNE build checks for the layers that have one.
+
+Stride 1, kernel 3 layers get the F(2,3) kernel {2 g0, g0 + g1 + g2, g0 - g1 + g2, 2 g2} (G scaled by 2
+so that it stays integer, the kernel halves the output transform exactly). Stride 2, kernel 3 layers are
+split in their even and odd phases: the even taps (g0, g2) run as F(2,2) on the even samples, the odd
+tap g1 directly on the odd samples, which gives {g0 + g2, g0, g2, g1}.
+"""
+
+import os
+import re
+import sys
+
+WEIGHTS = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'gsc_output_fixed', 'weights')
+NUMBER_MIN, NUMBER_MAX = -32768, 32767
+
+
+def read_layer(name):
+    with open(os.path.join(WEIGHTS, name + '.c'), encoding='latin-1') as f:
+        src = f.read()
+    defines = {k: int(v) for k, v in re.findall(r'#define (\w+)\s+(\d+)', src)}
+    body = src[src.index(name + '_kernel'):]
+    body = body[body.index('=') + 1:body.index(';')]
+    values = [int(v) for v in re.findall(r'-?\d+', body)]
+    filters, channels, kernel_size = defines['CONV_FILTERS'], defines['INPUT_CHANNELS'], defines['CONV_KERNEL_SIZE']
+    if len(values) != filters * channels * kernel_size:
+        sys.exit(f'{name}: expected {filters}x{channels}x{kernel_size} weights, read {len(values)}')
+    it = iter(values)
+    kernel = [[[next(it) for _ in range(kernel_size)] for _ in range(channels)] for _ in range(filters)]
+    return kernel, defines
+
+
+def transform(g, stride):
+    if stride == 1:
+        return [2 * g[0], g[0] + g[1] + g[2], g[0] - g[1] + g[2], 2 * g[2]]
+    return [g[0] + g[2], g[0], g[2], g[1]]
+
+
+def main():
+    layers = sys.argv[1:]
+    if not layers:
+        sys.exit(__doc__)
+    for layer in layers:
+        name = 'conv1d_' + layer
+        kernel, defines = read_layer(name)
+        # Strides are not in the weights file, they are read from the layer file next to it
+        with open(os.path.join(WEIGHTS, '..', name + '.c'), encoding='latin-1') as f:
+            stride = int(re.search(r'#define CONV_STRIDE\s+(\d+)', f.read()).group(1))
+        if defines['CONV_KERNEL_SIZE'] != 3 or stride not in (1, 2):
+            sys.exit(f'{name}: only kernel 3 with stride 1 or 2 has a Winograd path')
+
+        transformed = [[transform(g, stride) for g in row] for row in kernel]
+        flat = [v for row in transformed for u in row for v in u]
+        if min(flat) < NUMBER_MIN or max(flat) > NUMBER_MAX:
+            sys.exit(f'{name}: transformed weights do not fit in number_t')
+
+        rows = '\r\n}\r\n, '.join('{' + '\r\n, '.join('{' + ', '.join(map(str, u)) + '}' for u in row) for row in transformed)
+        brief = 'F(2,3) transformed kernel' if stride == 1 else 'Even/odd phase (F(2,2) + direct) transformed kernel'
+        out = f'''/**
+  ******************************************************************************
+  * @file    weights/{name}_winograd.c
+  * @version 1.0.0
+  * @date    17 october 2026
+  * @brief   {brief} of {name}, generated by tools/winograd_weights.py
+  */
+
+#define {name.upper()}_WINOGRAD
+
+#define INPUT_CHANNELS    {defines['INPUT_CHANNELS']}
+#define CONV_FILTERS      {defines['CONV_FILTERS']}
+#define WINOGRAD_TAPS     4
+
+
+const int16_t {name}_winograd_kernel[CONV_FILTERS][INPUT_CHANNELS][WINOGRAD_TAPS] = {{{rows}
+}}
+}}
+;
+
+#undef INPUT_CHANNELS
+#undef CONV_FILTERS
+#undef WINOGRAD_TAPS
+'''.replace('\n', '\r\n').replace('\r\r\n', '\r\n')
+        with open(os.path.join(WEIGHTS, name + '_winograd.c'), 'w', encoding='latin-1', newline='') as f:
+            f.write(out)
+
+
+if __name__ == '__main__':
+    main()